@@ -0,0 +1,244 @@
+/*******************************************************************************
+  Host Test Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    chacha_poly_cm4_test.c
+
+  Summary:
+    Host check of the ChaCha20 and Poly1305 kernels against RFC 8439.
+
+  Description:
+    This program runs the portable build of crypto_chacha_poly_cm4.c (the
+    UMAAL step falls back to C on non-ARMv7E-M targets) on the host against
+    the RFC 8439 test vectors:
+      - 2.4.2 ChaCha20 encryption, with the input split at every 7 bytes
+      - draft-strombergson-chacha-test-vectors TC1, the 128-bit key case,
+        with the input split at every 7 bytes
+      - 2.5.2 Poly1305, with the input split at every 3 bytes
+      - 2.6.2 Poly1305 key generation
+      - 2.8.2 ChaCha20-Poly1305 AEAD, built from the two kernels
+      - A.3 #6 and #7 Poly1305 carries and reduction
+
+    Build and run from this directory; stub/ stands in for crypto_common.h,
+    which pulls in the device headers:
+      gcc -Wall -DCRYPTO_CHACHA_POLY_CM4 -Istub -I../src/config/default \
+          chacha_poly_cm4_test.c \
+          ../src/config/default/crypto/wolfcrypt/src/crypto_chacha_poly_cm4.c \
+          -o chacha_poly_cm4_test && ./chacha_poly_cm4_test
+
+    The symmetric app builds the same kernel file. The exit status is the
+    number of failed checks.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include "crypto/wolfcrypt/crypto_chacha_poly_cm4.h"
+
+static int failed = 0;
+
+static void HexToBytes(const char *ptr_hex, uint8_t *ptr_out)
+{
+    size_t i;
+    unsigned int val;
+
+    for (i = 0; i < (strlen(ptr_hex) / 2U); i++)
+    {
+        (void) sscanf(&ptr_hex[2U * i], "%2x", &val);
+        ptr_out[i] = (uint8_t)val;
+    }
+}
+
+static void Check(const char *ptr_name, const uint8_t *ptr_got, const uint8_t *ptr_exp, size_t len)
+{
+    bool ok = (memcmp(ptr_got, ptr_exp, len) == 0);
+
+    printf("%-44s %s\n", ptr_name, ok ? "OK" : "FAIL");
+    if (!ok)
+    {
+        failed++;
+    }
+}
+
+static const char sunscreen[] = "Ladies and Gentlemen of the class of '99: "
+    "If I could offer you only one tip for the future, sunscreen would be it.";
+
+/* RFC 8439 2.4.2 */
+static void Test_ChaCha20(void)
+{
+    CRYPTO_CHACHA20_CM4_CTX chaCha;
+    uint8_t key[32], nonce[12], ct[114], exp[114];
+    uint32_t split;
+    bool ok = true;
+
+    for (split = 0; split < 32U; split++)
+    {
+        key[split] = (uint8_t)split;
+    }
+    HexToBytes("000000000000004a00000000", nonce);
+    HexToBytes("6e2e359a2568f98041ba0728dd0d6981e97e7aec1d4360c20a27afccfd9fae0b"
+               "f91b65c5524733ab8f593dabcd62b3571639d624e65152ab8f530c359f0861d8"
+               "07ca0dbf500d6a6156a38e088a22b65e52bc514d16ccf806818ce91ab7793736"
+               "5af90bbf74a35be6b40b8eedf2785e42874d", exp);
+
+    for (split = 0; (split < 114U) && ok; split += 7U)
+    {
+        Crypto_ChaCha20_Cm4_SetKey(&chaCha, key, sizeof(key));
+        Crypto_ChaCha20_Cm4_SetIv(&chaCha, nonce, 1U);
+        Crypto_ChaCha20_Cm4_Process(&chaCha, ct, (const uint8_t *)sunscreen, split);
+        Crypto_ChaCha20_Cm4_Process(&chaCha, &ct[split], (const uint8_t *)&sunscreen[split], 114U - split);
+        ok = (memcmp(ct, exp, sizeof(ct)) == 0);
+    }
+    Check("RFC 8439 2.4.2 ChaCha20", ct, exp, sizeof(ct));
+}
+
+/* draft-strombergson-chacha-test-vectors TC1, 128-bit all zero key and
+ * nonce, 20 rounds: the first two key stream blocks */
+static void Test_ChaCha20Key128(void)
+{
+    CRYPTO_CHACHA20_CM4_CTX chaCha;
+    uint8_t key[16] = {0}, nonce[12] = {0}, zeros[128] = {0}, ks[128], exp[128];
+    uint32_t split;
+    bool ok = true;
+
+    HexToBytes("89670952608364fd00b2f90936f031c8e756e15dba04b8493d00429259b20f46"
+               "cc04f111246b6c2ce066be3bfb32d9aa0fddfbc12123d4b9e44f34dca05a103f"
+               "6cd135c2878c832b5896b134f6142a9d4d8d0d8f1026d20a0a81512cbce6e975"
+               "8a7143d021978022a384141a80cea3062f41f67a752e66ad3411984c787e30ad", exp);
+
+    for (split = 0; (split < 128U) && ok; split += 7U)
+    {
+        Crypto_ChaCha20_Cm4_SetKey(&chaCha, key, sizeof(key));
+        Crypto_ChaCha20_Cm4_SetIv(&chaCha, nonce, 0U);
+        Crypto_ChaCha20_Cm4_Process(&chaCha, ks, zeros, split);
+        Crypto_ChaCha20_Cm4_Process(&chaCha, &ks[split], &zeros[split], 128U - split);
+        ok = (memcmp(ks, exp, sizeof(ks)) == 0);
+    }
+    Check("ChaCha20 128-bit key", ks, exp, sizeof(ks));
+}
+
+/* RFC 8439 2.5.2 */
+static void Test_Poly1305(void)
+{
+    CRYPTO_POLY1305_CM4_CTX poly;
+    static const char msg[] = "Cryptographic Forum Research Group";
+    uint8_t key[32], tag[16], exp[16];
+    uint32_t split;
+    bool ok = true;
+
+    HexToBytes("85d6be7857556d337f4452fe42d506a80103808afb0db2fd4abff6af4149f51b", key);
+    HexToBytes("a8061dc1305136c6c22b8baf0c0127a9", exp);
+
+    for (split = 0; (split < 34U) && ok; split += 3U)
+    {
+        Crypto_Poly1305_Cm4_Init(&poly, key);
+        Crypto_Poly1305_Cm4_Update(&poly, (const uint8_t *)msg, split);
+        Crypto_Poly1305_Cm4_Update(&poly, (const uint8_t *)&msg[split], 34U - split);
+        Crypto_Poly1305_Cm4_Final(&poly, tag);
+        ok = (memcmp(tag, exp, sizeof(tag)) == 0);
+    }
+    Check("RFC 8439 2.5.2 Poly1305", tag, exp, sizeof(tag));
+}
+
+/* One-time Poly1305 key: the first 32 bytes of the block with counter 0 */
+static void PolyKeyGen(const uint8_t *ptr_key, const uint8_t *ptr_nonce, uint8_t *ptr_polyKey)
+{
+    CRYPTO_CHACHA20_CM4_CTX chaCha;
+    uint8_t zeros[32] = {0};
+
+    Crypto_ChaCha20_Cm4_SetKey(&chaCha, ptr_key, CRYPTO_CHACHA20_CM4_KEYSIZE);
+    Crypto_ChaCha20_Cm4_SetIv(&chaCha, ptr_nonce, 0U);
+    Crypto_ChaCha20_Cm4_Process(&chaCha, ptr_polyKey, zeros, sizeof(zeros));
+}
+
+/* RFC 8439 2.6.2 */
+static void Test_PolyKeyGen(void)
+{
+    uint8_t key[32], nonce[12], polyKey[32], exp[32];
+
+    HexToBytes("808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f", key);
+    HexToBytes("000000000001020304050607", nonce);
+    HexToBytes("8ad5a08b905f81cc815040274ab29471a833b637e3fd0da508dbb8e2fdd1a646", exp);
+
+    PolyKeyGen(key, nonce, polyKey);
+    Check("RFC 8439 2.6.2 Poly1305 key generation", polyKey, exp, sizeof(exp));
+}
+
+/* RFC 8439 2.8.2 */
+static void Test_Aead(void)
+{
+    CRYPTO_CHACHA20_CM4_CTX chaCha;
+    CRYPTO_POLY1305_CM4_CTX poly;
+    uint8_t key[32], nonce[12], aad[12], polyKey[32], ct[114], tag[16];
+    uint8_t expCt[114], expTag[16], pad[16] = {0}, lens[16] = {0};
+
+    HexToBytes("808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f", key);
+    HexToBytes("070000004041424344454647", nonce);
+    HexToBytes("50515253c0c1c2c3c4c5c6c7", aad);
+    HexToBytes("d31a8d34648e60db7b86afbc53ef7ec2a4aded51296e08fea9e2b5a736ee62d6"
+               "3dbea45e8ca9671282fafb69da92728b1a71de0a9e060b2905d6a5b67ecd3b36"
+               "92ddbd7f2d778b8c9803aee328091b58fab324e4fad675945585808b4831d7bc"
+               "3ff4def08e4b7a9de576d26586cec64b6116", expCt);
+    HexToBytes("1ae10b594f09e26a7e902ecbd0600691", expTag);
+
+    PolyKeyGen(key, nonce, polyKey);
+    Crypto_ChaCha20_Cm4_SetKey(&chaCha, key, sizeof(key));
+    Crypto_ChaCha20_Cm4_SetIv(&chaCha, nonce, 1U);
+    Crypto_ChaCha20_Cm4_Process(&chaCha, ct, (const uint8_t *)sunscreen, sizeof(ct));
+
+    /* AAD || pad16 || C || pad16 || len(AAD) || len(C), lengths in LE */
+    lens[0] = (uint8_t)sizeof(aad);
+    lens[8] = (uint8_t)sizeof(ct);
+    Crypto_Poly1305_Cm4_Init(&poly, polyKey);
+    Crypto_Poly1305_Cm4_Update(&poly, aad, sizeof(aad));
+    Crypto_Poly1305_Cm4_Update(&poly, pad, 16U - (sizeof(aad) % 16U));
+    Crypto_Poly1305_Cm4_Update(&poly, ct, sizeof(ct));
+    Crypto_Poly1305_Cm4_Update(&poly, pad, 16U - (sizeof(ct) % 16U));
+    Crypto_Poly1305_Cm4_Update(&poly, lens, sizeof(lens));
+    Crypto_Poly1305_Cm4_Final(&poly, tag);
+
+    Check("RFC 8439 2.8.2 AEAD ciphertext", ct, expCt, sizeof(ct));
+    Check("RFC 8439 2.8.2 AEAD tag", tag, expTag, sizeof(tag));
+}
+
+/* RFC 8439 A.3 #6 and #7, h reaching p and the final carries */
+static void Test_PolyEdges(void)
+{
+    CRYPTO_POLY1305_CM4_CTX poly;
+    uint8_t key[32] = {0}, msg[48] = {0}, tag[16], exp[16];
+
+    key[0] = 2U;
+    (void) memset(msg, 0xFF, 16U);
+    HexToBytes("03000000000000000000000000000000", exp);
+    Crypto_Poly1305_Cm4_Init(&poly, key);
+    Crypto_Poly1305_Cm4_Update(&poly, msg, 16U);
+    Crypto_Poly1305_Cm4_Final(&poly, tag);
+    Check("RFC 8439 A.3 #6 Poly1305", tag, exp, sizeof(tag));
+
+    key[0] = 1U;
+    (void) memset(msg, 0xFF, 32U);
+    msg[16] = 0xF0U;
+    msg[32] = 0x11U;
+    HexToBytes("05000000000000000000000000000000", exp);
+    Crypto_Poly1305_Cm4_Init(&poly, key);
+    Crypto_Poly1305_Cm4_Update(&poly, msg, 48U);
+    Crypto_Poly1305_Cm4_Final(&poly, tag);
+    Check("RFC 8439 A.3 #7 Poly1305", tag, exp, sizeof(tag));
+}
+
+int main(void)
+{
+    Test_ChaCha20();
+    Test_ChaCha20Key128();
+    Test_Poly1305();
+    Test_PolyKeyGen();
+    Test_Aead();
+    Test_PolyEdges();
+
+    printf("%s\n", (failed == 0) ? "All checks passed" : "Checks failed");
+
+    return failed;
+}
@@ -0,0 +1,16 @@
+/*******************************************************************************
+  Host stand-in for crypto_common.h
+
+  Summary:
+    Lets the kernel file build on the host without the device headers that
+    the firmware crypto_common.h pulls in through wolfcrypt_config.h.
+*******************************************************************************/
+
+#ifndef CRYPTO_COMMON_H
+#define CRYPTO_COMMON_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#endif //CRYPTO_COMMON_H
@@ -11,8 +11,8 @@
     Provides test vectors and functions for cryptographic tests.
 
   Description:
-    This file contains test vectors and functions to test AEAD GCM and CCM
-    cryptographic functionalities.
+    This file contains test vectors and functions to test AEAD GCM, CCM,
+    ChaCha20-Poly1305 and GCM-SIV cryptographic functionalities.
  *******************************************************************************/
 
 /* ************************************************************************** */
@@ -90,6 +90,162 @@ uint8_t AEAD_CCM_Tag[4] = {
     0x02, 0x20, 0x9f, 0x55
 };
 
+
+// *****************************************************************************
+/* RFC 8439 Test Vectors
+
+  Summary:
+    ChaCha20-Poly1305 AEAD test vector from RFC 8439 section 2.8.2.
+
+  Description:
+    https://www.rfc-editor.org/rfc/rfc8439#section-2.8.2
+*/
+
+uint8_t chaChaPolyData[114];
+
+uint8_t AEAD_CHACHAPOLY_Plaintext[114] = {
+    0x4c, 0x61, 0x64, 0x69, 0x65, 0x73, 0x20, 0x61,
+    0x6e, 0x64, 0x20, 0x47, 0x65, 0x6e, 0x74, 0x6c,
+    0x65, 0x6d, 0x65, 0x6e, 0x20, 0x6f, 0x66, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x63, 0x6c, 0x61, 0x73,
+    0x73, 0x20, 0x6f, 0x66, 0x20, 0x27, 0x39, 0x39,
+    0x3a, 0x20, 0x49, 0x66, 0x20, 0x49, 0x20, 0x63,
+    0x6f, 0x75, 0x6c, 0x64, 0x20, 0x6f, 0x66, 0x66,
+    0x65, 0x72, 0x20, 0x79, 0x6f, 0x75, 0x20, 0x6f,
+    0x6e, 0x6c, 0x79, 0x20, 0x6f, 0x6e, 0x65, 0x20,
+    0x74, 0x69, 0x70, 0x20, 0x66, 0x6f, 0x72, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x66, 0x75, 0x74, 0x75,
+    0x72, 0x65, 0x2c, 0x20, 0x73, 0x75, 0x6e, 0x73,
+    0x63, 0x72, 0x65, 0x65, 0x6e, 0x20, 0x77, 0x6f,
+    0x75, 0x6c, 0x64, 0x20, 0x62, 0x65, 0x20, 0x69,
+    0x74, 0x2e
+};
+
+uint8_t AEAD_CHACHAPOLY_Key[32] = {
+    0x80, 0x81, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8a, 0x8b, 0x8c, 0x8d, 0x8e, 0x8f,
+    0x90, 0x91, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97,
+    0x98, 0x99, 0x9a, 0x9b, 0x9c, 0x9d, 0x9e, 0x9f
+};
+
+uint8_t AEAD_CHACHAPOLY_Nonce[12] = {
+    0x07, 0x00, 0x00, 0x00, 0x40, 0x41, 0x42, 0x43,
+    0x44, 0x45, 0x46, 0x47
+};
+
+uint8_t AEAD_CHACHAPOLY_AAD[12] = {
+    0x50, 0x51, 0x52, 0x53, 0xc0, 0xc1, 0xc2, 0xc3,
+    0xc4, 0xc5, 0xc6, 0xc7
+};
+
+uint8_t AEAD_CHACHAPOLY_Ciphertext[114] = {
+    0xd3, 0x1a, 0x8d, 0x34, 0x64, 0x8e, 0x60, 0xdb,
+    0x7b, 0x86, 0xaf, 0xbc, 0x53, 0xef, 0x7e, 0xc2,
+    0xa4, 0xad, 0xed, 0x51, 0x29, 0x6e, 0x08, 0xfe,
+    0xa9, 0xe2, 0xb5, 0xa7, 0x36, 0xee, 0x62, 0xd6,
+    0x3d, 0xbe, 0xa4, 0x5e, 0x8c, 0xa9, 0x67, 0x12,
+    0x82, 0xfa, 0xfb, 0x69, 0xda, 0x92, 0x72, 0x8b,
+    0x1a, 0x71, 0xde, 0x0a, 0x9e, 0x06, 0x0b, 0x29,
+    0x05, 0xd6, 0xa5, 0xb6, 0x7e, 0xcd, 0x3b, 0x36,
+    0x92, 0xdd, 0xbd, 0x7f, 0x2d, 0x77, 0x8b, 0x8c,
+    0x98, 0x03, 0xae, 0xe3, 0x28, 0x09, 0x1b, 0x58,
+    0xfa, 0xb3, 0x24, 0xe4, 0xfa, 0xd6, 0x75, 0x94,
+    0x55, 0x85, 0x80, 0x8b, 0x48, 0x31, 0xd7, 0xbc,
+    0x3f, 0xf4, 0xde, 0xf0, 0x8e, 0x4b, 0x7a, 0x9d,
+    0xe5, 0x76, 0xd2, 0x65, 0x86, 0xce, 0xc6, 0x4b,
+    0x61, 0x16
+};
+
+uint8_t AEAD_CHACHAPOLY_Tag[16] = {
+    0x1a, 0xe1, 0x0b, 0x59, 0x4f, 0x09, 0xe2, 0x6a,
+    0x7e, 0x90, 0x2e, 0xcb, 0xd0, 0x60, 0x06, 0x91
+};
+
+
+// *****************************************************************************
+/* RFC 8452 Test Vectors
+
+  Summary:
+    AEAD_AES_128_GCM_SIV test vector from RFC 8452 appendix C.1.
+
+  Description:
+    https://www.rfc-editor.org/rfc/rfc8452#appendix-C.1
+*/
+
+uint8_t gcmSivData[8];
+
+uint8_t AEAD_GCMSIV_Plaintext[8] = {
+    0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+uint8_t AEAD_GCMSIV_Key[16] = {
+    0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+uint8_t AEAD_GCMSIV_Nonce[12] = {
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00
+};
+
+uint8_t AEAD_GCMSIV_AAD[1] = {
+    0x01
+};
+
+uint8_t AEAD_GCMSIV_Ciphertext[8] = {
+    0x1e, 0x6d, 0xab, 0xa3, 0x56, 0x69, 0xf4, 0x27
+};
+
+uint8_t AEAD_GCMSIV_Tag[16] = {
+    0x3b, 0x0a, 0x1a, 0x25, 0x60, 0x96, 0x9c, 0xdf,
+    0x79, 0x0d, 0x99, 0x75, 0x9a, 0xbd, 0x15, 0x08
+};
+
+
+// *****************************************************************************
+/* AES-GCM batch frames
+
+  Summary:
+    Frame buffers for the AES-GCM batch benchmark.
+
+  Description:
+    The frames are filled with a counter pattern by AES_GCM_Batch_Test and
+    protected with AEAD_GCM_Key.
+*/
+
+st_Crypto_Aead_AesGcm_Frame gcmBatchFrames[APP_GCM_BATCH_FRAMES];
+
+uint8_t gcmBatchIv[APP_GCM_BATCH_FRAMES][12];
+
+uint8_t gcmBatchAad[APP_GCM_BATCH_FRAMES][8];
+
+uint8_t gcmBatchPt[APP_GCM_BATCH_FRAMES][APP_GCM_BATCH_FRAME_SIZE];
+
+uint8_t gcmBatchCipher[APP_GCM_BATCH_FRAMES][APP_GCM_BATCH_FRAME_SIZE];
+
+uint8_t gcmBatchData[APP_GCM_BATCH_FRAMES][APP_GCM_BATCH_FRAME_SIZE];
+
+uint8_t gcmBatchTag[APP_GCM_BATCH_FRAMES][16];
+
+
+// *****************************************************************************
+/* AES-GCM APDU buffers
+
+  Summary:
+    Buffers for the AES-GCM verify-then-decrypt benchmark.
+
+  Description:
+    The plaintext is filled with a counter pattern by AES_GCM_Verify_Test.
+*/
+
+uint8_t gcmApduPt[APP_GCM_APDU_SIZE];
+
+uint8_t gcmApduCipher[APP_GCM_APDU_SIZE];
+
+uint8_t gcmApduData[APP_GCM_APDU_SIZE];
+
+uint8_t gcmApduTag[16];
+
 /* ************************************************************************** */
 /* ************************************************************************** */
 // Section: Interface Functions                                               */
@@ -170,6 +326,252 @@ void AES_CCM_Test (crypto_HandlerType_E cryptoHandler)
     AES_CCM_MultiStep(&AES_CCM);
 }
 
+/*******************************************************************************
+  Function:
+    void AES_GMAC_Test (crypto_HandlerType_E cryptoHandler)
+
+  Remarks:
+    See prototype in app_config.
+ */
+
+void AES_GMAC_Test (crypto_HandlerType_E cryptoHandler)
+{
+    st_Crypto_Mac_Aes_ctx AesGmac_ctx;
+    
+    /* The NIST GCM vector has an empty plaintext, so its tag is also the
+     * GMAC of AEAD_GCM_AAD under AEAD_GCM_Key and AEAD_GCM_IV. */
+    
+    GMAC AES_GMAC = {
+        .AesGmac_ctx = AesGmac_ctx,
+        .handler     = cryptoHandler,
+        .key         = AEAD_GCM_Key,
+        .keySize     = sizeof(AEAD_GCM_Key),
+        .iv          = AEAD_GCM_IV,
+        .ivSize      = sizeof(AEAD_GCM_IV),
+        .aad         = AEAD_GCM_AAD,
+        .aadSize     = sizeof(AEAD_GCM_AAD),
+        .authTag     = AEAD_GCM_Tag,
+        .authTagSize = sizeof(AEAD_GCM_Tag),
+        .symData     = symData,
+        .symDataSize = sizeof(symData)
+    };
+
+    printf("\r\nAES-GMAC Direct\r\n");
+    AES_GMAC_SingleStep(&AES_GMAC);
+
+    printf("\r\nAES-GMAC vs AES-GCM (empty plaintext) benchmark\r\n");
+    AES_GMAC_Benchmark(&AES_GMAC);
+}
+
+/*******************************************************************************
+  Function:
+    void AES_GCM_Batch_Test (crypto_HandlerType_E cryptoHandler)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void AES_GCM_Batch_Test (crypto_HandlerType_E cryptoHandler)
+{
+    uint32_t frame, i;
+    
+    GCM_BATCH AES_GCM_BATCH = {
+        .handler     = cryptoHandler,
+        .key         = AEAD_GCM_Key,
+        .keySize     = sizeof(AEAD_GCM_Key),
+        .frames      = gcmBatchFrames,
+        .numFrames   = APP_GCM_BATCH_FRAMES,
+        .frameSize   = APP_GCM_BATCH_FRAME_SIZE,
+        .pt          = &gcmBatchPt[0][0],
+        .cipher      = &gcmBatchCipher[0][0],
+        .symData     = &gcmBatchData[0][0]
+    };
+    
+    for (frame = 0; frame < APP_GCM_BATCH_FRAMES; frame++)
+    {
+        /* Distinct IV per frame: fixed field || frame counter */
+        (void) memcpy(gcmBatchIv[frame], AEAD_GCM_IV, sizeof(gcmBatchIv[frame]));
+        gcmBatchIv[frame][11] = (uint8_t)frame;
+        
+        for (i = 0; i < sizeof(gcmBatchAad[frame]); i++)
+        {
+            gcmBatchAad[frame][i] = (uint8_t)(frame + i);
+        }
+        for (i = 0; i < APP_GCM_BATCH_FRAME_SIZE; i++)
+        {
+            gcmBatchPt[frame][i] = (uint8_t)((frame * APP_GCM_BATCH_FRAME_SIZE) + i);
+        }
+        
+        gcmBatchFrames[frame].ptr_initVect  = gcmBatchIv[frame];
+        gcmBatchFrames[frame].initVectLen   = sizeof(gcmBatchIv[frame]);
+        gcmBatchFrames[frame].ptr_aad       = gcmBatchAad[frame];
+        gcmBatchFrames[frame].aadLen        = sizeof(gcmBatchAad[frame]);
+        gcmBatchFrames[frame].ptr_inputData = gcmBatchPt[frame];
+        gcmBatchFrames[frame].dataLen       = APP_GCM_BATCH_FRAME_SIZE;
+        gcmBatchFrames[frame].ptr_outData   = gcmBatchCipher[frame];
+        gcmBatchFrames[frame].ptr_authTag   = gcmBatchTag[frame];
+    }
+
+    printf("\r\nAES-GCM frame by frame vs batch benchmark\r\n");
+    AES_GCM_Batch_Benchmark(&AES_GCM_BATCH);
+}
+
+/*******************************************************************************
+  Function:
+    void AES_GCM_Verify_Test (crypto_HandlerType_E cryptoHandler)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void AES_GCM_Verify_Test (crypto_HandlerType_E cryptoHandler)
+{
+    st_Crypto_Aead_AesGcm_ctx AesGcm_ctx;
+    uint32_t i;
+    
+    GCM AES_GCM_APDU = {
+        .AesGcm_ctx = AesGcm_ctx,
+        .handler     = cryptoHandler,
+        .pt          = gcmApduPt,
+        .ptSize      = sizeof(gcmApduPt),
+        .cipher      = gcmApduCipher,
+        .cipherSize  = sizeof(gcmApduCipher),
+        .symData     = gcmApduData,
+        .symDataSize = sizeof(gcmApduData),
+        .key         = AEAD_GCM_Key,
+        .keySize     = sizeof(AEAD_GCM_Key),
+        .iv          = AEAD_GCM_IV,
+        .ivSize      = sizeof(AEAD_GCM_IV),
+        .aad         = AEAD_GCM_AAD,
+        .aadSize     = sizeof(AEAD_GCM_AAD),
+        .authTag     = gcmApduTag,
+        .authTagSize = sizeof(gcmApduTag)
+    };
+    
+    for (i = 0; i < sizeof(gcmApduPt); i++)
+    {
+        gcmApduPt[i] = (uint8_t)i;
+    }
+
+    printf("\r\nAES-GCM decrypt then compare vs verify then decrypt\r\n");
+    AES_GCM_Verify_Benchmark(&AES_GCM_APDU);
+}
+
+/*******************************************************************************
+  Function:
+    void ChaCha20Poly1305_Test (crypto_HandlerType_E cryptoHandler)
+
+  Remarks:
+    See prototype in app_config.
+ */
+
+void ChaCha20Poly1305_Test (crypto_HandlerType_E cryptoHandler)
+{
+    st_Crypto_Aead_ChaChaPoly_ctx ChaChaPoly_ctx;
+    
+    CHACHA_POLY CHACHA20_POLY1305 = {
+        .ChaChaPoly_ctx = ChaChaPoly_ctx,
+        .handler     = cryptoHandler,
+        .pt          = AEAD_CHACHAPOLY_Plaintext,
+        .ptSize      = sizeof(AEAD_CHACHAPOLY_Plaintext),
+        .cipher      = AEAD_CHACHAPOLY_Ciphertext,
+        .cipherSize  = sizeof(AEAD_CHACHAPOLY_Ciphertext),
+        .symData     = chaChaPolyData,
+        .symDataSize = sizeof(chaChaPolyData),
+        .key         = AEAD_CHACHAPOLY_Key,
+        .keySize     = sizeof(AEAD_CHACHAPOLY_Key),
+        .nonce       = AEAD_CHACHAPOLY_Nonce,
+        .nonceSize   = sizeof(AEAD_CHACHAPOLY_Nonce),
+        .aad         = AEAD_CHACHAPOLY_AAD,
+        .aadSize     = sizeof(AEAD_CHACHAPOLY_AAD),
+        .authTag     = AEAD_CHACHAPOLY_Tag,
+        .authTagSize = sizeof(AEAD_CHACHAPOLY_Tag)
+    };
+
+    printf("\r\nChaCha20-Poly1305 Encrypt\r\n");
+    CHACHA20_POLY1305.operation = CRYPTO_CIOP_ENCRYPT;
+    ChaCha20Poly1305_SingleStep(&CHACHA20_POLY1305);
+
+    printf("\r\nChaCha20-Poly1305 Decrypt\r\n");
+    CHACHA20_POLY1305.operation = CRYPTO_CIOP_DECRYPT;
+    ChaCha20Poly1305_SingleStep(&CHACHA20_POLY1305);
+}
+
+/*******************************************************************************
+  Function:
+    void AES_GCM_SIV_Test (crypto_HandlerType_E cryptoHandler)
+
+  Remarks:
+    See prototype in app_config.
+ */
+
+void AES_GCM_SIV_Test (crypto_HandlerType_E cryptoHandler)
+{
+    st_Crypto_Aead_AesGcmSiv_ctx GcmSiv_ctx;
+    
+    GCM_SIV AES_GCM_SIV = {
+        .GcmSiv_ctx  = GcmSiv_ctx,
+        .handler     = cryptoHandler,
+        .pt          = AEAD_GCMSIV_Plaintext,
+        .ptSize      = sizeof(AEAD_GCMSIV_Plaintext),
+        .cipher      = AEAD_GCMSIV_Ciphertext,
+        .cipherSize  = sizeof(AEAD_GCMSIV_Ciphertext),
+        .symData     = gcmSivData,
+        .symDataSize = sizeof(gcmSivData),
+        .key         = AEAD_GCMSIV_Key,
+        .keySize     = sizeof(AEAD_GCMSIV_Key),
+        .nonce       = AEAD_GCMSIV_Nonce,
+        .nonceSize   = sizeof(AEAD_GCMSIV_Nonce),
+        .aad         = AEAD_GCMSIV_AAD,
+        .aadSize     = sizeof(AEAD_GCMSIV_AAD),
+        .authTag     = AEAD_GCMSIV_Tag,
+        .authTagSize = sizeof(AEAD_GCMSIV_Tag)
+    };
+
+    printf("\r\nAES-GCM-SIV Encrypt\r\n");
+    AES_GCM_SIV.operation = CRYPTO_CIOP_ENCRYPT;
+    AES_GCM_SIV_SingleStep(&AES_GCM_SIV);
+
+    printf("\r\nAES-GCM-SIV Decrypt\r\n");
+    AES_GCM_SIV.operation = CRYPTO_CIOP_DECRYPT;
+    AES_GCM_SIV_SingleStep(&AES_GCM_SIV);
+}
+
+/*******************************************************************************
+  Function:
+    void AES_GCM_CryptoCb_Test (void)
+
+  Remarks:
+    See prototype in app_config.
+ */
+
+void AES_GCM_CryptoCb_Test (void)
+{
+    st_Crypto_Aead_AesGcm_ctx AesGcm_ctx;
+    
+    GCM AES_GCM = {
+        .AesGcm_ctx = AesGcm_ctx,
+        .handler     = CRYPTO_HANDLER_SW_WOLFCRYPT,
+        .pt          = AEAD_GCM_Plaintext,
+        .ptSize      = sizeof(AEAD_GCM_Plaintext),
+        .cipher      = cipher,
+        .cipherSize  = sizeof(cipher),
+        .symData     = symData,
+        .symDataSize = sizeof(symData),
+        .key         = AEAD_GCM_Key,
+        .keySize     = sizeof(AEAD_GCM_Key),
+        .iv          = AEAD_GCM_IV,
+        .ivSize      = sizeof(AEAD_GCM_IV),
+        .aad         = AEAD_GCM_AAD,
+        .aadSize     = sizeof(AEAD_GCM_AAD),
+        .authTag     = AEAD_GCM_Tag,
+        .authTagSize = sizeof(AEAD_GCM_Tag)
+    };
+
+    printf("\r\nAES-GCM wc_AesGcm Encrypt->Decrypt\r\n");
+    AES_GCM_CryptoCb(&AES_GCM);
+}
+
 /*******************************************************************************
   Function:
     bool CompareHexArray (uint8_t *arr1, uint8_t *arr2, size_t size)
@@ -11,8 +11,8 @@
     Provides test vectors and functions for cryptographic tests.
 
   Description:
-    This file contains test vectors and functions to test AEAD GCM and CCM
-    cryptographic functionalities.
+    This file contains test vectors and functions to test AEAD GCM, CCM,
+    ChaCha20-Poly1305 and GCM-SIV cryptographic functionalities.
  *******************************************************************************/
 
 #ifndef APP_CONFIG_H    /* Guard against multiple inclusion */
@@ -27,6 +27,7 @@
 #include "configuration.h"
 #include "crypto/common_crypto/crypto_common.h"
 #include "crypto/common_crypto/crypto_aead_cipher.h"
+#include "crypto/common_crypto/crypto_mac_cipher.h"
 #include "definitions.h"
 
 /* Provide C++ Compatibility */
@@ -129,6 +130,170 @@ extern "C" {
         size_t authTagSize;
     } CCM;
 
+    // *****************************************************************************
+    /** GMAC
+
+      @Summary
+        Data structure for GMAC context.
+    
+      @Description
+        This structure contains all the necessary parameters for performing GMAC
+        (GCM authentication-only) operations. It includes the context, handler,
+        key, initialization vector (IV), authenticated data and the expected
+        and computed authentication tags.
+    
+      @Remarks
+        This structure is used in the GMAC test and benchmark functions.
+     */
+
+    typedef struct
+    {
+        st_Crypto_Mac_Aes_ctx AesGmac_ctx;
+
+        crypto_HandlerType_E handler;
+
+        uint8_t *key;
+        size_t keySize;
+
+        uint8_t *iv;
+        size_t ivSize;
+
+        uint8_t *aad;
+        size_t aadSize;
+
+        uint8_t *authTag;
+        size_t authTagSize;
+
+        uint8_t *symData;
+        size_t symDataSize;
+    } GMAC;
+
+    // *****************************************************************************
+    /** GCM_BATCH
+
+      @Summary
+        Data structure for an AES-GCM frame batch.
+    
+      @Description
+        This structure describes a set of small frames protected with one key
+        through the batch AES-GCM API. Each frame has its own IV, AAD,
+        plaintext, ciphertext and tag buffers; the plaintext of every frame is
+        frameSize bytes long.
+    
+      @Remarks
+        This structure is used in the AES-GCM batch benchmark.
+     */
+
+    #define APP_GCM_BATCH_FRAMES        (32U)
+    #define APP_GCM_BATCH_FRAME_SIZE    (32U)
+    #define APP_GCM_APDU_SIZE           (256U)
+
+    typedef struct
+    {
+        crypto_HandlerType_E handler;
+
+        uint8_t *key;
+        size_t keySize;
+
+        st_Crypto_Aead_AesGcm_Frame *frames;
+        size_t numFrames;
+        size_t frameSize;
+
+        uint8_t *pt;
+        uint8_t *cipher;
+        uint8_t *symData;
+    } GCM_BATCH;
+
+    // *****************************************************************************
+    /** CHACHA_POLY
+
+      @Summary
+        Data structure for ChaCha20-Poly1305 context.
+    
+      @Description
+        This structure contains all the necessary parameters for performing
+        ChaCha20-Poly1305 (RFC 8439) operations. It includes the context,
+        handler, operation, plaintext, ciphertext, key, nonce, additional
+        authenticated data (AAD), and authentication tag.
+    
+      @Remarks
+        This structure is used in the ChaCha20-Poly1305 test functions.
+     */
+
+    typedef struct
+    {
+        st_Crypto_Aead_ChaChaPoly_ctx ChaChaPoly_ctx;
+
+        crypto_HandlerType_E handler;
+        crypto_CipherOper_E operation;
+
+        uint8_t *pt;
+        size_t ptSize;
+
+        uint8_t *cipher;
+        size_t cipherSize;
+
+        uint8_t *symData;
+        size_t symDataSize;
+
+        uint8_t *key;
+        size_t keySize;
+
+        uint8_t *nonce;
+        size_t nonceSize;
+
+        uint8_t *aad;
+        size_t aadSize;
+
+        uint8_t *authTag;
+        size_t authTagSize;
+    } CHACHA_POLY;
+
+    // *****************************************************************************
+    /** GCM_SIV
+
+      @Summary
+        Data structure for AES-GCM-SIV context.
+    
+      @Description
+        This structure contains all the necessary parameters for performing
+        AES-GCM-SIV (RFC 8452) operations. It includes the context,
+        handler, operation, plaintext, ciphertext, key, nonce, additional
+        authenticated data (AAD), and authentication tag.
+    
+      @Remarks
+        This structure is used in the AES-GCM-SIV test functions.
+     */
+
+    typedef struct
+    {
+        st_Crypto_Aead_AesGcmSiv_ctx GcmSiv_ctx;
+
+        crypto_HandlerType_E handler;
+        crypto_CipherOper_E operation;
+
+        uint8_t *pt;
+        size_t ptSize;
+
+        uint8_t *cipher;
+        size_t cipherSize;
+
+        uint8_t *symData;
+        size_t symDataSize;
+
+        uint8_t *key;
+        size_t keySize;
+
+        uint8_t *nonce;
+        size_t nonceSize;
+
+        uint8_t *aad;
+        size_t aadSize;
+
+        uint8_t *authTag;
+        size_t authTagSize;
+    } GCM_SIV;
+
     // *****************************************************************************
     // *****************************************************************************
     // Section: Interface Functions
@@ -228,6 +393,193 @@ extern "C" {
 
     void AES_CCM_MultiStep (CCM *ctx);
 
+    // *****************************************************************************
+    /**
+      @Function
+        void AES_GMAC_SingleStep (GMAC *ctx)
+
+      @Summary
+        Computes a GMAC tag in one step and checks it against the expected tag.
+
+      @Description
+        This function computes the GMAC (GCM with empty plaintext) tag over the
+        authenticated data of the provided context with the direct API and
+        compares it with the expected authentication tag.
+
+      @Precondition
+        The GMAC context (GMAC structure) must be properly initialized with the
+        key, IV, authenticated data and expected tag.
+
+      @Parameters
+        @param ctx Pointer to the GMAC context (GMAC structure) containing the necessary
+                   parameters for the operation.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+     */
+
+    void AES_GMAC_SingleStep (GMAC *ctx);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void AES_GMAC_Benchmark (GMAC *ctx)
+
+      @Summary
+        Compares authentication-only throughput of GMAC and zero-length GCM.
+
+      @Description
+        This function authenticates the data of the provided context
+        a fixed number of times with the GMAC context API (key loaded once)
+        and the same number of times with AES-GCM encryption of an empty
+        plaintext, and prints the time per operation for both approaches.
+
+      @Precondition
+        The GMAC context (GMAC structure) must be properly initialized with the
+        key, IV, authenticated data and expected tag.
+
+      @Parameters
+        @param ctx Pointer to the GMAC context (GMAC structure) containing the necessary
+                   parameters for the operation.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+     */
+
+    void AES_GMAC_Benchmark (GMAC *ctx);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void AES_GCM_Batch_Benchmark (GCM_BATCH *ctx)
+
+      @Summary
+        Measures AES-GCM frames per second, frame by frame and as a batch.
+
+      @Description
+        This function protects all frames of the context once per frame with
+        the direct AES-GCM API and once with the batch API, and reports the
+        frames per second of both. The batch output is then checked frame by
+        frame against the direct API and decrypted back with the batch
+        decryption call.
+
+      @Precondition
+        The batch context (GCM_BATCH structure) must be properly initialized
+        with the key and the frame descriptors.
+
+      @Parameters
+        @param ctx Pointer to the batch context (GCM_BATCH structure).
+
+      @Returns
+        None.
+
+      @Remarks
+        The frame descriptors are rewritten to point at the ciphertext for the
+        decryption pass.
+     */
+
+    void AES_GCM_Batch_Benchmark (GCM_BATCH *ctx);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void AES_GCM_Verify_Benchmark (GCM *ctx)
+
+      @Summary
+        Compares verify-then-decrypt with the current AES-GCM decryption.
+
+      @Description
+        This function encrypts the plaintext of the context, then times the
+        current approach (decrypt into a staging buffer, then compare the
+        tag) against Crypto_Aead_AesGcm_DecryptVerifyDirect, which checks the
+        tag before writing any plaintext. It reports the latency of both and
+        the extra RAM each needs to avoid releasing unverified plaintext, and
+        checks that a corrupted tag leaves the output buffer unwritten.
+
+      @Precondition
+        The GCM context (GCM structure) must be properly initialized with the
+        key, IV, AAD and data buffers.
+
+      @Parameters
+        @param ctx Pointer to the GCM context (GCM structure).
+
+      @Returns
+        None.
+
+      @Remarks
+        The authTag buffer of the context receives the generated tag.
+     */
+
+    void AES_GCM_Verify_Benchmark (GCM *ctx);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ChaCha20Poly1305_SingleStep (CHACHA_POLY *ctx)
+
+      @Summary
+        Performs ChaCha20-Poly1305 encryption or decryption in one step.
+
+      @Description
+        This function encrypts or decrypts the data of the context with the
+        direct ChaCha20-Poly1305 API, as selected by the operation field, and
+        checks the output and the authentication tag against the expected
+        values.
+
+      @Precondition
+        The ChaCha20-Poly1305 context (CHACHA_POLY structure) must be properly
+        initialized with the key, nonce, AAD and data buffers.
+
+      @Parameters
+        @param ctx Pointer to the ChaCha20-Poly1305 context (CHACHA_POLY structure)
+                   containing the necessary parameters.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+     */
+
+    void ChaCha20Poly1305_SingleStep (CHACHA_POLY *ctx);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void AES_GCM_SIV_SingleStep (GCM_SIV *ctx)
+
+      @Summary
+        Performs AES-GCM-SIV encryption or decryption in one step.
+
+      @Description
+        This function encrypts or decrypts the data of the context with the
+        direct AES-GCM-SIV API, as selected by the operation field, and
+        checks the output and the authentication tag against the expected
+        values.
+
+      @Precondition
+        The AES-GCM-SIV context (GCM_SIV structure) must be properly
+        initialized with the key, nonce, AAD and data buffers.
+
+      @Parameters
+        @param ctx Pointer to the AES-GCM-SIV context (GCM_SIV structure)
+                   containing the necessary parameters.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+     */
+
+    void AES_GCM_SIV_SingleStep (GCM_SIV *ctx);
+
     // *****************************************************************************
     /**
       @Function
@@ -283,6 +635,205 @@ extern "C" {
      */
 
     void AES_CCM_Test (crypto_HandlerType_E cryptoHandler);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void AES_GMAC_Test (crypto_HandlerType_E cryptoHandler)
+
+      @Summary
+        Runs GMAC test vectors and the GMAC benchmark.
+
+      @Description
+        This function runs the predefined GMAC test vector to verify the
+        correctness of the GMAC implementation and then benchmarks it against
+        AES-GCM with an empty plaintext.
+
+      @Precondition
+        None.
+
+      @Parameters
+        @param cryptoHandler Handler used for the GMAC and GCM operations.
+
+      @Returns
+        None.
+
+      @Remarks
+        This function is used for testing purposes to validate the GMAC implementation.
+     */
+
+    void AES_GMAC_Test (crypto_HandlerType_E cryptoHandler);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void AES_GCM_Batch_Test (crypto_HandlerType_E cryptoHandler)
+
+      @Summary
+        Runs the AES-GCM batch benchmark.
+
+      @Description
+        This function builds APP_GCM_BATCH_FRAMES frames of
+        APP_GCM_BATCH_FRAME_SIZE bytes, each with a distinct IV and a short
+        AAD, and runs the batch benchmark on them.
+
+      @Precondition
+        None.
+
+      @Parameters
+        @param cryptoHandler Handler used for the AES-GCM operations.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+     */
+
+    void AES_GCM_Batch_Test (crypto_HandlerType_E cryptoHandler);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void AES_GCM_Verify_Test (crypto_HandlerType_E cryptoHandler)
+
+      @Summary
+        Runs the AES-GCM verify-then-decrypt benchmark.
+
+      @Description
+        This function runs the verify-then-decrypt benchmark on an
+        APP_GCM_APDU_SIZE byte message protected with the NIST GCM key, IV
+        and AAD.
+
+      @Precondition
+        None.
+
+      @Parameters
+        @param cryptoHandler Handler used for the AES-GCM operations.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+     */
+
+    void AES_GCM_Verify_Test (crypto_HandlerType_E cryptoHandler);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ChaCha20Poly1305_Test (crypto_HandlerType_E cryptoHandler)
+
+      @Summary
+        Runs ChaCha20-Poly1305 test vectors.
+
+      @Description
+        This function runs the RFC 8439 ChaCha20-Poly1305 test vector in both
+        directions to verify the correctness of the implementation.
+
+      @Precondition
+        None.
+
+      @Parameters
+        @param cryptoHandler Handler used for the ChaCha20-Poly1305 operations.
+
+      @Returns
+        None.
+
+      @Remarks
+        This function is used for testing purposes to validate the
+        ChaCha20-Poly1305 implementation.
+     */
+
+    void ChaCha20Poly1305_Test (crypto_HandlerType_E cryptoHandler);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void AES_GCM_SIV_Test (crypto_HandlerType_E cryptoHandler)
+
+      @Summary
+        Runs AES-GCM-SIV test vectors.
+
+      @Description
+        This function runs the RFC 8452 AES-GCM-SIV test vector in both
+        directions to verify the correctness of the implementation.
+
+      @Precondition
+        None.
+
+      @Parameters
+        @param cryptoHandler Handler used for the AES-GCM-SIV operations.
+
+      @Returns
+        None.
+
+      @Remarks
+        This function is used for testing purposes to validate the
+        AES-GCM-SIV implementation.
+     */
+
+    void AES_GCM_SIV_Test (crypto_HandlerType_E cryptoHandler);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void AES_GCM_CryptoCb_Test (void)
+
+      @Summary
+        Runs the AES-GCM test vector through the wolfCrypt crypto callback.
+
+      @Description
+        This function runs the AES-GCM test vector through wc_AesGcm with the
+        crypto callback device registered.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+     */
+
+    void AES_GCM_CryptoCb_Test (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void AES_GCM_CryptoCb (GCM *ctx)
+
+      @Summary
+        Checks wolfCrypt AES-GCM handed to the AES engine by the crypto 
+        callback against software.
+
+      @Description
+        This function encrypts the plaintext with wc_AesGcmEncrypt, first in 
+        software and then on an Aes object set up on the callback device. The
+        ciphertext and tag must be identical, the ciphertext must decrypt in
+        place and a forged tag must be refused with AES_GCM_AUTH_E. All three
+        callbacks must have run on the AES engine.
+
+      @Precondition
+        The GCM context (GCM structure) must be properly initialized.
+
+      @Parameters
+        @param ctx Pointer to the GCM context (GCM structure), the handler and
+                   tag are unused.
+
+      @Returns
+        None.
+
+      @Remarks
+        The device is unregistered on return.
+     */
+
+    void AES_GCM_CryptoCb (GCM *ctx);
         
     // *****************************************************************************
     /**
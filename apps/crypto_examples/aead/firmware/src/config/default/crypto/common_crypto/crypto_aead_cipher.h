@@ -84,6 +84,38 @@ typedef struct
     uint32_t aeadNonceLen;
     uint8_t arr_aeadDataCtx[512]__attribute__((aligned (4)));
 }st_Crypto_Aead_AesEax_ctx;
+
+typedef struct
+{
+    uint32_t cryptoSessionID;
+    crypto_HandlerType_E aeadHandlerType_en;
+    uint8_t *ptr_key;
+    uint32_t aeadKeySize;
+    uint8_t arr_aeadDataCtx[512]__attribute__((aligned (4)));
+}st_Crypto_Aead_ChaChaPoly_ctx;
+
+typedef struct
+{
+    uint32_t cryptoSessionID;
+    crypto_HandlerType_E aeadHandlerType_en;
+    uint8_t *ptr_key;
+    uint32_t aeadKeySize;
+    uint8_t arr_aeadDataCtx[512]__attribute__((aligned (4)));
+}st_Crypto_Aead_AesGcmSiv_ctx;
+
+//One frame of an AES-GCM batch. frameStatus_en is written by the batch call
+typedef struct
+{
+    uint8_t *ptr_initVect;
+    uint32_t initVectLen;
+    uint8_t *ptr_aad;
+    uint32_t aadLen;
+    uint8_t *ptr_inputData;
+    uint32_t dataLen;
+    uint8_t *ptr_outData;
+    uint8_t *ptr_authTag;
+    crypto_Aead_Status_E frameStatus_en;
+}st_Crypto_Aead_AesGcm_Frame;
 // *****************************************************************************
 
 crypto_Aead_Status_E Crypto_Aead_AesCcm_Init(st_Crypto_Aead_AesCcm_ctx *ptr_aesCcmCtx_st, crypto_HandlerType_E handlerType_en, 
@@ -128,4 +160,51 @@ crypto_Aead_Status_E Crypto_Aead_AesGcm_DecryptAuthDirect(crypto_HandlerType_E h
                                                             uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect, 
                                                             uint32_t initVectLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint8_t authTagLen, uint32_t sessionID);
 
+//AES-GCM decryption that checks the tag before any plaintext is written to ptr_outData.
+//Returns CRYPTO_AEAD_ERROR_AUTHFAIL and leaves ptr_outData unwritten on a tag mismatch
+crypto_Aead_Status_E Crypto_Aead_AesGcm_DecryptVerifyDirect(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData, uint32_t dataLen, 
+                                                            uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect, 
+                                                            uint32_t initVectLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint8_t authTagLen, uint32_t sessionID);
+
+//AES-GCM over an array of frames sharing one key: the arguments of all frames are
+//checked before any frame is processed and the key schedule is set up once
+crypto_Aead_Status_E Crypto_Aead_AesGcm_EncryptAuthBatch(crypto_HandlerType_E handlerType_en, uint8_t *ptr_key, uint32_t keyLen, 
+                                                            st_Crypto_Aead_AesGcm_Frame *ptr_frames, uint32_t numFrames, uint32_t authTagLen, uint32_t sessionID);
+
+crypto_Aead_Status_E Crypto_Aead_AesGcm_DecryptAuthBatch(crypto_HandlerType_E handlerType_en, uint8_t *ptr_key, uint32_t keyLen, 
+                                                            st_Crypto_Aead_AesGcm_Frame *ptr_frames, uint32_t numFrames, uint32_t authTagLen, uint32_t sessionID);
+
+//ChaCha20-Poly1305 (RFC 8439): 256-bit key, 96-bit nonce and 128-bit tag
+crypto_Aead_Status_E Crypto_Aead_ChaCha20Poly1305_Init(st_Crypto_Aead_ChaChaPoly_ctx *ptr_chaChaPolyCtx_st, crypto_HandlerType_E handlerType_en, 
+                                                        uint8_t *ptr_key, uint32_t keyLen, uint32_t sessionID);
+
+crypto_Aead_Status_E Crypto_Aead_ChaCha20Poly1305_Cipher(st_Crypto_Aead_ChaChaPoly_ctx *ptr_chaChaPolyCtx_st, crypto_CipherOper_E cipherOper_en, uint8_t *ptr_inputData, 
+                                                            uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_nonce, uint32_t nonceLen, 
+                                                            uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint32_t authTagLen);
+
+crypto_Aead_Status_E Crypto_Aead_ChaCha20Poly1305_EncryptAuthDirect(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData, uint32_t dataLen, 
+                                                            uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_nonce, 
+                                                            uint32_t nonceLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint32_t authTagLen, uint32_t sessionID);
+
+crypto_Aead_Status_E Crypto_Aead_ChaCha20Poly1305_DecryptAuthDirect(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData, uint32_t dataLen, 
+                                                            uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_nonce, 
+                                                            uint32_t nonceLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint32_t authTagLen, uint32_t sessionID);
+
+//AES-GCM-SIV (RFC 8452): 128 or 256-bit key, 96-bit nonce and 128-bit tag. The
+//key passed to Init is the key-generating key; per-nonce keys are derived internally
+crypto_Aead_Status_E Crypto_Aead_AesGcmSiv_Init(st_Crypto_Aead_AesGcmSiv_ctx *ptr_aesGcmSivCtx_st, crypto_HandlerType_E handlerType_en, 
+                                                        uint8_t *ptr_key, uint32_t keyLen, uint32_t sessionID);
+
+crypto_Aead_Status_E Crypto_Aead_AesGcmSiv_Cipher(st_Crypto_Aead_AesGcmSiv_ctx *ptr_aesGcmSivCtx_st, crypto_CipherOper_E cipherOper_en, uint8_t *ptr_inputData, 
+                                                            uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_nonce, uint32_t nonceLen, 
+                                                            uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint32_t authTagLen);
+
+crypto_Aead_Status_E Crypto_Aead_AesGcmSiv_EncryptAuthDirect(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData, uint32_t dataLen, 
+                                                            uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_nonce, 
+                                                            uint32_t nonceLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint32_t authTagLen, uint32_t sessionID);
+
+crypto_Aead_Status_E Crypto_Aead_AesGcmSiv_DecryptAuthDirect(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData, uint32_t dataLen, 
+                                                            uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_nonce, 
+                                                            uint32_t nonceLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint32_t authTagLen, uint32_t sessionID);
+
 #endif //CRYPTO_AEAD_CIPHER_H
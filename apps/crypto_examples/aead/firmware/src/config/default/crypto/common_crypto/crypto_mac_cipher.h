@@ -0,0 +1,71 @@
+/*******************************************************************************
+  MPLAB Harmony Application Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_mac_cipher.h
+
+  Summary:
+    This header file provides prototypes and definitions for the application.
+
+  Description:
+    This header file provides function prototypes and data type definitions for
+    the Message Authentication Code (MAC) algorithms of the Common Crypto API.
+    AES-GMAC is the authentication-only variant of AES-GCM (GCM with an empty
+    plaintext) as used by DLMS HLS mechanism 5 and authenticated-only security
+    policies.
+*******************************************************************************/
+
+#ifndef CRYPTO_MAC_CIPHER_H
+#define CRYPTO_MAC_CIPHER_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "crypto_common.h"
+
+typedef enum
+{
+    CRYPTO_MAC_ERROR_CIPNOTSUPPTD = -127,
+    CRYPTO_MAC_ERROR_CTX = -126,
+    CRYPTO_MAC_ERROR_KEY = -125,
+    CRYPTO_MAC_ERROR_HDLR = -124,
+    CRYPTO_MAC_ERROR_INPUTDATA = -123,
+    CRYPTO_MAC_ERROR_MACDATA = -122,
+    CRYPTO_MAC_ERROR_NONCE = -121,
+    CRYPTO_MAC_ERROR_SID = -120,  //session ID Error
+    CRYPTO_MAC_ERROR_ARG = -119,
+    CRYPTO_MAC_ERROR_CIPFAIL = -118,
+    CRYPTO_MAC_CIPHER_SUCCESS = 0,
+}crypto_Mac_Status_E;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+typedef struct
+{
+    uint32_t cryptoSessionID;
+    crypto_HandlerType_E macHandlerType_en;
+    uint8_t *ptr_key;
+    uint32_t macKeySize;
+    uint8_t arr_macDataCtx[512]__attribute__((aligned (4)));
+}st_Crypto_Mac_Aes_ctx;
+// *****************************************************************************
+
+crypto_Mac_Status_E Crypto_Mac_AesGmac_Init(st_Crypto_Mac_Aes_ctx *ptr_aesGmacCtx_st, crypto_HandlerType_E handlerType_en,
+                                              uint8_t *ptr_key, uint32_t keyLen, uint32_t sessionID);
+
+crypto_Mac_Status_E Crypto_Mac_AesGmac_Cipher(st_Crypto_Mac_Aes_ctx *ptr_aesGmacCtx_st, uint8_t *ptr_initVect, uint32_t initVectLen,
+                                                uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_outMac, uint32_t macLen);
+
+crypto_Mac_Status_E Crypto_Mac_AesGmac_Direct(crypto_HandlerType_E handlerType_en, uint8_t *ptr_initVect, uint32_t initVectLen,
+                                                uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_outMac, uint32_t macLen,
+                                                uint8_t *ptr_key, uint32_t keyLen, uint32_t sessionID);
+
+#endif //CRYPTO_MAC_CIPHER_H
@@ -712,4 +712,519 @@ crypto_Aead_Status_E Crypto_Aead_AesGcm_DecryptAuthDirect(crypto_HandlerType_E h
     }
     return ret_aesGcmStat_en;
 }
+
+crypto_Aead_Status_E Crypto_Aead_AesGcm_DecryptVerifyDirect(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData, uint32_t dataLen, 
+                                                            uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_initVect, 
+                                                            uint32_t initVectLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint8_t authTagLen, uint32_t sessionID)
+{
+    crypto_Aead_Status_E ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CIPNOTSUPPTD;
+    if( ((ptr_inputData == NULL) && (dataLen > 0u))
+        || ((ptr_inputData != NULL) && (dataLen == 0u)) )
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_INPUTDATA;
+    }
+    else if( ((ptr_inputData != NULL) && (ptr_outData == NULL))
+                || ((ptr_inputData == NULL) && (ptr_outData != NULL)) )
+    {
+       ret_aesGcmStat_en =  CRYPTO_AEAD_ERROR_OUTPUTDATA; 
+    }
+    else if( (ptr_key == NULL) || 
+                ( (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_128)
+                    && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_192)
+                    && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_256) ) ) 
+    {
+       ret_aesGcmStat_en =  CRYPTO_AEAD_ERROR_KEY;
+    }
+        else if(ptr_initVect == NULL || initVectLen == 0u)
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_NONCE;
+    }
+    else if( ((ptr_aad == NULL) && (aadLen > 0u))
+                || ((ptr_aad != NULL) && (aadLen == 0u)) )
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_AAD;
+    }
+    else if((ptr_authTag == NULL) || (authTagLen > 16u) || (authTagLen < 4u))
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_AUTHTAG;
+    }
+    else if((ptr_aad == NULL) && (ptr_inputData == NULL))
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_ARG;
+    }
+    else if( (sessionID <= 0u) || (sessionID > (uint32_t)CRYPTO_AEAD_SESSION_MAX) )
+    {
+       ret_aesGcmStat_en =  CRYPTO_AEAD_ERROR_SID; 
+    } 
+    else
+    {
+        switch(handlerType_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_aesGcmStat_en =  Crypto_Aead_Wc_AesGcm_DecryptVerifyDirect(ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, 
+                                                ptr_initVect, initVectLen, ptr_aad, aadLen, ptr_authTag, authTagLen);
+                break;
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_aesGcmStat_en = Crypto_Aead_Hw_AesGcm_DecryptVerifyDirect(ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, 
+                                                            ptr_initVect, initVectLen, ptr_aad, aadLen, ptr_authTag, authTagLen);
+                break;
+            default:
+                ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_aesGcmStat_en;
+}
+
+static crypto_Aead_Status_E lCrypto_Aead_AesGcm_CheckFrames(st_Crypto_Aead_AesGcm_Frame *ptr_frames, uint32_t numFrames)
+{
+    crypto_Aead_Status_E ret_aesGcmStat_en = CRYPTO_AEAD_CIPHER_SUCCESS;
+    uint32_t frameIdx;
+    
+    for(frameIdx = 0u; (frameIdx < numFrames) && (ret_aesGcmStat_en == CRYPTO_AEAD_CIPHER_SUCCESS); frameIdx++)
+    {
+        st_Crypto_Aead_AesGcm_Frame *ptr_frame_st = &ptr_frames[frameIdx];
+        
+        if( ((ptr_frame_st->ptr_inputData == NULL) && (ptr_frame_st->dataLen > 0u))
+                    || ((ptr_frame_st->ptr_inputData != NULL) && (ptr_frame_st->dataLen == 0u)) )
+        {
+            ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_INPUTDATA;
+        }
+        else if( ((ptr_frame_st->ptr_inputData != NULL) && (ptr_frame_st->ptr_outData == NULL))
+                    || ((ptr_frame_st->ptr_inputData == NULL) && (ptr_frame_st->ptr_outData != NULL)) )
+        {
+            ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_OUTPUTDATA;
+        }
+        else if( (ptr_frame_st->ptr_initVect == NULL) || (ptr_frame_st->initVectLen == 0u) )
+        {
+            ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_NONCE;
+        }
+        else if( ((ptr_frame_st->ptr_aad == NULL) && (ptr_frame_st->aadLen > 0u))
+                    || ((ptr_frame_st->ptr_aad != NULL) && (ptr_frame_st->aadLen == 0u)) )
+        {
+            ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_AAD;
+        }
+        else if(ptr_frame_st->ptr_authTag == NULL)
+        {
+            ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_AUTHTAG;
+        }
+        else
+        {
+            ptr_frame_st->frameStatus_en = CRYPTO_AEAD_ERROR_CIPNOTSUPPTD;
+        }
+    }
+    return ret_aesGcmStat_en;
+}
+
+static crypto_Aead_Status_E lCrypto_Aead_AesGcm_AuthBatch(crypto_HandlerType_E handlerType_en, crypto_CipherOper_E cipherOper_en, uint8_t *ptr_key, 
+                                                            uint32_t keyLen, st_Crypto_Aead_AesGcm_Frame *ptr_frames, uint32_t numFrames, 
+                                                            uint32_t authTagLen, uint32_t sessionID)
+{
+    crypto_Aead_Status_E ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CIPNOTSUPPTD;
+    
+    if( (ptr_key == NULL) || 
+                ( (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_128)
+                    && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_192)
+                    && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_256) ) ) 
+    {
+       ret_aesGcmStat_en =  CRYPTO_AEAD_ERROR_KEY;
+    }
+    else if( (ptr_frames == NULL) || (numFrames == 0u) )
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_ARG;
+    }
+    else if( (authTagLen > 16u) || (authTagLen < 4u) )
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_AUTHTAG;
+    }
+    else if( (sessionID <= 0u) || (sessionID > (uint32_t)CRYPTO_AEAD_SESSION_MAX) )
+    {
+       ret_aesGcmStat_en =  CRYPTO_AEAD_ERROR_SID; 
+    } 
+    else
+    {
+        ret_aesGcmStat_en = lCrypto_Aead_AesGcm_CheckFrames(ptr_frames, numFrames);
+    }
+    
+    if(ret_aesGcmStat_en == CRYPTO_AEAD_CIPHER_SUCCESS)
+    {
+        switch(handlerType_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_aesGcmStat_en = Crypto_Aead_Wc_AesGcm_AuthBatch(cipherOper_en, ptr_key, keyLen, ptr_frames, numFrames, authTagLen);
+                break;
+                
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_aesGcmStat_en = Crypto_Aead_Hw_AesGcm_AuthBatch(cipherOper_en, ptr_key, keyLen, ptr_frames, numFrames, authTagLen);
+                break;
+                
+            default:
+                ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_aesGcmStat_en;
+}
+
+crypto_Aead_Status_E Crypto_Aead_AesGcm_EncryptAuthBatch(crypto_HandlerType_E handlerType_en, uint8_t *ptr_key, uint32_t keyLen, 
+                                                            st_Crypto_Aead_AesGcm_Frame *ptr_frames, uint32_t numFrames, uint32_t authTagLen, uint32_t sessionID)
+{
+    return lCrypto_Aead_AesGcm_AuthBatch(handlerType_en, CRYPTO_CIOP_ENCRYPT, ptr_key, keyLen, ptr_frames, numFrames, authTagLen, sessionID);
+}
+
+crypto_Aead_Status_E Crypto_Aead_AesGcm_DecryptAuthBatch(crypto_HandlerType_E handlerType_en, uint8_t *ptr_key, uint32_t keyLen, 
+                                                            st_Crypto_Aead_AesGcm_Frame *ptr_frames, uint32_t numFrames, uint32_t authTagLen, uint32_t sessionID)
+{
+    return lCrypto_Aead_AesGcm_AuthBatch(handlerType_en, CRYPTO_CIOP_DECRYPT, ptr_key, keyLen, ptr_frames, numFrames, authTagLen, sessionID);
+}
+
+static crypto_Aead_Status_E lCrypto_Aead_ChaCha20Poly1305_Direct(crypto_HandlerType_E handlerType_en, crypto_CipherOper_E cipherOper_en, uint8_t *ptr_inputData, 
+                                                            uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_nonce, 
+                                                            uint32_t nonceLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint32_t authTagLen, uint32_t sessionID)
+{
+    crypto_Aead_Status_E ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_CIPNOTSUPPTD;
+    
+    if( ((ptr_inputData == NULL) && (dataLen > 0u))
+                || ((ptr_inputData != NULL) && (dataLen == 0u)) )
+    {
+        ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_INPUTDATA;
+    }
+    else if( ((ptr_inputData != NULL) && (ptr_outData == NULL))
+                || ((ptr_inputData == NULL) && (ptr_outData != NULL)) )
+    {
+       ret_chaChaPolyStat_en =  CRYPTO_AEAD_ERROR_OUTPUTDATA; 
+    }
+    else if( (ptr_key == NULL) || (keyLen != 32u) )
+    {
+       ret_chaChaPolyStat_en =  CRYPTO_AEAD_ERROR_KEY;
+    }
+    else if( (ptr_nonce == NULL) || (nonceLen != 12u) )
+    {
+        ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_NONCE;
+    }
+    else if( ((ptr_aad == NULL) && (aadLen > 0u))
+                || ((ptr_aad != NULL) && (aadLen == 0u)) )
+    {
+        ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_AAD;
+    }
+    else if( (ptr_authTag == NULL) || (authTagLen != 16u) )
+    {
+        ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_AUTHTAG;
+    }
+    else if( (sessionID <= 0u) || (sessionID > (uint32_t)CRYPTO_AEAD_SESSION_MAX) )
+    {
+       ret_chaChaPolyStat_en =  CRYPTO_AEAD_ERROR_SID; 
+    } 
+    else
+    {
+        switch(handlerType_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_chaChaPolyStat_en = Crypto_Aead_Wc_ChaCha20Poly1305_EncDecAuthDirect(cipherOper_en, ptr_inputData, dataLen, ptr_outData, ptr_key, 
+                                                                                    ptr_nonce, ptr_aad, aadLen, ptr_authTag);
+                break;
+                
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                //No ChaCha20 or Poly1305 engine on this device
+                break;
+                
+            default:
+                ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_chaChaPolyStat_en;
+}
+
+crypto_Aead_Status_E Crypto_Aead_ChaCha20Poly1305_Init(st_Crypto_Aead_ChaChaPoly_ctx *ptr_chaChaPolyCtx_st, crypto_HandlerType_E handlerType_en, 
+                                                        uint8_t *ptr_key, uint32_t keyLen, uint32_t sessionID)
+{
+    crypto_Aead_Status_E ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_CIPNOTSUPPTD;
+    
+    if(ptr_chaChaPolyCtx_st == NULL)
+    {
+        ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_CTX;
+    }
+    else if( (ptr_key == NULL) || (keyLen != 32u) )
+    {
+       ret_chaChaPolyStat_en =  CRYPTO_AEAD_ERROR_KEY;
+    }
+    else if( (sessionID <= 0u) || (sessionID > (uint32_t)CRYPTO_AEAD_SESSION_MAX) )
+    {
+       ret_chaChaPolyStat_en =  CRYPTO_AEAD_ERROR_SID; 
+    }
+    else
+    {
+        ptr_chaChaPolyCtx_st->cryptoSessionID =  sessionID;
+        ptr_chaChaPolyCtx_st->aeadHandlerType_en = handlerType_en;
+        ptr_chaChaPolyCtx_st->ptr_key = ptr_key;
+        ptr_chaChaPolyCtx_st->aeadKeySize = keyLen;
+        
+        switch(ptr_chaChaPolyCtx_st->aeadHandlerType_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_chaChaPolyStat_en = Crypto_Aead_Wc_ChaCha20Poly1305_Init((void*)ptr_chaChaPolyCtx_st->arr_aeadDataCtx, ptr_chaChaPolyCtx_st->ptr_key);
+                break;
+               
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                //No ChaCha20 or Poly1305 engine on this device
+                break;
+				
+            default:
+                ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_chaChaPolyStat_en;
+}
+
+crypto_Aead_Status_E Crypto_Aead_ChaCha20Poly1305_Cipher(st_Crypto_Aead_ChaChaPoly_ctx *ptr_chaChaPolyCtx_st, crypto_CipherOper_E cipherOper_en, uint8_t *ptr_inputData, 
+                                                            uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_nonce, uint32_t nonceLen, 
+                                                            uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint32_t authTagLen)
+{
+    crypto_Aead_Status_E ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_CIPNOTSUPPTD;
+    
+    if(ptr_chaChaPolyCtx_st == NULL)
+    {
+        ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_CTX;
+    }
+    else if( ((ptr_inputData == NULL) && (dataLen > 0u))
+                || ((ptr_inputData != NULL) && (dataLen == 0u)) )
+    {
+        ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_INPUTDATA;
+    }
+    else if( ((ptr_inputData != NULL) && (ptr_outData == NULL))
+                || ((ptr_inputData == NULL) && (ptr_outData != NULL)) )
+    {
+        ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_OUTPUTDATA;
+    }
+    else if( (ptr_nonce == NULL) || (nonceLen != 12u) )
+    {
+        ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_NONCE;
+    }
+    else if( ((ptr_aad == NULL) && (aadLen > 0u))
+                || ((ptr_aad != NULL) && (aadLen == 0u)) )
+    {
+        ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_AAD;
+    }
+    else if( (ptr_authTag == NULL) || (authTagLen != 16u) )
+    {
+        ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_AUTHTAG;
+    }
+    else if((cipherOper_en != CRYPTO_CIOP_ENCRYPT) && (cipherOper_en != CRYPTO_CIOP_DECRYPT))
+    {
+        ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_CIPOPER;
+    }
+    else
+    {
+        switch(ptr_chaChaPolyCtx_st->aeadHandlerType_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_chaChaPolyStat_en = Crypto_Aead_Wc_ChaCha20Poly1305_Cipher(cipherOper_en, (void*)ptr_chaChaPolyCtx_st->arr_aeadDataCtx, ptr_inputData, dataLen, 
+                                                                                ptr_outData, ptr_nonce, ptr_aad, aadLen, ptr_authTag);
+                break;
+               
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                //No ChaCha20 or Poly1305 engine on this device
+                break;
+				
+            default:
+                ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_chaChaPolyStat_en;
+}
+
+crypto_Aead_Status_E Crypto_Aead_ChaCha20Poly1305_EncryptAuthDirect(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData, uint32_t dataLen, 
+                                                            uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_nonce, 
+                                                            uint32_t nonceLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint32_t authTagLen, uint32_t sessionID)
+{
+    return lCrypto_Aead_ChaCha20Poly1305_Direct(handlerType_en, CRYPTO_CIOP_ENCRYPT, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, 
+                                                    ptr_nonce, nonceLen, ptr_aad, aadLen, ptr_authTag, authTagLen, sessionID);
+}
+
+crypto_Aead_Status_E Crypto_Aead_ChaCha20Poly1305_DecryptAuthDirect(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData, uint32_t dataLen, 
+                                                            uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_nonce, 
+                                                            uint32_t nonceLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint32_t authTagLen, uint32_t sessionID)
+{
+    return lCrypto_Aead_ChaCha20Poly1305_Direct(handlerType_en, CRYPTO_CIOP_DECRYPT, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, 
+                                                    ptr_nonce, nonceLen, ptr_aad, aadLen, ptr_authTag, authTagLen, sessionID);
+}
+// *****************************************************************************
+
+static crypto_Aead_Status_E lCrypto_Aead_AesGcmSiv_Direct(crypto_HandlerType_E handlerType_en, crypto_CipherOper_E cipherOper_en, uint8_t *ptr_inputData, 
+                                                            uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_nonce, 
+                                                            uint32_t nonceLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint32_t authTagLen, uint32_t sessionID)
+{
+    crypto_Aead_Status_E ret_aesGcmSivStat_en = CRYPTO_AEAD_ERROR_CIPNOTSUPPTD;
+    
+    if( ((ptr_inputData == NULL) && (dataLen > 0u))
+                || ((ptr_inputData != NULL) && (dataLen == 0u)) )
+    {
+        ret_aesGcmSivStat_en = CRYPTO_AEAD_ERROR_INPUTDATA;
+    }
+    else if( ((ptr_inputData != NULL) && (ptr_outData == NULL))
+                || ((ptr_inputData == NULL) && (ptr_outData != NULL)) )
+    {
+       ret_aesGcmSivStat_en =  CRYPTO_AEAD_ERROR_OUTPUTDATA; 
+    }
+    else if( (ptr_key == NULL) || ( (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_128) && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_256) ) )
+    {
+       ret_aesGcmSivStat_en =  CRYPTO_AEAD_ERROR_KEY;
+    }
+    else if( (ptr_nonce == NULL) || (nonceLen != 12u) )
+    {
+        ret_aesGcmSivStat_en = CRYPTO_AEAD_ERROR_NONCE;
+    }
+    else if( ((ptr_aad == NULL) && (aadLen > 0u))
+                || ((ptr_aad != NULL) && (aadLen == 0u)) )
+    {
+        ret_aesGcmSivStat_en = CRYPTO_AEAD_ERROR_AAD;
+    }
+    else if( (ptr_authTag == NULL) || (authTagLen != 16u) )
+    {
+        ret_aesGcmSivStat_en = CRYPTO_AEAD_ERROR_AUTHTAG;
+    }
+    else if( (sessionID <= 0u) || (sessionID > (uint32_t)CRYPTO_AEAD_SESSION_MAX) )
+    {
+       ret_aesGcmSivStat_en =  CRYPTO_AEAD_ERROR_SID; 
+    } 
+    else
+    {
+        switch(handlerType_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                //wolfCrypt provides AES-SIV (RFC 5297) but not AES-GCM-SIV
+                break;
+                
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_aesGcmSivStat_en = Crypto_Aead_Hw_AesGcmSiv_EncDecAuthDirect(cipherOper_en, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, 
+                                                                                    ptr_nonce, ptr_aad, aadLen, ptr_authTag);
+                break;
+                
+            default:
+                ret_aesGcmSivStat_en = CRYPTO_AEAD_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_aesGcmSivStat_en;
+}
+
+crypto_Aead_Status_E Crypto_Aead_AesGcmSiv_Init(st_Crypto_Aead_AesGcmSiv_ctx *ptr_aesGcmSivCtx_st, crypto_HandlerType_E handlerType_en, 
+                                                        uint8_t *ptr_key, uint32_t keyLen, uint32_t sessionID)
+{
+    crypto_Aead_Status_E ret_aesGcmSivStat_en = CRYPTO_AEAD_ERROR_CIPNOTSUPPTD;
+    
+    if(ptr_aesGcmSivCtx_st == NULL)
+    {
+        ret_aesGcmSivStat_en = CRYPTO_AEAD_ERROR_CTX;
+    }
+    else if( (ptr_key == NULL) || ( (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_128) && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_256) ) )
+    {
+       ret_aesGcmSivStat_en =  CRYPTO_AEAD_ERROR_KEY;
+    }
+    else if( (sessionID <= 0u) || (sessionID > (uint32_t)CRYPTO_AEAD_SESSION_MAX) )
+    {
+       ret_aesGcmSivStat_en =  CRYPTO_AEAD_ERROR_SID; 
+    }
+    else
+    {
+        ptr_aesGcmSivCtx_st->cryptoSessionID =  sessionID;
+        ptr_aesGcmSivCtx_st->aeadHandlerType_en = handlerType_en;
+        ptr_aesGcmSivCtx_st->ptr_key = ptr_key;
+        ptr_aesGcmSivCtx_st->aeadKeySize = keyLen;
+        
+        switch(ptr_aesGcmSivCtx_st->aeadHandlerType_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                //wolfCrypt provides AES-SIV (RFC 5297) but not AES-GCM-SIV
+                break;
+               
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_aesGcmSivStat_en = Crypto_Aead_Hw_AesGcmSiv_Init((void*)ptr_aesGcmSivCtx_st->arr_aeadDataCtx, ptr_aesGcmSivCtx_st->ptr_key, 
+                                                                        ptr_aesGcmSivCtx_st->aeadKeySize);
+                break;
+				
+            default:
+                ret_aesGcmSivStat_en = CRYPTO_AEAD_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_aesGcmSivStat_en;
+}
+
+crypto_Aead_Status_E Crypto_Aead_AesGcmSiv_Cipher(st_Crypto_Aead_AesGcmSiv_ctx *ptr_aesGcmSivCtx_st, crypto_CipherOper_E cipherOper_en, uint8_t *ptr_inputData, 
+                                                            uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_nonce, uint32_t nonceLen, 
+                                                            uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint32_t authTagLen)
+{
+    crypto_Aead_Status_E ret_aesGcmSivStat_en = CRYPTO_AEAD_ERROR_CIPNOTSUPPTD;
+    
+    if(ptr_aesGcmSivCtx_st == NULL)
+    {
+        ret_aesGcmSivStat_en = CRYPTO_AEAD_ERROR_CTX;
+    }
+    else if( ((ptr_inputData == NULL) && (dataLen > 0u))
+                || ((ptr_inputData != NULL) && (dataLen == 0u)) )
+    {
+        ret_aesGcmSivStat_en = CRYPTO_AEAD_ERROR_INPUTDATA;
+    }
+    else if( ((ptr_inputData != NULL) && (ptr_outData == NULL))
+                || ((ptr_inputData == NULL) && (ptr_outData != NULL)) )
+    {
+        ret_aesGcmSivStat_en = CRYPTO_AEAD_ERROR_OUTPUTDATA;
+    }
+    else if( (ptr_nonce == NULL) || (nonceLen != 12u) )
+    {
+        ret_aesGcmSivStat_en = CRYPTO_AEAD_ERROR_NONCE;
+    }
+    else if( ((ptr_aad == NULL) && (aadLen > 0u))
+                || ((ptr_aad != NULL) && (aadLen == 0u)) )
+    {
+        ret_aesGcmSivStat_en = CRYPTO_AEAD_ERROR_AAD;
+    }
+    else if( (ptr_authTag == NULL) || (authTagLen != 16u) )
+    {
+        ret_aesGcmSivStat_en = CRYPTO_AEAD_ERROR_AUTHTAG;
+    }
+    else if((cipherOper_en != CRYPTO_CIOP_ENCRYPT) && (cipherOper_en != CRYPTO_CIOP_DECRYPT))
+    {
+        ret_aesGcmSivStat_en = CRYPTO_AEAD_ERROR_CIPOPER;
+    }
+    else
+    {
+        switch(ptr_aesGcmSivCtx_st->aeadHandlerType_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                //wolfCrypt provides AES-SIV (RFC 5297) but not AES-GCM-SIV
+                break;
+               
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_aesGcmSivStat_en = Crypto_Aead_Hw_AesGcmSiv_Cipher((void*)ptr_aesGcmSivCtx_st->arr_aeadDataCtx, cipherOper_en, ptr_nonce, ptr_inputData, 
+                                                                        dataLen, ptr_outData, ptr_aad, aadLen, ptr_authTag);
+                break;
+				
+            default:
+                ret_aesGcmSivStat_en = CRYPTO_AEAD_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_aesGcmSivStat_en;
+}
+
+crypto_Aead_Status_E Crypto_Aead_AesGcmSiv_EncryptAuthDirect(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData, uint32_t dataLen, 
+                                                            uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_nonce, 
+                                                            uint32_t nonceLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint32_t authTagLen, uint32_t sessionID)
+{
+    return lCrypto_Aead_AesGcmSiv_Direct(handlerType_en, CRYPTO_CIOP_ENCRYPT, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, 
+                                                    ptr_nonce, nonceLen, ptr_aad, aadLen, ptr_authTag, authTagLen, sessionID);
+}
+
+crypto_Aead_Status_E Crypto_Aead_AesGcmSiv_DecryptAuthDirect(crypto_HandlerType_E handlerType_en, uint8_t *ptr_inputData, uint32_t dataLen, 
+                                                            uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keyLen, uint8_t *ptr_nonce, 
+                                                            uint32_t nonceLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint32_t authTagLen, uint32_t sessionID)
+{
+    return lCrypto_Aead_AesGcmSiv_Direct(handlerType_en, CRYPTO_CIOP_DECRYPT, ptr_inputData, dataLen, ptr_outData, ptr_key, keyLen, 
+                                                    ptr_nonce, nonceLen, ptr_aad, aadLen, ptr_authTag, authTagLen, sessionID);
+}
 // *****************************************************************************
\ No newline at end of file
@@ -0,0 +1,181 @@
+/*******************************************************************************
+  MPLAB Harmony Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_mac_cipher.c
+
+  Summary:
+    This file contains the source code for the MPLAB Harmony application.
+
+  Description:
+    This file contains the source code for the MAC algorithms of the Common
+    Crypto API. It validates the arguments and dispatches each call to the
+    hardware or the wolfCrypt handler selected by the caller.
+*******************************************************************************/
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_mac_cipher.h"
+#include "crypto/drivers/wrapper/crypto_mac_aes6149_wrapper.h"
+#include "crypto/wolfcrypt/crypto_mac_wc_wrapper.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_MAC_SESSION_MAX (1)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Mac_Status_E Crypto_Mac_AesGmac_Init(st_Crypto_Mac_Aes_ctx *ptr_aesGmacCtx_st, crypto_HandlerType_E handlerType_en,
+                                              uint8_t *ptr_key, uint32_t keyLen, uint32_t sessionID)
+{
+    crypto_Mac_Status_E ret_aesGmacStat_en = CRYPTO_MAC_ERROR_CIPNOTSUPPTD;
+
+    if(ptr_aesGmacCtx_st == NULL)
+    {
+        ret_aesGmacStat_en = CRYPTO_MAC_ERROR_CTX;
+    }
+    else if( (ptr_key == NULL) ||
+                ( (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_128)
+                    && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_192)
+                    && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_256) ) )
+    {
+       ret_aesGmacStat_en =  CRYPTO_MAC_ERROR_KEY;
+    }
+    else if( (sessionID <= 0u) || (sessionID > (uint32_t)CRYPTO_MAC_SESSION_MAX) )
+    {
+       ret_aesGmacStat_en =  CRYPTO_MAC_ERROR_SID;
+    }
+    else
+    {
+        ptr_aesGmacCtx_st->cryptoSessionID =  sessionID;
+        ptr_aesGmacCtx_st->macHandlerType_en = handlerType_en;
+        ptr_aesGmacCtx_st->ptr_key = ptr_key;
+        ptr_aesGmacCtx_st->macKeySize = keyLen;
+
+        switch(ptr_aesGmacCtx_st->macHandlerType_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_aesGmacStat_en = Crypto_Mac_Wc_AesGmac_Init((void*)ptr_aesGmacCtx_st->arr_macDataCtx, ptr_aesGmacCtx_st->ptr_key, ptr_aesGmacCtx_st->macKeySize);
+                break;
+
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_aesGmacStat_en = Crypto_Mac_Hw_AesGmac_Init((void*)ptr_aesGmacCtx_st->arr_macDataCtx, ptr_aesGmacCtx_st->ptr_key, ptr_aesGmacCtx_st->macKeySize);
+                break;
+
+            default:
+                ret_aesGmacStat_en = CRYPTO_MAC_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_aesGmacStat_en;
+}
+
+crypto_Mac_Status_E Crypto_Mac_AesGmac_Cipher(st_Crypto_Mac_Aes_ctx *ptr_aesGmacCtx_st, uint8_t *ptr_initVect, uint32_t initVectLen,
+                                                uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_outMac, uint32_t macLen)
+{
+    crypto_Mac_Status_E ret_aesGmacStat_en = CRYPTO_MAC_ERROR_CIPNOTSUPPTD;
+
+    if(ptr_aesGmacCtx_st == NULL)
+    {
+        ret_aesGmacStat_en = CRYPTO_MAC_ERROR_CTX;
+    }
+    else if( (ptr_initVect == NULL) || (initVectLen == 0u) )
+    {
+        ret_aesGmacStat_en = CRYPTO_MAC_ERROR_NONCE;
+    }
+    else if( (ptr_aad == NULL) || (aadLen == 0u) )
+    {
+        ret_aesGmacStat_en = CRYPTO_MAC_ERROR_INPUTDATA;
+    }
+    else if( (ptr_outMac == NULL) || (macLen > 16u) || (macLen < 4u) )
+    {
+        ret_aesGmacStat_en = CRYPTO_MAC_ERROR_MACDATA;
+    }
+    else
+    {
+        switch(ptr_aesGmacCtx_st->macHandlerType_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_aesGmacStat_en = Crypto_Mac_Wc_AesGmac_Cipher((void*)ptr_aesGmacCtx_st->arr_macDataCtx, ptr_initVect, initVectLen,
+                                                                    ptr_aad, aadLen, ptr_outMac, macLen);
+                break;
+
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_aesGmacStat_en = Crypto_Mac_Hw_AesGmac_Cipher((void*)ptr_aesGmacCtx_st->arr_macDataCtx, ptr_initVect, initVectLen,
+                                                                    ptr_aad, aadLen, ptr_outMac, macLen);
+                break;
+
+            default:
+                ret_aesGmacStat_en = CRYPTO_MAC_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_aesGmacStat_en;
+}
+
+crypto_Mac_Status_E Crypto_Mac_AesGmac_Direct(crypto_HandlerType_E handlerType_en, uint8_t *ptr_initVect, uint32_t initVectLen,
+                                                uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_outMac, uint32_t macLen,
+                                                uint8_t *ptr_key, uint32_t keyLen, uint32_t sessionID)
+{
+    crypto_Mac_Status_E ret_aesGmacStat_en = CRYPTO_MAC_ERROR_CIPNOTSUPPTD;
+
+    if( (ptr_key == NULL) ||
+                ( (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_128)
+                    && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_192)
+                    && (keyLen != (uint32_t)CRYPTO_AESKEYSIZE_256) ) )
+    {
+       ret_aesGmacStat_en =  CRYPTO_MAC_ERROR_KEY;
+    }
+    else if( (ptr_initVect == NULL) || (initVectLen == 0u) )
+    {
+        ret_aesGmacStat_en = CRYPTO_MAC_ERROR_NONCE;
+    }
+    else if( (ptr_aad == NULL) || (aadLen == 0u) )
+    {
+        ret_aesGmacStat_en = CRYPTO_MAC_ERROR_INPUTDATA;
+    }
+    else if( (ptr_outMac == NULL) || (macLen > 16u) || (macLen < 4u) )
+    {
+        ret_aesGmacStat_en = CRYPTO_MAC_ERROR_MACDATA;
+    }
+    else if( (sessionID <= 0u) || (sessionID > (uint32_t)CRYPTO_MAC_SESSION_MAX) )
+    {
+       ret_aesGmacStat_en =  CRYPTO_MAC_ERROR_SID;
+    }
+    else
+    {
+        switch(handlerType_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_aesGmacStat_en = Crypto_Mac_Wc_AesGmac_Direct(ptr_initVect, initVectLen, ptr_aad, aadLen, ptr_outMac, macLen, ptr_key, keyLen);
+                break;
+
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_aesGmacStat_en = Crypto_Mac_Hw_AesGmac_Direct(ptr_initVect, initVectLen, ptr_aad, aadLen, ptr_outMac, macLen, ptr_key, keyLen);
+                break;
+
+            default:
+                ret_aesGmacStat_en = CRYPTO_MAC_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_aesGmacStat_en;
+}
+// *****************************************************************************
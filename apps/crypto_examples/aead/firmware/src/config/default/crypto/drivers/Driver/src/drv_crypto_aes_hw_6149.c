@@ -51,6 +51,16 @@ Microchip or any third party.
 #include "definitions.h"
 #include "../drv_crypto_aes_hw_6149.h"
 
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Variables
+// *****************************************************************************
+// *****************************************************************************
+
+/* Context whose key and mode are currently loaded in the engine. Any reset or
+ * reconfiguration of the engine invalidates it. */
+static const void *aesEngineOwner = NULL;
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: AES Common Interface Implementation
@@ -83,12 +93,16 @@ void DRV_CRYPTO_AES_Init(void)
 {
     /* Software reset */
     AES_REGS->AES_CR = AES_CR_SWRST_Msk;
+    
+    aesEngineOwner = NULL;
 }
 
 void DRV_CRYPTO_AES_SetConfig(CRYPTO_AES_CONFIG *aesCfg)
 {
     CRYPTO_AES_MR aesMR = {0};
     CRYPTO_AES_EMR aesEMR = {0};
+    
+    aesEngineOwner = NULL;
       
     /* MR fields */
     aesMR.s.CKEY = 0xE;
@@ -330,3 +344,12 @@ void DRV_CRYPTO_AES_ReadGcmH(uint32_t *hBuffer)
     }
 }
 
+void DRV_CRYPTO_AES_SetOwner(const void *owner)
+{
+    aesEngineOwner = owner;
+}
+
+bool DRV_CRYPTO_AES_IsOwner(const void *owner)
+{
+    return ((owner != NULL) && (aesEngineOwner == owner));
+}
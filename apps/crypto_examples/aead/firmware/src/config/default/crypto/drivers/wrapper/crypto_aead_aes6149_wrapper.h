@@ -76,6 +76,12 @@ typedef struct
     uint32_t invokeCtr[2];
 } CRYPTO_GCM_HW_CONTEXT;
 
+typedef struct 
+{
+    uint32_t key[8];
+    uint32_t keyLen;
+} CRYPTO_GCMSIV_HW_CONTEXT;
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: AEAD Algorithms Common Interface 
@@ -100,6 +106,29 @@ crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_DecryptAuthDirect(uint8_t *inputData,
     uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, uint32_t aadLen, 
     uint8_t *authTag, uint32_t authTagLen);
 
+crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_DecryptVerifyDirect(
+    uint8_t *inputData, uint32_t dataLen, uint8_t *outData, uint8_t *key, 
+    uint32_t keyLen, uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, 
+    uint32_t aadLen, uint8_t *authTag, uint32_t authTagLen);
+
+crypto_Aead_Status_E Crypto_Aead_Hw_AesGcm_AuthBatch(
+    crypto_CipherOper_E cipherOper_en, uint8_t *key, uint32_t keyLen, 
+    st_Crypto_Aead_AesGcm_Frame *frames, uint32_t numFrames, 
+    uint32_t authTagLen);
+
+crypto_Aead_Status_E Crypto_Aead_Hw_AesGcmSiv_Init(void *gcmSivInitCtx, 
+    uint8_t *key, uint32_t keyLen);
+
+crypto_Aead_Status_E Crypto_Aead_Hw_AesGcmSiv_Cipher(void *gcmSivCipherCtx, 
+    crypto_CipherOper_E cipherOper_en, uint8_t *nonce, uint8_t *inputData, 
+    uint32_t dataLen, uint8_t *outData, uint8_t *aad, uint32_t aadLen, 
+    uint8_t *authTag);
+
+crypto_Aead_Status_E Crypto_Aead_Hw_AesGcmSiv_EncDecAuthDirect(
+    crypto_CipherOper_E cipherOper_en, uint8_t *inputData, uint32_t dataLen, 
+    uint8_t *outData, uint8_t *key, uint32_t keyLen, uint8_t *nonce, 
+    uint8_t *aad, uint32_t aadLen, uint8_t *authTag);
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
 
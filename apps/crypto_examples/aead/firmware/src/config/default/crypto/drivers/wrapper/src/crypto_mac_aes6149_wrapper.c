@@ -0,0 +1,292 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_mac_aes6149_wrapper.c
+
+  Summary:
+    Crypto Framework Library wrapper file for hardware AES.
+
+  Description:
+    This source file contains the wrapper interface to access the MAC
+    algorithms in the AES hardware driver for Microchip microcontrollers.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2024, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <string.h>
+#include "crypto/drivers/wrapper/crypto_mac_aes6149_wrapper.h"
+#include "crypto/drivers/driver/drv_crypto_aes_hw_6149.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Loads the GMAC configuration and key into the engine. The engine computes
+ * the hash subkey H when the key is written; it is cached in the context so
+ * J0 for non 96-bit IVs can be derived without another engine pass. */
+static void lCrypto_Mac_Hw_Gmac_LoadEngine(CRYPTO_GMAC_HW_CONTEXT *gmacCtx)
+{
+    CRYPTO_AES_CONFIG gmacCfg;
+
+    /* Get the default configuration from the driver */
+    DRV_CRYPTO_AES_GetConfigDefault(&gmacCfg);
+
+    /* Initialize the driver */
+    DRV_CRYPTO_AES_Init();
+
+    /* GCM with automatic tag generation: the engine encrypts J0 and folds
+     * it into the tag in the same pass as the GHASH of the AAD. */
+    gmacCfg.keySize = DRV_CRYPTO_AES_GetKeySize(gmacCtx->keyLen / 4UL);
+    gmacCfg.startMode = CRYPTO_AES_AUTO_START;
+    gmacCfg.opMode = CRYPTO_AES_MODE_GCM;
+    gmacCfg.encryptMode = CRYPTO_AES_ENCRYPTION;
+    gmacCfg.gtagEn = 1;
+    DRV_CRYPTO_AES_SetConfig(&gmacCfg);
+
+    /* Write the key */
+    DRV_CRYPTO_AES_WriteKey(gmacCtx->key);
+
+    /* Wait for the GCMH to generate */
+    while (!DRV_CRYPTO_AES_CipherIsReady())
+    {
+        ;
+    }
+
+    DRV_CRYPTO_AES_ReadGcmH(gmacCtx->H);
+
+    DRV_CRYPTO_AES_SetOwner(gmacCtx);
+}
+
+/* X = X * Y in GF(2^128) as defined in NIST SP 800-38D, Algorithm 1 */
+static void lCrypto_Mac_Hw_Gmac_GfMult(uint8_t *x, const uint8_t *y)
+{
+    uint8_t z[16] = {0};
+    uint8_t v[16];
+    uint8_t lsb;
+    uint32_t i, j;
+
+    (void) memcpy(v, y, sizeof(v));
+
+    for (i = 0; i < 128UL; i++)
+    {
+        if ((x[i / 8UL] & (uint8_t)(0x80U >> (i % 8UL))) != 0U)
+        {
+            for (j = 0; j < 16UL; j++)
+            {
+                z[j] ^= v[j];
+            }
+        }
+
+        lsb = v[15] & 0x01U;
+        for (j = 15; j > 0UL; j--)
+        {
+            v[j] = (uint8_t)((v[j] >> 1) | (uint8_t)(v[j - 1UL] << 7));
+        }
+        v[0] >>= 1;
+        if (lsb != 0U)
+        {
+            v[0] ^= 0xE1U;
+        }
+    }
+
+    (void) memcpy(x, z, sizeof(z));
+}
+
+static void lCrypto_Mac_Hw_Gmac_WriteIv(CRYPTO_GMAC_HW_CONTEXT *gmacCtx,
+                                        const uint8_t *iv, uint32_t ivLen)
+{
+    uint32_t j0[4] = {0};
+    uint8_t *j0Bytes = (uint8_t *)j0;
+    uint32_t ctr;
+
+    if (ivLen == 12UL)
+    {
+        /* J0 = IV || 0^31 || 1 */
+        (void) memcpy(j0Bytes, iv, ivLen);
+        j0Bytes[15] = 0x1;
+    }
+    else
+    {
+        /* J0 = GHASH_H(IV || 0^(s+64) || [len(IV)]64) with the cached H */
+        uint8_t block[16];
+        uint32_t bits = ivLen * 8UL;
+
+        while (ivLen > 0UL)
+        {
+            uint32_t chunk = (ivLen > 16UL) ? 16UL : ivLen;
+
+            (void) memset(block, 0, sizeof(block));
+            (void) memcpy(block, iv, chunk);
+            for (ctr = 0; ctr < 16UL; ctr++)
+            {
+                j0Bytes[ctr] ^= block[ctr];
+            }
+            lCrypto_Mac_Hw_Gmac_GfMult(j0Bytes, (uint8_t *)gmacCtx->H);
+
+            iv += chunk;
+            ivLen -= chunk;
+        }
+
+        j0Bytes[12] ^= (uint8_t)((bits >> 24) & 0xFFUL);
+        j0Bytes[13] ^= (uint8_t)((bits >> 16) & 0xFFUL);
+        j0Bytes[14] ^= (uint8_t)((bits >> 8) & 0xFFUL);
+        j0Bytes[15] ^= (uint8_t)(bits & 0xFFUL);
+        lCrypto_Mac_Hw_Gmac_GfMult(j0Bytes, (uint8_t *)gmacCtx->H);
+    }
+
+    /* Write IV with inc32(J0) (J0 + 1 on 32 bits) */
+    ctr = ((uint32_t)j0Bytes[12] << 24U) | ((uint32_t)j0Bytes[13] << 16U) |
+          ((uint32_t)j0Bytes[14] << 8U) | (uint32_t)j0Bytes[15];
+    ctr++;
+    j0Bytes[12] = (uint8_t)((ctr >> 24U) & 0xFFUL);
+    j0Bytes[13] = (uint8_t)((ctr >> 16U) & 0xFFUL);
+    j0Bytes[14] = (uint8_t)((ctr >> 8U) & 0xFFUL);
+    j0Bytes[15] = (uint8_t)(ctr & 0xFFUL);
+
+    DRV_CRYPTO_AES_WriteInitVector(j0);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: MAC Algorithms Common Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Mac_Status_E Crypto_Mac_Hw_AesGmac_Init(void *gmacInitCtx, uint8_t *key,
+    uint32_t keyLen)
+{
+    CRYPTO_GMAC_HW_CONTEXT *gmacCtx = (CRYPTO_GMAC_HW_CONTEXT*)gmacInitCtx;
+
+    /* Initialize the context */
+    (void) memset(gmacCtx, 0, sizeof(CRYPTO_GMAC_HW_CONTEXT));
+
+    /* Store the key */
+    uint32_t i;
+    for (i = 0; i < (keyLen / 4UL); i++)
+    {
+        gmacCtx->key[i]  = ((uint32_t) *key++) << 24UL;
+        gmacCtx->key[i] += ((uint32_t) *key++) << 16UL;
+        gmacCtx->key[i] += ((uint32_t) *key++) << 8UL;
+        gmacCtx->key[i] += ((uint32_t) *key++);
+    }
+    gmacCtx->keyLen = keyLen;
+
+    lCrypto_Mac_Hw_Gmac_LoadEngine(gmacCtx);
+
+    return CRYPTO_MAC_CIPHER_SUCCESS;
+}
+
+crypto_Mac_Status_E Crypto_Mac_Hw_AesGmac_Cipher(void *gmacCipherCtx,
+    uint8_t *initVect, uint32_t initVectLen, uint8_t *aad, uint32_t aadLen,
+    uint8_t *outMac, uint32_t macLen)
+{
+    CRYPTO_GMAC_HW_CONTEXT *gmacCtx = (CRYPTO_GMAC_HW_CONTEXT*)gmacCipherCtx;
+    uint32_t block[4];
+    uint32_t ghashInit[4] = {0};
+    uint32_t tag[4];
+
+    /* The key and H stay loaded between messages unless another context
+     * reconfigured the engine in the meantime. */
+    if (!DRV_CRYPTO_AES_IsOwner(gmacCtx))
+    {
+        lCrypto_Mac_Hw_Gmac_LoadEngine(gmacCtx);
+    }
+
+    lCrypto_Mac_Hw_Gmac_WriteIv(gmacCtx, initVect, initVectLen);
+
+    /* GHASH-only pass: the AAD is the whole message */
+    DRV_CRYPTO_AES_WriteAuthDataLen(aadLen);
+    DRV_CRYPTO_AES_WritePCTextLen(0);
+    DRV_CRYPTO_AES_WriteGcmHash(ghashInit);
+
+    while (aadLen > 0UL)
+    {
+        uint32_t chunk = (aadLen > 16UL) ? 16UL : aadLen;
+
+        if (chunk < 16UL)
+        {
+            (void) memset(block, 0, sizeof(block));
+        }
+        (void) memcpy(block, aad, chunk);
+
+        /* Write the data to be hashed to the input data registers */
+        DRV_CRYPTO_AES_WriteInputData(block);
+
+        /* Wait for the GHASH step to end */
+        while (!DRV_CRYPTO_AES_CipherIsReady())
+        {
+            ;
+        }
+
+        aad += chunk;
+        aadLen -= chunk;
+    }
+
+    /* Wait for the tag to generate */
+    while (!DRV_CRYPTO_AES_TagIsReady())
+    {
+        ;
+    }
+
+    DRV_CRYPTO_AES_ReadTag(tag);
+    (void) memcpy(outMac, (uint8_t *)tag, macLen);
+
+    return CRYPTO_MAC_CIPHER_SUCCESS;
+}
+
+crypto_Mac_Status_E Crypto_Mac_Hw_AesGmac_Direct(uint8_t *initVect,
+    uint32_t initVectLen, uint8_t *aad, uint32_t aadLen, uint8_t *outMac,
+    uint32_t macLen, uint8_t *key, uint32_t keyLen)
+{
+    CRYPTO_GMAC_HW_CONTEXT gmacCtx;
+    crypto_Mac_Status_E result;
+
+    result = Crypto_Mac_Hw_AesGmac_Init(&gmacCtx, key, keyLen);
+    if (result == CRYPTO_MAC_CIPHER_SUCCESS)
+    {
+        result = Crypto_Mac_Hw_AesGmac_Cipher(&gmacCtx, initVect, initVectLen,
+                    aad, aadLen, outMac, macLen);
+    }
+
+    /* The context lives on the stack, do not leave it as the engine owner */
+    DRV_CRYPTO_AES_SetOwner(NULL);
+    (void) memset(&gmacCtx, 0, sizeof(gmacCtx));
+
+    return result;
+}
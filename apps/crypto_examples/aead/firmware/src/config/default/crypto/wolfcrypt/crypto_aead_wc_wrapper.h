@@ -55,5 +55,15 @@ crypto_Aead_Status_E Crypto_Aead_Wc_AesGcm_Cipher(crypto_CipherOper_E cipherOper
 crypto_Aead_Status_E Crypto_Aead_Wc_AesGcm_Final(crypto_CipherOper_E cipherOper_en, void *ptr_aesGcmCtx, uint8_t *ptr_authTag, uint8_t authTagLen);
 crypto_Aead_Status_E Crypto_Aead_Wc_AesGcm_EncDecAuthDirect(crypto_CipherOper_E cipherOper_en, uint8_t *ptr_inputData, uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keySize, 
                                                 uint8_t *ptr_initVect, uint32_t initVectLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint8_t authTagLen);
+crypto_Aead_Status_E Crypto_Aead_Wc_AesGcm_DecryptVerifyDirect(uint8_t *ptr_inputData, uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keySize, 
+                                                uint8_t *ptr_initVect, uint32_t initVectLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint8_t authTagLen);
+crypto_Aead_Status_E Crypto_Aead_Wc_AesGcm_AuthBatch(crypto_CipherOper_E cipherOper_en, uint8_t *ptr_key, uint32_t keySize, 
+                                                st_Crypto_Aead_AesGcm_Frame *ptr_frames, uint32_t numFrames, uint32_t authTagLen);
+
+crypto_Aead_Status_E Crypto_Aead_Wc_ChaCha20Poly1305_Init(void *ptr_chaChaPolyCtx, uint8_t *ptr_key);
+crypto_Aead_Status_E Crypto_Aead_Wc_ChaCha20Poly1305_Cipher(crypto_CipherOper_E cipherOper_en, void *ptr_chaChaPolyCtx, uint8_t *ptr_inputData, uint32_t dataLen, 
+                                                uint8_t *ptr_outData, uint8_t *ptr_nonce, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag);
+crypto_Aead_Status_E Crypto_Aead_Wc_ChaCha20Poly1305_EncDecAuthDirect(crypto_CipherOper_E cipherOper_en, uint8_t *ptr_inputData, uint32_t dataLen, uint8_t *ptr_outData, 
+                                                uint8_t *ptr_key, uint8_t *ptr_nonce, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag);
 
 #endif //CRYPTO_AEAD_WC_WRAPPER_H
\ No newline at end of file
@@ -0,0 +1,72 @@
+/*******************************************************************************
+  MPLAB Harmony Application Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_chacha_poly_cm4.h
+
+  Summary:
+    This header file provides prototypes and definitions for the application.
+
+  Description:
+    This header file provides the Cortex-M4 ChaCha20 and Poly1305 kernels
+    (RFC 8439) used by the wolfCrypt handler when CRYPTO_CHACHA_POLY_CM4 is
+    defined in wolfcrypt_config.h. The ChaCha20 block keeps the whole state in
+    core registers and the Poly1305 multiply is built on the UMAAL
+    instruction. On other targets the same code builds with a portable
+    fallback for UMAAL, so the kernels can be checked on a host.
+*******************************************************************************/
+
+#ifndef CRYPTO_CHACHA_POLY_CM4_H
+#define CRYPTO_CHACHA_POLY_CM4_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stdint.h>
+
+#define CRYPTO_CHACHA20_CM4_KEYSIZE     (32U)
+#define CRYPTO_CHACHA20_CM4_KEYSIZE_128 (16U)
+#define CRYPTO_CHACHA20_CM4_NONCESIZE   (12U)
+#define CRYPTO_POLY1305_CM4_KEYSIZE     (32U)
+#define CRYPTO_POLY1305_CM4_TAGSIZE     (16U)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+typedef struct
+{
+    uint32_t state[16];
+    uint32_t keyStream[16];
+    uint32_t left;              //Unused bytes at the end of keyStream
+}CRYPTO_CHACHA20_CM4_CTX;
+
+typedef struct
+{
+    uint32_t r[4];              //Clamped r, radix 2^32
+    uint32_t s[4];              //Second half of the one-time key
+    uint32_t h[5];              //Accumulator, h[4] holds bits 128 and up
+    uint8_t buffer[16];
+    uint32_t leftover;
+}CRYPTO_POLY1305_CM4_CTX;
+// *****************************************************************************
+
+void Crypto_ChaCha20_Cm4_SetKey(CRYPTO_CHACHA20_CM4_CTX *ptr_chaChaCtx, const uint8_t *ptr_key, uint32_t keySize);
+
+void Crypto_ChaCha20_Cm4_SetIv(CRYPTO_CHACHA20_CM4_CTX *ptr_chaChaCtx, const uint8_t *ptr_nonce, uint32_t counter);
+
+void Crypto_ChaCha20_Cm4_Process(CRYPTO_CHACHA20_CM4_CTX *ptr_chaChaCtx, uint8_t *ptr_outData, const uint8_t *ptr_inputData, uint32_t dataLen);
+
+void Crypto_Poly1305_Cm4_Init(CRYPTO_POLY1305_CM4_CTX *ptr_polyCtx, const uint8_t *ptr_key);
+
+void Crypto_Poly1305_Cm4_Update(CRYPTO_POLY1305_CM4_CTX *ptr_polyCtx, const uint8_t *ptr_data, uint32_t dataLen);
+
+void Crypto_Poly1305_Cm4_Final(CRYPTO_POLY1305_CM4_CTX *ptr_polyCtx, uint8_t *ptr_tag);
+
+#endif //CRYPTO_CHACHA_POLY_CM4_H
@@ -0,0 +1,82 @@
+/*******************************************************************************
+  MPLAB Harmony Application Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_cryptocb_wc_wrapper.h
+
+  Summary:
+    wolfCrypt crypto callback device running wolfCrypt operations on the
+    hardware crypto engines.
+
+  Description:
+    Once Crypto_CryptoCb_Wc_Init has registered the device, the wolfCrypt
+    operations of the routes enabled in wolfcrypt_config.h are handed to the
+    hardware wrappers for the objects set up with CRYPTO_CRYPTOCB_WC_DEVID
+    (wc_InitSha256_ex, wc_ecc_init_ex, wc_AesInit, wc_InitRng_ex). Objects
+    set up with INVALID_DEVID stay in software:
+        CRYPTO_CRYPTOCB_HW_SHA      SHA-256/384/512 on the SHA6156
+        CRYPTO_CRYPTOCB_HW_ECDSA    ECDSA sign and verify on the CPKCC
+        CRYPTO_CRYPTOCB_HW_ECDH     ECDH shared secret on the CPKCC
+        CRYPTO_CRYPTOCB_HW_AES      AES-ECB and AES-CBC on the AES6149
+        CRYPTO_CRYPTOCB_HW_AES_GCM  AES-GCM on the AES6149
+        CRYPTO_CRYPTOCB_HW_TRNG     RNG blocks and seeds from the TRNG6334
+    An operation the engine does not take (curve, key size or length it does
+    not support, engine busy or not ready) is left to the wolfCrypt software,
+    as is an ECDSA signature with a nonce set by wc_ecc_sign_set_k.
+    The SHA6156 keeps the state of one hash: a stream holds it from its first
+    update to its final, streams started meanwhile are hashed in software. A
+    stream held by the engine cannot be copied (wc_Sha256Copy, GetHash).
+*******************************************************************************/
+
+#ifndef CRYPTO_CRYPTOCB_WC_WRAPPER_H
+#define CRYPTO_CRYPTOCB_WC_WRAPPER_H
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Device ID of the hardware engines. Only the wolfCrypt objects set up with
+   it reach them. */
+#define CRYPTO_CRYPTOCB_WC_DEVID    (0x4D434850)
+
+typedef enum
+{
+    CRYPTO_CRYPTOCB_ENGINE_AES = 0,
+    CRYPTO_CRYPTOCB_ENGINE_SHA,
+    CRYPTO_CRYPTOCB_ENGINE_TRNG,
+    CRYPTO_CRYPTOCB_ENGINE_CPKCC,
+    CRYPTO_CRYPTOCB_ENGINE_MAX
+}crypto_CryptoCb_Engine_E;
+
+//Calls wolfCrypt_Init and registers the device. Returns 0 or a wolfCrypt error
+int Crypto_CryptoCb_Wc_Init(void);
+
+//Unregisters the device, wolfCrypt runs everything in software again. Also
+//frees the SHA engine from a stream that never reached its final
+void Crypto_CryptoCb_Wc_Deinit(void);
+
+//Marks an engine busy for code driving it outside wolfCrypt, its wolfCrypt
+//operations then run in software. Returns false when the engine is already busy
+bool Crypto_CryptoCb_Wc_EngineClaim(crypto_CryptoCb_Engine_E engine_en);
+
+void Crypto_CryptoCb_Wc_EngineRelease(crypto_CryptoCb_Engine_E engine_en);
+
+//Number of callbacks run on the engines and left to software since Init
+void Crypto_CryptoCb_Wc_GetCounts(uint32_t *ptr_hwCount, uint32_t *ptr_swCount);
+
+#endif //CRYPTO_CRYPTOCB_WC_WRAPPER_H
@@ -0,0 +1,38 @@
+/*******************************************************************************
+  MPLAB Harmony Application Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_mac_wc_wrapper.h
+
+  Summary:
+    This header file provides prototypes and definitions for the application.
+
+  Description:
+    This header file provides function prototypes for the wolfCrypt handler of
+    the MAC algorithms of the Common Crypto API.
+*******************************************************************************/
+
+#ifndef CRYPTO_MAC_WC_WRAPPER_H
+#define CRYPTO_MAC_WC_WRAPPER_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Type Definitions
+// *****************************************************************************
+crypto_Mac_Status_E Crypto_Mac_Wc_AesGmac_Init(void *ptr_aesGmacCtx, uint8_t *ptr_key, uint32_t keySize);
+crypto_Mac_Status_E Crypto_Mac_Wc_AesGmac_Cipher(void *ptr_aesGmacCtx, uint8_t *ptr_initVect, uint32_t initVectLen,
+                                                    uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_outMac, uint32_t macLen);
+crypto_Mac_Status_E Crypto_Mac_Wc_AesGmac_Direct(uint8_t *ptr_initVect, uint32_t initVectLen, uint8_t *ptr_aad, uint32_t aadLen,
+                                                    uint8_t *ptr_outMac, uint32_t macLen, uint8_t *ptr_key, uint32_t keySize);
+
+#endif //CRYPTO_MAC_WC_WRAPPER_H
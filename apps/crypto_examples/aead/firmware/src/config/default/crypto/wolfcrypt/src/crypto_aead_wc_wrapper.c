@@ -27,11 +27,18 @@
 // Section: Included Files
 // *****************************************************************************
 // *****************************************************************************
+#include <string.h>
 #include "crypto/common_crypto/crypto_common.h"
 #include "crypto/common_crypto/crypto_aead_cipher.h"
 #include "crypto/wolfcrypt/crypto_aead_wc_wrapper.h"
+#include "crypto/wolfcrypt/crypto_chacha_poly_cm4.h"
 #include "wolfssl/wolfcrypt/error-crypt.h"
 #include "wolfssl/wolfcrypt/aes.h"
+#include "wolfssl/wolfcrypt/chacha20_poly1305.h"
+
+#ifndef WC_AES_GCM_DEC_AUTH_EARLY
+    #error Crypto_Aead_Wc_AesGcm_DecryptVerifyDirect needs WC_AES_GCM_DEC_AUTH_EARLY
+#endif
 // *****************************************************************************
 // *****************************************************************************
 // Section: Global Data Definitions
@@ -553,4 +560,293 @@ crypto_Aead_Status_E Crypto_Aead_Wc_AesGcm_EncDecAuthDirect(crypto_CipherOper_E
     }
     return ret_aesGcmStat_en;
 }
+
+crypto_Aead_Status_E Crypto_Aead_Wc_AesGcm_DecryptVerifyDirect(uint8_t *ptr_inputData, uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keySize, 
+                                                uint8_t *ptr_initVect, uint32_t initVectLen, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag, uint8_t authTagLen)
+{
+    crypto_Aead_Status_E ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CIPFAIL;
+    int wcAesGcmStatus = BAD_FUNC_ARG;
+    Aes arr_aesGcmCtx[1];
+    
+    wcAesGcmStatus = wc_AesInit(arr_aesGcmCtx, NULL, INVALID_DEVID);
+    if(wcAesGcmStatus == 0)
+    {
+        wcAesGcmStatus = wc_AesGcmSetKey(arr_aesGcmCtx, (const byte*)ptr_key, (word32)keySize);
+    }
+    if(wcAesGcmStatus == 0)
+    {
+        //WC_AES_GCM_DEC_AUTH_EARLY makes wolfCrypt compare the tag in constant time 
+        //and return before the CTR pass, so ptr_outData is not written on a mismatch
+        wcAesGcmStatus = wc_AesGcmDecrypt(arr_aesGcmCtx, (byte*)ptr_outData, (const byte*)ptr_inputData, (word32)dataLen, ptr_initVect, (word32)initVectLen, 
+                        ptr_authTag, (word32)authTagLen, ptr_aad, (word32)aadLen);
+    }
+    
+    if(wcAesGcmStatus == 0)
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_CIPHER_SUCCESS;
+    }
+    else if(wcAesGcmStatus == AES_GCM_AUTH_E)
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_AUTHFAIL;
+    }
+    else if(wcAesGcmStatus == BAD_FUNC_ARG)
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_ARG;
+    }
+    else
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
+    
+    wc_AesFree(arr_aesGcmCtx);
+    
+    return ret_aesGcmStat_en;
+}
+
+crypto_Aead_Status_E Crypto_Aead_Wc_AesGcm_AuthBatch(crypto_CipherOper_E cipherOper_en, uint8_t *ptr_key, uint32_t keySize, 
+                                                st_Crypto_Aead_AesGcm_Frame *ptr_frames, uint32_t numFrames, uint32_t authTagLen)
+{
+    crypto_Aead_Status_E ret_aesGcmStat_en = CRYPTO_AEAD_CIPHER_SUCCESS;
+    int wcAesGcmStatus = BAD_FUNC_ARG;
+    Aes arr_aesGcmCtx[1];
+    uint32_t frameIdx;
+    
+    //The key schedule and the GHASH table are computed once for the whole batch
+    wcAesGcmStatus = wc_AesInit(arr_aesGcmCtx, NULL, INVALID_DEVID);
+    if(wcAesGcmStatus == 0)
+    {
+        wcAesGcmStatus = wc_AesGcmSetKey(arr_aesGcmCtx, (const byte*)ptr_key, (word32)keySize);
+    }
+    
+    if(wcAesGcmStatus != 0)
+    {
+        ret_aesGcmStat_en = (wcAesGcmStatus == BAD_FUNC_ARG) ? CRYPTO_AEAD_ERROR_ARG : CRYPTO_AEAD_ERROR_CIPFAIL;
+    }
+    else if((cipherOper_en != CRYPTO_CIOP_ENCRYPT) && (cipherOper_en != CRYPTO_CIOP_DECRYPT))
+    {
+        ret_aesGcmStat_en = CRYPTO_AEAD_ERROR_CIPOPER;
+    }
+    else
+    {
+        for(frameIdx = 0u; frameIdx < numFrames; frameIdx++)
+        {
+            st_Crypto_Aead_AesGcm_Frame *ptr_frame_st = &ptr_frames[frameIdx];
+            
+            if(cipherOper_en == CRYPTO_CIOP_ENCRYPT)
+            {
+                wcAesGcmStatus = wc_AesGcmEncrypt(arr_aesGcmCtx, (byte*)ptr_frame_st->ptr_outData, (const byte*)ptr_frame_st->ptr_inputData, 
+                                    (word32)ptr_frame_st->dataLen, ptr_frame_st->ptr_initVect, (word32)ptr_frame_st->initVectLen, 
+                                    ptr_frame_st->ptr_authTag, (word32)authTagLen, ptr_frame_st->ptr_aad, (word32)ptr_frame_st->aadLen);
+            }
+            else
+            {
+                wcAesGcmStatus = wc_AesGcmDecrypt(arr_aesGcmCtx, (byte*)ptr_frame_st->ptr_outData, (const byte*)ptr_frame_st->ptr_inputData, 
+                                    (word32)ptr_frame_st->dataLen, ptr_frame_st->ptr_initVect, (word32)ptr_frame_st->initVectLen, 
+                                    ptr_frame_st->ptr_authTag, (word32)authTagLen, ptr_frame_st->ptr_aad, (word32)ptr_frame_st->aadLen);
+            }
+            
+            if(wcAesGcmStatus == 0)
+            {
+                ptr_frame_st->frameStatus_en = CRYPTO_AEAD_CIPHER_SUCCESS;
+            }
+            else if(wcAesGcmStatus == AES_GCM_AUTH_E)
+            {
+                //Do not release unauthenticated plaintext
+                if(ptr_frame_st->ptr_outData != NULL)
+                {
+                    (void)memset(ptr_frame_st->ptr_outData, 0, ptr_frame_st->dataLen);
+                }
+                ptr_frame_st->frameStatus_en = CRYPTO_AEAD_ERROR_AUTHFAIL;
+            }
+            else
+            {
+                ptr_frame_st->frameStatus_en = CRYPTO_AEAD_ERROR_CIPFAIL;
+            }
+            
+            //Keep going so every frame gets a status; report the first failure
+            if( (ptr_frame_st->frameStatus_en != CRYPTO_AEAD_CIPHER_SUCCESS) && (ret_aesGcmStat_en == CRYPTO_AEAD_CIPHER_SUCCESS) )
+            {
+                ret_aesGcmStat_en = ptr_frame_st->frameStatus_en;
+            }
+        }
+    }
+    
+    wc_AesFree(arr_aesGcmCtx);
+    
+    return ret_aesGcmStat_en;
+}
+
+#ifdef CRYPTO_CHACHA_POLY_CM4
+static void lCrypto_Aead_Wc_ChaChaPoly_Cm4_Pad16(CRYPTO_POLY1305_CM4_CTX *ptr_polyCtx, uint32_t dataLen)
+{
+    static const uint8_t zeroPad[16] = {0};
+    
+    if((dataLen % 16u) != 0u)
+    {
+        Crypto_Poly1305_Cm4_Update(ptr_polyCtx, zeroPad, 16u - (dataLen % 16u));
+    }
+}
+
+/* RFC 8439 section 2.8 on the Cortex-M4 kernels. On decryption the tag is
+ * checked before the caller sees the plaintext; a mismatch wipes the output. */
+static crypto_Aead_Status_E lCrypto_Aead_Wc_ChaChaPoly_Cm4(crypto_CipherOper_E cipherOper_en, uint8_t *ptr_inputData, uint32_t dataLen, uint8_t *ptr_outData, 
+                                                uint8_t *ptr_key, uint8_t *ptr_nonce, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag)
+{
+    CRYPTO_CHACHA20_CM4_CTX chaChaCtx;
+    CRYPTO_POLY1305_CM4_CTX polyCtx;
+    uint8_t polyKey[CRYPTO_CHACHA20_CM4_KEYSIZE] = {0};
+    uint8_t calcTag[CRYPTO_POLY1305_CM4_TAGSIZE];
+    uint8_t lengths[16];
+    uint8_t diff = 0;
+    uint32_t i;
+    
+    /* Poly1305 one-time key is the first half of key stream block 0 */
+    Crypto_ChaCha20_Cm4_SetKey(&chaChaCtx, ptr_key, CRYPTO_CHACHA20_CM4_KEYSIZE);
+    Crypto_ChaCha20_Cm4_SetIv(&chaChaCtx, ptr_nonce, 0u);
+    Crypto_ChaCha20_Cm4_Process(&chaChaCtx, polyKey, polyKey, sizeof(polyKey));
+    Crypto_ChaCha20_Cm4_SetIv(&chaChaCtx, ptr_nonce, 1u);
+    Crypto_Poly1305_Cm4_Init(&polyCtx, polyKey);
+    
+    if(aadLen > 0u)
+    {
+        Crypto_Poly1305_Cm4_Update(&polyCtx, ptr_aad, aadLen);
+        lCrypto_Aead_Wc_ChaChaPoly_Cm4_Pad16(&polyCtx, aadLen);
+    }
+    
+    if(dataLen > 0u)
+    {
+        if(cipherOper_en == CRYPTO_CIOP_ENCRYPT)
+        {
+            Crypto_ChaCha20_Cm4_Process(&chaChaCtx, ptr_outData, ptr_inputData, dataLen);
+            Crypto_Poly1305_Cm4_Update(&polyCtx, ptr_outData, dataLen);
+        }
+        else
+        {
+            Crypto_Poly1305_Cm4_Update(&polyCtx, ptr_inputData, dataLen);
+            Crypto_ChaCha20_Cm4_Process(&chaChaCtx, ptr_outData, ptr_inputData, dataLen);
+        }
+        lCrypto_Aead_Wc_ChaChaPoly_Cm4_Pad16(&polyCtx, dataLen);
+    }
+    
+    /* le64(aadLen) || le64(dataLen) */
+    (void) memset(lengths, 0, sizeof(lengths));
+    for(i = 0u; i < 4u; i++)
+    {
+        lengths[i] = (uint8_t)((aadLen >> (8u * i)) & 0xFFu);
+        lengths[8u + i] = (uint8_t)((dataLen >> (8u * i)) & 0xFFu);
+    }
+    Crypto_Poly1305_Cm4_Update(&polyCtx, lengths, sizeof(lengths));
+    Crypto_Poly1305_Cm4_Final(&polyCtx, calcTag);
+    
+    if(cipherOper_en == CRYPTO_CIOP_ENCRYPT)
+    {
+        (void) memcpy(ptr_authTag, calcTag, sizeof(calcTag));
+    }
+    else
+    {
+        for(i = 0u; i < sizeof(calcTag); i++)
+        {
+            diff |= (uint8_t)(calcTag[i] ^ ptr_authTag[i]);
+        }
+        if((diff != 0u) && (dataLen > 0u))
+        {
+            (void) memset(ptr_outData, 0, dataLen);
+        }
+    }
+    
+    (void) memset(&chaChaCtx, 0, sizeof(chaChaCtx));
+    (void) memset(polyKey, 0, sizeof(polyKey));
+    
+    return (diff == 0u) ? CRYPTO_AEAD_CIPHER_SUCCESS : CRYPTO_AEAD_ERROR_AUTHFAIL;
+}
+#endif /* CRYPTO_CHACHA_POLY_CM4 */
+
+crypto_Aead_Status_E Crypto_Aead_Wc_ChaCha20Poly1305_Init(void *ptr_chaChaPolyCtx, uint8_t *ptr_key)
+{
+    crypto_Aead_Status_E ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_CIPNOTSUPPTD;
+    
+    if(ptr_chaChaPolyCtx == NULL)
+    {
+        ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_CTX;
+    }
+    else if(ptr_key == NULL)
+    {
+        ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_KEY;
+    }
+    else
+    {
+        //Every message derives its own Poly1305 key from the nonce, so only the key is kept
+        (void) memcpy(ptr_chaChaPolyCtx, ptr_key, CHACHA20_POLY1305_AEAD_KEYSIZE);
+        ret_chaChaPolyStat_en = CRYPTO_AEAD_CIPHER_SUCCESS;
+    }
+    return ret_chaChaPolyStat_en;
+}
+
+crypto_Aead_Status_E Crypto_Aead_Wc_ChaCha20Poly1305_Cipher(crypto_CipherOper_E cipherOper_en, void *ptr_chaChaPolyCtx, uint8_t *ptr_inputData, uint32_t dataLen, 
+                                                uint8_t *ptr_outData, uint8_t *ptr_nonce, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag)
+{
+    crypto_Aead_Status_E ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_CIPNOTSUPPTD;
+    
+    if(ptr_chaChaPolyCtx != NULL)
+    {
+        ret_chaChaPolyStat_en = Crypto_Aead_Wc_ChaCha20Poly1305_EncDecAuthDirect(cipherOper_en, ptr_inputData, dataLen, ptr_outData, 
+                                                                (uint8_t*)ptr_chaChaPolyCtx, ptr_nonce, ptr_aad, aadLen, ptr_authTag);
+    }
+    else
+    {
+        ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_CTX;
+    }
+    return ret_chaChaPolyStat_en;
+}
+
+crypto_Aead_Status_E Crypto_Aead_Wc_ChaCha20Poly1305_EncDecAuthDirect(crypto_CipherOper_E cipherOper_en, uint8_t *ptr_inputData, uint32_t dataLen, uint8_t *ptr_outData, 
+                                                uint8_t *ptr_key, uint8_t *ptr_nonce, uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_authTag)
+{
+    crypto_Aead_Status_E ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_CIPNOTSUPPTD;
+    
+    if((cipherOper_en != CRYPTO_CIOP_ENCRYPT) && (cipherOper_en != CRYPTO_CIOP_DECRYPT))
+    {
+        ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_CIPOPER;
+    }
+    else
+    {
+#ifdef CRYPTO_CHACHA_POLY_CM4
+        ret_chaChaPolyStat_en = lCrypto_Aead_Wc_ChaChaPoly_Cm4(cipherOper_en, ptr_inputData, dataLen, ptr_outData, ptr_key, 
+                                                                ptr_nonce, ptr_aad, aadLen, ptr_authTag);
+#else
+        int wcChaChaPolyStatus = BAD_FUNC_ARG;
+        byte emptyOut[1];
+        byte *ptr_wcOutData = (ptr_outData != NULL) ? (byte*)ptr_outData : emptyOut;
+        
+        if(cipherOper_en == CRYPTO_CIOP_ENCRYPT)
+        {
+            wcChaChaPolyStatus = wc_ChaCha20Poly1305_Encrypt((const byte*)ptr_key, (const byte*)ptr_nonce, (const byte*)ptr_aad, (word32)aadLen, 
+                                                (const byte*)ptr_inputData, (word32)dataLen, ptr_wcOutData, (byte*)ptr_authTag);
+        }
+        else
+        {
+            wcChaChaPolyStatus = wc_ChaCha20Poly1305_Decrypt((const byte*)ptr_key, (const byte*)ptr_nonce, (const byte*)ptr_aad, (word32)aadLen, 
+                                                (const byte*)ptr_inputData, (word32)dataLen, (const byte*)ptr_authTag, ptr_wcOutData);
+        }
+        
+        if(wcChaChaPolyStatus == 0)
+        {
+            ret_chaChaPolyStat_en = CRYPTO_AEAD_CIPHER_SUCCESS;
+        }
+        else if(wcChaChaPolyStatus == MAC_CMP_FAILED_E)
+        {
+            ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_AUTHFAIL;
+        }
+        else if(wcChaChaPolyStatus == BAD_FUNC_ARG)
+        {
+            ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_ARG;
+        }
+        else
+        {
+            ret_chaChaPolyStat_en = CRYPTO_AEAD_ERROR_CIPFAIL;
+        }
+#endif /* CRYPTO_CHACHA_POLY_CM4 */
+    }
+    return ret_chaChaPolyStat_en;
+}
 // *****************************************************************************
\ No newline at end of file
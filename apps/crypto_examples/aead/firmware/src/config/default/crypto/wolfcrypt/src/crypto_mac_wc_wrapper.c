@@ -0,0 +1,118 @@
+/*******************************************************************************
+  MPLAB Harmony Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_mac_wc_wrapper.c
+
+  Summary:
+    This file contains the source code for the MPLAB Harmony application.
+
+  Description:
+    This file contains the wolfCrypt handler of the MAC algorithms of the
+    Common Crypto API.
+*******************************************************************************/
+
+ 
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_mac_cipher.h"
+#include "crypto/wolfcrypt/crypto_mac_wc_wrapper.h"
+#include "wolfssl/wolfcrypt/error-crypt.h"
+#include "wolfssl/wolfcrypt/aes.h"
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+crypto_Mac_Status_E Crypto_Mac_Wc_AesGmac_Init(void *ptr_aesGmacCtx, uint8_t *ptr_key, uint32_t keySize)
+{
+    crypto_Mac_Status_E ret_aesGmacStat_en = CRYPTO_MAC_ERROR_CIPNOTSUPPTD;
+    int wcAesGmacStatus = BAD_FUNC_ARG;
+    
+    if(ptr_aesGmacCtx != NULL)
+    {
+        wcAesGmacStatus = wc_AesInit(&((Gmac*)ptr_aesGmacCtx)->aes, NULL, INVALID_DEVID);
+        
+        if(wcAesGmacStatus == 0)
+        {
+            wcAesGmacStatus = wc_GmacSetKey((Gmac*)ptr_aesGmacCtx, (const byte*)ptr_key, (word32)keySize);
+        }
+
+        if(wcAesGmacStatus == 0)
+        {
+            ret_aesGmacStat_en = CRYPTO_MAC_CIPHER_SUCCESS;
+        }
+        else if (wcAesGmacStatus == WC_KEY_SIZE_E)
+        {
+            ret_aesGmacStat_en = CRYPTO_MAC_ERROR_KEY;
+        }
+        else if(wcAesGmacStatus == BAD_FUNC_ARG)
+        {
+            ret_aesGmacStat_en = CRYPTO_MAC_ERROR_ARG;
+        }
+        else
+        {
+            ret_aesGmacStat_en  = CRYPTO_MAC_ERROR_CIPFAIL;
+        }
+    }
+    else
+    {
+        ret_aesGmacStat_en = CRYPTO_MAC_ERROR_CTX;
+    }
+    return ret_aesGmacStat_en;
+}
+
+crypto_Mac_Status_E Crypto_Mac_Wc_AesGmac_Cipher(void *ptr_aesGmacCtx, uint8_t *ptr_initVect, uint32_t initVectLen,
+                                                    uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_outMac, uint32_t macLen)
+{
+    crypto_Mac_Status_E ret_aesGmacStat_en = CRYPTO_MAC_ERROR_CIPNOTSUPPTD;
+    int wcAesGmacStatus = BAD_FUNC_ARG;
+    
+    if(ptr_aesGmacCtx != NULL)
+    {
+        wcAesGmacStatus = wc_GmacUpdate((Gmac*)ptr_aesGmacCtx, (const byte*)ptr_initVect, (word32)initVectLen, 
+                                            (const byte*)ptr_aad, (word32)aadLen, (byte*)ptr_outMac, (word32)macLen);
+        if(wcAesGmacStatus == 0)
+        {
+            ret_aesGmacStat_en = CRYPTO_MAC_CIPHER_SUCCESS;
+        }
+        else if(wcAesGmacStatus == BAD_FUNC_ARG)
+        {
+            ret_aesGmacStat_en = CRYPTO_MAC_ERROR_ARG;
+        }
+        else
+        {
+            ret_aesGmacStat_en  = CRYPTO_MAC_ERROR_CIPFAIL;
+        }
+    }
+    else
+    {
+        ret_aesGmacStat_en = CRYPTO_MAC_ERROR_CTX;
+    }
+    return ret_aesGmacStat_en;
+}
+
+crypto_Mac_Status_E Crypto_Mac_Wc_AesGmac_Direct(uint8_t *ptr_initVect, uint32_t initVectLen, uint8_t *ptr_aad, uint32_t aadLen,
+                                                    uint8_t *ptr_outMac, uint32_t macLen, uint8_t *ptr_key, uint32_t keySize)
+{
+    crypto_Mac_Status_E ret_aesGmacStat_en = CRYPTO_MAC_ERROR_CIPNOTSUPPTD;
+    Gmac arr_aesGmacCtx[1];
+    
+    ret_aesGmacStat_en = Crypto_Mac_Wc_AesGmac_Init((void*)arr_aesGmacCtx, ptr_key, keySize);
+    
+    if(ret_aesGmacStat_en == CRYPTO_MAC_CIPHER_SUCCESS)
+    {
+        ret_aesGmacStat_en = Crypto_Mac_Wc_AesGmac_Cipher((void*)arr_aesGmacCtx, ptr_initVect, initVectLen, 
+                                                            ptr_aad, aadLen, ptr_outMac, macLen);
+    }
+    wc_AesFree(&arr_aesGmacCtx[0].aes);
+    
+    return ret_aesGmacStat_en;
+}
@@ -123,7 +123,8 @@ extern "C" {
 #define WC_ECC_NONBLOCK      //JK
 
 #define NO_PWDBASED
-//#define WOLF_CRYPTO_CB     //Provide call-back support 
+#define WOLF_CRYPTO_CB     //Provide call-back support 
+#define CRYPTO_CRYPTOCB_HW_AES_GCM  //AES-GCM on the AES6149, crypto_cryptocb_wc_wrapper.c
 #define WOLFCRYPT_ONLY
 #define HAVE_COMP_KEY        //JK 
 
@@ -148,6 +149,7 @@ extern "C" {
 #define WOLFSSL_AES_CFB
 #define WOLFSSL_AES_OFB
 #define HAVE_AESGCM
+#define WC_AES_GCM_DEC_AUTH_EARLY  //Tag checked before the CTR pass, crypto_aead_wc_wrapper.c
 #define WOLFSSL_AES_XTS
 #define HAVE_AESCCM
 #define WOLFSSL_CMAC
@@ -191,6 +193,10 @@ extern "C" {
 #define HAVE_BLAKE2S    
 #define HAVE_BLAKE2B   
 #define HAVE_CHACHA      
+#define HAVE_POLY1305
+//Cortex-M4 ChaCha20 block and Poly1305 (UMAAL) kernels for the wolfCrypt
+//handler; comment out to fall back to the portable wolfCrypt code
+#define CRYPTO_CHACHA_POLY_CM4
 #define HAVE_AES_KEYWRAP
 #define HAVE_ECC_DHE   
 //#define WOLFCRYPT_HAVE_ECCSI  //JK
@@ -0,0 +1,276 @@
+/*******************************************************************************
+  Host Test Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    cpkcc_sp_int_test.c
+
+  Summary:
+    Host check of the CPKCC sp_int hooks against the software sp_int.
+
+  Description:
+    This program links the shipped sp_int.c, the hooks in cpkcc-sp-int.c
+    and drv_crypto_mp_hw_cpkcl.c with the --wrap options of the firmware,
+    the CPKCL services being the reference model in cpkcl_model.c. Each
+    hooked operation is compared with its __real_ software version:
+      - mulmod, also with the result on an operand
+      - mod of a double length number
+      - exptmod, exptmod_ex on more digits than the exponent has, and
+        exptmod_nct
+      - invmod, also without inverse on a composite modulus
+    on odd moduli of 255 bits (below the threshold, software only) and of
+    256, 384, 521, 1024, 2048 and 3072 bits. The model call counts show
+    which path ran, and that the reduction constant is set up again only
+    when the modulus changes.
+
+    Build and run from this directory; stub/ points the driver at the
+    model and resolves the lower case driver include path:
+      gcc -Wall -DWOLFSSL_USER_SETTINGS -I. -Istub -I../src/config/default \
+          -I../src/third_party/wolfssl -I../src/third_party/wolfssl/wolfssl \
+          -Wl,--wrap=sp_mod,--wrap=sp_mulmod,--wrap=sp_invmod \
+          -Wl,--wrap=sp_exptmod,--wrap=sp_exptmod_ex,--wrap=sp_exptmod_nct \
+          cpkcc_sp_int_test.c cpkcl_model.c \
+          ../src/config/default/crypto/drivers/Driver/src/drv_crypto_mp_hw_cpkcl.c \
+          ../src/third_party/wolfssl/wolfcrypt/src/port/cpkcc/cpkcc-sp-int.c \
+          ../src/third_party/wolfssl/wolfcrypt/src/sp_int.c \
+          ../src/third_party/wolfssl/wolfcrypt/src/memory.c \
+          -o cpkcc_sp_int_test && ./cpkcc_sp_int_test
+
+    The exit status is the number of failed checks.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <stdbool.h>
+#include <string.h>
+#include <limits.h>
+
+#include <wolfssl/wolfcrypt/settings.h>
+#include <wolfssl/wolfcrypt/sp_int.h>
+#include <wolfssl/wolfcrypt/random.h>
+#include <wolfssl/wolfcrypt/port/cpkcc/cpkcc-sp-int.h>
+
+#include "cpkcl_model.h"
+
+#define TEST_MAX_BYTES      (768U)
+
+static int failed = 0;
+static uint32_t prng = 0x2545F491U;
+
+/* sp_int.c links the prime test, which is not run here */
+int wc_RNG_GenerateBlock(WC_RNG *rng, byte *b, word32 sz)
+{
+    (void) rng;
+    (void) b;
+    (void) sz;
+
+    return -1;
+}
+
+static void Check(const char *ptr_name, int bits, bool ok)
+{
+    printf("%-44s %4d %s\n", ptr_name, bits, ok ? "OK" : "FAIL");
+    if (!ok)
+    {
+        failed++;
+    }
+}
+
+static void Random(sp_int *ptr_a, int bits)
+{
+    byte be[TEST_MAX_BYTES];
+    int bytes = (bits + 7) / 8;
+    int i;
+
+    for (i = 0; i < bytes; i++)
+    {
+        prng ^= prng << 13;
+        prng ^= prng >> 17;
+        prng ^= prng << 5;
+        be[i] = (byte)prng;
+    }
+    if ((bits % 8) != 0)
+    {
+        be[0] &= (byte)((1U << (bits % 8)) - 1U);
+    }
+    (void) sp_read_unsigned_bin(ptr_a, be, (word32)bytes);
+}
+
+/* Odd modulus of exactly bits bits */
+static void Modulus(sp_int *ptr_n, int bits)
+{
+    Random(ptr_n, bits);
+    (void) sp_set_bit(ptr_n, bits - 1);
+    (void) sp_set_bit(ptr_n, 0);
+}
+
+/* Hooked and software results agree, the hook reaching the model when
+   expected */
+static bool Same(int errHook, const sp_int *ptr_hook, int errSw,
+    const sp_int *ptr_sw, uint32_t calls, bool hw)
+{
+    return (errHook == errSw) &&
+           ((errHook != MP_OKAY) || (sp_cmp(ptr_hook, ptr_sw) == MP_EQ)) &&
+           ((calls != 0U) == hw);
+}
+
+static void Test_Size(int bits)
+{
+    bool hw = (bits >= WOLFSSL_SP_CPKCC_MIN_BITS);
+    sp_int n, a, b, e, x, r, s;
+    uint32_t calls;
+    int errHook;
+    int errSw;
+
+    (void) sp_init_multi(&n, &a, &b, &e, &x, &r);
+    (void) sp_init(&s);
+    Modulus(&n, bits);
+    Random(&a, bits - 1);
+    Random(&b, bits - 1);
+    Random(&e, bits);
+    Random(&x, 2 * bits);
+
+    calls = cpkclModelCount.fmult;
+    errHook = sp_mulmod(&a, &b, &n, &r);
+    errSw = __real_sp_mulmod(&a, &b, &n, &s);
+    Check("mulmod", bits, Same(errHook, &r, errSw, &s,
+        cpkclModelCount.fmult - calls, hw));
+
+    (void) sp_copy(&a, &r);
+    errHook = sp_mulmod(&r, &b, &n, &r);
+    Check("mulmod, result on an operand", bits,
+        Same(errHook, &r, errSw, &s, 0U, false));
+
+    calls = cpkclModelCount.redModReduction;
+    errHook = sp_mod(&x, &n, &r);
+    errSw = __real_sp_mod(&x, &n, &s);
+    Check("mod of a double length number", bits, Same(errHook, &r, errSw,
+        &s, cpkclModelCount.redModReduction - calls, hw));
+
+    calls = cpkclModelCount.expModRegular;
+    errHook = sp_exptmod(&a, &e, &n, &r);
+    errSw = __real_sp_exptmod(&a, &e, &n, &s);
+    Check("exptmod", bits, Same(errHook, &r, errSw, &s,
+        cpkclModelCount.expModRegular - calls, hw));
+
+    /* Short exponent processed on as many digits as the modulus. The
+       software reads the digits above used, which must be zero. */
+    sp_forcezero(&e);
+    Random(&e, bits / 2);
+    calls = cpkclModelCount.expModRegular;
+    errHook = sp_exptmod_ex(&a, &e, (int)n.used, &n, &r);
+    errSw = __real_sp_exptmod_ex(&a, &e, (int)n.used, &n, &s);
+    Check("exptmod_ex, digits above the exponent", bits, Same(errHook, &r,
+        errSw, &s, cpkclModelCount.expModRegular - calls, hw));
+
+    calls = cpkclModelCount.expModFast;
+    errHook = sp_exptmod_nct(&b, &e, &n, &r);
+    errSw = __real_sp_exptmod_nct(&b, &e, &n, &s);
+    Check("exptmod_nct", bits, Same(errHook, &r, errSw, &s,
+        cpkclModelCount.expModFast - calls, hw));
+
+    /* Zero exponent: software whatever the size */
+    sp_zero(&e);
+    calls = cpkclModelCount.expModRegular + cpkclModelCount.expModFast;
+    errHook = sp_exptmod(&a, &e, &n, &r);
+    errSw = __real_sp_exptmod(&a, &e, &n, &s);
+    Check("exptmod, zero exponent", bits, Same(errHook, &r, errSw, &s,
+        cpkclModelCount.expModRegular + cpkclModelCount.expModFast - calls,
+        false));
+
+    calls = cpkclModelCount.gcd;
+    errHook = sp_invmod(&a, &n, &r);
+    errSw = __real_sp_invmod(&a, &n, &s);
+    Check("invmod", bits, Same(errHook, &r, errSw, &s,
+        cpkclModelCount.gcd - calls, hw));
+
+    /* n and a multiples of 3: no inverse */
+    do
+    {
+        Random(&x, bits - 1);
+        (void) sp_set_bit(&x, 0);
+        (void) sp_mul_d(&x, 3U, &n);
+    } while (sp_count_bits(&n) != bits);
+    (void) sp_mul_d(&b, 3U, &x);
+    (void) __real_sp_mod(&x, &n, &a);
+    calls = cpkclModelCount.gcd;
+    errHook = sp_invmod(&a, &n, &r);
+    errSw = __real_sp_invmod(&a, &n, &s);
+    Check("invmod without inverse", bits, (errSw == MP_VAL) &&
+        Same(errHook, &r, errSw, &s, cpkclModelCount.gcd - calls, hw));
+}
+
+/* The reduction constant is set up once per run of the same modulus */
+static void Test_CnsCache(void)
+{
+    sp_int n1, n2, a, b, r, s;
+    uint32_t setups = cpkclModelCount.redModSetup;
+    bool ok = true;
+
+    (void) sp_init_multi(&n1, &n2, &a, &b, &r, &s);
+    Modulus(&n1, 384);
+    Modulus(&n2, 384);
+    Random(&a, 383);
+    Random(&b, 383);
+
+    ok = ok && (sp_mulmod(&a, &b, &n1, &r) == MP_OKAY);
+    ok = ok && (sp_mulmod(&a, &b, &n1, &r) == MP_OKAY);
+    ok = ok && (cpkclModelCount.redModSetup - setups == 1U);
+    ok = ok && (sp_mulmod(&a, &b, &n2, &r) == MP_OKAY);
+    ok = ok && (__real_sp_mulmod(&a, &b, &n2, &s) == MP_OKAY) &&
+         (sp_cmp(&r, &s) == MP_EQ);
+    ok = ok && (sp_mulmod(&a, &b, &n1, &r) == MP_OKAY);
+    ok = ok && (__real_sp_mulmod(&a, &b, &n1, &s) == MP_OKAY) &&
+         (sp_cmp(&r, &s) == MP_EQ);
+    ok = ok && (cpkclModelCount.redModSetup - setups == 3U);
+    Check("reduction constant set up on modulus change", 384, ok);
+}
+
+/* A threshold above 3072 bits keeps everything in software */
+static void Test_Threshold(void)
+{
+    CPKCL_MODEL_COUNT before = cpkclModelCount;
+    sp_int n, a, b, r, s;
+
+    (void) sp_init_multi(&n, &a, &b, &r, &s, NULL);
+    Modulus(&n, 2048);
+    Random(&a, 2047);
+    Random(&b, 2047);
+
+    cpkcc_sp_set_min_bits(INT_MAX);
+    (void) sp_mulmod(&a, &b, &n, &r);
+    (void) sp_exptmod(&a, &b, &n, &r);
+    (void) sp_invmod(&a, &n, &r);
+    cpkcc_sp_set_min_bits(WOLFSSL_SP_CPKCC_MIN_BITS);
+    (void) __real_sp_invmod(&a, &n, &s);
+
+    Check("threshold above 3072 bits, software only", 2048,
+        (memcmp(&before, &cpkclModelCount, sizeof(before)) == 0) &&
+        (sp_cmp(&r, &s) == MP_EQ));
+}
+
+int main(void)
+{
+    static const int sizes[] = { 255, 256, 384, 521, 1024, 2048, 3072 };
+    size_t i;
+
+    for (i = 0; i < (sizeof(sizes) / sizeof(sizes[0])); i++)
+    {
+        Test_Size(sizes[i]);
+    }
+    Test_CnsCache();
+    Test_Threshold();
+
+    Check("no service rule broken", 0, cpkclModelCount.violations == 0U);
+    printf("Model calls: Fmult %u, RedMod %u/%u/%u, ExpMod %u/%u, GCD %u\n",
+        (unsigned)cpkclModelCount.fmult, (unsigned)cpkclModelCount.redModSetup,
+        (unsigned)cpkclModelCount.redModReduction,
+        (unsigned)cpkclModelCount.redModNormalize,
+        (unsigned)cpkclModelCount.expModRegular,
+        (unsigned)cpkclModelCount.expModFast, (unsigned)cpkclModelCount.gcd);
+
+    printf("%s\n", (failed == 0) ? "All checks passed" : "Checks failed");
+
+    return failed;
+}
@@ -0,0 +1,498 @@
+/*******************************************************************************
+  Host Test Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    cpkcl_model.c
+
+  Summary:
+    Reference model of the CPKCL multi-precision services.
+
+  Description:
+    The services compute with the wolfCrypt software versions and keep to
+    the contract of the ROM ones rather than to their internals:
+      - every area is checked to lie in the 4 KB crypto RAM and the areas a
+        service writes are checked not to overlap the ones it reads
+      - RedMod setup writes a reduction constant derived from the modulus;
+        the reduction and ExpMod fail when it does not match the modulus,
+        which catches a stale constant cache in the driver
+      - the fast reduction returns a result below 2n, n above the exact
+        one on every other call, so a missing normalization shows
+      - the setup, ExpMod and GCD overwrite their workspace and GCD its
+        inputs, as the ROM services do
+    Any broken rule sets a severe status and counts a violation.
+*******************************************************************************/
+
+#include <stdio.h>
+#include <string.h>
+
+#include <wolfssl/wolfcrypt/settings.h>
+#include <wolfssl/wolfcrypt/sp_int.h>
+#include <wolfssl/wolfcrypt/port/cpkcc/cpkcc-sp-int.h>
+
+#include "crypto/drivers/driver/drv_crypto_ecc_hw_cpkcl.h"
+#include "crypto/drivers/driver/drv_crypto_mp_hw_cpkcl.h"
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_typedef_pb.h"
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_mapping_pb.h"
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_Headers_pb.h"
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_JumpTable_Addr_pb.h"
+#include "cpkcl_model.h"
+
+#define MODEL_RAM_START     (0x1000U)
+#define MODEL_RAM_END       (0x2000U)
+#define MODEL_MAX_BYTES     (2U * CRYPTO_MP_HW_MAX_MODULUS_SIZE + 8U)
+#define MODEL_SCRIBBLE      (0xEEU)
+
+typedef struct
+{
+    const char *name;
+    uint32_t start;
+    uint32_t length;
+} MODEL_AREA;
+
+/* The crypto RAM is the upper half, nu1 offsets 0x1000 to 0x1FFF */
+unsigned char cpkclModelRam[0x2000] __attribute__((aligned(0x10000)));
+
+static CPKCL_PARAM cpkclModelParam;
+PCPKCL_PARAM pvCPKCLParam = &cpkclModelParam;
+
+CPKCL_MODEL_COUNT cpkclModelCount;
+
+static uint32_t reductionParity = 0U;
+
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_CheckCpkcl(void)
+{
+    return CRYPTO_CPKCL_RESULT_INIT_SUCCESS;
+}
+
+void DRV_CRYPTO_ECC_RamInvalidate(void)
+{
+}
+
+static u2 Violation(const char *ptr_service, const char *ptr_what, u2 u2Status)
+{
+    printf("CPKCL model: %s: %s\n", ptr_service, ptr_what);
+    cpkclModelCount.violations++;
+
+    return u2Status;
+}
+
+/* Checks the areas lie in crypto RAM and the ones from index first on
+   overlap none of the others */
+static u2 CheckAreas(const char *ptr_service, const MODEL_AREA *ptr_areas,
+    size_t count, size_t first)
+{
+    size_t i;
+    size_t j;
+
+    for (i = 0; i < count; i++)
+    {
+        if ((ptr_areas[i].start < MODEL_RAM_START) ||
+            ((ptr_areas[i].start + ptr_areas[i].length) > MODEL_RAM_END))
+        {
+            return Violation(ptr_service, ptr_areas[i].name,
+                CPKCL_PARAM_NOT_IN_CPKCCRAM);
+        }
+    }
+
+    for (i = first; i < count; i++)
+    {
+        for (j = 0; j < count; j++)
+        {
+            if ((i != j) &&
+                (ptr_areas[i].start < (ptr_areas[j].start + ptr_areas[j].length)) &&
+                (ptr_areas[j].start < (ptr_areas[i].start + ptr_areas[i].length)))
+            {
+                printf("CPKCL model: %s: %s overlaps %s\n", ptr_service,
+                    ptr_areas[i].name, ptr_areas[j].name);
+                return Violation(ptr_service, "overlap",
+                    CPKCL_OVERLAP_NOT_ALLOWED);
+            }
+        }
+    }
+
+    return CPKCL_OK;
+}
+
+/* Numbers are LSB first in crypto RAM */
+static void Load(sp_int *ptr_a, nu1 nu1Base, uint32_t length)
+{
+    byte be[MODEL_MAX_BYTES];
+    uint32_t i;
+
+    for (i = 0; i < length; i++)
+    {
+        be[i] = cpkclModelRam[nu1Base + length - 1U - i];
+    }
+    (void) sp_read_unsigned_bin(ptr_a, be, length);
+}
+
+static void Store(nu1 nu1Base, uint32_t length, const sp_int *ptr_a)
+{
+    byte be[MODEL_MAX_BYTES];
+    uint32_t i;
+
+    (void) sp_to_unsigned_bin_len(ptr_a, be, (int)length);
+    for (i = 0; i < length; i++)
+    {
+        cpkclModelRam[nu1Base + i] = be[length - 1U - i];
+    }
+}
+
+/* The model reduction constant: n xored with a pattern, then the length */
+static void CnsOf(nu1 nu1ModBase, u2 u2ModLength, u1 *ptr_cns)
+{
+    uint32_t i;
+
+    for (i = 0; i < u2ModLength; i++)
+    {
+        ptr_cns[i] = cpkclModelRam[nu1ModBase + i] ^ 0x5AU;
+    }
+    ptr_cns[u2ModLength] = (u1)u2ModLength;
+    ptr_cns[u2ModLength + 1U] = (u1)(u2ModLength >> 8);
+    ptr_cns[u2ModLength + 2U] = 0xC5U;
+    ptr_cns[u2ModLength + 3U] = 0x5CU;
+    (void) memset(&ptr_cns[u2ModLength + 4U], 0, 4U);
+}
+
+static bool CnsMatches(nu1 nu1ModBase, nu1 nu1CnsBase, u2 u2ModLength)
+{
+    u1 cns[CRYPTO_MP_HW_MAX_MODULUS_SIZE + 8U];
+
+    CnsOf(nu1ModBase, u2ModLength, cns);
+
+    return (memcmp(cns, &cpkclModelRam[nu1CnsBase], u2ModLength + 8U) == 0);
+}
+
+static bool ModulusValid(nu1 nu1ModBase, u2 u2ModLength)
+{
+    return ((u2ModLength >= CRYPTO_MP_HW_MIN_MODULUS_SIZE) &&
+            (u2ModLength <= CRYPTO_MP_HW_MAX_MODULUS_SIZE) &&
+            ((u2ModLength & 3U) == 0U) &&
+            ((cpkclModelRam[nu1ModBase] & 1U) == 1U));
+}
+
+/* Euclid, sp_gcd is only built with key generation */
+static void Gcd(const sp_int *ptr_x, const sp_int *ptr_y, sp_int *ptr_a)
+{
+    sp_int u;
+    sp_int v;
+
+    (void) sp_init(&u);
+    (void) sp_init(&v);
+    (void) sp_copy(ptr_y, &u);
+    (void) sp_copy(ptr_x, &v);
+    while (!sp_iszero(&v))
+    {
+        (void) __real_sp_mod(&u, &v, ptr_a);
+        (void) sp_copy(&v, &u);
+        (void) sp_copy(ptr_a, &v);
+    }
+    (void) sp_copy(&u, ptr_a);
+}
+
+void vCPKCLCsFmult(PCPKCL_PARAM pvParam)
+{
+    CPKCL_FMULT_STRUCT *ptr_p = &pvParam->P.CPKCL_Fmult_s;
+    u2 u2XLength = ptr_p->u2XLength;
+    u2 u2YLength = ptr_p->u2YLength;
+    MODEL_AREA areas[] = {
+        {"X", ptr_p->nu1XBase, u2XLength + 4U},
+        {"Y", ptr_p->nu1YBase, u2YLength + 4U},
+        {"N", ptr_p->nu1ModBase, ptr_p->u2ModLength + 4U},
+        {"R", ptr_p->nu1RBase, u2XLength + u2YLength + 4U},
+    };
+    sp_int x;
+    sp_int y;
+    sp_int r;
+
+    cpkclModelCount.fmult++;
+
+    if ((pvParam->CPKCL_Header.u2Option & MULTIPLIEROPTION_MASK) != MULT_ONLY)
+    {
+        pvParam->CPKCL_Header.u2Status = Violation("Fmult", "option",
+            CPKCL_UNEXPLOITABLE_OPTIONS);
+        return;
+    }
+    /* Z is not read by the plain multiplication */
+    pvParam->CPKCL_Header.u2Status = CheckAreas("Fmult", areas, 4U, 3U);
+    if (pvParam->CPKCL_Header.u2Status != CPKCL_OK)
+    {
+        return;
+    }
+
+    (void) sp_init(&x);
+    (void) sp_init(&y);
+    (void) sp_init(&r);
+    Load(&x, ptr_p->nu1XBase, u2XLength);
+    Load(&y, ptr_p->nu1YBase, u2YLength);
+    (void) sp_mul(&x, &y, &r);
+    Store(ptr_p->nu1RBase, u2XLength + u2YLength + 4U, &r);
+}
+
+void vCPKCLCsRedMod(PCPKCL_PARAM pvParam)
+{
+    CPKCL_REDMOD_STRUCT *ptr_p = &pvParam->P.CPKCL_RedMod_s;
+    u2 u2Option = pvParam->CPKCL_Header.u2Option;
+    u2 u2ModLength = ptr_p->u2ModLength;
+    MODEL_AREA areas[] = {
+        {"N", ptr_p->nu1ModBase, u2ModLength + 4U},
+        {"Cns", ptr_p->nu1CnsBase, u2ModLength + 12U},
+        {"X", ptr_p->nu1XBase, 0U},
+        {"R", ptr_p->nu1RBase, u2ModLength + 4U},
+    };
+    sp_int n;
+    sp_int x;
+    sp_int r;
+
+    if (!ModulusValid(ptr_p->nu1ModBase, u2ModLength))
+    {
+        pvParam->CPKCL_Header.u2Status = Violation("RedMod", "modulus",
+            CPKCL_MALFORMED_MODULUS);
+        return;
+    }
+
+    (void) sp_init(&n);
+    (void) sp_init(&x);
+    (void) sp_init(&r);
+
+    if (u2Option == CPKCL_REDMOD_SETUP)
+    {
+        cpkclModelCount.redModSetup++;
+        /* Cns, X and R are all written */
+        areas[2].length = (2U * u2ModLength) + 8U;
+        pvParam->CPKCL_Header.u2Status = CheckAreas("RedMod setup", areas,
+            4U, 1U);
+        if (pvParam->CPKCL_Header.u2Status == CPKCL_OK)
+        {
+            (void) memset(&cpkclModelRam[ptr_p->nu1CnsBase], 0,
+                u2ModLength + 12U);
+            CnsOf(ptr_p->nu1ModBase, u2ModLength,
+                &cpkclModelRam[ptr_p->nu1CnsBase]);
+            (void) memset(&cpkclModelRam[ptr_p->nu1XBase], MODEL_SCRIBBLE,
+                areas[2].length);
+            (void) memset(&cpkclModelRam[ptr_p->nu1RBase], MODEL_SCRIBBLE,
+                areas[3].length);
+        }
+        return;
+    }
+
+    if (u2Option == (CPKCL_REDMOD_REDUCTION | CPKCL_REDMOD_USING_FASTRED))
+    {
+        cpkclModelCount.redModReduction++;
+        areas[2].length = (2U * u2ModLength) + 4U;
+    }
+    else if (u2Option == CPKCL_REDMOD_NORMALIZE)
+    {
+        cpkclModelCount.redModNormalize++;
+        areas[2].length = u2ModLength + 4U;
+    }
+    else
+    {
+        pvParam->CPKCL_Header.u2Status = Violation("RedMod", "option",
+            CPKCL_UNEXPLOITABLE_OPTIONS);
+        return;
+    }
+
+    pvParam->CPKCL_Header.u2Status = CheckAreas("RedMod", areas, 4U, 3U);
+    if (pvParam->CPKCL_Header.u2Status != CPKCL_OK)
+    {
+        return;
+    }
+    if (!CnsMatches(ptr_p->nu1ModBase, ptr_p->nu1CnsBase, u2ModLength))
+    {
+        pvParam->CPKCL_Header.u2Status = Violation("RedMod",
+            "reduction constant not set up for this modulus",
+            CPKCL_MALFORMED_MODULUS);
+        return;
+    }
+
+    Load(&n, ptr_p->nu1ModBase, u2ModLength);
+    Load(&x, ptr_p->nu1XBase, areas[2].length);
+
+    if (u2Option == CPKCL_REDMOD_NORMALIZE)
+    {
+        /* One subtraction at most: the input must be below 2n */
+        (void) sp_add(&n, &n, &r);
+        if (sp_cmp(&x, &r) != MP_LT)
+        {
+            pvParam->CPKCL_Header.u2Status = Violation("RedMod normalize",
+                "input not below 2n", CPKCL_PARAM_X_BIGGER_THAN_Y);
+            return;
+        }
+        if (sp_cmp(&x, &n) != MP_LT)
+        {
+            (void) sp_sub(&x, &n, &r);
+        }
+        else
+        {
+            (void) sp_copy(&x, &r);
+        }
+    }
+    else
+    {
+        (void) __real_sp_mod(&x, &n, &r);
+        reductionParity ^= 1U;
+        if (reductionParity != 0U)
+        {
+            (void) sp_add(&r, &n, &r);
+        }
+    }
+
+    Store(ptr_p->nu1RBase, u2ModLength + 4U, &r);
+}
+
+void vCPKCLCsExpMod(PCPKCL_PARAM pvParam)
+{
+    CPKCL_EXPMOD_STRUCT *ptr_p = &pvParam->P.CPKCL_ExpMod_s;
+    u2 u2Option = pvParam->CPKCL_Header.u2Option;
+    u2 u2ModLength = ptr_p->u2ModLength;
+    u2 u2ExpLength = ptr_p->u2ExpLength;
+    uintptr_t expOffset = (uintptr_t)ptr_p->pfu1ExpBase -
+        (uintptr_t)cpkclModelRam;
+    MODEL_AREA areas[] = {
+        {"N", ptr_p->nu1ModBase, u2ModLength + 4U},
+        {"Cns", ptr_p->nu1CnsBase, u2ModLength + 12U},
+        {"Exp", (uint32_t)expOffset, u2ExpLength + 4U},
+        {"X", ptr_p->nu1XBase, (3U * u2ModLength) + 24U},
+        {"Precomp", ptr_p->nu1PrecompBase, (3U * u2ModLength) + 24U},
+    };
+    sp_int n;
+    sp_int x;
+    sp_int e;
+    sp_int r;
+
+    if ((u2Option & CPKCL_EXPMOD_OPERATIONMASK) ==
+        (CPKCL_EXPMOD_REGULARRSA | CPKCL_EXPMOD_EXPINPKCCRAM))
+    {
+        cpkclModelCount.expModRegular++;
+    }
+    else if ((u2Option & CPKCL_EXPMOD_OPERATIONMASK) ==
+             (CPKCL_EXPMOD_FASTRSA | CPKCL_EXPMOD_EXPINPKCCRAM))
+    {
+        cpkclModelCount.expModFast++;
+    }
+    else
+    {
+        pvParam->CPKCL_Header.u2Status = Violation("ExpMod", "option",
+            CPKCL_UNEXPLOITABLE_OPTIONS);
+        return;
+    }
+
+    if (!ModulusValid(ptr_p->nu1ModBase, u2ModLength) ||
+        (u2ExpLength == 0U) || ((u2ExpLength & 3U) != 0U) ||
+        (ptr_p->u1Blinding != 0U))
+    {
+        pvParam->CPKCL_Header.u2Status = Violation("ExpMod", "lengths",
+            CPKCL_PARAM_WRONG_LENGTH);
+        return;
+    }
+    pvParam->CPKCL_Header.u2Status = CheckAreas("ExpMod", areas, 5U, 3U);
+    if (pvParam->CPKCL_Header.u2Status != CPKCL_OK)
+    {
+        return;
+    }
+    if (!CnsMatches(ptr_p->nu1ModBase, ptr_p->nu1CnsBase, u2ModLength))
+    {
+        pvParam->CPKCL_Header.u2Status = Violation("ExpMod",
+            "reduction constant not set up for this modulus",
+            CPKCL_MALFORMED_MODULUS);
+        return;
+    }
+    if ((cpkclModelRam[ptr_p->nu1XBase] | cpkclModelRam[ptr_p->nu1XBase + 1U] |
+         cpkclModelRam[ptr_p->nu1XBase + 2U] | cpkclModelRam[ptr_p->nu1XBase + 3U]) != 0U)
+    {
+        pvParam->CPKCL_Header.u2Status = Violation("ExpMod",
+            "least significant word of X not zero", CPKCL_PARAM_BAD_ALIGNEMENT);
+        return;
+    }
+
+    (void) sp_init(&n);
+    (void) sp_init(&x);
+    (void) sp_init(&e);
+    (void) sp_init(&r);
+    Load(&n, ptr_p->nu1ModBase, u2ModLength);
+    Load(&x, (nu1)(ptr_p->nu1XBase + 4U), u2ModLength);
+    Load(&e, (nu1)expOffset, u2ExpLength);
+    if (sp_cmp(&x, &n) != MP_LT)
+    {
+        pvParam->CPKCL_Header.u2Status = Violation("ExpMod", "x not below n",
+            CPKCL_PARAM_X_BIGGER_THAN_Y);
+        return;
+    }
+
+    (void) __real_sp_exptmod_nct(&x, &e, &n, &r);
+
+    (void) memset(&cpkclModelRam[ptr_p->nu1PrecompBase], MODEL_SCRIBBLE,
+        areas[4].length);
+    (void) memset(&cpkclModelRam[ptr_p->nu1XBase + 4U + u2ModLength],
+        MODEL_SCRIBBLE, (2U * u2ModLength) + 20U);
+    Store((nu1)(ptr_p->nu1XBase + 4U), u2ModLength, &r);
+}
+
+void vCPKCLCsGCD(PCPKCL_PARAM pvParam)
+{
+    CPKCL_GCD_STRUCT *ptr_p = &pvParam->P.CPKCL_GCD_s;
+    u2 u2Length = ptr_p->u2Length;
+    MODEL_AREA areas[] = {
+        {"X", ptr_p->nu1XBase, u2Length + 4U},
+        {"Y", ptr_p->nu1YBase, u2Length + 4U},
+        {"A", ptr_p->nu1ABase, u2Length + 4U},
+        {"Z", ptr_p->nu1ZBase, u2Length + 4U},
+        {"WorkSpace", ptr_p->nu1WorkSpace, u2Length + 4U},
+    };
+    sp_int x;
+    sp_int y;
+    sp_int a;
+    sp_int z;
+
+    cpkclModelCount.gcd++;
+
+    if ((u2Length < CRYPTO_MP_HW_MIN_MODULUS_SIZE) ||
+        (u2Length > CRYPTO_MP_HW_MAX_MODULUS_SIZE) || ((u2Length & 3U) != 0U))
+    {
+        pvParam->CPKCL_Header.u2Status = Violation("GCD", "length",
+            CPKCL_PARAM_WRONG_LENGTH);
+        return;
+    }
+    pvParam->CPKCL_Header.u2Status = CheckAreas("GCD", areas, 5U, 0U);
+    if (pvParam->CPKCL_Header.u2Status != CPKCL_OK)
+    {
+        return;
+    }
+
+    (void) sp_init(&x);
+    (void) sp_init(&y);
+    (void) sp_init(&a);
+    (void) sp_init(&z);
+    Load(&x, ptr_p->nu1XBase, u2Length);
+    Load(&y, ptr_p->nu1YBase, u2Length);
+    if (sp_iszero(&x) || (sp_cmp(&x, &y) != MP_LT))
+    {
+        pvParam->CPKCL_Header.u2Status = Violation("GCD", "x not in ]0, y[",
+            CPKCL_PARAM_X_BIGGER_THAN_Y);
+        return;
+    }
+
+    Gcd(&x, &y, &a);
+    if (sp_isone(&a))
+    {
+        (void) __real_sp_invmod(&x, &y, &z);
+        Store(ptr_p->nu1ZBase, u2Length + 4U, &z);
+    }
+    else
+    {
+        (void) memset(&cpkclModelRam[ptr_p->nu1ZBase], MODEL_SCRIBBLE,
+            u2Length + 4U);
+    }
+    Store(ptr_p->nu1ABase, u2Length + 4U, &a);
+
+    (void) memset(&cpkclModelRam[ptr_p->nu1XBase], MODEL_SCRIBBLE,
+        u2Length + 4U);
+    (void) memset(&cpkclModelRam[ptr_p->nu1YBase], MODEL_SCRIBBLE,
+        u2Length + 4U);
+    (void) memset(&cpkclModelRam[ptr_p->nu1WorkSpace], MODEL_SCRIBBLE,
+        u2Length + 4U);
+}
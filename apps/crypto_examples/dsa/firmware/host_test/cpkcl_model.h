@@ -0,0 +1,41 @@
+/*******************************************************************************
+  Host Test Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    cpkcl_model.h
+
+  Summary:
+    Reference model of the CPKCL multi-precision services.
+
+  Description:
+    cpkcl_model.c stands in for the Fmult, RedMod, ExpMod and GCD services
+    of the CPKCL ROM, so that drv_crypto_mp_hw_cpkcl.c and the wolfCrypt
+    hooks in cpkcc-sp-int.c run unchanged on the host. The counters tell
+    which services a test reached and how many calls broke a rule of the
+    services: area outside crypto RAM, overlapping areas, operand out of
+    range, reduction constant not set up for the modulus.
+*******************************************************************************/
+
+#ifndef CPKCL_MODEL_H
+#define CPKCL_MODEL_H
+
+#include <stdint.h>
+
+typedef struct
+{
+    uint32_t fmult;
+    uint32_t redModSetup;
+    uint32_t redModReduction;
+    uint32_t redModNormalize;
+    uint32_t expModRegular;
+    uint32_t expModFast;
+    uint32_t gcd;
+    uint32_t violations;
+} CPKCL_MODEL_COUNT;
+
+extern CPKCL_MODEL_COUNT cpkclModelCount;
+
+#endif // CPKCL_MODEL_H
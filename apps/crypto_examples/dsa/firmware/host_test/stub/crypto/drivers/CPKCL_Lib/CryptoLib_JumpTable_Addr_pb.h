@@ -0,0 +1,21 @@
+/*******************************************************************************
+  Host stand-in for CryptoLib_JumpTable_Addr_pb.h
+
+  Summary:
+    Points the services the multi-precision driver calls at the reference
+    model in cpkcl_model.c instead of the CPKCL ROM.
+*******************************************************************************/
+
+#ifndef CRYPTOLIB_JUMPTABLE_ADDR_PB_INCLUDED_
+#define CRYPTOLIB_JUMPTABLE_ADDR_PB_INCLUDED_
+
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_typedef_pb.h"
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_mapping_pb.h"
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_Headers_pb.h"
+
+void vCPKCLCsFmult(PCPKCL_PARAM pvParam);
+void vCPKCLCsRedMod(PCPKCL_PARAM pvParam);
+void vCPKCLCsExpMod(PCPKCL_PARAM pvParam);
+void vCPKCLCsGCD(PCPKCL_PARAM pvParam);
+
+#endif // CRYPTOLIB_JUMPTABLE_ADDR_PB_INCLUDED_
@@ -0,0 +1,22 @@
+/*******************************************************************************
+  Host stand-in for CryptoLib_mapping_pb.h
+
+  Summary:
+    Places the 4 KB crypto RAM in cpkclModelRam, see cpkcl_model.c. The
+    array is aligned on 64 KB so that the 16-bit nu1 offsets the services
+    take are the low half of the host addresses, as on the device.
+*******************************************************************************/
+
+#ifndef CRYPTOLIB_MAPPING_PB_INCLUDED
+#define CRYPTOLIB_MAPPING_PB_INCLUDED
+
+#include <stdint.h>
+
+extern unsigned char cpkclModelRam[0x2000];
+
+#define nu1CRYPTORAM_BASE            (nu1)0x1000
+#define u2CRYPTORAM_LENGTH           (u2)0x1000
+#define nu1CRYPTORAM_LAST            (nu1)(nu1CRYPTORAM_BASE + (u2CRYPTORAM_LENGTH - 1))
+#define MSB_EXTENT_CRYPTORAM         ((uintptr_t)cpkclModelRam)
+
+#endif // CRYPTOLIB_MAPPING_PB_INCLUDED
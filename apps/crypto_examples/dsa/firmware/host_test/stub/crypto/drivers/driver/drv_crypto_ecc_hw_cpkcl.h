@@ -0,0 +1,9 @@
+/*******************************************************************************
+  Host stand-in for crypto/drivers/driver/drv_crypto_ecc_hw_cpkcl.h
+
+  Summary:
+    The firmware include path names the driver directory in lower case,
+    which only resolves on a case insensitive file system.
+*******************************************************************************/
+
+#include "../../../../../src/config/default/crypto/drivers/Driver/drv_crypto_ecc_hw_cpkcl.h"
@@ -0,0 +1,30 @@
+/*******************************************************************************
+  Host Test Header File
+
+  File Name:
+    user_settings.h
+
+  Summary:
+    wolfCrypt settings of the CPKCC sp_int host test.
+
+  Description:
+    The sp_int part of the dsa wolfcrypt_config.h, with 32-bit digits as on
+    the Cortex-M4 so that the operands reach the driver with the same
+    lengths as on the device.
+*******************************************************************************/
+
+#ifndef USER_SETTINGS_H
+#define USER_SETTINGS_H
+
+#define WOLFCRYPT_ONLY
+#define NO_FILESYSTEM
+#define SINGLE_THREADED
+#define NO_DH
+#define HAVE_ECC
+#define WOLFSSL_SP_MATH_ALL
+#define WOLFSSL_SP_SMALL
+#define WOLFSSL_SP_NO_MALLOC
+#define SP_WORD_SIZE 32
+#define WOLFSSL_SP_CPKCC
+
+#endif // USER_SETTINGS_H
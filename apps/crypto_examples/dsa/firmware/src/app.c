@@ -27,7 +27,15 @@
 // *****************************************************************************
 // *****************************************************************************
 
+#include <limits.h>
 #include "app.h"
+#include "wolfssl/wolfcrypt/wolfmath.h"
+#include "wolfssl/wolfcrypt/port/cpkcc/cpkcc-sp-int.h"
+#include "wolfssl/wolfcrypt/sha256.h"
+#include "wolfssl/wolfcrypt/ecc.h"
+#include "wolfssl/wolfcrypt/random.h"
+#include "crypto/wolfcrypt/crypto_common_wc_wrapper.h"
+#include "crypto/wolfcrypt/crypto_cryptocb_wc_wrapper.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -39,6 +47,77 @@
 
 uint64_t diffCount;
 
+#define APP_CPKCL_LATENCY_ROUNDS    (10U)
+
+#define APP_KEYGEN_ROUNDS           (10U)
+
+#define APP_BATCH_SIZE              (8U)
+
+/* Item of the batch whose signature is corrupted, its bit must stay clear */
+#define APP_BATCH_BAD_ITEM          (3U)
+
+#define APP_KEY_HANDLE_ROUNDS       (10U)
+
+#define APP_POINT_ROUNDS            (10U)
+
+#define APP_COMB_ROUNDS             (10U)
+
+#define APP_RFC6979_ROUNDS          (10U)
+
+#define APP_ECQV_ROUNDS             (10U)
+
+/* Steps of a non-blocking operation run per slice, one slice standing for one
+   call of APP_Tasks */
+#define APP_NB_SLICE_STEPS          (8U)
+
+static uint8_t batchHash[APP_BATCH_SIZE][32];
+static uint8_t batchSig[APP_BATCH_SIZE][96];
+
+/* RSA operations timed on each handler, in the order they are printed */
+#define APP_RSA_PKCS1_SIGN          (0U)
+#define APP_RSA_PKCS1_VERIFY        (1U)
+#define APP_RSA_PSS_SIGN            (2U)
+#define APP_RSA_PSS_VERIFY          (3U)
+#define APP_RSA_OAEP_ENCRYPT        (4U)
+#define APP_RSA_OAEP_DECRYPT        (5U)
+#define APP_RSA_OPERATIONS          (6U)
+
+static uint8_t rsaPkcs1Sig[2][CRYPTO_RSA_MAX_MODULUS_SIZE];
+static uint8_t rsaPssSig[2][CRYPTO_RSA_MAX_MODULUS_SIZE];
+static uint8_t rsaCipher[2][CRYPTO_RSA_MAX_MODULUS_SIZE];
+static uint8_t rsaPlain[CRYPTO_RSA_MAX_MODULUS_SIZE];
+
+/* sp_int operations timed in software and on the CPKCC, in the order they are 
+   printed */
+#define APP_SP_MULMOD               (0U)
+#define APP_SP_MOD                  (1U)
+#define APP_SP_EXPTMOD              (2U)
+#define APP_SP_EXPTMOD_NCT          (3U)
+#define APP_SP_INVMOD               (4U)
+#define APP_SP_OPERATIONS           (5U)
+
+/* Big integers of the sp_int test, too large for the task stack */
+static mp_int spN;
+static mp_int spA;
+static mp_int spB;
+static mp_int spE;
+static mp_int spProduct;
+static mp_int spResult[2];
+
+/* wolfCrypt operations timed in software and through the crypto callback, in 
+   the order they are printed */
+#define APP_CB_SHA256               (0U)
+#define APP_CB_SIGN                 (1U)
+#define APP_CB_VERIFY               (2U)
+#define APP_CB_OPERATIONS           (3U)
+
+/* wolfCrypt objects of the crypto callback test, too large for the task stack */
+static wc_Sha256 cbSha[2];
+static ecc_key cbEccKey;
+static WC_RNG cbRng;
+static uint8_t cbSig[ECC_MAX_SIG_SIZE];
+static uint8_t cbSigK[2][ECC_MAX_SIG_SIZE];
+
 // *****************************************************************************
 /* Application Data
 
@@ -155,74 +234,1995 @@ void ECDSA_Verify_Test(ECDSA *ecdsa)
     }
 }
 
-// *****************************************************************************
-// *****************************************************************************
-// Section: Application Initialization and State Machine Functions
-// *****************************************************************************
-// *****************************************************************************
+/*******************************************************************************
+  Function:
+    void ECDSA_Cpkcl_Latency(ECDSA *ecdsa)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDSA_Cpkcl_Latency(ECDSA *ecdsa)
+{
+    crypto_DigiSign_Status_E status = CRYPTO_DIGISIGN_SUCCESS;
+    uint64_t reTestCount;
+    uint64_t reloadCount;
+    uint64_t cachedCount;
+    uint32_t i;
+
+    /* Self test in front of every signature, as before the result was cached */
+    appData.prevCounterVal = SYS_TIME_Counter64Get();
+    for (i = 0; (i < APP_CPKCL_LATENCY_ROUNDS) && (status == CRYPTO_DIGISIGN_SUCCESS); i++)
+    {
+        if (DRV_CRYPTO_ECC_ReTestCpkcl() != CRYPTO_CPKCL_RESULT_INIT_SUCCESS)
+        {
+            status = CRYPTO_DIGISIGN_ERROR_FAIL;
+        }
+        else
+        {
+            status = Crypto_DigiSign_Ecdsa_Sign(ecdsa->handler, ecdsa->inputHash,
+                ecdsa->inputHashSize, ecdsa->sig, ecdsa->sigSize, ecdsa->key,
+                ecdsa->keySize, ecdsa->curveType, SESSION_ID);
+        }
+    }
+    reTestCount = SYS_TIME_Counter64Get() - appData.prevCounterVal;
+
+    /* Cached self test result, curve constants loaded in crypto RAM each time */
+    appData.prevCounterVal = SYS_TIME_Counter64Get();
+    for (i = 0; (i < APP_CPKCL_LATENCY_ROUNDS) && (status == CRYPTO_DIGISIGN_SUCCESS); i++)
+    {
+        DRV_CRYPTO_ECC_RamInvalidate();
+        status = Crypto_DigiSign_Ecdsa_Sign(ecdsa->handler, ecdsa->inputHash,
+            ecdsa->inputHashSize, ecdsa->sig, ecdsa->sigSize, ecdsa->key,
+            ecdsa->keySize, ecdsa->curveType, SESSION_ID);
+    }
+    reloadCount = SYS_TIME_Counter64Get() - appData.prevCounterVal;
+
+    /* Cached self test result, curve constants resident in crypto RAM */
+    appData.prevCounterVal = SYS_TIME_Counter64Get();
+    for (i = 0; (i < APP_CPKCL_LATENCY_ROUNDS) && (status == CRYPTO_DIGISIGN_SUCCESS); i++)
+    {
+        status = Crypto_DigiSign_Ecdsa_Sign(ecdsa->handler, ecdsa->inputHash,
+            ecdsa->inputHashSize, ecdsa->sig, ecdsa->sigSize, ecdsa->key,
+            ecdsa->keySize, ecdsa->curveType, SESSION_ID);
+    }
+    cachedCount = SYS_TIME_Counter64Get() - appData.prevCounterVal;
+
+    if (status != CRYPTO_DIGISIGN_SUCCESS)
+    {
+        printf("Failed to create message signature\r\n");
+        printf("Status: %d\r\n", status);
+        appData.testsFailed++;
+    }
+    else
+    {
+        reTestCount /= APP_CPKCL_LATENCY_ROUNDS;
+        reloadCount /= APP_CPKCL_LATENCY_ROUNDS;
+        cachedCount /= APP_CPKCL_LATENCY_ROUNDS;
+        printf("Self test per call (us): %d\r\n", (int)SYS_TIME_CountToUS(reTestCount));
+        printf("Cached self test (us): %d\r\n", (int)SYS_TIME_CountToUS(reloadCount));
+        printf("Resident curve constants (us): %d\r\n", (int)SYS_TIME_CountToUS(cachedCount));
+        printf("Saved per operation (us): %d\r\n",
+            (int)SYS_TIME_CountToUS(reTestCount) - (int)SYS_TIME_CountToUS(cachedCount));
+        appData.testsPassed++;
+    }
+}
 
 /*******************************************************************************
   Function:
-    void APP_Initialize ( void )
+    void ECDSA_SignData_Test(ECDSA *ecdsa, uint8_t *pubKey, size_t pubKeySize,
+                             crypto_Hash_Algo_E hashType)
 
   Remarks:
-    See prototype in app.h.
+    See prototype in app_config.h.
  */
 
-void APP_Initialize ( void )
+void ECDSA_SignData_Test(ECDSA *ecdsa, uint8_t *pubKey, size_t pubKeySize,
+                         crypto_Hash_Algo_E hashType)
 {
-    /* Place the App state machine in its initial state. */
-    appData.state = APP_STATE_INIT;
-    
-    appData.speedTest = SYS_TIME_HANDLE_INVALID;
+    crypto_DigiSign_Status_E status;
+    int8_t hwVerifyStat = 0;
+    int8_t wcVerifyStat = 0;
 
-    appData.testsPassed = 0; 
-    appData.testsFailed = 0;
+    (void) memset(ecdsa->sig, 0, ecdsa->sigSize);
 
-    appData.isTestedECDSA = false;
+    appData.prevCounterVal = SYS_TIME_Counter64Get();
+
+    status = Crypto_DigiSign_Ecdsa_SignData(ecdsa->handler, ecdsa->inputHash,
+        ecdsa->inputHashSize, ecdsa->sig, ecdsa->sigSize, ecdsa->key,
+        ecdsa->keySize, hashType, ecdsa->curveType, SESSION_ID);
+
+    diffCount = (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+    printf("Sign time elapsed (ms): %d\r\n", (int)SYS_TIME_CountToMS(diffCount));
+
+    if (status == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+
+        status = Crypto_DigiSign_Ecdsa_VerifyData(ecdsa->handler, 
+            ecdsa->inputHash, ecdsa->inputHashSize, ecdsa->sig, ecdsa->sigSize,
+            pubKey, pubKeySize, hashType, &hwVerifyStat, ecdsa->curveType, 
+            SESSION_ID);
+
+        diffCount = (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+        printf("Verify time elapsed (ms): %d\r\n", (int)SYS_TIME_CountToMS(diffCount));
+    }
+
+    /* The signature must also hold for the software implementation */
+    if (status == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        status = Crypto_DigiSign_Ecdsa_VerifyData(CRYPTO_HANDLER_SW_WOLFCRYPT, 
+            ecdsa->inputHash, ecdsa->inputHashSize, ecdsa->sig, ecdsa->sigSize,
+            pubKey, pubKeySize, hashType, &wcVerifyStat, ecdsa->curveType, 
+            SESSION_ID);
+    }
+
+    if (status != CRYPTO_DIGISIGN_SUCCESS)
+    {
+        printf("Failed to sign or verify message\r\n");
+        printf("Status: %d\r\n", status);
+        appData.testsFailed++;
+    }
+    else if ((hwVerifyStat != 1) || (wcVerifyStat != 1))
+    {
+        printf("Signature rejected, HW: %d, wolfCrypt: %d\r\n", hwVerifyStat,
+            wcVerifyStat);
+        appData.testsFailed++;
+    }
+    else
+    {
+        printf("Test successful\r\n");
+        appData.testsPassed++;
+    }
 }
 
-/******************************************************************************
+/*******************************************************************************
   Function:
-    void APP_Tasks ( void )
+    void ECC_KeyGen_Test(ECDSA *ecdsa, uint8_t *pubKey, size_t pubKeySize)
 
   Remarks:
-    See prototype in app.h.
+    See prototype in app_config.h.
  */
 
-void APP_Tasks ( void )
+void ECC_KeyGen_Test(ECDSA *ecdsa, uint8_t *pubKey, size_t pubKeySize)
 {
-    /* Check the application's current state. */
-    switch ( appData.state )
+    crypto_DigiSign_Status_E status = CRYPTO_DIGISIGN_SUCCESS;
+    int8_t verifyStat = 0;
+    uint32_t i;
+
+    appData.prevCounterVal = SYS_TIME_Counter64Get();
+    for (i = 0; (i < APP_KEYGEN_ROUNDS) && (status == CRYPTO_DIGISIGN_SUCCESS); i++)
     {
-        /* Application's initial state. */
-        case APP_STATE_INIT:
+        status = Crypto_DigiSign_Ecc_KeyGen(ecdsa->handler, ecdsa->key,
+            ecdsa->keySize, pubKey, pubKeySize, ecdsa->curveType, SESSION_ID);
+    }
+    diffCount = (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+
+    if (status == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        printf("Key generation average (us): %d\r\n", 
+            (int)SYS_TIME_CountToUS(diffCount / APP_KEYGEN_ROUNDS));
+
+        /* The last pair must sign on this handler and verify on wolfCrypt */
+        status = Crypto_DigiSign_Ecdsa_Sign(ecdsa->handler, ecdsa->inputHash,
+            ecdsa->inputHashSize, ecdsa->sig, ecdsa->sigSize, ecdsa->key,
+            ecdsa->keySize, ecdsa->curveType, SESSION_ID);
+    }
+
+    if (status == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        status = Crypto_DigiSign_Ecdsa_Verify(CRYPTO_HANDLER_SW_WOLFCRYPT, 
+            ecdsa->inputHash, ecdsa->inputHashSize, ecdsa->sig, ecdsa->sigSize,
+            pubKey, pubKeySize, &verifyStat, ecdsa->curveType, SESSION_ID);
+    }
+
+    (void) memset(ecdsa->key, 0, ecdsa->keySize);
+
+    if (status != CRYPTO_DIGISIGN_SUCCESS)
+    {
+        printf("Failed to generate or use key pair\r\n");
+        printf("Status: %d\r\n", status);
+        appData.testsFailed++;
+    }
+    else if (verifyStat != 1)
+    {
+        printf("Signature with the generated key rejected\r\n");
+        appData.testsFailed++;
+    }
+    else
+    {
+        printf("Test successful\r\n");
+        appData.testsPassed++;
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void ECDSA_Pool_Test(ECDSA *ecdsa, uint8_t *pubKey, size_t pubKeySize)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDSA_Pool_Test(ECDSA *ecdsa, uint8_t *pubKey, size_t pubKeySize)
+{
+    crypto_DigiSign_Status_E status = CRYPTO_DIGISIGN_SUCCESS;
+    int8_t verifyStat = 1;
+    uint32_t pairs = 0;
+    uint32_t i;
+
+    if (Crypto_Ecc_Pool_Init(ecdsa->curveType) != CRYPTO_ECC_POOL_SUCCESS)
+    {
+        printf("Curve not supported by the pool\r\n");
+        appData.testsFailed++;
+        return;
+    }
+
+    /* What APP_Tasks does when idle, one pair per call */
+    appData.prevCounterVal = SYS_TIME_Counter64Get();
+    while (Crypto_Ecc_Pool_Tasks() == CRYPTO_ECC_POOL_SUCCESS)
+    {
+        pairs++;
+    }
+    diffCount = (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+
+    if (pairs != CRYPTO_ECC_POOL_SIZE)
+    {
+        printf("Failed to fill the pool\r\n");
+        appData.testsFailed++;
+        return;
+    }
+    printf("Precomputation per pair (us): %d\r\n", 
+        (int)SYS_TIME_CountToUS(diffCount / pairs));
+
+    /* Each signature takes one pair, the verification runs out of the timing */
+    diffCount = 0;
+    for (i = 0; (i < pairs) && (status == CRYPTO_DIGISIGN_SUCCESS) && (verifyStat == 1); i++)
+    {
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        status = Crypto_DigiSign_Ecdsa_Sign(ecdsa->handler, ecdsa->inputHash,
+            ecdsa->inputHashSize, ecdsa->sig, ecdsa->sigSize, ecdsa->key,
+            ecdsa->keySize, ecdsa->curveType, SESSION_ID);
+        diffCount += (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+
+        if (status == CRYPTO_DIGISIGN_SUCCESS)
         {
-            bool appInitialized = true;
+            status = Crypto_DigiSign_Ecdsa_Verify(CRYPTO_HANDLER_SW_WOLFCRYPT, 
+                ecdsa->inputHash, ecdsa->inputHashSize, ecdsa->sig, 
+                ecdsa->sigSize, pubKey, pubKeySize, &verifyStat, 
+                ecdsa->curveType, SESSION_ID);
+        }
+    }
 
-            if (appInitialized)
-            {
-                appData.state = APP_STATE_SERVICE_TASKS;
-            }
+    if ((status == CRYPTO_DIGISIGN_SUCCESS) && (verifyStat == 1))
+    {
+        printf("Sign with precomputed nonce average (us): %d\r\n", 
+            (int)SYS_TIME_CountToUS(diffCount / pairs));
 
-            break;
+        /* The pool is empty now, the same signatures run in full */
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        for (i = 0; (i < pairs) && (status == CRYPTO_DIGISIGN_SUCCESS); i++)
+        {
+            status = Crypto_DigiSign_Ecdsa_Sign(ecdsa->handler, ecdsa->inputHash,
+                ecdsa->inputHashSize, ecdsa->sig, ecdsa->sigSize, ecdsa->key,
+                ecdsa->keySize, ecdsa->curveType, SESSION_ID);
         }
+        diffCount = (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+    }
 
-        case APP_STATE_SERVICE_TASKS:
-        {               
-            if (!appData.isTestedECDSA)
-            {
-                printf("\r\n-----------ECDSA Hardware Wrapper-------------\r\n");
-                ECDSA_Test(CRYPTO_HANDLER_HW_INTERNAL);
-                
-                printf("\r\n-----------ECDSA wolfCrypt Wrapper-------------\r\n");
-                ECDSA_Test(CRYPTO_HANDLER_SW_WOLFCRYPT);
-                
-                appData.isTestedECDSA = true;
+    if (status != CRYPTO_DIGISIGN_SUCCESS)
+    {
+        printf("Failed to sign\r\n");
+        printf("Status: %d\r\n", status);
+        appData.testsFailed++;
+    }
+    else if (verifyStat != 1)
+    {
+        printf("Signature with precomputed nonce rejected\r\n");
+        appData.testsFailed++;
+    }
+    else
+    {
+        printf("Sign without precomputation average (us): %d\r\n", 
+            (int)SYS_TIME_CountToUS(diffCount / pairs));
+        printf("Test successful\r\n");
+        appData.testsPassed++;
+    }
+}
 
-                printf("\r\n-----------------------------------\r\n");
-                printf("Tests attempted: %d", appData.testsPassed + appData.testsFailed);
-                printf("\r\nTests successful: %d\r\n", appData.testsPassed);
+/*******************************************************************************
+  Function:
+    void ECDSA_VerifyBatch_Test(ECDSA *ecdsa, uint8_t *pubKey, size_t pubKeySize)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDSA_VerifyBatch_Test(ECDSA *ecdsa, uint8_t *pubKey, size_t pubKeySize)
+{
+    st_Crypto_DigiSign_Ecdsa_VerifyItem items[APP_BATCH_SIZE];
+    crypto_DigiSign_Status_E status = CRYPTO_DIGISIGN_SUCCESS;
+    uint32_t expectedBitmap = 0;
+    uint32_t bitmap = 0;
+    uint64_t singleCount = 0;
+    int8_t verifyStat = 0;
+    uint32_t i;
+
+    /* One signer, a different hash per item, signed out of the timing */
+    for (i = 0; (i < APP_BATCH_SIZE) && (status == CRYPTO_DIGISIGN_SUCCESS); i++)
+    {
+        (void) memcpy(batchHash[i], ecdsa->inputHash, sizeof(batchHash[i]));
+        batchHash[i][0] ^= (uint8_t)i;
+
+        status = Crypto_DigiSign_Ecdsa_Sign(CRYPTO_HANDLER_SW_WOLFCRYPT, 
+            batchHash[i], sizeof(batchHash[i]), batchSig[i], ecdsa->sigSize, 
+            ecdsa->key, ecdsa->keySize, ecdsa->curveType, SESSION_ID);
+
+        items[i].ptr_inputHash = batchHash[i];
+        items[i].hashLen = sizeof(batchHash[i]);
+        items[i].ptr_inputSig = batchSig[i];
+        items[i].sigLen = (uint32_t)ecdsa->sigSize;
+        items[i].ptr_pubKey = pubKey;
+        items[i].pubKeyLen = (uint32_t)pubKeySize;
+        
+        expectedBitmap |= ((uint32_t)1U << i);
+    }
+
+    if (status != CRYPTO_DIGISIGN_SUCCESS)
+    {
+        printf("Failed to sign the batch\r\n");
+        printf("Status: %d\r\n", status);
+        appData.testsFailed++;
+        return;
+    }
+
+    batchSig[APP_BATCH_BAD_ITEM][1] ^= 0x01U;
+    expectedBitmap &= ~((uint32_t)1U << APP_BATCH_BAD_ITEM);
+
+    /* Reference, one Verify call per signature */
+    for (i = 0; (i < APP_BATCH_SIZE) && (status == CRYPTO_DIGISIGN_SUCCESS); i++)
+    {
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        status = Crypto_DigiSign_Ecdsa_Verify(ecdsa->handler, batchHash[i], 
+            sizeof(batchHash[i]), batchSig[i], ecdsa->sigSize, pubKey, 
+            pubKeySize, &verifyStat, ecdsa->curveType, SESSION_ID);
+        singleCount += (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+
+        if ((status == CRYPTO_DIGISIGN_SUCCESS) && (verifyStat == 1))
+        {
+            bitmap |= ((uint32_t)1U << i);
+        }
+    }
+
+    if ((status != CRYPTO_DIGISIGN_SUCCESS) || (bitmap != expectedBitmap))
+    {
+        printf("Single verification mismatch, bitmap: 0x%02x\r\n", (unsigned int)bitmap);
+        printf("Status: %d\r\n", status);
+        appData.testsFailed++;
+        return;
+    }
+
+    appData.prevCounterVal = SYS_TIME_Counter64Get();
+    status = Crypto_DigiSign_Ecdsa_VerifyBatch(ecdsa->handler, items, 
+        APP_BATCH_SIZE, &bitmap, ecdsa->curveType, SESSION_ID);
+    diffCount = (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+
+    if (status != CRYPTO_DIGISIGN_SUCCESS)
+    {
+        printf("Failed to verify the batch\r\n");
+        printf("Status: %d\r\n", status);
+        appData.testsFailed++;
+    }
+    else if (bitmap != expectedBitmap)
+    {
+        printf("Wrong batch result, bitmap: 0x%02x\r\n", (unsigned int)bitmap);
+        appData.testsFailed++;
+    }
+    else
+    {
+        printf("Single verify per signature (us): %d\r\n", 
+            (int)SYS_TIME_CountToUS(singleCount / APP_BATCH_SIZE));
+        printf("Batch verify per signature (us): %d\r\n", 
+            (int)SYS_TIME_CountToUS(diffCount / APP_BATCH_SIZE));
+        printf("Test successful\r\n");
+        appData.testsPassed++;
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void ECDSA_Compressed_Test(ECDSA *ecdsa, uint8_t *pubKey, size_t pubKeySize)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDSA_Compressed_Test(ECDSA *ecdsa, uint8_t *pubKey, size_t pubKeySize)
+{
+    static uint8_t compKey[CRYPTO_ECC_MAX_KEY_LENGTH + 1U];
+    crypto_DigiSign_Status_E status;
+    int8_t verifyStat = 0;
+    int8_t wrongParityStat = 0;
+    uint64_t uncompCount = 0;
+    size_t coordSize = (pubKeySize - 1U) / 2U;
+
+    status = Crypto_DigiSign_Ecc_KeyGen(ecdsa->handler, ecdsa->key, 
+        ecdsa->keySize, pubKey, pubKeySize, ecdsa->curveType, SESSION_ID);
+
+    if (status == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        status = Crypto_DigiSign_Ecdsa_Sign(ecdsa->handler, ecdsa->inputHash,
+            ecdsa->inputHashSize, ecdsa->sig, ecdsa->sigSize, ecdsa->key,
+            ecdsa->keySize, ecdsa->curveType, SESSION_ID);
+    }
+
+    (void) memset(ecdsa->key, 0, ecdsa->keySize);
+
+    /* 0x02 for an even Y, 0x03 for an odd one, followed by X */
+    compKey[0] = (uint8_t)(0x02U | (pubKey[pubKeySize - 1U] & 0x01U));
+    (void) memcpy(&compKey[1], &pubKey[1], coordSize);
+
+    if (status == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        status = Crypto_DigiSign_Ecdsa_Verify(ecdsa->handler, ecdsa->inputHash,
+            ecdsa->inputHashSize, ecdsa->sig, ecdsa->sigSize, pubKey, 
+            pubKeySize, &verifyStat, ecdsa->curveType, SESSION_ID);
+        uncompCount = (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+    }
+
+    if ((status == CRYPTO_DIGISIGN_SUCCESS) && (verifyStat == 1))
+    {
+        verifyStat = 0;
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        status = Crypto_DigiSign_Ecdsa_Verify(ecdsa->handler, ecdsa->inputHash,
+            ecdsa->inputHashSize, ecdsa->sig, ecdsa->sigSize, compKey, 
+            coordSize + 1U, &verifyStat, ecdsa->curveType, SESSION_ID);
+        diffCount = (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+    }
+
+    if ((status == CRYPTO_DIGISIGN_SUCCESS) && (verifyStat == 1))
+    {
+        /* The other root of the curve equation is -Q, the signature must fail */
+        compKey[0] ^= 0x01U;
+        (void) Crypto_DigiSign_Ecdsa_Verify(ecdsa->handler, ecdsa->inputHash,
+            ecdsa->inputHashSize, ecdsa->sig, ecdsa->sigSize, compKey, 
+            coordSize + 1U, &wrongParityStat, ecdsa->curveType, SESSION_ID);
+    }
+
+    if (status != CRYPTO_DIGISIGN_SUCCESS)
+    {
+        printf("Failed to generate, sign or verify\r\n");
+        printf("Status: %d\r\n", status);
+        appData.testsFailed++;
+    }
+    else if (verifyStat != 1)
+    {
+        printf("Signature rejected\r\n");
+        appData.testsFailed++;
+    }
+    else if (wrongParityStat == 1)
+    {
+        printf("Signature accepted with the wrong Y parity\r\n");
+        appData.testsFailed++;
+    }
+    else
+    {
+        printf("Verify with uncompressed key, %d bytes (us): %d\r\n", 
+            (int)pubKeySize, (int)SYS_TIME_CountToUS(uncompCount));
+        printf("Verify with compressed key, %d bytes (us): %d\r\n", 
+            (int)(coordSize + 1U), (int)SYS_TIME_CountToUS(diffCount));
+        printf("Test successful\r\n");
+        appData.testsPassed++;
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void ECDSA_Binary_Test(ECDSA *ecdsa, uint8_t *katPubKey, uint8_t *katSig,
+        uint8_t *pubKey, size_t pubKeySize)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDSA_Binary_Test(ECDSA *ecdsa, uint8_t *katPubKey, uint8_t *katSig,
+    uint8_t *pubKey, size_t pubKeySize)
+{
+    crypto_DigiSign_Status_E status;
+    int8_t katVerifyStat = 0;
+    int8_t verifyStat = 0;
+    int8_t tamperedStat = 1;
+    uint64_t signCount = 0;
+
+    status = Crypto_DigiSign_Ecdsa_Verify(ecdsa->handler, ecdsa->inputHash,
+        ecdsa->inputHashSize, katSig, ecdsa->sigSize, katPubKey, pubKeySize,
+        &katVerifyStat, ecdsa->curveType, SESSION_ID);
+
+    if (status == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        status = Crypto_DigiSign_Ecc_KeyGen(ecdsa->handler, ecdsa->key, 
+            ecdsa->keySize, pubKey, pubKeySize, ecdsa->curveType, SESSION_ID);
+    }
+
+    if (status == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        status = Crypto_DigiSign_Ecdsa_Sign(ecdsa->handler, ecdsa->inputHash,
+            ecdsa->inputHashSize, ecdsa->sig, ecdsa->sigSize, ecdsa->key,
+            ecdsa->keySize, ecdsa->curveType, SESSION_ID);
+        signCount = (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+    }
+
+    (void) memset(ecdsa->key, 0, ecdsa->keySize);
+
+    if (status == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        status = Crypto_DigiSign_Ecdsa_Verify(ecdsa->handler, ecdsa->inputHash,
+            ecdsa->inputHashSize, ecdsa->sig, ecdsa->sigSize, pubKey, 
+            pubKeySize, &verifyStat, ecdsa->curveType, SESSION_ID);
+        diffCount = (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+    }
+
+    if ((status == CRYPTO_DIGISIGN_SUCCESS) && (verifyStat == 1))
+    {
+        /* A flipped bit inside the truncated hash must be caught */
+        ecdsa->inputHash[0] ^= 0x01U;
+        (void) Crypto_DigiSign_Ecdsa_Verify(ecdsa->handler, ecdsa->inputHash,
+            ecdsa->inputHashSize, ecdsa->sig, ecdsa->sigSize, pubKey, 
+            pubKeySize, &tamperedStat, ecdsa->curveType, SESSION_ID);
+        ecdsa->inputHash[0] ^= 0x01U;
+    }
+
+    if (status != CRYPTO_DIGISIGN_SUCCESS)
+    {
+        printf("Failed to generate, sign or verify\r\n");
+        printf("Status: %d\r\n", status);
+        appData.testsFailed++;
+    }
+    else if (katVerifyStat != 1)
+    {
+        printf("Known answer signature rejected\r\n");
+        appData.testsFailed++;
+    }
+    else if (verifyStat != 1)
+    {
+        printf("Signature with the generated key rejected\r\n");
+        appData.testsFailed++;
+    }
+    else if (tamperedStat == 1)
+    {
+        printf("Signature accepted with a modified hash\r\n");
+        appData.testsFailed++;
+    }
+    else
+    {
+        printf("Sign (us): %d\r\n", (int)SYS_TIME_CountToUS(signCount));
+        printf("Verify (us): %d\r\n", (int)SYS_TIME_CountToUS(diffCount));
+        printf("Test successful\r\n");
+        appData.testsPassed++;
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void ECDSA_Custom_Test(ECDSA *ecdsa, const CPKCL_ECC_CURVE_DESC *curve, 
+        crypto_EccCurveType_E builtInCurve, uint8_t *pubKey, size_t pubKeySize)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDSA_Custom_Test(ECDSA *ecdsa, const CPKCL_ECC_CURVE_DESC *curve, 
+    crypto_EccCurveType_E builtInCurve, uint8_t *pubKey, size_t pubKeySize)
+{
+    crypto_DigiSign_Status_E status;
+    int8_t verifyStat = 0;
+    uint64_t builtInCount = 0;
+
+    if (DRV_CRYPTO_ECC_SetCustomCurve(curve) != CRYPTO_CPKCL_RESULT_CURVE_SUCCESS)
+    {
+        printf("Custom curve rejected\r\n");
+        appData.testsFailed++;
+        return;
+    }
+
+    status = Crypto_DigiSign_Ecc_KeyGen(ecdsa->handler, ecdsa->key, 
+        ecdsa->keySize, pubKey, pubKeySize, ecdsa->curveType, SESSION_ID);
+
+    if (status == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        status = Crypto_DigiSign_Ecdsa_Sign(ecdsa->handler, ecdsa->inputHash,
+            ecdsa->inputHashSize, ecdsa->sig, ecdsa->sigSize, ecdsa->key,
+            ecdsa->keySize, builtInCurve, SESSION_ID);
+        builtInCount = (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+    }
+
+    if (status == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        status = Crypto_DigiSign_Ecdsa_Sign(ecdsa->handler, ecdsa->inputHash,
+            ecdsa->inputHashSize, ecdsa->sig, ecdsa->sigSize, ecdsa->key,
+            ecdsa->keySize, ecdsa->curveType, SESSION_ID);
+        diffCount = (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+    }
+
+    (void) memset(ecdsa->key, 0, ecdsa->keySize);
+    (void) DRV_CRYPTO_ECC_SetCustomCurve(NULL);
+
+    /* wolfCrypt only knows the built-in curve */
+    if (status == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        status = Crypto_DigiSign_Ecdsa_Verify(CRYPTO_HANDLER_SW_WOLFCRYPT, 
+            ecdsa->inputHash, ecdsa->inputHashSize, ecdsa->sig, ecdsa->sigSize,
+            pubKey, pubKeySize, &verifyStat, builtInCurve, SESSION_ID);
+    }
+
+    if (status != CRYPTO_DIGISIGN_SUCCESS)
+    {
+        printf("Failed to generate, sign or verify\r\n");
+        printf("Status: %d\r\n", status);
+        appData.testsFailed++;
+    }
+    else if (verifyStat != 1)
+    {
+        printf("Signature on the custom curve rejected\r\n");
+        appData.testsFailed++;
+    }
+    else
+    {
+        printf("Sign on the built-in curve (us): %d\r\n", 
+            (int)SYS_TIME_CountToUS(builtInCount));
+        printf("Sign on the custom curve (us): %d\r\n", 
+            (int)SYS_TIME_CountToUS(diffCount));
+        printf("Test successful\r\n");
+        appData.testsPassed++;
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void RSA_Test(st_Crypto_Rsa_PrivKey *privKey, uint8_t *hash, 
+        size_t hashSize, uint8_t *data, size_t dataSize)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void RSA_Test(st_Crypto_Rsa_PrivKey *privKey, uint8_t *hash, 
+    size_t hashSize, uint8_t *data, size_t dataSize)
+{
+    static const crypto_HandlerType_E handlers[2] = {
+        CRYPTO_HANDLER_HW_INTERNAL, CRYPTO_HANDLER_SW_WOLFCRYPT };
+    static const char *operations[APP_RSA_OPERATIONS] = {
+        "PKCS#1 v1.5 sign", "PKCS#1 v1.5 verify", "PSS sign", "PSS verify",
+        "OAEP encrypt", "OAEP decrypt" };
+    st_Crypto_Rsa_PubKey pubKey = {
+        .ptr_n = privKey->ptr_n,
+        .modulusLen = privKey->modulusLen,
+        .ptr_e = privKey->ptr_e,
+        .eLen = privKey->eLen
+    };
+    uint32_t sigLen = privKey->modulusLen;
+    uint64_t counts[2][APP_RSA_OPERATIONS];
+    crypto_Rsa_Status_E status = CRYPTO_RSA_SUCCESS;
+    int8_t verifyStat = 1;
+    uint32_t msgLen = 0;
+    bool plainMatch = true;
+    size_t i;
+    size_t other;
+
+    /* Private key operations and the checks that stay on one handler */
+    for (i = 0; (i < 2U) && (status == CRYPTO_RSA_SUCCESS) && (verifyStat == 1); i++)
+    {
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        status = Crypto_Rsa_Pkcs1v15_Sign(handlers[i], hash, hashSize, 
+            CRYPTO_HASH_SHA2_256, rsaPkcs1Sig[i], sigLen, privKey, SESSION_ID);
+        counts[i][APP_RSA_PKCS1_SIGN] = SYS_TIME_Counter64Get() - appData.prevCounterVal;
+
+        if (status == CRYPTO_RSA_SUCCESS)
+        {
+            appData.prevCounterVal = SYS_TIME_Counter64Get();
+            status = Crypto_Rsa_Pkcs1v15_Verify(handlers[i], hash, hashSize, 
+                CRYPTO_HASH_SHA2_256, rsaPkcs1Sig[i], sigLen, &pubKey, 
+                &verifyStat, SESSION_ID);
+            counts[i][APP_RSA_PKCS1_VERIFY] = SYS_TIME_Counter64Get() - appData.prevCounterVal;
+        }
+
+        if ((status == CRYPTO_RSA_SUCCESS) && (verifyStat == 1))
+        {
+            appData.prevCounterVal = SYS_TIME_Counter64Get();
+            status = Crypto_Rsa_Pss_Sign(handlers[i], hash, hashSize, 
+                CRYPTO_HASH_SHA2_256, hashSize, rsaPssSig[i], sigLen, privKey, 
+                SESSION_ID);
+            counts[i][APP_RSA_PSS_SIGN] = SYS_TIME_Counter64Get() - appData.prevCounterVal;
+        }
+
+        if ((status == CRYPTO_RSA_SUCCESS) && (verifyStat == 1))
+        {
+            appData.prevCounterVal = SYS_TIME_Counter64Get();
+            status = Crypto_Rsa_Oaep_Encrypt(handlers[i], data, dataSize, 
+                CRYPTO_HASH_SHA2_256, NULL, 0U, rsaCipher[i], sigLen, &pubKey, 
+                SESSION_ID);
+            counts[i][APP_RSA_OAEP_ENCRYPT] = SYS_TIME_Counter64Get() - appData.prevCounterVal;
+        }
+    }
+
+    /* Each handler checks the PSS signature and decrypts the ciphertext of 
+       the other one */
+    for (i = 0; (i < 2U) && (status == CRYPTO_RSA_SUCCESS) && (verifyStat == 1) && plainMatch; i++)
+    {
+        other = 1U - i;
+
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        status = Crypto_Rsa_Pss_Verify(handlers[i], hash, hashSize, 
+            CRYPTO_HASH_SHA2_256, hashSize, rsaPssSig[other], sigLen, &pubKey, 
+            &verifyStat, SESSION_ID);
+        counts[i][APP_RSA_PSS_VERIFY] = SYS_TIME_Counter64Get() - appData.prevCounterVal;
+
+        if ((status == CRYPTO_RSA_SUCCESS) && (verifyStat == 1))
+        {
+            appData.prevCounterVal = SYS_TIME_Counter64Get();
+            status = Crypto_Rsa_Oaep_Decrypt(handlers[i], rsaCipher[other], 
+                sigLen, CRYPTO_HASH_SHA2_256, NULL, 0U, rsaPlain, 
+                sizeof(rsaPlain), &msgLen, privKey, SESSION_ID);
+            counts[i][APP_RSA_OAEP_DECRYPT] = SYS_TIME_Counter64Get() - appData.prevCounterVal;
+
+            plainMatch = (status == CRYPTO_RSA_SUCCESS) && (msgLen == dataSize) && 
+                CompareHexArray(rsaPlain, data, dataSize);
+        }
+    }
+
+    if (status != CRYPTO_RSA_SUCCESS)
+    {
+        printf("Failed to sign, verify, encrypt or decrypt\r\n");
+        printf("Status: %d\r\n", status);
+        appData.testsFailed++;
+    }
+    else if (verifyStat != 1)
+    {
+        printf("Signature rejected\r\n");
+        appData.testsFailed++;
+    }
+    else if (!plainMatch)
+    {
+        printf("Decrypted message does not match\r\n");
+        appData.testsFailed++;
+    }
+    else if (!CompareHexArray(rsaPkcs1Sig[0], rsaPkcs1Sig[1], sigLen))
+    {
+        printf("PKCS#1 v1.5 signatures differ between handlers\r\n");
+        appData.testsFailed++;
+    }
+    else
+    {
+        printf("Operation (us): HW / wolfCrypt\r\n");
+        for (i = 0; i < APP_RSA_OPERATIONS; i++)
+        {
+            printf("%s: %d / %d\r\n", operations[i], 
+                (int)SYS_TIME_CountToUS(counts[0][i]), 
+                (int)SYS_TIME_CountToUS(counts[1][i]));
+        }
+        printf("Test successful\r\n");
+        appData.testsPassed++;
+    }
+}
+
+/* Runs one of the sp_int operations of SP_Offload_Test into r */
+static int lSP_Offload_Run(size_t operation, mp_int *r)
+{
+    int ret;
+
+    switch (operation)
+    {
+        case APP_SP_MULMOD:
+            ret = mp_mulmod(&spA, &spB, &spN, r);
+            break;
+        case APP_SP_MOD:
+            ret = mp_mod(&spProduct, &spN, r);
+            break;
+        case APP_SP_EXPTMOD:
+            ret = mp_exptmod(&spB, &spA, &spN, r);
+            break;
+        case APP_SP_EXPTMOD_NCT:
+            ret = mp_exptmod_nct(&spB, &spE, &spN, r);
+            break;
+        default:
+            ret = mp_invmod(&spA, &spN, r);
+            break;
+    }
+
+    return ret;
+}
+
+/*******************************************************************************
+  Function:
+    void SP_Offload_Test(uint8_t *n, uint8_t *a, size_t nSize, uint8_t *b, 
+        size_t bSize, uint8_t *e, size_t eSize)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void SP_Offload_Test(uint8_t *n, uint8_t *a, size_t nSize, uint8_t *b, 
+    size_t bSize, uint8_t *e, size_t eSize)
+{
+    static const char *operations[APP_SP_OPERATIONS] = {
+        "mulmod", "mod", "exptmod", "exptmod_nct", "invmod" };
+    static const int minBits[2] = { INT_MAX, WOLFSSL_SP_CPKCC_MIN_BITS };
+    uint64_t counts[2][APP_SP_OPERATIONS];
+    bool match = true;
+    int ret;
+    size_t op;
+    size_t i;
+
+    ret = mp_init_multi(&spN, &spA, &spB, &spE, &spProduct, NULL);
+    if (ret == MP_OKAY)
+    {
+        ret = mp_init_multi(&spResult[0], &spResult[1], NULL, NULL, NULL, NULL);
+    }
+    if (ret == MP_OKAY)
+    {
+        ret = mp_read_unsigned_bin(&spN, n, (word32)nSize);
+    }
+    if (ret == MP_OKAY)
+    {
+        ret = mp_read_unsigned_bin(&spA, a, (word32)nSize);
+    }
+    if (ret == MP_OKAY)
+    {
+        ret = mp_read_unsigned_bin(&spB, b, (word32)bSize);
+    }
+    if (ret == MP_OKAY)
+    {
+        ret = mp_read_unsigned_bin(&spE, e, (word32)eSize);
+    }
+    if (ret == MP_OKAY)
+    {
+        ret = mp_mul(&spA, &spB, &spProduct);
+    }
+
+    /* Software first as the reference, then the CPKCC */
+    for (op = 0; (op < APP_SP_OPERATIONS) && (ret == MP_OKAY) && match; op++)
+    {
+        for (i = 0; (i < 2U) && (ret == MP_OKAY); i++)
+        {
+            cpkcc_sp_set_min_bits(minBits[i]);
+
+            appData.prevCounterVal = SYS_TIME_Counter64Get();
+            ret = lSP_Offload_Run(op, &spResult[i]);
+            counts[i][op] = SYS_TIME_Counter64Get() - appData.prevCounterVal;
+        }
+
+        match = (ret == MP_OKAY) && (mp_cmp(&spResult[0], &spResult[1]) == MP_EQ);
+    }
+
+    cpkcc_sp_set_min_bits(WOLFSSL_SP_CPKCC_MIN_BITS);
+
+    if (ret != MP_OKAY)
+    {
+        printf("sp_int operation failed\r\n");
+        printf("Status: %d\r\n", ret);
+        appData.testsFailed++;
+    }
+    else if (!match)
+    {
+        printf("%s result differs from software\r\n", operations[op - 1U]);
+        appData.testsFailed++;
+    }
+    else
+    {
+        printf("Operation (us): wolfCrypt / CPKCC\r\n");
+        for (op = 0; op < APP_SP_OPERATIONS; op++)
+        {
+            printf("%s: %d / %d\r\n", operations[op], 
+                (int)SYS_TIME_CountToUS(counts[0][op]), 
+                (int)SYS_TIME_CountToUS(counts[1][op]));
+        }
+        printf("Test successful\r\n");
+        appData.testsPassed++;
+    }
+
+    /* a is a private exponent */
+    mp_forcezero(&spA);
+    mp_clear(&spResult[0]);
+    mp_clear(&spResult[1]);
+}
+
+/*******************************************************************************
+  Function:
+    void CryptoCb_Test(uint8_t *privKey, uint8_t *pubKey, size_t keySize, 
+        crypto_EccCurveType_E curveType, uint8_t *data, size_t dataSize)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void CryptoCb_Test(uint8_t *privKey, uint8_t *pubKey, size_t keySize, 
+    crypto_EccCurveType_E curveType, uint8_t *data, size_t dataSize)
+{
+    static const char *operations[APP_CB_OPERATIONS] = {
+        "SHA-256", "sign", "verify" };
+    uint8_t digest[2][WC_SHA256_DIGEST_SIZE];
+    uint8_t streamDigest[2][WC_SHA256_DIGEST_SIZE];
+    uint64_t counts[2][APP_CB_OPERATIONS];
+    uint8_t nonce[WC_SHA256_DIGEST_SIZE];
+    word32 sigSize = 0;
+    word32 sigKSize[2] = { 0, 0 };
+    int verifyStat[3] = { 0, 0, 0 };
+    uint32_t hwCount = 0;
+    uint32_t swCount = 0;
+    uint32_t busySwCount = 0;
+    bool registered = false;
+    bool keyInit = false;
+    int devId;
+    int ret;
+    size_t i;
+
+    ret = wc_InitRng(&cbRng);
+
+    /* Software first as the reference, then through the callback: only the 
+       objects set up with its device ID reach the engines */
+    for (i = 0; (i < 2U) && (ret == 0); i++)
+    {
+        devId = (i == 0U) ? INVALID_DEVID : CRYPTO_CRYPTOCB_WC_DEVID;
+        if (i == 1U)
+        {
+            wc_ecc_free(&cbEccKey);
+            keyInit = false;
+            ret = Crypto_CryptoCb_Wc_Init();
+            registered = (ret == 0);
+        }
+        if (ret == 0)
+        {
+            ret = wc_ecc_init_ex(&cbEccKey, NULL, devId);
+            keyInit = (ret == 0);
+        }
+        if (ret == 0)
+        {
+            ret = wc_ecc_import_unsigned(&cbEccKey, &pubKey[1], 
+                &pubKey[1U + keySize], privKey, 
+                Crypto_Common_Wc_Ecc_GetWcCurveId(curveType));
+        }
+
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        if (ret == 0)
+        {
+            ret = wc_InitSha256_ex(&cbSha[0], NULL, devId);
+        }
+        if (ret == 0)
+        {
+            ret = wc_Sha256Update(&cbSha[0], data, (word32)dataSize);
+        }
+        if (ret == 0)
+        {
+            ret = wc_Sha256Final(&cbSha[0], digest[i]);
+        }
+        counts[i][APP_CB_SHA256] = SYS_TIME_Counter64Get() - appData.prevCounterVal;
+
+        if (ret == 0)
+        {
+            sigSize = sizeof(cbSig);
+            appData.prevCounterVal = SYS_TIME_Counter64Get();
+            ret = wc_ecc_sign_hash(digest[i], WC_SHA256_DIGEST_SIZE, cbSig, 
+                &sigSize, &cbRng, &cbEccKey);
+            counts[i][APP_CB_SIGN] = SYS_TIME_Counter64Get() - appData.prevCounterVal;
+        }
+
+        if (ret == 0)
+        {
+            appData.prevCounterVal = SYS_TIME_Counter64Get();
+            ret = wc_ecc_verify_hash(cbSig, sigSize, digest[i], 
+                WC_SHA256_DIGEST_SIZE, &verifyStat[i], &cbEccKey);
+            counts[i][APP_CB_VERIFY] = SYS_TIME_Counter64Get() - appData.prevCounterVal;
+        }
+    }
+
+    /* A second stream started while the first holds the SHA engine is hashed 
+       in software */
+    if (ret == 0)
+    {
+        ret = wc_InitSha256_ex(&cbSha[0], NULL, CRYPTO_CRYPTOCB_WC_DEVID);
+    }
+    if (ret == 0)
+    {
+        ret = wc_Sha256Update(&cbSha[0], data, (word32)(dataSize / 2U));
+    }
+    if (ret == 0)
+    {
+        ret = wc_InitSha256_ex(&cbSha[1], NULL, CRYPTO_CRYPTOCB_WC_DEVID);
+    }
+    if (ret == 0)
+    {
+        ret = wc_Sha256Update(&cbSha[1], data, (word32)dataSize);
+    }
+    if (ret == 0)
+    {
+        ret = wc_Sha256Final(&cbSha[1], streamDigest[1]);
+    }
+    if (ret == 0)
+    {
+        ret = wc_Sha256Update(&cbSha[0], &data[dataSize / 2U], 
+            (word32)(dataSize - (dataSize / 2U)));
+    }
+    if (ret == 0)
+    {
+        ret = wc_Sha256Final(&cbSha[0], streamDigest[0]);
+    }
+
+    /* CPKCC busy, the verification runs in software */
+    if (ret == 0)
+    {
+        Crypto_CryptoCb_Wc_GetCounts(&hwCount, &busySwCount);
+        if (Crypto_CryptoCb_Wc_EngineClaim(CRYPTO_CRYPTOCB_ENGINE_CPKCC))
+        {
+            ret = wc_ecc_verify_hash(cbSig, sigSize, digest[1], 
+                WC_SHA256_DIGEST_SIZE, &verifyStat[2], &cbEccKey);
+            Crypto_CryptoCb_Wc_EngineRelease(CRYPTO_CRYPTOCB_ENGINE_CPKCC);
+        }
+        Crypto_CryptoCb_Wc_GetCounts(&hwCount, &swCount);
+        busySwCount = swCount - busySwCount;
+    }
+
+    /* A nonce set on the key is signed in software: the same nonce gives the 
+       same signature twice */
+    if (ret == 0)
+    {
+        (void) memcpy(nonce, digest[1], sizeof(nonce));
+        nonce[0] = 0U;
+    }
+    for (i = 0; (i < 2U) && (ret == 0); i++)
+    {
+        ret = wc_ecc_sign_set_k(nonce, (word32)sizeof(nonce), &cbEccKey);
+        if (ret == 0)
+        {
+            sigKSize[i] = (word32)sizeof(cbSigK[i]);
+            ret = wc_ecc_sign_hash(digest[1], WC_SHA256_DIGEST_SIZE, 
+                cbSigK[i], &sigKSize[i], &cbRng, &cbEccKey);
+        }
+    }
+
+    if (registered)
+    {
+        Crypto_CryptoCb_Wc_Deinit();
+    }
+
+    if (ret != 0)
+    {
+        printf("wolfCrypt operation failed\r\n");
+        printf("Status: %d\r\n", ret);
+        appData.testsFailed++;
+    }
+    else if ((!CompareHexArray(digest[0], digest[1], WC_SHA256_DIGEST_SIZE)) ||
+        (!CompareHexArray(digest[0], streamDigest[0], WC_SHA256_DIGEST_SIZE)) ||
+        (!CompareHexArray(digest[0], streamDigest[1], WC_SHA256_DIGEST_SIZE)))
+    {
+        printf("SHA-256 digest differs from software\r\n");
+        appData.testsFailed++;
+    }
+    else if ((verifyStat[0] != 1) || (verifyStat[1] != 1) || (verifyStat[2] != 1))
+    {
+        printf("Signature rejected, wolfCrypt: %d, callback: %d, busy: %d\r\n", 
+            verifyStat[0], verifyStat[1], verifyStat[2]);
+        appData.testsFailed++;
+    }
+    else if ((sigKSize[0] != sigKSize[1]) || 
+        (!CompareHexArray(cbSigK[0], cbSigK[1], sigKSize[0])))
+    {
+        printf("Signature with a set nonce differs\r\n");
+        appData.testsFailed++;
+    }
+    else if ((hwCount == 0U) || (busySwCount == 0U))
+    {
+        printf("Callbacks on the engines: %d, left to software: %d\r\n", 
+            (int)hwCount, (int)swCount);
+        appData.testsFailed++;
+    }
+    else
+    {
+        printf("Operation (us): wolfCrypt / callback\r\n");
+        for (i = 0; i < APP_CB_OPERATIONS; i++)
+        {
+            printf("%s: %d / %d\r\n", operations[i], 
+                (int)SYS_TIME_CountToUS(counts[0][i]), 
+                (int)SYS_TIME_CountToUS(counts[1][i]));
+        }
+        printf("Callbacks on the engines: %d, left to software: %d\r\n", 
+            (int)hwCount, (int)swCount);
+        printf("Test successful\r\n");
+        appData.testsPassed++;
+    }
+
+    if (keyInit)
+    {
+        wc_ecc_free(&cbEccKey);
+    }
+    (void) wc_FreeRng(&cbRng);
+}
+
+/*******************************************************************************
+  Function:
+    void KeyHandle_Test(crypto_HandlerType_E handler, uint8_t *privKey, 
+        uint8_t *pubKey, size_t keySize, crypto_EccCurveType_E curveType,
+        uint8_t *hash, size_t hashSize)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void KeyHandle_Test(crypto_HandlerType_E handler, uint8_t *privKey, 
+    uint8_t *pubKey, size_t keySize, crypto_EccCurveType_E curveType,
+    uint8_t *hash, size_t hashSize)
+{
+    static uint8_t compKey[CRYPTO_ECC_MAX_KEY_LENGTH + 1U];
+    static uint8_t handleSig[2 * CRYPTO_ECC_MAX_KEY_LENGTH];
+    static uint8_t callSig[2 * CRYPTO_ECC_MAX_KEY_LENGTH];
+    crypto_Key_Status_E keyStatus;
+    crypto_DigiSign_Status_E status = CRYPTO_DIGISIGN_SUCCESS;
+    crypto_Key_Handle_T handle = CRYPTO_KEY_HANDLE_INVALID;
+    int8_t verifyStat[2] = {0, 0};
+    uint64_t importCount;
+    uint64_t callCount[2] = {0, 0};
+    uint64_t handleCount[2] = {0, 0};
+    uint32_t i;
+
+    /* 0x02 for an even Y, 0x03 for an odd one, followed by X */
+    compKey[0] = (uint8_t)(0x02U | (pubKey[2U * keySize] & 0x01U));
+    (void) memcpy(&compKey[1], &pubKey[1], keySize);
+
+    /* Key passed on every call */
+    for (i = 0; (i < APP_KEY_HANDLE_ROUNDS) && (status == CRYPTO_DIGISIGN_SUCCESS); i++)
+    {
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        status = Crypto_DigiSign_Ecdsa_Sign(handler, hash, hashSize, callSig,
+            2U * keySize, privKey, keySize, curveType, SESSION_ID);
+        callCount[0] += (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+
+        if (status == CRYPTO_DIGISIGN_SUCCESS)
+        {
+            appData.prevCounterVal = SYS_TIME_Counter64Get();
+            status = Crypto_DigiSign_Ecdsa_Verify(handler, hash, hashSize, 
+                callSig, 2U * keySize, compKey, keySize + 1U, &verifyStat[0],
+                curveType, SESSION_ID);
+            callCount[1] += (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+        }
+    }
+
+    /* Key imported once, the public key compressed */
+    appData.prevCounterVal = SYS_TIME_Counter64Get();
+    keyStatus = Crypto_Key_Import(handler, privKey, keySize, compKey, 
+        keySize + 1U, curveType, &handle);
+    importCount = (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+
+    if (keyStatus != CRYPTO_KEY_SUCCESS)
+    {
+        status = CRYPTO_DIGISIGN_ERROR_FAIL;
+    }
+
+    for (i = 0; (i < APP_KEY_HANDLE_ROUNDS) && (status == CRYPTO_DIGISIGN_SUCCESS); i++)
+    {
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        status = Crypto_DigiSign_Ecdsa_SignWithKey(handle, hash, hashSize, 
+            handleSig, 2U * keySize, SESSION_ID);
+        handleCount[0] += (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+
+        if (status == CRYPTO_DIGISIGN_SUCCESS)
+        {
+            appData.prevCounterVal = SYS_TIME_Counter64Get();
+            status = Crypto_DigiSign_Ecdsa_VerifyWithKey(handle, hash, hashSize, 
+                callSig, 2U * keySize, &verifyStat[1], SESSION_ID);
+            handleCount[1] += (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+        }
+    }
+
+    /* The signature made with the handle must pass the per call verification */
+    if (status == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        status = Crypto_DigiSign_Ecdsa_Verify(handler, hash, hashSize, 
+            handleSig, 2U * keySize, pubKey, (2U * keySize) + 1U, 
+            &verifyStat[0], curveType, SESSION_ID);
+    }
+
+    keyStatus = Crypto_Key_Destroy(handle);
+
+    if (status != CRYPTO_DIGISIGN_SUCCESS)
+    {
+        printf("Failed to import, sign or verify\r\n");
+        printf("Status: %d\r\n", status);
+        appData.testsFailed++;
+    }
+    else if ((verifyStat[0] != 1) || (verifyStat[1] != 1))
+    {
+        printf("Signature rejected, per call: %d, handle: %d\r\n", 
+            verifyStat[0], verifyStat[1]);
+        appData.testsFailed++;
+    }
+    else if ((keyStatus != CRYPTO_KEY_SUCCESS) || 
+        (Crypto_DigiSign_Ecdsa_SignWithKey(handle, hash, hashSize, handleSig, 
+            2U * keySize, SESSION_ID) != CRYPTO_DIGISIGN_ERROR_PRIVKEY))
+    {
+        printf("Handle still usable after destroy\r\n");
+        appData.testsFailed++;
+    }
+    else
+    {
+        printf("Import (us): %d\r\n", (int)SYS_TIME_CountToUS(importCount));
+        printf("Operation (us): per call / handle\r\n");
+        printf("Sign: %d / %d\r\n", 
+            (int)SYS_TIME_CountToUS(callCount[0] / APP_KEY_HANDLE_ROUNDS), 
+            (int)SYS_TIME_CountToUS(handleCount[0] / APP_KEY_HANDLE_ROUNDS));
+        printf("Verify: %d / %d\r\n", 
+            (int)SYS_TIME_CountToUS(callCount[1] / APP_KEY_HANDLE_ROUNDS), 
+            (int)SYS_TIME_CountToUS(handleCount[1] / APP_KEY_HANDLE_ROUNDS));
+        printf("Test successful\r\n");
+        appData.testsPassed++;
+    }
+}
+
+/* r = a + b on size bytes, big endian, the carry out of the top byte lost */
+static void lApp_ScalarAdd(uint8_t *r, uint8_t *a, uint8_t *b, size_t size)
+{
+    uint32_t carry = 0U;
+    size_t i = size;
+
+    while (i > 0U)
+    {
+        i--;
+        carry += (uint32_t)a[i] + (uint32_t)b[i];
+        r[i] = (uint8_t)carry;
+        carry >>= 8U;
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void EccPoint_Test(uint8_t *privKey, uint8_t *pubKey, size_t keySize, 
+        crypto_EccCurveType_E curveType)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void EccPoint_Test(uint8_t *privKey, uint8_t *pubKey, size_t keySize, 
+    crypto_EccCurveType_E curveType)
+{
+    static uint8_t k1[CRYPTO_ECC_MAX_KEY_LENGTH];
+    static uint8_t k2[CRYPTO_ECC_MAX_KEY_LENGTH];
+    static uint8_t kSum[CRYPTO_ECC_MAX_KEY_LENGTH];
+    static uint8_t point2Q[(2 * CRYPTO_ECC_MAX_KEY_LENGTH) + 1];
+    static uint8_t dualPoint[(2 * CRYPTO_ECC_MAX_KEY_LENGTH) + 1];
+    static uint8_t refPoint[(2 * CRYPTO_ECC_MAX_KEY_LENGTH) + 1];
+    static uint8_t prodPoint[(2 * CRYPTO_ECC_MAX_KEY_LENGTH) + 1];
+    crypto_Ecc_Point_Status_E status;
+    size_t pointSize = (2U * keySize) + 1U;
+    uint64_t dualCount = 0;
+    uint64_t separateCount = 0;
+    uint32_t i;
+    bool match = true;
+
+    /* Full size scalars from the public key, below 2^(8*keySize - 2) so 
+       k1 + 2*k2 does not overflow */
+    (void) memcpy(k1, &pubKey[1], keySize);
+    (void) memcpy(k2, &pubKey[1U + keySize], keySize);
+    k1[0] &= 0x3FU;
+    k2[0] &= 0x3FU;
+
+    /* d*G must give the public key, Q + Q goes through the doubling */
+    status = Crypto_Ecc_Point_Mul(curveType, privKey, keySize, NULL, 0U, 
+        refPoint, pointSize);
+    if (status == CRYPTO_ECC_POINT_SUCCESS)
+    {
+        match = (memcmp(refPoint, pubKey, pointSize) == 0);
+        status = Crypto_Ecc_Point_Add(curveType, pubKey, pointSize, pubKey, 
+            pointSize, point2Q, pointSize);
+    }
+
+    /* k1*Q + k2*2Q = (k1 + 2*k2)*Q */
+    if ((status == CRYPTO_ECC_POINT_SUCCESS) && match)
+    {
+        status = Crypto_Ecc_Point_DualMul(curveType, k1, keySize, pubKey, 
+            pointSize, k2, keySize, point2Q, pointSize, dualPoint, pointSize);
+    }
+    if ((status == CRYPTO_ECC_POINT_SUCCESS) && match)
+    {
+        lApp_ScalarAdd(kSum, k2, k2, keySize);
+        lApp_ScalarAdd(kSum, kSum, k1, keySize);
+        status = Crypto_Ecc_Point_Mul(curveType, kSum, keySize, pubKey, 
+            pointSize, refPoint, pointSize);
+        match = (memcmp(dualPoint, refPoint, pointSize) == 0);
+    }
+
+    /* k1*Q + k2*Q = (k1 + k2)*Q, P1 = P2 takes the separate computation */
+    if ((status == CRYPTO_ECC_POINT_SUCCESS) && match)
+    {
+        status = Crypto_Ecc_Point_DualMul(curveType, k1, keySize, pubKey, 
+            pointSize, k2, keySize, pubKey, pointSize, dualPoint, pointSize);
+    }
+    if ((status == CRYPTO_ECC_POINT_SUCCESS) && match)
+    {
+        lApp_ScalarAdd(kSum, k1, k2, keySize);
+        status = Crypto_Ecc_Point_Mul(curveType, kSum, keySize, pubKey, 
+            pointSize, refPoint, pointSize);
+        match = (memcmp(dualPoint, refPoint, pointSize) == 0);
+    }
+
+    /* k1*G + k2*Q, as an ECDSA verification, against two multiplications 
+       and an addition */
+    for (i = 0; (i < APP_POINT_ROUNDS) && (status == CRYPTO_ECC_POINT_SUCCESS) 
+            && match; i++)
+    {
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        status = Crypto_Ecc_Point_DualMul(curveType, k1, keySize, NULL, 0U, 
+            k2, keySize, pubKey, pointSize, dualPoint, pointSize);
+        dualCount += (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+
+        if (status == CRYPTO_ECC_POINT_SUCCESS)
+        {
+            appData.prevCounterVal = SYS_TIME_Counter64Get();
+            status = Crypto_Ecc_Point_Mul(curveType, k1, keySize, NULL, 0U, 
+                refPoint, pointSize);
+            if (status == CRYPTO_ECC_POINT_SUCCESS)
+            {
+                status = Crypto_Ecc_Point_Mul(curveType, k2, keySize, pubKey, 
+                    pointSize, prodPoint, pointSize);
+            }
+            if (status == CRYPTO_ECC_POINT_SUCCESS)
+            {
+                status = Crypto_Ecc_Point_Add(curveType, refPoint, pointSize, 
+                    prodPoint, pointSize, refPoint, pointSize);
+            }
+            separateCount += (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+            match = (memcmp(dualPoint, refPoint, pointSize) == 0);
+        }
+
+        /* Next scalars */
+        k1[keySize - 1U]++;
+        k2[keySize - 1U]++;
+    }
+
+    if (status != CRYPTO_ECC_POINT_SUCCESS)
+    {
+        printf("Point operation failed\r\n");
+        printf("Status: %d\r\n", status);
+        appData.testsFailed++;
+    }
+    else if (!match)
+    {
+        printf("Points mismatch\r\n");
+        appData.testsFailed++;
+    }
+    else
+    {
+        printf("k1*G + k2*Q (us): dual / separate\r\n");
+        printf("%d / %d\r\n", 
+            (int)SYS_TIME_CountToUS(dualCount / APP_POINT_ROUNDS), 
+            (int)SYS_TIME_CountToUS(separateCount / APP_POINT_ROUNDS));
+        printf("Test successful\r\n");
+        appData.testsPassed++;
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void Comb_Test(crypto_EccCurveType_E curveType, CRYPTO_CPKCL_CURVE hwCurve,
+        size_t keySize, uint8_t *hash, size_t hashSize)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void Comb_Test(crypto_EccCurveType_E curveType, CRYPTO_CPKCL_CURVE hwCurve,
+    size_t keySize, uint8_t *hash, size_t hashSize)
+{
+    static uint8_t privKey[CRYPTO_ECC_MAX_KEY_LENGTH];
+    static uint8_t pubKey[(2 * CRYPTO_ECC_MAX_KEY_LENGTH) + 1];
+    static uint8_t refPoint[(2 * CRYPTO_ECC_MAX_KEY_LENGTH) + 1];
+    static uint8_t sig[2 * CRYPTO_ECC_MAX_KEY_LENGTH];
+    const CPKCL_ECC_COMB_TABLE *comb = DRV_CRYPTO_ECC_GetCombTable(hwCurve);
+    crypto_DigiSign_Status_E status = CRYPTO_DIGISIGN_SUCCESS;
+    crypto_Ecc_Point_Status_E pointStatus = CRYPTO_ECC_POINT_SUCCESS;
+    size_t pointSize = (2U * keySize) + 1U;
+    size_t sigSize = 2U * keySize;
+    uint64_t signCount[2] = {0, 0};
+    int8_t verifyStat = 1;
+    uint32_t pass;
+    uint32_t i;
+    bool match = true;
+
+    if (comb == NULL)
+    {
+        printf("No comb table for the curve\r\n");
+        appData.testsFailed++;
+        return;
+    }
+
+    /* Key pair from the comb, d*G again with the CPKCL multiplication */
+    status = Crypto_DigiSign_Ecc_KeyGen(CRYPTO_HANDLER_HW_INTERNAL, privKey, 
+        keySize, pubKey, pointSize, curveType, SESSION_ID);
+    if (status == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        DRV_CRYPTO_ECC_SetCombEnabled(false);
+        pointStatus = Crypto_Ecc_Point_Mul(curveType, privKey, keySize, NULL, 
+            0U, refPoint, pointSize);
+        DRV_CRYPTO_ECC_SetCombEnabled(true);
+        match = (memcmp(refPoint, pubKey, pointSize) == 0);
+    }
+
+    /* Signatures with the comb (pass 0) and with the CPKCL (pass 1), each 
+       verified on wolfCrypt */
+    for (pass = 0; pass < 2U; pass++)
+    {
+        DRV_CRYPTO_ECC_SetCombEnabled(pass == 0U);
+        for (i = 0; (i < APP_COMB_ROUNDS) && (status == CRYPTO_DIGISIGN_SUCCESS)
+                && (pointStatus == CRYPTO_ECC_POINT_SUCCESS) && match 
+                && (verifyStat == 1); i++)
+        {
+            appData.prevCounterVal = SYS_TIME_Counter64Get();
+            status = Crypto_DigiSign_Ecdsa_Sign(CRYPTO_HANDLER_HW_INTERNAL, 
+                hash, hashSize, sig, sigSize, privKey, keySize, curveType, 
+                SESSION_ID);
+            signCount[pass] += (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+
+            if (status == CRYPTO_DIGISIGN_SUCCESS)
+            {
+                status = Crypto_DigiSign_Ecdsa_Verify(CRYPTO_HANDLER_SW_WOLFCRYPT,
+                    hash, hashSize, sig, sigSize, pubKey, pointSize, 
+                    &verifyStat, curveType, SESSION_ID);
+            }
+        }
+    }
+    DRV_CRYPTO_ECC_SetCombEnabled(true);
+
+    (void) memset(privKey, 0, sizeof(privKey));
+
+    if ((status != CRYPTO_DIGISIGN_SUCCESS) 
+            || (pointStatus != CRYPTO_ECC_POINT_SUCCESS))
+    {
+        printf("Comb key generation or signature failed\r\n");
+        printf("Status: %d / %d\r\n", status, pointStatus);
+        appData.testsFailed++;
+    }
+    else if (!match)
+    {
+        printf("Comb public key mismatch\r\n");
+        appData.testsFailed++;
+    }
+    else if (verifyStat != 1)
+    {
+        printf("Comb signature rejected\r\n");
+        appData.testsFailed++;
+    }
+    else
+    {
+        printf("Table: %d columns, %d bytes of flash\r\n", 
+            (int)comb->u2Columns, (int)comb->u4Size);
+        printf("Sign (us): comb / CPKCL\r\n");
+        printf("%d / %d\r\n", 
+            (int)SYS_TIME_CountToUS(signCount[0] / APP_COMB_ROUNDS), 
+            (int)SYS_TIME_CountToUS(signCount[1] / APP_COMB_ROUNDS));
+        printf("Test successful\r\n");
+        appData.testsPassed++;
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void Rfc6979_Test(crypto_EccCurveType_E curveType, uint8_t *privKey,
+        uint8_t *pubKey, size_t keySize, uint8_t *hash, size_t hashSize, 
+        uint8_t *expSig)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void Rfc6979_Test(crypto_EccCurveType_E curveType, uint8_t *privKey,
+    uint8_t *pubKey, size_t keySize, uint8_t *hash, size_t hashSize, 
+    uint8_t *expSig)
+{
+    static uint8_t sig[2 * CRYPTO_ECC_MAX_KEY_LENGTH];
+    crypto_DigiSign_Status_E status;
+    size_t pointSize = (2U * keySize) + 1U;
+    size_t sigSize = 2U * keySize;
+    uint64_t signCount[2] = {0, 0};
+    int8_t verifyStat = 0;
+    uint32_t i;
+    bool match;
+
+    /* wolfCrypt handler, HMAC_DRBG on the wolfCrypt HMAC */
+    (void) memset(sig, 0, sizeof(sig));
+    status = Crypto_DigiSign_Ecdsa_SignDeterministic(CRYPTO_HANDLER_SW_WOLFCRYPT,
+        hash, hashSize, sig, sigSize, privKey, keySize, curveType, SESSION_ID);
+    match = (status == CRYPTO_DIGISIGN_SUCCESS) 
+        && CompareHexArray(sig, expSig, sigSize);
+
+    /* Hardware handler, HMAC_DRBG on the SHA engine and k into the CPKCC */
+    for (i = 0; (i < APP_RFC6979_ROUNDS) && match; i++)
+    {
+        (void) memset(sig, 0, sizeof(sig));
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        status = Crypto_DigiSign_Ecdsa_SignDeterministic(
+            CRYPTO_HANDLER_HW_INTERNAL, hash, hashSize, sig, sigSize, privKey, 
+            keySize, curveType, SESSION_ID);
+        signCount[0] += (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+        match = (status == CRYPTO_DIGISIGN_SUCCESS) 
+            && CompareHexArray(sig, expSig, sigSize);
+    }
+
+    if (match)
+    {
+        status = Crypto_DigiSign_Ecdsa_Verify(CRYPTO_HANDLER_SW_WOLFCRYPT,
+            hash, hashSize, sig, sigSize, pubKey, pointSize, &verifyStat, 
+            curveType, SESSION_ID);
+    }
+
+    /* Random nonce drawn by the CPKCL for the same key and hash */
+    for (i = 0; (i < APP_RFC6979_ROUNDS) && match 
+            && (status == CRYPTO_DIGISIGN_SUCCESS); i++)
+    {
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        status = Crypto_DigiSign_Ecdsa_Sign(CRYPTO_HANDLER_HW_INTERNAL, 
+            hash, hashSize, sig, sigSize, privKey, keySize, curveType, 
+            SESSION_ID);
+        signCount[1] += (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+    }
+
+    if (!match)
+    {
+        printf("Deterministic signature mismatch\r\n");
+        printf("Status: %d\r\n", status);
+        appData.testsFailed++;
+    }
+    else if (status != CRYPTO_DIGISIGN_SUCCESS)
+    {
+        printf("Verification or random signature failed\r\n");
+        printf("Status: %d\r\n", status);
+        appData.testsFailed++;
+    }
+    else if (verifyStat != 1)
+    {
+        printf("Deterministic signature rejected\r\n");
+        appData.testsFailed++;
+    }
+    else
+    {
+        printf("Sign (us): deterministic / random\r\n");
+        printf("%d / %d\r\n", 
+            (int)SYS_TIME_CountToUS(signCount[0] / APP_RFC6979_ROUNDS), 
+            (int)SYS_TIME_CountToUS(signCount[1] / APP_RFC6979_ROUNDS));
+        printf("Test successful\r\n");
+        appData.testsPassed++;
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void Ecqv_Test(crypto_EccCurveType_E curveType, size_t keySize,
+        uint8_t *certInfo, size_t certInfoSize)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void Ecqv_Test(crypto_EccCurveType_E curveType, size_t keySize,
+    uint8_t *certInfo, size_t certInfoSize)
+{
+    static uint8_t caPrivKey[CRYPTO_ECC_MAX_KEY_LENGTH];
+    static uint8_t caPubKey[(2 * CRYPTO_ECC_MAX_KEY_LENGTH) + 1];
+    static uint8_t requestPrivKey[CRYPTO_ECC_MAX_KEY_LENGTH];
+    static uint8_t requestPoint[(2 * CRYPTO_ECC_MAX_KEY_LENGTH) + 1];
+    static uint8_t privKeyRecon[CRYPTO_ECC_MAX_KEY_LENGTH];
+    static uint8_t privKey[CRYPTO_ECC_MAX_KEY_LENGTH];
+    static uint8_t pubKey[(2 * CRYPTO_ECC_MAX_KEY_LENGTH) + 1];
+    static uint8_t relyingPubKey[(2 * CRYPTO_ECC_MAX_KEY_LENGTH) + 1];
+    static uint8_t cert[CRYPTO_ECQV_CERT_SIZE(CRYPTO_ECC_MAX_KEY_LENGTH, 64)];
+    crypto_DigiSign_Status_E keyStatus;
+    crypto_Ecqv_Status_E status = CRYPTO_ECQV_ERROR_ARG;
+    crypto_Ecc_Point_Status_E pointStatus = CRYPTO_ECC_POINT_SUCCESS;
+    size_t pointSize = (2U * keySize) + 1U;
+    size_t certSize = CRYPTO_ECQV_CERT_SIZE(keySize, certInfoSize);
+    uint64_t issueCount = 0;
+    uint64_t privCount = 0;
+    uint64_t pubCount = 0;
+    uint64_t dualMulCount = 0;
+    uint32_t i;
+    bool match = false;
+    bool tamperRejected = false;
+
+    /* CA key pair, then the request of the subject R_U = k_U*G */
+    keyStatus = Crypto_DigiSign_Ecc_KeyGen(CRYPTO_HANDLER_HW_INTERNAL, 
+        caPrivKey, keySize, caPubKey, pointSize, curveType, SESSION_ID);
+    if (keyStatus == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        keyStatus = Crypto_DigiSign_Ecc_KeyGen(CRYPTO_HANDLER_HW_INTERNAL,
+            requestPrivKey, keySize, requestPoint, pointSize, curveType, 
+            SESSION_ID);
+    }
+
+    if ((keyStatus == CRYPTO_DIGISIGN_SUCCESS) 
+            && (certInfoSize <= 64U) && (keySize <= sizeof(privKey)))
+    {
+        /* CA */
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        status = Crypto_Ecqv_Issue(curveType, caPrivKey, keySize, 
+            requestPoint, pointSize, certInfo, certInfoSize, cert, certSize,
+            privKeyRecon, keySize);
+        issueCount = SYS_TIME_Counter64Get() - appData.prevCounterVal;
+    }
+
+    if (status == CRYPTO_ECQV_SUCCESS)
+    {
+        /* Subject, d_U*G is checked against the reconstructed key */
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        status = Crypto_Ecqv_PrivateKey(curveType, cert, certSize, 
+            privKeyRecon, keySize, requestPrivKey, keySize, caPubKey, 
+            pointSize, privKey, keySize, pubKey, pointSize);
+        privCount = SYS_TIME_Counter64Get() - appData.prevCounterVal;
+    }
+
+    /* Relying party, from the certificate and the CA public key only */
+    match = (status == CRYPTO_ECQV_SUCCESS);
+    for (i = 0; (i < APP_ECQV_ROUNDS) && match; i++)
+    {
+        (void) memset(relyingPubKey, 0, sizeof(relyingPubKey));
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        status = Crypto_Ecqv_PublicKey(curveType, cert, certSize, caPubKey, 
+            pointSize, relyingPubKey, pointSize);
+        pubCount += (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+        match = (status == CRYPTO_ECQV_SUCCESS)
+            && CompareHexArray(relyingPubKey, pubKey, pointSize);
+    }
+
+    /* Reference: a double scalar multiplication with full size scalars */
+    for (i = 0; (i < APP_ECQV_ROUNDS) && match 
+            && (pointStatus == CRYPTO_ECC_POINT_SUCCESS); i++)
+    {
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        pointStatus = Crypto_Ecc_Point_DualMul(curveType, privKeyRecon, 
+            keySize, NULL, 0, privKeyRecon, keySize, caPubKey, pointSize, 
+            relyingPubKey, pointSize);
+        dualMulCount += (SYS_TIME_Counter64Get() - appData.prevCounterVal);
+    }
+
+    /* Any change to the certificate information changes the key */
+    if (match && (certInfoSize > 0U))
+    {
+        cert[certSize - 1U] ^= 0x01U;
+        tamperRejected = (Crypto_Ecqv_PublicKey(curveType, cert, certSize, 
+            caPubKey, pointSize, relyingPubKey, pointSize) 
+                != CRYPTO_ECQV_SUCCESS)
+            || !CompareHexArray(relyingPubKey, pubKey, pointSize);
+        cert[certSize - 1U] ^= 0x01U;
+    }
+
+    (void) memset(requestPrivKey, 0, sizeof(requestPrivKey));
+    (void) memset(privKey, 0, sizeof(privKey));
+
+    if (keyStatus != CRYPTO_DIGISIGN_SUCCESS)
+    {
+        printf("Key generation failed\r\n");
+        printf("Status: %d\r\n", keyStatus);
+        appData.testsFailed++;
+    }
+    else if (!match)
+    {
+        printf("Reconstructed keys mismatch\r\n");
+        printf("Status: %d\r\n", status);
+        appData.testsFailed++;
+    }
+    else if (pointStatus != CRYPTO_ECC_POINT_SUCCESS)
+    {
+        printf("Double scalar multiplication failed\r\n");
+        printf("Status: %d\r\n", pointStatus);
+        appData.testsFailed++;
+    }
+    else if (!tamperRejected)
+    {
+        printf("Modified certificate gave the same key\r\n");
+        appData.testsFailed++;
+    }
+    else
+    {
+        printf("Certificate (bytes): %d, P_U %d + information %d\r\n", 
+            (int)certSize, (int)(keySize + 1U), (int)certInfoSize);
+        printf("Issue / private key / public key (us)\r\n");
+        printf("%d / %d / %d\r\n", 
+            (int)SYS_TIME_CountToUS(issueCount), 
+            (int)SYS_TIME_CountToUS(privCount), 
+            (int)SYS_TIME_CountToUS(pubCount / APP_ECQV_ROUNDS));
+        printf("Point DualMul (us): %d\r\n", 
+            (int)SYS_TIME_CountToUS(dualMulCount / APP_ECQV_ROUNDS));
+        printf("Test successful\r\n");
+        appData.testsPassed++;
+    }
+}
+
+/* Runs the non-blocking operation started with status to its end, one call of
+   Crypto_Ecc_Nb_Continue per slice. The count of the Start call and of the 
+   longest slice go to worst, the sum of all of them to total. */
+static crypto_Ecc_Nb_Status_E lApp_Nb_Run(crypto_Ecc_Nb_Status_E status, 
+    uint64_t startCount, uint64_t *worst, uint64_t *total, uint32_t *slices)
+{
+    uint64_t count;
+
+    *worst = startCount;
+    *total = startCount;
+    *slices = 0U;
+    while (status == CRYPTO_ECC_NB_IN_PROGRESS)
+    {
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        status = Crypto_Ecc_Nb_Continue(APP_NB_SLICE_STEPS);
+        count = SYS_TIME_Counter64Get() - appData.prevCounterVal;
+        *total += count;
+        (*slices)++;
+        if (count > *worst)
+        {
+            *worst = count;
+        }
+    }
+
+    return status;
+}
+
+/*******************************************************************************
+  Function:
+    void EccNb_Test(crypto_HandlerType_E handler, 
+        crypto_EccCurveType_E curveType, uint8_t *privKey, uint8_t *pubKey,
+        size_t keySize, uint8_t *hash, size_t hashSize, uint8_t *expSig)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void EccNb_Test(crypto_HandlerType_E handler, 
+    crypto_EccCurveType_E curveType, uint8_t *privKey, uint8_t *pubKey,
+    size_t keySize, uint8_t *hash, size_t hashSize, uint8_t *expSig)
+{
+    static uint8_t sig[2 * CRYPTO_ECC_MAX_KEY_LENGTH];
+    crypto_Ecc_Nb_Status_E status;
+    crypto_DigiSign_Status_E blockStatus = CRYPTO_DIGISIGN_SUCCESS;
+    size_t pointSize = (2U * keySize) + 1U;
+    size_t sigSize = 2U * keySize;
+    uint64_t worst[2] = {0, 0};
+    uint64_t total[2] = {0, 0};
+    uint64_t blockCount[2] = {0, 0};
+    uint32_t slices[2] = {0, 0};
+    int8_t verifyStat = 0;
+    int8_t expVerifyStat = 0;
+    bool badRejected = false;
+
+    /* Known answer: the RFC 6979 signature verifies */
+    appData.prevCounterVal = SYS_TIME_Counter64Get();
+    status = Crypto_Ecc_Nb_VerifyStart(handler, curveType, hash, hashSize, 
+        expSig, sigSize, pubKey, pointSize, &expVerifyStat);
+    status = lApp_Nb_Run(status, 
+        SYS_TIME_Counter64Get() - appData.prevCounterVal, &worst[1], 
+        &total[1], &slices[1]);
+
+    /* Random nonce signature, checked by the blocking wolfCrypt verification */
+    if (status == CRYPTO_ECC_NB_SUCCESS)
+    {
+        (void) memset(sig, 0, sizeof(sig));
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        status = Crypto_Ecc_Nb_SignStart(handler, curveType, hash, hashSize, 
+            privKey, keySize, sig, sigSize);
+        status = lApp_Nb_Run(status, 
+            SYS_TIME_Counter64Get() - appData.prevCounterVal, &worst[0], 
+            &total[0], &slices[0]);
+    }
+
+    if (status == CRYPTO_ECC_NB_SUCCESS)
+    {
+        blockStatus = Crypto_DigiSign_Ecdsa_Verify(CRYPTO_HANDLER_SW_WOLFCRYPT,
+            hash, hashSize, sig, sigSize, pubKey, pointSize, &verifyStat, 
+            curveType, SESSION_ID);
+    }
+
+    /* A corrupted signature must be rejected */
+    if ((status == CRYPTO_ECC_NB_SUCCESS) 
+            && (blockStatus == CRYPTO_DIGISIGN_SUCCESS))
+    {
+        int8_t badVerifyStat = 1;
+
+        sig[sigSize - 1U] ^= 0x01U;
+        status = Crypto_Ecc_Nb_VerifyStart(handler, curveType, hash, hashSize,
+            sig, sigSize, pubKey, pointSize, &badVerifyStat);
+        while (status == CRYPTO_ECC_NB_IN_PROGRESS)
+        {
+            status = Crypto_Ecc_Nb_Continue(APP_NB_SLICE_STEPS);
+        }
+        sig[sigSize - 1U] ^= 0x01U;
+        badRejected = (badVerifyStat == 0);
+    }
+
+    /* Reference: the blocking calls on the same handler */
+    if ((status == CRYPTO_ECC_NB_SUCCESS) 
+            && (blockStatus == CRYPTO_DIGISIGN_SUCCESS))
+    {
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        blockStatus = Crypto_DigiSign_Ecdsa_Sign(handler, hash, hashSize, 
+            sig, sigSize, privKey, keySize, curveType, SESSION_ID);
+        blockCount[0] = SYS_TIME_Counter64Get() - appData.prevCounterVal;
+    }
+
+    if ((status == CRYPTO_ECC_NB_SUCCESS) 
+            && (blockStatus == CRYPTO_DIGISIGN_SUCCESS))
+    {
+        appData.prevCounterVal = SYS_TIME_Counter64Get();
+        blockStatus = Crypto_DigiSign_Ecdsa_Verify(handler, hash, hashSize, 
+            expSig, sigSize, pubKey, pointSize, &verifyStat, curveType, 
+            SESSION_ID);
+        blockCount[1] = SYS_TIME_Counter64Get() - appData.prevCounterVal;
+    }
+
+    if (status != CRYPTO_ECC_NB_SUCCESS)
+    {
+        printf("Non-blocking operation failed\r\n");
+        printf("Status: %d\r\n", status);
+        appData.testsFailed++;
+    }
+    else if (blockStatus != CRYPTO_DIGISIGN_SUCCESS)
+    {
+        printf("Blocking operation failed\r\n");
+        printf("Status: %d\r\n", blockStatus);
+        appData.testsFailed++;
+    }
+    else if ((expVerifyStat != 1) || (verifyStat != 1))
+    {
+        printf("Valid signature rejected\r\n");
+        appData.testsFailed++;
+    }
+    else if (!badRejected)
+    {
+        printf("Corrupted signature accepted\r\n");
+        appData.testsFailed++;
+    }
+    else
+    {
+        printf("Steps per slice: %d\r\n", (int)APP_NB_SLICE_STEPS);
+        printf("Sign: slices / worst slice / total / blocking (us)\r\n");
+        printf("%d / %d / %d / %d\r\n", (int)slices[0], 
+            (int)SYS_TIME_CountToUS(worst[0]), 
+            (int)SYS_TIME_CountToUS(total[0]), 
+            (int)SYS_TIME_CountToUS(blockCount[0]));
+        printf("Verify: slices / worst slice / total / blocking (us)\r\n");
+        printf("%d / %d / %d / %d\r\n", (int)slices[1], 
+            (int)SYS_TIME_CountToUS(worst[1]), 
+            (int)SYS_TIME_CountToUS(total[1]), 
+            (int)SYS_TIME_CountToUS(blockCount[1]));
+        printf("Test successful\r\n");
+        appData.testsPassed++;
+    }
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Application Initialization and State Machine Functions
+// *****************************************************************************
+// *****************************************************************************
+
+/*******************************************************************************
+  Function:
+    void APP_Initialize ( void )
+
+  Remarks:
+    See prototype in app.h.
+ */
+
+void APP_Initialize ( void )
+{
+    /* Place the App state machine in its initial state. */
+    appData.state = APP_STATE_INIT;
+    
+    appData.speedTest = SYS_TIME_HANDLE_INVALID;
+
+    appData.testsPassed = 0; 
+    appData.testsFailed = 0;
+
+    appData.isTestedECDSA = false;
+
+    /* CPKCL self test runs once here, ECC operations use the cached result */
+    (void) DRV_CRYPTO_ECC_InitCpkcl();
+}
+
+/******************************************************************************
+  Function:
+    void APP_Tasks ( void )
+
+  Remarks:
+    See prototype in app.h.
+ */
+
+void APP_Tasks ( void )
+{
+    /* Check the application's current state. */
+    switch ( appData.state )
+    {
+        /* Application's initial state. */
+        case APP_STATE_INIT:
+        {
+            bool appInitialized = true;
+
+            if (appInitialized)
+            {
+                appData.state = APP_STATE_SERVICE_TASKS;
+            }
+
+            break;
+        }
+
+        case APP_STATE_SERVICE_TASKS:
+        {               
+            if (!appData.isTestedECDSA)
+            {
+                printf("\r\n-----------ECDSA Hardware Wrapper-------------\r\n");
+                ECDSA_Test(CRYPTO_HANDLER_HW_INTERNAL);
+                
+                printf("\r\n-----------ECDSA wolfCrypt Wrapper-------------\r\n");
+                ECDSA_Test(CRYPTO_HANDLER_SW_WOLFCRYPT);
+                
+                printf("\r\n-----------ECDSA CPKCL Self Test Latency-------------\r\n");
+                ECDSA_Cpkcl_Benchmark();
+                
+                printf("\r\n-----------ECDSA Hardware SignData/VerifyData-------------\r\n");
+                ECDSA_SignData_Benchmark();
+                
+                printf("\r\n-----------ECC Key Generation-------------\r\n");
+                ECC_KeyGen_Benchmark();
+                
+                printf("\r\n-----------ECDSA Nonce Precomputation-------------\r\n");
+                ECDSA_Pool_Benchmark();
+                
+                printf("\r\n-----------ECDSA Batch Verification-------------\r\n");
+                ECDSA_VerifyBatch_Benchmark();
+                
+                printf("\r\n-----------ECDSA Compressed Public Keys-------------\r\n");
+                ECDSA_Compressed_Benchmark();
+                
+                printf("\r\n-----------ECDSA Binary Curves-------------\r\n");
+                ECDSA_Binary_Benchmark();
+                
+                printf("\r\n-----------ECDSA Custom Curve-------------\r\n");
+                ECDSA_Custom_Benchmark();
+                
+                printf("\r\n-----------RSA PKCS#1 v1.5, PSS and OAEP-------------\r\n");
+                RSA_Benchmark();
+                
+                printf("\r\n-----------wolfCrypt sp_int on the CPKCC-------------\r\n");
+                SP_Offload_Benchmark();
+                
+                printf("\r\n-----------wolfCrypt Crypto Callback-------------\r\n");
+                CryptoCb_Benchmark();
+                
+                printf("\r\n-----------ECC Key Handles-------------\r\n");
+                KeyHandle_Benchmark();
+                
+                printf("\r\n-----------ECC Point Arithmetic-------------\r\n");
+                EccPoint_Benchmark();
+                
+                printf("\r\n-----------ECC Fixed-Base Comb-------------\r\n");
+                Comb_Benchmark();
+                
+                printf("\r\n-----------Deterministic ECDSA (RFC 6979)-------------\r\n");
+                Rfc6979_Benchmark();
+                
+                printf("\r\n-----------ECQV implicit certificates-------------\r\n");
+                Ecqv_Benchmark();
+                
+                printf("\r\n-----------Non-blocking ECDSA-------------\r\n");
+                EccNb_Benchmark();
+                
+                appData.isTestedECDSA = true;
+
+                printf("\r\n-----------------------------------\r\n");
+                printf("Tests attempted: %d", appData.testsPassed + appData.testsFailed);
+                printf("\r\nTests successful: %d\r\n", appData.testsPassed);
+            }
+            else
+            {
+                /* Idle, precompute the next signature nonce */
+                (void) Crypto_Ecc_Pool_Tasks();
             }
            
             break;
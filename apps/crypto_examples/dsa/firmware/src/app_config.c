@@ -33,6 +33,15 @@ uint8_t sig256[64];
 
 uint8_t sig384[96];
 
+uint8_t sig521[132];
+
+/* Generated key pairs, sized for the largest curve */
+uint8_t keyGenPriv[CRYPTO_ECC_MAX_KEY_LENGTH];
+
+uint8_t keyGenPub[(2 * CRYPTO_ECC_MAX_KEY_LENGTH) + 1];
+
+uint8_t keyGenSig[2 * CRYPTO_ECC_MAX_KEY_LENGTH];
+
 
 // *****************************************************************************
 /* NIST Test Vectors
@@ -126,6 +135,964 @@ uint8_t pubKeyECDSA384_Compressed[49] =
     0x8f, 0x70, 0x59, 0xf1, 0x01, 0xf6, 0x5a, 0x2b 
 };
 
+uint8_t privKeyECDSA521[66] =
+{
+    /* d */
+    0x01, 0xc8, 0x15, 0x27, 0xdc, 0x37, 0xde, 0xce,
+    0xfa, 0x9d, 0x7b, 0x68, 0x0b, 0xd1, 0x88, 0xa1,
+    0x4a, 0xca, 0x60, 0x1f, 0x2c, 0xa1, 0xd9, 0x6e,
+    0xda, 0xa4, 0x58, 0x01, 0xf6, 0x32, 0x6e, 0xea,
+    0x04, 0x78, 0xf2, 0x68, 0xce, 0x6e, 0x5b, 0x6b,
+    0xb9, 0x63, 0xb1, 0xd6, 0xc0, 0x01, 0x8b, 0xe1,
+    0x60, 0x29, 0x91, 0x8b, 0x89, 0xe2, 0xef, 0x03,
+    0xb6, 0x9a, 0xcf, 0x05, 0x3e, 0x38, 0x7b, 0x5c,
+    0xf7, 0x8d
+};
+
+//04 + qx + qy 
+uint8_t pubKeyECDSA521[133] =
+{
+    /* Qx */
+    0x04,
+    0x00, 0xeb, 0x41, 0x12, 0xf3, 0x2e, 0x9b, 0xa7,
+    0x5f, 0x94, 0x56, 0xb6, 0x6b, 0xc9, 0xb3, 0x66,
+    0xdb, 0xf0, 0x38, 0xc5, 0x00, 0x2b, 0xb7, 0x7e,
+    0x53, 0x24, 0xc3, 0xa5, 0x10, 0xd0, 0x1f, 0x20,
+    0xf6, 0xfb, 0xbe, 0x03, 0x81, 0x46, 0x8a, 0xba,
+    0x05, 0xdf, 0x33, 0x12, 0x95, 0x65, 0x55, 0xd9,
+    0x7e, 0x99, 0x11, 0xb4, 0x02, 0x27, 0xef, 0x0b,
+    0xfd, 0xe4, 0x02, 0x90, 0x4e, 0x8a, 0xac, 0x81,
+    0x23, 0x06,
+    /* Qy */
+    0x01, 0x64, 0x1d, 0x6e, 0x25, 0xbc, 0x6b, 0xc2,
+    0x20, 0x30, 0x95, 0x4d, 0x4c, 0x4d, 0x0f, 0xf6,
+    0xb1, 0xa7, 0xf7, 0x62, 0x3e, 0xe2, 0xa1, 0x78,
+    0xf7, 0x54, 0xa7, 0xb8, 0xb6, 0x35, 0x6c, 0xa2,
+    0x2b, 0x45, 0x5a, 0x96, 0x40, 0x8c, 0xe1, 0x75,
+    0x1e, 0x31, 0x09, 0x88, 0x8a, 0xbc, 0x2f, 0x6f,
+    0x2d, 0xe8, 0x6a, 0xa1, 0x81, 0xb1, 0x16, 0x44,
+    0xb8, 0x17, 0xb5, 0x57, 0x39, 0x7c, 0x95, 0x1d,
+    0xc6, 0xfe
+};
+
+/* Message signed by the SignData/VerifyData tests, longer than a SHA-512 
+   block so the hash runs over several blocks */
+uint8_t dataMsg[] = 
+    "The hardware SignData and VerifyData calls hash this message on the SHA "
+    "engine and hand the digest to the CPKCC, the signature is then checked "
+    "again with the wolfCrypt handler.";
+
+// *****************************************************************************
+/* RSA Test Keys
+
+  Summary:
+    RSA 2048 and 3072 key pairs in CRT form, e = 65537.
+
+  Description:
+    The keys were generated with OpenSSL. They only serve the RSA tests and 
+    must not be used anywhere else.
+*/
+
+uint8_t rsaExponent[3] = { 0x01, 0x00, 0x01 };
+
+/* n */
+uint8_t rsa2048N[256] =
+{
+    0xc2, 0xe6, 0xb2, 0xb5, 0xec, 0x3d, 0xa7, 0x1e,
+    0x17, 0xe2, 0x2c, 0xd0, 0x66, 0xa6, 0x76, 0x65,
+    0x65, 0x14, 0x9b, 0xb5, 0xf6, 0x14, 0x96, 0x1e,
+    0xf3, 0x24, 0xa3, 0xc9, 0xa9, 0x1d, 0x21, 0xf8,
+    0xec, 0xb3, 0x39, 0xb1, 0x4b, 0x8f, 0xfc, 0xbd,
+    0x22, 0xd7, 0x01, 0x31, 0x7b, 0x5e, 0x39, 0xaa,
+    0xff, 0xe4, 0x0a, 0xe2, 0x2d, 0xae, 0x9f, 0x94,
+    0xf1, 0x37, 0xe6, 0xcd, 0x4f, 0x5a, 0x71, 0x10,
+    0xcc, 0xa0, 0x09, 0xb0, 0x46, 0x3c, 0x0d, 0x6c,
+    0xc4, 0xef, 0x25, 0xb1, 0xfd, 0x15, 0x6f, 0xfe,
+    0x5d, 0x59, 0x2d, 0x0d, 0x1a, 0xe4, 0x96, 0x18,
+    0x41, 0x68, 0x74, 0xe2, 0x8f, 0xa5, 0x37, 0x4d,
+    0x29, 0x29, 0x70, 0x14, 0x9b, 0x13, 0x57, 0xcb,
+    0x46, 0x99, 0x79, 0xeb, 0xa6, 0x8d, 0x9a, 0x1f,
+    0x94, 0xa9, 0x03, 0xad, 0x26, 0x7e, 0x78, 0xe8,
+    0x37, 0x64, 0x40, 0xbd, 0x82, 0x25, 0x3a, 0x85,
+    0x82, 0xe0, 0xf4, 0x7a, 0xab, 0x19, 0x4f, 0x47,
+    0x76, 0x44, 0xa6, 0x9d, 0xcc, 0xdb, 0xad, 0x49,
+    0x04, 0xb9, 0x20, 0x3a, 0xa4, 0x0f, 0x29, 0xbc,
+    0xb2, 0x41, 0x82, 0x56, 0x93, 0x1d, 0x9e, 0x87,
+    0x82, 0x4b, 0xe0, 0x6f, 0xac, 0x20, 0x8d, 0x0a,
+    0x7e, 0xf6, 0x13, 0xc1, 0xc1, 0xa5, 0x86, 0xbc,
+    0xff, 0xb5, 0x7b, 0x28, 0xeb, 0x6a, 0x2e, 0x0a,
+    0xaf, 0xa3, 0x4e, 0xfc, 0xc5, 0x0f, 0x9c, 0x80,
+    0x0a, 0xa4, 0xdb, 0x8b, 0x6a, 0x5f, 0x0b, 0x46,
+    0x30, 0xea, 0x2a, 0x79, 0xd9, 0x93, 0xe7, 0x5c,
+    0x8b, 0x4e, 0x0c, 0xb2, 0xcc, 0x5b, 0x57, 0xa0,
+    0xc1, 0x8a, 0xa9, 0x5d, 0x65, 0x38, 0xaf, 0x89,
+    0xe7, 0xf4, 0x38, 0x69, 0x1d, 0x9f, 0x56, 0x84,
+    0xa1, 0x0b, 0xbf, 0xb3, 0xf0, 0xec, 0xad, 0x50,
+    0x73, 0x30, 0x74, 0x23, 0x17, 0x08, 0xd0, 0xe7,
+    0xdf, 0x54, 0xc3, 0xdf, 0x98, 0x27, 0xbe, 0xd7
+};
+
+/* d */
+uint8_t rsa2048D[256] =
+{
+    0x2e, 0x2a, 0x5e, 0x0f, 0x68, 0x7f, 0x6c, 0x0b,
+    0xdd, 0x45, 0x66, 0x2f, 0x10, 0xf9, 0x82, 0x16,
+    0xdf, 0x5c, 0x03, 0xcc, 0x14, 0x97, 0x68, 0xbd,
+    0xb9, 0x03, 0x27, 0x46, 0xb7, 0xa7, 0x9e, 0x69,
+    0xeb, 0x8b, 0x42, 0x71, 0xa3, 0xff, 0xdd, 0xb2,
+    0x61, 0x43, 0xc3, 0x55, 0x18, 0xaf, 0x47, 0x82,
+    0xa1, 0x2d, 0x3f, 0x84, 0xb6, 0xa4, 0x63, 0xc9,
+    0x70, 0x5f, 0xb8, 0xec, 0x4d, 0xcd, 0x12, 0xf6,
+    0x13, 0x3a, 0x1f, 0x41, 0x61, 0x49, 0x8d, 0x36,
+    0x83, 0xe9, 0x4f, 0xa8, 0xfa, 0xd5, 0x2e, 0x9b,
+    0x76, 0x3a, 0x0e, 0xc9, 0x49, 0x62, 0xf6, 0xc8,
+    0x95, 0x09, 0xac, 0x92, 0x13, 0xcb, 0x63, 0x2f,
+    0x84, 0x3d, 0xfb, 0xfd, 0xed, 0x83, 0xa5, 0xea,
+    0x90, 0xf4, 0xfe, 0xa3, 0x9a, 0x66, 0x75, 0x28,
+    0xe0, 0xda, 0x2d, 0xf4, 0x40, 0x27, 0x79, 0xf5,
+    0x2b, 0x55, 0xb4, 0x5e, 0x0f, 0x2b, 0x49, 0x52,
+    0x77, 0xaf, 0xbb, 0xa3, 0xf4, 0x58, 0xa6, 0x4e,
+    0x06, 0x7c, 0x5d, 0xb5, 0xbd, 0x9f, 0xaa, 0xd5,
+    0x46, 0x0e, 0xd7, 0xf9, 0x71, 0xfa, 0x86, 0xf1,
+    0x36, 0x31, 0xf4, 0x36, 0x5d, 0xbe, 0x91, 0x33,
+    0xac, 0x67, 0x85, 0x4c, 0x90, 0x39, 0x08, 0x10,
+    0x39, 0x73, 0x50, 0xeb, 0xfd, 0xe9, 0x3e, 0xdc,
+    0x45, 0x64, 0x16, 0x8a, 0x0b, 0xc2, 0x1f, 0x97,
+    0x29, 0x2a, 0x80, 0x21, 0x11, 0x33, 0x06, 0x74,
+    0x1e, 0xdb, 0xb0, 0x9a, 0x67, 0x54, 0xfa, 0xd1,
+    0x04, 0x79, 0x9b, 0xc9, 0x3f, 0x86, 0xd0, 0x46,
+    0xd1, 0x9d, 0x39, 0x19, 0xe8, 0xc0, 0x39, 0xfc,
+    0x05, 0x10, 0xb0, 0xda, 0xb7, 0x94, 0xe0, 0x41,
+    0x9d, 0xb8, 0x59, 0xc5, 0x36, 0x4d, 0xef, 0x79,
+    0x38, 0x72, 0x06, 0x26, 0x7e, 0x14, 0x61, 0xc3,
+    0x78, 0xe5, 0x25, 0x69, 0x2b, 0x00, 0xb9, 0x15,
+    0x4c, 0xb6, 0x10, 0x98, 0xed, 0xd3, 0x97, 0x3d
+};
+
+/* p */
+uint8_t rsa2048P[128] =
+{
+    0xea, 0x16, 0x3c, 0x8a, 0x6c, 0x6f, 0x50, 0xcb,
+    0xf7, 0x55, 0xc4, 0x10, 0x0b, 0x70, 0xb8, 0xf0,
+    0x88, 0x73, 0xab, 0xc5, 0xda, 0x00, 0x17, 0x44,
+    0xd3, 0x3e, 0xb1, 0x0f, 0x2c, 0xa4, 0x92, 0xc4,
+    0x35, 0xdc, 0x1f, 0xc5, 0xab, 0xae, 0x67, 0x13,
+    0x14, 0x45, 0x37, 0x3c, 0x0a, 0xfe, 0x85, 0x40,
+    0x08, 0x21, 0xd9, 0xd0, 0xab, 0xa0, 0x1e, 0xbc,
+    0xec, 0xac, 0x2a, 0x53, 0x6f, 0x4d, 0xac, 0x54,
+    0xc2, 0xd9, 0x8d, 0x76, 0x82, 0x48, 0xfd, 0x13,
+    0x2f, 0xd6, 0x5a, 0x1c, 0x0f, 0x5b, 0xb7, 0x04,
+    0x4d, 0x31, 0x92, 0x5c, 0x0b, 0x51, 0xfd, 0xf4,
+    0x6a, 0x48, 0x82, 0x50, 0x25, 0x2b, 0xc5, 0xb8,
+    0xbb, 0x29, 0x04, 0xc6, 0x7d, 0xec, 0xb6, 0xff,
+    0xc4, 0x43, 0x5e, 0x7f, 0x74, 0x72, 0x35, 0x82,
+    0x86, 0x46, 0x46, 0xec, 0xb6, 0xd5, 0x75, 0x9f,
+    0x8f, 0x6d, 0x1e, 0xc1, 0x0d, 0x8e, 0x6e, 0x9b
+};
+
+/* q */
+uint8_t rsa2048Q[128] =
+{
+    0xd5, 0x25, 0x65, 0xd7, 0xb0, 0x91, 0x08, 0x42,
+    0x3d, 0xf9, 0xf4, 0x9e, 0x35, 0x4b, 0x51, 0x24,
+    0x66, 0x66, 0xf2, 0xa6, 0x58, 0x8d, 0x08, 0x5d,
+    0x0d, 0xe6, 0x9a, 0x4a, 0xce, 0x71, 0x36, 0xab,
+    0x38, 0x43, 0xc2, 0x58, 0x43, 0x5b, 0x69, 0x1b,
+    0x1a, 0x73, 0xde, 0xff, 0xc8, 0x97, 0x3e, 0x7a,
+    0xf5, 0x93, 0x48, 0xfb, 0xa9, 0xc0, 0x0f, 0x76,
+    0xc7, 0x6e, 0x8c, 0xf3, 0x42, 0x61, 0x04, 0x6d,
+    0x0e, 0xf3, 0xce, 0xcf, 0x52, 0xc7, 0x04, 0xf0,
+    0x83, 0xf2, 0xeb, 0x06, 0xd1, 0x9d, 0x5f, 0x96,
+    0xef, 0x78, 0xfd, 0x53, 0x62, 0x51, 0x47, 0xdb,
+    0xd5, 0xa0, 0x5e, 0x20, 0x19, 0xc1, 0xaa, 0xc1,
+    0x51, 0xb3, 0x91, 0xf0, 0x4f, 0xf1, 0xb8, 0xca,
+    0x00, 0xb8, 0x9a, 0xb7, 0xb1, 0xb0, 0x67, 0xa1,
+    0x06, 0x96, 0xe8, 0x6a, 0x1c, 0x20, 0x85, 0xb4,
+    0x9c, 0xdc, 0xe9, 0x95, 0x12, 0x97, 0xb6, 0x75
+};
+
+/* dP = d mod (p - 1) */
+uint8_t rsa2048DP[128] =
+{
+    0x67, 0xf8, 0x00, 0x63, 0xaa, 0xcd, 0xb6, 0x21,
+    0x21, 0x75, 0xa2, 0x63, 0x4d, 0xf1, 0x7e, 0xf2,
+    0xb6, 0x68, 0x49, 0xbe, 0xd2, 0x98, 0x7f, 0xbd,
+    0x3d, 0xe5, 0xf6, 0x56, 0x3b, 0x09, 0xcd, 0x76,
+    0x00, 0x46, 0x08, 0x86, 0x8f, 0x3e, 0x22, 0xe1,
+    0xc2, 0x7b, 0x0b, 0x91, 0x4b, 0x80, 0xc8, 0x46,
+    0x2c, 0x56, 0x7c, 0x9b, 0xc5, 0xde, 0x94, 0x48,
+    0x6d, 0x05, 0xfa, 0xb6, 0x9c, 0x14, 0xef, 0x99,
+    0xa6, 0x01, 0x62, 0x67, 0x64, 0x6e, 0x6e, 0x98,
+    0xfb, 0x02, 0x45, 0x7b, 0x79, 0x06, 0xcf, 0x3e,
+    0xc5, 0xda, 0x62, 0x9b, 0x27, 0x1b, 0xff, 0xa3,
+    0x73, 0x21, 0x49, 0x5f, 0xb7, 0x62, 0xbd, 0xaa,
+    0xd2, 0xd5, 0xe1, 0x1d, 0x18, 0x08, 0xef, 0x2e,
+    0xa2, 0x49, 0x19, 0xcb, 0x9a, 0x38, 0xaf, 0xb3,
+    0x8d, 0x57, 0xe1, 0x60, 0x79, 0xc4, 0x4d, 0x3d,
+    0xd5, 0x42, 0x2e, 0x0a, 0xa8, 0xae, 0xbe, 0x49
+};
+
+/* dQ = d mod (q - 1) */
+uint8_t rsa2048DQ[128] =
+{
+    0x03, 0x2f, 0xef, 0xf9, 0xed, 0xb5, 0xfd, 0x7d,
+    0xa0, 0x17, 0xa0, 0xc4, 0xcc, 0xdf, 0x37, 0x73,
+    0x67, 0xe4, 0x9a, 0x34, 0x4a, 0x96, 0xb1, 0x4d,
+    0x52, 0xeb, 0xe3, 0xda, 0xc2, 0x83, 0x86, 0xe1,
+    0xc0, 0x91, 0xa2, 0xd2, 0x57, 0x0f, 0x82, 0xde,
+    0xd8, 0xe2, 0x6a, 0xaf, 0x40, 0x7c, 0xa2, 0x7e,
+    0x8c, 0x35, 0x8b, 0x9d, 0xd7, 0xc7, 0xfb, 0x73,
+    0x37, 0x40, 0x3b, 0xf3, 0x57, 0x46, 0xc4, 0x1e,
+    0x2d, 0x5f, 0x0f, 0xf4, 0xa1, 0xb4, 0x40, 0x2a,
+    0xa8, 0x8e, 0x75, 0x5d, 0x40, 0xbd, 0x2d, 0xb4,
+    0xc0, 0x17, 0xfb, 0x11, 0xc8, 0x22, 0x97, 0x04,
+    0x7e, 0x89, 0x4b, 0x5f, 0x07, 0x83, 0x91, 0xde,
+    0x1a, 0x2e, 0xa9, 0x3c, 0x02, 0xb6, 0x06, 0xa1,
+    0x5e, 0xa9, 0x64, 0x06, 0xe3, 0x2d, 0x54, 0x1f,
+    0x60, 0x4d, 0xd9, 0x63, 0xdc, 0xcf, 0xcf, 0xb0,
+    0x07, 0xb8, 0x75, 0xf5, 0xb8, 0xb5, 0x74, 0x11
+};
+
+/* qInv = q^-1 mod p */
+uint8_t rsa2048QInv[128] =
+{
+    0x32, 0x9d, 0xf4, 0x29, 0x7d, 0x92, 0xa6, 0xa4,
+    0xf1, 0xff, 0x7c, 0xaa, 0xf9, 0xf4, 0x06, 0x73,
+    0x8a, 0xaa, 0x2d, 0xa1, 0x5c, 0xf2, 0x52, 0x2e,
+    0xfc, 0x03, 0xdb, 0x64, 0x84, 0xb0, 0xd3, 0x08,
+    0x86, 0xa4, 0xc4, 0x26, 0x83, 0x1a, 0xea, 0x08,
+    0x0a, 0x92, 0x49, 0x4c, 0x41, 0x2d, 0x50, 0x7c,
+    0x5c, 0x83, 0x71, 0xe6, 0x45, 0xce, 0x66, 0xf9,
+    0x54, 0xa2, 0xd3, 0xa4, 0x50, 0xff, 0xbd, 0x0e,
+    0x6c, 0xd7, 0xd5, 0x7b, 0x56, 0x3b, 0x5d, 0x60,
+    0x54, 0x52, 0x4a, 0x15, 0x74, 0xdd, 0xdc, 0x62,
+    0x85, 0xa2, 0xdd, 0x1f, 0x00, 0x22, 0x87, 0x22,
+    0xb9, 0xa1, 0xa5, 0x9d, 0x25, 0xab, 0x2f, 0x4a,
+    0x2e, 0x7d, 0x85, 0x3c, 0x30, 0xd6, 0x2c, 0xe1,
+    0x3f, 0xde, 0x12, 0xa1, 0x27, 0x0e, 0xd3, 0x61,
+    0x46, 0x1b, 0x6f, 0xad, 0x4b, 0xc6, 0xda, 0xd5,
+    0x80, 0xe2, 0x3c, 0x52, 0xa8, 0x85, 0xfd, 0x75
+};
+
+
+/* n */
+uint8_t rsa3072N[384] =
+{
+    0xbe, 0xc6, 0x5a, 0xc2, 0x4b, 0x32, 0xeb, 0xae,
+    0x70, 0xde, 0x6d, 0x9d, 0x10, 0xbd, 0xbb, 0x89,
+    0x83, 0x79, 0x52, 0xaf, 0x3c, 0x6f, 0x83, 0x41,
+    0xc8, 0xb5, 0x2f, 0xd9, 0xf7, 0xc8, 0x5f, 0xbb,
+    0x6c, 0x8a, 0x35, 0xc9, 0x6f, 0x4c, 0x60, 0x97,
+    0x91, 0x9f, 0x19, 0x39, 0xb7, 0xe6, 0xde, 0x03,
+    0x4f, 0xb7, 0x72, 0xa6, 0xdb, 0x12, 0x3b, 0x6b,
+    0xae, 0xc2, 0x35, 0xd8, 0x1b, 0xf0, 0xd6, 0x79,
+    0xca, 0xba, 0xf9, 0x27, 0xaf, 0x9c, 0x6c, 0x42,
+    0xa6, 0x5e, 0x24, 0x48, 0xf6, 0xb4, 0xc8, 0x46,
+    0xc3, 0xde, 0x6e, 0xe3, 0x6b, 0x12, 0x1d, 0xe3,
+    0x37, 0xfe, 0x2d, 0x57, 0x20, 0x97, 0x7b, 0x59,
+    0xba, 0x5d, 0x45, 0x29, 0x43, 0x84, 0x04, 0x6c,
+    0x27, 0x69, 0xb9, 0x8d, 0xed, 0x90, 0x62, 0xb1,
+    0x62, 0x69, 0x02, 0x23, 0x78, 0xf9, 0x2a, 0x54,
+    0x86, 0x4f, 0xab, 0x08, 0x93, 0x4b, 0xc3, 0x6f,
+    0x58, 0x26, 0x5e, 0xd8, 0x9d, 0x26, 0x35, 0xcd,
+    0xa2, 0x32, 0x2a, 0x89, 0xd6, 0x68, 0xcd, 0xe5,
+    0x98, 0xac, 0x5c, 0x9e, 0xd4, 0xd1, 0x65, 0xb3,
+    0x18, 0xe4, 0xc9, 0x46, 0xd6, 0x9a, 0xde, 0xc3,
+    0xdd, 0x1e, 0x86, 0x88, 0x16, 0x68, 0x44, 0xf0,
+    0x2c, 0xc9, 0x11, 0x6e, 0xc9, 0x02, 0x57, 0x6b,
+    0x80, 0x00, 0x14, 0xa7, 0x95, 0xa4, 0x2e, 0xab,
+    0x87, 0x38, 0x1d, 0xd9, 0xc1, 0x02, 0x81, 0x13,
+    0xb5, 0x88, 0x3c, 0xfe, 0xca, 0xfb, 0x2e, 0x07,
+    0x5f, 0xc1, 0x80, 0x14, 0xeb, 0x5c, 0xb8, 0x98,
+    0x21, 0x32, 0x74, 0xe7, 0xae, 0xfe, 0x1d, 0xb9,
+    0x20, 0x68, 0x9b, 0x70, 0x49, 0x4c, 0xd0, 0x64,
+    0x01, 0xc6, 0x90, 0x3f, 0x4d, 0xeb, 0x90, 0x19,
+    0x0d, 0xa9, 0xea, 0x17, 0x22, 0xd6, 0x82, 0x4e,
+    0xe2, 0x17, 0xec, 0x94, 0xff, 0x34, 0xc9, 0x6c,
+    0x16, 0xe8, 0x1c, 0xbc, 0x54, 0x9c, 0x14, 0xb7,
+    0xd5, 0x80, 0x60, 0xbe, 0xe6, 0xbd, 0x4e, 0xa6,
+    0x72, 0x14, 0x46, 0xe0, 0x2e, 0x31, 0xe1, 0x27,
+    0x85, 0x02, 0x7a, 0x6c, 0x34, 0x4c, 0x87, 0x90,
+    0xcf, 0x37, 0x2b, 0x20, 0xfe, 0xd5, 0x2f, 0xff,
+    0xb3, 0x68, 0x24, 0x05, 0xa3, 0xca, 0x7b, 0x15,
+    0xa9, 0x98, 0xa7, 0x7d, 0xd3, 0x04, 0x56, 0x2f,
+    0x35, 0x51, 0x5e, 0xec, 0xb6, 0xf7, 0xdb, 0xa8,
+    0xea, 0x05, 0xd1, 0x5e, 0x60, 0x3d, 0x1e, 0x51,
+    0xd9, 0xb2, 0x5b, 0x48, 0x2b, 0x5a, 0xbd, 0x0f,
+    0x94, 0x96, 0x28, 0xf5, 0xec, 0x93, 0xa5, 0x10,
+    0xf7, 0x17, 0x64, 0x11, 0xb2, 0x22, 0xb4, 0xb8,
+    0xe5, 0x44, 0x8f, 0xf3, 0xc6, 0x55, 0x86, 0x26,
+    0xcc, 0x3e, 0x80, 0xa8, 0x58, 0x27, 0xa6, 0xff,
+    0xef, 0x19, 0xf5, 0xb6, 0xa8, 0x35, 0x51, 0x9b,
+    0x56, 0xae, 0x24, 0xe8, 0x02, 0xea, 0xe5, 0xde,
+    0x93, 0xa2, 0x7c, 0x5e, 0xf3, 0x06, 0x23, 0x19
+};
+
+/* d */
+uint8_t rsa3072D[384] =
+{
+    0x00, 0xba, 0x9b, 0x54, 0xa2, 0x8a, 0xe2, 0xed,
+    0x53, 0xef, 0xf8, 0x34, 0xb7, 0x0e, 0x24, 0x88,
+    0xec, 0xc7, 0xa9, 0x20, 0x57, 0xf6, 0x5c, 0x9d,
+    0x9e, 0x64, 0x8b, 0xd6, 0x99, 0x88, 0x0a, 0x7c,
+    0x50, 0xb8, 0xa8, 0x8a, 0xeb, 0x1e, 0x80, 0xe4,
+    0xe8, 0x82, 0x1f, 0x86, 0xff, 0x7c, 0x03, 0x80,
+    0xc2, 0x57, 0xe0, 0xb0, 0x49, 0xea, 0xbf, 0xdd,
+    0x0d, 0x6a, 0x1f, 0x72, 0xcb, 0xb5, 0xd2, 0x19,
+    0xf8, 0xec, 0x99, 0x80, 0xa6, 0xba, 0x49, 0x4c,
+    0x40, 0xd3, 0x4d, 0xb9, 0xa7, 0x49, 0xcf, 0x27,
+    0x73, 0xa3, 0x2d, 0x2b, 0xe5, 0xe3, 0x7e, 0xeb,
+    0xfd, 0x3f, 0x27, 0xf8, 0x5f, 0x73, 0x86, 0x70,
+    0x01, 0xd9, 0x69, 0xc7, 0x01, 0x7f, 0x04, 0x95,
+    0xce, 0xd9, 0xac, 0x4c, 0x62, 0x3a, 0x30, 0xa1,
+    0x7d, 0xb3, 0xc0, 0xb1, 0x2d, 0xaf, 0x3e, 0x2f,
+    0x00, 0x9a, 0x4e, 0x13, 0x70, 0xd4, 0x7f, 0x15,
+    0x30, 0x7d, 0xc4, 0x9c, 0xe6, 0x73, 0x3f, 0x1f,
+    0x46, 0x5c, 0x6e, 0xf5, 0xb6, 0x42, 0xdb, 0x01,
+    0x42, 0xa1, 0xd8, 0xf7, 0x64, 0xc1, 0x19, 0x6d,
+    0xa5, 0xcf, 0xef, 0x43, 0xbb, 0xb9, 0x38, 0xcd,
+    0x12, 0x89, 0x4e, 0xf2, 0x9b, 0x7d, 0x74, 0x1c,
+    0x1f, 0x52, 0x41, 0xb6, 0xc7, 0x10, 0x2a, 0x11,
+    0x06, 0x88, 0x69, 0x8b, 0xca, 0x98, 0x07, 0x7c,
+    0x68, 0x55, 0x3c, 0x01, 0x40, 0x0c, 0x62, 0x86,
+    0xb0, 0x51, 0x7b, 0x62, 0xf0, 0xd2, 0x8c, 0x59,
+    0xee, 0x40, 0x23, 0x9a, 0x84, 0x1a, 0xc7, 0x03,
+    0x59, 0x20, 0x81, 0x33, 0xe9, 0x02, 0xb5, 0x27,
+    0xa9, 0xb3, 0xf7, 0x78, 0xb9, 0xbc, 0x7a, 0x46,
+    0x67, 0x5f, 0x52, 0x97, 0xb3, 0xd1, 0x68, 0x0e,
+    0x5a, 0x8d, 0x3a, 0xb2, 0xd3, 0x87, 0x45, 0x25,
+    0x7f, 0x3a, 0x2e, 0x0e, 0x0a, 0x9d, 0xb0, 0x15,
+    0xeb, 0x36, 0x18, 0x0b, 0x80, 0xa0, 0x41, 0xe9,
+    0xd2, 0x4c, 0x57, 0xf2, 0xf2, 0x3f, 0x65, 0x7e,
+    0xd9, 0xfb, 0x91, 0x73, 0x3b, 0x8c, 0xbd, 0x12,
+    0xc3, 0xbd, 0x53, 0x02, 0x37, 0xf9, 0x76, 0xf3,
+    0x98, 0x19, 0x8f, 0x2d, 0xd5, 0x31, 0xe8, 0xfa,
+    0x16, 0xd8, 0x68, 0x5c, 0x11, 0x59, 0xe4, 0x06,
+    0xe9, 0x46, 0xd3, 0x73, 0xf2, 0x2a, 0x47, 0x65,
+    0x25, 0x6f, 0x4e, 0xab, 0x62, 0x8d, 0x71, 0x13,
+    0x8f, 0x47, 0xe5, 0xd6, 0x4d, 0x56, 0x7f, 0x9e,
+    0x90, 0x21, 0x0c, 0x20, 0x9a, 0xc1, 0xa0, 0x82,
+    0xb4, 0xda, 0x9f, 0x3a, 0x54, 0x0a, 0x06, 0x48,
+    0x2e, 0xd9, 0xd6, 0x47, 0x67, 0x67, 0x65, 0x31,
+    0xfb, 0xa7, 0xd5, 0x40, 0x91, 0x78, 0x4b, 0x92,
+    0x2e, 0x26, 0x9e, 0x6f, 0xdd, 0xca, 0xe6, 0xef,
+    0xbb, 0x91, 0x41, 0x53, 0xaf, 0x73, 0x7e, 0xda,
+    0x2f, 0x43, 0xa0, 0x66, 0x74, 0xc2, 0xd8, 0x65,
+    0x01, 0xd5, 0x08, 0x4a, 0x87, 0x35, 0xb6, 0x61
+};
+
+/* p */
+uint8_t rsa3072P[192] =
+{
+    0xfa, 0xa9, 0xb7, 0x49, 0xbc, 0x96, 0xaf, 0x4b,
+    0x0f, 0x94, 0xde, 0xd9, 0x84, 0x7f, 0x85, 0xaf,
+    0xa9, 0xf2, 0x1d, 0xd1, 0x46, 0x60, 0x78, 0x4d,
+    0xc1, 0x6b, 0x1f, 0x81, 0xd3, 0x2b, 0x56, 0x35,
+    0x32, 0x07, 0x0b, 0x61, 0xc5, 0xaa, 0x10, 0x45,
+    0x9c, 0x42, 0x94, 0xeb, 0x9e, 0xe0, 0xe9, 0xdc,
+    0x76, 0x11, 0x48, 0xbf, 0x40, 0x9f, 0x4c, 0x26,
+    0x1e, 0x19, 0x32, 0xa9, 0x42, 0x9a, 0x20, 0xbe,
+    0x99, 0x5b, 0x5c, 0xca, 0xce, 0x05, 0xe2, 0x8a,
+    0xf5, 0x46, 0x1c, 0x9a, 0x24, 0x08, 0xbb, 0xe3,
+    0x9f, 0xd9, 0x4b, 0xca, 0xe0, 0x98, 0x99, 0xca,
+    0x3e, 0x2f, 0xc4, 0x23, 0x6e, 0x45, 0x78, 0x87,
+    0xcc, 0x4a, 0xea, 0xf9, 0x69, 0xcf, 0x37, 0x24,
+    0x9c, 0x65, 0x62, 0x8c, 0x14, 0x2d, 0x8d, 0xa5,
+    0xb8, 0x22, 0xda, 0xe5, 0xd5, 0xe1, 0x95, 0x2e,
+    0xcf, 0x25, 0x58, 0x8e, 0xd3, 0x14, 0xe4, 0x3b,
+    0xb9, 0x2b, 0x8b, 0xae, 0x8a, 0x1e, 0x8c, 0x85,
+    0xf1, 0x7a, 0x50, 0x52, 0x64, 0x21, 0x57, 0xc4,
+    0x19, 0x7b, 0x1d, 0x9f, 0x8c, 0xe2, 0x72, 0x83,
+    0x6e, 0x41, 0x95, 0xac, 0x36, 0xb4, 0x7e, 0x93,
+    0x88, 0x18, 0xf4, 0xee, 0x08, 0x19, 0x5e, 0x8f,
+    0x1f, 0xe5, 0x9e, 0x68, 0x80, 0x50, 0x9e, 0xfc,
+    0xfa, 0xd4, 0xff, 0x54, 0x4b, 0xf9, 0xa3, 0xf0,
+    0xad, 0xfe, 0x4b, 0x2f, 0x39, 0x41, 0x0b, 0xa1
+};
+
+/* q */
+uint8_t rsa3072Q[192] =
+{
+    0xc2, 0xd6, 0x35, 0x18, 0x92, 0xd9, 0x5f, 0x85,
+    0x88, 0x7e, 0xb5, 0xeb, 0xe7, 0x85, 0xc2, 0xed,
+    0x49, 0xc7, 0xdc, 0xb7, 0x14, 0x06, 0xaf, 0x48,
+    0x35, 0xb0, 0xe7, 0xca, 0x65, 0x0e, 0x05, 0xff,
+    0x32, 0x2b, 0xaa, 0x4c, 0xed, 0xc6, 0x2e, 0xd0,
+    0x9c, 0xdb, 0xd2, 0x7e, 0x54, 0x28, 0x9b, 0x13,
+    0x9a, 0x61, 0x02, 0x6d, 0xc9, 0x3a, 0xdc, 0xd7,
+    0xb2, 0x25, 0x46, 0x9b, 0x02, 0xa0, 0x4c, 0xa6,
+    0xf5, 0x8b, 0x98, 0xe1, 0x25, 0x99, 0xfb, 0x99,
+    0x74, 0xbe, 0xd3, 0x73, 0xc5, 0x38, 0x56, 0x18,
+    0x95, 0x46, 0x35, 0xe8, 0x28, 0x7c, 0x99, 0x2c,
+    0x5c, 0xd7, 0xdf, 0x13, 0xd1, 0xc7, 0x33, 0xe1,
+    0xbf, 0xa6, 0x01, 0x15, 0x23, 0x8d, 0x16, 0xc2,
+    0xa5, 0x3a, 0x8e, 0x54, 0x01, 0x3e, 0x15, 0xed,
+    0x36, 0x1a, 0xdb, 0x75, 0x30, 0xd2, 0x98, 0xeb,
+    0x1b, 0x98, 0x83, 0xda, 0x16, 0xae, 0x36, 0x7b,
+    0x5f, 0xf6, 0x41, 0x6a, 0x52, 0x01, 0x84, 0x43,
+    0xac, 0x72, 0xd2, 0xf9, 0xc1, 0x71, 0xfd, 0xee,
+    0x67, 0x09, 0x8c, 0x89, 0xf2, 0x57, 0x1a, 0xcf,
+    0x41, 0xed, 0xf3, 0x34, 0xbb, 0x3c, 0x4a, 0x08,
+    0x6c, 0x75, 0xb5, 0x4a, 0xf9, 0x44, 0x78, 0x18,
+    0xaa, 0xb4, 0x96, 0x05, 0x0c, 0xab, 0xf5, 0x86,
+    0x32, 0x6b, 0x0f, 0x9f, 0x45, 0x15, 0x6d, 0x61,
+    0xf8, 0xf3, 0xb7, 0x3f, 0xd3, 0x85, 0x24, 0x79
+};
+
+/* dP = d mod (p - 1) */
+uint8_t rsa3072DP[192] =
+{
+    0x04, 0x4f, 0x7c, 0xd6, 0x68, 0xc6, 0xd2, 0x96,
+    0xe0, 0xda, 0xb7, 0x86, 0x58, 0x0f, 0xf5, 0x55,
+    0x92, 0xff, 0x95, 0xe1, 0xae, 0x6b, 0x24, 0x46,
+    0x7a, 0x08, 0x04, 0x8f, 0xaf, 0xf8, 0xf3, 0xcf,
+    0x90, 0x5f, 0xac, 0xa3, 0x6e, 0xc9, 0xc0, 0xe3,
+    0xe1, 0x8f, 0x07, 0x8e, 0x91, 0xb9, 0xde, 0x6b,
+    0xab, 0x20, 0x1a, 0xf7, 0x26, 0xfe, 0x56, 0x49,
+    0xe5, 0x84, 0x9b, 0x69, 0x6b, 0xba, 0xc8, 0xcb,
+    0x5e, 0x49, 0xc2, 0xeb, 0xbd, 0xe5, 0x3e, 0x03,
+    0x13, 0xba, 0xb3, 0xed, 0x36, 0xa7, 0x6b, 0xcb,
+    0xbb, 0x48, 0xfa, 0x53, 0xaf, 0xcf, 0x0f, 0xfd,
+    0xf9, 0x59, 0xca, 0xee, 0xad, 0x0b, 0xc6, 0xc9,
+    0xd7, 0x0a, 0x86, 0xc5, 0xe9, 0x3a, 0xe6, 0x00,
+    0xdc, 0x2b, 0xa6, 0x29, 0x30, 0x83, 0xa4, 0x06,
+    0xf0, 0x86, 0xb0, 0xea, 0xf8, 0xe5, 0x9b, 0x32,
+    0x25, 0xdf, 0xc7, 0x89, 0x15, 0x3a, 0x2b, 0xbe,
+    0x97, 0x2d, 0x97, 0x86, 0x55, 0xdb, 0xb6, 0xa0,
+    0xeb, 0x09, 0x26, 0x6e, 0x74, 0x48, 0x5a, 0x81,
+    0x05, 0xcb, 0x27, 0x34, 0x42, 0x30, 0xf6, 0xb5,
+    0x29, 0xe5, 0x38, 0xd4, 0xb0, 0x50, 0x24, 0x49,
+    0x17, 0x33, 0x0e, 0xab, 0x35, 0x3a, 0x72, 0x74,
+    0xd5, 0xa0, 0x96, 0x3b, 0xc7, 0xd1, 0x1b, 0x1a,
+    0xd0, 0x99, 0x6f, 0x16, 0x9d, 0x03, 0xda, 0xfc,
+    0xdd, 0x91, 0x1c, 0xeb, 0xdf, 0xf9, 0x2d, 0x61
+};
+
+/* dQ = d mod (q - 1) */
+uint8_t rsa3072DQ[192] =
+{
+    0x62, 0x1e, 0x55, 0xe6, 0xe6, 0x2d, 0x29, 0xf9,
+    0xa9, 0x5f, 0x86, 0x66, 0x22, 0xd6, 0x2d, 0xf0,
+    0x29, 0xb3, 0xc8, 0xe7, 0x39, 0xe2, 0x93, 0xeb,
+    0x1d, 0x7e, 0xd5, 0x7c, 0x0b, 0xa0, 0x20, 0x4d,
+    0x00, 0x0b, 0x15, 0x5c, 0x60, 0x71, 0xe9, 0xa9,
+    0x8d, 0x14, 0xf6, 0xd0, 0x3f, 0xb9, 0xa3, 0x3f,
+    0x20, 0x03, 0xb2, 0xa1, 0x6f, 0x31, 0x81, 0x7d,
+    0xee, 0x6c, 0xef, 0x3d, 0xa8, 0xf8, 0xe9, 0x21,
+    0x3b, 0x8e, 0xed, 0x92, 0x94, 0xc9, 0x12, 0xf7,
+    0x98, 0xdf, 0x70, 0xc5, 0x60, 0x90, 0x9a, 0x6b,
+    0x0e, 0xe1, 0xa8, 0xcc, 0x1d, 0x77, 0x81, 0xfb,
+    0xe1, 0x55, 0xa5, 0x35, 0xe9, 0xf3, 0x13, 0xa1,
+    0xa0, 0x4e, 0x0d, 0x45, 0x83, 0xfd, 0xcd, 0x74,
+    0x80, 0x99, 0x18, 0x8c, 0x1d, 0x84, 0x12, 0xae,
+    0xbf, 0x0c, 0x8f, 0x70, 0x59, 0x01, 0xf5, 0x98,
+    0x90, 0xf1, 0x21, 0x95, 0x76, 0xce, 0x8d, 0x09,
+    0x5c, 0xae, 0x3b, 0x0b, 0x3b, 0xf9, 0x1f, 0x8e,
+    0xa5, 0x0d, 0xbe, 0x49, 0xa0, 0xad, 0xb3, 0x5f,
+    0x97, 0xec, 0x2b, 0x26, 0x5d, 0x30, 0x98, 0x83,
+    0xbf, 0x84, 0x01, 0x72, 0x90, 0xc8, 0x2f, 0xd0,
+    0x46, 0x2e, 0x90, 0xfa, 0x0c, 0xc5, 0xfa, 0x65,
+    0x11, 0xb2, 0x97, 0xca, 0x3b, 0x33, 0x6e, 0x16,
+    0x02, 0xd5, 0xff, 0xac, 0x09, 0xb2, 0x5c, 0xbf,
+    0x76, 0x0b, 0xe6, 0x40, 0xf2, 0x58, 0x9e, 0xa1
+};
+
+/* qInv = q^-1 mod p */
+uint8_t rsa3072QInv[192] =
+{
+    0xf1, 0xea, 0xf1, 0x59, 0x65, 0x2c, 0x30, 0x48,
+    0xbe, 0x89, 0xb2, 0x2f, 0x87, 0xc7, 0xf8, 0xfd,
+    0x66, 0xdb, 0x86, 0x16, 0x2c, 0xb2, 0xe7, 0xb9,
+    0x13, 0xeb, 0x7e, 0xbf, 0x35, 0x61, 0x5a, 0x46,
+    0x1a, 0x7d, 0xa0, 0x4a, 0xe6, 0x64, 0x56, 0xb0,
+    0x9b, 0xbf, 0x64, 0x12, 0x65, 0x1d, 0x4a, 0x40,
+    0x1b, 0x05, 0x58, 0x83, 0x6e, 0xce, 0xad, 0x47,
+    0x8b, 0xf8, 0x53, 0x9d, 0xad, 0x16, 0x5c, 0xec,
+    0x66, 0x32, 0xa9, 0x01, 0xac, 0x7b, 0xc6, 0x79,
+    0x0d, 0xb0, 0xb6, 0x07, 0x77, 0xa8, 0xe7, 0xf4,
+    0xb6, 0x9d, 0xbc, 0x05, 0x47, 0x92, 0xa4, 0x5d,
+    0xb0, 0x5f, 0xb3, 0x12, 0x99, 0xee, 0xe2, 0x83,
+    0x67, 0x57, 0x9c, 0x2d, 0xc2, 0xfc, 0x18, 0x61,
+    0x99, 0xa6, 0xc8, 0xe5, 0x31, 0xe1, 0x71, 0xce,
+    0x9a, 0x92, 0x6c, 0x62, 0x2a, 0x86, 0xab, 0xfa,
+    0x50, 0x1a, 0x35, 0xcb, 0xb0, 0x49, 0xac, 0x44,
+    0x85, 0x19, 0x35, 0xc3, 0x85, 0x22, 0xbf, 0xd1,
+    0x0f, 0x76, 0x71, 0xf9, 0xbe, 0x96, 0x70, 0x02,
+    0x3d, 0x02, 0xac, 0xc1, 0xaa, 0xc2, 0xd0, 0xcc,
+    0xe2, 0xab, 0xc7, 0xe0, 0x68, 0xac, 0x01, 0xa8,
+    0xae, 0xdc, 0x2c, 0x1a, 0x49, 0x0f, 0x31, 0x07,
+    0x67, 0x01, 0x73, 0xcc, 0xa2, 0xc0, 0x39, 0xc5,
+    0xd1, 0x01, 0x85, 0xeb, 0xb7, 0xf4, 0x3f, 0xe6,
+    0x72, 0x18, 0x68, 0x88, 0x83, 0xc9, 0x53, 0x30
+};
+
+// *****************************************************************************
+/* Binary Curve Test Vectors
+
+  Summary:
+    Public keys and signatures of msg on K-233, B-233, K-283 and B-283.
+
+  Description:
+    The signatures were computed offline with a fixed private key and nonce
+    per curve, the hash is truncated to the bit length of the order as in
+    FIPS 186-4. They only serve the binary curve tests.
+*/
+
+//04 + qx + qy, K-233
+uint8_t pubKeyECDSAK233[61] =
+{
+    0x04, 0x00, 0x0a, 0x39, 0xc3, 0xfc, 0x0f, 0x73,
+    0x64, 0x9c, 0xb5, 0x63, 0xdc, 0x5f, 0x14, 0x06,
+    0xab, 0x2d, 0x4d, 0x6d, 0x60, 0xbc, 0x86, 0x7d,
+    0xd4, 0x68, 0xcb, 0x5f, 0x95, 0x14, 0x7e, 0x01,
+    0xe0, 0x07, 0x33, 0xe7, 0x78, 0xdd, 0x16, 0x74,
+    0x43, 0xc1, 0x0c, 0x52, 0x11, 0xa7, 0x6c, 0x7f,
+    0xaf, 0xec, 0x8a, 0x36, 0x93, 0xbd, 0x25, 0x77,
+    0xd4, 0x6d, 0xdf, 0x17, 0x28
+};
+
+//r + s over msg, K-233
+uint8_t sigECDSAK233[60] =
+{
+    0x00, 0x1c, 0x2a, 0x78, 0xb0, 0xa3, 0x50, 0x57,
+    0x2e, 0xa5, 0xca, 0x04, 0xcc, 0xc2, 0x0f, 0x1a,
+    0xae, 0xb3, 0x05, 0xf3, 0x58, 0x7d, 0xc6, 0x3d,
+    0x3b, 0xd0, 0xc2, 0xe5, 0x4e, 0xce, 0x00, 0x1e,
+    0x59, 0x2a, 0x17, 0x5d, 0xf1, 0x28, 0x34, 0x4e,
+    0xcb, 0x76, 0xfb, 0x94, 0xf2, 0xb6, 0xfd, 0xcd,
+    0x55, 0x3c, 0x37, 0xa4, 0x55, 0xc0, 0x56, 0xb9,
+    0xc8, 0xec, 0x50, 0xf0
+};
+
+//04 + qx + qy, B-233
+uint8_t pubKeyECDSAB233[61] =
+{
+    0x04, 0x01, 0x5b, 0x54, 0xc4, 0xda, 0x19, 0x0d,
+    0x3e, 0x4e, 0xcf, 0x7b, 0xcc, 0x55, 0x7f, 0x4e,
+    0x38, 0x33, 0xfd, 0xc5, 0x27, 0x9c, 0x73, 0xea,
+    0xfd, 0xc7, 0x36, 0xa8, 0xb3, 0xa4, 0xa5, 0x00,
+    0xc3, 0xd9, 0x7f, 0x4f, 0xf9, 0xb4, 0x17, 0xf4,
+    0x13, 0xbe, 0xe6, 0x53, 0x55, 0xf7, 0x07, 0x66,
+    0x4d, 0xfb, 0x6c, 0x5f, 0x10, 0x65, 0x12, 0x00,
+    0x6e, 0x77, 0x69, 0x0a, 0x66
+};
+
+//r + s over msg, B-233
+uint8_t sigECDSAB233[60] =
+{
+    0x00, 0x48, 0x85, 0xc0, 0x9a, 0x5d, 0xdd, 0x23,
+    0x58, 0xd5, 0xea, 0x7c, 0x74, 0x1e, 0xae, 0x0a,
+    0xfc, 0xe0, 0x69, 0x91, 0xf3, 0xd7, 0xee, 0xda,
+    0x16, 0x6d, 0x58, 0x3c, 0x08, 0x85, 0x00, 0x9f,
+    0x47, 0x8f, 0x39, 0x92, 0x8a, 0x3c, 0x32, 0x9f,
+    0x58, 0x18, 0x66, 0x6d, 0x7a, 0x15, 0x3b, 0xda,
+    0xa8, 0xcd, 0xcf, 0x62, 0xe0, 0x0e, 0x1d, 0xf8,
+    0xe0, 0x56, 0xd2, 0xc2
+};
+
+//04 + qx + qy, K-283
+uint8_t pubKeyECDSAK283[73] =
+{
+    0x04, 0x03, 0x0d, 0x9a, 0x1a, 0x0c, 0x77, 0x9e,
+    0x9a, 0xab, 0x01, 0x16, 0x64, 0x5e, 0xdb, 0xdd,
+    0xcd, 0x69, 0x92, 0xb3, 0x05, 0x64, 0xcc, 0x44,
+    0xa0, 0x6f, 0x5f, 0x7b, 0x36, 0xb5, 0x8f, 0x2f,
+    0x4f, 0x5c, 0xbb, 0x85, 0x6b, 0x04, 0xcc, 0xd2,
+    0xf8, 0x30, 0x69, 0x01, 0x76, 0x06, 0x45, 0x9c,
+    0xd7, 0x37, 0x9b, 0x97, 0x91, 0xc2, 0xe9, 0x28,
+    0xf8, 0x9c, 0x4a, 0x4b, 0xd8, 0xfa, 0x55, 0x88,
+    0xc6, 0xda, 0x77, 0x8d, 0xc8, 0xd0, 0x58, 0x7f,
+    0xf8
+};
+
+//r + s over msg, K-283
+uint8_t sigECDSAK283[72] =
+{
+    0x00, 0xa3, 0x8b, 0xff, 0xbb, 0x47, 0x51, 0x4c,
+    0xb6, 0x0d, 0xb9, 0xee, 0x86, 0xc1, 0xd1, 0xc7,
+    0x67, 0x01, 0x44, 0xc3, 0x44, 0xd3, 0xc1, 0x2a,
+    0x08, 0xd6, 0x87, 0xfe, 0x45, 0x98, 0x39, 0x12,
+    0x6e, 0x60, 0x17, 0x59, 0x01, 0x86, 0x62, 0x9f,
+    0xf6, 0xd0, 0xfa, 0x2c, 0x6d, 0x47, 0x09, 0xfc,
+    0x49, 0x5a, 0x29, 0x71, 0x0c, 0xa3, 0xdf, 0xa5,
+    0xa0, 0x3b, 0x34, 0x9f, 0x97, 0x59, 0x00, 0x47,
+    0x0b, 0x88, 0x05, 0x95, 0xef, 0x4d, 0xa2, 0x98
+};
+
+//04 + qx + qy, B-283
+uint8_t pubKeyECDSAB283[73] =
+{
+    0x04, 0x02, 0x9a, 0x03, 0x30, 0xe0, 0xf2, 0x37,
+    0x36, 0x21, 0xa3, 0x54, 0x7f, 0x9e, 0x46, 0x7e,
+    0x6f, 0x13, 0x3e, 0x2b, 0xb4, 0xe2, 0x46, 0x49,
+    0x9e, 0x00, 0x03, 0x21, 0x67, 0x95, 0x17, 0x58,
+    0x7a, 0x52, 0xde, 0x4c, 0x3b, 0x00, 0x79, 0xcd,
+    0xda, 0xee, 0x3b, 0xb3, 0x81, 0xd1, 0xa1, 0x17,
+    0x5d, 0xf2, 0x15, 0x8d, 0x63, 0xcc, 0x1d, 0x7a,
+    0xb9, 0x1b, 0x8e, 0x20, 0x87, 0x52, 0xc7, 0x5e,
+    0x5a, 0x47, 0xd6, 0x3c, 0x9f, 0x37, 0xda, 0x10,
+    0xa4
+};
+
+//r + s over msg, B-283
+uint8_t sigECDSAB283[72] =
+{
+    0x02, 0xc3, 0x77, 0x86, 0xa7, 0x4a, 0xee, 0x98,
+    0x8b, 0x31, 0x25, 0x0d, 0x85, 0xa8, 0x0e, 0x2d,
+    0x85, 0x9a, 0x75, 0x53, 0x2e, 0x18, 0x16, 0x67,
+    0x39, 0xd1, 0x6c, 0x45, 0x83, 0x15, 0x8e, 0x5a,
+    0xac, 0x99, 0x08, 0x90, 0x02, 0x7e, 0xcb, 0xfc,
+    0x3f, 0xa3, 0xda, 0x22, 0x86, 0x75, 0xc2, 0x74,
+    0x38, 0x0a, 0xf1, 0x94, 0xc3, 0xa8, 0xd7, 0xbe,
+    0x77, 0x77, 0x1e, 0xa4, 0x26, 0xa9, 0x53, 0x69,
+    0xde, 0x66, 0xa2, 0xcc, 0x69, 0x51, 0xdf, 0xfa
+};
+
+// *****************************************************************************
+/* Custom Curve Parameters
+
+  Summary:
+    brainpoolP256r1 supplied as a custom curve.
+
+  Description:
+    LSB first with 4 bytes of padding, the layout the CPKCC takes. The same
+    curve is built in, so the signatures made on the custom curve are checked
+    by wolfCrypt on brainpoolP256r1.
+*/
+
+/* p */
+const uint8_t customP[36] =
+{
+    0x77, 0x53, 0x6e, 0x1f, 0x1d, 0x48, 0x13, 0x20,
+    0x28, 0x20, 0x26, 0xd5, 0x23, 0xf6, 0x3b, 0x6e,
+    0x72, 0x8d, 0x83, 0x9d, 0x90, 0x0a, 0x66, 0x3e,
+    0xbc, 0xa9, 0xee, 0xa1, 0xdb, 0x57, 0xfb, 0xa9,
+    0x00, 0x00, 0x00, 0x00
+};
+
+/* a */
+const uint8_t customA[36] =
+{
+    0xd9, 0xb5, 0x30, 0xf3, 0x44, 0x4b, 0x4a, 0xe9,
+    0x6c, 0x5c, 0xdc, 0x26, 0xc1, 0x55, 0x80, 0xfb,
+    0xe7, 0xff, 0x7a, 0x41, 0x30, 0x75, 0xf6, 0xee,
+    0x57, 0x30, 0x2c, 0xfc, 0x75, 0x09, 0x5a, 0x7d,
+    0x00, 0x00, 0x00, 0x00
+};
+
+/* b */
+const uint8_t customB[36] =
+{
+    0xb6, 0x07, 0x8c, 0xff, 0x18, 0xdc, 0xcc, 0x6b,
+    0xce, 0xe1, 0xf7, 0x5c, 0x29, 0x16, 0x84, 0x95,
+    0xbf, 0x7c, 0xd7, 0xbb, 0xd9, 0xb5, 0x30, 0xf3,
+    0x44, 0x4b, 0x4a, 0xe9, 0x6c, 0x5c, 0xdc, 0x26,
+    0x00, 0x00, 0x00, 0x00
+};
+
+/* Gx */
+const uint8_t customGx[36] =
+{
+    0x62, 0x32, 0xce, 0x9a, 0xbd, 0x53, 0x44, 0x3a,
+    0xc2, 0x23, 0xbd, 0xe3, 0xe1, 0x27, 0xde, 0xb9,
+    0xaf, 0xb7, 0x81, 0xfc, 0x2f, 0x48, 0x4b, 0x2c,
+    0xcb, 0x57, 0x7e, 0xcb, 0xb9, 0xae, 0xd2, 0x8b,
+    0x00, 0x00, 0x00, 0x00
+};
+
+/* Gy */
+const uint8_t customGy[36] =
+{
+    0x97, 0x69, 0x04, 0x2f, 0xc7, 0x54, 0x1d, 0x5c,
+    0x54, 0x8e, 0xed, 0x2d, 0x13, 0x45, 0x77, 0xc2,
+    0xc9, 0x1d, 0x61, 0x14, 0x1a, 0x46, 0xf8, 0x97,
+    0xfd, 0xc4, 0xda, 0xc3, 0x35, 0xf8, 0x7e, 0x54,
+    0x00, 0x00, 0x00, 0x00
+};
+
+/* n */
+const uint8_t customN[36] =
+{
+    0xa7, 0x56, 0x48, 0x97, 0x82, 0x0e, 0x1e, 0x90,
+    0xf7, 0xa6, 0x61, 0xb5, 0xa3, 0x7a, 0x39, 0x8c,
+    0x71, 0x8d, 0x83, 0x9d, 0x90, 0x0a, 0x66, 0x3e,
+    0xbc, 0xa9, 0xee, 0xa1, 0xdb, 0x57, 0xfb, 0xa9,
+    0x00, 0x00, 0x00, 0x00
+};
+
+/* Cns = floor(2^(16*32 + 32) / p) */
+const uint8_t customCns[40] =
+{
+    0x94, 0x7c, 0x11, 0x6b, 0x0c, 0xdd, 0x80, 0x11,
+    0x30, 0xe6, 0x2a, 0xb6, 0xa9, 0x2f, 0x6a, 0xff,
+    0xa0, 0x54, 0x4f, 0x9b, 0xf2, 0x7b, 0x2a, 0x32,
+    0xa8, 0xab, 0x73, 0xbb, 0x7e, 0x5b, 0xc5, 0xa1,
+    0x31, 0x11, 0x8c, 0x81, 0x01, 0x00, 0x00, 0x00
+};
+
+// *****************************************************************************
+/* RFC 6979 Test Vectors
+
+  Summary:
+    Deterministic ECDSA signatures of "sample" from RFC 6979 appendix A.2.
+
+  Description:
+    The key pairs of A.2.5 (P-256) and A.2.6 (P-384) and their signatures of
+    the message "sample" with SHA-256 and SHA-384. The nonce only depends on
+    the key and the hash, both handlers must give these exact signatures.
+    RFC 6979 has no Brainpool vector: the brainpoolP256r1 one signs "sample"
+    with SHA-256 with the key pair of RFC 7027 A.1, its first candidate for k
+    is above n and step h. draws a second one. It was computed with an
+    independent implementation of RFC 6979 section 3.2.
+*/
+
+//x, P-256
+uint8_t rfc6979PrivKey256[32] =
+{
+    0xc9, 0xaf, 0xa9, 0xd8, 0x45, 0xba, 0x75, 0x16,
+    0x6b, 0x5c, 0x21, 0x57, 0x67, 0xb1, 0xd6, 0x93,
+    0x4e, 0x50, 0xc3, 0xdb, 0x36, 0xe8, 0x9b, 0x12,
+    0x7b, 0x8a, 0x62, 0x2b, 0x12, 0x0f, 0x67, 0x21
+};
+
+//04 + Ux + Uy, P-256
+uint8_t rfc6979PubKey256[65] =
+{
+    0x04, 0x60, 0xfe, 0xd4, 0xba, 0x25, 0x5a, 0x9d,
+    0x31, 0xc9, 0x61, 0xeb, 0x74, 0xc6, 0x35, 0x6d,
+    0x68, 0xc0, 0x49, 0xb8, 0x92, 0x3b, 0x61, 0xfa,
+    0x6c, 0xe6, 0x69, 0x62, 0x2e, 0x60, 0xf2, 0x9f,
+    0xb6, 0x79, 0x03, 0xfe, 0x10, 0x08, 0xb8, 0xbc,
+    0x99, 0xa4, 0x1a, 0xe9, 0xe9, 0x56, 0x28, 0xbc,
+    0x64, 0xf2, 0xf1, 0xb2, 0x0c, 0x2d, 0x7e, 0x9f,
+    0x51, 0x77, 0xa3, 0xc2, 0x94, 0xd4, 0x46, 0x22,
+    0x99
+};
+
+//SHA-256("sample")
+uint8_t rfc6979Hash256[32] =
+{
+    0xaf, 0x2b, 0xdb, 0xe1, 0xaa, 0x9b, 0x6e, 0xc1,
+    0xe2, 0xad, 0xe1, 0xd6, 0x94, 0xf4, 0x1f, 0xc7,
+    0x1a, 0x83, 0x1d, 0x02, 0x68, 0xe9, 0x89, 0x15,
+    0x62, 0x11, 0x3d, 0x8a, 0x62, 0xad, 0xd1, 0xbf
+};
+
+//r + s, P-256 with SHA-256 (A.2.5)
+uint8_t rfc6979Sig256[64] =
+{
+    0xef, 0xd4, 0x8b, 0x2a, 0xac, 0xb6, 0xa8, 0xfd,
+    0x11, 0x40, 0xdd, 0x9c, 0xd4, 0x5e, 0x81, 0xd6,
+    0x9d, 0x2c, 0x87, 0x7b, 0x56, 0xaa, 0xf9, 0x91,
+    0xc3, 0x4d, 0x0e, 0xa8, 0x4e, 0xaf, 0x37, 0x16,
+    0xf7, 0xcb, 0x1c, 0x94, 0x2d, 0x65, 0x7c, 0x41,
+    0xd4, 0x36, 0xc7, 0xa1, 0xb6, 0xe2, 0x9f, 0x65,
+    0xf3, 0xe9, 0x00, 0xdb, 0xb9, 0xaf, 0xf4, 0x06,
+    0x4d, 0xc4, 0xab, 0x2f, 0x84, 0x3a, 0xcd, 0xa8
+};
+
+//x, P-384
+uint8_t rfc6979PrivKey384[48] =
+{
+    0x6b, 0x9d, 0x3d, 0xad, 0x2e, 0x1b, 0x8c, 0x1c,
+    0x05, 0xb1, 0x98, 0x75, 0xb6, 0x65, 0x9f, 0x4d,
+    0xe2, 0x3c, 0x3b, 0x66, 0x7b, 0xf2, 0x97, 0xba,
+    0x9a, 0xa4, 0x77, 0x40, 0x78, 0x71, 0x37, 0xd8,
+    0x96, 0xd5, 0x72, 0x4e, 0x4c, 0x70, 0xa8, 0x25,
+    0xf8, 0x72, 0xc9, 0xea, 0x60, 0xd2, 0xed, 0xf5
+};
+
+//04 + Ux + Uy, P-384
+uint8_t rfc6979PubKey384[97] =
+{
+    0x04, 0xec, 0x3a, 0x4e, 0x41, 0x5b, 0x4e, 0x19,
+    0xa4, 0x56, 0x86, 0x18, 0x02, 0x9f, 0x42, 0x7f,
+    0xa5, 0xda, 0x9a, 0x8b, 0xc4, 0xae, 0x92, 0xe0,
+    0x2e, 0x06, 0xaa, 0xe5, 0x28, 0x6b, 0x30, 0x0c,
+    0x64, 0xde, 0xf8, 0xf0, 0xea, 0x90, 0x55, 0x86,
+    0x60, 0x64, 0xa2, 0x54, 0x51, 0x54, 0x80, 0xbc,
+    0x13, 0x80, 0x15, 0xd9, 0xb7, 0x2d, 0x7d, 0x57,
+    0x24, 0x4e, 0xa8, 0xef, 0x9a, 0xc0, 0xc6, 0x21,
+    0x89, 0x67, 0x08, 0xa5, 0x93, 0x67, 0xf9, 0xdf,
+    0xb9, 0xf5, 0x4c, 0xa8, 0x4b, 0x3f, 0x1c, 0x9d,
+    0xb1, 0x28, 0x8b, 0x23, 0x1c, 0x3a, 0xe0, 0xd4,
+    0xfe, 0x73, 0x44, 0xfd, 0x25, 0x33, 0x26, 0x47,
+    0x20
+};
+
+//SHA-384("sample")
+uint8_t rfc6979Hash384[48] =
+{
+    0x9a, 0x90, 0x83, 0x50, 0x5b, 0xc9, 0x22, 0x76,
+    0xae, 0xc4, 0xbe, 0x31, 0x26, 0x96, 0xef, 0x7b,
+    0xf3, 0xbf, 0x60, 0x3f, 0x4b, 0xbd, 0x38, 0x11,
+    0x96, 0xa0, 0x29, 0xf3, 0x40, 0x58, 0x53, 0x12,
+    0x31, 0x3b, 0xca, 0x4a, 0x9b, 0x5b, 0x89, 0x0e,
+    0xfe, 0xe4, 0x2c, 0x77, 0xb1, 0xee, 0x25, 0xfe
+};
+
+//r + s, P-384 with SHA-384 (A.2.6)
+uint8_t rfc6979Sig384[96] =
+{
+    0x94, 0xed, 0xbb, 0x92, 0xa5, 0xec, 0xb8, 0xaa,
+    0xd4, 0x73, 0x6e, 0x56, 0xc6, 0x91, 0x91, 0x6b,
+    0x3f, 0x88, 0x14, 0x06, 0x66, 0xce, 0x9f, 0xa7,
+    0x3d, 0x64, 0xc4, 0xea, 0x95, 0xad, 0x13, 0x3c,
+    0x81, 0xa6, 0x48, 0x15, 0x2e, 0x44, 0xac, 0xf9,
+    0x6e, 0x36, 0xdd, 0x1e, 0x80, 0xfa, 0xbe, 0x46,
+    0x99, 0xef, 0x4a, 0xeb, 0x15, 0xf1, 0x78, 0xce,
+    0xa1, 0xfe, 0x40, 0xdb, 0x26, 0x03, 0x13, 0x8f,
+    0x13, 0x0e, 0x74, 0x0a, 0x19, 0x62, 0x45, 0x26,
+    0x20, 0x3b, 0x63, 0x51, 0xd0, 0xa3, 0xa9, 0x4f,
+    0xa3, 0x29, 0xc1, 0x45, 0x78, 0x6e, 0x67, 0x9e,
+    0x7b, 0x82, 0xc7, 0x1a, 0x38, 0x62, 0x8a, 0xc8
+};
+
+//x, brainpoolP256r1
+uint8_t rfc6979PrivKeyBp256[32] =
+{
+    0x81, 0xdb, 0x1e, 0xe1, 0x00, 0x15, 0x0f, 0xf2,
+    0xea, 0x33, 0x8d, 0x70, 0x82, 0x71, 0xbe, 0x38,
+    0x30, 0x0c, 0xb5, 0x42, 0x41, 0xd7, 0x99, 0x50,
+    0xf7, 0x7b, 0x06, 0x30, 0x39, 0x80, 0x4f, 0x1d
+};
+
+//04 + Ux + Uy, brainpoolP256r1
+uint8_t rfc6979PubKeyBp256[65] =
+{
+    0x04, 0x44, 0x10, 0x6e, 0x91, 0x3f, 0x92, 0xbc,
+    0x02, 0xa1, 0x70, 0x5d, 0x99, 0x53, 0xa8, 0x41,
+    0x4d, 0xb9, 0x5e, 0x1a, 0xaa, 0x49, 0xe8, 0x1d,
+    0x9e, 0x85, 0xf9, 0x29, 0xa8, 0xe3, 0x10, 0x0b,
+    0xe5, 0x8a, 0xb4, 0x84, 0x6f, 0x11, 0xca, 0xcc,
+    0xb7, 0x3c, 0xe4, 0x9c, 0xbd, 0xd1, 0x20, 0xf5,
+    0xa9, 0x00, 0xa6, 0x9f, 0xd3, 0x2c, 0x27, 0x22,
+    0x23, 0xf7, 0x89, 0xef, 0x10, 0xeb, 0x08, 0x9b,
+    0xdc
+};
+
+//r + s, brainpoolP256r1 with SHA-256 of "sample"
+uint8_t rfc6979SigBp256[64] =
+{
+    0x8a, 0x6b, 0x3a, 0x1a, 0x10, 0xa8, 0xce, 0x14,
+    0x59, 0xcd, 0xee, 0xd0, 0xcb, 0x18, 0x84, 0x59,
+    0x76, 0x42, 0xe6, 0xbc, 0x47, 0xb9, 0xc5, 0x52,
+    0xea, 0x61, 0x14, 0xa0, 0xd0, 0x3c, 0x40, 0xdd,
+    0x46, 0x6c, 0x80, 0xb9, 0x01, 0x17, 0x4c, 0x93,
+    0x36, 0x9e, 0x57, 0x36, 0xa6, 0x99, 0x3c, 0x08,
+    0x10, 0x87, 0x04, 0x0f, 0x5c, 0x70, 0x39, 0xf3,
+    0x14, 0xe0, 0x2a, 0x28, 0x53, 0xd6, 0xf8, 0x7f
+};
+
+/* Degenerate ECDSA Key Pairs
+
+  Summary:
+    P-256 key pairs whose verification meets equal or opposite points.
+
+  Description:
+    The public keys are G and -G, the private keys 1 and n - 1. The table of
+    the sliced verification holds G + G, doubled, or G - G, at infinity.
+    The signatures of "sample" with SHA-256 are the RFC 6979 ones, computed
+    with the same implementation as the brainpoolP256r1 vector.
+*/
+
+//x = 1, P-256
+uint8_t eccNbPrivKeyOne[32] =
+{
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+};
+
+//04 + Ux + Uy, G
+uint8_t eccNbPubKeyOne[65] =
+{
+    0x04, 0x6b, 0x17, 0xd1, 0xf2, 0xe1, 0x2c, 0x42,
+    0x47, 0xf8, 0xbc, 0xe6, 0xe5, 0x63, 0xa4, 0x40,
+    0xf2, 0x77, 0x03, 0x7d, 0x81, 0x2d, 0xeb, 0x33,
+    0xa0, 0xf4, 0xa1, 0x39, 0x45, 0xd8, 0x98, 0xc2,
+    0x96, 0x4f, 0xe3, 0x42, 0xe2, 0xfe, 0x1a, 0x7f,
+    0x9b, 0x8e, 0xe7, 0xeb, 0x4a, 0x7c, 0x0f, 0x9e,
+    0x16, 0x2b, 0xce, 0x33, 0x57, 0x6b, 0x31, 0x5e,
+    0xce, 0xcb, 0xb6, 0x40, 0x68, 0x37, 0xbf, 0x51,
+    0xf5
+};
+
+//r + s, x = 1 with SHA-256 of "sample"
+uint8_t eccNbSigOne[64] =
+{
+    0x04, 0x66, 0x34, 0x11, 0x74, 0xd5, 0x9e, 0x93,
+    0xeb, 0x98, 0x4c, 0x2a, 0x7c, 0x92, 0x3a, 0x80,
+    0xab, 0x99, 0xa9, 0xe9, 0x15, 0x55, 0xbc, 0x73,
+    0xeb, 0xd8, 0x07, 0x3d, 0x4c, 0x72, 0x21, 0x21,
+    0x99, 0x8f, 0x2b, 0x7b, 0xb6, 0x30, 0x82, 0xe9,
+    0x76, 0x21, 0x5e, 0x6a, 0xe4, 0x63, 0x44, 0xd6,
+    0x6d, 0x2d, 0x4e, 0xde, 0xa6, 0x7d, 0x65, 0xd9,
+    0x15, 0x95, 0xf2, 0x13, 0x11, 0xdf, 0x50, 0x30
+};
+
+//x = n - 1, P-256
+uint8_t eccNbPrivKeyMinusOne[32] =
+{
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xbc, 0xe6, 0xfa, 0xad, 0xa7, 0x17, 0x9e, 0x84,
+    0xf3, 0xb9, 0xca, 0xc2, 0xfc, 0x63, 0x25, 0x50
+};
+
+//04 + Ux + Uy, -G
+uint8_t eccNbPubKeyMinusOne[65] =
+{
+    0x04, 0x6b, 0x17, 0xd1, 0xf2, 0xe1, 0x2c, 0x42,
+    0x47, 0xf8, 0xbc, 0xe6, 0xe5, 0x63, 0xa4, 0x40,
+    0xf2, 0x77, 0x03, 0x7d, 0x81, 0x2d, 0xeb, 0x33,
+    0xa0, 0xf4, 0xa1, 0x39, 0x45, 0xd8, 0x98, 0xc2,
+    0x96, 0xb0, 0x1c, 0xbd, 0x1c, 0x01, 0xe5, 0x80,
+    0x65, 0x71, 0x18, 0x14, 0xb5, 0x83, 0xf0, 0x61,
+    0xe9, 0xd4, 0x31, 0xcc, 0xa9, 0x94, 0xce, 0xa1,
+    0x31, 0x34, 0x49, 0xbf, 0x97, 0xc8, 0x40, 0xae,
+    0x0a
+};
+
+//r + s, x = n - 1 with SHA-256 of "sample"
+uint8_t eccNbSigMinusOne[64] =
+{
+    0xa2, 0xe0, 0x9d, 0xf1, 0x04, 0xaa, 0xfc, 0x80,
+    0x2a, 0x50, 0xc6, 0x68, 0x4f, 0x6d, 0xb8, 0x33,
+    0x55, 0xa0, 0xa2, 0x58, 0x85, 0x85, 0xa7, 0x78,
+    0xb3, 0x11, 0xe7, 0xe6, 0xc7, 0xc6, 0x00, 0xce,
+    0xb7, 0x83, 0xaa, 0x56, 0x96, 0x66, 0xdd, 0xbb,
+    0x05, 0xd0, 0xa5, 0xb9, 0xce, 0x18, 0xb2, 0x75,
+    0x7b, 0x27, 0xe2, 0xf6, 0xa4, 0xb4, 0xb1, 0xa3,
+    0xe4, 0xb4, 0xce, 0xd2, 0x1f, 0x41, 0x74, 0xb2
+};
+
+/* ECQV certificate information
+
+  Summary:
+    Fields hashed with the reconstruction point of the ECQV certificates.
+
+  Description:
+    The layout is the one of the application, the ECQV module only hashes it:
+    subject and issuer identifiers (EUI-64), start of validity and validity
+    period in seconds, and key usage.
+*/
+
+uint8_t ecqvCertInfo[25] =
+{
+    //Subject
+    0x00, 0x0d, 0x6f, 0x00, 0x0a, 0x14, 0x2c, 0x51,
+    //Issuer
+    0x54, 0x45, 0x53, 0x54, 0x53, 0x45, 0x43, 0x41,
+    //Valid from
+    0x2c, 0x4b, 0xc1, 0x00,
+    //Validity period
+    0x01, 0xe1, 0x33, 0x80,
+    //Key usage: signature and key agreement
+    0x88
+};
+
 /* ************************************************************************** */
 /* ************************************************************************** */
 // Section: Interface Functions                                               */
@@ -234,6 +1201,643 @@ void ECDSA_Test (crypto_HandlerType_E cryptoHandler)
     }
 }
 
+/*******************************************************************************
+  Function:
+    void ECDSA_Cpkcl_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDSA_Cpkcl_Benchmark (void)
+{
+    ECDSA ECDSA_Sign256 = {
+        .handler     = CRYPTO_HANDLER_HW_INTERNAL,
+        .curveType = CRYPTO_ECC_CURVE_SECP256R1,
+        .inputHash = msg,
+        .inputHashSize = sizeof(msg),
+        .key = privKeyECDSA256,
+        .keySize = sizeof(privKeyECDSA256),
+        .sig = sig256,
+        .sigSize = sizeof(sig256)
+    };
+
+    printf("\r\nECDSA P-256 Sign, CPKCL self test per call vs cached\r\n");
+    ECDSA_Cpkcl_Latency(&ECDSA_Sign256);
+
+    ECDSA ECDSA_Sign384 = {
+        .handler     = CRYPTO_HANDLER_HW_INTERNAL,
+        .curveType = CRYPTO_ECC_CURVE_SECP384R1,
+        .inputHash = msg,
+        .inputHashSize = sizeof(msg),
+        .key = privKeyECDSA384,
+        .keySize = sizeof(privKeyECDSA384),
+        .sig = sig384,
+        .sigSize = sizeof(sig384)
+    };
+
+    printf("\r\nECDSA P-384 Sign, CPKCL self test per call vs cached\r\n");
+    ECDSA_Cpkcl_Latency(&ECDSA_Sign384);
+}
+
+/*******************************************************************************
+  Function:
+    void ECDSA_SignData_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDSA_SignData_Benchmark (void)
+{
+    ECDSA ECDSA_Sign256 = {
+        .handler     = CRYPTO_HANDLER_HW_INTERNAL,
+        .curveType = CRYPTO_ECC_CURVE_SECP256R1,
+        .inputHash = dataMsg,
+        .inputHashSize = sizeof(dataMsg) - 1U,
+        .key = privKeyECDSA256,
+        .keySize = sizeof(privKeyECDSA256),
+        .sig = sig256,
+        .sigSize = sizeof(sig256)
+    };
+
+    printf("\r\nECDSA P-256 SHA-256 HW SignData\r\n");
+    ECDSA_SignData_Test(&ECDSA_Sign256, pubKeyECDSA256, sizeof(pubKeyECDSA256),
+        CRYPTO_HASH_SHA2_256);
+
+    /* Hash longer than the order, the leftmost 256 bits are signed */
+    printf("\r\nECDSA P-256 SHA-512 HW SignData\r\n");
+    ECDSA_SignData_Test(&ECDSA_Sign256, pubKeyECDSA256, sizeof(pubKeyECDSA256),
+        CRYPTO_HASH_SHA2_512);
+
+    ECDSA ECDSA_Sign384 = {
+        .handler     = CRYPTO_HANDLER_HW_INTERNAL,
+        .curveType = CRYPTO_ECC_CURVE_SECP384R1,
+        .inputHash = dataMsg,
+        .inputHashSize = sizeof(dataMsg) - 1U,
+        .key = privKeyECDSA384,
+        .keySize = sizeof(privKeyECDSA384),
+        .sig = sig384,
+        .sigSize = sizeof(sig384)
+    };
+
+    printf("\r\nECDSA P-384 SHA-384 HW SignData\r\n");
+    ECDSA_SignData_Test(&ECDSA_Sign384, pubKeyECDSA384, sizeof(pubKeyECDSA384),
+        CRYPTO_HASH_SHA2_384);
+
+    /* Hash shorter than the order */
+    printf("\r\nECDSA P-384 SHA-256 HW SignData\r\n");
+    ECDSA_SignData_Test(&ECDSA_Sign384, pubKeyECDSA384, sizeof(pubKeyECDSA384),
+        CRYPTO_HASH_SHA2_256);
+
+    ECDSA ECDSA_Sign521 = {
+        .handler     = CRYPTO_HANDLER_HW_INTERNAL,
+        .curveType = CRYPTO_ECC_CURVE_SECP521R1,
+        .inputHash = dataMsg,
+        .inputHashSize = sizeof(dataMsg) - 1U,
+        .key = privKeyECDSA521,
+        .keySize = sizeof(privKeyECDSA521),
+        .sig = sig521,
+        .sigSize = sizeof(sig521)
+    };
+
+    printf("\r\nECDSA P-521 SHA-512 HW SignData\r\n");
+    ECDSA_SignData_Test(&ECDSA_Sign521, pubKeyECDSA521, sizeof(pubKeyECDSA521),
+        CRYPTO_HASH_SHA2_512);
+}
+
+/*******************************************************************************
+  Function:
+    void ECC_KeyGen_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECC_KeyGen_Benchmark (void)
+{
+    static const struct
+    {
+        crypto_EccCurveType_E curveType;
+        size_t keySize;
+        const char *name;
+    } curves[] = {
+        { CRYPTO_ECC_CURVE_P224, 28U, "P-224" },
+        { CRYPTO_ECC_CURVE_P256, 32U, "P-256" },
+        { CRYPTO_ECC_CURVE_P384, 48U, "P-384" },
+        { CRYPTO_ECC_CURVE_P521, 66U, "P-521" },
+        { CRYPTO_ECC_CURVE_BRAINPOOLP256R1, 32U, "brainpoolP256r1" },
+        { CRYPTO_ECC_CURVE_BRAINPOOLP384R1, 48U, "brainpoolP384r1" },
+        { CRYPTO_ECC_CURVE_SECP256K1, 32U, "secp256k1" },
+    };
+    size_t i;
+
+    for (i = 0; i < (sizeof(curves) / sizeof(curves[0])); i++)
+    {
+        ECDSA ECC_KeyGen = {
+            .handler     = CRYPTO_HANDLER_HW_INTERNAL,
+            .curveType = curves[i].curveType,
+            .inputHash = msg,
+            .inputHashSize = sizeof(msg),
+            .key = keyGenPriv,
+            .keySize = curves[i].keySize,
+            .sig = keyGenSig,
+            .sigSize = 2U * curves[i].keySize
+        };
+
+        printf("\r\nECC %s HW KeyGen\r\n", curves[i].name);
+        ECC_KeyGen_Test(&ECC_KeyGen, keyGenPub, (2U * curves[i].keySize) + 1U);
+
+        ECC_KeyGen.handler = CRYPTO_HANDLER_SW_WOLFCRYPT;
+        printf("\r\nECC %s SW KeyGen\r\n", curves[i].name);
+        ECC_KeyGen_Test(&ECC_KeyGen, keyGenPub, (2U * curves[i].keySize) + 1U);
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void ECDSA_Pool_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDSA_Pool_Benchmark (void)
+{
+    ECDSA ECDSA_Pool256 = {
+        .handler     = CRYPTO_HANDLER_HW_INTERNAL,
+        .curveType = CRYPTO_ECC_CURVE_SECP256R1,
+        .inputHash = msg,
+        .inputHashSize = sizeof(msg),
+        .key = privKeyECDSA256,
+        .keySize = sizeof(privKeyECDSA256),
+        .sig = sig256,
+        .sigSize = sizeof(sig256)
+    };
+
+    printf("\r\nECDSA P-256 HW Sign with precomputed nonces\r\n");
+    ECDSA_Pool_Test(&ECDSA_Pool256, pubKeyECDSA256, sizeof(pubKeyECDSA256));
+
+    ECDSA ECDSA_Pool384 = {
+        .handler     = CRYPTO_HANDLER_HW_INTERNAL,
+        .curveType = CRYPTO_ECC_CURVE_SECP384R1,
+        .inputHash = msg,
+        .inputHashSize = sizeof(msg),
+        .key = privKeyECDSA384,
+        .keySize = sizeof(privKeyECDSA384),
+        .sig = sig384,
+        .sigSize = sizeof(sig384)
+    };
+
+    printf("\r\nECDSA P-384 HW Sign with precomputed nonces\r\n");
+    ECDSA_Pool_Test(&ECDSA_Pool384, pubKeyECDSA384, sizeof(pubKeyECDSA384));
+
+    /* Keep P-256 nonces ready, APP_Tasks refills the pool when idle */
+    (void) Crypto_Ecc_Pool_Init(CRYPTO_ECC_CURVE_SECP256R1);
+}
+
+/*******************************************************************************
+  Function:
+    void ECDSA_VerifyBatch_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDSA_VerifyBatch_Benchmark (void)
+{
+    static const struct
+    {
+        const char *name;
+        crypto_EccCurveType_E curveType;
+        uint8_t *privKey;
+        size_t keySize;
+        uint8_t *pubKey;
+        size_t pubKeySize;
+    } curves[] = {
+        {"P-256", CRYPTO_ECC_CURVE_SECP256R1, privKeyECDSA256, sizeof(privKeyECDSA256), 
+            pubKeyECDSA256, sizeof(pubKeyECDSA256)},
+        {"P-384", CRYPTO_ECC_CURVE_SECP384R1, privKeyECDSA384, sizeof(privKeyECDSA384), 
+            pubKeyECDSA384, sizeof(pubKeyECDSA384)},
+    };
+    ECDSA ECDSA_Batch = {
+        .inputHash = msg,
+        .inputHashSize = sizeof(msg),
+    };
+    uint32_t i;
+
+    for (i = 0; i < (sizeof(curves) / sizeof(curves[0])); i++)
+    {
+        ECDSA_Batch.curveType = curves[i].curveType;
+        ECDSA_Batch.key = curves[i].privKey;
+        ECDSA_Batch.keySize = curves[i].keySize;
+        ECDSA_Batch.sigSize = 2U * curves[i].keySize;
+
+        ECDSA_Batch.handler = CRYPTO_HANDLER_HW_INTERNAL;
+        printf("\r\nECDSA %s HW Batch Verify\r\n", curves[i].name);
+        ECDSA_VerifyBatch_Test(&ECDSA_Batch, curves[i].pubKey, curves[i].pubKeySize);
+
+        ECDSA_Batch.handler = CRYPTO_HANDLER_SW_WOLFCRYPT;
+        printf("\r\nECDSA %s SW Batch Verify\r\n", curves[i].name);
+        ECDSA_VerifyBatch_Test(&ECDSA_Batch, curves[i].pubKey, curves[i].pubKeySize);
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void ECDSA_Compressed_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDSA_Compressed_Benchmark (void)
+{
+    static const struct
+    {
+        crypto_EccCurveType_E curveType;
+        size_t keySize;
+        const char *name;
+    } curves[] = {
+        { CRYPTO_ECC_CURVE_P192, 24U, "P-192" },
+        { CRYPTO_ECC_CURVE_P224, 28U, "P-224" },
+        { CRYPTO_ECC_CURVE_P256, 32U, "P-256" },
+        { CRYPTO_ECC_CURVE_P384, 48U, "P-384" },
+        { CRYPTO_ECC_CURVE_P521, 66U, "P-521" },
+    };
+    size_t i;
+
+    for (i = 0; i < (sizeof(curves) / sizeof(curves[0])); i++)
+    {
+        ECDSA ECDSA_Compressed = {
+            .handler     = CRYPTO_HANDLER_HW_INTERNAL,
+            .curveType = curves[i].curveType,
+            .inputHash = msg,
+            .inputHashSize = sizeof(msg),
+            .key = keyGenPriv,
+            .keySize = curves[i].keySize,
+            .sig = keyGenSig,
+            .sigSize = 2U * curves[i].keySize
+        };
+
+        printf("\r\nECDSA %s HW Verify with compressed key\r\n", curves[i].name);
+        ECDSA_Compressed_Test(&ECDSA_Compressed, keyGenPub, (2U * curves[i].keySize) + 1U);
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void ECDSA_Binary_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDSA_Binary_Benchmark (void)
+{
+    static const struct
+    {
+        crypto_EccCurveType_E curveType;
+        size_t keySize;
+        uint8_t *pubKey;
+        uint8_t *sig;
+        const char *name;
+    } curves[] = {
+        { CRYPTO_ECC_CURVE_SECT233K1, 30U, pubKeyECDSAK233, sigECDSAK233, "K-233" },
+        { CRYPTO_ECC_CURVE_SECT233R1, 30U, pubKeyECDSAB233, sigECDSAB233, "B-233" },
+        { CRYPTO_ECC_CURVE_SECT283K1, 36U, pubKeyECDSAK283, sigECDSAK283, "K-283" },
+        { CRYPTO_ECC_CURVE_SECT283R1, 36U, pubKeyECDSAB283, sigECDSAB283, "B-283" },
+    };
+    size_t i;
+
+    for (i = 0; i < (sizeof(curves) / sizeof(curves[0])); i++)
+    {
+        ECDSA ECDSA_Binary = {
+            .handler     = CRYPTO_HANDLER_HW_INTERNAL,
+            .curveType = curves[i].curveType,
+            .inputHash = msg,
+            .inputHashSize = sizeof(msg),
+            .key = keyGenPriv,
+            .keySize = curves[i].keySize,
+            .sig = keyGenSig,
+            .sigSize = 2U * curves[i].keySize
+        };
+
+        printf("\r\nECDSA %s HW\r\n", curves[i].name);
+        ECDSA_Binary_Test(&ECDSA_Binary, curves[i].pubKey, curves[i].sig,
+            keyGenPub, (2U * curves[i].keySize) + 1U);
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void ECDSA_Custom_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDSA_Custom_Benchmark (void)
+{
+    static const CPKCL_ECC_CURVE_DESC customCurve = {
+        .u2ModuloPSize = 32U,
+        .u2OrderSize = 32U,
+        .u2KeySize = 32U,
+        .pu1ModuloP = customP,
+        .pu1ACurve = customA,
+        .pu1BCurve = customB,
+        .pu1APointX = customGx,
+        .pu1APointY = customGy,
+        .pu1APointOrder = customN,
+        .pu1Cns = customCns
+    };
+    ECDSA ECDSA_Custom = {
+        .handler     = CRYPTO_HANDLER_HW_INTERNAL,
+        .curveType = CRYPTO_ECC_CURVE_CUSTOM,
+        .inputHash = msg,
+        .inputHashSize = sizeof(msg),
+        .key = keyGenPriv,
+        .keySize = 32U,
+        .sig = keyGenSig,
+        .sigSize = 64U
+    };
+
+    printf("\r\nECDSA brainpoolP256r1 as a custom curve, HW\r\n");
+    ECDSA_Custom_Test(&ECDSA_Custom, &customCurve, 
+        CRYPTO_ECC_CURVE_BRAINPOOLP256R1, keyGenPub, 65U);
+}
+
+/*******************************************************************************
+  Function:
+    void RSA_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void RSA_Benchmark (void)
+{
+    st_Crypto_Rsa_PrivKey rsa2048 = {
+        .ptr_n = rsa2048N,
+        .modulusLen = sizeof(rsa2048N),
+        .ptr_e = rsaExponent,
+        .eLen = sizeof(rsaExponent),
+        .ptr_d = rsa2048D,
+        .ptr_p = rsa2048P,
+        .ptr_q = rsa2048Q,
+        .ptr_dP = rsa2048DP,
+        .ptr_dQ = rsa2048DQ,
+        .ptr_qInv = rsa2048QInv
+    };
+    st_Crypto_Rsa_PrivKey rsa3072 = {
+        .ptr_n = rsa3072N,
+        .modulusLen = sizeof(rsa3072N),
+        .ptr_e = rsaExponent,
+        .eLen = sizeof(rsaExponent),
+        .ptr_d = rsa3072D,
+        .ptr_p = rsa3072P,
+        .ptr_q = rsa3072Q,
+        .ptr_dP = rsa3072DP,
+        .ptr_dQ = rsa3072DQ,
+        .ptr_qInv = rsa3072QInv
+    };
+
+    printf("\r\nRSA 2048 SHA-256\r\n");
+    RSA_Test(&rsa2048, msg, sizeof(msg), dataMsg, 64U);
+
+    printf("\r\nRSA 3072 SHA-256\r\n");
+    RSA_Test(&rsa3072, msg, sizeof(msg), dataMsg, 64U);
+}
+
+/*******************************************************************************
+  Function:
+    void SP_Offload_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void SP_Offload_Benchmark (void)
+{
+    printf("\r\nsp_int 2048-bit modulus\r\n");
+    SP_Offload_Test(rsa2048N, rsa2048D, sizeof(rsa2048N), rsa2048P, 
+        sizeof(rsa2048P), rsaExponent, sizeof(rsaExponent));
+
+    printf("\r\nsp_int 3072-bit modulus\r\n");
+    SP_Offload_Test(rsa3072N, rsa3072D, sizeof(rsa3072N), rsa3072P, 
+        sizeof(rsa3072P), rsaExponent, sizeof(rsaExponent));
+}
+
+/*******************************************************************************
+  Function:
+    void CryptoCb_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void CryptoCb_Benchmark (void)
+{
+    printf("\r\nwolfCrypt callback P-256\r\n");
+    CryptoCb_Test(privKeyECDSA256, pubKeyECDSA256, sizeof(privKeyECDSA256), 
+        CRYPTO_ECC_CURVE_SECP256R1, dataMsg, sizeof(dataMsg) - 1U);
+
+    printf("\r\nwolfCrypt callback P-384\r\n");
+    CryptoCb_Test(privKeyECDSA384, pubKeyECDSA384, sizeof(privKeyECDSA384), 
+        CRYPTO_ECC_CURVE_SECP384R1, dataMsg, sizeof(dataMsg) - 1U);
+}
+
+/*******************************************************************************
+  Function:
+    void KeyHandle_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void KeyHandle_Benchmark (void)
+{
+    printf("\r\nECDSA P-256 HW key handle\r\n");
+    KeyHandle_Test(CRYPTO_HANDLER_HW_INTERNAL, privKeyECDSA256, pubKeyECDSA256, 
+        sizeof(privKeyECDSA256), CRYPTO_ECC_CURVE_P256, msg, sizeof(msg));
+
+    printf("\r\nECDSA P-256 SW key handle\r\n");
+    KeyHandle_Test(CRYPTO_HANDLER_SW_WOLFCRYPT, privKeyECDSA256, pubKeyECDSA256, 
+        sizeof(privKeyECDSA256), CRYPTO_ECC_CURVE_P256, msg, sizeof(msg));
+
+    printf("\r\nECDSA P-384 HW key handle\r\n");
+    KeyHandle_Test(CRYPTO_HANDLER_HW_INTERNAL, privKeyECDSA384, pubKeyECDSA384, 
+        sizeof(privKeyECDSA384), CRYPTO_ECC_CURVE_P384, msg, sizeof(msg));
+
+    printf("\r\nECDSA P-384 SW key handle\r\n");
+    KeyHandle_Test(CRYPTO_HANDLER_SW_WOLFCRYPT, privKeyECDSA384, pubKeyECDSA384, 
+        sizeof(privKeyECDSA384), CRYPTO_ECC_CURVE_P384, msg, sizeof(msg));
+}
+
+/*******************************************************************************
+  Function:
+    void EccPoint_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void EccPoint_Benchmark (void)
+{
+    printf("\r\nP-256 point arithmetic\r\n");
+    EccPoint_Test(privKeyECDSA256, pubKeyECDSA256, sizeof(privKeyECDSA256), 
+        CRYPTO_ECC_CURVE_P256);
+
+    printf("\r\nP-384 point arithmetic\r\n");
+    EccPoint_Test(privKeyECDSA384, pubKeyECDSA384, sizeof(privKeyECDSA384), 
+        CRYPTO_ECC_CURVE_P384);
+}
+
+/*******************************************************************************
+  Function:
+    void Comb_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void Comb_Benchmark (void)
+{
+    /* The signatures must not take their nonce from the pool */
+    Crypto_Ecc_Pool_Deinit();
+
+#ifdef CRYPTO_CPKCL_COMB_P192
+    printf("\r\nP-192 comb\r\n");
+    Comb_Test(CRYPTO_ECC_CURVE_P192, CRYPTO_CPKCL_CURVE_P192, 24U, msg, 
+        sizeof(msg));
+#endif
+
+#ifdef CRYPTO_CPKCL_COMB_P224
+    printf("\r\nP-224 comb\r\n");
+    Comb_Test(CRYPTO_ECC_CURVE_P224, CRYPTO_CPKCL_CURVE_P224, 28U, msg, 
+        sizeof(msg));
+#endif
+
+#ifdef CRYPTO_CPKCL_COMB_P256
+    printf("\r\nP-256 comb\r\n");
+    Comb_Test(CRYPTO_ECC_CURVE_P256, CRYPTO_CPKCL_CURVE_P256, 32U, msg, 
+        sizeof(msg));
+#endif
+
+#ifdef CRYPTO_CPKCL_COMB_P384
+    printf("\r\nP-384 comb\r\n");
+    Comb_Test(CRYPTO_ECC_CURVE_P384, CRYPTO_CPKCL_CURVE_P384, 48U, msg, 
+        sizeof(msg));
+#endif
+
+#ifdef CRYPTO_CPKCL_COMB_P521
+    printf("\r\nP-521 comb\r\n");
+    Comb_Test(CRYPTO_ECC_CURVE_P521, CRYPTO_CPKCL_CURVE_P521, 66U, msg, 
+        sizeof(msg));
+#endif
+
+    /* Back to the idle precomputation */
+    (void) Crypto_Ecc_Pool_Init(CRYPTO_ECC_CURVE_SECP256R1);
+}
+
+/*******************************************************************************
+  Function:
+    void Rfc6979_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void Rfc6979_Benchmark (void)
+{
+    /* The random signatures must not take their nonce from the pool */
+    Crypto_Ecc_Pool_Deinit();
+
+    printf("\r\nP-256 SHA-256 (RFC 6979 A.2.5)\r\n");
+    Rfc6979_Test(CRYPTO_ECC_CURVE_P256, rfc6979PrivKey256, rfc6979PubKey256, 
+        sizeof(rfc6979PrivKey256), rfc6979Hash256, sizeof(rfc6979Hash256), 
+        rfc6979Sig256);
+
+    printf("\r\nP-384 SHA-384 (RFC 6979 A.2.6)\r\n");
+    Rfc6979_Test(CRYPTO_ECC_CURVE_P384, rfc6979PrivKey384, rfc6979PubKey384, 
+        sizeof(rfc6979PrivKey384), rfc6979Hash384, sizeof(rfc6979Hash384), 
+        rfc6979Sig384);
+
+    printf("\r\nbrainpoolP256r1 SHA-256, one candidate for k rejected\r\n");
+    Rfc6979_Test(CRYPTO_ECC_CURVE_BRAINPOOLP256R1, rfc6979PrivKeyBp256, 
+        rfc6979PubKeyBp256, sizeof(rfc6979PrivKeyBp256), rfc6979Hash256, 
+        sizeof(rfc6979Hash256), rfc6979SigBp256);
+
+    /* Back to the idle precomputation */
+    (void) Crypto_Ecc_Pool_Init(CRYPTO_ECC_CURVE_SECP256R1);
+}
+
+/*******************************************************************************
+  Function:
+    void Ecqv_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void Ecqv_Benchmark (void)
+{
+    printf("\r\nP-256 SHA-256\r\n");
+    Ecqv_Test(CRYPTO_ECC_CURVE_P256, 32U, ecqvCertInfo, sizeof(ecqvCertInfo));
+
+    printf("\r\nP-384 SHA-384\r\n");
+    Ecqv_Test(CRYPTO_ECC_CURVE_P384, 48U, ecqvCertInfo, sizeof(ecqvCertInfo));
+}
+
+/*******************************************************************************
+  Function:
+    void EccNb_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void EccNb_Benchmark (void)
+{
+    /* The hardware signatures must run the sliced multiplication */
+    Crypto_Ecc_Pool_Deinit();
+
+    printf("\r\nP-256 hardware\r\n");
+    EccNb_Test(CRYPTO_HANDLER_HW_INTERNAL, CRYPTO_ECC_CURVE_P256, 
+        rfc6979PrivKey256, rfc6979PubKey256, sizeof(rfc6979PrivKey256), 
+        rfc6979Hash256, sizeof(rfc6979Hash256), rfc6979Sig256);
+
+    /* Additions of equal and opposite points within the slices */
+    printf("\r\nP-256 hardware, public key G\r\n");
+    EccNb_Test(CRYPTO_HANDLER_HW_INTERNAL, CRYPTO_ECC_CURVE_P256, 
+        eccNbPrivKeyOne, eccNbPubKeyOne, sizeof(eccNbPrivKeyOne), 
+        rfc6979Hash256, sizeof(rfc6979Hash256), eccNbSigOne);
+
+    printf("\r\nP-256 hardware, public key -G\r\n");
+    EccNb_Test(CRYPTO_HANDLER_HW_INTERNAL, CRYPTO_ECC_CURVE_P256, 
+        eccNbPrivKeyMinusOne, eccNbPubKeyMinusOne, 
+        sizeof(eccNbPrivKeyMinusOne), rfc6979Hash256, sizeof(rfc6979Hash256),
+        eccNbSigMinusOne);
+
+    printf("\r\nP-256 wolfCrypt\r\n");
+    EccNb_Test(CRYPTO_HANDLER_SW_WOLFCRYPT, CRYPTO_ECC_CURVE_P256, 
+        rfc6979PrivKey256, rfc6979PubKey256, sizeof(rfc6979PrivKey256), 
+        rfc6979Hash256, sizeof(rfc6979Hash256), rfc6979Sig256);
+
+    printf("\r\nP-384 hardware\r\n");
+    EccNb_Test(CRYPTO_HANDLER_HW_INTERNAL, CRYPTO_ECC_CURVE_P384, 
+        rfc6979PrivKey384, rfc6979PubKey384, sizeof(rfc6979PrivKey384), 
+        rfc6979Hash384, sizeof(rfc6979Hash384), rfc6979Sig384);
+
+    printf("\r\nP-384 wolfCrypt\r\n");
+    EccNb_Test(CRYPTO_HANDLER_SW_WOLFCRYPT, CRYPTO_ECC_CURVE_P384, 
+        rfc6979PrivKey384, rfc6979PubKey384, sizeof(rfc6979PrivKey384), 
+        rfc6979Hash384, sizeof(rfc6979Hash384), rfc6979Sig384);
+
+    /* Back to the idle precomputation */
+    (void) Crypto_Ecc_Pool_Init(CRYPTO_ECC_CURVE_SECP256R1);
+}
+
 /*******************************************************************************
   Function:
     bool CompareHexArray (uint8_t *arr1, uint8_t *arr2, size_t size)
@@ -27,6 +27,12 @@
 #include "configuration.h"
 #include "crypto/common_crypto/crypto_common.h"
 #include "crypto/common_crypto/crypto_digsign.h"
+#include "crypto/common_crypto/crypto_ecc_nb.h"
+#include "crypto/common_crypto/crypto_ecc_pool.h"
+#include "crypto/common_crypto/crypto_ecc_point.h"
+#include "crypto/common_crypto/crypto_ecqv.h"
+#include "crypto/common_crypto/crypto_rsa.h"
+#include "crypto/drivers/driver/drv_crypto_ecc_hw_cpkcl.h"
 #include "definitions.h"
 
 /* Provide C++ Compatibility */
@@ -163,6 +169,1161 @@ void ECDSA_Test (crypto_HandlerType_E cryptoHandler);
     */
     void ECDSA_Verify_Test(ECDSA *ctx);
 
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDSA_Cpkcl_Benchmark (void)
+
+      @Summary
+        Measures the latency saved by the CPKCL self test and crypto RAM caches.
+
+      @Description
+        This function signs with the hardware handler on P-256 and P-384, first
+        with a CPKCL self test in front of every signature as the driver used to
+        do, then with the self test result cached since power-on, with and
+        without the curve constants resident in crypto RAM, and prints the
+        average time of each and the time saved per operation.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDSA_Cpkcl_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDSA_Cpkcl_Latency(ECDSA *ctx)
+
+      @Summary
+        Times hardware signatures with and without a CPKCL self test per call.
+
+      @Description
+        This function runs APP_CPKCL_LATENCY_ROUNDS signatures with a forced
+        CPKCL self test before each one, then the same number with the cached
+        self test result and the curve constants reloaded in crypto RAM, then
+        with the constants left resident, and prints the average latencies.
+
+      @Precondition
+        The ECDSA context (ECDSA structure) must be initialized for a signature
+        with the hardware handler.
+
+      @Parameters
+        @param ctx Pointer to the ECDSA context (ECDSA structure).
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDSA_Cpkcl_Latency(ECDSA *ctx);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDSA_SignData_Benchmark (void)
+
+      @Summary
+        Runs the hardware SignData and VerifyData tests.
+
+      @Description
+        This function signs a message longer than one hash block with the
+        hardware handler for SHA-256 and SHA-512 on P-256, SHA-384 and SHA-256
+        on P-384 and SHA-512 on P-521, which covers digests longer and shorter
+        than the curve order.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDSA_SignData_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDSA_SignData_Test(ECDSA *ctx, uint8_t *pubKey, size_t pubKeySize,
+                                 crypto_Hash_Algo_E hashType)
+
+      @Summary
+        Signs a message with SignData and checks it with both handlers.
+
+      @Description
+        This function hashes and signs the message in the context with
+        Crypto_DigiSign_Ecdsa_SignData, prints the sign and verify times, then
+        verifies the signature with VerifyData on the same handler and on the
+        wolfCrypt handler.
+
+      @Precondition
+        The ECDSA context (ECDSA structure) must hold the message in inputHash
+        and the private key matching pubKey.
+
+      @Parameters
+        @param ctx Pointer to the ECDSA context (ECDSA structure).
+
+        @param pubKey Uncompressed public key matching the private key.
+
+        @param pubKeySize Size of the public key in bytes.
+
+        @param hashType Hash algorithm applied to the message.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDSA_SignData_Test(ECDSA *ctx, uint8_t *pubKey, size_t pubKeySize,
+                             crypto_Hash_Algo_E hashType);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECC_KeyGen_Benchmark (void)
+
+      @Summary
+        Runs the key generation tests on every supported curve.
+
+      @Description
+        This function generates key pairs on P-224, P-256, P-384, P-521,
+        brainpoolP256r1, brainpoolP384r1 and secp256k1 with the hardware and
+        the wolfCrypt handlers and prints the average latency of each. P-192
+        is left out as wolfCrypt, which checks every pair, does not support
+        it.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECC_KeyGen_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECC_KeyGen_Test(ECDSA *ctx, uint8_t *pubKey, size_t pubKeySize)
+
+      @Summary
+        Times key pair generation and checks the last pair.
+
+      @Description
+        This function runs APP_KEYGEN_ROUNDS key generations with
+        Crypto_DigiSign_Ecc_KeyGen on the handler and curve of the context and
+        prints the average time, then signs the input hash with the last
+        private key on the same handler and verifies it with the last public
+        key on the wolfCrypt handler. The private key is cleared afterwards.
+
+      @Precondition
+        The ECDSA context (ECDSA structure) must hold the input hash and
+        buffers of the curve size for the key and signature.
+
+      @Parameters
+        @param ctx Pointer to the ECDSA context (ECDSA structure).
+
+        @param pubKey Buffer receiving the uncompressed public key.
+
+        @param pubKeySize Size of the public key, twice the key size plus one.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECC_KeyGen_Test(ECDSA *ctx, uint8_t *pubKey, size_t pubKeySize);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDSA_Pool_Benchmark (void)
+
+      @Summary
+        Measures hardware signatures with nonces from the precomputation pool.
+
+      @Description
+        This function runs the pool test on P-256 and P-384 with the hardware
+        handler, then leaves the pool initialized on P-256 so APP_Tasks keeps
+        it filled while the application is idle.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDSA_Pool_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDSA_Pool_Test(ECDSA *ctx, uint8_t *pubKey, size_t pubKeySize)
+
+      @Summary
+        Times signatures with and without precomputed nonces.
+
+      @Description
+        This function fills the pool for the curve of the context and prints
+        the average time to precompute one (k, k*G) pair, then signs the input
+        hash once per pair and once more per pair with the pool empty, prints
+        both average latencies and verifies every pooled signature with the
+        wolfCrypt handler.
+
+      @Precondition
+        The ECDSA context (ECDSA structure) must be initialized for a signature
+        with the hardware handler and pubKey must match its private key.
+
+      @Parameters
+        @param ctx Pointer to the ECDSA context (ECDSA structure).
+
+        @param pubKey Uncompressed public key matching the private key.
+
+        @param pubKeySize Size of the public key in bytes.
+
+      @Returns
+        None.
+
+      @Remarks
+        The pool is left empty on the curve of the context.
+    */
+    void ECDSA_Pool_Test(ECDSA *ctx, uint8_t *pubKey, size_t pubKeySize);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDSA_VerifyBatch_Benchmark (void)
+
+      @Summary
+        Compares batch and single ECDSA verification.
+
+      @Description
+        This function runs the batch verification test on P-256 and P-384 with
+        the hardware and the wolfCrypt handlers.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDSA_VerifyBatch_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDSA_VerifyBatch_Test(ECDSA *ctx, uint8_t *pubKey, size_t pubKeySize)
+
+      @Summary
+        Times a batch of signatures verified one by one and in one call.
+
+      @Description
+        This function signs APP_BATCH_SIZE different hashes with the private
+        key of the context on the wolfCrypt handler and corrupts one of the
+        signatures, then verifies them with one Crypto_DigiSign_Ecdsa_Verify
+        call each and with one Crypto_DigiSign_Ecdsa_VerifyBatch call on the
+        handler of the context. Both result bitmaps must have only the bit of
+        the corrupted signature clear, and the average time per signature of
+        each method is printed.
+
+      @Precondition
+        The ECDSA context (ECDSA structure) must hold the input hash and the
+        private key matching pubKey.
+
+      @Parameters
+        @param ctx Pointer to the ECDSA context (ECDSA structure).
+
+        @param pubKey Uncompressed public key matching the private key.
+
+        @param pubKeySize Size of the public key in bytes.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDSA_VerifyBatch_Test(ECDSA *ctx, uint8_t *pubKey, size_t pubKeySize);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDSA_Compressed_Benchmark (void)
+
+      @Summary
+        Runs the compressed public key tests on every supported curve.
+
+      @Description
+        This function runs the compressed key test with the hardware handler
+        on P-192, P-224, P-256, P-384 and P-521. P-224 is the only curve with
+        p = 1 mod 4 and takes the Tonelli-Shanks square root.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDSA_Compressed_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDSA_Compressed_Test(ECDSA *ctx, uint8_t *pubKey, size_t pubKeySize)
+
+      @Summary
+        Verifies a signature with the compressed and uncompressed public key.
+
+      @Description
+        This function generates a key pair and signs the input hash on the
+        handler of the context, then verifies the signature with the
+        uncompressed public key and with its compressed form and prints both
+        latencies. The verification must also fail when the parity byte of the
+        compressed key is flipped. The private key is cleared afterwards.
+
+      @Precondition
+        The ECDSA context (ECDSA structure) must hold the input hash and
+        buffers of the curve size for the key and signature.
+
+      @Parameters
+        @param ctx Pointer to the ECDSA context (ECDSA structure).
+
+        @param pubKey Buffer receiving the uncompressed public key.
+
+        @param pubKeySize Size of the public key, twice the key size plus one.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDSA_Compressed_Test(ECDSA *ctx, uint8_t *pubKey, size_t pubKeySize);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDSA_Binary_Benchmark (void)
+
+      @Summary
+        Runs the ECDSA tests on the binary curves.
+
+      @Description
+        This function runs the binary curve test with the hardware handler on
+        K-233, B-233, K-283 and B-283. wolfCrypt has no binary curves, the
+        known answer signatures stand in for the cross check.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDSA_Binary_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDSA_Binary_Test(ECDSA *ctx, uint8_t *katPubKey, uint8_t *katSig,
+            uint8_t *pubKey, size_t pubKeySize)
+
+      @Summary
+        Verifies a known answer signature, then signs and verifies with a
+        generated key.
+
+      @Description
+        This function verifies the known answer signature of the input hash,
+        generates a key pair, signs the input hash and verifies the signature
+        on the handler of the context and prints the sign and verify
+        latencies. The verification must fail once a bit of the hash is
+        flipped. The private key is cleared afterwards.
+
+      @Precondition
+        The ECDSA context (ECDSA structure) must hold the input hash and
+        buffers of the curve size for the key and signature.
+
+      @Parameters
+        @param ctx Pointer to the ECDSA context (ECDSA structure).
+
+        @param katPubKey Uncompressed public key of the known answer.
+
+        @param katSig Known answer signature, R followed by S.
+
+        @param pubKey Buffer receiving the generated public key.
+
+        @param pubKeySize Size of the public keys, twice the key size plus one.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDSA_Binary_Test(ECDSA *ctx, uint8_t *katPubKey, uint8_t *katSig,
+        uint8_t *pubKey, size_t pubKeySize);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDSA_Custom_Benchmark (void)
+
+      @Summary
+        Runs the ECDSA test on a curve supplied at run time.
+
+      @Description
+        This function runs the custom curve test with the hardware handler
+        on brainpoolP256r1 supplied as a custom curve.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDSA_Custom_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDSA_Custom_Test(ECDSA *ctx, const CPKCL_ECC_CURVE_DESC *curve, 
+            crypto_EccCurveType_E builtInCurve, uint8_t *pubKey, 
+            size_t pubKeySize)
+
+      @Summary
+        Signs on a custom curve and verifies on the same built-in curve.
+
+      @Description
+        This function sets the custom curve of the CPKCC driver, generates a
+        key pair on it and signs the input hash on the built-in and on the
+        custom curve, printing both latencies. The custom curve signature is
+        verified by wolfCrypt on the built-in curve. The private key and the
+        custom curve are cleared afterwards.
+
+      @Precondition
+        The ECDSA context (ECDSA structure) must hold the input hash and
+        buffers of the curve size for the key and signature.
+
+      @Parameters
+        @param ctx Pointer to the ECDSA context (ECDSA structure), on
+        CRYPTO_ECC_CURVE_CUSTOM.
+
+        @param curve Custom curve descriptor, with the parameters of 
+        builtInCurve.
+
+        @param builtInCurve Built-in curve with the same parameters.
+
+        @param pubKey Buffer receiving the uncompressed public key.
+
+        @param pubKeySize Size of the public key, twice the key size plus one.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDSA_Custom_Test(ECDSA *ctx, const CPKCL_ECC_CURVE_DESC *curve, 
+        crypto_EccCurveType_E builtInCurve, uint8_t *pubKey, size_t pubKeySize);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void RSA_Benchmark (void)
+
+      @Summary
+        Runs the RSA tests with the 2048 and 3072-bit keys.
+
+      @Description
+        This function runs the RSA test on the 2048 and 3072-bit test keys 
+        with a SHA-256 hash and prints the latency of each operation on the 
+        CPKCC next to wolfCrypt.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void RSA_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void RSA_Test(st_Crypto_Rsa_PrivKey *privKey, uint8_t *hash, 
+            size_t hashSize, uint8_t *data, size_t dataSize)
+
+      @Summary
+        Times the RSA operations on the hardware and wolfCrypt handlers.
+
+      @Description
+        This function signs the hash with PKCS#1 v1.5 and PSS, verifies the 
+        signatures and encrypts then decrypts the data with OAEP, first on the 
+        hardware handler and then on wolfCrypt. PKCS#1 v1.5 signatures must be 
+        identical on both handlers, the PSS signature and OAEP ciphertext of 
+        each handler are checked by the other one.
+
+      @Precondition
+        The key must be in CRT form with e set.
+
+      @Parameters
+        @param privKey Pointer to the RSA private key.
+
+        @param hash SHA-256 hash to sign.
+
+        @param hashSize Size of the hash, 32 bytes.
+
+        @param data Message encrypted with OAEP.
+
+        @param dataSize Size of the message, at most the modulus length minus 
+        66 bytes.
+
+      @Returns
+        None.
+
+      @Remarks
+        The PSS salt is as long as the hash.
+    */
+    void RSA_Test(st_Crypto_Rsa_PrivKey *privKey, uint8_t *hash, 
+        size_t hashSize, uint8_t *data, size_t dataSize);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void SP_Offload_Benchmark (void)
+
+      @Summary
+        Runs the sp_int offload test on the 2048 and 3072-bit RSA moduli.
+
+      @Description
+        This function runs the sp_int offload test with the modulus, private 
+        exponent and first prime of each RSA test key.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void SP_Offload_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void SP_Offload_Test(uint8_t *n, uint8_t *a, size_t nSize, uint8_t *b, 
+            size_t bSize, uint8_t *e, size_t eSize)
+
+      @Summary
+        Checks the wolfCrypt sp_int operations run on the CPKCC against 
+        software.
+
+      @Description
+        This function runs mp_mulmod, mp_mod, mp_exptmod, mp_exptmod_nct and 
+        mp_invmod modulo n, first with the CPKCC threshold moved out of reach 
+        so wolfCrypt computes them in software, then with the default 
+        threshold so they run on the CPKCC. Results must be identical and the 
+        latency of each operation is printed for both.
+
+      @Precondition
+        None.
+
+      @Parameters
+        @param n Odd modulus, big endian.
+
+        @param a Operand below n and coprime to it, used as the secret 
+        exponent, big endian.
+
+        @param nSize Size of n and a in bytes.
+
+        @param b Operand below n, used as the base, big endian.
+
+        @param bSize Size of b in bytes.
+
+        @param e Public exponent, big endian.
+
+        @param eSize Size of e in bytes.
+
+      @Returns
+        None.
+
+      @Remarks
+        mp_mod reduces the double length product a*b.
+    */
+    void SP_Offload_Test(uint8_t *n, uint8_t *a, size_t nSize, uint8_t *b, 
+        size_t bSize, uint8_t *e, size_t eSize);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void CryptoCb_Benchmark (void)
+
+      @Summary
+        Runs the wolfCrypt crypto callback test on P-256 and P-384.
+
+      @Description
+        This function runs the crypto callback test with the ECDSA test key of
+        each curve and the SignData message.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void CryptoCb_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void CryptoCb_Test(uint8_t *privKey, uint8_t *pubKey, size_t keySize, 
+            crypto_EccCurveType_E curveType, uint8_t *data, size_t dataSize)
+
+      @Summary
+        Checks the wolfCrypt SHA-256 and ECDSA operations handed to the 
+        hardware by the crypto callback against software.
+
+      @Description
+        This function hashes the data with wc_Sha256 and signs and verifies the
+        digest with wc_ecc, first in software and then with the crypto callback
+        device registered. Digests must be identical, both signatures must 
+        verify and the latency of each operation is printed for both. With the
+        device registered it also checks the fallback to software: a second 
+        hash stream started while the first holds the SHA engine, and a 
+        verification while the CPKCC is claimed.
+
+      @Precondition
+        None.
+
+      @Parameters
+        @param privKey Private key, big endian.
+
+        @param pubKey Uncompressed public key, 0x04 || X || Y.
+
+        @param keySize Size of the private key in bytes.
+
+        @param curveType Curve of the key.
+
+        @param data Message to hash.
+
+        @param dataSize Size of the message in bytes.
+
+      @Returns
+        None.
+
+      @Remarks
+        The device is unregistered on return, the other wolfCrypt tests run in
+        software.
+    */
+    void CryptoCb_Test(uint8_t *privKey, uint8_t *pubKey, size_t keySize, 
+        crypto_EccCurveType_E curveType, uint8_t *data, size_t dataSize);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void KeyHandle_Benchmark (void)
+
+      @Summary
+        Runs the key handle test on P-256 and P-384 with both handlers.
+
+      @Description
+        This function runs the key handle test with the ECDSA test key of each
+        curve and the test hash, on the hardware and wolfCrypt handlers.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void KeyHandle_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void KeyHandle_Test(crypto_HandlerType_E handler, uint8_t *privKey, 
+            uint8_t *pubKey, size_t keySize, crypto_EccCurveType_E curveType,
+            uint8_t *hash, size_t hashSize)
+
+      @Summary
+        Compares the ECDSA calls taking the key with those taking a key handle.
+
+      @Description
+        This function signs the hash and verifies the signature with the
+        compressed public key APP_KEY_HANDLE_ROUNDS times, passing the key on
+        every call, then imports the key once with Crypto_Key_Import and runs
+        the same rounds with the handle. The signature made with the handle
+        must pass the per call verification. The import time and the average
+        latency of each operation are printed for both. The handle must be
+        rejected once destroyed.
+
+      @Precondition
+        None.
+
+      @Parameters
+        @param handler Handler of the calls and of the key handle.
+
+        @param privKey Private key, big endian.
+
+        @param pubKey Uncompressed public key, 0x04 || X || Y.
+
+        @param keySize Size of the private key in bytes.
+
+        @param curveType Curve of the key.
+
+        @param hash Hash to sign.
+
+        @param hashSize Size of the hash in bytes.
+
+      @Returns
+        None.
+
+      @Remarks
+        The per call verification decompresses the public key each time, the
+        handle only at import.
+    */
+    void KeyHandle_Test(crypto_HandlerType_E handler, uint8_t *privKey, 
+        uint8_t *pubKey, size_t keySize, crypto_EccCurveType_E curveType,
+        uint8_t *hash, size_t hashSize);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void EccPoint_Benchmark (void)
+
+      @Summary
+        Runs the point arithmetic test on P-256 and P-384.
+
+      @Description
+        This function runs the point arithmetic test with the ECDSA test key of
+        each curve.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void EccPoint_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void EccPoint_Test(uint8_t *privKey, uint8_t *pubKey, size_t keySize, 
+            crypto_EccCurveType_E curveType)
+
+      @Summary
+        Checks the point arithmetic calls and times the double scalar 
+        multiplication.
+
+      @Description
+        This function checks that d*G gives the public key Q, then that 
+        k1*Q + k2*2Q and k1*Q + k2*Q computed by Crypto_Ecc_Point_DualMul give 
+        (k1 + 2*k2)*Q and (k1 + k2)*Q, 2Q coming from Crypto_Ecc_Point_Add. The
+        scalars are taken from the coordinates of Q. k1*G + k2*Q is then 
+        computed APP_POINT_ROUNDS times by Crypto_Ecc_Point_DualMul and by two 
+        Crypto_Ecc_Point_Mul calls and a Crypto_Ecc_Point_Add, the results 
+        must match and the average latency of both is printed.
+
+      @Precondition
+        None.
+
+      @Parameters
+        @param privKey Private key d, big endian.
+
+        @param pubKey Uncompressed public key Q = d*G, 0x04 || X || Y.
+
+        @param keySize Size of the private key in bytes.
+
+        @param curveType Curve of the key.
+
+      @Returns
+        None.
+
+      @Remarks
+        k1*Q + k2*Q meets P1 = P2 and takes the separate computation inside
+        Crypto_Ecc_Point_DualMul.
+    */
+    void EccPoint_Test(uint8_t *privKey, uint8_t *pubKey, size_t keySize, 
+        crypto_EccCurveType_E curveType);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void Comb_Benchmark (void)
+
+      @Summary
+        Runs the fixed-base comb test on the curves with a comb table.
+
+      @Description
+        This function runs the comb test on each NIST curve enabled by the
+        CRYPTO_CPKCL_COMB_* options of wolfcrypt_config.h, with the pool of
+        signature nonces stopped, and restarts the pool on P-256.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void Comb_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void Comb_Test(crypto_EccCurveType_E curveType, 
+            CRYPTO_CPKCL_CURVE hwCurve, size_t keySize, uint8_t *hash, 
+            size_t hashSize)
+
+      @Summary
+        Checks the comb table of a curve and compares the signature latency
+        with and without it.
+
+      @Description
+        This function generates a key pair on the hardware handler, d*G running
+        on the comb table, and checks the public key against d*G computed by
+        the CPKCL multiplication. The hash is then signed APP_COMB_ROUNDS times
+        with the comb and APP_COMB_ROUNDS times without it, every signature is
+        verified on wolfCrypt. The flash size of the table and the average
+        signature latency of both are printed.
+
+      @Precondition
+        The pool of signature nonces must be empty for the curve.
+
+      @Parameters
+        @param curveType Curve to test.
+
+        @param hwCurve Same curve for the CPKCC driver.
+
+        @param keySize Size of the private key in bytes.
+
+        @param hash Hash to sign.
+
+        @param hashSize Size of the hash in bytes.
+
+      @Returns
+        None.
+
+      @Remarks
+        The comb is switched off with DRV_CRYPTO_ECC_SetCombEnabled for the
+        reference run and switched on again at the end.
+    */
+    void Comb_Test(crypto_EccCurveType_E curveType, CRYPTO_CPKCL_CURVE hwCurve,
+        size_t keySize, uint8_t *hash, size_t hashSize);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void Rfc6979_Benchmark (void)
+
+      @Summary
+        Runs the deterministic ECDSA test on the RFC 6979 vectors.
+
+      @Description
+        This function runs the deterministic ECDSA test on the P-256 and P-384
+        vectors of RFC 6979 appendix A.2 and on a brainpoolP256r1 vector whose
+        first candidate for k is rejected, with the pool of signature nonces 
+        stopped, and restarts the pool on P-256.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void Rfc6979_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void Rfc6979_Test(crypto_EccCurveType_E curveType, uint8_t *privKey, 
+            uint8_t *pubKey, size_t keySize, uint8_t *hash, size_t hashSize, 
+            uint8_t *expSig)
+
+      @Summary
+        Checks the deterministic ECDSA signature of both handlers against a
+        known answer and compares its latency with the random nonce signature.
+
+      @Description
+        This function signs the hash with Crypto_DigiSign_Ecdsa_SignDeterministic
+        on the wolfCrypt handler, then APP_RFC6979_ROUNDS times on the hardware
+        handler. Every signature must equal the expected one and is verified on
+        wolfCrypt. The hash is then signed APP_RFC6979_ROUNDS times with a
+        random nonce on the hardware handler. The average signature latency of
+        both is printed.
+
+      @Precondition
+        The pool of signature nonces must be empty for the curve.
+
+      @Parameters
+        @param curveType Curve of the key pair.
+
+        @param privKey Private key.
+
+        @param pubKey Uncompressed public key, 0x04 || X || Y.
+
+        @param keySize Size of the private key in bytes.
+
+        @param hash Hash to sign, SHA-256, SHA-384 or SHA-512.
+
+        @param hashSize Size of the hash in bytes.
+
+        @param expSig Expected signature r || s.
+
+      @Returns
+        None.
+
+      @Remarks
+        The deterministic latency includes the HMAC_DRBG on the SHA engine.
+    */
+    void Rfc6979_Test(crypto_EccCurveType_E curveType, uint8_t *privKey,
+        uint8_t *pubKey, size_t keySize, uint8_t *hash, size_t hashSize, 
+        uint8_t *expSig);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void Ecqv_Benchmark (void)
+
+      @Summary
+        Runs the ECQV implicit certificate test on P-256 and P-384.
+
+      @Description
+        This function runs the ECQV test on P-256 and P-384 with the same
+        certificate information.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void Ecqv_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void Ecqv_Test(crypto_EccCurveType_E curveType, size_t keySize,
+            uint8_t *certInfo, size_t certInfoSize)
+
+      @Summary
+        Issues an ECQV certificate, derives its key pair on both sides and
+        times the public key reconstruction.
+
+      @Description
+        This function generates a CA key pair and a certificate request on the
+        CPKCC, issues the certificate with Crypto_Ecqv_Issue, derives the 
+        private key of the subject with Crypto_Ecqv_PrivateKey, then 
+        reconstructs the public key from the certificate and the CA public key
+        APP_ECQV_ROUNDS times with Crypto_Ecqv_PublicKey. The reconstructed key
+        must equal the one of the subject and must change when a bit of the 
+        certificate information changes. The certificate size, the latency of
+        the three steps and, for reference, the average latency of a double
+        scalar multiplication with scalars of the curve size are printed.
+
+      @Precondition
+        None.
+
+      @Parameters
+        @param curveType Prime curve of the certificate.
+
+        @param keySize Size of the curve in bytes.
+
+        @param certInfo Certificate information, at most 64 bytes.
+
+        @param certInfoSize Size of the certificate information in bytes.
+
+      @Returns
+        None.
+
+      @Remarks
+        The reconstruction latency includes the decompression of P_U and the
+        certificate hash on the SHA engine.
+    */
+    void Ecqv_Test(crypto_EccCurveType_E curveType, size_t keySize,
+        uint8_t *certInfo, size_t certInfoSize);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void EccNb_Benchmark (void)
+
+      @Summary
+        Runs the non-blocking ECDSA test on both handlers on P-256 and P-384.
+
+      @Description
+        This function stops the nonce pool, so that the hardware signatures
+        run the sliced multiplication, runs the non-blocking ECDSA test with
+        the RFC 6979 key pairs on the hardware and wolfCrypt handlers, then
+        restarts the pool on P-256. On P-256 the hardware handler also runs
+        it with the public keys G and -G, whose verifications add equal and
+        opposite points within their slices.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void EccNb_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void EccNb_Test(crypto_HandlerType_E handler, 
+            crypto_EccCurveType_E curveType, uint8_t *privKey, uint8_t *pubKey,
+            size_t keySize, uint8_t *hash, size_t hashSize, uint8_t *expSig)
+
+      @Summary
+        Signs and verifies in slices with crypto_ecc_nb.h and measures the
+        longest slice.
+
+      @Description
+        This function verifies the known signature, signs the hash with a 
+        random nonce and verifies a corrupted copy of the new signature with 
+        the non-blocking functions, calling Crypto_Ecc_Nb_Continue with
+        APP_NB_SLICE_STEPS steps per slice as APP_Tasks would. The new 
+        signature is checked by the blocking wolfCrypt verification. The count
+        of slices, the longest slice, the start call included, the total time
+        of the operation and the time of the blocking call on the same handler
+        are printed for the signature and the verification.
+
+      @Precondition
+        The nonce pool is stopped for the hardware signature to run the sliced
+        multiplication.
+
+      @Parameters
+        @param handler Handler of the operations.
+
+        @param curveType Curve of the key pair, P-256 or P-384 for wolfCrypt.
+
+        @param privKey Private key on keySize bytes.
+
+        @param pubKey Uncompressed public key.
+
+        @param keySize Size of the curve in bytes.
+
+        @param hash Hash to sign.
+
+        @param hashSize Size of the hash in bytes.
+
+        @param expSig Valid signature r || s of the hash.
+
+      @Returns
+        None.
+
+      @Remarks
+        The longest hardware slice is the one with the arithmetic modulo the 
+        order on wolfCrypt, or the last bits of the multiplication with its
+        conversion to affine coordinates.
+    */
+    void EccNb_Test(crypto_HandlerType_E handler, 
+        crypto_EccCurveType_E curveType, uint8_t *privKey, uint8_t *pubKey,
+        size_t keySize, uint8_t *hash, size_t hashSize, uint8_t *expSig);
+
     // *****************************************************************************
     /**
       @Function
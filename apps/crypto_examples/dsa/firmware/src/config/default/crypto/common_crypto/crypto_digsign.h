@@ -28,6 +28,7 @@
 // *****************************************************************************
 #include "crypto_common.h"
 #include "crypto/common_crypto/crypto_hash.h"
+#include "crypto/common_crypto/crypto_key.h"
 
 typedef enum
 {
@@ -49,6 +50,20 @@ typedef enum
     CRYPTO_DIGISIGN_SUCCESS = 0,        
 }crypto_DigiSign_Status_E;
 
+//Maximum number of signatures in one batch verification, one bit each in the result bitmap
+#define CRYPTO_DIGISIGN_BATCH_MAX (32u)
+
+//One signature of an ECDSA batch verification
+typedef struct
+{
+    uint8_t *ptr_inputHash;
+    uint32_t hashLen;
+    uint8_t *ptr_inputSig;
+    uint32_t sigLen;
+    uint8_t *ptr_pubKey;
+    uint32_t pubKeyLen;
+}st_Crypto_DigiSign_Ecdsa_VerifyItem;
+
 crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Sign(crypto_HandlerType_E ecdsaHandlerType_en, uint8_t *ptr_inputHash, uint32_t hashLen, uint8_t *ptr_outSig, 
                                                     uint32_t sigLen, uint8_t *ptr_privKey, uint32_t privKeyLen, 
                                                     crypto_EccCurveType_E eccCurveType_En, uint32_t ecdsaSessionId);
@@ -66,4 +81,34 @@ crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_VerifyData(crypto_HandlerType_E e
                                                             crypto_Hash_Algo_E hashType_en, int8_t *ptr_hashVerifyStat, crypto_EccCurveType_E eccCurveType_En, 
                                                             uint32_t ecdsaSessionId);
 
+//Generates an ECC key pair. The private key is written on the curve size and the public key uncompressed (0x04 || X || Y) 
+//on twice the curve size plus one byte, privKeyLen and pubKeyLen give the sizes of the buffers.
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecc_KeyGen(crypto_HandlerType_E ecdsaHandlerType_en, uint8_t *ptr_privKey, uint32_t privKeyLen, 
+                                                    uint8_t *ptr_pubKey, uint32_t pubKeyLen, crypto_EccCurveType_E eccCurveType_En, uint32_t ecdsaSessionId);
+
+//Verifies numItems signatures on one curve. The arguments of all items are checked first, then the curve is set up
+//once for the whole batch. Bit i of ptr_verifyBitmap is set when signature i is valid and cleared when it is not or
+//when its public key cannot be decoded. Items in a row with the same ptr_pubKey share the decoded key.
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_VerifyBatch(crypto_HandlerType_E ecdsaHandlerType_en, st_Crypto_DigiSign_Ecdsa_VerifyItem *ptr_items, 
+                                                            uint32_t numItems, uint32_t *ptr_verifyBitmap, crypto_EccCurveType_E eccCurveType_En, 
+                                                            uint32_t ecdsaSessionId);
+
+//Signs a hash with the private key of a handle from Crypto_Key_Import, r || s is written on twice the curve size.
+//The key is neither parsed again nor is a DRBG instantiated for the signature.
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_SignWithKey(crypto_Key_Handle_T keyHandle, uint8_t *ptr_inputHash, uint32_t hashLen, 
+                                                            uint8_t *ptr_outSig, uint32_t sigLen, uint32_t ecdsaSessionId);
+
+//Verifies a signature r || s with the public key of a handle from Crypto_Key_Import.
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_VerifyWithKey(crypto_Key_Handle_T keyHandle, uint8_t *ptr_inputHash, uint32_t hashLen, 
+                                                            uint8_t *ptr_inputSig, uint32_t sigLen, int8_t *ptr_hashVerifyStat, 
+                                                            uint32_t ecdsaSessionId);
+
+//Signs a hash with a nonce derived from the private key and the hash (RFC 6979), the same key and hash always give the
+//same signature r || s and no random number is drawn. The HMAC_DRBG runs on the hash of the signature, picked from
+//hashLen: 32, 48 or 64 bytes for SHA-256, SHA-384 or SHA-512. It runs on the SHA engine for the hardware handler.
+//Prime curves only on the hardware handler.
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_SignDeterministic(crypto_HandlerType_E ecdsaHandlerType_en, uint8_t *ptr_inputHash, uint32_t hashLen, 
+                                                                uint8_t *ptr_outSig, uint32_t sigLen, uint8_t *ptr_privKey, uint32_t privKeyLen, 
+                                                                crypto_EccCurveType_E eccCurveType_En, uint32_t ecdsaSessionId);
+
 #endif /* CRYPTO_DIGSIGN_H */
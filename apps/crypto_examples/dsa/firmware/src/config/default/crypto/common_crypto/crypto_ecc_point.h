@@ -0,0 +1,63 @@
+/*******************************************************************************
+  MPLAB Harmony Application Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_ecc_point.h
+
+  Summary:
+    ECC point arithmetic on the CPKCC.
+
+  Description:
+    This header file provides scalar multiplication, point addition and the
+    double scalar multiplication k1*P1 + k2*P2 on the prime curves, for the
+    protocols built on top of the ECDSA and ECDH calls: signature verification
+    from precomputed values, implicit certificates, key derivations. Points are
+    uncompressed (0x04 || X || Y) on twice the curve size plus one byte and
+    scalars are big endian, at most the curve size long. The points given are
+    not checked to be on the curve, except by the decompression.
+*******************************************************************************/
+
+#ifndef CRYPTO_ECC_POINT_H
+#define CRYPTO_ECC_POINT_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stdint.h>
+#include "crypto_common.h"
+
+typedef enum
+{
+    CRYPTO_ECC_POINT_ERROR_CURVE = -4,  //Binary curve or curve not supported
+    CRYPTO_ECC_POINT_ERROR_ARG = -3,
+    CRYPTO_ECC_POINT_ERROR_FAIL = -2,
+    CRYPTO_ECC_POINT_INFINITY = -1,     //The result is the point at infinity, nothing is written
+    CRYPTO_ECC_POINT_SUCCESS = 0,
+}crypto_Ecc_Point_Status_E;
+
+//k*P, or k*G when ptr_point is NULL. k may be secret.
+crypto_Ecc_Point_Status_E Crypto_Ecc_Point_Mul(crypto_EccCurveType_E eccCurveType_En, uint8_t *ptr_k, uint32_t kLen,
+                                               uint8_t *ptr_point, uint32_t pointLen, uint8_t *ptr_result, uint32_t resultLen);
+
+//A + B, A = B included.
+crypto_Ecc_Point_Status_E Crypto_Ecc_Point_Add(crypto_EccCurveType_E eccCurveType_En, uint8_t *ptr_pointA, uint32_t pointALen,
+                                               uint8_t *ptr_pointB, uint32_t pointBLen, uint8_t *ptr_result, uint32_t resultLen);
+
+//k1*P1 + k2*P2, P1 being G when ptr_point1 is NULL, in one pass over the scalar bits (Shamir's trick): half the
+//doublings of two Crypto_Ecc_Point_Mul calls. The time taken depends on the scalars, which must be public. When an
+//intermediate addition meets equal points the two products are computed and added separately.
+crypto_Ecc_Point_Status_E Crypto_Ecc_Point_DualMul(crypto_EccCurveType_E eccCurveType_En, uint8_t *ptr_k1, uint32_t k1Len,
+                                                   uint8_t *ptr_point1, uint32_t point1Len, uint8_t *ptr_k2, uint32_t k2Len,
+                                                   uint8_t *ptr_point2, uint32_t point2Len, uint8_t *ptr_result, uint32_t resultLen);
+
+//Uncompressed form of a compressed point (0x02 or 0x03 for an even or odd Y || X) on the curve size plus one byte.
+//Y is a modular square root on the CPKCC, CRYPTO_ECC_POINT_ERROR_FAIL is returned when X is not on the curve.
+crypto_Ecc_Point_Status_E Crypto_Ecc_Point_Decompress(crypto_EccCurveType_E eccCurveType_En, uint8_t *ptr_point, uint32_t pointLen,
+                                                      uint8_t *ptr_result, uint32_t resultLen);
+
+#endif /* CRYPTO_ECC_POINT_H */
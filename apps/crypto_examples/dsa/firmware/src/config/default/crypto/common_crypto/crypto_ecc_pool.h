@@ -0,0 +1,75 @@
+/*******************************************************************************
+  MPLAB Harmony Application Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_ecc_pool.h
+
+  Summary:
+    Pool of precomputed ECC ephemeral key pairs.
+
+  Description:
+    This header file provides the interface of a pool of (k, k*G) pairs which
+    are computed ahead of time, when the application is idle, and consumed by
+    the ECDSA signature and the ephemeral ECDH key generation so the scalar
+    multiplication does not add to their latency.
+*******************************************************************************/
+
+#ifndef CRYPTO_ECC_POOL_H
+#define CRYPTO_ECC_POOL_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stdint.h>
+#include "crypto_common.h"
+
+//Number of precomputed pairs, each one takes 200 bytes of RAM
+#ifndef CRYPTO_ECC_POOL_SIZE
+#define CRYPTO_ECC_POOL_SIZE (4U)
+#endif
+
+typedef enum
+{
+    CRYPTO_ECC_POOL_ERROR_CURVE = -4,
+    CRYPTO_ECC_POOL_ERROR_ARG = -3,
+    CRYPTO_ECC_POOL_ERROR_FAIL = -2,
+    CRYPTO_ECC_POOL_EMPTY = -1,        //No pair precomputed for the curve
+    CRYPTO_ECC_POOL_SUCCESS = 0,
+    CRYPTO_ECC_POOL_FULL = 1,          //Nothing left to precompute
+}crypto_Ecc_Pool_Status_E;
+
+//Clears the pool and starts precomputing pairs on the curve. Only one curve is served at a time.
+crypto_Ecc_Pool_Status_E Crypto_Ecc_Pool_Init(crypto_EccCurveType_E eccCurveType_En);
+
+//Clears the pool and stops precomputing pairs.
+void Crypto_Ecc_Pool_Deinit(void);
+
+//Precomputes at most one pair, to be called when the application is idle. The CPKCC is used while its self test
+//passes and wolfCrypt otherwise. Returns CRYPTO_ECC_POOL_FULL when the pool is full or not initialized.
+crypto_Ecc_Pool_Status_E Crypto_Ecc_Pool_Tasks(void);
+
+//Number of pairs ready for the curve.
+uint32_t Crypto_Ecc_Pool_Count(crypto_EccCurveType_E eccCurveType_En);
+
+//Removes one pair from the pool. k is written on the curve size and k*G uncompressed (0x04 || X || Y) on twice the
+//curve size plus one byte. The pair is cleared from the pool and must not be used twice.
+crypto_Ecc_Pool_Status_E Crypto_Ecc_Pool_Take(crypto_EccCurveType_E eccCurveType_En, uint8_t *ptr_k, uint32_t kLen,
+                                              uint8_t *ptr_kG, uint32_t kGLen);
+
+//Signs a hash with the nonce of one pair: r = x(k*G) mod n and s = k^-1 (e + r*d) mod n, written as r || s on twice
+//the curve size. Returns CRYPTO_ECC_POOL_EMPTY when no pair is ready, the caller then runs the full signature.
+crypto_Ecc_Pool_Status_E Crypto_Ecc_Pool_EcdsaSign(crypto_EccCurveType_E eccCurveType_En, uint8_t *ptr_inputHash, uint32_t hashLen,
+                                                   uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_outSig, uint32_t sigLen);
+
+//Same signature with a nonce pair computed by the caller, k on the curve size and k*G uncompressed. The pair must not
+//be used twice, the caller clears it.
+crypto_Ecc_Pool_Status_E Crypto_Ecc_Pool_EcdsaSignNonce(crypto_EccCurveType_E eccCurveType_En, uint8_t *ptr_k, uint32_t kLen,
+                                                        uint8_t *ptr_kG, uint32_t kGLen, uint8_t *ptr_inputHash, uint32_t hashLen,
+                                                        uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_outSig, uint32_t sigLen);
+
+#endif /* CRYPTO_ECC_POOL_H */
@@ -0,0 +1,83 @@
+/*******************************************************************************
+  MPLAB Harmony Application Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_ecqv.h
+
+  Summary:
+    ECQV implicit certificates (SEC 4) on the CPKCC.
+
+  Description:
+    An ECQV certificate carries a reconstruction point P_U instead of a public
+    key and a CA signature: the public key of the subject is computed from the
+    certificate and the CA public key as Q_U = e*P_U + Q_CA, with e the hash of
+    the certificate, and only the owner of the request key k_U can find the
+    matching private key d_U = e*k_U + r from the value r sent by the CA.
+
+    The certificate is P_U compressed on the curve size plus one byte followed
+    by the certificate information (subject, issuer, validity...), whose
+    layout is left to the application and which is hashed with P_U. e is the
+    leftmost bits of the hash, as many as in the order of the curve, computed
+    on the SHA engine with the hash of the curve size:
+
+    Curve size   Hash
+    <= 32        SHA-256
+    <= 48        SHA-384
+    66           SHA-512
+
+    The point operations run on the CPKCC through crypto_ecc_point.h, so only
+    the prime curves are supported, and the arithmetic modulo the order on
+    wolfCrypt. The public key reconstruction is one double scalar
+    multiplication with the one scalar reduced to 1.
+*******************************************************************************/
+
+#ifndef CRYPTO_ECQV_H
+#define CRYPTO_ECQV_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stdint.h>
+#include "crypto_common.h"
+
+//Size of a certificate on a curve of keySize bytes with infoLen bytes of certificate information
+#define CRYPTO_ECQV_CERT_SIZE(keySize, infoLen) ((uint32_t)(keySize) + 1u + (uint32_t)(infoLen))
+
+typedef enum
+{
+    CRYPTO_ECQV_ERROR_KEY = -6,        //The private key does not match the public key of the certificate
+    CRYPTO_ECQV_ERROR_CERT = -5,       //P_U is not a point of the curve, or a key is the point at infinity
+    CRYPTO_ECQV_ERROR_HASH = -4,
+    CRYPTO_ECQV_ERROR_CURVE = -3,      //Binary curve or curve not supported
+    CRYPTO_ECQV_ERROR_ARG = -2,
+    CRYPTO_ECQV_ERROR_FAIL = -1,
+    CRYPTO_ECQV_SUCCESS = 0,
+}crypto_Ecqv_Status_E;
+
+//CA side: issues the certificate for the request point R_U = k_U*G (uncompressed), the request key pair being an ordinary
+//ECC key pair of the subject. P_U = R_U + k*G with a new k from the CPKCC generator, CRYPTO_ECQV_CERT_SIZE bytes of
+//certificate are written to ptr_cert and the private key reconstruction value r = e*k + d_CA mod n to ptr_r on the
+//curve size.
+crypto_Ecqv_Status_E Crypto_Ecqv_Issue(crypto_EccCurveType_E eccCurveType_en, uint8_t *ptr_caPrivKey, uint32_t caPrivKeyLen,
+                                       uint8_t *ptr_requestPoint, uint32_t requestPointLen, uint8_t *ptr_certInfo, uint32_t certInfoLen,
+                                       uint8_t *ptr_cert, uint32_t certLen, uint8_t *ptr_r, uint32_t rLen);
+
+//Any party: reconstructs the public key Q_U = e*P_U + Q_CA of the certificate, written uncompressed on twice the curve size
+//plus one byte. The CA public key is uncompressed.
+crypto_Ecqv_Status_E Crypto_Ecqv_PublicKey(crypto_EccCurveType_E eccCurveType_en, uint8_t *ptr_cert, uint32_t certLen,
+                                           uint8_t *ptr_caPubKey, uint32_t caPubKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen);
+
+//Subject side: derives the private key d_U = e*k_U + r mod n from the request private key and the value r of the CA,
+//written on the curve size. d_U*G is checked against the reconstructed public key, which is written to ptr_pubKey as
+//by Crypto_Ecqv_PublicKey. The private key is cleared when the check fails.
+crypto_Ecqv_Status_E Crypto_Ecqv_PrivateKey(crypto_EccCurveType_E eccCurveType_en, uint8_t *ptr_cert, uint32_t certLen,
+                                            uint8_t *ptr_r, uint32_t rLen, uint8_t *ptr_requestPrivKey, uint32_t requestPrivKeyLen,
+                                            uint8_t *ptr_caPubKey, uint32_t caPubKeyLen, uint8_t *ptr_privKey, uint32_t privKeyLen,
+                                            uint8_t *ptr_pubKey, uint32_t pubKeyLen);
+
+#endif /* CRYPTO_ECQV_H */
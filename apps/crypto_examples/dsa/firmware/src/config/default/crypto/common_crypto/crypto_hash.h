@@ -37,6 +37,8 @@
 typedef enum {
     CRYPTO_HASH_INVALID = 0,
     CRYPTO_HASH_SHA2_256 = 3,
+    CRYPTO_HASH_SHA2_384 = 4,
+    CRYPTO_HASH_SHA2_512 = 5,
     CRYPTO_HASH_MAX
 }crypto_Hash_Algo_E;
 
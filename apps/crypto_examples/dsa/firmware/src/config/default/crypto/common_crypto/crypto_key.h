@@ -0,0 +1,83 @@
+/*******************************************************************************
+  MPLAB Harmony Application Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_key.h
+
+  Summary:
+    Persistent ECC key handles.
+
+  Description:
+    A key imported once with Crypto_Key_Import is kept parsed in a slot until
+    Crypto_Key_Destroy, and its handle is passed to the ECDSA and ECDH calls in
+    place of the raw key bytes. For the wolfCrypt handler the slot holds the
+    imported ecc_key and an instantiated DRBG, for the hardware handler the
+    public key is decompressed once and kept uncompressed.
+*******************************************************************************/
+
+#ifndef CRYPTO_KEY_H
+#define CRYPTO_KEY_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stdint.h>
+#include "crypto_common.h"
+
+//Number of keys alive at the same time, at most 255. Each slot takes about 200 bytes of RAM, plus an ecc_key and a
+//WC_RNG for the wolfCrypt handler.
+#ifndef CRYPTO_KEY_SLOTS
+#define CRYPTO_KEY_SLOTS (2U)
+#endif
+
+//Handle of an imported key. The handle of a destroyed key is rejected, it only comes back after 2^24 imports.
+typedef uint32_t crypto_Key_Handle_T;
+
+#define CRYPTO_KEY_HANDLE_INVALID (0U)
+
+typedef enum
+{
+    CRYPTO_KEY_ERROR_RNG = -8,
+    CRYPTO_KEY_ERROR_HDLR = -7,
+    CRYPTO_KEY_ERROR_CURVE = -6,
+    CRYPTO_KEY_ERROR_PRIVKEY = -5,
+    CRYPTO_KEY_ERROR_PUBKEY = -4,
+    CRYPTO_KEY_ERROR_HANDLE = -3,   //Invalid handle or key destroyed
+    CRYPTO_KEY_ERROR_FULL = -2,     //No free slot
+    CRYPTO_KEY_ERROR_FAIL = -1,
+    CRYPTO_KEY_SUCCESS = 0,
+}crypto_Key_Status_E;
+
+//ECC key held by a slot, owned by crypto_key.c
+typedef struct
+{
+    crypto_HandlerType_E handler_en;
+    crypto_EccCurveType_E eccCurveType_en;
+    uint32_t keySize;
+    uint32_t privKeyLen;    //0 when no private key was imported
+    uint32_t pubKeyLen;     //0 when no public key was imported, 2 * keySize + 1 otherwise
+    uint8_t privKey[CRYPTO_ECC_MAX_KEY_LENGTH];             //Hardware handler only
+    uint8_t pubKey[(2 * CRYPTO_ECC_MAX_KEY_LENGTH) + 1];    //Uncompressed, 0x04 || X || Y
+    void *ptr_wcEccKey;     //ecc_key of the wolfCrypt handler
+    void *ptr_wcRng;        //WC_RNG of the wolfCrypt handler
+}st_Crypto_Key_Ecc;
+
+//Imports an ECC key for the handler. Either part can be left out with a NULL pointer: the private key is needed to
+//sign and for ECDH, the public key to verify. The public key is uncompressed (0x04 || X || Y) or compressed (0x02 or
+//0x03 || X), compressed keys of the binary curves are rejected with CRYPTO_KEY_ERROR_PUBKEY on the hardware handler.
+crypto_Key_Status_E Crypto_Key_Import(crypto_HandlerType_E handlerType_en, uint8_t *ptr_privKey, uint32_t privKeyLen,
+                                      uint8_t *ptr_pubKey, uint32_t pubKeyLen, crypto_EccCurveType_E eccCurveType_en,
+                                      crypto_Key_Handle_T *ptr_keyHandle);
+
+//Clears the key and frees its slot.
+crypto_Key_Status_E Crypto_Key_Destroy(crypto_Key_Handle_T keyHandle);
+
+//Key of a handle, NULL when the handle is invalid or the key destroyed.
+st_Crypto_Key_Ecc *Crypto_Key_Get(crypto_Key_Handle_T keyHandle);
+
+#endif /* CRYPTO_KEY_H */
@@ -0,0 +1,56 @@
+/*******************************************************************************
+  MPLAB Harmony Application Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_rfc6979.h
+
+  Summary:
+    Deterministic ECDSA nonce generation (RFC 6979).
+
+  Description:
+    Crypto_Rfc6979_GenerateK derives the ECDSA nonce k from the private key and
+    the message hash with the HMAC_DRBG of RFC 6979 section 3.2, so the same
+    key and hash always give the same signature and no entropy is needed to
+    sign. The HMAC is supplied by the caller, each handler runs it on its own
+    hash implementation: the SHA engine for the hardware handler, wolfCrypt
+    for the wolfCrypt handler.
+*******************************************************************************/
+
+#ifndef CRYPTO_RFC6979_H
+#define CRYPTO_RFC6979_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stdint.h>
+#include <stdbool.h>
+#include "crypto_common.h"
+#include "crypto/common_crypto/crypto_hash.h"
+
+typedef enum
+{
+    CRYPTO_RFC6979_ERROR_HMAC = -4,
+    CRYPTO_RFC6979_ERROR_HASHTYPE = -3,    //Only SHA-256, SHA-384 and SHA-512
+    CRYPTO_RFC6979_ERROR_ARG = -2,
+    CRYPTO_RFC6979_ERROR_FAIL = -1,
+    CRYPTO_RFC6979_SUCCESS = 0,
+}crypto_Rfc6979_Status_E;
+
+//HMAC of the concatenation of numData buffers with the key, the MAC is written on the digest size of the hash to
+//ptr_mac, which is 4 byte aligned and may be the key or the first buffer. Returns false when the HMAC fails.
+typedef bool (*crypto_Rfc6979_Hmac_Fp)(crypto_Hash_Algo_E hashAlgo_en, uint8_t *ptr_key, uint32_t keyLen,
+                                       uint8_t **ptr_data, uint32_t *ptr_dataLen, uint32_t numData, uint8_t *ptr_mac);
+
+//Writes the nonce k for the private key and the message hash to ptr_k on orderLen bytes. The order n of the curve is
+//given MSB first on orderLen bytes, its leading byte not zero. The private key is at most orderLen bytes and the hash
+//is the one signed, its algorithm also runs the HMAC_DRBG.
+crypto_Rfc6979_Status_E Crypto_Rfc6979_GenerateK(crypto_Rfc6979_Hmac_Fp hmac_fp, crypto_Hash_Algo_E hashAlgo_en,
+                                                 uint8_t *ptr_order, uint32_t orderLen, uint8_t *ptr_privKey,
+                                                 uint32_t privKeyLen, uint8_t *ptr_hash, uint32_t hashLen, uint8_t *ptr_k);
+
+#endif /* CRYPTO_RFC6979_H */
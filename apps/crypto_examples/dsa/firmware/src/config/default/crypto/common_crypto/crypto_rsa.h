@@ -0,0 +1,113 @@
+/*******************************************************************************
+  MPLAB Harmony Application Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_rsa.h
+
+  Summary:
+    RSA signature and decryption.
+
+  Description:
+    This header file provides the interface of the RSA operations: PKCS#1
+    v1.5 and PSS signature and verification of a hash, and OAEP encryption
+    and decryption, on the CPKCC or on wolfCrypt.
+*******************************************************************************/
+
+#ifndef CRYPTO_RSA_H
+#define CRYPTO_RSA_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "crypto_common.h"
+#include "crypto/common_crypto/crypto_hash.h"
+
+//Modulus sizes in bytes, 2048 to 3072 bits in steps of 32 bits
+#define CRYPTO_RSA_MIN_MODULUS_SIZE (256u)
+#define CRYPTO_RSA_MAX_MODULUS_SIZE (384u)
+
+typedef enum
+{
+    CRYPTO_RSA_ERROR_NOTSUPPTED = -127,
+    CRYPTO_RSA_ERROR_PRIVKEY = -126,
+    CRYPTO_RSA_ERROR_PUBKEY = -125,
+    CRYPTO_RSA_ERROR_KEYLEN = -124,
+    CRYPTO_RSA_ERROR_HDLR = -123,
+    CRYPTO_RSA_ERROR_INPUTHASH = -122,
+    CRYPTO_RSA_ERROR_HASHTYPE = -121,
+    CRYPTO_RSA_ERROR_SIGNATURE = -120,
+    CRYPTO_RSA_ERROR_SALTLEN = -119,
+    CRYPTO_RSA_ERROR_INPUTDATA = -118,
+    CRYPTO_RSA_ERROR_OUTPUTDATA = -117,
+    CRYPTO_RSA_ERROR_DECRYPT = -116,   //Ciphertext out of range or padding not valid
+    CRYPTO_RSA_ERROR_SID = -115,       //Session ID Error
+    CRYPTO_RSA_ERROR_ARG = -114,
+    CRYPTO_RSA_ERROR_RNG = -113,
+    CRYPTO_RSA_ERROR_FAIL = -112,
+    CRYPTO_RSA_SUCCESS = 0,
+}crypto_Rsa_Status_E;
+
+//RSA public key, numbers MSB first. n is on modulusLen bytes.
+typedef struct
+{
+    uint8_t *ptr_n;
+    uint32_t modulusLen;
+    uint8_t *ptr_e;
+    uint32_t eLen;
+}st_Crypto_Rsa_PubKey;
+
+//RSA private key in CRT form, numbers MSB first. n and d are on modulusLen bytes, p, q, dP, dQ and qInv = q^-1 mod p
+//on half of it. e protects the CRT against faults, d is only read by wolfCrypt.
+typedef struct
+{
+    uint8_t *ptr_n;
+    uint32_t modulusLen;
+    uint8_t *ptr_e;
+    uint32_t eLen;
+    uint8_t *ptr_d;
+    uint8_t *ptr_p;
+    uint8_t *ptr_q;
+    uint8_t *ptr_dP;
+    uint8_t *ptr_dQ;
+    uint8_t *ptr_qInv;
+}st_Crypto_Rsa_PrivKey;
+
+//EMSA-PKCS1-v1_5 signature of a SHA-2 hash. The signature is written on the modulus length.
+crypto_Rsa_Status_E Crypto_Rsa_Pkcs1v15_Sign(crypto_HandlerType_E rsaHandlerType_en, uint8_t *ptr_inputHash, uint32_t hashLen,
+                                            crypto_Hash_Algo_E hashType_en, uint8_t *ptr_outSig, uint32_t sigLen,
+                                            st_Crypto_Rsa_PrivKey *ptr_privKey, uint32_t rsaSessionId);
+
+//ptr_hashVerifyStat is set to 1 when the signature is valid and 0 when it is not.
+crypto_Rsa_Status_E Crypto_Rsa_Pkcs1v15_Verify(crypto_HandlerType_E rsaHandlerType_en, uint8_t *ptr_inputHash, uint32_t hashLen,
+                                              crypto_Hash_Algo_E hashType_en, uint8_t *ptr_inputSig, uint32_t sigLen,
+                                              st_Crypto_Rsa_PubKey *ptr_pubKey, int8_t *ptr_hashVerifyStat, uint32_t rsaSessionId);
+
+//EMSA-PSS signature of a SHA-2 hash, MGF1 runs on the same hash. The salt is random, saltLen goes from 0 to the hash size.
+crypto_Rsa_Status_E Crypto_Rsa_Pss_Sign(crypto_HandlerType_E rsaHandlerType_en, uint8_t *ptr_inputHash, uint32_t hashLen,
+                                       crypto_Hash_Algo_E hashType_en, uint32_t saltLen, uint8_t *ptr_outSig, uint32_t sigLen,
+                                       st_Crypto_Rsa_PrivKey *ptr_privKey, uint32_t rsaSessionId);
+
+crypto_Rsa_Status_E Crypto_Rsa_Pss_Verify(crypto_HandlerType_E rsaHandlerType_en, uint8_t *ptr_inputHash, uint32_t hashLen,
+                                         crypto_Hash_Algo_E hashType_en, uint32_t saltLen, uint8_t *ptr_inputSig, uint32_t sigLen,
+                                         st_Crypto_Rsa_PubKey *ptr_pubKey, int8_t *ptr_hashVerifyStat, uint32_t rsaSessionId);
+
+//RSAES-OAEP encryption, MGF1 runs on the same hash. The label may be empty, the ciphertext is written on the modulus length.
+crypto_Rsa_Status_E Crypto_Rsa_Oaep_Encrypt(crypto_HandlerType_E rsaHandlerType_en, uint8_t *ptr_inputData, uint32_t dataLen,
+                                           crypto_Hash_Algo_E hashType_en, uint8_t *ptr_label, uint32_t labelLen,
+                                           uint8_t *ptr_outData, uint32_t outDataLen, st_Crypto_Rsa_PubKey *ptr_pubKey,
+                                           uint32_t rsaSessionId);
+
+//RSAES-OAEP decryption. outDataLen must hold the longest message, modulus length - 2 * hash size - 2 bytes, the
+//message length is returned in ptr_msgLen. A ciphertext that does not decrypt to a valid padding returns
+//CRYPTO_RSA_ERROR_DECRYPT whatever the reason.
+crypto_Rsa_Status_E Crypto_Rsa_Oaep_Decrypt(crypto_HandlerType_E rsaHandlerType_en, uint8_t *ptr_inputData, uint32_t dataLen,
+                                           crypto_Hash_Algo_E hashType_en, uint8_t *ptr_label, uint32_t labelLen,
+                                           uint8_t *ptr_outData, uint32_t outDataLen, uint32_t *ptr_msgLen,
+                                           st_Crypto_Rsa_PrivKey *ptr_privKey, uint32_t rsaSessionId);
+
+#endif /* CRYPTO_RSA_H */
@@ -178,6 +178,8 @@ crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_SignData(crypto_HandlerType_E ecd
                                                                                                                     hashType_en, eccCurveType_En);
             break; 
             case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_ecdsaStat_en = Crypto_DigiSign_Ecdsa_Hw_SignData(ptr_inputData, dataLen, ptr_outSig, sigLen, ptr_privKey, privKeyLen, 
+                                                                                                                    hashType_en, eccCurveType_En);
             break;
             default:
                 ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_HDLR;
@@ -232,10 +234,284 @@ crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_VerifyData(crypto_HandlerType_E e
                                                                             ptr_hashVerifyStat, eccCurveType_En);
             break; 
             case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_ecdsaStat_en = Crypto_DigiSign_Ecdsa_Hw_VerifyData(ptr_inputData, dataLen, ptr_inputSig, sigLen, ptr_pubKey, pubKeyLen, hashType_en,
+                                                                            ptr_hashVerifyStat, eccCurveType_En);
+            break;
+            default:
+                ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_HDLR;
             break;
+        }
+    }
+    return ret_ecdsaStat_en;
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecc_KeyGen(crypto_HandlerType_E ecdsaHandlerType_en, uint8_t *ptr_privKey, uint32_t privKeyLen, 
+                                                    uint8_t *ptr_pubKey, uint32_t pubKeyLen, crypto_EccCurveType_E eccCurveType_En, uint32_t ecdsaSessionId)
+{
+    crypto_DigiSign_Status_E ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_ALGONOTSUPPTD;
+    
+    if(ptr_privKey == NULL)
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_PRIVKEY;
+    }
+    else if(privKeyLen == 0u)
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_PRIVKEYLEN;
+    }
+    else if(ptr_pubKey == NULL)
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_PUBKEY;
+    }
+    else if(pubKeyLen == 0u)
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_PUBKEYLEN;
+    }
+    else if( (eccCurveType_En <= CRYPTO_ECC_CURVE_INVALID) || (eccCurveType_En >= CRYPTO_ECC_CURVE_MAX) )
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_CURVE;
+    }
+    else if((ecdsaSessionId <= 0u) || (ecdsaSessionId > (uint32_t)CRYPTO_DIGISIGN_SESSION_MAX) )
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_SID;
+    }
+    else
+    {
+        switch(ecdsaHandlerType_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_ecdsaStat_en = Crypto_DigiSign_Wc_Ecc_KeyGen(ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen, eccCurveType_En);
+            break; 
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_ecdsaStat_en = Crypto_DigiSign_Ecc_Hw_KeyGen(ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen, eccCurveType_En);
+            break;
+            default:
+                ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_HDLR;
+            break;
+        }
+    }
+    return ret_ecdsaStat_en;
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_VerifyBatch(crypto_HandlerType_E ecdsaHandlerType_en, st_Crypto_DigiSign_Ecdsa_VerifyItem *ptr_items, 
+                                                            uint32_t numItems, uint32_t *ptr_verifyBitmap, crypto_EccCurveType_E eccCurveType_En, 
+                                                            uint32_t ecdsaSessionId)
+{
+    crypto_DigiSign_Status_E ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_ALGONOTSUPPTD;
+    uint32_t item;
+    
+    if( (ptr_items == NULL) || (numItems == 0u) || (numItems > CRYPTO_DIGISIGN_BATCH_MAX) || (ptr_verifyBitmap == NULL) )
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_ARG;
+    }
+    else if( (eccCurveType_En <= CRYPTO_ECC_CURVE_INVALID) || (eccCurveType_En >= CRYPTO_ECC_CURVE_MAX) )
+    {
+         ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_CURVE;
+    }
+    else if((ecdsaSessionId <= 0u) || (ecdsaSessionId > (uint32_t)CRYPTO_DIGISIGN_SESSION_MAX) )
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_SID;
+    }
+    else
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_SUCCESS;
+        
+        for(item = 0u; (item < numItems) && (ret_ecdsaStat_en == CRYPTO_DIGISIGN_SUCCESS); item++)
+        {
+            if( (ptr_items[item].ptr_inputHash == NULL) || (ptr_items[item].hashLen == 0u) )
+            {
+                ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_INPUTHASH;
+            }
+            else if( (ptr_items[item].ptr_inputSig == NULL) || (ptr_items[item].sigLen == 0u) )
+            {
+                ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_SIGNATURE;
+            }
+            else if( (ptr_items[item].ptr_pubKey == NULL) || (ptr_items[item].pubKeyLen == 0u) )
+            {
+                ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_PUBKEY;
+            }
+            //Check the Key compression Type, 0x04 for uncompressed, 0x02 for Even compressed and 0x03 for Odd compressed
+            else if( !( (ptr_items[item].ptr_pubKey[0] == 0x04u) || ((ptr_items[item].ptr_pubKey[0] == 0x02u) || (ptr_items[item].ptr_pubKey[0] == 0x03u)) ) )
+            {
+                ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_PUBKEYCOMPRESS;
+            }
+            else
+            {
+                //Item is valid
+            }
+        }
+    }
+    
+    if(ret_ecdsaStat_en == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        *ptr_verifyBitmap = 0u;
+        
+        switch(ecdsaHandlerType_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_ecdsaStat_en = Crypto_DigiSign_Wc_Ecdsa_VerifyBatch(ptr_items, numItems, ptr_verifyBitmap, eccCurveType_En);
+            	break; 
+            case CRYPTO_HANDLER_HW_INTERNAL:
+            	ret_ecdsaStat_en = Crypto_DigiSign_Ecdsa_Hw_VerifyBatch(ptr_items, numItems, ptr_verifyBitmap, eccCurveType_En);
+            	break;
+            default:
+                ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_HDLR;
+            	break;
+        }
+    }
+    return ret_ecdsaStat_en;
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_SignWithKey(crypto_Key_Handle_T keyHandle, uint8_t *ptr_inputHash, uint32_t hashLen, 
+                                                            uint8_t *ptr_outSig, uint32_t sigLen, uint32_t ecdsaSessionId)
+{
+    crypto_DigiSign_Status_E ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_ALGONOTSUPPTD;
+    st_Crypto_Key_Ecc *ptr_key_st = Crypto_Key_Get(keyHandle);
+    
+    if( (ptr_inputHash == NULL) || (hashLen == 0u) )
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_INPUTHASH;
+    }
+    else if( (ptr_key_st == NULL) || (ptr_key_st->privKeyLen == 0u) )
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_PRIVKEY;
+    }
+    else if( (ptr_outSig == NULL) || (sigLen < (2u * ptr_key_st->keySize)) )
+    {
+         ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_SIGNATURE;
+    }
+    else if((ecdsaSessionId <= 0u) || (ecdsaSessionId > (uint32_t)CRYPTO_DIGISIGN_SESSION_MAX) )
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_SID;
+    }
+    else
+    {
+        switch(ptr_key_st->handler_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_ecdsaStat_en = Crypto_DigiSign_Wc_Ecdsa_SignHashWithKey(ptr_inputHash, hashLen, ptr_outSig, sigLen, ptr_key_st);
+            	break; 
+            case CRYPTO_HANDLER_HW_INTERNAL:
+            	ret_ecdsaStat_en = Crypto_DigiSign_Ecdsa_Hw_Sign(ptr_inputHash, hashLen, ptr_outSig, sigLen, ptr_key_st->privKey, 
+                                        ptr_key_st->privKeyLen, ptr_key_st->eccCurveType_en);
+                break;             
             default:
                 ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_HDLR;
+            	break;
+        }
+    }
+    return ret_ecdsaStat_en;
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_VerifyWithKey(crypto_Key_Handle_T keyHandle, uint8_t *ptr_inputHash, uint32_t hashLen, 
+                                                            uint8_t *ptr_inputSig, uint32_t sigLen, int8_t *ptr_hashVerifyStat, 
+                                                            uint32_t ecdsaSessionId)
+{
+    crypto_DigiSign_Status_E ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_ALGONOTSUPPTD;
+    st_Crypto_Key_Ecc *ptr_key_st = Crypto_Key_Get(keyHandle);
+    
+    if( (ptr_inputHash == NULL) || (hashLen == 0u) )
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_INPUTHASH;
+    }
+    else if( (ptr_key_st == NULL) || (ptr_key_st->pubKeyLen == 0u) )
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_PUBKEY;
+    }
+    else if( (ptr_inputSig == NULL) || (sigLen < (2u * ptr_key_st->keySize)) )
+    {
+         ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_SIGNATURE;
+    }
+    else if(ptr_hashVerifyStat == NULL)
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_ARG;
+    }
+    else if((ecdsaSessionId <= 0u) || (ecdsaSessionId > (uint32_t)CRYPTO_DIGISIGN_SESSION_MAX) )
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_SID;
+    }
+    else
+    {
+        switch(ptr_key_st->handler_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_ecdsaStat_en = Crypto_DigiSign_Wc_Ecdsa_VerifyHashWithKey(ptr_inputHash, hashLen, ptr_inputSig, sigLen, ptr_hashVerifyStat, ptr_key_st);
+            	break; 
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                //The key was decompressed at import, the driver only splits the coordinates
+            	ret_ecdsaStat_en = Crypto_DigiSign_Ecdsa_Hw_Verify(ptr_inputHash, hashLen, ptr_inputSig, sigLen, ptr_key_st->pubKey, 
+                                        ptr_key_st->pubKeyLen, ptr_hashVerifyStat, ptr_key_st->eccCurveType_en);
+            	break;
+            default:
+                ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_HDLR;
+            	break;
+        }
+    }
+    return ret_ecdsaStat_en;
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_SignDeterministic(crypto_HandlerType_E ecdsaHandlerType_en, uint8_t *ptr_inputHash, uint32_t hashLen, 
+                                                                uint8_t *ptr_outSig, uint32_t sigLen, uint8_t *ptr_privKey, uint32_t privKeyLen, 
+                                                                crypto_EccCurveType_E eccCurveType_En, uint32_t ecdsaSessionId)
+{
+    crypto_DigiSign_Status_E ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_ALGONOTSUPPTD;
+    crypto_Hash_Algo_E hashType_en = CRYPTO_HASH_INVALID;
+    
+    //The HMAC_DRBG runs on the hash of the signature
+    switch(hashLen)
+    {
+        case 32u:
+            hashType_en = CRYPTO_HASH_SHA2_256;
+            break;
+        case 48u:
+            hashType_en = CRYPTO_HASH_SHA2_384;
+            break;
+        case 64u:
+            hashType_en = CRYPTO_HASH_SHA2_512;
+            break;
+        default:
+            hashType_en = CRYPTO_HASH_INVALID;
             break;
+    }
+    
+    if(ptr_inputHash == NULL)
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_INPUTHASH;
+    }
+    else if(hashType_en == CRYPTO_HASH_INVALID)
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_HASHTYPE;
+    }
+    else if( (ptr_outSig == NULL) || (sigLen == 0u) )
+    {
+         ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_SIGNATURE;
+    }
+    else if( (eccCurveType_En <= CRYPTO_ECC_CURVE_INVALID) || (eccCurveType_En >= CRYPTO_ECC_CURVE_MAX) )
+    {
+         ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_CURVE;
+    }
+    else if( (ptr_privKey == NULL) || (privKeyLen == 0u))
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_PRIVKEY;
+    }
+    else if((ecdsaSessionId <= 0u) || (ecdsaSessionId > (uint32_t)CRYPTO_DIGISIGN_SESSION_MAX) )
+    {
+        ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_SID;
+    }
+    else
+    {
+        switch(ecdsaHandlerType_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_ecdsaStat_en = Crypto_DigiSign_Wc_Ecdsa_SignHashDeterministic(ptr_inputHash, hashLen, ptr_outSig, sigLen, ptr_privKey, 
+                                        privKeyLen, hashType_en, eccCurveType_En);
+            	break; 
+            case CRYPTO_HANDLER_HW_INTERNAL:
+            	ret_ecdsaStat_en = Crypto_DigiSign_Ecdsa_Hw_SignDeterministic(ptr_inputHash, hashLen, ptr_outSig, sigLen, ptr_privKey, 
+                                        privKeyLen, hashType_en, eccCurveType_En);
+                break;             
+            default:
+                ret_ecdsaStat_en = CRYPTO_DIGISIGN_ERROR_HDLR;
+            	break;
         }
     }
     return ret_ecdsaStat_en;
@@ -0,0 +1,339 @@
+/*******************************************************************************
+  MPLAB Harmony Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_ecc_point.c
+
+  Summary:
+    ECC point arithmetic on the CPKCC.
+
+  Description:
+    This file checks the arguments of the point arithmetic calls and runs them
+    on the CPKCC driver. The double scalar multiplication falls back to two
+    scalar multiplications and an addition when the driver reports an addition
+    of equal points, which its formulas do not take.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "crypto/common_crypto/crypto_ecc_point.h"
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/drivers/driver/drv_crypto_ecc_hw_cpkcl.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_ECC_POINT_SIZE_MAX ((2 * CRYPTO_ECC_MAX_KEY_LENGTH) + 1)
+
+//Scalars padded to the curve size, and the products of the fall back
+static uint8_t eccPointK1[CRYPTO_ECC_MAX_KEY_LENGTH];
+static uint8_t eccPointK2[CRYPTO_ECC_MAX_KEY_LENGTH];
+static uint8_t eccPointProd1[CRYPTO_ECC_POINT_SIZE_MAX];
+static uint8_t eccPointProd2[CRYPTO_ECC_POINT_SIZE_MAX];
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static crypto_Ecc_Point_Status_E lCrypto_Ecc_Point_GetHwCurve(crypto_EccCurveType_E eccCurveType_En, CRYPTO_CPKCL_CURVE *ptr_hwCurve)
+{
+    crypto_Ecc_Point_Status_E ret_pointStat_en = CRYPTO_ECC_POINT_SUCCESS;
+
+    switch(eccCurveType_En)
+    {
+        case CRYPTO_ECC_CURVE_P192:
+            *ptr_hwCurve = CRYPTO_CPKCL_CURVE_P192;
+            break;
+
+        case CRYPTO_ECC_CURVE_P224:
+            *ptr_hwCurve = CRYPTO_CPKCL_CURVE_P224;
+            break;
+
+        case CRYPTO_ECC_CURVE_P256:
+            *ptr_hwCurve = CRYPTO_CPKCL_CURVE_P256;
+            break;
+
+        case CRYPTO_ECC_CURVE_P384:
+            *ptr_hwCurve = CRYPTO_CPKCL_CURVE_P384;
+            break;
+
+        case CRYPTO_ECC_CURVE_P521:
+            *ptr_hwCurve = CRYPTO_CPKCL_CURVE_P521;
+            break;
+
+        case CRYPTO_ECC_CURVE_BRAINPOOLP256R1:
+            *ptr_hwCurve = CRYPTO_CPKCL_CURVE_BP256R1;
+            break;
+
+        case CRYPTO_ECC_CURVE_BRAINPOOLP384R1:
+            *ptr_hwCurve = CRYPTO_CPKCL_CURVE_BP384R1;
+            break;
+
+        case CRYPTO_ECC_CURVE_SECP256K1:
+            *ptr_hwCurve = CRYPTO_CPKCL_CURVE_SECP256K1;
+            break;
+
+        case CRYPTO_ECC_CURVE_CUSTOM:
+            *ptr_hwCurve = CRYPTO_CPKCL_CURVE_CUSTOM;
+            break;
+
+        default:
+            ret_pointStat_en = CRYPTO_ECC_POINT_ERROR_CURVE;
+            break;
+    }
+
+    return ret_pointStat_en;
+}
+
+//Checks the CPKCL and loads the curve
+static crypto_Ecc_Point_Status_E lCrypto_Ecc_Point_Init(crypto_EccCurveType_E eccCurveType_En, CPKCL_ECC_DATA *ptr_eccData)
+{
+    CRYPTO_CPKCL_CURVE hwCurve = CRYPTO_CPKCL_CURVE_P256;
+    crypto_Ecc_Point_Status_E ret_pointStat_en = lCrypto_Ecc_Point_GetHwCurve(eccCurveType_En, &hwCurve);
+
+    if(ret_pointStat_en != CRYPTO_ECC_POINT_SUCCESS)
+    {
+        //Binary curve
+    }
+    else if(DRV_CRYPTO_ECC_CheckCpkcl() != CRYPTO_CPKCL_RESULT_INIT_SUCCESS)
+    {
+        ret_pointStat_en = CRYPTO_ECC_POINT_ERROR_FAIL;
+    }
+    else if(DRV_CRYPTO_ECC_InitCurveParams(ptr_eccData, hwCurve) != CRYPTO_CPKCL_RESULT_CURVE_SUCCESS)
+    {
+        ret_pointStat_en = CRYPTO_ECC_POINT_ERROR_CURVE;
+    }
+    else
+    {
+        //Curve loaded
+    }
+
+    return ret_pointStat_en;
+}
+
+//An uncompressed point of the curve size, or NULL for G when allowed
+static bool lCrypto_Ecc_Point_IsPointArg(uint8_t *ptr_point, uint32_t pointLen, uint32_t keySize, bool nullIsG)
+{
+    bool pointOk;
+
+    if(ptr_point == NULL)
+    {
+        pointOk = nullIsG;
+    }
+    else
+    {
+        pointOk = ( (pointLen == ((2u * keySize) + 1u)) && (ptr_point[0] == 0x04u) );
+    }
+
+    return pointOk;
+}
+
+//Copies a big endian scalar to ptr_dest padded to the curve size
+static bool lCrypto_Ecc_Point_PadScalar(uint8_t *ptr_dest, uint8_t *ptr_k, uint32_t kLen, uint32_t keySize)
+{
+    bool scalarOk = ( (ptr_k != NULL) && (kLen > 0u) && (kLen <= keySize) );
+
+    if(scalarOk == true)
+    {
+        (void) memset(ptr_dest, 0, keySize - kLen);
+        (void) memcpy(&ptr_dest[keySize - kLen], ptr_k, kLen);
+    }
+
+    return scalarOk;
+}
+
+static crypto_Ecc_Point_Status_E lCrypto_Ecc_Point_GetStatus(CRYPTO_CPKCL_RESULT hwResult)
+{
+    crypto_Ecc_Point_Status_E ret_pointStat_en;
+
+    if(hwResult == CRYPTO_CPKCL_RESULT_POINT_SUCCESS)
+    {
+        ret_pointStat_en = CRYPTO_ECC_POINT_SUCCESS;
+    }
+    else if(hwResult == CRYPTO_CPKCL_RESULT_POINT_INFINITY)
+    {
+        ret_pointStat_en = CRYPTO_ECC_POINT_INFINITY;
+    }
+    else
+    {
+        ret_pointStat_en = CRYPTO_ECC_POINT_ERROR_FAIL;
+    }
+
+    return ret_pointStat_en;
+}
+
+//k1*P1 + k2*P2 as two scalar multiplications and an addition, the padded scalars being in eccPointK1 and eccPointK2
+static CRYPTO_CPKCL_RESULT lCrypto_Ecc_Point_DualMulSeparate(CPKCL_ECC_DATA *ptr_eccData, uint8_t *ptr_point1,
+                                                            uint8_t *ptr_point2, uint8_t *ptr_result)
+{
+    uint32_t pointSize = (2u * (uint32_t)ptr_eccData->u2KeySize) + 1u;
+    CRYPTO_CPKCL_RESULT hwResult1 = DRV_CRYPTO_ECC_PointMul(ptr_eccData, eccPointK1, ptr_point1, eccPointProd1);
+    CRYPTO_CPKCL_RESULT hwResult2 = DRV_CRYPTO_ECC_PointMul(ptr_eccData, eccPointK2, ptr_point2, eccPointProd2);
+    CRYPTO_CPKCL_RESULT ret_hwResult;
+
+    if( (hwResult1 == CRYPTO_CPKCL_RESULT_POINT_SUCCESS) && (hwResult2 == CRYPTO_CPKCL_RESULT_POINT_SUCCESS) )
+    {
+        ret_hwResult = DRV_CRYPTO_ECC_PointAdd(ptr_eccData, eccPointProd1, eccPointProd2, ptr_result);
+    }
+    else if( (hwResult1 == CRYPTO_CPKCL_RESULT_POINT_INFINITY) && (hwResult2 == CRYPTO_CPKCL_RESULT_POINT_SUCCESS) )
+    {
+        (void) memcpy(ptr_result, eccPointProd2, pointSize);
+        ret_hwResult = CRYPTO_CPKCL_RESULT_POINT_SUCCESS;
+    }
+    else if( (hwResult1 == CRYPTO_CPKCL_RESULT_POINT_SUCCESS) && (hwResult2 == CRYPTO_CPKCL_RESULT_POINT_INFINITY) )
+    {
+        (void) memcpy(ptr_result, eccPointProd1, pointSize);
+        ret_hwResult = CRYPTO_CPKCL_RESULT_POINT_SUCCESS;
+    }
+    else if( (hwResult1 == CRYPTO_CPKCL_RESULT_POINT_INFINITY) && (hwResult2 == CRYPTO_CPKCL_RESULT_POINT_INFINITY) )
+    {
+        ret_hwResult = CRYPTO_CPKCL_RESULT_POINT_INFINITY;
+    }
+    else
+    {
+        ret_hwResult = CRYPTO_CPKCL_RESULT_POINT_ERROR;
+    }
+
+    return ret_hwResult;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Ecc_Point_Status_E Crypto_Ecc_Point_Mul(crypto_EccCurveType_E eccCurveType_En, uint8_t *ptr_k, uint32_t kLen,
+                                               uint8_t *ptr_point, uint32_t pointLen, uint8_t *ptr_result, uint32_t resultLen)
+{
+    CPKCL_ECC_DATA eccData;
+    uint32_t keySize;
+    crypto_Ecc_Point_Status_E ret_pointStat_en = lCrypto_Ecc_Point_Init(eccCurveType_En, &eccData);
+
+    if(ret_pointStat_en == CRYPTO_ECC_POINT_SUCCESS)
+    {
+        keySize = eccData.u2KeySize;
+
+        if( (ptr_result == NULL) || (resultLen < ((2u * keySize) + 1u))
+                || (lCrypto_Ecc_Point_IsPointArg(ptr_point, pointLen, keySize, true) == false)
+                || (lCrypto_Ecc_Point_PadScalar(eccPointK1, ptr_k, kLen, keySize) == false) )
+        {
+            ret_pointStat_en = CRYPTO_ECC_POINT_ERROR_ARG;
+        }
+        else
+        {
+            ret_pointStat_en = lCrypto_Ecc_Point_GetStatus(DRV_CRYPTO_ECC_PointMul(&eccData, eccPointK1, ptr_point, ptr_result));
+            (void) memset(eccPointK1, 0, sizeof(eccPointK1));
+        }
+    }
+
+    return ret_pointStat_en;
+}
+
+crypto_Ecc_Point_Status_E Crypto_Ecc_Point_Add(crypto_EccCurveType_E eccCurveType_En, uint8_t *ptr_pointA, uint32_t pointALen,
+                                               uint8_t *ptr_pointB, uint32_t pointBLen, uint8_t *ptr_result, uint32_t resultLen)
+{
+    CPKCL_ECC_DATA eccData;
+    uint32_t keySize;
+    crypto_Ecc_Point_Status_E ret_pointStat_en = lCrypto_Ecc_Point_Init(eccCurveType_En, &eccData);
+
+    if(ret_pointStat_en == CRYPTO_ECC_POINT_SUCCESS)
+    {
+        keySize = eccData.u2KeySize;
+
+        if( (ptr_result == NULL) || (resultLen < ((2u * keySize) + 1u))
+                || (lCrypto_Ecc_Point_IsPointArg(ptr_pointA, pointALen, keySize, false) == false)
+                || (lCrypto_Ecc_Point_IsPointArg(ptr_pointB, pointBLen, keySize, false) == false) )
+        {
+            ret_pointStat_en = CRYPTO_ECC_POINT_ERROR_ARG;
+        }
+        else
+        {
+            ret_pointStat_en = lCrypto_Ecc_Point_GetStatus(DRV_CRYPTO_ECC_PointAdd(&eccData, ptr_pointA, ptr_pointB, ptr_result));
+        }
+    }
+
+    return ret_pointStat_en;
+}
+
+crypto_Ecc_Point_Status_E Crypto_Ecc_Point_DualMul(crypto_EccCurveType_E eccCurveType_En, uint8_t *ptr_k1, uint32_t k1Len,
+                                                   uint8_t *ptr_point1, uint32_t point1Len, uint8_t *ptr_k2, uint32_t k2Len,
+                                                   uint8_t *ptr_point2, uint32_t point2Len, uint8_t *ptr_result, uint32_t resultLen)
+{
+    CPKCL_ECC_DATA eccData;
+    CRYPTO_CPKCL_RESULT hwResult;
+    uint32_t keySize;
+    crypto_Ecc_Point_Status_E ret_pointStat_en = lCrypto_Ecc_Point_Init(eccCurveType_En, &eccData);
+
+    if(ret_pointStat_en == CRYPTO_ECC_POINT_SUCCESS)
+    {
+        keySize = eccData.u2KeySize;
+
+        if( (ptr_result == NULL) || (resultLen < ((2u * keySize) + 1u))
+                || (lCrypto_Ecc_Point_IsPointArg(ptr_point1, point1Len, keySize, true) == false)
+                || (lCrypto_Ecc_Point_IsPointArg(ptr_point2, point2Len, keySize, false) == false)
+                || (lCrypto_Ecc_Point_PadScalar(eccPointK1, ptr_k1, k1Len, keySize) == false)
+                || (lCrypto_Ecc_Point_PadScalar(eccPointK2, ptr_k2, k2Len, keySize) == false) )
+        {
+            ret_pointStat_en = CRYPTO_ECC_POINT_ERROR_ARG;
+        }
+        else
+        {
+            hwResult = DRV_CRYPTO_ECC_DualMul(&eccData, eccPointK1, ptr_point1, eccPointK2, ptr_point2, ptr_result);
+            if(hwResult == CRYPTO_CPKCL_RESULT_POINT_DEGENERATE)
+            {
+                hwResult = lCrypto_Ecc_Point_DualMulSeparate(&eccData, ptr_point1, ptr_point2, ptr_result);
+            }
+            ret_pointStat_en = lCrypto_Ecc_Point_GetStatus(hwResult);
+        }
+    }
+
+    return ret_pointStat_en;
+}
+
+crypto_Ecc_Point_Status_E Crypto_Ecc_Point_Decompress(crypto_EccCurveType_E eccCurveType_En, uint8_t *ptr_point, uint32_t pointLen,
+                                                      uint8_t *ptr_result, uint32_t resultLen)
+{
+    CPKCL_ECC_DATA eccData;
+    CRYPTO_CPKCL_CURVE hwCurve = CRYPTO_CPKCL_CURVE_P256;
+    uint32_t keySize;
+    crypto_Ecc_Point_Status_E ret_pointStat_en = lCrypto_Ecc_Point_Init(eccCurveType_En, &eccData);
+
+    if(ret_pointStat_en == CRYPTO_ECC_POINT_SUCCESS)
+    {
+        keySize = eccData.u2KeySize;
+        (void) lCrypto_Ecc_Point_GetHwCurve(eccCurveType_En, &hwCurve);
+
+        if( (ptr_point == NULL) || (pointLen != (keySize + 1u)) || ((ptr_point[0] != 0x02u) && (ptr_point[0] != 0x03u))
+                || (ptr_result == NULL) || (resultLen < ((2u * keySize) + 1u)) )
+        {
+            ret_pointStat_en = CRYPTO_ECC_POINT_ERROR_ARG;
+        }
+        else if(DRV_CRYPTO_ECC_SetPubKeyCoordinates(&eccData, (pfu1)ptr_point, (pfu1)&ptr_result[1],
+                                                    (pfu1)&ptr_result[1u + keySize], hwCurve)
+                    != CRYPTO_CPKCL_RESULT_CURVE_SUCCESS)
+        {
+            //X is not the abscissa of a point of the curve
+            ret_pointStat_en = CRYPTO_ECC_POINT_ERROR_FAIL;
+        }
+        else
+        {
+            ptr_result[0] = 0x04u;
+        }
+    }
+
+    return ret_pointStat_en;
+}
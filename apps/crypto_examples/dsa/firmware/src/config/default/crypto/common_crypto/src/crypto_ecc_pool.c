@@ -0,0 +1,442 @@
+/*******************************************************************************
+  MPLAB Harmony Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_ecc_pool.c
+
+  Summary:
+    Pool of precomputed ECC ephemeral key pairs.
+
+  Description:
+    This file fills a pool of (k, k*G) pairs from Crypto_Ecc_Pool_Tasks, using
+    the CPKCC key generation while the CPKCL self test passes and wolfCrypt
+    otherwise. A pair is cleared from the pool as soon as it is taken, so a
+    nonce or an ephemeral key is never used twice.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "crypto/common_crypto/crypto_ecc_pool.h"
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/drivers/driver/drv_crypto_ecc_hw_cpkcl.h"
+#include "crypto/wolfcrypt/crypto_common_wc_wrapper.h"
+#include "wolfssl/wolfcrypt/error-crypt.h"
+#include "wolfssl/wolfcrypt/random.h"
+#include "wolfssl/wolfcrypt/ecc.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_ECC_POOL_KEY_SIZE_MAX (CRYPTO_ECC_MAX_KEY_LENGTH)
+#define CRYPTO_ECC_POOL_POINT_SIZE_MAX ((2 * CRYPTO_ECC_MAX_KEY_LENGTH) + 1)
+
+typedef struct
+{
+    uint8_t k[CRYPTO_ECC_POOL_KEY_SIZE_MAX];
+    uint8_t kG[CRYPTO_ECC_POOL_POINT_SIZE_MAX];
+}crypto_Ecc_Pool_Entry_T;
+
+static crypto_Ecc_Pool_Entry_T eccPoolEntry_st[CRYPTO_ECC_POOL_SIZE];
+static uint32_t eccPoolCount = 0u;
+static crypto_EccCurveType_E eccPoolCurve_en = CRYPTO_ECC_CURVE_INVALID;
+static uint32_t eccPoolKeySize = 0u;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static CRYPTO_CPKCL_CURVE lCrypto_Ecc_Pool_GetHwCurve(crypto_EccCurveType_E eccCurveType_En)
+{
+    CRYPTO_CPKCL_CURVE hwCurve;
+
+    switch(eccCurveType_En)
+    {
+        case CRYPTO_ECC_CURVE_P192:
+            hwCurve = CRYPTO_CPKCL_CURVE_P192;
+            break;
+
+        case CRYPTO_ECC_CURVE_P224:
+            hwCurve = CRYPTO_CPKCL_CURVE_P224;
+            break;
+
+        case CRYPTO_ECC_CURVE_P256:
+            hwCurve = CRYPTO_CPKCL_CURVE_P256;
+            break;
+
+        case CRYPTO_ECC_CURVE_P384:
+            hwCurve = CRYPTO_CPKCL_CURVE_P384;
+            break;
+
+        case CRYPTO_ECC_CURVE_BRAINPOOLP256R1:
+            hwCurve = CRYPTO_CPKCL_CURVE_BP256R1;
+            break;
+
+        case CRYPTO_ECC_CURVE_BRAINPOOLP384R1:
+            hwCurve = CRYPTO_CPKCL_CURVE_BP384R1;
+            break;
+
+        case CRYPTO_ECC_CURVE_SECP256K1:
+            hwCurve = CRYPTO_CPKCL_CURVE_SECP256K1;
+            break;
+
+        default:
+            hwCurve = CRYPTO_CPKCL_CURVE_P521;
+            break;
+    }
+
+    return hwCurve;
+}
+
+//Key generation on the CPKCC. The CPKCL services are blocking, so the CPKCC is free whenever this runs from the
+//application task; it leaves the BASE_SCA_MUL_* constants in the crypto RAM and the next signature reloads its own.
+static crypto_Ecc_Pool_Status_E lCrypto_Ecc_Pool_Hw_Generate(uint8_t *ptr_k, uint8_t *ptr_kG)
+{
+    crypto_Ecc_Pool_Status_E ret_poolStat_en = CRYPTO_ECC_POOL_ERROR_FAIL;
+    CPKCL_ECC_DATA eccData;
+
+    if(DRV_CRYPTO_ECC_CheckCpkcl() == CRYPTO_CPKCL_RESULT_INIT_SUCCESS)
+    {
+        if( (DRV_CRYPTO_ECC_InitCurveParams(&eccData, lCrypto_Ecc_Pool_GetHwCurve(eccPoolCurve_en)) == CRYPTO_CPKCL_RESULT_CURVE_SUCCESS)
+                && (DRV_CRYPTO_ECC_KeyGen(&eccData, (pfu1)ptr_k, (pfu1)ptr_kG) == CRYPTO_CPKCL_RESULT_KEYGEN_SUCCESS) )
+        {
+            ret_poolStat_en = CRYPTO_ECC_POOL_SUCCESS;
+        }
+    }
+
+    return ret_poolStat_en;
+}
+
+static crypto_Ecc_Pool_Status_E lCrypto_Ecc_Pool_Wc_Generate(uint8_t *ptr_k, uint8_t *ptr_kG)
+{
+    crypto_Ecc_Pool_Status_E ret_poolStat_en = CRYPTO_ECC_POOL_ERROR_FAIL;
+    ecc_key wcEccKey_st;
+    WC_RNG wcRng_st;
+    int wcEccCurveId = Crypto_Common_Wc_Ecc_GetWcCurveId(eccPoolCurve_en);
+    int wcPoolStat;
+    word32 kLen = eccPoolKeySize;
+    word32 kGLen = (2u * eccPoolKeySize) + 1u;
+
+    wcPoolStat = wc_InitRng(&wcRng_st);
+
+    if(wcPoolStat == 0)
+    {
+        wcPoolStat = wc_ecc_init(&wcEccKey_st);
+
+        if(wcPoolStat == 0)
+        {
+            wcPoolStat = wc_ecc_make_key_ex(&wcRng_st, (int)eccPoolKeySize, &wcEccKey_st, wcEccCurveId);
+
+            if(wcPoolStat == 0)
+            {
+                wcPoolStat = wc_ecc_export_private_only(&wcEccKey_st, ptr_k, &kLen);
+            }
+            if(wcPoolStat == 0)
+            {
+                wcPoolStat = wc_ecc_export_x963(&wcEccKey_st, ptr_kG, &kGLen);
+            }
+            (void)wc_ecc_free(&wcEccKey_st);
+        }
+        (void)wc_FreeRng(&wcRng_st);
+    }
+
+    if(wcPoolStat == 0)
+    {
+        ret_poolStat_en = CRYPTO_ECC_POOL_SUCCESS;
+    }
+
+    return ret_poolStat_en;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Ecc_Pool_Status_E Crypto_Ecc_Pool_Init(crypto_EccCurveType_E eccCurveType_En)
+{
+    crypto_Ecc_Pool_Status_E ret_poolStat_en = CRYPTO_ECC_POOL_SUCCESS;
+    int wcEccCurveId = Crypto_Common_Wc_Ecc_GetWcCurveId(eccCurveType_En);
+
+    Crypto_Ecc_Pool_Deinit();
+
+    if(wcEccCurveId == (int)ECC_CURVE_INVALID)
+    {
+        ret_poolStat_en = CRYPTO_ECC_POOL_ERROR_CURVE;
+    }
+    else
+    {
+        eccPoolKeySize = (uint32_t)wc_ecc_get_curve_size_from_id(wcEccCurveId);
+        eccPoolCurve_en = eccCurveType_En;
+    }
+
+    return ret_poolStat_en;
+}
+
+void Crypto_Ecc_Pool_Deinit(void)
+{
+    (void) memset(eccPoolEntry_st, 0, sizeof(eccPoolEntry_st));
+    eccPoolCount = 0u;
+    eccPoolKeySize = 0u;
+    eccPoolCurve_en = CRYPTO_ECC_CURVE_INVALID;
+}
+
+crypto_Ecc_Pool_Status_E Crypto_Ecc_Pool_Tasks(void)
+{
+    crypto_Ecc_Pool_Status_E ret_poolStat_en = CRYPTO_ECC_POOL_FULL;
+    crypto_Ecc_Pool_Entry_T *ptr_entry_st;
+
+    if( (eccPoolCurve_en != CRYPTO_ECC_CURVE_INVALID) && (eccPoolCount < CRYPTO_ECC_POOL_SIZE) )
+    {
+        ptr_entry_st = &eccPoolEntry_st[eccPoolCount];
+
+        ret_poolStat_en = lCrypto_Ecc_Pool_Hw_Generate(ptr_entry_st->k, ptr_entry_st->kG);
+
+        if(ret_poolStat_en != CRYPTO_ECC_POOL_SUCCESS)
+        {
+            ret_poolStat_en = lCrypto_Ecc_Pool_Wc_Generate(ptr_entry_st->k, ptr_entry_st->kG);
+        }
+
+        if(ret_poolStat_en == CRYPTO_ECC_POOL_SUCCESS)
+        {
+            eccPoolCount++;
+        }
+        else
+        {
+            (void) memset(ptr_entry_st, 0, sizeof(crypto_Ecc_Pool_Entry_T));
+        }
+    }
+
+    return ret_poolStat_en;
+}
+
+uint32_t Crypto_Ecc_Pool_Count(crypto_EccCurveType_E eccCurveType_En)
+{
+    uint32_t count = 0u;
+
+    if( (eccCurveType_En != CRYPTO_ECC_CURVE_INVALID) && (eccCurveType_En == eccPoolCurve_en) )
+    {
+        count = eccPoolCount;
+    }
+
+    return count;
+}
+
+crypto_Ecc_Pool_Status_E Crypto_Ecc_Pool_Take(crypto_EccCurveType_E eccCurveType_En, uint8_t *ptr_k, uint32_t kLen,
+                                              uint8_t *ptr_kG, uint32_t kGLen)
+{
+    crypto_Ecc_Pool_Status_E ret_poolStat_en = CRYPTO_ECC_POOL_SUCCESS;
+    crypto_Ecc_Pool_Entry_T *ptr_entry_st;
+
+    if(Crypto_Ecc_Pool_Count(eccCurveType_En) == 0u)
+    {
+        ret_poolStat_en = CRYPTO_ECC_POOL_EMPTY;
+    }
+    else if( (ptr_k == NULL) || (kLen < eccPoolKeySize) )
+    {
+        ret_poolStat_en = CRYPTO_ECC_POOL_ERROR_ARG;
+    }
+    else if( (ptr_kG == NULL) || (kGLen < ((2u * eccPoolKeySize) + 1u)) )
+    {
+        ret_poolStat_en = CRYPTO_ECC_POOL_ERROR_ARG;
+    }
+    else
+    {
+        eccPoolCount--;
+        ptr_entry_st = &eccPoolEntry_st[eccPoolCount];
+
+        (void) memcpy(ptr_k, ptr_entry_st->k, eccPoolKeySize);
+        (void) memcpy(ptr_kG, ptr_entry_st->kG, (2u * eccPoolKeySize) + 1u);
+        (void) memset(ptr_entry_st, 0, sizeof(crypto_Ecc_Pool_Entry_T));
+    }
+
+    return ret_poolStat_en;
+}
+
+crypto_Ecc_Pool_Status_E Crypto_Ecc_Pool_EcdsaSignNonce(crypto_EccCurveType_E eccCurveType_En, uint8_t *ptr_k, uint32_t kLen,
+                                                        uint8_t *ptr_kG, uint32_t kGLen, uint8_t *ptr_inputHash, uint32_t hashLen,
+                                                        uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_outSig, uint32_t sigLen)
+{
+    crypto_Ecc_Pool_Status_E ret_poolStat_en = CRYPTO_ECC_POOL_SUCCESS;
+    const ecc_set_type *ptr_curveParams = NULL;
+    int curveSize = wc_ecc_get_curve_size_from_id(Crypto_Common_Wc_Ecc_GetWcCurveId(eccCurveType_En));
+    uint32_t keySize = (curveSize > 0) ? (uint32_t)curveSize : 0u;
+    int orderBits;
+    int wcPoolStat;
+    mp_digit mp = 0u;
+    mp_int n, e, d, r, s, t;
+
+    if(keySize == 0u)
+    {
+        ret_poolStat_en = CRYPTO_ECC_POOL_ERROR_CURVE;
+    }
+    else if( (ptr_k == NULL) || (kLen != keySize) || (ptr_kG == NULL) || (kGLen != ((2u * keySize) + 1u)) )
+    {
+        ret_poolStat_en = CRYPTO_ECC_POOL_ERROR_ARG;
+    }
+    else if( (ptr_inputHash == NULL) || (hashLen == 0u) || (ptr_privKey == NULL) || (privKeyLen == 0u)
+            || (ptr_outSig == NULL) || (sigLen < (2u * keySize)) || (privKeyLen > keySize) )
+    {
+        ret_poolStat_en = CRYPTO_ECC_POOL_ERROR_ARG;
+    }
+    else
+    {
+        //Arguments valid
+    }
+
+    if(ret_poolStat_en == CRYPTO_ECC_POOL_SUCCESS)
+    {
+        ptr_curveParams = wc_ecc_get_curve_params(wc_ecc_get_curve_idx(Crypto_Common_Wc_Ecc_GetWcCurveId(eccCurveType_En)));
+        wcPoolStat = mp_init_multi(&n, &e, &d, &r, &s, &t);
+
+        if( (wcPoolStat == MP_OKAY) && (ptr_curveParams != NULL) )
+        {
+            wcPoolStat = mp_read_radix(&n, ptr_curveParams->order, MP_RADIX_HEX);
+
+            //e is the leftmost bits of the hash, as many as in the order
+            if(wcPoolStat == MP_OKAY)
+            {
+                wcPoolStat = mp_read_unsigned_bin(&e, ptr_inputHash, hashLen);
+            }
+            orderBits = mp_count_bits(&n);
+            if( (wcPoolStat == MP_OKAY) && (((int)hashLen * 8) > orderBits) )
+            {
+                wcPoolStat = mp_rshb(&e, ((int)hashLen * 8) - orderBits);
+            }
+            if(wcPoolStat == MP_OKAY)
+            {
+                wcPoolStat = mp_read_unsigned_bin(&d, ptr_privKey, privKeyLen);
+            }
+
+            //r = x(k*G) mod n
+            if(wcPoolStat == MP_OKAY)
+            {
+                wcPoolStat = mp_read_unsigned_bin(&t, &ptr_kG[1], keySize);
+            }
+            if(wcPoolStat == MP_OKAY)
+            {
+                wcPoolStat = mp_mod(&t, &n, &r);
+            }
+
+            //s = k^-1 (e + r*d) mod n
+            if(wcPoolStat == MP_OKAY)
+            {
+                wcPoolStat = mp_mulmod(&r, &d, &n, &s);
+            }
+            if(wcPoolStat == MP_OKAY)
+            {
+                wcPoolStat = mp_addmod(&s, &e, &n, &t);
+            }
+            if(wcPoolStat == MP_OKAY)
+            {
+                wcPoolStat = mp_read_unsigned_bin(&d, ptr_k, keySize);
+            }
+
+            //k^-1 as k^(n-2) on the Montgomery form, in constant time: mp_invmod is a
+            //binary GCD whose run time depends on the nonce
+            if(wcPoolStat == MP_OKAY)
+            {
+                wcPoolStat = mp_montgomery_setup(&n, &mp);
+            }
+            if(wcPoolStat == MP_OKAY)
+            {
+                wcPoolStat = mp_montgomery_calc_normalization(&s, &n);
+            }
+            if(wcPoolStat == MP_OKAY)
+            {
+                wcPoolStat = mp_mulmod(&d, &s, &n, &e);
+            }
+            if(wcPoolStat == MP_OKAY)
+            {
+                wcPoolStat = mp_invmod_mont_ct(&e, &n, &d, mp);
+            }
+            if(wcPoolStat == MP_OKAY)
+            {
+                wcPoolStat = mp_montgomery_reduce(&d, &n, mp);
+            }
+            if(wcPoolStat == MP_OKAY)
+            {
+                wcPoolStat = mp_mulmod(&d, &t, &n, &s);
+            }
+
+            if( (wcPoolStat == MP_OKAY) && ((mp_iszero(&r) == MP_YES) || (mp_iszero(&s) == MP_YES)) )
+            {
+                wcPoolStat = MP_VAL;
+            }
+            if(wcPoolStat == MP_OKAY)
+            {
+                wcPoolStat = mp_to_unsigned_bin_len(&r, ptr_outSig, (int)keySize);
+            }
+            if(wcPoolStat == MP_OKAY)
+            {
+                wcPoolStat = mp_to_unsigned_bin_len(&s, &ptr_outSig[keySize], (int)keySize);
+            }
+        }
+        else
+        {
+            wcPoolStat = MP_VAL;
+        }
+
+        //d and e hold the nonce and its inverse, t depends on the private key
+        mp_forcezero(&d);
+        mp_forcezero(&e);
+        mp_forcezero(&t);
+        mp_clear(&n);
+        mp_clear(&r);
+        mp_clear(&s);
+
+        if(wcPoolStat != MP_OKAY)
+        {
+            ret_poolStat_en = CRYPTO_ECC_POOL_ERROR_FAIL;
+        }
+    }
+
+    return ret_poolStat_en;
+}
+
+crypto_Ecc_Pool_Status_E Crypto_Ecc_Pool_EcdsaSign(crypto_EccCurveType_E eccCurveType_En, uint8_t *ptr_inputHash, uint32_t hashLen,
+                                                   uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_outSig, uint32_t sigLen)
+{
+    crypto_Ecc_Pool_Status_E ret_poolStat_en;
+    uint8_t k[CRYPTO_ECC_POOL_KEY_SIZE_MAX];
+    uint8_t kG[CRYPTO_ECC_POOL_POINT_SIZE_MAX];
+    uint32_t keySize = eccPoolKeySize;
+
+    if(Crypto_Ecc_Pool_Count(eccCurveType_En) == 0u)
+    {
+        ret_poolStat_en = CRYPTO_ECC_POOL_EMPTY;
+    }
+    else if( (ptr_inputHash == NULL) || (hashLen == 0u) || (ptr_privKey == NULL) || (privKeyLen == 0u)
+            || (ptr_outSig == NULL) || (sigLen < (2u * keySize)) || (privKeyLen > keySize) )
+    {
+        ret_poolStat_en = CRYPTO_ECC_POOL_ERROR_ARG;
+    }
+    else
+    {
+        ret_poolStat_en = Crypto_Ecc_Pool_Take(eccCurveType_En, k, sizeof(k), kG, sizeof(kG));
+    }
+
+    if(ret_poolStat_en == CRYPTO_ECC_POOL_SUCCESS)
+    {
+        ret_poolStat_en = Crypto_Ecc_Pool_EcdsaSignNonce(eccCurveType_En, k, keySize, kG, (2u * keySize) + 1u,
+                                                          ptr_inputHash, hashLen, ptr_privKey, privKeyLen, ptr_outSig, sigLen);
+    }
+
+    (void) memset(k, 0, sizeof(k));
+    (void) memset(kG, 0, sizeof(kG));
+
+    return ret_poolStat_en;
+}
@@ -0,0 +1,422 @@
+/*******************************************************************************
+  MPLAB Harmony Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_ecqv.c
+
+  Summary:
+    ECQV implicit certificates (SEC 4) on the CPKCC.
+
+  Description:
+    This file issues ECQV certificates and reconstructs their keys. The point
+    operations go through crypto_ecc_point.h, the CA key k through
+    Crypto_DigiSign_Ecc_KeyGen and the certificate hash through the SHA
+    engine. The values modulo the order are computed on wolfCrypt integers,
+    as the nonce signatures of the ECC pool. k, the request private key and
+    the derived private key only live in the buffers of the caller and on the
+    stack, which is cleared before returning.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "crypto/common_crypto/crypto_ecqv.h"
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_ecc_point.h"
+#include "crypto/common_crypto/crypto_hash.h"
+#include "crypto/common_crypto/crypto_digsign.h"
+#include "crypto/wolfcrypt/crypto_common_wc_wrapper.h"
+#include "wolfssl/wolfcrypt/error-crypt.h"
+#include "wolfssl/wolfcrypt/ecc.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_ECQV_POINT_SIZE_MAX ((2 * CRYPTO_ECC_MAX_KEY_LENGTH) + 1)
+#define CRYPTO_ECQV_DIGEST_SIZE_MAX (64u)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+//Curve size in bytes, 0 when wolfCrypt does not know the curve
+static uint32_t lCrypto_Ecqv_GetKeySize(crypto_EccCurveType_E eccCurveType_en)
+{
+    int curveSize = wc_ecc_get_curve_size_from_id(Crypto_Common_Wc_Ecc_GetWcCurveId(eccCurveType_en));
+
+    return (curveSize > 0) ? (uint32_t)curveSize : 0u;
+}
+
+static crypto_Ecqv_Status_E lCrypto_Ecqv_GetPointStatus(crypto_Ecc_Point_Status_E pointStat_en)
+{
+    crypto_Ecqv_Status_E ret_ecqvStat_en;
+
+    switch(pointStat_en)
+    {
+        case CRYPTO_ECC_POINT_SUCCESS:
+            ret_ecqvStat_en = CRYPTO_ECQV_SUCCESS;
+            break;
+
+        case CRYPTO_ECC_POINT_INFINITY:
+            ret_ecqvStat_en = CRYPTO_ECQV_ERROR_CERT;
+            break;
+
+        case CRYPTO_ECC_POINT_ERROR_CURVE:
+            ret_ecqvStat_en = CRYPTO_ECQV_ERROR_CURVE;
+            break;
+
+        case CRYPTO_ECC_POINT_ERROR_ARG:
+            ret_ecqvStat_en = CRYPTO_ECQV_ERROR_ARG;
+            break;
+
+        default:
+            ret_ecqvStat_en = CRYPTO_ECQV_ERROR_FAIL;
+            break;
+    }
+
+    return ret_ecqvStat_en;
+}
+
+//Reads the order n of the curve
+static int lCrypto_Ecqv_ReadOrder(crypto_EccCurveType_E eccCurveType_en, mp_int *ptr_n)
+{
+    const ecc_set_type *ptr_curveParams = wc_ecc_get_curve_params(wc_ecc_get_curve_idx(Crypto_Common_Wc_Ecc_GetWcCurveId(eccCurveType_en)));
+    int wcEcqvStat = MP_VAL;
+
+    if(ptr_curveParams != NULL)
+    {
+        wcEcqvStat = mp_read_radix(ptr_n, ptr_curveParams->order, MP_RADIX_HEX);
+    }
+
+    return wcEcqvStat;
+}
+
+//e = Hn(Cert) on keySize bytes: the SHA of the certificate on the engine, with the hash of the curve size, truncated
+//to the bit length of the order n and reduced modulo n
+static crypto_Ecqv_Status_E lCrypto_Ecqv_HashCert(crypto_EccCurveType_E eccCurveType_en, uint8_t *ptr_cert, uint32_t certLen,
+                                                  uint8_t *ptr_e, uint32_t keySize)
+{
+    crypto_Ecqv_Status_E ret_ecqvStat_en = CRYPTO_ECQV_SUCCESS;
+    crypto_Hash_Algo_E hashAlgo_en;
+    //The digest is words for the SHA engine, which writes it 32 bits at a time
+    uint32_t digest[CRYPTO_ECQV_DIGEST_SIZE_MAX / 4u];
+    uint32_t digestLen;
+    int orderBits;
+    int wcEcqvStat;
+    mp_int n, e;
+
+    if(keySize <= 32u)
+    {
+        hashAlgo_en = CRYPTO_HASH_SHA2_256;
+        digestLen = 32u;
+    }
+    else if(keySize <= 48u)
+    {
+        hashAlgo_en = CRYPTO_HASH_SHA2_384;
+        digestLen = 48u;
+    }
+    else
+    {
+        hashAlgo_en = CRYPTO_HASH_SHA2_512;
+        digestLen = 64u;
+    }
+
+    if(Crypto_Hash_Sha_Digest(CRYPTO_HANDLER_HW_INTERNAL, ptr_cert, certLen, (uint8_t*)digest, hashAlgo_en, 1) != CRYPTO_HASH_SUCCESS)
+    {
+        ret_ecqvStat_en = CRYPTO_ECQV_ERROR_HASH;
+    }
+    else
+    {
+        wcEcqvStat = mp_init_multi(&n, &e, NULL, NULL, NULL, NULL);
+
+        if(wcEcqvStat == MP_OKAY)
+        {
+            wcEcqvStat = lCrypto_Ecqv_ReadOrder(eccCurveType_en, &n);
+        }
+        if(wcEcqvStat == MP_OKAY)
+        {
+            wcEcqvStat = mp_read_unsigned_bin(&e, (uint8_t*)digest, digestLen);
+        }
+        orderBits = mp_count_bits(&n);
+        if( (wcEcqvStat == MP_OKAY) && (((int)digestLen * 8) > orderBits) )
+        {
+            wcEcqvStat = mp_rshb(&e, ((int)digestLen * 8) - orderBits);
+        }
+        if(wcEcqvStat == MP_OKAY)
+        {
+            wcEcqvStat = mp_mod(&e, &n, &e);
+        }
+        if(wcEcqvStat == MP_OKAY)
+        {
+            wcEcqvStat = mp_to_unsigned_bin_len(&e, ptr_e, (int)keySize);
+        }
+
+        mp_clear(&n);
+        mp_clear(&e);
+
+        if(wcEcqvStat != MP_OKAY)
+        {
+            ret_ecqvStat_en = CRYPTO_ECQV_ERROR_FAIL;
+        }
+    }
+
+    return ret_ecqvStat_en;
+}
+
+//ptr_result = e*a + b mod n on keySize bytes, e being reduced on keySize bytes
+static crypto_Ecqv_Status_E lCrypto_Ecqv_MulAddModN(crypto_EccCurveType_E eccCurveType_en, uint8_t *ptr_e, uint8_t *ptr_a,
+                                                    uint32_t aLen, uint8_t *ptr_b, uint32_t bLen, uint8_t *ptr_result,
+                                                    uint32_t keySize)
+{
+    crypto_Ecqv_Status_E ret_ecqvStat_en = CRYPTO_ECQV_SUCCESS;
+    int wcEcqvStat;
+    mp_int n, e, a, t;
+
+    wcEcqvStat = mp_init_multi(&n, &e, &a, &t, NULL, NULL);
+
+    if(wcEcqvStat == MP_OKAY)
+    {
+        wcEcqvStat = lCrypto_Ecqv_ReadOrder(eccCurveType_en, &n);
+    }
+    if(wcEcqvStat == MP_OKAY)
+    {
+        wcEcqvStat = mp_read_unsigned_bin(&e, ptr_e, keySize);
+    }
+    if(wcEcqvStat == MP_OKAY)
+    {
+        wcEcqvStat = mp_read_unsigned_bin(&a, ptr_a, aLen);
+    }
+    if(wcEcqvStat == MP_OKAY)
+    {
+        wcEcqvStat = mp_mulmod(&e, &a, &n, &t);
+    }
+    if(wcEcqvStat == MP_OKAY)
+    {
+        wcEcqvStat = mp_read_unsigned_bin(&a, ptr_b, bLen);
+    }
+    if(wcEcqvStat == MP_OKAY)
+    {
+        wcEcqvStat = mp_addmod(&t, &a, &n, &e);
+    }
+    if(wcEcqvStat == MP_OKAY)
+    {
+        wcEcqvStat = mp_to_unsigned_bin_len(&e, ptr_result, (int)keySize);
+    }
+
+    //a holds a private key, e and t the values derived from it
+    mp_forcezero(&a);
+    mp_forcezero(&e);
+    mp_forcezero(&t);
+    mp_clear(&n);
+
+    if(wcEcqvStat != MP_OKAY)
+    {
+        ret_ecqvStat_en = CRYPTO_ECQV_ERROR_FAIL;
+    }
+
+    return ret_ecqvStat_en;
+}
+
+//Q_U = e*P_U + Q_CA, e being written to ptr_e on keySize bytes. The arguments are checked by the caller.
+static crypto_Ecqv_Status_E lCrypto_Ecqv_Reconstruct(crypto_EccCurveType_E eccCurveType_en, uint32_t keySize, uint8_t *ptr_cert,
+                                                     uint32_t certLen, uint8_t *ptr_caPubKey, uint8_t *ptr_e, uint8_t *ptr_pubKey)
+{
+    crypto_Ecqv_Status_E ret_ecqvStat_en;
+    crypto_Ecc_Point_Status_E pointStat_en;
+    uint8_t pointU[CRYPTO_ECQV_POINT_SIZE_MAX];
+    uint8_t one = 0x01u;
+    uint32_t pointSize = (2u * keySize) + 1u;
+
+    pointStat_en = Crypto_Ecc_Point_Decompress(eccCurveType_en, ptr_cert, keySize + 1u, pointU, pointSize);
+    if(pointStat_en == CRYPTO_ECC_POINT_ERROR_FAIL)
+    {
+        ret_ecqvStat_en = CRYPTO_ECQV_ERROR_CERT;
+    }
+    else
+    {
+        ret_ecqvStat_en = lCrypto_Ecqv_GetPointStatus(pointStat_en);
+    }
+
+    if(ret_ecqvStat_en == CRYPTO_ECQV_SUCCESS)
+    {
+        ret_ecqvStat_en = lCrypto_Ecqv_HashCert(eccCurveType_en, ptr_cert, certLen, ptr_e, keySize);
+    }
+
+    //e and the points are public, the one pass double scalar multiplication applies
+    if(ret_ecqvStat_en == CRYPTO_ECQV_SUCCESS)
+    {
+        ret_ecqvStat_en = lCrypto_Ecqv_GetPointStatus(Crypto_Ecc_Point_DualMul(eccCurveType_en, ptr_e, keySize, pointU, pointSize,
+                                                                               &one, 1u, ptr_caPubKey, pointSize, ptr_pubKey, pointSize));
+    }
+
+    return ret_ecqvStat_en;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: ECQV Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Ecqv_Status_E Crypto_Ecqv_Issue(crypto_EccCurveType_E eccCurveType_en, uint8_t *ptr_caPrivKey, uint32_t caPrivKeyLen,
+                                       uint8_t *ptr_requestPoint, uint32_t requestPointLen, uint8_t *ptr_certInfo, uint32_t certInfoLen,
+                                       uint8_t *ptr_cert, uint32_t certLen, uint8_t *ptr_r, uint32_t rLen)
+{
+    crypto_Ecqv_Status_E ret_ecqvStat_en = CRYPTO_ECQV_SUCCESS;
+    uint8_t e[CRYPTO_ECC_MAX_KEY_LENGTH];
+    uint8_t k[CRYPTO_ECC_MAX_KEY_LENGTH];
+    uint8_t kG[CRYPTO_ECQV_POINT_SIZE_MAX];
+    uint8_t pointU[CRYPTO_ECQV_POINT_SIZE_MAX];
+    uint32_t keySize = lCrypto_Ecqv_GetKeySize(eccCurveType_en);
+    uint32_t pointSize = (2u * keySize) + 1u;
+
+    if(keySize == 0u)
+    {
+        ret_ecqvStat_en = CRYPTO_ECQV_ERROR_CURVE;
+    }
+    else if( (ptr_caPrivKey == NULL) || (caPrivKeyLen == 0u) || (caPrivKeyLen > keySize)
+            || (ptr_requestPoint == NULL) || (requestPointLen != pointSize) || (ptr_requestPoint[0] != 0x04u)
+            || ((ptr_certInfo == NULL) && (certInfoLen != 0u)) )
+    {
+        ret_ecqvStat_en = CRYPTO_ECQV_ERROR_ARG;
+    }
+    else if( (ptr_cert == NULL) || (certLen < CRYPTO_ECQV_CERT_SIZE(keySize, certInfoLen)) || (ptr_r == NULL) || (rLen < keySize) )
+    {
+        ret_ecqvStat_en = CRYPTO_ECQV_ERROR_ARG;
+    }
+    else
+    {
+        //Arguments valid
+    }
+
+    //P_U = R_U + k*G
+    if(ret_ecqvStat_en == CRYPTO_ECQV_SUCCESS)
+    {
+        if(Crypto_DigiSign_Ecc_KeyGen(CRYPTO_HANDLER_HW_INTERNAL, k, keySize, kG, pointSize, eccCurveType_en, 1) != CRYPTO_DIGISIGN_SUCCESS)
+        {
+            ret_ecqvStat_en = CRYPTO_ECQV_ERROR_FAIL;
+        }
+        else
+        {
+            ret_ecqvStat_en = lCrypto_Ecqv_GetPointStatus(Crypto_Ecc_Point_Add(eccCurveType_en, ptr_requestPoint, pointSize,
+                                                                               kG, pointSize, pointU, pointSize));
+        }
+    }
+
+    //Cert = P_U compressed || certificate information
+    if(ret_ecqvStat_en == CRYPTO_ECQV_SUCCESS)
+    {
+        ptr_cert[0] = 0x02u | (pointU[2u * keySize] & 0x01u);
+        (void) memcpy(&ptr_cert[1], &pointU[1], keySize);
+        if(certInfoLen != 0u)
+        {
+            (void) memcpy(&ptr_cert[keySize + 1u], ptr_certInfo, certInfoLen);
+        }
+
+        ret_ecqvStat_en = lCrypto_Ecqv_HashCert(eccCurveType_en, ptr_cert, CRYPTO_ECQV_CERT_SIZE(keySize, certInfoLen), e, keySize);
+    }
+
+    //r = e*k + d_CA mod n
+    if(ret_ecqvStat_en == CRYPTO_ECQV_SUCCESS)
+    {
+        ret_ecqvStat_en = lCrypto_Ecqv_MulAddModN(eccCurveType_en, e, k, keySize, ptr_caPrivKey, caPrivKeyLen, ptr_r, keySize);
+    }
+
+    (void) memset(k, 0, sizeof(k));
+
+    return ret_ecqvStat_en;
+}
+
+crypto_Ecqv_Status_E Crypto_Ecqv_PublicKey(crypto_EccCurveType_E eccCurveType_en, uint8_t *ptr_cert, uint32_t certLen,
+                                           uint8_t *ptr_caPubKey, uint32_t caPubKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen)
+{
+    crypto_Ecqv_Status_E ret_ecqvStat_en = CRYPTO_ECQV_SUCCESS;
+    uint8_t e[CRYPTO_ECC_MAX_KEY_LENGTH];
+    uint32_t keySize = lCrypto_Ecqv_GetKeySize(eccCurveType_en);
+    uint32_t pointSize = (2u * keySize) + 1u;
+
+    if(keySize == 0u)
+    {
+        ret_ecqvStat_en = CRYPTO_ECQV_ERROR_CURVE;
+    }
+    else if( (ptr_cert == NULL) || (certLen < (keySize + 1u)) || (ptr_caPubKey == NULL) || (caPubKeyLen != pointSize)
+            || (ptr_caPubKey[0] != 0x04u) || (ptr_pubKey == NULL) || (pubKeyLen < pointSize) )
+    {
+        ret_ecqvStat_en = CRYPTO_ECQV_ERROR_ARG;
+    }
+    else
+    {
+        ret_ecqvStat_en = lCrypto_Ecqv_Reconstruct(eccCurveType_en, keySize, ptr_cert, certLen, ptr_caPubKey, e, ptr_pubKey);
+    }
+
+    return ret_ecqvStat_en;
+}
+
+crypto_Ecqv_Status_E Crypto_Ecqv_PrivateKey(crypto_EccCurveType_E eccCurveType_en, uint8_t *ptr_cert, uint32_t certLen,
+                                            uint8_t *ptr_r, uint32_t rLen, uint8_t *ptr_requestPrivKey, uint32_t requestPrivKeyLen,
+                                            uint8_t *ptr_caPubKey, uint32_t caPubKeyLen, uint8_t *ptr_privKey, uint32_t privKeyLen,
+                                            uint8_t *ptr_pubKey, uint32_t pubKeyLen)
+{
+    crypto_Ecqv_Status_E ret_ecqvStat_en = CRYPTO_ECQV_SUCCESS;
+    uint8_t e[CRYPTO_ECC_MAX_KEY_LENGTH];
+    uint8_t checkPoint[CRYPTO_ECQV_POINT_SIZE_MAX];
+    uint32_t keySize = lCrypto_Ecqv_GetKeySize(eccCurveType_en);
+    uint32_t pointSize = (2u * keySize) + 1u;
+
+    if(keySize == 0u)
+    {
+        ret_ecqvStat_en = CRYPTO_ECQV_ERROR_CURVE;
+    }
+    else if( (ptr_cert == NULL) || (certLen < (keySize + 1u)) || (ptr_caPubKey == NULL) || (caPubKeyLen != pointSize)
+            || (ptr_caPubKey[0] != 0x04u) || (ptr_pubKey == NULL) || (pubKeyLen < pointSize) )
+    {
+        ret_ecqvStat_en = CRYPTO_ECQV_ERROR_ARG;
+    }
+    else if( (ptr_r == NULL) || (rLen == 0u) || (rLen > keySize) || (ptr_requestPrivKey == NULL) || (requestPrivKeyLen == 0u)
+            || (requestPrivKeyLen > keySize) || (ptr_privKey == NULL) || (privKeyLen < keySize) )
+    {
+        ret_ecqvStat_en = CRYPTO_ECQV_ERROR_ARG;
+    }
+    else
+    {
+        ret_ecqvStat_en = lCrypto_Ecqv_Reconstruct(eccCurveType_en, keySize, ptr_cert, certLen, ptr_caPubKey, e, ptr_pubKey);
+    }
+
+    //d_U = e*k_U + r mod n
+    if(ret_ecqvStat_en == CRYPTO_ECQV_SUCCESS)
+    {
+        ret_ecqvStat_en = lCrypto_Ecqv_MulAddModN(eccCurveType_en, e, ptr_requestPrivKey, requestPrivKeyLen, ptr_r, rLen,
+                                                  ptr_privKey, keySize);
+    }
+
+    //d_U*G = Q_U, the CA value r is not trusted
+    if(ret_ecqvStat_en == CRYPTO_ECQV_SUCCESS)
+    {
+        ret_ecqvStat_en = lCrypto_Ecqv_GetPointStatus(Crypto_Ecc_Point_Mul(eccCurveType_en, ptr_privKey, keySize, NULL, 0u,
+                                                                           checkPoint, pointSize));
+        if( (ret_ecqvStat_en == CRYPTO_ECQV_ERROR_CERT)
+                || ((ret_ecqvStat_en == CRYPTO_ECQV_SUCCESS) && (memcmp(checkPoint, ptr_pubKey, pointSize) != 0)) )
+        {
+            ret_ecqvStat_en = CRYPTO_ECQV_ERROR_KEY;
+        }
+
+        if(ret_ecqvStat_en != CRYPTO_ECQV_SUCCESS)
+        {
+            (void) memset(ptr_privKey, 0, keySize);
+        }
+    }
+
+    return ret_ecqvStat_en;
+}
@@ -195,6 +195,12 @@ static crypto_Hash_Status_E Crypto_Hash_GetHashSize(crypto_Hash_Algo_E hashType_
         case CRYPTO_HASH_SHA2_256:
             *hashSize = 0x20;   //32 Bytes
             break;
+        case CRYPTO_HASH_SHA2_384:
+            *hashSize = 0x30;   //48 Bytes
+            break;
+        case CRYPTO_HASH_SHA2_512:
+            *hashSize = 0x40;   //64 Bytes
+            break;
         default:
             ret_val_en = CRYPTO_HASH_ERROR_NOTSUPPTED;
             break;    
@@ -213,6 +219,12 @@ uint32_t Crypto_Hash_GetHashAndHashSize(crypto_HandlerType_E shaHandler_en, cryp
         case CRYPTO_HASH_SHA2_256:
             hashStatus_en = Crypto_Hash_Sha_Digest(shaHandler_en, ptr_wcInputData, wcDataLen, ptr_outHash, CRYPTO_HASH_SHA2_256, 1); 
             break;            
+        case CRYPTO_HASH_SHA2_384:
+            hashStatus_en = Crypto_Hash_Sha_Digest(shaHandler_en, ptr_wcInputData, wcDataLen, ptr_outHash, CRYPTO_HASH_SHA2_384, 1); 
+            break;               
+        case CRYPTO_HASH_SHA2_512:
+            hashStatus_en = Crypto_Hash_Sha_Digest(shaHandler_en, ptr_wcInputData, wcDataLen, ptr_outHash, CRYPTO_HASH_SHA2_512, 1); 
+            break;              
         default:
             hashStatus_en = CRYPTO_HASH_ERROR_NOTSUPPTED;
             break;    
@@ -0,0 +1,297 @@
+/*******************************************************************************
+  MPLAB Harmony Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_rfc6979.c
+
+  Summary:
+    Deterministic ECDSA nonce generation (RFC 6979).
+
+  Description:
+    This file runs the HMAC_DRBG of RFC 6979 section 3.2 on byte strings. The
+    integers of the RFC are all below 2^qlen, they are kept MSB first on the
+    size of the order and the reduction modulo n is a single subtraction. K, V
+    and the candidates for k are cleared before returning.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "crypto/common_crypto/crypto_rfc6979.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_RFC6979_DIGEST_SIZE_MAX (64u)
+
+//Step h. loops until a candidate is in [1, n-1]. n has qlen bits, so it is at least 2^(qlen-1) and a candidate is
+//rejected with a chance below 1/2 on any curve: about 1/3 on brainpoolP256r1, 2^-32 on P-256. The loop gives up after
+//128 rejections in a row, which have a chance below 2^-128 and only guard against a broken HMAC.
+#define CRYPTO_RFC6979_RETRY_MAX (128u)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static uint32_t lCrypto_Rfc6979_GetDigestSize(crypto_Hash_Algo_E hashAlgo_en)
+{
+    uint32_t digestSize;
+
+    switch(hashAlgo_en)
+    {
+        case CRYPTO_HASH_SHA2_256:
+            digestSize = 32u;
+            break;
+        case CRYPTO_HASH_SHA2_384:
+            digestSize = 48u;
+            break;
+        case CRYPTO_HASH_SHA2_512:
+            digestSize = 64u;
+            break;
+        default:
+            digestSize = 0u;
+            break;
+    }
+    return digestSize;
+}
+
+//Bit length qlen of the order, MSB first with a non zero leading byte
+static uint32_t lCrypto_Rfc6979_OrderBits(uint8_t *ptr_order, uint32_t orderLen)
+{
+    uint32_t orderBits = (orderLen - 1u) * 8u;
+    uint8_t top = ptr_order[0];
+
+    while(top != 0u)
+    {
+        orderBits++;
+        top >>= 1u;
+    }
+    return orderBits;
+}
+
+//Compares two integers of len bytes MSB first: -1, 0 or 1
+static int32_t lCrypto_Rfc6979_Compare(uint8_t *ptr_a, uint8_t *ptr_b, uint32_t len)
+{
+    int32_t cmp = 0;
+    uint32_t i;
+
+    for(i = 0u; (i < len) && (cmp == 0); i++)
+    {
+        if(ptr_a[i] > ptr_b[i])
+        {
+            cmp = 1;
+        }
+        else if(ptr_a[i] < ptr_b[i])
+        {
+            cmp = -1;
+        }
+        else
+        {
+            //Same byte
+        }
+    }
+    return cmp;
+}
+
+//bits2int of the RFC on the order size: the leftmost qlen bits of ptr_in, zero extended when shorter
+static void lCrypto_Rfc6979_Bits2Int(uint8_t *ptr_in, uint32_t inLen, uint32_t orderBits, uint8_t *ptr_out,
+                                     uint32_t orderLen)
+{
+    uint32_t shift = (orderLen * 8u) - orderBits;
+    uint32_t i;
+
+    (void) memset(ptr_out, 0, orderLen);
+    if(inLen < orderLen)
+    {
+        //inLen * 8 is below qlen, nothing to truncate
+        (void) memcpy(&ptr_out[orderLen - inLen], ptr_in, inLen);
+    }
+    else
+    {
+        (void) memcpy(ptr_out, ptr_in, orderLen);
+        if(shift != 0u)
+        {
+            for(i = orderLen - 1u; i > 0u; i--)
+            {
+                ptr_out[i] = (uint8_t)((uint32_t)ptr_out[i] >> shift) | (uint8_t)((uint32_t)ptr_out[i - 1u] << (8u - shift));
+            }
+            ptr_out[0] = (uint8_t)((uint32_t)ptr_out[0] >> shift);
+        }
+    }
+}
+
+//a = a - n on len bytes MSB first, a is at least n
+static void lCrypto_Rfc6979_Sub(uint8_t *ptr_a, uint8_t *ptr_n, uint32_t len)
+{
+    uint32_t borrow = 0u;
+    uint32_t diff;
+    uint32_t i;
+
+    for(i = len; i > 0u; i--)
+    {
+        diff = (uint32_t)ptr_a[i - 1u] - (uint32_t)ptr_n[i - 1u] - borrow;
+        ptr_a[i - 1u] = (uint8_t)diff;
+        borrow = (diff >> 31u) & 1u;
+    }
+}
+
+static bool lCrypto_Rfc6979_IsZero(uint8_t *ptr_a, uint32_t len)
+{
+    uint8_t acc = 0u;
+    uint32_t i;
+
+    for(i = 0u; i < len; i++)
+    {
+        acc |= ptr_a[i];
+    }
+    return (acc == 0u);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: RFC 6979 Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Rfc6979_Status_E Crypto_Rfc6979_GenerateK(crypto_Rfc6979_Hmac_Fp hmac_fp, crypto_Hash_Algo_E hashAlgo_en,
+                                                 uint8_t *ptr_order, uint32_t orderLen, uint8_t *ptr_privKey,
+                                                 uint32_t privKeyLen, uint8_t *ptr_hash, uint32_t hashLen, uint8_t *ptr_k)
+{
+    crypto_Rfc6979_Status_E ret_rfc6979Stat_en = CRYPTO_RFC6979_SUCCESS;
+    //K and V are words for the HMAC of the SHA engine, which writes its digest 32 bits at a time
+    uint32_t hmacK[CRYPTO_RFC6979_DIGEST_SIZE_MAX / 4u];
+    uint32_t hmacV[CRYPTO_RFC6979_DIGEST_SIZE_MAX / 4u];
+    uint8_t privKeyOctets[CRYPTO_ECC_MAX_KEY_LENGTH];
+    uint8_t hashOctets[CRYPTO_ECC_MAX_KEY_LENGTH];
+    uint8_t t[CRYPTO_ECC_MAX_KEY_LENGTH + CRYPTO_RFC6979_DIGEST_SIZE_MAX];
+    uint8_t separator = 0x00u;
+    uint8_t *ptr_data[4];
+    uint32_t dataLen[4];
+    uint32_t digestSize;
+    uint32_t orderBits = 0u;
+    uint32_t tLen;
+    uint32_t retry = 0u;
+    bool kFound = false;
+    bool hmacOk = true;
+
+    digestSize = lCrypto_Rfc6979_GetDigestSize(hashAlgo_en);
+
+    if( (hmac_fp == NULL) || (ptr_order == NULL) || (ptr_privKey == NULL) || (ptr_hash == NULL) || (ptr_k == NULL)
+       || (orderLen == 0u) || (orderLen > (uint32_t)CRYPTO_ECC_MAX_KEY_LENGTH) || (privKeyLen == 0u)
+       || (privKeyLen > orderLen) || (hashLen == 0u) )
+    {
+        ret_rfc6979Stat_en = CRYPTO_RFC6979_ERROR_ARG;
+    }
+    else if(ptr_order[0] == 0u)
+    {
+        ret_rfc6979Stat_en = CRYPTO_RFC6979_ERROR_ARG;
+    }
+    else if(digestSize == 0u)
+    {
+        ret_rfc6979Stat_en = CRYPTO_RFC6979_ERROR_HASHTYPE;
+    }
+    else
+    {
+        orderBits = lCrypto_Rfc6979_OrderBits(ptr_order, orderLen);
+
+        //int2octets(x)
+        (void) memset(privKeyOctets, 0, sizeof(privKeyOctets));
+        (void) memcpy(&privKeyOctets[orderLen - privKeyLen], ptr_privKey, privKeyLen);
+
+        //bits2octets(h1): bits2int is below 2^qlen, so below 2n
+        lCrypto_Rfc6979_Bits2Int(ptr_hash, hashLen, orderBits, hashOctets, orderLen);
+        if(lCrypto_Rfc6979_Compare(hashOctets, ptr_order, orderLen) >= 0)
+        {
+            lCrypto_Rfc6979_Sub(hashOctets, ptr_order, orderLen);
+        }
+
+        //Steps b. to g.
+        (void) memset(hmacV, 0x01, digestSize);
+        (void) memset(hmacK, 0x00, digestSize);
+
+        ptr_data[0] = (uint8_t*)hmacV;
+        dataLen[0] = digestSize;
+        ptr_data[1] = &separator;
+        dataLen[1] = 1u;
+        ptr_data[2] = privKeyOctets;
+        dataLen[2] = orderLen;
+        ptr_data[3] = hashOctets;
+        dataLen[3] = orderLen;
+
+        for(separator = 0x00u; (separator <= 0x01u) && hmacOk; separator++)
+        {
+            hmacOk = hmac_fp(hashAlgo_en, (uint8_t*)hmacK, digestSize, ptr_data, dataLen, 4u, (uint8_t*)hmacK);
+            if(hmacOk)
+            {
+                hmacOk = hmac_fp(hashAlgo_en, (uint8_t*)hmacK, digestSize, ptr_data, dataLen, 1u, (uint8_t*)hmacV);
+            }
+        }
+
+        //Step h.
+        while(hmacOk && (!kFound) && (retry < CRYPTO_RFC6979_RETRY_MAX))
+        {
+            for(tLen = 0u; hmacOk && (tLen < orderLen); tLen += digestSize)
+            {
+                hmacOk = hmac_fp(hashAlgo_en, (uint8_t*)hmacK, digestSize, ptr_data, dataLen, 1u, (uint8_t*)hmacV);
+                (void) memcpy(&t[tLen], hmacV, digestSize);
+            }
+
+            if(hmacOk)
+            {
+                lCrypto_Rfc6979_Bits2Int(t, orderLen, orderBits, ptr_k, orderLen);
+                kFound = (!lCrypto_Rfc6979_IsZero(ptr_k, orderLen))
+                            && (lCrypto_Rfc6979_Compare(ptr_k, ptr_order, orderLen) < 0);
+
+                if(!kFound)
+                {
+                    //K = HMAC_K(V || 0x00), V = HMAC_K(V)
+                    separator = 0x00u;
+                    hmacOk = hmac_fp(hashAlgo_en, (uint8_t*)hmacK, digestSize, ptr_data, dataLen, 2u, (uint8_t*)hmacK);
+                    if(hmacOk)
+                    {
+                        hmacOk = hmac_fp(hashAlgo_en, (uint8_t*)hmacK, digestSize, ptr_data, dataLen, 1u, (uint8_t*)hmacV);
+                    }
+                    retry++;
+                }
+            }
+        }
+
+        if(!hmacOk)
+        {
+            ret_rfc6979Stat_en = CRYPTO_RFC6979_ERROR_HMAC;
+        }
+        else if(!kFound)
+        {
+            ret_rfc6979Stat_en = CRYPTO_RFC6979_ERROR_FAIL;
+        }
+        else
+        {
+            //k found
+        }
+
+        if(ret_rfc6979Stat_en != CRYPTO_RFC6979_SUCCESS)
+        {
+            (void) memset(ptr_k, 0, orderLen);
+        }
+    }
+
+    (void) memset(hmacK, 0, sizeof(hmacK));
+    (void) memset(hmacV, 0, sizeof(hmacV));
+    (void) memset(privKeyOctets, 0, sizeof(privKeyOctets));
+    (void) memset(hashOctets, 0, sizeof(hashOctets));
+    (void) memset(t, 0, sizeof(t));
+
+    return ret_rfc6979Stat_en;
+}
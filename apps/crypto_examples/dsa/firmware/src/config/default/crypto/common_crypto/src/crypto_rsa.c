@@ -0,0 +1,419 @@
+/*******************************************************************************
+  MPLAB Harmony Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_rsa.c
+
+  Summary:
+    RSA signature and decryption.
+
+  Description:
+    This file checks the arguments of the RSA operations and calls the CPKCC
+    or the wolfCrypt implementation of the handler.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include "crypto/common_crypto/crypto_rsa.h"
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/drivers/wrapper/crypto_rsa_cpkcc44163_wrapper.h"
+#include "crypto/wolfcrypt/crypto_rsa_wc_wrapper.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_RSA_SESSION_MAX (1)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static uint32_t lCrypto_Rsa_GetHashSize(crypto_Hash_Algo_E hashType_en)
+{
+    uint32_t hashSize;
+
+    switch(hashType_en)
+    {
+        case CRYPTO_HASH_SHA2_256:
+            hashSize = 32u;
+            break;
+        case CRYPTO_HASH_SHA2_384:
+            hashSize = 48u;
+            break;
+        case CRYPTO_HASH_SHA2_512:
+            hashSize = 64u;
+            break;
+        default:
+            hashSize = 0u;
+            break;
+    }
+    return hashSize;
+}
+
+static bool lCrypto_Rsa_IsModulusLen(uint32_t modulusLen)
+{
+    return ( (modulusLen >= CRYPTO_RSA_MIN_MODULUS_SIZE) && (modulusLen <= CRYPTO_RSA_MAX_MODULUS_SIZE)
+             && ((modulusLen % 4u) == 0u) );
+}
+
+static crypto_Rsa_Status_E lCrypto_Rsa_CheckPubKey(st_Crypto_Rsa_PubKey *ptr_pubKey)
+{
+    crypto_Rsa_Status_E ret_rsaStat_en = CRYPTO_RSA_SUCCESS;
+
+    if( (ptr_pubKey == NULL) || (ptr_pubKey->ptr_n == NULL) || (ptr_pubKey->ptr_e == NULL) || (ptr_pubKey->eLen == 0u) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_PUBKEY;
+    }
+    else if( (!lCrypto_Rsa_IsModulusLen(ptr_pubKey->modulusLen)) || (ptr_pubKey->eLen > ptr_pubKey->modulusLen) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_KEYLEN;
+    }
+    else
+    {
+        ret_rsaStat_en = CRYPTO_RSA_SUCCESS;
+    }
+    return ret_rsaStat_en;
+}
+
+static crypto_Rsa_Status_E lCrypto_Rsa_CheckPrivKey(st_Crypto_Rsa_PrivKey *ptr_privKey)
+{
+    crypto_Rsa_Status_E ret_rsaStat_en = CRYPTO_RSA_SUCCESS;
+
+    if( (ptr_privKey == NULL) || (ptr_privKey->ptr_n == NULL) || (ptr_privKey->ptr_e == NULL) || (ptr_privKey->eLen == 0u)
+        || (ptr_privKey->ptr_d == NULL) || (ptr_privKey->ptr_p == NULL) || (ptr_privKey->ptr_q == NULL)
+        || (ptr_privKey->ptr_dP == NULL) || (ptr_privKey->ptr_dQ == NULL) || (ptr_privKey->ptr_qInv == NULL) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_PRIVKEY;
+    }
+    //The primes are on half of the modulus length, a multiple of 4 for the CPKCC
+    else if( (!lCrypto_Rsa_IsModulusLen(ptr_privKey->modulusLen)) || ((ptr_privKey->modulusLen % 8u) != 0u)
+             || (ptr_privKey->eLen > ptr_privKey->modulusLen) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_KEYLEN;
+    }
+    else
+    {
+        ret_rsaStat_en = CRYPTO_RSA_SUCCESS;
+    }
+    return ret_rsaStat_en;
+}
+
+static crypto_Rsa_Status_E lCrypto_Rsa_CheckHash(uint8_t *ptr_inputHash, uint32_t hashLen, crypto_Hash_Algo_E hashType_en)
+{
+    crypto_Rsa_Status_E ret_rsaStat_en = CRYPTO_RSA_SUCCESS;
+    uint32_t hashSize = lCrypto_Rsa_GetHashSize(hashType_en);
+
+    if(hashSize == 0u)
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_HASHTYPE;
+    }
+    else if( (ptr_inputHash == NULL) || (hashLen != hashSize) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_INPUTHASH;
+    }
+    else
+    {
+        ret_rsaStat_en = CRYPTO_RSA_SUCCESS;
+    }
+    return ret_rsaStat_en;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Rsa_Status_E Crypto_Rsa_Pkcs1v15_Sign(crypto_HandlerType_E rsaHandlerType_en, uint8_t *ptr_inputHash, uint32_t hashLen,
+                                            crypto_Hash_Algo_E hashType_en, uint8_t *ptr_outSig, uint32_t sigLen,
+                                            st_Crypto_Rsa_PrivKey *ptr_privKey, uint32_t rsaSessionId)
+{
+    crypto_Rsa_Status_E ret_rsaStat_en = lCrypto_Rsa_CheckHash(ptr_inputHash, hashLen, hashType_en);
+
+    if(ret_rsaStat_en == CRYPTO_RSA_SUCCESS)
+    {
+        ret_rsaStat_en = lCrypto_Rsa_CheckPrivKey(ptr_privKey);
+    }
+
+    if(ret_rsaStat_en != CRYPTO_RSA_SUCCESS)
+    {
+        //Hash or key error already set
+    }
+    else if( (ptr_outSig == NULL) || (sigLen < ptr_privKey->modulusLen) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_SIGNATURE;
+    }
+    else if( (rsaSessionId <= 0u) || (rsaSessionId > (uint32_t)CRYPTO_RSA_SESSION_MAX) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_SID;
+    }
+    else
+    {
+        switch(rsaHandlerType_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_rsaStat_en = Crypto_Rsa_Wc_Pkcs1v15_Sign(ptr_inputHash, hashLen, hashType_en, ptr_outSig, sigLen, ptr_privKey);
+                break;
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_rsaStat_en = Crypto_Rsa_Hw_Pkcs1v15_Sign(ptr_inputHash, hashLen, hashType_en, ptr_outSig, sigLen, ptr_privKey);
+                break;
+            default:
+                ret_rsaStat_en = CRYPTO_RSA_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_rsaStat_en;
+}
+
+crypto_Rsa_Status_E Crypto_Rsa_Pkcs1v15_Verify(crypto_HandlerType_E rsaHandlerType_en, uint8_t *ptr_inputHash, uint32_t hashLen,
+                                              crypto_Hash_Algo_E hashType_en, uint8_t *ptr_inputSig, uint32_t sigLen,
+                                              st_Crypto_Rsa_PubKey *ptr_pubKey, int8_t *ptr_hashVerifyStat, uint32_t rsaSessionId)
+{
+    crypto_Rsa_Status_E ret_rsaStat_en = lCrypto_Rsa_CheckHash(ptr_inputHash, hashLen, hashType_en);
+
+    if(ret_rsaStat_en == CRYPTO_RSA_SUCCESS)
+    {
+        ret_rsaStat_en = lCrypto_Rsa_CheckPubKey(ptr_pubKey);
+    }
+
+    if(ret_rsaStat_en != CRYPTO_RSA_SUCCESS)
+    {
+        //Hash or key error already set
+    }
+    else if( (ptr_inputSig == NULL) || (sigLen != ptr_pubKey->modulusLen) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_SIGNATURE;
+    }
+    else if(ptr_hashVerifyStat == NULL)
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_ARG;
+    }
+    else if( (rsaSessionId <= 0u) || (rsaSessionId > (uint32_t)CRYPTO_RSA_SESSION_MAX) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_SID;
+    }
+    else
+    {
+        switch(rsaHandlerType_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_rsaStat_en = Crypto_Rsa_Wc_Pkcs1v15_Verify(ptr_inputHash, hashLen, hashType_en, ptr_inputSig, sigLen, ptr_pubKey, ptr_hashVerifyStat);
+                break;
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_rsaStat_en = Crypto_Rsa_Hw_Pkcs1v15_Verify(ptr_inputHash, hashLen, hashType_en, ptr_inputSig, sigLen, ptr_pubKey, ptr_hashVerifyStat);
+                break;
+            default:
+                ret_rsaStat_en = CRYPTO_RSA_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_rsaStat_en;
+}
+
+crypto_Rsa_Status_E Crypto_Rsa_Pss_Sign(crypto_HandlerType_E rsaHandlerType_en, uint8_t *ptr_inputHash, uint32_t hashLen,
+                                       crypto_Hash_Algo_E hashType_en, uint32_t saltLen, uint8_t *ptr_outSig, uint32_t sigLen,
+                                       st_Crypto_Rsa_PrivKey *ptr_privKey, uint32_t rsaSessionId)
+{
+    crypto_Rsa_Status_E ret_rsaStat_en = lCrypto_Rsa_CheckHash(ptr_inputHash, hashLen, hashType_en);
+
+    if(ret_rsaStat_en == CRYPTO_RSA_SUCCESS)
+    {
+        ret_rsaStat_en = lCrypto_Rsa_CheckPrivKey(ptr_privKey);
+    }
+
+    if(ret_rsaStat_en != CRYPTO_RSA_SUCCESS)
+    {
+        //Hash or key error already set
+    }
+    else if(saltLen > hashLen)
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_SALTLEN;
+    }
+    else if( (ptr_outSig == NULL) || (sigLen < ptr_privKey->modulusLen) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_SIGNATURE;
+    }
+    else if( (rsaSessionId <= 0u) || (rsaSessionId > (uint32_t)CRYPTO_RSA_SESSION_MAX) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_SID;
+    }
+    else
+    {
+        switch(rsaHandlerType_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_rsaStat_en = Crypto_Rsa_Wc_Pss_Sign(ptr_inputHash, hashLen, hashType_en, saltLen, ptr_outSig, sigLen, ptr_privKey);
+                break;
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_rsaStat_en = Crypto_Rsa_Hw_Pss_Sign(ptr_inputHash, hashLen, hashType_en, saltLen, ptr_outSig, sigLen, ptr_privKey);
+                break;
+            default:
+                ret_rsaStat_en = CRYPTO_RSA_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_rsaStat_en;
+}
+
+crypto_Rsa_Status_E Crypto_Rsa_Pss_Verify(crypto_HandlerType_E rsaHandlerType_en, uint8_t *ptr_inputHash, uint32_t hashLen,
+                                         crypto_Hash_Algo_E hashType_en, uint32_t saltLen, uint8_t *ptr_inputSig, uint32_t sigLen,
+                                         st_Crypto_Rsa_PubKey *ptr_pubKey, int8_t *ptr_hashVerifyStat, uint32_t rsaSessionId)
+{
+    crypto_Rsa_Status_E ret_rsaStat_en = lCrypto_Rsa_CheckHash(ptr_inputHash, hashLen, hashType_en);
+
+    if(ret_rsaStat_en == CRYPTO_RSA_SUCCESS)
+    {
+        ret_rsaStat_en = lCrypto_Rsa_CheckPubKey(ptr_pubKey);
+    }
+
+    if(ret_rsaStat_en != CRYPTO_RSA_SUCCESS)
+    {
+        //Hash or key error already set
+    }
+    else if(saltLen > hashLen)
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_SALTLEN;
+    }
+    else if( (ptr_inputSig == NULL) || (sigLen != ptr_pubKey->modulusLen) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_SIGNATURE;
+    }
+    else if(ptr_hashVerifyStat == NULL)
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_ARG;
+    }
+    else if( (rsaSessionId <= 0u) || (rsaSessionId > (uint32_t)CRYPTO_RSA_SESSION_MAX) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_SID;
+    }
+    else
+    {
+        switch(rsaHandlerType_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_rsaStat_en = Crypto_Rsa_Wc_Pss_Verify(ptr_inputHash, hashLen, hashType_en, saltLen, ptr_inputSig, sigLen, ptr_pubKey, ptr_hashVerifyStat);
+                break;
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_rsaStat_en = Crypto_Rsa_Hw_Pss_Verify(ptr_inputHash, hashLen, hashType_en, saltLen, ptr_inputSig, sigLen, ptr_pubKey, ptr_hashVerifyStat);
+                break;
+            default:
+                ret_rsaStat_en = CRYPTO_RSA_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_rsaStat_en;
+}
+
+crypto_Rsa_Status_E Crypto_Rsa_Oaep_Encrypt(crypto_HandlerType_E rsaHandlerType_en, uint8_t *ptr_inputData, uint32_t dataLen,
+                                           crypto_Hash_Algo_E hashType_en, uint8_t *ptr_label, uint32_t labelLen,
+                                           uint8_t *ptr_outData, uint32_t outDataLen, st_Crypto_Rsa_PubKey *ptr_pubKey,
+                                           uint32_t rsaSessionId)
+{
+    crypto_Rsa_Status_E ret_rsaStat_en = lCrypto_Rsa_CheckPubKey(ptr_pubKey);
+    uint32_t hashSize = lCrypto_Rsa_GetHashSize(hashType_en);
+
+    if(ret_rsaStat_en != CRYPTO_RSA_SUCCESS)
+    {
+        //Key error already set
+    }
+    else if(hashSize == 0u)
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_HASHTYPE;
+    }
+    //The message fits in the modulus with two hashes and two bytes of padding
+    else if( ((ptr_inputData == NULL) && (dataLen != 0u)) || ((dataLen + (2u * hashSize) + 2u) > ptr_pubKey->modulusLen) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_INPUTDATA;
+    }
+    else if( (ptr_label == NULL) && (labelLen != 0u) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_ARG;
+    }
+    else if( (ptr_outData == NULL) || (outDataLen < ptr_pubKey->modulusLen) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_OUTPUTDATA;
+    }
+    else if( (rsaSessionId <= 0u) || (rsaSessionId > (uint32_t)CRYPTO_RSA_SESSION_MAX) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_SID;
+    }
+    else
+    {
+        switch(rsaHandlerType_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_rsaStat_en = Crypto_Rsa_Wc_Oaep_Encrypt(ptr_inputData, dataLen, hashType_en, ptr_label, labelLen, ptr_outData, outDataLen, ptr_pubKey);
+                break;
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_rsaStat_en = Crypto_Rsa_Hw_Oaep_Encrypt(ptr_inputData, dataLen, hashType_en, ptr_label, labelLen, ptr_outData, outDataLen, ptr_pubKey);
+                break;
+            default:
+                ret_rsaStat_en = CRYPTO_RSA_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_rsaStat_en;
+}
+
+crypto_Rsa_Status_E Crypto_Rsa_Oaep_Decrypt(crypto_HandlerType_E rsaHandlerType_en, uint8_t *ptr_inputData, uint32_t dataLen,
+                                           crypto_Hash_Algo_E hashType_en, uint8_t *ptr_label, uint32_t labelLen,
+                                           uint8_t *ptr_outData, uint32_t outDataLen, uint32_t *ptr_msgLen,
+                                           st_Crypto_Rsa_PrivKey *ptr_privKey, uint32_t rsaSessionId)
+{
+    crypto_Rsa_Status_E ret_rsaStat_en = lCrypto_Rsa_CheckPrivKey(ptr_privKey);
+
+    if(ret_rsaStat_en != CRYPTO_RSA_SUCCESS)
+    {
+        //Key error already set
+    }
+    else if(lCrypto_Rsa_GetHashSize(hashType_en) == 0u)
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_HASHTYPE;
+    }
+    else if( (ptr_inputData == NULL) || (dataLen != ptr_privKey->modulusLen) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_INPUTDATA;
+    }
+    else if( ((ptr_label == NULL) && (labelLen != 0u)) || (ptr_msgLen == NULL) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_ARG;
+    }
+    //The output takes the longest message the key and hash allow, so a short buffer is never the reason a decryption fails
+    else if( (ptr_outData == NULL)
+             || (outDataLen < (ptr_privKey->modulusLen - (2u * lCrypto_Rsa_GetHashSize(hashType_en)) - 2u)) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_OUTPUTDATA;
+    }
+    else if( (rsaSessionId <= 0u) || (rsaSessionId > (uint32_t)CRYPTO_RSA_SESSION_MAX) )
+    {
+        ret_rsaStat_en = CRYPTO_RSA_ERROR_SID;
+    }
+    else
+    {
+        switch(rsaHandlerType_en)
+        {
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_rsaStat_en = Crypto_Rsa_Wc_Oaep_Decrypt(ptr_inputData, dataLen, hashType_en, ptr_label, labelLen, ptr_outData, outDataLen, ptr_msgLen, ptr_privKey);
+                break;
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_rsaStat_en = Crypto_Rsa_Hw_Oaep_Decrypt(ptr_inputData, dataLen, hashType_en, ptr_label, labelLen, ptr_outData, outDataLen, ptr_msgLen, ptr_privKey);
+                break;
+            default:
+                ret_rsaStat_en = CRYPTO_RSA_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_rsaStat_en;
+}
@@ -81,14 +81,25 @@ typedef enum
 // *****************************************************************************
 // *****************************************************************************
 
+/* The hash is not copied: it is written into crypto RAM by 
+   DRV_CRYPTO_ECDSA_Sign/Verify, so it must stay valid until then. */
 CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_InitEccParamsSign(CPKCL_ECC_DATA *pEccData, 
     pfu1 hash, u4 hashLen, pfu1 privKey, u4 privKeyLen, 
     CRYPTO_CPKCL_CURVE eccCurveType);
 
 /* The signature is in MSB mode with the following order: */
 /* 4 "0" bytes - S - 4 "0" bytes - R */
+/* Binary curves run on the GF2N services, with the BASE_GF2N_ECDSA_* memory
+   mapping for the signature and BASE_GF2N_ECDSAV_* for the verification. */
 CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_Sign(CPKCL_ECC_DATA *pEccData, 
     pfu1 pfulSignature, u4 signatureLen);
+
+/* DRV_CRYPTO_ECDSA_Sign with the scalar number k given in MSB mode on at most
+   the order size, for deterministic signatures (RFC 6979). k must be in 
+   [1, n-1], it is cleared from crypto RAM after the signature. Prime curves 
+   only. */
+CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_SignWithNonce(CPKCL_ECC_DATA *pEccData, 
+    pfu1 nonce, u4 nonceLen, pfu1 pfulSignature, u4 signatureLen);
                                           
 CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_InitEccParamsVerify(CPKCL_ECC_DATA *pEccData, 
     pfu1 hash, u4 hashLen, pfu1 pubKey, CRYPTO_CPKCL_CURVE eccCurveType);
@@ -96,6 +107,16 @@ CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_InitEccParamsVerify(CPKCL_ECC_DATA *pEccDat
 CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_Verify(CPKCL_ECC_DATA *pEccData, 
     pfu1 pfu1Signature);
 
+/* Batch verification: after DRV_CRYPTO_ECDSA_InitEccParamsVerify, the key of
+   the next signatures is changed with SetVerifyKey and each signature is 
+   checked with VerifyHash, without running the CPKCL check or the curve 
+   setup again. The curve constants stay resident in crypto RAM. */
+CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_SetVerifyKey(CPKCL_ECC_DATA *pEccData, 
+    pfu1 pubKey);
+
+CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_VerifyHash(CPKCL_ECC_DATA *pEccData, 
+    pfu1 hash, u4 hashLen, pfu1 pfu1Signature);
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
 
@@ -0,0 +1,150 @@
+/**************************************************************************
+  Crypto Framework Library Header
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_crypto_mp_hw_cpkcl.h
+
+  Summary:
+    Crypto Framework Library header for the CPKCC multi-precision
+    arithmetic.
+
+  Description:
+    This header contains the function definitions for the CPKCC modular
+    arithmetic on big integers: multiplication on Fmult, reduction on
+    RedMod, exponentiation on ExpMod and inversion on GCD. It is the
+    backend of the wolfCrypt sp_int hooks enabled by WOLFSSL_SP_CPKCC.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2024, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef DRV_CRYPTO_MP_HW_CPKCL_H
+#define DRV_CRYPTO_MP_HW_CPKCL_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_typedef_pb.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Macro Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Modulus sizes in bytes, a multiple of 4. The exponentiation mapping takes
+   9 times the modulus size plus 68 bytes of the 4 KB crypto RAM, which caps
+   the modulus at 3072 bits. */
+#define CRYPTO_MP_HW_MIN_MODULUS_SIZE   (12U)
+#define CRYPTO_MP_HW_MAX_MODULUS_SIZE   (384U)
+
+//******************************************************************************
+// Memory mapping for the multi-precision services, a is the modulus length.
+// ExpMod uses the areas as named. Fmult takes its operands from PRECOMP and
+// writes the double length product to X, which RedMod reduces into PRECOMP
+// and normalizes into EXPONENT. GCD works in X and PRECOMP only.
+//******************************************************************************
+#define BASE_MP_MODULO(a)               (MSB_EXTENT_CRYPTORAM | nu1CRYPTORAM_BASE)
+#define BASE_MP_CNS(a)                  (BASE_MP_MODULO(a) + a + 4)
+#define BASE_MP_X(a)                    (BASE_MP_CNS(a) + a + 12)
+#define BASE_MP_PRECOMP(a)              (BASE_MP_X(a) + 3*a + 24)
+#define BASE_MP_EXPONENT(a)             (BASE_MP_PRECOMP(a) + 3*a + 24)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+typedef enum
+{
+    CRYPTO_MP_RESULT_SUCCESS,
+    CRYPTO_MP_RESULT_INIT_FAIL,
+    CRYPTO_MP_RESULT_ERROR_SIZE,
+    CRYPTO_MP_RESULT_ERROR_INPUT,
+    CRYPTO_MP_RESULT_NO_INVERSE,
+    CRYPTO_MP_RESULT_ERROR_FAIL
+} CRYPTO_MP_RESULT;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: CPKCC Multi-Precision Common Interface
+// *****************************************************************************
+// *****************************************************************************
+
+/* All numbers are LSB first, the layout of the sp_int digits on the little
+   endian core, so operands are copied to and from crypto RAM as they are.
+   The modulus n is odd, on u2ModLength bytes with a non-zero most
+   significant word. Operands may be shorter than their bound, results are
+   written on u2ModLength bytes and may overlap any operand. The reduction
+   constant of the last modulus is kept, so a run of operations on the same
+   modulus sets it up once. */
+
+/* r = x*y mod n, x and y on up to u2ModLength bytes each */
+CRYPTO_MP_RESULT DRV_CRYPTO_MP_ModMul(pu1 pu1N, u2 u2ModLength,
+    pu1 pu1X, u2 u2XLength, pu1 pu1Y, u2 u2YLength, pu1 pu1R);
+
+/* r = x mod n, x on up to twice u2ModLength bytes */
+CRYPTO_MP_RESULT DRV_CRYPTO_MP_Mod(pu1 pu1N, u2 u2ModLength,
+    pu1 pu1X, u2 u2XLength, pu1 pu1R);
+
+/* r = x^e mod n, x below n and e on up to u2ModLength bytes. bRegular runs
+   the regular exponentiation, with a sequence of operations independent of
+   the exponent bits, and clears the exponent from crypto RAM afterwards;
+   it is meant for secret exponents. Otherwise the fast exponentiation is
+   used. */
+CRYPTO_MP_RESULT DRV_CRYPTO_MP_ExpMod(pu1 pu1N, u2 u2ModLength,
+    pu1 pu1X, u2 u2XLength, pu1 pu1E, u2 u2ELength, bool bRegular, pu1 pu1R);
+
+/* r = x^-1 mod n on GCD, x below n and non zero. Returns
+   CRYPTO_MP_RESULT_NO_INVERSE when x and n are not coprime. */
+CRYPTO_MP_RESULT DRV_CRYPTO_MP_InvMod(pu1 pu1N, u2 u2ModLength,
+    pu1 pu1X, u2 u2XLength, pu1 pu1R);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif /* DRV_CRYPTO_MP_HW_CPKCL_H */
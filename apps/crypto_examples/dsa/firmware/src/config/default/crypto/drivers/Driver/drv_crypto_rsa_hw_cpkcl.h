@@ -0,0 +1,156 @@
+/**************************************************************************
+  Crypto Framework Library Header
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_crypto_rsa_hw_cpkcl.h
+
+  Summary:
+    Crypto Framework Library header for the CPKCC RSA functions.
+
+  Description:
+    This header contains the function definitions for the CPKCC RSA
+    primitives: the public key operation on ExpMod and the private key
+    operation on the CRT service.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2024, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef DRV_CRYPTO_RSA_HW_CPKCL_H
+#define DRV_CRYPTO_RSA_HW_CPKCL_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_typedef_pb.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Macro Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Modulus sizes in bytes, a multiple of 4. The upper bound is set by the
+   4 KB crypto RAM: the public operation on a 3072-bit modulus takes 3.5 KB
+   of it. */
+#define CRYPTO_RSA_HW_MIN_MODULUS_SIZE  (256U)
+#define CRYPTO_RSA_HW_MAX_MODULUS_SIZE  (384U)
+
+//******************************************************************************
+// Memory mapping for the RSA public operation, a is the modulus length
+//******************************************************************************
+#define BASE_RSA_EXPMOD_MODULO(a)       (MSB_EXTENT_CRYPTORAM | nu1CRYPTORAM_BASE)
+#define BASE_RSA_EXPMOD_CNS(a)          (BASE_RSA_EXPMOD_MODULO(a) + a + 4)
+#define BASE_RSA_EXPMOD_X(a)            (BASE_RSA_EXPMOD_CNS(a) + a + 12)
+#define BASE_RSA_EXPMOD_PRECOMP(a)      (BASE_RSA_EXPMOD_X(a) + 3*a + 24)
+#define BASE_RSA_EXPMOD_EXPONENT(a)     (BASE_RSA_EXPMOD_PRECOMP(a) + 3*a + 24)
+
+//******************************************************************************
+// Memory mapping for the RSA private operation, a is the length of one prime
+//******************************************************************************
+#define BASE_RSA_CRT_MODULO(a)          (MSB_EXTENT_CRYPTORAM | nu1CRYPTORAM_BASE)
+#define BASE_RSA_CRT_X(a)               (BASE_RSA_CRT_MODULO(a) + 2*a + 8)
+#define BASE_RSA_CRT_PRECOMP(a)         (BASE_RSA_CRT_X(a) + 6*a + 24)
+#define BASE_RSA_CRT_EXPONENT(a)        (BASE_RSA_CRT_PRECOMP(a) + 4*a + 28)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+typedef enum
+{
+    CRYPTO_RSA_RESULT_SUCCESS,
+    CRYPTO_RSA_RESULT_INIT_FAIL,
+    CRYPTO_RSA_RESULT_ERROR_KEY,
+    CRYPTO_RSA_RESULT_ERROR_INPUT,
+    CRYPTO_RSA_RESULT_ERROR_RNG,
+    CRYPTO_RSA_RESULT_ERROR_FAIL
+} CRYPTO_RSA_RESULT;
+
+/* RSA private key in CRT form. All numbers are MSB first, n on twice the
+   prime length and p, q, dP, dQ and qInv = q^-1 mod p on the prime length. */
+typedef struct
+{
+    pfu1 pfu1N;
+    pfu1 pfu1E;
+    u2 u2ELength;
+    pfu1 pfu1P;
+    pfu1 pfu1Q;
+    pfu1 pfu1DP;
+    pfu1 pfu1DQ;
+    pfu1 pfu1QInv;
+    u2 u2PrimeLength;
+} CPKCL_RSA_CRT_KEY;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: CPKCC RSA Common Interface
+// *****************************************************************************
+// *****************************************************************************
+
+/* y = x^e mod n, x below n. All numbers are MSB first, x and y on the
+   modulus length. The exponent is public: it runs with the fast, non
+   regular, exponentiation and only its significant words are processed, so
+   e = 65537 costs 17 modular multiplications. y may be x. */
+CRYPTO_RSA_RESULT DRV_CRYPTO_RSA_Public(pfu1 pfu1N, u2 u2ModLength,
+    pfu1 pfu1E, u2 u2ELength, pfu1 pfu1X, pfu1 pfu1Y);
+
+/* y = x^d mod n with the CRT service, x below n, x and y MSB first on the
+   modulus length. The exponentiations mod p and mod q are regular. The
+   result is checked with the public exponent before it is written to y, so
+   a fault in one half of the CRT cannot leak a factor of n. y may be x. */
+CRYPTO_RSA_RESULT DRV_CRYPTO_RSA_PrivateCrt(CPKCL_RSA_CRT_KEY *pKey,
+    pfu1 pfu1X, pfu1 pfu1Y);
+
+/* Random bytes from the CPKCL generator, used for the PSS salt and the
+   OAEP seed. */
+CRYPTO_RSA_RESULT DRV_CRYPTO_RSA_Random(pfu1 pfu1Out, u2 u2Length);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif /* DRV_CRYPTO_RSA_HW_CPKCL_H */
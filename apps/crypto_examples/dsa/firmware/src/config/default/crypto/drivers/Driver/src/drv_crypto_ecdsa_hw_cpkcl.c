@@ -60,65 +60,85 @@ Microchip or any third party.
 // *****************************************************************************
 // *****************************************************************************
 
-// All buffers maximum size + 4
-static u1 pubKeyX[P521_PUBLIC_KEY_COORDINATE_SIZE + 4];    
-static u1 pubKeyY[P521_PUBLIC_KEY_COORDINATE_SIZE + 4];  
-static u1 localHash[P521_PUBLIC_KEY_COORDINATE_SIZE + 4];    
-static u1 privateKey[P521_PUBLIC_KEY_COORDINATE_SIZE + 4]; 
-static u1 signX[P521_PUBLIC_KEY_COORDINATE_SIZE + 4];
-static u1 signY[P521_PUBLIC_KEY_COORDINATE_SIZE + 4];
+// All buffers maximum operand size + 4
+static u1 pubKeyX[CPKCL_ECC_MAX_OPERAND_SIZE + 4];    
+static u1 pubKeyY[CPKCL_ECC_MAX_OPERAND_SIZE + 4];  
+static u1 privateKey[CPKCL_ECC_MAX_OPERAND_SIZE + 4]; 
+static u1 signX[CPKCL_ECC_MAX_OPERAND_SIZE + 4];
+static u1 signY[CPKCL_ECC_MAX_OPERAND_SIZE + 4];
     
 // *****************************************************************************
 // *****************************************************************************
-// Section: CPKCL ECDSA Common Interface Implementation
+// Section: File scope functions
 // *****************************************************************************
 // *****************************************************************************
 
-CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_InitEccParamsSign(CPKCL_ECC_DATA *pEccData, 
-    pfu1 hash, u4 hashLen, pfu1 privKey, u4 privKeyLen, 
-    CRYPTO_CPKCL_CURVE eccCurveType)
+/* Bit length of the order of the base point */
+static u2 lDRV_CRYPTO_ECDSA_OrderBits(CPKCL_ECC_DATA *pEccData)
 {
-    CRYPTO_CPKCL_RESULT result;
+    u2 u2Cpt = pEccData->u2OrderSize;
+    u1 u1Top = 0U;
+    u2 u2Bits;
     
-    /* Initialize CPKCL */
-    result = DRV_CRYPTO_ECC_InitCpkcl();
-    if (result != CRYPTO_CPKCL_RESULT_INIT_SUCCESS) 
+    while ((u2Cpt > 0U) && (u1Top == 0U))
     {
-        return CRYPTO_ECDSA_RESULT_INIT_FAIL;
+        u2Cpt--;
+        u1Top = pEccData->pfu1APointOrder[u2Cpt];
     }
     
-    /* Fill curve parameters */
-    result = DRV_CRYPTO_ECC_InitCurveParams(pEccData, eccCurveType);
-    if (result != CRYPTO_CPKCL_RESULT_CURVE_SUCCESS) 
+    u2Bits = (u2) (u2Cpt * 8U);
+    while (u1Top != 0U)
     {
-        return CRYPTO_ECDSA_RESULT_ERROR_CURVE;
+        u2Bits++;
+        u1Top >>= 1U;
     }
     
-    /* Clean out local buffers */
-    (void) memset(localHash, 0, sizeof(localHash));
-    (void) memset(privateKey, 0, sizeof(privateKey));
+    return u2Bits;
+}
+
+/* Writes the hash straight into crypto RAM in LSB mode. As in FIPS 186-4 only
+   the leftmost bits of a hash longer than the order are used and a shorter 
+   hash is zero extended. The orders of the binary curves are not a whole 
+   number of bytes, the truncated hash is shifted right for them. */
+static void lDRV_CRYPTO_ECDSA_WriteHash(pu1 pu1Dest, CPKCL_ECC_DATA *pEccData)
+{
+    u2 u2OrderSize = pEccData->u2OrderSize;
+    u2 u2HashSize = pEccData->u2HashSize;
+    u2 u2OrderBits = lDRV_CRYPTO_ECDSA_OrderBits(pEccData);
+    u2 u2Shift = 0U;
+    u2 u2Cpt;
     
-    /* Copy leaving first 4 bytes empty */
-    (void) memcpy(&localHash[4], hash, hashLen);
-    (void) memcpy(&privateKey[4], privKey, privKeyLen);
+    if (((u4)u2HashSize * 8U) > u2OrderBits)
+    {
+        u2HashSize = (u2) ((u2OrderBits + 7U) / 8U);
+        u2Shift = (u2) (((u2)(u2HashSize * 8U)) - u2OrderBits);
+    }
     
-    /* Store in context */
-    pEccData->pfu1HashValue = (pfu1) localHash;
-    pEccData->pfu1PrivateKey = (pfu1) privateKey;
+    (void) memset(pu1Dest, 0, (size_t)u2OrderSize + 4U);
+    for (u2Cpt = 0; u2Cpt < u2HashSize; u2Cpt++)
+    {
+        pu1Dest[u2Cpt] = pEccData->pfu1HashValue[u2HashSize - u2Cpt - 1U];
+    }
     
-    return CRYPTO_ECDSA_RESULT_SUCCESS;
+    if (u2Shift != 0U)
+    {
+        for (u2Cpt = 0; u2Cpt < u2HashSize; u2Cpt++)
+        {
+            pu1Dest[u2Cpt] = (u1) ((pu1Dest[u2Cpt] >> u2Shift) 
+                | (pu1Dest[u2Cpt + 1U] << (8U - u2Shift)));
+        }
+    }
 }
 
-CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_Sign(CPKCL_ECC_DATA *pEccData, 
-    pfu1 pfulSignature, u4 signatureLen)
+/* DRV_CRYPTO_ECDSA_Sign on a binary curve, signX and signY are cleared */
+static CRYPTO_ECDSA_RESULT lDRV_CRYPTO_ECDSA_SignGf2n(CPKCL_ECC_DATA *pEccData,
+    pfu1 pfulSignature)
 {
-    /* Clean out local buffers */
-    (void) memset(signX, 0, sizeof(signX));
-    (void) memset(signY, 0, sizeof(signY));
-    
     /* Set sizes */
     u2 u2ModuloPSize = pEccData->u2ModuloPSize;
     u2 u2OrderSize = pEccData->u2OrderSize;
+    u2 u2KeySize = pEccData->u2KeySize;
+    pu1 pu1Scalar;
     
     /* MISRA C-2012 deviation block start */
     /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
@@ -126,12 +146,15 @@ CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_Sign(CPKCL_ECC_DATA *pEccData,
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
 #pragma coverity compliance block \
-(deviate:1 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
-(deviate:12 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
-(deviate:1 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
-(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
-    /* Generate scalar number */
-    CPKCL_Rng(nu1RBase) = (nu1) BASE_CONV_RANDOM(u2ModuloPSize);
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:28 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:2 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:2 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    pu1Scalar = (pu1) BASE_GF2N_ECDSA_SCALAR(u2ModuloPSize, u2OrderSize);
+    
+    /* Generate scalar number in place, away from the resident curve constants */
+    CPKCL_Rng(nu1RBase) = (nu1) BASE_GF2N_ECDSA_SCALAR(u2ModuloPSize, 
+        u2OrderSize);
 #pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
 #pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
 #pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
@@ -157,51 +180,322 @@ CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_Sign(CPKCL_ECC_DATA *pEccData,
     /* MISRA C-2012 deviation block end */
     if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
     {
+        (void) memset(pu1Scalar, 0, (size_t)u2OrderSize + 4U);
         return CRYPTO_ECDSA_RESULT_ERROR_RNG;
     }
     
-    u1 au1ScalarNumber[72];   // u2OrderSize - maximum size
     /* MISRA C-2012 deviation block start */
     /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
        H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunknown-pragmas"
 #pragma coverity compliance block \
-(deviate:19 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
-(deviate:115 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
-(deviate:9 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:20 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:140 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:10 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:18 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* Clear the padding above the scalar number */
+    (void) memset((pu1) ((BASE_GF2N_ECDSA_SCALAR(u2ModuloPSize, u2OrderSize)))
+        + u2OrderSize, 0, 4U);
+
+    /* Curve constants are skipped when the previous signature left them, a 
+       and b are read together from the "a" address */
+    if (!DRV_CRYPTO_ECC_RamIsResident(pEccData->curveType, 
+            CRYPTO_CPKCL_RAM_ECDSA_SIGN))
+    {
+        (void) memcpy(
+            (pu1) ((BASE_ECDSA_MODULO(u2ModuloPSize, u2OrderSize))),
+            pEccData->pfu1ModuloP, u2ModuloPSize + 4U);
+        (void) memcpy(
+            (pu1) ((BASE_ECDSA_A(u2ModuloPSize, u2OrderSize))),
+            pEccData->pfu1ACurve, u2ModuloPSize + 4U);
+        (void) memcpy(
+            (pu1) ((BASE_GF2N_ECDSA_B(u2ModuloPSize, u2OrderSize))),
+            pEccData->pfu1BCurve, u2ModuloPSize + 4U);
+        (void) memcpy(
+            (pu1) ((BASE_GF2N_ECDSA_ORDER(u2ModuloPSize, u2OrderSize))),
+            pEccData->pfu1APointOrder, u2OrderSize + 4U);
+        DRV_CRYPTO_ECC_RamSetResident(pEccData->curveType, 
+            CRYPTO_CPKCL_RAM_ECDSA_SIGN);
+    }
+
+    /* The base point is overwritten by the signature, load it every time */
+    (void) memcpy(
+        (pu1) ((BASE_ECDSA_POINT_A_X(u2ModuloPSize, u2OrderSize))),
+        pEccData->pfu1APointX, u2ModuloPSize + 4U);
+    (void) memcpy(
+        (pu1) ((BASE_ECDSA_POINT_A_Y(u2ModuloPSize, u2OrderSize))),
+        pEccData->pfu1APointY, u2ModuloPSize + 4U);
+    (void) memcpy(
+        (pu1) ((BASE_ECDSA_POINT_A_Z(u2ModuloPSize, u2OrderSize))),
+        pEccData->pfu1APointZ, u2ModuloPSize + 4U);
+    DRV_CRYPTO_ECC_SecureCopy(
+        (pu1) ((BASE_GF2N_PRIVATE_KEY(u2ModuloPSize, u2OrderSize))),
+        pEccData->pfu1PrivateKey, u2OrderSize + 4U);
+    lDRV_CRYPTO_ECDSA_WriteHash(
+        (pu1) ((BASE_GF2N_ECDSA_HASH(u2ModuloPSize, u2OrderSize))), pEccData);
+
+    /* Ask for a signature generation */
+    CPKCL_GF2NEcDsaGenerate(nu1ModBase) = (nu1) BASE_ECDSA_MODULO(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_GF2NEcDsaGenerate(nu1CnsBase) = (nu1) BASE_ECDSA_CNS(u2ModuloPSize,
+        u2OrderSize);
+    CPKCL_GF2NEcDsaGenerate(nu1PointABase) = (nu1) BASE_ECDSA_POINT_A(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_GF2NEcDsaGenerate(nu1PrivateKey) = (nu1) BASE_GF2N_PRIVATE_KEY(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_GF2NEcDsaGenerate(nu1ScalarNumber) = (nu1) BASE_GF2N_ECDSA_SCALAR(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_GF2NEcDsaGenerate(nu1OrderPointBase) = (nu1) BASE_GF2N_ECDSA_ORDER(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_GF2NEcDsaGenerate(nu1ABase) = (nu1) BASE_ECDSA_A(u2ModuloPSize,
+        u2OrderSize);
+    CPKCL_GF2NEcDsaGenerate(nu1Workspace) = (nu1) BASE_GF2N_ECDSA_WORKSPACE(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_GF2NEcDsaGenerate(nu1HashBase) = (nu1) BASE_GF2N_ECDSA_HASH(
+        u2ModuloPSize, u2OrderSize);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL_GF2NEcDsaGenerate(u2ModLength) = u2ModuloPSize;
+    CPKCL_GF2NEcDsaGenerate(u2ScalarLength) = u2OrderSize;
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* Launch the signature generation */
+    /* See CPKCL_Rc_pb.h for possible u2Status Values */
+    vCPKCL_Process(GF2NEcDsaGenerateFast, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        /* The nonce and the signature give the private key, do not leave 
+           it */
+        (void) memset(pu1Scalar, 0, (size_t)u2OrderSize + 4U);
+        DRV_CRYPTO_ECC_RamInvalidate();
+        return CRYPTO_ECDSA_RESULT_ERROR_FAIL;
+    }
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:6 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:2 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* Copy the result */
+    DRV_CRYPTO_ECC_SecureCopy(signX,
+        (pu1) ((BASE_ECDSA_POINT_A(u2ModuloPSize, u2OrderSize))),
+                u2OrderSize + 4U);
+    DRV_CRYPTO_ECC_SecureCopy(signY,
+        (pu1) ((BASE_ECDSA_POINT_A(u2ModuloPSize, u2OrderSize)))
+                + u2OrderSize + 4U, u2OrderSize + 4U);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    
+    /* R and S on the key size, without the operand rounding */
+    (void) memcpy(pfulSignature, &signX[4U + u2OrderSize - u2KeySize], 
+                  u2KeySize);
+    (void) memcpy(&pfulSignature[u2KeySize], 
+                  &signY[4U + u2OrderSize - u2KeySize], u2KeySize);
+    
+    /* Nor once the signature is out */
+    (void) memset(pu1Scalar, 0, (size_t)u2OrderSize + 4U);
+                    
+    return CRYPTO_ECDSA_RESULT_SUCCESS;
+}
+
+/* DRV_CRYPTO_ECDSA_Verify on a binary curve, once the signature is in the 
+   crypto RAM */
+static CRYPTO_ECDSA_RESULT lDRV_CRYPTO_ECDSA_VerifyGf2n(
+    CPKCL_ECC_DATA *pEccData)
+{
+    /* Set sizes */
+    u2 u2ModuloPSize = pEccData->u2ModuloPSize;	
+    u2 u2OrderSize = pEccData->u2OrderSize;
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:20 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:140 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:10 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
 (deviate:17 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
-    DRV_CRYPTO_ECC_SecureCopy(au1ScalarNumber,
-	(pu1) ((BASE_CONV_RANDOM(u2ModuloPSize))), u2OrderSize + 4U);
+    /* Curve constants are skipped when the previous verification left them, 
+       a and b are read together from the "a" address */
+    if (!DRV_CRYPTO_ECC_RamIsResident(pEccData->curveType, 
+            CRYPTO_CPKCL_RAM_ECDSA_VERIFY))
+    {
+        (void) memcpy(
+            (pu1) ((BASE_ECDSAV_MODULO(u2ModuloPSize, u2OrderSize))),
+            pEccData->pfu1ModuloP, u2ModuloPSize + 4U);
+        (void) memcpy(
+            (pu1) ((BASE_ECDSAV_A(u2ModuloPSize, u2OrderSize))),
+            pEccData->pfu1ACurve, u2ModuloPSize + 4U);
+        (void) memcpy(
+            (pu1) ((BASE_GF2N_ECDSAV_B(u2ModuloPSize, u2OrderSize))),
+            pEccData->pfu1BCurve, u2ModuloPSize + 4U);
+        (void) memcpy(
+            (pu1) ((BASE_ECDSAV_ORDER(u2ModuloPSize, u2OrderSize))),
+            pEccData->pfu1APointOrder, u2OrderSize + 4U);
+        DRV_CRYPTO_ECC_RamSetResident(pEccData->curveType, 
+            CRYPTO_CPKCL_RAM_ECDSA_VERIFY);
+    }
 
-    /* Copy parameters for ECDSA signature generation in memory areas */
+    /* Points are used as work areas, load them every time */
+    (void) memcpy(
+        (pu1) ((BASE_ECDSAV_POINT_A_X(u2ModuloPSize, u2OrderSize))),
+        pEccData->pfu1APointX, u2ModuloPSize + 4U);
+    (void) memcpy(
+        (pu1) ((BASE_ECDSAV_POINT_A_Y(u2ModuloPSize, u2OrderSize))),
+        pEccData->pfu1APointY, u2ModuloPSize + 4U);
+    (void) memcpy(
+        (pu1) ((BASE_ECDSAV_POINT_A_Z(u2ModuloPSize, u2OrderSize))),
+        pEccData->pfu1APointZ, u2ModuloPSize + 4U);
     DRV_CRYPTO_ECC_SecureCopy(
-        (pu1) ((BASE_ECDSA_MODULO(u2ModuloPSize, u2OrderSize))),
-        pEccData->pfu1ModuloP, u2ModuloPSize + 4U);
+        (pu1) ((BASE_ECDSAV_PUBLIC_KEY_X(u2ModuloPSize, u2OrderSize))),
+        pEccData->pfu1PublicKeyX, u2ModuloPSize + 4U);
     DRV_CRYPTO_ECC_SecureCopy(
+        (pu1) ((BASE_ECDSAV_PUBLIC_KEY_Y(u2ModuloPSize, u2OrderSize))),
+        pEccData->pfu1PublicKeyY, u2ModuloPSize + 4U);
+    (void) memcpy(
+        (pu1) ((BASE_ECDSAV_PUBLIC_KEY_Z(u2ModuloPSize, u2OrderSize))),
+        pEccData->pfu1PublicKeyZ, u2ModuloPSize + 4U);
+    lDRV_CRYPTO_ECDSA_WriteHash(
+        (pu1) ((BASE_ECDSAV_HASH(u2ModuloPSize, u2OrderSize))), pEccData);
+
+    /* Ask for a verification generation */
+    CPKCL_GF2NEcDsaVerify(nu1ModBase) = (nu1) BASE_ECDSAV_MODULO(u2ModuloPSize,
+        u2OrderSize);
+    CPKCL_GF2NEcDsaVerify(nu1CnsBase) = (nu1) BASE_ECDSAV_CNS(u2ModuloPSize,
+        u2OrderSize);
+    CPKCL_GF2NEcDsaVerify(nu1PointABase) = (nu1) BASE_ECDSAV_POINT_A(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_GF2NEcDsaVerify(nu1PointPublicKeyGen) = (nu1) BASE_ECDSAV_PUBLIC_KEY(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_GF2NEcDsaVerify(nu1PointSignature) = (nu1) BASE_ECDSAV_SIGNATURE(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_GF2NEcDsaVerify(nu1OrderPointBase) = (nu1) BASE_ECDSAV_ORDER(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_GF2NEcDsaVerify(nu1ABase) = (nu1) BASE_ECDSAV_A(u2ModuloPSize,
+        u2OrderSize);
+    CPKCL_GF2NEcDsaVerify(nu1Workspace) = (nu1) BASE_GF2N_ECDSAV_WORKSPACE(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_GF2NEcDsaVerify(nu1HashBase) = (nu1) BASE_ECDSAV_HASH(u2ModuloPSize,
+        u2OrderSize);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL_GF2NEcDsaVerify(u2ModLength) = u2ModuloPSize;
+    CPKCL_GF2NEcDsaVerify(u2ScalarLength) = u2OrderSize;
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* Verify the signature */
+    vCPKCL_Process(GF2NEcDsaVerifyFast, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        DRV_CRYPTO_ECC_RamInvalidate();
+        return CRYPTO_ECDSA_RESULT_ERROR_FAIL;
+    }
+
+    return CRYPTO_ECDSA_RESULT_SUCCESS;
+}
+
+/* Prime curve signature with the scalar number already in crypto RAM, 
+   signX and signY are cleared */
+static CRYPTO_ECDSA_RESULT lDRV_CRYPTO_ECDSA_SignZp(CPKCL_ECC_DATA *pEccData,
+    pfu1 pfulSignature)
+{
+    u2 u2ModuloPSize = pEccData->u2ModuloPSize;
+    u2 u2OrderSize = pEccData->u2OrderSize;
+    u2 u2KeySize = pEccData->u2KeySize;
+    pu1 pu1Scalar;
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:20 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:127 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:10 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:18 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    pu1Scalar = (pu1) BASE_ECDSA_SCALAR(u2ModuloPSize, u2OrderSize);
+    
+    /* Clear the padding above the scalar number */
+    (void) memset((pu1) ((BASE_ECDSA_SCALAR(u2ModuloPSize, u2OrderSize)))
+        + u2OrderSize, 0, 4U);
+
+    /* Curve constants are skipped when the previous signature left them */
+    if (!DRV_CRYPTO_ECC_RamIsResident(pEccData->curveType, 
+            CRYPTO_CPKCL_RAM_ECDSA_SIGN))
+    {
+        (void) memcpy(
+            (pu1) ((BASE_ECDSA_MODULO(u2ModuloPSize, u2OrderSize))),
+            pEccData->pfu1ModuloP, u2ModuloPSize + 4U);
+        (void) memcpy(
+            (pu1) ((BASE_ECDSA_A(u2ModuloPSize, u2OrderSize))),
+            pEccData->pfu1ACurve, u2ModuloPSize + 4U);
+        (void) memcpy(
+            (pu1) ((BASE_ECDSA_ORDER(u2ModuloPSize, u2OrderSize))),
+            pEccData->pfu1APointOrder, u2OrderSize + 4U);
+        DRV_CRYPTO_ECC_RamSetResident(pEccData->curveType, 
+            CRYPTO_CPKCL_RAM_ECDSA_SIGN);
+    }
+
+    /* The base point is overwritten by the signature, load it every time */
+    (void) memcpy(
         (pu1) ((BASE_ECDSA_POINT_A_X(u2ModuloPSize, u2OrderSize))),
         pEccData->pfu1APointX, u2ModuloPSize + 4U);
-    DRV_CRYPTO_ECC_SecureCopy(
+    (void) memcpy(
         (pu1) ((BASE_ECDSA_POINT_A_Y(u2ModuloPSize, u2OrderSize))),
         pEccData->pfu1APointY, u2ModuloPSize + 4U);
-    DRV_CRYPTO_ECC_SecureCopy(
+    (void) memcpy(
         (pu1) ((BASE_ECDSA_POINT_A_Z(u2ModuloPSize, u2OrderSize))),
         pEccData->pfu1APointZ, u2ModuloPSize + 4U);
-    DRV_CRYPTO_ECC_SecureCopy(
-        (pu1) ((BASE_ECDSA_A(u2ModuloPSize, u2OrderSize))),
-        pEccData->pfu1ACurve, u2ModuloPSize + 4U);
-    DRV_CRYPTO_ECC_SecureCopy(
-        (pu1) ((BASE_ECDSA_ORDER(u2ModuloPSize, u2OrderSize))),
-        pEccData->pfu1APointOrder, u2OrderSize + 4U);
     DRV_CRYPTO_ECC_SecureCopy(
         (pu1) ((BASE_PRIVATE_KEY(u2ModuloPSize, u2OrderSize))),
         pEccData->pfu1PrivateKey, u2OrderSize + 4U);
-    DRV_CRYPTO_ECC_SecureCopy(
-        (pu1) ((BASE_ECDSA_HASH(u2ModuloPSize, u2OrderSize))),
-        pEccData->pfu1HashValue, u2ModuloPSize + 4U);
-    DRV_CRYPTO_ECC_SecureCopy(
-        (pu1) ((BASE_ECDSA_SCALAR(u2ModuloPSize, u2OrderSize))),
-        (pfu1) au1ScalarNumber, u2OrderSize + 4U);
+    lDRV_CRYPTO_ECDSA_WriteHash(
+        (pu1) ((BASE_ECDSA_HASH(u2ModuloPSize, u2OrderSize))), pEccData);
 
     /* ECC signature */
     /* Ask for a signature generation */
@@ -251,6 +545,10 @@ CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_Sign(CPKCL_ECC_DATA *pEccData,
     /* MISRA C-2012 deviation block end */
     if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
     {
+        /* The nonce and the signature give the private key, do not leave 
+           it */
+        (void) memset(pu1Scalar, 0, (size_t)u2OrderSize + 4U);
+        DRV_CRYPTO_ECC_RamInvalidate();
         return CRYPTO_ECDSA_RESULT_ERROR_FAIL;
     }
 
@@ -276,16 +574,185 @@ CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_Sign(CPKCL_ECC_DATA *pEccData,
 #pragma GCC diagnostic pop
     /* MISRA C-2012 deviation block end */
     
-    (void) memcpy(pfulSignature, &signX[4], u2OrderSize);
-    (void) memcpy(&pfulSignature[u2OrderSize], &signY[4], u2OrderSize);
+    /* R and S on the key size, without the operand rounding */
+    (void) memcpy(pfulSignature, &signX[4U + u2OrderSize - u2KeySize], 
+                  u2KeySize);
+    (void) memcpy(&pfulSignature[u2KeySize], 
+                  &signY[4U + u2OrderSize - u2KeySize], u2KeySize);
+    
+    /* Nor once the signature is out */
+    (void) memset(pu1Scalar, 0, (size_t)u2OrderSize + 4U);
                     
     return CRYPTO_ECDSA_RESULT_SUCCESS;
 }
 
+// *****************************************************************************
+// *****************************************************************************
+// Section: CPKCL ECDSA Common Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_InitEccParamsSign(CPKCL_ECC_DATA *pEccData, 
+    pfu1 hash, u4 hashLen, pfu1 privKey, u4 privKeyLen, 
+    CRYPTO_CPKCL_CURVE eccCurveType)
+{
+    CRYPTO_CPKCL_RESULT result;
+    
+    /* Check the CPKCL is initialized and its self test passed */
+    result = DRV_CRYPTO_ECC_CheckCpkcl();
+    if (result != CRYPTO_CPKCL_RESULT_INIT_SUCCESS) 
+    {
+        return CRYPTO_ECDSA_RESULT_INIT_FAIL;
+    }
+    
+    /* Fill curve parameters */
+    result = DRV_CRYPTO_ECC_InitCurveParams(pEccData, eccCurveType);
+    if (result != CRYPTO_CPKCL_RESULT_CURVE_SUCCESS) 
+    {
+        return CRYPTO_ECDSA_RESULT_ERROR_CURVE;
+    }
+    
+    if (privKeyLen > pEccData->u2KeySize)
+    {
+        return CRYPTO_ECDSA_RESULT_ERROR_FAIL;
+    }
+    
+    /* Clean out local buffers */
+    (void) memset(privateKey, 0, sizeof(privateKey));
+    
+    /* Copy leaving first 4 bytes empty, right aligned on the operand size */
+    (void) memcpy(&privateKey[4U + pEccData->u2OrderSize - privKeyLen], 
+                  privKey, privKeyLen);
+    
+    /* Store in context, the hash is read in place by the signature */
+    pEccData->pfu1HashValue = hash;
+    pEccData->u2HashSize = (u2) hashLen;
+    pEccData->pfu1PrivateKey = (pfu1) privateKey;
+    
+    return CRYPTO_ECDSA_RESULT_SUCCESS;
+}
+
+CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_Sign(CPKCL_ECC_DATA *pEccData, 
+    pfu1 pfulSignature, u4 signatureLen)
+{
+    /* Clean out local buffers */
+    (void) memset(signX, 0, sizeof(signX));
+    (void) memset(signY, 0, sizeof(signY));
+    
+    /* Set sizes */
+    u2 u2ModuloPSize = pEccData->u2ModuloPSize;
+    u2 u2OrderSize = pEccData->u2OrderSize;
+    
+    if (DRV_CRYPTO_ECC_IsBinaryCurve(pEccData->curveType))
+    {
+        return lDRV_CRYPTO_ECDSA_SignGf2n(pEccData, pfulSignature);
+    }
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:1 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:12 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* Generate scalar number in place, away from the resident curve constants */
+    CPKCL_Rng(nu1RBase) = (nu1) BASE_ECDSA_SCALAR(u2ModuloPSize, u2OrderSize);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL_Rng(u2RLength) = u2OrderSize;
+    CPKCL(u2Option) = CPKCL_RNG_GET;
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    vCPKCL_Process(Rng, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        return CRYPTO_ECDSA_RESULT_ERROR_RNG;
+    }
+    
+    return lDRV_CRYPTO_ECDSA_SignZp(pEccData, pfulSignature);
+}
+
+CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_SignWithNonce(CPKCL_ECC_DATA *pEccData, 
+    pfu1 nonce, u4 nonceLen, pfu1 pfulSignature, u4 signatureLen)
+{
+    /* Clean out local buffers */
+    (void) memset(signX, 0, sizeof(signX));
+    (void) memset(signY, 0, sizeof(signY));
+    
+    /* Set sizes */
+    u2 u2ModuloPSize = pEccData->u2ModuloPSize;
+    u2 u2OrderSize = pEccData->u2OrderSize;
+    
+    /* The GF2N signature draws its scalar number inside the service */
+    if (DRV_CRYPTO_ECC_IsBinaryCurve(pEccData->curveType))
+    {
+        return CRYPTO_ECDSA_RESULT_ERROR_CURVE;
+    }
+    
+    if ((nonceLen == 0U) || (nonceLen > u2OrderSize))
+    {
+        return CRYPTO_ECDSA_RESULT_ERROR_FAIL;
+    }
+    
+    /* Right aligned in signX as for the private key, then reversed into 
+       crypto RAM. signX is cleared again by the signature. */
+    (void) memcpy(&signX[4U + u2OrderSize - nonceLen], nonce, nonceLen);
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:1 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:2 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    DRV_CRYPTO_ECC_SecureCopy(
+        (pu1) ((BASE_ECDSA_SCALAR(u2ModuloPSize, u2OrderSize))),
+        signX, u2OrderSize + 4U);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    (void) memset(signX, 0, sizeof(signX));
+    
+    return lDRV_CRYPTO_ECDSA_SignZp(pEccData, pfulSignature);
+}
+
  CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_InitEccParamsVerify(CPKCL_ECC_DATA *pEccData, 
     pfu1 hash, u4 hashLen, pfu1 pubKey, CRYPTO_CPKCL_CURVE eccCurveType)
 {
     CRYPTO_CPKCL_RESULT result;
+    CRYPTO_ECDSA_RESULT ecdsaResult;
+    
+    /* Check the CPKCL is initialized and its self test passed */
+    result = DRV_CRYPTO_ECC_CheckCpkcl();
+    if (result != CRYPTO_CPKCL_RESULT_INIT_SUCCESS) 
+    {
+        return CRYPTO_ECDSA_RESULT_INIT_FAIL;
+    }
     
     /* Fill curve parameters */
     result = DRV_CRYPTO_ECC_InitCurveParams(pEccData, eccCurveType);
@@ -294,11 +761,27 @@ CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_Sign(CPKCL_ECC_DATA *pEccData,
         return CRYPTO_ECDSA_RESULT_ERROR_CURVE;
     }
     
+    ecdsaResult = DRV_CRYPTO_ECDSA_SetVerifyKey(pEccData, pubKey);
+    
+    /* The hash is read in place by the verification */
+    pEccData->pfu1HashValue = hash;
+    pEccData->u2HashSize = (u2) hashLen;
+    
+    return ecdsaResult;
+}
+
+CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_SetVerifyKey(CPKCL_ECC_DATA *pEccData, 
+    pfu1 pubKey)
+{
+    CRYPTO_CPKCL_RESULT result;
+    
     /* Get coordinates of public key */
     (void) memset(pubKeyX, 0, sizeof(pubKeyX));
     (void) memset(pubKeyY, 0, sizeof(pubKeyY));
-    result = DRV_CRYPTO_ECC_SetPubKeyCoordinates(pEccData, pubKey, &pubKeyX[4], 
-                                                 &pubKeyY[4], eccCurveType);
+    result = DRV_CRYPTO_ECC_SetPubKeyCoordinates(pEccData, pubKey, 
+        &pubKeyX[4U + pEccData->u2ModuloPSize - pEccData->u2KeySize], 
+        &pubKeyY[4U + pEccData->u2ModuloPSize - pEccData->u2KeySize], 
+        pEccData->curveType);
     if (result == CRYPTO_CPKCL_RESULT_CURVE_ERROR)
     {
         return CRYPTO_ECDSA_RESULT_ERROR_CURVE;
@@ -315,13 +798,17 @@ CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_Sign(CPKCL_ECC_DATA *pEccData,
     pEccData->pfu1PublicKeyX = (pfu1) pubKeyX;
     pEccData->pfu1PublicKeyY = (pfu1) pubKeyY;
     
-    /* Store hash locally */
-    (void) memset(localHash, 0, sizeof(localHash));
-    (void) memcpy(&localHash[4], hash, hashLen);
-    pEccData->pfu1HashValue = (pfu1) localHash;
-    
     return CRYPTO_ECDSA_RESULT_SUCCESS;
 }
+
+CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_VerifyHash(CPKCL_ECC_DATA *pEccData, 
+    pfu1 hash, u4 hashLen, pfu1 pfu1Signature)
+{
+    pEccData->pfu1HashValue = hash;
+    pEccData->u2HashSize = (u2) hashLen;
+    
+    return DRV_CRYPTO_ECDSA_Verify(pEccData, pfu1Signature);
+}
     
 CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_Verify(CPKCL_ECC_DATA *pEccData, 
     pfu1 pfu1Signature)
@@ -331,14 +818,17 @@ CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_Verify(CPKCL_ECC_DATA *pEccData,
     /* Set sizes */
     u2 u2ModuloPSize = pEccData->u2ModuloPSize;	
     u2 u2OrderSize = pEccData->u2OrderSize;
+    u2 u2KeySize = pEccData->u2KeySize;
     
     /* Clean out local buffers */
     (void) memset(signX, 0, sizeof(signX));
     (void) memset(signY, 0, sizeof(signY));
     
     /* Copy signature leaving first 4 bytes empty */
-    (void) memcpy(&signX[4], pfu1Signature, u2OrderSize);
-    (void) memcpy(&signY[4], &pfu1Signature[u2OrderSize], u2OrderSize);
+    (void) memcpy(&signX[4U + u2OrderSize - u2KeySize], pfu1Signature, 
+                  u2KeySize);
+    (void) memcpy(&signY[4U + u2OrderSize - u2KeySize], 
+                  &pfu1Signature[u2KeySize], u2KeySize);
 
     /* MISRA C-2012 deviation block start */
     /* MISRA C-2012 Rule 10.1, 10.4, 20.7 deviated below. Deviation record ID - 
@@ -360,6 +850,11 @@ CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_Verify(CPKCL_ECC_DATA *pEccData,
     DRV_CRYPTO_ECC_SecureCopy(pu1Tmp, signX, u2OrderSize + 4U);
     DRV_CRYPTO_ECC_SecureCopy(pu1Tmp + u2OrderSize + 4U, signY, u2OrderSize + 4U);
 
+    if (DRV_CRYPTO_ECC_IsBinaryCurve(pEccData->curveType))
+    {
+        return lDRV_CRYPTO_ECDSA_VerifyGf2n(pEccData);
+    }
+
     /* MISRA C-2012 deviation block start */
     /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
        H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
@@ -370,37 +865,44 @@ CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_Verify(CPKCL_ECC_DATA *pEccData,
 (deviate:126 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
 (deviate:9 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
 (deviate:16 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
-    /* Copy parameters for ECDSA signature verification in memory areas */
-    DRV_CRYPTO_ECC_SecureCopy(
-        (pu1) ((BASE_ECDSAV_MODULO(u2ModuloPSize, u2OrderSize))),
-        pEccData->pfu1ModuloP, u2ModuloPSize + 4U);
-    DRV_CRYPTO_ECC_SecureCopy(
+    /* Curve constants are skipped when the previous verification left them */
+    if (!DRV_CRYPTO_ECC_RamIsResident(pEccData->curveType, 
+            CRYPTO_CPKCL_RAM_ECDSA_VERIFY))
+    {
+        (void) memcpy(
+            (pu1) ((BASE_ECDSAV_MODULO(u2ModuloPSize, u2OrderSize))),
+            pEccData->pfu1ModuloP, u2ModuloPSize + 4U);
+        (void) memcpy(
+            (pu1) ((BASE_ECDSAV_A(u2ModuloPSize, u2OrderSize))),
+            pEccData->pfu1ACurve, u2ModuloPSize + 4U);
+        (void) memcpy(
+            (pu1) ((BASE_ECDSAV_ORDER(u2ModuloPSize, u2OrderSize))),
+            pEccData->pfu1APointOrder, u2OrderSize + 4U);
+        DRV_CRYPTO_ECC_RamSetResident(pEccData->curveType, 
+            CRYPTO_CPKCL_RAM_ECDSA_VERIFY);
+    }
+
+    /* Points are used as work areas, load them every time */
+    (void) memcpy(
         (pu1) ((BASE_ECDSAV_POINT_A_X(u2ModuloPSize, u2OrderSize))),
         pEccData->pfu1APointX, u2ModuloPSize + 4U);
-    DRV_CRYPTO_ECC_SecureCopy(
+    (void) memcpy(
         (pu1) ((BASE_ECDSAV_POINT_A_Y(u2ModuloPSize, u2OrderSize))),
         pEccData->pfu1APointY, u2ModuloPSize + 4U);
-    DRV_CRYPTO_ECC_SecureCopy(
+    (void) memcpy(
         (pu1) ((BASE_ECDSAV_POINT_A_Z(u2ModuloPSize, u2OrderSize))),
         pEccData->pfu1APointZ, u2ModuloPSize + 4U);
-    DRV_CRYPTO_ECC_SecureCopy(
-        (pu1) ((BASE_ECDSAV_A(u2ModuloPSize, u2OrderSize))),
-        pEccData->pfu1ACurve, u2ModuloPSize + 4U);
-    DRV_CRYPTO_ECC_SecureCopy(
-        (pu1) ((BASE_ECDSAV_ORDER(u2ModuloPSize, u2OrderSize))),
-        pEccData->pfu1APointOrder, u2OrderSize + 4U);
     DRV_CRYPTO_ECC_SecureCopy(
         (pu1) ((BASE_ECDSAV_PUBLIC_KEY_X(u2ModuloPSize, u2OrderSize))),
         pEccData->pfu1PublicKeyX, u2ModuloPSize + 4U);
     DRV_CRYPTO_ECC_SecureCopy(
         (pu1) ((BASE_ECDSAV_PUBLIC_KEY_Y(u2ModuloPSize, u2OrderSize))),
         pEccData->pfu1PublicKeyY, u2ModuloPSize + 4U);
-    DRV_CRYPTO_ECC_SecureCopy(
+    (void) memcpy(
         (pu1) ((BASE_ECDSAV_PUBLIC_KEY_Z(u2ModuloPSize, u2OrderSize))),
         pEccData->pfu1PublicKeyZ, u2ModuloPSize + 4U);
-    DRV_CRYPTO_ECC_SecureCopy(
-        (pu1) ((BASE_ECDSAV_HASH(u2ModuloPSize, u2OrderSize))),
-        pEccData->pfu1HashValue, u2ModuloPSize + 4U);
+    lDRV_CRYPTO_ECDSA_WriteHash(
+        (pu1) ((BASE_ECDSAV_HASH(u2ModuloPSize, u2OrderSize))), pEccData);
 
     /* Ask for a verification generation */
     CPKCL_ZpEcDsaVerify(nu1ModBase) = (nu1) BASE_ECDSAV_MODULO(u2ModuloPSize,
@@ -448,6 +950,7 @@ CRYPTO_ECDSA_RESULT DRV_CRYPTO_ECDSA_Verify(CPKCL_ECC_DATA *pEccData,
     /* MISRA C-2012 deviation block end */
     if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
     {
+        DRV_CRYPTO_ECC_RamInvalidate();
         return CRYPTO_ECDSA_RESULT_ERROR_FAIL;
     }
 
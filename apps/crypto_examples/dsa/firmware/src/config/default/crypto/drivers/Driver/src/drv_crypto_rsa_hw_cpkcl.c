@@ -0,0 +1,487 @@
+/**************************************************************************
+  Crypto Framework Library Header
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_crypto_rsa_hw_cpkcl.c
+
+  Summary:
+    Crypto Framework Library source for the CPKCC RSA functions.
+
+  Description:
+    This source contains the function code for the CPKCC RSA primitives.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2024, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "crypto/drivers/driver/drv_crypto_ecc_hw_cpkcl.h"
+#include "crypto/drivers/driver/drv_crypto_rsa_hw_cpkcl.h"
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_typedef_pb.h"
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_mapping_pb.h"
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_Headers_pb.h"
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_JumpTable_Addr_pb.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Variables
+// *****************************************************************************
+// *****************************************************************************
+
+// Result of the CRT, released once checked with the public exponent
+static u1 crtResult[CRYPTO_RSA_HW_MAX_MODULUS_SIZE];
+static u1 crtCheck[CRYPTO_RSA_HW_MAX_MODULUS_SIZE];
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Writes an MSB first number into crypto RAM in LSB mode, zero extended to
+   u2Length bytes plus the padding word */
+static void lDRV_CRYPTO_RSA_Load(pu1 pu1Dest, pfu1 pfu1Src, u2 u2SrcLength,
+    u2 u2Length)
+{
+    u2 u2Cpt;
+
+    (void) memset(pu1Dest, 0, (size_t)u2Length + 4U);
+    for (u2Cpt = 0; u2Cpt < u2SrcLength; u2Cpt++)
+    {
+        pu1Dest[u2Cpt] = pfu1Src[u2SrcLength - u2Cpt - 1U];
+    }
+}
+
+/* Reads a number in LSB mode from crypto RAM, MSB first */
+static void lDRV_CRYPTO_RSA_Store(pfu1 pfu1Dest, pu1 pu1Src, u2 u2Length)
+{
+    u2 u2Cpt;
+
+    for (u2Cpt = 0; u2Cpt < u2Length; u2Cpt++)
+    {
+        pfu1Dest[u2Cpt] = pu1Src[u2Length - u2Cpt - 1U];
+    }
+}
+
+/* x < n, both MSB first on u2Length bytes */
+static bool lDRV_CRYPTO_RSA_IsBelow(pfu1 pfu1X, pfu1 pfu1N, u2 u2Length)
+{
+    u2 u2Cpt;
+
+    for (u2Cpt = 0; u2Cpt < u2Length; u2Cpt++)
+    {
+        if (pfu1X[u2Cpt] != pfu1N[u2Cpt])
+        {
+            return (pfu1X[u2Cpt] < pfu1N[u2Cpt]);
+        }
+    }
+
+    return false;
+}
+
+static bool lDRV_CRYPTO_RSA_CheckModulus(pfu1 pfu1N, u2 u2ModLength)
+{
+    return ((u2ModLength >= CRYPTO_RSA_HW_MIN_MODULUS_SIZE) &&
+            (u2ModLength <= CRYPTO_RSA_HW_MAX_MODULUS_SIZE) &&
+            ((u2ModLength & 3U) == 0U) && (pfu1N[0] != 0U) &&
+            ((pfu1N[u2ModLength - 1U] & 1U) != 0U));
+}
+
+/* y = x^e mod n on ExpMod, the arguments are checked by the caller */
+static CRYPTO_RSA_RESULT lDRV_CRYPTO_RSA_ExpModPublic(pfu1 pfu1N,
+    u2 u2ModLength, pfu1 pfu1E, u2 u2ELength, pfu1 pfu1X, pfu1 pfu1Y)
+{
+    u2 u2ExpLength;
+    pu1 pu1XArea;
+
+    /* Skip the leading zero bytes of e and process whole words only */
+    while ((u2ELength > 0U) && (pfu1E[0] == 0U))
+    {
+        pfu1E++;
+        u2ELength--;
+    }
+    if ((u2ELength == 0U) || (u2ELength > u2ModLength))
+    {
+        return CRYPTO_RSA_RESULT_ERROR_KEY;
+    }
+    u2ExpLength = (u2) ((u2ELength + 3U) & ~3U);
+
+    /* The ECC constants do not survive */
+    DRV_CRYPTO_ECC_RamInvalidate();
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:8 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:24 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:8 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:8 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    lDRV_CRYPTO_RSA_Load((pu1) BASE_RSA_EXPMOD_MODULO(u2ModLength), pfu1N,
+        u2ModLength, u2ModLength);
+
+    /* Reduction constant of n, the X and precomputation areas are the
+       workspace of the setup */
+    CPKCL_RedMod(u2ModLength) = u2ModLength;
+    CPKCL_RedMod(nu1ModBase) = (nu1) BASE_RSA_EXPMOD_MODULO(u2ModLength);
+    CPKCL_RedMod(nu1CnsBase) = (nu1) BASE_RSA_EXPMOD_CNS(u2ModLength);
+    CPKCL_RedMod(nu1RBase) = (nu1) BASE_RSA_EXPMOD_PRECOMP(u2ModLength);
+    CPKCL_RedMod(nu1XBase) = (nu1) BASE_RSA_EXPMOD_X(u2ModLength);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL(u2Option) = CPKCL_REDMOD_SETUP;
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    vCPKCL_Process(RedMod, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        return CRYPTO_RSA_RESULT_ERROR_FAIL;
+    }
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:7 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:30 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:7 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:7 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    pu1XArea = (pu1) BASE_RSA_EXPMOD_X(u2ModLength);
+
+    /* The least significant word of the X area stays 0, X follows it */
+    (void) memset(pu1XArea, 0, (3U * (size_t)u2ModLength) + 24U);
+    lDRV_CRYPTO_RSA_Load(&pu1XArea[4], pfu1X, u2ModLength, u2ModLength);
+    lDRV_CRYPTO_RSA_Load((pu1) BASE_RSA_EXPMOD_EXPONENT(u2ModLength),
+        pfu1E, u2ELength, u2ExpLength);
+
+    CPKCL_ExpMod(nu1ModBase) = (nu1) BASE_RSA_EXPMOD_MODULO(u2ModLength);
+    CPKCL_ExpMod(nu1CnsBase) = (nu1) BASE_RSA_EXPMOD_CNS(u2ModLength);
+    CPKCL_ExpMod(nu1XBase) = (nu1) BASE_RSA_EXPMOD_X(u2ModLength);
+    CPKCL_ExpMod(nu1PrecompBase) = (nu1) BASE_RSA_EXPMOD_PRECOMP(u2ModLength);
+    CPKCL_ExpMod(pfu1ExpBase) = (pfu1) BASE_RSA_EXPMOD_EXPONENT(u2ModLength);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL_ExpMod(u2ModLength) = u2ModLength;
+    CPKCL_ExpMod(u2ExpLength) = u2ExpLength;
+    CPKCL_ExpMod(u1Blinding) = 0U;
+
+    /* The exponent is public, the fast exponentiation needs no protection */
+    CPKCL(u2Option) = (u2) (CPKCL_EXPMOD_FASTRSA |
+        CPKCL_EXPMOD_EXPINPKCCRAM | CPKCL_EXPMOD_WINDOWSIZE_1);
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    vCPKCL_Process(ExpMod, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        return CRYPTO_RSA_RESULT_ERROR_FAIL;
+    }
+
+    /* The result replaces X */
+    lDRV_CRYPTO_RSA_Store(pfu1Y, &pu1XArea[4], u2ModLength);
+
+    return CRYPTO_RSA_RESULT_SUCCESS;
+}
+
+/* Runs the CRT service, the result is left in crtResult. The key material is
+   cleared from crypto RAM whatever the outcome. */
+static CRYPTO_RSA_RESULT lDRV_CRYPTO_RSA_Crt(CPKCL_RSA_CRT_KEY *pKey,
+    pfu1 pfu1X)
+{
+    u2 u2PrimeLength = pKey->u2PrimeLength;
+    u2 u2ModLength = (u2) (2U * u2PrimeLength);
+    CRYPTO_RSA_RESULT result = CRYPTO_RSA_RESULT_SUCCESS;
+    pu1 pu1Base;
+    pu1 pu1XArea;
+    size_t ramSize;
+
+    DRV_CRYPTO_ECC_RamInvalidate();
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:12 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:48 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:12 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:12 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    pu1Base = (pu1) BASE_RSA_CRT_MODULO(u2PrimeLength);
+    pu1XArea = (pu1) BASE_RSA_CRT_X(u2PrimeLength);
+    ramSize = (size_t) ((BASE_RSA_CRT_EXPONENT(u2PrimeLength) +
+        2U * u2PrimeLength + 8U) - BASE_RSA_CRT_MODULO(u2PrimeLength));
+
+    /* P then Q, the X area with its zero least significant word, qInv
+       ahead of the precomputations and dP then dQ */
+    lDRV_CRYPTO_RSA_Load(pu1Base, pKey->pfu1P, u2PrimeLength, u2PrimeLength);
+    lDRV_CRYPTO_RSA_Load(&pu1Base[u2PrimeLength + 4U], pKey->pfu1Q,
+        u2PrimeLength, u2PrimeLength);
+    (void) memset(pu1XArea, 0, (6U * (size_t)u2PrimeLength) + 24U);
+    lDRV_CRYPTO_RSA_Load(&pu1XArea[4], pfu1X, u2ModLength, u2ModLength);
+    (void) memset((pu1) BASE_RSA_CRT_PRECOMP(u2PrimeLength), 0,
+        (4U * (size_t)u2PrimeLength) + 28U);
+    lDRV_CRYPTO_RSA_Load((pu1) BASE_RSA_CRT_PRECOMP(u2PrimeLength),
+        pKey->pfu1QInv, u2PrimeLength, u2PrimeLength);
+    lDRV_CRYPTO_RSA_Load((pu1) BASE_RSA_CRT_EXPONENT(u2PrimeLength),
+        pKey->pfu1DP, u2PrimeLength, u2PrimeLength);
+    lDRV_CRYPTO_RSA_Load((pu1) (BASE_RSA_CRT_EXPONENT(u2PrimeLength) +
+        u2PrimeLength + 4U), pKey->pfu1DQ, u2PrimeLength, u2PrimeLength);
+
+    CPKCL_CRT(nu1ModBase) = (nu1) BASE_RSA_CRT_MODULO(u2PrimeLength);
+    CPKCL_CRT(nu1XBase) = (nu1) BASE_RSA_CRT_X(u2PrimeLength);
+    CPKCL_CRT(nu1PrecompBase) = (nu1) BASE_RSA_CRT_PRECOMP(u2PrimeLength);
+    CPKCL_CRT(pfu1ExpBase) = (pfu1) BASE_RSA_CRT_EXPONENT(u2PrimeLength);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL_CRT(u2ModLength) = u2PrimeLength;
+    CPKCL_CRT(u2ExpLength) = u2PrimeLength;
+    CPKCL_CRT(u1Blinding) = 0U;
+
+    /* The exponents are secret, the regular exponentiation keeps the
+       sequence of operations independent of them */
+    CPKCL(u2Option) = (u2) (CPKCL_EXPMOD_REGULARRSA |
+        CPKCL_EXPMOD_EXPINPKCCRAM | CPKCL_EXPMOD_WINDOWSIZE_1);
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    vCPKCL_Process(CRT, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        result = CRYPTO_RSA_RESULT_ERROR_FAIL;
+    }
+    else
+    {
+        /* The result replaces X */
+        lDRV_CRYPTO_RSA_Store(crtResult, &pu1XArea[4], u2ModLength);
+    }
+
+    (void) memset(pu1Base, 0, ramSize);
+
+    return result;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: CPKCC RSA Common Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+CRYPTO_RSA_RESULT DRV_CRYPTO_RSA_Public(pfu1 pfu1N, u2 u2ModLength,
+    pfu1 pfu1E, u2 u2ELength, pfu1 pfu1X, pfu1 pfu1Y)
+{
+    /* Check the CPKCL is initialized and its self test passed */
+    if (DRV_CRYPTO_ECC_CheckCpkcl() != CRYPTO_CPKCL_RESULT_INIT_SUCCESS)
+    {
+        return CRYPTO_RSA_RESULT_INIT_FAIL;
+    }
+
+    if (!lDRV_CRYPTO_RSA_CheckModulus(pfu1N, u2ModLength))
+    {
+        return CRYPTO_RSA_RESULT_ERROR_KEY;
+    }
+
+    if (!lDRV_CRYPTO_RSA_IsBelow(pfu1X, pfu1N, u2ModLength))
+    {
+        return CRYPTO_RSA_RESULT_ERROR_INPUT;
+    }
+
+    return lDRV_CRYPTO_RSA_ExpModPublic(pfu1N, u2ModLength, pfu1E, u2ELength,
+        pfu1X, pfu1Y);
+}
+
+CRYPTO_RSA_RESULT DRV_CRYPTO_RSA_PrivateCrt(CPKCL_RSA_CRT_KEY *pKey,
+    pfu1 pfu1X, pfu1 pfu1Y)
+{
+    u2 u2ModLength = (u2) (2U * pKey->u2PrimeLength);
+    CRYPTO_RSA_RESULT result;
+
+    /* Check the CPKCL is initialized and its self test passed */
+    if (DRV_CRYPTO_ECC_CheckCpkcl() != CRYPTO_CPKCL_RESULT_INIT_SUCCESS)
+    {
+        return CRYPTO_RSA_RESULT_INIT_FAIL;
+    }
+
+    if (!lDRV_CRYPTO_RSA_CheckModulus(pKey->pfu1N, u2ModLength) ||
+        ((pKey->pfu1P[pKey->u2PrimeLength - 1U] & 1U) == 0U) ||
+        ((pKey->pfu1Q[pKey->u2PrimeLength - 1U] & 1U) == 0U))
+    {
+        return CRYPTO_RSA_RESULT_ERROR_KEY;
+    }
+
+    if (!lDRV_CRYPTO_RSA_IsBelow(pfu1X, pKey->pfu1N, u2ModLength))
+    {
+        return CRYPTO_RSA_RESULT_ERROR_INPUT;
+    }
+
+    result = lDRV_CRYPTO_RSA_Crt(pKey, pfu1X);
+
+    /* Bellcore check: y^e must give x back */
+    if (result == CRYPTO_RSA_RESULT_SUCCESS)
+    {
+        result = lDRV_CRYPTO_RSA_ExpModPublic(pKey->pfu1N, u2ModLength,
+            pKey->pfu1E, pKey->u2ELength, crtResult, crtCheck);
+    }
+    if ((result == CRYPTO_RSA_RESULT_SUCCESS) &&
+        (memcmp(crtCheck, pfu1X, u2ModLength) != 0))
+    {
+        result = CRYPTO_RSA_RESULT_ERROR_FAIL;
+    }
+
+    if (result == CRYPTO_RSA_RESULT_SUCCESS)
+    {
+        (void) memcpy(pfu1Y, crtResult, u2ModLength);
+    }
+
+    (void) memset(crtResult, 0, sizeof(crtResult));
+    (void) memset(crtCheck, 0, sizeof(crtCheck));
+
+    return result;
+}
+
+CRYPTO_RSA_RESULT DRV_CRYPTO_RSA_Random(pfu1 pfu1Out, u2 u2Length)
+{
+    pu1 pu1R;
+
+    if ((u2Length == 0U) || (u2Length > CRYPTO_RSA_HW_MAX_MODULUS_SIZE))
+    {
+        return CRYPTO_RSA_RESULT_ERROR_FAIL;
+    }
+
+    if (DRV_CRYPTO_ECC_CheckCpkcl() != CRYPTO_CPKCL_RESULT_INIT_SUCCESS)
+    {
+        return CRYPTO_RSA_RESULT_INIT_FAIL;
+    }
+
+    DRV_CRYPTO_ECC_RamInvalidate();
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:2 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:2 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:2 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    pu1R = (pu1) BASE_RSA_EXPMOD_MODULO(0U);
+    CPKCL_Rng(nu1RBase) = (nu1) BASE_RSA_EXPMOD_MODULO(0U);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL_Rng(u2RLength) = (u2) ((u2Length + 3U) & ~3U);
+    CPKCL(u2Option) = CPKCL_RNG_GET;
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    vCPKCL_Process(Rng, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        return CRYPTO_RSA_RESULT_ERROR_RNG;
+    }
+
+    (void) memcpy(pfu1Out, pu1R, u2Length);
+    (void) memset(pu1R, 0, ((size_t)u2Length + 3U) & ~(size_t)3U);
+
+    return CRYPTO_RSA_RESULT_SUCCESS;
+}
@@ -77,6 +77,31 @@ crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_Verify(uint8_t *inputHash,
     uint32_t pubKeyLen, int8_t *hashVerifyStatus, 
     crypto_EccCurveType_E eccCurveType_En);
 
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_SignData(uint8_t *inputData, 
+    uint32_t dataLen, uint8_t *outSig, uint32_t sigLen, uint8_t *privKey, 
+    uint32_t privKeyLen, crypto_Hash_Algo_E hashType, 
+    crypto_EccCurveType_E eccCurveType_En);
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_VerifyData(uint8_t *inputData, 
+    uint32_t dataLen, uint8_t *inputSig, uint32_t sigLen, uint8_t *pubKey, 
+    uint32_t pubKeyLen, crypto_Hash_Algo_E hashType, int8_t *hashVerifyStatus, 
+    crypto_EccCurveType_E eccCurveType_En);
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecc_Hw_KeyGen(uint8_t *privKey, 
+    uint32_t privKeyLen, uint8_t *pubKey, uint32_t pubKeyLen, 
+    crypto_EccCurveType_E eccCurveType_En);
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_VerifyBatch(
+    st_Crypto_DigiSign_Ecdsa_VerifyItem *items, uint32_t numItems, 
+    uint32_t *verifyBitmap, crypto_EccCurveType_E eccCurveType_En);
+
+/* RFC 6979 nonce from an HMAC_DRBG on the SHA engine, signed by the CPKCC 
+   without drawing a random number */
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_SignDeterministic(
+    uint8_t *inputHash, uint32_t hashLen, uint8_t *outSig, uint32_t sigLen, 
+    uint8_t *privKey, uint32_t privKeyLen, crypto_Hash_Algo_E hashType, 
+    crypto_EccCurveType_E eccCurveType_En);
+
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
@@ -74,6 +74,15 @@ typedef struct
     uint8_t buffer[128]; /* Maximum size for all */
 } CRYPTO_HASH_HW_CONTEXT;
 
+/* HMAC on the SHA engine: the inner hash runs from HmacInit to HmacFinal, the
+   outer one in HmacFinal. The engine keeps the state of one hash, no other 
+   hash may run on it in between. */
+typedef struct 
+{
+    CRYPTO_HASH_HW_CONTEXT shaCtx;
+    uint8_t outerKey[128];  /* Key xor opad, hashed by HmacFinal */
+} CRYPTO_HMAC_HW_CONTEXT;
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Hash Algorithms Common Interface 
@@ -92,6 +101,17 @@ crypto_Hash_Status_E Crypto_Hash_Hw_Sha_Update(void *shaUpdateCtx,
 crypto_Hash_Status_E Crypto_Hash_Hw_Sha_Final(void *shaFinalCtx, 
     uint8_t *digest);
 
+crypto_Hash_Status_E Crypto_Hash_Hw_Sha_HmacInit(void *hmacInitCtx, 
+    uint8_t *key, uint32_t keyLen, crypto_Hash_Algo_E shaAlgorithm_en);
+
+crypto_Hash_Status_E Crypto_Hash_Hw_Sha_HmacUpdate(void *hmacUpdateCtx, 
+    uint8_t *data, uint32_t dataLen);
+
+/* The MAC is written 32 bits at a time on the digest size, mac is 4 byte 
+   aligned */
+crypto_Hash_Status_E Crypto_Hash_Hw_Sha_HmacFinal(void *hmacFinalCtx, 
+    uint8_t *mac);
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
 
@@ -0,0 +1,106 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_rsa_cpkcc44163_wrapper.h
+
+  Summary:
+    Crypto Framework Library wrapper file for RSA in the hardware 
+    cryptographic library.
+
+  Description:
+    This header file contains the wrapper interface to access the hardware 
+    cryptographic library in Microchip microcontrollers for RSA.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2024, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef CRYPTO_RSA_CPKCC44163_WRAPPER_H
+#define CRYPTO_RSA_CPKCC44163_WRAPPER_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_rsa.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: RSA Common Interface 
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Rsa_Status_E Crypto_Rsa_Hw_Pkcs1v15_Sign(uint8_t *inputHash, 
+    uint32_t hashLen, crypto_Hash_Algo_E hashType, uint8_t *outSig, 
+    uint32_t sigLen, st_Crypto_Rsa_PrivKey *privKey);
+
+crypto_Rsa_Status_E Crypto_Rsa_Hw_Pkcs1v15_Verify(uint8_t *inputHash, 
+    uint32_t hashLen, crypto_Hash_Algo_E hashType, uint8_t *inputSig, 
+    uint32_t sigLen, st_Crypto_Rsa_PubKey *pubKey, int8_t *hashVerifyStatus);
+
+crypto_Rsa_Status_E Crypto_Rsa_Hw_Pss_Sign(uint8_t *inputHash, 
+    uint32_t hashLen, crypto_Hash_Algo_E hashType, uint32_t saltLen, 
+    uint8_t *outSig, uint32_t sigLen, st_Crypto_Rsa_PrivKey *privKey);
+
+crypto_Rsa_Status_E Crypto_Rsa_Hw_Pss_Verify(uint8_t *inputHash, 
+    uint32_t hashLen, crypto_Hash_Algo_E hashType, uint32_t saltLen, 
+    uint8_t *inputSig, uint32_t sigLen, st_Crypto_Rsa_PubKey *pubKey, 
+    int8_t *hashVerifyStatus);
+
+crypto_Rsa_Status_E Crypto_Rsa_Hw_Oaep_Encrypt(uint8_t *inputData, 
+    uint32_t dataLen, crypto_Hash_Algo_E hashType, uint8_t *label, 
+    uint32_t labelLen, uint8_t *outData, uint32_t outDataLen, 
+    st_Crypto_Rsa_PubKey *pubKey);
+
+crypto_Rsa_Status_E Crypto_Rsa_Hw_Oaep_Decrypt(uint8_t *inputData, 
+    uint32_t dataLen, crypto_Hash_Algo_E hashType, uint8_t *label, 
+    uint32_t labelLen, uint8_t *outData, uint32_t outDataLen, 
+    uint32_t *msgLen, st_Crypto_Rsa_PrivKey *privKey);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif /* CRYPTO_RSA_CPKCC44163_WRAPPER_H */
@@ -48,7 +48,11 @@ Microchip or any third party.
 // *****************************************************************************
 
 #include <stdint.h>
+#include <string.h>
 #include "crypto/drivers/wrapper/crypto_digisign_cpkcc44163_wrapper.h"
+#include "crypto/drivers/wrapper/crypto_hash_sha6156_wrapper.h"
+#include "crypto/common_crypto/crypto_ecc_pool.h"
+#include "crypto/common_crypto/crypto_rfc6979.h"
 #include "crypto/drivers/driver/drv_crypto_ecc_hw_cpkcl.h"
 #include "crypto/drivers/driver/drv_crypto_ecdsa_hw_cpkcl.h"
 
@@ -84,6 +88,38 @@ static crypto_DigiSign_Status_E lCrypto_DigSign_Ecdsa_Hw_GetCurve(
         case CRYPTO_ECC_CURVE_P521:
             *hwEccCurve = CRYPTO_CPKCL_CURVE_P521;
             break;
+        
+        case CRYPTO_ECC_CURVE_SECT233K1:
+            *hwEccCurve = CRYPTO_CPKCL_CURVE_SECT233K1;
+            break;
+        
+        case CRYPTO_ECC_CURVE_SECT233R1:
+            *hwEccCurve = CRYPTO_CPKCL_CURVE_SECT233R1;
+            break;
+        
+        case CRYPTO_ECC_CURVE_SECT283K1:
+            *hwEccCurve = CRYPTO_CPKCL_CURVE_SECT283K1;
+            break;
+        
+        case CRYPTO_ECC_CURVE_SECT283R1:
+            *hwEccCurve = CRYPTO_CPKCL_CURVE_SECT283R1;
+            break;
+        
+        case CRYPTO_ECC_CURVE_BRAINPOOLP256R1:
+            *hwEccCurve = CRYPTO_CPKCL_CURVE_BP256R1;
+            break;
+        
+        case CRYPTO_ECC_CURVE_BRAINPOOLP384R1:
+            *hwEccCurve = CRYPTO_CPKCL_CURVE_BP384R1;
+            break;
+        
+        case CRYPTO_ECC_CURVE_SECP256K1:
+            *hwEccCurve = CRYPTO_CPKCL_CURVE_SECP256K1;
+            break;
+        
+        case CRYPTO_ECC_CURVE_CUSTOM:
+            *hwEccCurve = CRYPTO_CPKCL_CURVE_CUSTOM;
+            break;
             
         default:
             digiSigntatus = CRYPTO_DIGISIGN_ERROR_CURVE;
@@ -129,6 +165,135 @@ static crypto_DigiSign_Status_E lCrypto_DigSign_Ecdsa_Hw_MapResult(
     return digiSigntatus;
 }
 
+/* Hashes the message on the SHA engine. Only the SHA-2 sizes used with the
+ * NIST prime curves are accepted. */
+static crypto_DigiSign_Status_E lCrypto_DigSign_Ecdsa_Hw_Hash(uint8_t *inputData,
+    uint32_t dataLen, crypto_Hash_Algo_E hashType, uint32_t *digest,
+    uint32_t *digestLen)
+{
+    crypto_DigiSign_Status_E digiSigntatus = CRYPTO_DIGISIGN_SUCCESS;
+    
+    switch (hashType)
+    {
+        case CRYPTO_HASH_SHA2_256:
+            *digestLen = 32U;
+            break;
+            
+        case CRYPTO_HASH_SHA2_384:
+            *digestLen = 48U;
+            break;
+            
+        case CRYPTO_HASH_SHA2_512:
+            *digestLen = 64U;
+            break;
+            
+        default:
+            digiSigntatus = CRYPTO_DIGISIGN_ERROR_HASHTYPE;
+            break;
+    }
+    
+    if (digiSigntatus == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        if (Crypto_Hash_Hw_Sha_Digest(inputData, dataLen, (uint8_t *)digest, 
+                hashType) != CRYPTO_HASH_SUCCESS)
+        {
+            digiSigntatus = CRYPTO_DIGISIGN_ERROR_FAIL;
+        }
+    }
+    
+    return digiSigntatus;
+}
+
+/* Signs with a nonce pair drawn by the key generation, whose k*G runs on the 
+ * comb table of the curve, and s computed in software. Returns false when the
+ * curve has no comb table or a step fails, the CPKCL signature then runs. */
+static bool lCrypto_DigSign_Ecdsa_Hw_CombSign(uint8_t *inputHash, 
+    uint32_t hashLen, uint8_t *outSig, uint32_t sigLen, uint8_t *privKey, 
+    uint32_t privKeyLen, crypto_EccCurveType_E eccCurveType_En, 
+    CRYPTO_CPKCL_CURVE hwEccCurve)
+{
+    CPKCL_ECC_DATA eccData;
+    uint8_t k[CRYPTO_ECC_MAX_KEY_LENGTH];
+    uint8_t kG[(2 * CRYPTO_ECC_MAX_KEY_LENGTH) + 1];
+    bool signed_b = false;
+    
+    if (!DRV_CRYPTO_ECC_CombIsUsed(hwEccCurve) 
+            || (DRV_CRYPTO_ECC_CheckCpkcl() != CRYPTO_CPKCL_RESULT_INIT_SUCCESS)
+            || (DRV_CRYPTO_ECC_InitCurveParams(&eccData, hwEccCurve) 
+                != CRYPTO_CPKCL_RESULT_CURVE_SUCCESS)
+            || ((uint32_t)eccData.u2KeySize > (uint32_t)CRYPTO_ECC_MAX_KEY_LENGTH))
+    {
+        return false;
+    }
+    
+    if (DRV_CRYPTO_ECC_KeyGen(&eccData, (pfu1)k, (pfu1)kG) 
+            == CRYPTO_CPKCL_RESULT_KEYGEN_SUCCESS)
+    {
+        signed_b = (Crypto_Ecc_Pool_EcdsaSignNonce(eccCurveType_En, k, 
+            (uint32_t)eccData.u2KeySize, kG, 
+            (2U * (uint32_t)eccData.u2KeySize) + 1U, inputHash, hashLen, 
+            privKey, privKeyLen, outSig, sigLen) == CRYPTO_ECC_POOL_SUCCESS);
+    }
+    
+    (void) memset(k, 0, sizeof(k));
+    (void) memset(kG, 0, sizeof(kG));
+    
+    return signed_b;
+}
+
+/* HMAC of the RFC 6979 HMAC_DRBG on the SHA engine. The inner and outer 
+ * hashes run one after the other, the engine holds one hash at a time. */
+static bool lCrypto_DigSign_Ecdsa_Hw_Hmac(crypto_Hash_Algo_E hashAlgo_en, 
+    uint8_t *ptr_key, uint32_t keyLen, uint8_t **ptr_data, 
+    uint32_t *ptr_dataLen, uint32_t numData, uint8_t *ptr_mac)
+{
+    CRYPTO_HMAC_HW_CONTEXT hmacCtx;
+    crypto_Hash_Status_E hashStatus;
+    uint32_t i;
+    
+    hashStatus = Crypto_Hash_Hw_Sha_HmacInit(&hmacCtx, ptr_key, keyLen, 
+                                             hashAlgo_en);
+    for (i = 0U; (i < numData) && (hashStatus == CRYPTO_HASH_SUCCESS); i++)
+    {
+        hashStatus = Crypto_Hash_Hw_Sha_HmacUpdate(&hmacCtx, ptr_data[i], 
+                                                   ptr_dataLen[i]);
+    }
+    if (hashStatus == CRYPTO_HASH_SUCCESS)
+    {
+        hashStatus = Crypto_Hash_Hw_Sha_HmacFinal(&hmacCtx, ptr_mac);
+    }
+    
+    (void) memset(&hmacCtx, 0, sizeof(hmacCtx));
+    
+    return (hashStatus == CRYPTO_HASH_SUCCESS);
+}
+
+/* Order of the base point MSB first without leading zero bytes, from the 
+ * LSB operand of the curve parameters */
+static uint32_t lCrypto_DigSign_Ecdsa_Hw_GetOrder(CPKCL_ECC_DATA *eccData, 
+    uint8_t *order)
+{
+    uint32_t orderLen = (uint32_t)eccData->u2OrderSize;
+    uint32_t i;
+    
+    while ((orderLen > 0U) && (eccData->pfu1APointOrder[orderLen - 1U] == 0U))
+    {
+        orderLen--;
+    }
+    
+    if (orderLen > (uint32_t)CRYPTO_ECC_MAX_KEY_LENGTH)
+    {
+        orderLen = 0U;
+    }
+    
+    for (i = 0U; i < orderLen; i++)
+    {
+        order[i] = eccData->pfu1APointOrder[orderLen - 1U - i];
+    }
+    
+    return orderLen;
+}
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: DigSign Common Interface Implementation
@@ -151,6 +316,22 @@ crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_Sign(uint8_t *inputHash,
         return result;
     }
     
+    /* A nonce precomputed in idle time leaves only the modular arithmetic of
+     * s, the full signature runs when the pool is empty */
+    if (Crypto_Ecc_Pool_EcdsaSign(eccCurveType_En, inputHash, hashLen, 
+            privKey, privKeyLen, outSig, sigLen) == CRYPTO_ECC_POOL_SUCCESS)
+    {
+        return CRYPTO_DIGISIGN_SUCCESS;
+    }
+    
+    /* Otherwise the nonce is drawn now, k*G with the comb table of the curve 
+     * instead of the double-and-add of the CPKCL signature */
+    if (lCrypto_DigSign_Ecdsa_Hw_CombSign(inputHash, hashLen, outSig, sigLen, 
+            privKey, privKeyLen, eccCurveType_En, hwEccCurve))
+    {
+        return CRYPTO_DIGISIGN_SUCCESS;
+    }
+    
     /* Initialize the hardware library for ECDSA signature generation */
     hwResult = DRV_CRYPTO_ECDSA_InitEccParamsSign(&eccData, 
                                                   (pfu1)inputHash,
@@ -195,7 +376,10 @@ crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_Verify(uint8_t *inputHash,
                                                     hwEccCurve);
     
     /* Verify the signature */
-    hwResult = DRV_CRYPTO_ECDSA_Verify(&eccData, (pfu1)inputSig);
+    if (hwResult == CRYPTO_ECDSA_RESULT_SUCCESS) 
+    {
+        hwResult = DRV_CRYPTO_ECDSA_Verify(&eccData, (pfu1)inputSig);
+    }
     
     /* Set verification status */
     if (hwResult == CRYPTO_ECDSA_RESULT_SUCCESS) 
@@ -209,3 +393,240 @@ crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_Verify(uint8_t *inputHash,
 
     return lCrypto_DigSign_Ecdsa_Hw_MapResult(hwResult);
 }
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_SignData(uint8_t *inputData, 
+    uint32_t dataLen, uint8_t *outSig, uint32_t sigLen, uint8_t *privKey, 
+    uint32_t privKeyLen, crypto_Hash_Algo_E hashType, 
+    crypto_EccCurveType_E eccCurveType_En)
+{
+    crypto_DigiSign_Status_E result;
+    uint32_t digest[16];
+    uint32_t digestLen = 0;
+    
+    /* The digest goes from the SHA engine into CPKCC crypto RAM, the driver
+     * truncates it to the order size on the way */
+    result = lCrypto_DigSign_Ecdsa_Hw_Hash(inputData, dataLen, hashType, 
+                                           digest, &digestLen);
+    if (result == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        result = Crypto_DigiSign_Ecdsa_Hw_Sign((uint8_t *)digest, digestLen, 
+                    outSig, sigLen, privKey, privKeyLen, eccCurveType_En);
+    }
+    
+    (void) memset(digest, 0, sizeof(digest));
+    
+    return result;
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_VerifyData(uint8_t *inputData, 
+    uint32_t dataLen, uint8_t *inputSig, uint32_t sigLen, uint8_t *pubKey, 
+    uint32_t pubKeyLen, crypto_Hash_Algo_E hashType, int8_t *hashVerifyStatus, 
+    crypto_EccCurveType_E eccCurveType_En)
+{
+    crypto_DigiSign_Status_E result;
+    uint32_t digest[16];
+    uint32_t digestLen = 0;
+    
+    *hashVerifyStatus = 0;
+    
+    result = lCrypto_DigSign_Ecdsa_Hw_Hash(inputData, dataLen, hashType, 
+                                           digest, &digestLen);
+    if (result == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        result = Crypto_DigiSign_Ecdsa_Hw_Verify((uint8_t *)digest, digestLen, 
+                    inputSig, sigLen, pubKey, pubKeyLen, hashVerifyStatus, 
+                    eccCurveType_En);
+    }
+    
+    return result;
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecc_Hw_KeyGen(uint8_t *privKey, 
+    uint32_t privKeyLen, uint8_t *pubKey, uint32_t pubKeyLen, 
+    crypto_EccCurveType_E eccCurveType_En)
+{
+    crypto_DigiSign_Status_E result;
+    CRYPTO_CPKCL_RESULT hwResult;
+    CPKCL_ECC_DATA eccData;
+    CRYPTO_CPKCL_CURVE hwEccCurve;
+    
+    /* Get curve */
+    result = lCrypto_DigSign_Ecdsa_Hw_GetCurve(eccCurveType_En, &hwEccCurve);
+    if (result != CRYPTO_DIGISIGN_SUCCESS)
+    {
+        return result;
+    }
+    
+    /* Check the CPKCL is initialized and its self test passed */
+    if (DRV_CRYPTO_ECC_CheckCpkcl() != CRYPTO_CPKCL_RESULT_INIT_SUCCESS)
+    {
+        return CRYPTO_DIGISIGN_ERROR_FAIL;
+    }
+    
+    if (DRV_CRYPTO_ECC_InitCurveParams(&eccData, hwEccCurve) 
+            != CRYPTO_CPKCL_RESULT_CURVE_SUCCESS)
+    {
+        return CRYPTO_DIGISIGN_ERROR_CURVE;
+    }
+    
+    if (privKeyLen < (uint32_t)eccData.u2KeySize)
+    {
+        return CRYPTO_DIGISIGN_ERROR_PRIVKEYLEN;
+    }
+    
+    if (pubKeyLen < ((2U * (uint32_t)eccData.u2KeySize) + 1U))
+    {
+        return CRYPTO_DIGISIGN_ERROR_PUBKEYLEN;
+    }
+    
+    hwResult = DRV_CRYPTO_ECC_KeyGen(&eccData, (pfu1)privKey, (pfu1)pubKey);
+    
+    if (hwResult == CRYPTO_CPKCL_RESULT_KEYGEN_SUCCESS)
+    {
+        result = CRYPTO_DIGISIGN_SUCCESS;
+    }
+    else if (hwResult == CRYPTO_CPKCL_RESULT_KEYGEN_RNG_ERROR)
+    {
+        result = CRYPTO_DIGISIGN_ERROR_RNG;
+    }
+    else
+    {
+        result = CRYPTO_DIGISIGN_ERROR_FAIL;
+    }
+    
+    return result;
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_VerifyBatch(
+    st_Crypto_DigiSign_Ecdsa_VerifyItem *items, uint32_t numItems, 
+    uint32_t *verifyBitmap, crypto_EccCurveType_E eccCurveType_En)
+{
+    crypto_DigiSign_Status_E result;
+    CRYPTO_ECDSA_RESULT hwResult;
+    CRYPTO_CPKCL_CURVE hwEccCurve;
+    CPKCL_ECC_DATA eccData = {0};
+    uint8_t *decodedKey = NULL;
+    uint32_t i;
+    
+    /* Get curve */
+    result = lCrypto_DigSign_Ecdsa_Hw_GetCurve(eccCurveType_En, &hwEccCurve);
+    if (result != CRYPTO_DIGISIGN_SUCCESS)
+    {
+        return result;
+    }
+    
+    /* CPKCL check and curve setup once for the whole batch */
+    if (DRV_CRYPTO_ECC_CheckCpkcl() != CRYPTO_CPKCL_RESULT_INIT_SUCCESS)
+    {
+        return CRYPTO_DIGISIGN_ERROR_FAIL;
+    }
+    
+    if (DRV_CRYPTO_ECC_InitCurveParams(&eccData, hwEccCurve) 
+            != CRYPTO_CPKCL_RESULT_CURVE_SUCCESS)
+    {
+        return CRYPTO_DIGISIGN_ERROR_CURVE;
+    }
+    
+    for (i = 0; i < numItems; i++)
+    {
+        hwResult = CRYPTO_ECDSA_RESULT_SUCCESS;
+        
+        /* A chain of signatures from one signer decodes the key once */
+        if (items[i].ptr_pubKey != decodedKey)
+        {
+            hwResult = DRV_CRYPTO_ECDSA_SetVerifyKey(&eccData, 
+                                                     (pfu1)items[i].ptr_pubKey);
+            decodedKey = (hwResult == CRYPTO_ECDSA_RESULT_SUCCESS) ? 
+                             items[i].ptr_pubKey : NULL;
+        }
+        
+        if ((hwResult == CRYPTO_ECDSA_RESULT_SUCCESS) && 
+            (items[i].sigLen >= (2U * (uint32_t)eccData.u2KeySize)))
+        {
+            hwResult = DRV_CRYPTO_ECDSA_VerifyHash(&eccData, 
+                                                   (pfu1)items[i].ptr_inputHash,
+                                                   (u4)items[i].hashLen, 
+                                                   (pfu1)items[i].ptr_inputSig);
+            
+            if (hwResult == CRYPTO_ECDSA_RESULT_SUCCESS)
+            {
+                *verifyBitmap |= ((uint32_t)1U << i);
+            }
+        }
+    }
+    
+    return CRYPTO_DIGISIGN_SUCCESS;
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Ecdsa_Hw_SignDeterministic(
+    uint8_t *inputHash, uint32_t hashLen, uint8_t *outSig, uint32_t sigLen, 
+    uint8_t *privKey, uint32_t privKeyLen, crypto_Hash_Algo_E hashType, 
+    crypto_EccCurveType_E eccCurveType_En)
+{
+    crypto_DigiSign_Status_E result;
+    crypto_Rfc6979_Status_E nonceResult;
+    CRYPTO_ECDSA_RESULT hwResult;
+    CPKCL_ECC_DATA eccData;
+    CRYPTO_CPKCL_CURVE hwEccCurve;
+    uint8_t order[CRYPTO_ECC_MAX_KEY_LENGTH];
+    uint8_t k[CRYPTO_ECC_MAX_KEY_LENGTH];
+    uint32_t orderLen;
+    
+    /* Get curve */
+    result = lCrypto_DigSign_Ecdsa_Hw_GetCurve(eccCurveType_En, &hwEccCurve);
+    if (result != CRYPTO_DIGISIGN_SUCCESS)
+    {
+        return result;
+    }
+    
+    /* The pool and the comb table draw their nonce, the signature always 
+     * runs on the CPKCL with k given */
+    hwResult = DRV_CRYPTO_ECDSA_InitEccParamsSign(&eccData, 
+                                                  (pfu1)inputHash,
+                                                  (u4) hashLen, 
+                                                  (pfu1)privKey, 
+                                                  (u4) privKeyLen, 
+                                                  hwEccCurve);
+    if (hwResult != CRYPTO_ECDSA_RESULT_SUCCESS) 
+    {
+        return lCrypto_DigSign_Ecdsa_Hw_MapResult(hwResult);
+    }
+    
+    if (DRV_CRYPTO_ECC_IsBinaryCurve(eccData.curveType))
+    {
+        return CRYPTO_DIGISIGN_ERROR_CURVE;
+    }
+    
+    orderLen = lCrypto_DigSign_Ecdsa_Hw_GetOrder(&eccData, order);
+    if (orderLen == 0U)
+    {
+        return CRYPTO_DIGISIGN_ERROR_CURVE;
+    }
+    
+    nonceResult = Crypto_Rfc6979_GenerateK(lCrypto_DigSign_Ecdsa_Hw_Hmac, 
+                    hashType, order, orderLen, privKey, privKeyLen, inputHash, 
+                    hashLen, k);
+    
+    if (nonceResult == CRYPTO_RFC6979_SUCCESS)
+    {
+        hwResult = DRV_CRYPTO_ECDSA_SignWithNonce(&eccData, (pfu1)k, 
+                        (u4)orderLen, (pfu1)outSig, (u4)sigLen);
+        result = lCrypto_DigSign_Ecdsa_Hw_MapResult(hwResult);
+    }
+    else if (nonceResult == CRYPTO_RFC6979_ERROR_ARG)
+    {
+        result = CRYPTO_DIGISIGN_ERROR_PRIVKEYLEN;
+    }
+    else if (nonceResult == CRYPTO_RFC6979_ERROR_HASHTYPE)
+    {
+        result = CRYPTO_DIGISIGN_ERROR_HASHTYPE;
+    }
+    else
+    {
+        result = CRYPTO_DIGISIGN_ERROR_FAIL;
+    }
+    
+    (void) memset(k, 0, sizeof(k));
+    
+    return result;
+}
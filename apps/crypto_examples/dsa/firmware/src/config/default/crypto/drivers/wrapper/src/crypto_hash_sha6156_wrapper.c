@@ -61,6 +61,9 @@ Microchip or any third party.
 #define HASH_SHORT_PAD_SIZE_BYTES     (56U)
 #define HASH_LONG_PAD_SIZE_BYTES      (112U)
 
+#define HMAC_IPAD_BYTE                (0x36U)
+#define HMAC_OPAD_BYTE                (0x5CU)
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: File scope data
@@ -93,6 +96,14 @@ static crypto_Hash_Status_E lCrypto_Hash_Hw_Sha_GetAlgorithm
             *shaAlgo = CRYPTO_SHA_ALGO_SHA256;
             ret_status = CRYPTO_HASH_SUCCESS;
             break;
+        case CRYPTO_HASH_SHA2_384:
+            *shaAlgo = CRYPTO_SHA_ALGO_SHA384;
+            ret_status = CRYPTO_HASH_SUCCESS;
+            break;
+        case CRYPTO_HASH_SHA2_512:
+            *shaAlgo = CRYPTO_SHA_ALGO_SHA512;
+            ret_status = CRYPTO_HASH_SUCCESS;
+            break;
         default:
             ret_status = CRYPTO_HASH_ERROR_ALGO;
             break;
@@ -251,7 +262,8 @@ crypto_Hash_Status_E Crypto_Hash_Hw_Sha_Update(void *shaUpdateCtx,
     fill = blockSizeBytes - left;
     shaCtx->totalLen += dataLen;
 
-    if ((left & dataLen) >= fill)
+    /* Complete the block left over by the previous update */
+    if ((left != 0U) && (dataLen >= fill))
     {
         (void) memcpy((shaCtx->buffer + left), data, fill);
         
@@ -266,18 +278,15 @@ crypto_Hash_Status_E Crypto_Hash_Hw_Sha_Update(void *shaUpdateCtx,
 #pragma GCC diagnostic pop
         /* MISRA C-2012 deviation block end */
 
-        for (uint32_t x = 0; x < dataLen; x += blockSizeBytes)
-        {
-            DRV_CRYPTO_SHA_Update(localBuffer, blockSizeWords);
-            localBuffer += (uint32_t)blockSizeWords;
-        }
+        DRV_CRYPTO_SHA_Update(localBuffer, blockSizeWords);
         
         data += fill;
         dataLen -= fill;
         left = 0;
     }
 
-    if (dataLen >= blockSizeBytes)
+    /* Hash the whole blocks straight from the caller buffer */
+    while (dataLen >= blockSizeBytes)
     {
         /* MISRA C-2012 deviation block start */
         /* MISRA C-2012 Rule 11.3 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_3_DR_1 */
@@ -392,3 +401,122 @@ crypto_Hash_Status_E Crypto_Hash_Hw_Sha_Digest(uint8_t *data, uint32_t dataLen,
     }    
     return Crypto_Hash_Hw_Sha_Final(&shaCtx, digest);
 }
+
+crypto_Hash_Status_E Crypto_Hash_Hw_Sha_HmacInit(void *hmacInitCtx, 
+    uint8_t *key, uint32_t keyLen, crypto_Hash_Algo_E shaAlgorithm_en)
+{
+    crypto_Hash_Status_E result;
+    CRYPTO_HMAC_HW_CONTEXT *hmacCtx = (CRYPTO_HMAC_HW_CONTEXT*)hmacInitCtx;
+    uint32_t innerKey[32];
+    uint32_t blockSizeBytes;
+    uint32_t i;
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 11.3 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_3_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.3" "H3_MISRAC_2012_R_11_3_DR_1"
+    uint8_t *ptr_innerKey = (uint8_t*)innerKey;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.3"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    
+    result = Crypto_Hash_Hw_Sha_Init(&hmacCtx->shaCtx, shaAlgorithm_en);
+    if (result != CRYPTO_HASH_SUCCESS)
+    {
+        return result;
+    }
+    
+    blockSizeBytes = lCrypto_Hash_Hw_Sha_GetBlockSizeBytes(shaAlgorithm_en);
+    (void) memset(innerKey, 0, sizeof(innerKey));
+    
+    /* A key longer than a block is replaced by its digest */
+    if (keyLen > blockSizeBytes)
+    {
+        result = Crypto_Hash_Hw_Sha_Update(&hmacCtx->shaCtx, key, keyLen);
+        if (result == CRYPTO_HASH_SUCCESS)
+        {
+            result = Crypto_Hash_Hw_Sha_Final(&hmacCtx->shaCtx, ptr_innerKey);
+        }
+        if (result == CRYPTO_HASH_SUCCESS)
+        {
+            result = Crypto_Hash_Hw_Sha_Init(&hmacCtx->shaCtx, 
+                                             shaAlgorithm_en);
+        }
+    }
+    else
+    {
+        (void) memcpy(ptr_innerKey, key, keyLen);
+    }
+    
+    if (result == CRYPTO_HASH_SUCCESS)
+    {
+        for (i = 0U; i < blockSizeBytes; i++)
+        {
+            hmacCtx->outerKey[i] = ptr_innerKey[i] ^ HMAC_OPAD_BYTE;
+            ptr_innerKey[i] ^= HMAC_IPAD_BYTE;
+        }
+        result = Crypto_Hash_Hw_Sha_Update(&hmacCtx->shaCtx, ptr_innerKey, 
+                                           blockSizeBytes);
+    }
+    
+    (void) memset(innerKey, 0, sizeof(innerKey));
+    
+    return result;
+}
+
+crypto_Hash_Status_E Crypto_Hash_Hw_Sha_HmacUpdate(void *hmacUpdateCtx, 
+    uint8_t *data, uint32_t dataLen)
+{
+    CRYPTO_HMAC_HW_CONTEXT *hmacCtx = (CRYPTO_HMAC_HW_CONTEXT*)hmacUpdateCtx;
+    
+    return Crypto_Hash_Hw_Sha_Update(&hmacCtx->shaCtx, data, dataLen);
+}
+
+crypto_Hash_Status_E Crypto_Hash_Hw_Sha_HmacFinal(void *hmacFinalCtx, 
+    uint8_t *mac)
+{
+    crypto_Hash_Status_E result;
+    CRYPTO_HMAC_HW_CONTEXT *hmacCtx = (CRYPTO_HMAC_HW_CONTEXT*)hmacFinalCtx;
+    crypto_Hash_Algo_E shaAlgorithm_en = hmacCtx->shaCtx.algo;
+    uint32_t innerDigest[16];
+    uint32_t digestLen;
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 11.3 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_3_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.3" "H3_MISRAC_2012_R_11_3_DR_1"
+    uint8_t *ptr_innerDigest = (uint8_t*)innerDigest;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.3"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    
+    digestLen = ((uint32_t)lCrypto_Hash_Hw_Sha_GetDigestLen(shaAlgorithm_en)) 
+        << 2UL;
+    
+    /* H((K ^ opad) || H((K ^ ipad) || data)) */
+    result = Crypto_Hash_Hw_Sha_Final(&hmacCtx->shaCtx, ptr_innerDigest);
+    if (result == CRYPTO_HASH_SUCCESS)
+    {
+        result = Crypto_Hash_Hw_Sha_Init(&hmacCtx->shaCtx, shaAlgorithm_en);
+    }
+    if (result == CRYPTO_HASH_SUCCESS)
+    {
+        result = Crypto_Hash_Hw_Sha_Update(&hmacCtx->shaCtx, 
+            hmacCtx->outerKey, 
+            lCrypto_Hash_Hw_Sha_GetBlockSizeBytes(shaAlgorithm_en));
+    }
+    if (result == CRYPTO_HASH_SUCCESS)
+    {
+        result = Crypto_Hash_Hw_Sha_Update(&hmacCtx->shaCtx, ptr_innerDigest, 
+                                           digestLen);
+    }
+    if (result == CRYPTO_HASH_SUCCESS)
+    {
+        result = Crypto_Hash_Hw_Sha_Final(&hmacCtx->shaCtx, mac);
+    }
+    
+    (void) memset(innerDigest, 0, sizeof(innerDigest));
+    (void) memset(hmacCtx->outerKey, 0, sizeof(hmacCtx->outerKey));
+    
+    return result;
+}
@@ -0,0 +1,697 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_rsa_cpkcc44163_wrapper.c
+
+  Summary:
+    Crypto Framework Library wrapper file for RSA in the hardware 
+    cryptographic library.
+
+  Description:
+    This source file contains the wrapper interface to access the hardware 
+    cryptographic library in Microchip microcontrollers for RSA. The PKCS#1
+    encodings run here, the modular exponentiations on the CPKCC.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2024, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include <string.h>
+#include "crypto/drivers/wrapper/crypto_rsa_cpkcc44163_wrapper.h"
+#include "crypto/drivers/wrapper/crypto_hash_sha6156_wrapper.h"
+#include "crypto/drivers/driver/drv_crypto_rsa_hw_cpkcl.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Variables
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_RSA_HW_MAX_HASH_SIZE     (64U)
+#define CRYPTO_RSA_HW_DIGESTINFO_SIZE   (19U)
+
+/* DER DigestInfo ahead of the hash in EMSA-PKCS1-v1_5, RFC 8017 9.2 */
+static const uint8_t digestInfoSha256[CRYPTO_RSA_HW_DIGESTINFO_SIZE] = {
+    0x30, 0x31, 0x30, 0x0d, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 
+    0x65, 0x03, 0x04, 0x02, 0x01, 0x05, 0x00, 0x04, 0x20};
+static const uint8_t digestInfoSha384[CRYPTO_RSA_HW_DIGESTINFO_SIZE] = {
+    0x30, 0x41, 0x30, 0x0d, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 
+    0x65, 0x03, 0x04, 0x02, 0x02, 0x05, 0x00, 0x04, 0x30};
+static const uint8_t digestInfoSha512[CRYPTO_RSA_HW_DIGESTINFO_SIZE] = {
+    0x30, 0x51, 0x30, 0x0d, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01, 
+    0x65, 0x03, 0x04, 0x02, 0x03, 0x05, 0x00, 0x04, 0x40};
+
+static const uint8_t pssZeros[8] = {0};
+
+/* Encoded message, and the expected one for a PKCS#1 v1.5 verification */
+static uint8_t rsaEm[CRYPTO_RSA_HW_MAX_MODULUS_SIZE];
+static uint8_t rsaEmCheck[CRYPTO_RSA_HW_MAX_MODULUS_SIZE];
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static uint32_t lCrypto_Rsa_Hw_HashSize(crypto_Hash_Algo_E hashType)
+{
+    uint32_t hashSize;
+    
+    switch (hashType)
+    {
+        case CRYPTO_HASH_SHA2_256:
+            hashSize = 32U;
+            break;
+            
+        case CRYPTO_HASH_SHA2_384:
+            hashSize = 48U;
+            break;
+            
+        case CRYPTO_HASH_SHA2_512:
+            hashSize = 64U;
+            break;
+            
+        default:
+            hashSize = 0U;
+            break;
+    }
+    
+    return hashSize;
+}
+
+static crypto_Rsa_Status_E lCrypto_Rsa_Hw_MapResult(CRYPTO_RSA_RESULT result)
+{
+    crypto_Rsa_Status_E rsaStatus;
+    
+    switch (result) 
+    {
+        case CRYPTO_RSA_RESULT_SUCCESS:
+            rsaStatus = CRYPTO_RSA_SUCCESS;
+            break;
+            
+        case CRYPTO_RSA_RESULT_ERROR_KEY:
+            rsaStatus = CRYPTO_RSA_ERROR_KEYLEN;
+            break;
+            
+        case CRYPTO_RSA_RESULT_ERROR_RNG:   
+            rsaStatus = CRYPTO_RSA_ERROR_RNG;
+            break;
+        
+        case CRYPTO_RSA_RESULT_ERROR_INPUT:
+        case CRYPTO_RSA_RESULT_INIT_FAIL:
+        case CRYPTO_RSA_RESULT_ERROR_FAIL:
+            rsaStatus = CRYPTO_RSA_ERROR_FAIL;
+            break;
+            
+        default:
+            rsaStatus = CRYPTO_RSA_ERROR_FAIL;
+            break;
+    }
+    
+    return rsaStatus;
+}
+
+static void lCrypto_Rsa_Hw_CrtKey(st_Crypto_Rsa_PrivKey *privKey, 
+    CPKCL_RSA_CRT_KEY *crtKey)
+{
+    crtKey->pfu1N = privKey->ptr_n;
+    crtKey->pfu1E = privKey->ptr_e;
+    crtKey->u2ELength = (u2) privKey->eLen;
+    crtKey->pfu1P = privKey->ptr_p;
+    crtKey->pfu1Q = privKey->ptr_q;
+    crtKey->pfu1DP = privKey->ptr_dP;
+    crtKey->pfu1DQ = privKey->ptr_dQ;
+    crtKey->pfu1QInv = privKey->ptr_qInv;
+    crtKey->u2PrimeLength = (u2) (privKey->modulusLen / 2U);
+}
+
+/* Size in bits of the modulus */
+static uint32_t lCrypto_Rsa_Hw_ModBits(uint8_t *n, uint32_t modulusLen)
+{
+    uint32_t modBits = modulusLen * 8U;
+    uint8_t topByte = n[0];
+    
+    while ((topByte != 0U) && ((topByte & 0x80U) == 0U))
+    {
+        topByte <<= 1U;
+        modBits--;
+    }
+    
+    return modBits;
+}
+
+/* Hash of up to three parts on the SHA engine, an empty part is skipped */
+static crypto_Rsa_Status_E lCrypto_Rsa_Hw_Hash(crypto_Hash_Algo_E hashType, 
+    const uint8_t *part1, uint32_t part1Len, const uint8_t *part2, 
+    uint32_t part2Len, const uint8_t *part3, uint32_t part3Len, 
+    uint8_t *digest)
+{
+    CRYPTO_HASH_HW_CONTEXT shaCtx;
+    crypto_Hash_Status_E result;
+    
+    result = Crypto_Hash_Hw_Sha_Init(&shaCtx, hashType);
+    if ((result == CRYPTO_HASH_SUCCESS) && (part1Len != 0U))
+    {
+        result = Crypto_Hash_Hw_Sha_Update(&shaCtx, (uint8_t *)part1, 
+            part1Len);
+    }
+    if ((result == CRYPTO_HASH_SUCCESS) && (part2Len != 0U))
+    {
+        result = Crypto_Hash_Hw_Sha_Update(&shaCtx, (uint8_t *)part2, 
+            part2Len);
+    }
+    if ((result == CRYPTO_HASH_SUCCESS) && (part3Len != 0U))
+    {
+        result = Crypto_Hash_Hw_Sha_Update(&shaCtx, (uint8_t *)part3, 
+            part3Len);
+    }
+    if (result == CRYPTO_HASH_SUCCESS)
+    {
+        result = Crypto_Hash_Hw_Sha_Final(&shaCtx, digest);
+    }
+    
+    return (result == CRYPTO_HASH_SUCCESS) ? CRYPTO_RSA_SUCCESS : 
+        CRYPTO_RSA_ERROR_FAIL;
+}
+
+/* out ^= MGF1(seed, outLen), RFC 8017 B.2.1 */
+static crypto_Rsa_Status_E lCrypto_Rsa_Hw_Mgf1Xor(crypto_Hash_Algo_E hashType,
+    const uint8_t *seed, uint32_t seedLen, uint8_t *out, uint32_t outLen)
+{
+    uint8_t mask[CRYPTO_RSA_HW_MAX_HASH_SIZE];
+    uint8_t counter[4] = {0};
+    uint32_t hashSize = lCrypto_Rsa_Hw_HashSize(hashType);
+    uint32_t done = 0U;
+    uint32_t blockCount = 0U;
+    uint32_t i;
+    
+    while (done < outLen)
+    {
+        counter[0] = (uint8_t) (blockCount >> 24U);
+        counter[1] = (uint8_t) (blockCount >> 16U);
+        counter[2] = (uint8_t) (blockCount >> 8U);
+        counter[3] = (uint8_t) blockCount;
+        
+        if (lCrypto_Rsa_Hw_Hash(hashType, seed, seedLen, counter, 4U, 
+                NULL, 0U, mask) != CRYPTO_RSA_SUCCESS)
+        {
+            return CRYPTO_RSA_ERROR_FAIL;
+        }
+        
+        for (i = 0U; (i < hashSize) && (done < outLen); i++)
+        {
+            out[done] ^= mask[i];
+            done++;
+        }
+        blockCount++;
+    }
+    
+    return CRYPTO_RSA_SUCCESS;
+}
+
+/* EMSA-PKCS1-v1_5: 00 01 FF..FF 00 || DigestInfo || H on emLen bytes */
+static crypto_Rsa_Status_E lCrypto_Rsa_Hw_Pkcs1v15Encode(uint8_t *inputHash,
+    uint32_t hashLen, crypto_Hash_Algo_E hashType, uint8_t *em, 
+    uint32_t emLen)
+{
+    const uint8_t *digestInfo;
+    uint32_t tLen = CRYPTO_RSA_HW_DIGESTINFO_SIZE + hashLen;
+    
+    switch (hashType)
+    {
+        case CRYPTO_HASH_SHA2_256:
+            digestInfo = digestInfoSha256;
+            break;
+            
+        case CRYPTO_HASH_SHA2_384:
+            digestInfo = digestInfoSha384;
+            break;
+            
+        case CRYPTO_HASH_SHA2_512:
+            digestInfo = digestInfoSha512;
+            break;
+            
+        default:
+            digestInfo = NULL;
+            break;
+    }
+    
+    if ((digestInfo == NULL) || (hashLen != lCrypto_Rsa_Hw_HashSize(hashType)))
+    {
+        return CRYPTO_RSA_ERROR_HASHTYPE;
+    }
+    
+    /* At least 8 bytes of 0xFF padding */
+    if (emLen < (tLen + 11U))
+    {
+        return CRYPTO_RSA_ERROR_KEYLEN;
+    }
+    
+    em[0] = 0x00U;
+    em[1] = 0x01U;
+    (void) memset(&em[2], 0xFF, emLen - tLen - 3U);
+    em[emLen - tLen - 1U] = 0x00U;
+    (void) memcpy(&em[emLen - tLen], digestInfo, 
+        CRYPTO_RSA_HW_DIGESTINFO_SIZE);
+    (void) memcpy(&em[emLen - hashLen], inputHash, hashLen);
+    
+    return CRYPTO_RSA_SUCCESS;
+}
+
+/* EMSA-PSS encoding, RFC 8017 9.1.1. em is on the modulus length, with a 
+   leading zero byte when emBits is a multiple of 8. */
+static crypto_Rsa_Status_E lCrypto_Rsa_Hw_PssEncode(uint8_t *inputHash, 
+    uint32_t hashLen, crypto_Hash_Algo_E hashType, uint32_t saltLen, 
+    uint8_t *em, uint32_t modulusLen, uint32_t emBits)
+{
+    crypto_Rsa_Status_E result;
+    uint32_t emLen = (emBits + 7U) / 8U;
+    uint32_t dbLen;
+    uint8_t *pEm = &em[modulusLen - emLen];
+    uint8_t *salt;
+    
+    if (emLen < (hashLen + saltLen + 2U))
+    {
+        return CRYPTO_RSA_ERROR_KEYLEN;
+    }
+    dbLen = emLen - hashLen - 1U;
+    
+    /* DB = PS || 0x01 || salt, the salt goes in place */
+    (void) memset(em, 0, modulusLen);
+    pEm[dbLen - saltLen - 1U] = 0x01U;
+    salt = &pEm[dbLen - saltLen];
+    if (saltLen != 0U)
+    {
+        if (DRV_CRYPTO_RSA_Random(salt, (u2) saltLen) != 
+                CRYPTO_RSA_RESULT_SUCCESS)
+        {
+            return CRYPTO_RSA_ERROR_RNG;
+        }
+    }
+    
+    /* H = Hash(0x00 * 8 || mHash || salt) */
+    result = lCrypto_Rsa_Hw_Hash(hashType, pssZeros, sizeof(pssZeros), 
+        inputHash, hashLen, salt, saltLen, &pEm[dbLen]);
+    if (result != CRYPTO_RSA_SUCCESS)
+    {
+        return result;
+    }
+    pEm[emLen - 1U] = 0xBCU;
+    
+    result = lCrypto_Rsa_Hw_Mgf1Xor(hashType, &pEm[dbLen], hashLen, pEm, 
+        dbLen);
+    
+    /* Clear the bits above emBits */
+    pEm[0] &= (uint8_t) (0xFFU >> ((8U * emLen) - emBits));
+    
+    return result;
+}
+
+/* EMSA-PSS verification, RFC 8017 9.1.2. em is modified. */
+static bool lCrypto_Rsa_Hw_PssCheck(uint8_t *inputHash, uint32_t hashLen,
+    crypto_Hash_Algo_E hashType, uint32_t saltLen, uint8_t *em, 
+    uint32_t modulusLen, uint32_t emBits)
+{
+    uint8_t hashCheck[CRYPTO_RSA_HW_MAX_HASH_SIZE];
+    uint32_t emLen = (emBits + 7U) / 8U;
+    uint32_t dbLen;
+    uint8_t *pEm = &em[modulusLen - emLen];
+    uint8_t topMask = (uint8_t) (0xFFU >> ((8U * emLen) - emBits));
+    uint32_t i;
+    
+    if ((emLen < (hashLen + saltLen + 2U)) || (pEm[emLen - 1U] != 0xBCU) ||
+        ((pEm[0] & (uint8_t)~topMask) != 0U) || 
+        ((modulusLen != emLen) && (em[0] != 0U)))
+    {
+        return false;
+    }
+    dbLen = emLen - hashLen - 1U;
+    
+    if (lCrypto_Rsa_Hw_Mgf1Xor(hashType, &pEm[dbLen], hashLen, pEm, dbLen) 
+            != CRYPTO_RSA_SUCCESS)
+    {
+        return false;
+    }
+    pEm[0] &= topMask;
+    
+    /* DB = PS || 0x01 || salt */
+    for (i = 0U; i < (dbLen - saltLen - 1U); i++)
+    {
+        if (pEm[i] != 0U)
+        {
+            return false;
+        }
+    }
+    if (pEm[dbLen - saltLen - 1U] != 0x01U)
+    {
+        return false;
+    }
+    
+    if (lCrypto_Rsa_Hw_Hash(hashType, pssZeros, sizeof(pssZeros), inputHash,
+            hashLen, &pEm[dbLen - saltLen], saltLen, hashCheck) 
+            != CRYPTO_RSA_SUCCESS)
+    {
+        return false;
+    }
+    
+    return (memcmp(hashCheck, &pEm[dbLen], hashLen) == 0);
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: RSA Common Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Rsa_Status_E Crypto_Rsa_Hw_Pkcs1v15_Sign(uint8_t *inputHash, 
+    uint32_t hashLen, crypto_Hash_Algo_E hashType, uint8_t *outSig, 
+    uint32_t sigLen, st_Crypto_Rsa_PrivKey *privKey)
+{
+    crypto_Rsa_Status_E result;
+    CPKCL_RSA_CRT_KEY crtKey;
+    uint32_t modulusLen = privKey->modulusLen;
+    
+    if ((modulusLen > CRYPTO_RSA_HW_MAX_MODULUS_SIZE) || (sigLen < modulusLen))
+    {
+        return CRYPTO_RSA_ERROR_KEYLEN;
+    }
+    
+    result = lCrypto_Rsa_Hw_Pkcs1v15Encode(inputHash, hashLen, hashType, 
+        rsaEm, modulusLen);
+    if (result != CRYPTO_RSA_SUCCESS)
+    {
+        return result;
+    }
+    
+    lCrypto_Rsa_Hw_CrtKey(privKey, &crtKey);
+    
+    return lCrypto_Rsa_Hw_MapResult(DRV_CRYPTO_RSA_PrivateCrt(&crtKey, 
+        rsaEm, outSig));
+}
+
+crypto_Rsa_Status_E Crypto_Rsa_Hw_Pkcs1v15_Verify(uint8_t *inputHash, 
+    uint32_t hashLen, crypto_Hash_Algo_E hashType, uint8_t *inputSig, 
+    uint32_t sigLen, st_Crypto_Rsa_PubKey *pubKey, int8_t *hashVerifyStatus)
+{
+    crypto_Rsa_Status_E result;
+    CRYPTO_RSA_RESULT hwResult;
+    uint32_t modulusLen = pubKey->modulusLen;
+    
+    *hashVerifyStatus = 0;
+    
+    if ((modulusLen > CRYPTO_RSA_HW_MAX_MODULUS_SIZE) || (sigLen != modulusLen))
+    {
+        return CRYPTO_RSA_ERROR_KEYLEN;
+    }
+    
+    hwResult = DRV_CRYPTO_RSA_Public(pubKey->ptr_n, (u2) modulusLen, 
+        pubKey->ptr_e, (u2) pubKey->eLen, inputSig, rsaEm);
+    
+    /* A signature out of range is not valid */
+    if (hwResult == CRYPTO_RSA_RESULT_ERROR_INPUT)
+    {
+        return CRYPTO_RSA_SUCCESS;
+    }
+    if (hwResult != CRYPTO_RSA_RESULT_SUCCESS)
+    {
+        return lCrypto_Rsa_Hw_MapResult(hwResult);
+    }
+    
+    /* Encode the expected message and compare, rather than parse the 
+       recovered one, RFC 8017 8.2.2 */
+    result = lCrypto_Rsa_Hw_Pkcs1v15Encode(inputHash, hashLen, hashType, 
+        rsaEmCheck, modulusLen);
+    if (result != CRYPTO_RSA_SUCCESS)
+    {
+        return result;
+    }
+    
+    if (memcmp(rsaEm, rsaEmCheck, modulusLen) == 0)
+    {
+        *hashVerifyStatus = 1;
+    }
+    
+    return CRYPTO_RSA_SUCCESS;
+}
+
+crypto_Rsa_Status_E Crypto_Rsa_Hw_Pss_Sign(uint8_t *inputHash, 
+    uint32_t hashLen, crypto_Hash_Algo_E hashType, uint32_t saltLen, 
+    uint8_t *outSig, uint32_t sigLen, st_Crypto_Rsa_PrivKey *privKey)
+{
+    crypto_Rsa_Status_E result;
+    CPKCL_RSA_CRT_KEY crtKey;
+    uint32_t modulusLen = privKey->modulusLen;
+    
+    if ((modulusLen > CRYPTO_RSA_HW_MAX_MODULUS_SIZE) || (sigLen < modulusLen))
+    {
+        return CRYPTO_RSA_ERROR_KEYLEN;
+    }
+    
+    if (lCrypto_Rsa_Hw_HashSize(hashType) != hashLen)
+    {
+        return CRYPTO_RSA_ERROR_HASHTYPE;
+    }
+    
+    result = lCrypto_Rsa_Hw_PssEncode(inputHash, hashLen, hashType, saltLen,
+        rsaEm, modulusLen, 
+        lCrypto_Rsa_Hw_ModBits(privKey->ptr_n, modulusLen) - 1U);
+    if (result != CRYPTO_RSA_SUCCESS)
+    {
+        return result;
+    }
+    
+    lCrypto_Rsa_Hw_CrtKey(privKey, &crtKey);
+    
+    return lCrypto_Rsa_Hw_MapResult(DRV_CRYPTO_RSA_PrivateCrt(&crtKey, 
+        rsaEm, outSig));
+}
+
+crypto_Rsa_Status_E Crypto_Rsa_Hw_Pss_Verify(uint8_t *inputHash, 
+    uint32_t hashLen, crypto_Hash_Algo_E hashType, uint32_t saltLen, 
+    uint8_t *inputSig, uint32_t sigLen, st_Crypto_Rsa_PubKey *pubKey, 
+    int8_t *hashVerifyStatus)
+{
+    CRYPTO_RSA_RESULT hwResult;
+    uint32_t modulusLen = pubKey->modulusLen;
+    
+    *hashVerifyStatus = 0;
+    
+    if ((modulusLen > CRYPTO_RSA_HW_MAX_MODULUS_SIZE) || (sigLen != modulusLen))
+    {
+        return CRYPTO_RSA_ERROR_KEYLEN;
+    }
+    
+    if (lCrypto_Rsa_Hw_HashSize(hashType) != hashLen)
+    {
+        return CRYPTO_RSA_ERROR_HASHTYPE;
+    }
+    
+    hwResult = DRV_CRYPTO_RSA_Public(pubKey->ptr_n, (u2) modulusLen, 
+        pubKey->ptr_e, (u2) pubKey->eLen, inputSig, rsaEm);
+    
+    /* A signature out of range is not valid */
+    if (hwResult == CRYPTO_RSA_RESULT_ERROR_INPUT)
+    {
+        return CRYPTO_RSA_SUCCESS;
+    }
+    if (hwResult != CRYPTO_RSA_RESULT_SUCCESS)
+    {
+        return lCrypto_Rsa_Hw_MapResult(hwResult);
+    }
+    
+    if (lCrypto_Rsa_Hw_PssCheck(inputHash, hashLen, hashType, saltLen, rsaEm,
+            modulusLen, lCrypto_Rsa_Hw_ModBits(pubKey->ptr_n, modulusLen) - 1U))
+    {
+        *hashVerifyStatus = 1;
+    }
+    
+    return CRYPTO_RSA_SUCCESS;
+}
+
+crypto_Rsa_Status_E Crypto_Rsa_Hw_Oaep_Encrypt(uint8_t *inputData, 
+    uint32_t dataLen, crypto_Hash_Algo_E hashType, uint8_t *label, 
+    uint32_t labelLen, uint8_t *outData, uint32_t outDataLen, 
+    st_Crypto_Rsa_PubKey *pubKey)
+{
+    crypto_Rsa_Status_E result;
+    uint32_t modulusLen = pubKey->modulusLen;
+    uint32_t hashSize = lCrypto_Rsa_Hw_HashSize(hashType);
+    uint32_t dbLen = modulusLen - hashSize - 1U;
+    uint8_t *seed = &rsaEm[1];
+    uint8_t *db = &rsaEm[1U + hashSize];
+    
+    if ((modulusLen > CRYPTO_RSA_HW_MAX_MODULUS_SIZE) || 
+        (outDataLen < modulusLen) || (hashSize == 0U))
+    {
+        return CRYPTO_RSA_ERROR_KEYLEN;
+    }
+    if ((dataLen + (2U * hashSize) + 2U) > modulusLen)
+    {
+        return CRYPTO_RSA_ERROR_INPUTDATA;
+    }
+    
+    /* EM = 0x00 || seed || DB, DB = lHash || PS || 0x01 || M */
+    (void) memset(rsaEm, 0, modulusLen);
+    result = lCrypto_Rsa_Hw_Hash(hashType, label, labelLen, NULL, 0U, NULL, 
+        0U, db);
+    if (result != CRYPTO_RSA_SUCCESS)
+    {
+        return result;
+    }
+    db[dbLen - dataLen - 1U] = 0x01U;
+    if (dataLen != 0U)
+    {
+        (void) memcpy(&db[dbLen - dataLen], inputData, dataLen);
+    }
+    
+    if (DRV_CRYPTO_RSA_Random(seed, (u2) hashSize) != 
+            CRYPTO_RSA_RESULT_SUCCESS)
+    {
+        return CRYPTO_RSA_ERROR_RNG;
+    }
+    
+    result = lCrypto_Rsa_Hw_Mgf1Xor(hashType, seed, hashSize, db, dbLen);
+    if (result == CRYPTO_RSA_SUCCESS)
+    {
+        result = lCrypto_Rsa_Hw_Mgf1Xor(hashType, db, dbLen, seed, hashSize);
+    }
+    if (result == CRYPTO_RSA_SUCCESS)
+    {
+        result = lCrypto_Rsa_Hw_MapResult(DRV_CRYPTO_RSA_Public(pubKey->ptr_n,
+            (u2) modulusLen, pubKey->ptr_e, (u2) pubKey->eLen, rsaEm, 
+            outData));
+    }
+    
+    (void) memset(rsaEm, 0, sizeof(rsaEm));
+    
+    return result;
+}
+
+crypto_Rsa_Status_E Crypto_Rsa_Hw_Oaep_Decrypt(uint8_t *inputData, 
+    uint32_t dataLen, crypto_Hash_Algo_E hashType, uint8_t *label, 
+    uint32_t labelLen, uint8_t *outData, uint32_t outDataLen, 
+    uint32_t *msgLen, st_Crypto_Rsa_PrivKey *privKey)
+{
+    crypto_Rsa_Status_E result;
+    CRYPTO_RSA_RESULT hwResult;
+    CPKCL_RSA_CRT_KEY crtKey;
+    uint8_t lHash[CRYPTO_RSA_HW_MAX_HASH_SIZE];
+    uint32_t modulusLen = privKey->modulusLen;
+    uint32_t hashSize = lCrypto_Rsa_Hw_HashSize(hashType);
+    uint32_t dbLen = modulusLen - hashSize - 1U;
+    uint8_t *seed = &rsaEm[1];
+    uint8_t *db = &rsaEm[1U + hashSize];
+    uint32_t i;
+    uint32_t msgStart = 0U;
+    uint8_t bad;
+    uint8_t found = 0U;
+    
+    *msgLen = 0U;
+    
+    if ((modulusLen > CRYPTO_RSA_HW_MAX_MODULUS_SIZE) || 
+        (dataLen != modulusLen) || (hashSize == 0U))
+    {
+        return CRYPTO_RSA_ERROR_KEYLEN;
+    }
+    
+    result = lCrypto_Rsa_Hw_Hash(hashType, label, labelLen, NULL, 0U, NULL, 
+        0U, lHash);
+    if (result != CRYPTO_RSA_SUCCESS)
+    {
+        return result;
+    }
+    
+    lCrypto_Rsa_Hw_CrtKey(privKey, &crtKey);
+    hwResult = DRV_CRYPTO_RSA_PrivateCrt(&crtKey, inputData, rsaEm);
+    if (hwResult == CRYPTO_RSA_RESULT_ERROR_INPUT)
+    {
+        return CRYPTO_RSA_ERROR_DECRYPT;
+    }
+    if (hwResult != CRYPTO_RSA_RESULT_SUCCESS)
+    {
+        return lCrypto_Rsa_Hw_MapResult(hwResult);
+    }
+    
+    result = lCrypto_Rsa_Hw_Mgf1Xor(hashType, db, dbLen, seed, hashSize);
+    if (result == CRYPTO_RSA_SUCCESS)
+    {
+        result = lCrypto_Rsa_Hw_Mgf1Xor(hashType, seed, hashSize, db, dbLen);
+    }
+    if (result != CRYPTO_RSA_SUCCESS)
+    {
+        (void) memset(rsaEm, 0, sizeof(rsaEm));
+        return result;
+    }
+    
+    /* The checks go through the whole block whatever fails first, so the 
+       time does not tell which part of the padding is wrong */
+    bad = rsaEm[0];
+    for (i = 0U; i < hashSize; i++)
+    {
+        bad |= (uint8_t) (db[i] ^ lHash[i]);
+    }
+    for (i = hashSize; i < dbLen; i++)
+    {
+        uint8_t isOne = (uint8_t) ((db[i] == 0x01U) ? 1U : 0U);
+        uint8_t isZero = (uint8_t) ((db[i] == 0x00U) ? 1U : 0U);
+        
+        if ((found == 0U) && (isOne != 0U))
+        {
+            msgStart = i + 1U;
+        }
+        bad |= (uint8_t) (((found | isOne | isZero) == 0U) ? 1U : 0U);
+        found |= isOne;
+    }
+    bad |= (uint8_t) ((found == 0U) ? 1U : 0U);
+    
+    if (bad != 0U)
+    {
+        result = CRYPTO_RSA_ERROR_DECRYPT;
+    }
+    else if ((dbLen - msgStart) > outDataLen)
+    {
+        result = CRYPTO_RSA_ERROR_OUTPUTDATA;
+    }
+    else
+    {
+        *msgLen = dbLen - msgStart;
+        (void) memcpy(outData, &db[msgStart], *msgLen);
+    }
+    
+    (void) memset(rsaEm, 0, sizeof(rsaEm));
+    
+    return result;
+}
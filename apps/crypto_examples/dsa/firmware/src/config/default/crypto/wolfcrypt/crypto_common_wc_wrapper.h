@@ -23,7 +23,7 @@
 
 #include "crypto/common_crypto/crypto_common.h"
 
-#define CRYPTO_WC_ECC_TOTAL_CURVES (5)
+#define CRYPTO_WC_ECC_TOTAL_CURVES (8)
 
 int Crypto_Common_Wc_Ecc_GetWcCurveId(crypto_EccCurveType_E curveType_en);
 
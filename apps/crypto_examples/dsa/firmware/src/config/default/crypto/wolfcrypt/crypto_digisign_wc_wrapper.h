@@ -40,4 +40,21 @@ crypto_DigiSign_Status_E Crypto_DigiSign_Wc_Ecdsa_VerifyData(uint8_t *ptr_wcInpu
                                                             uint8_t *ptr_wcPubKey, uint32_t wcPubKeyLen, crypto_Hash_Algo_E hashType_en,
                                                             int8_t *ptr_wcHashVerifyStat, crypto_EccCurveType_E wcEccCurveType_en);
 
+crypto_DigiSign_Status_E Crypto_DigiSign_Wc_Ecc_KeyGen(uint8_t *ptr_wcPrivKey, uint32_t wcPrivKeyLen, uint8_t *ptr_wcPubKey, uint32_t wcPubKeyLen, 
+                                                        crypto_EccCurveType_E wcEccCurveType_en);
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Wc_Ecdsa_VerifyBatch(st_Crypto_DigiSign_Ecdsa_VerifyItem *ptr_wcItems, uint32_t wcNumItems, 
+                                                            uint32_t *ptr_wcVerifyBitmap, crypto_EccCurveType_E wcEccCurveType_en);
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Wc_Ecdsa_SignHashWithKey(uint8_t *ptr_wcInputHash, uint32_t wcHashLen, uint8_t *ptr_wcSig, uint32_t wcSigLen, 
+                                                                st_Crypto_Key_Ecc *ptr_wcKey_st);
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Wc_Ecdsa_VerifyHashWithKey(uint8_t *ptr_wcInputHash, uint32_t wcHashLen, uint8_t *ptr_wcInputSig, uint32_t wcSigLen, 
+                                                                    int8_t *ptr_wcHashVerifyStat, st_Crypto_Key_Ecc *ptr_wcKey_st);
+
+//k of RFC 6979 from an HMAC_DRBG on the wolfCrypt HMAC, handed to wolfCrypt with wc_ecc_sign_set_k
+crypto_DigiSign_Status_E Crypto_DigiSign_Wc_Ecdsa_SignHashDeterministic(uint8_t *ptr_wcInputHash, uint32_t wcHashLen, uint8_t *ptr_wcSig, 
+                                                                    uint32_t wcSigLen, uint8_t *ptr_wcPrivKey, uint32_t wcPrivKeyLen, 
+                                                                    crypto_Hash_Algo_E hashType_en, crypto_EccCurveType_E wcEccCurveType_en);
+
 #endif /* CRYPTO_DIGISIGN_WC_WRAPPER_H */
@@ -0,0 +1,50 @@
+/*******************************************************************************
+  MPLAB Harmony Application Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_rsa_wc_wrapper.h
+
+  Summary:
+    This header file provides prototypes and definitions for the application.
+
+  Description:
+    This header file provides function prototypes and data type definitions for
+    the application.  Some of these are required by the system (such as the
+    "APP_Initialize" and "APP_Tasks" prototypes) and some of them are only used
+    internally by the application (such as the "APP_STATES" definition).  Both
+    are defined here for convenience.
+*******************************************************************************/
+
+#ifndef CRYPTO_RSA_WC_WRAPPER_H
+#define CRYPTO_RSA_WC_WRAPPER_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include "crypto/common_crypto/crypto_rsa.h"
+
+crypto_Rsa_Status_E Crypto_Rsa_Wc_Pkcs1v15_Sign(uint8_t *ptr_wcInputHash, uint32_t wcHashLen, crypto_Hash_Algo_E hashType_en, uint8_t *ptr_wcSig, 
+                                                uint32_t wcSigLen, st_Crypto_Rsa_PrivKey *ptr_wcPrivKey);
+
+crypto_Rsa_Status_E Crypto_Rsa_Wc_Pkcs1v15_Verify(uint8_t *ptr_wcInputHash, uint32_t wcHashLen, crypto_Hash_Algo_E hashType_en, uint8_t *ptr_wcSig, 
+                                                  uint32_t wcSigLen, st_Crypto_Rsa_PubKey *ptr_wcPubKey, int8_t *ptr_wcHashVerifyStat);
+
+crypto_Rsa_Status_E Crypto_Rsa_Wc_Pss_Sign(uint8_t *ptr_wcInputHash, uint32_t wcHashLen, crypto_Hash_Algo_E hashType_en, uint32_t wcSaltLen, 
+                                           uint8_t *ptr_wcSig, uint32_t wcSigLen, st_Crypto_Rsa_PrivKey *ptr_wcPrivKey);
+
+crypto_Rsa_Status_E Crypto_Rsa_Wc_Pss_Verify(uint8_t *ptr_wcInputHash, uint32_t wcHashLen, crypto_Hash_Algo_E hashType_en, uint32_t wcSaltLen, 
+                                             uint8_t *ptr_wcSig, uint32_t wcSigLen, st_Crypto_Rsa_PubKey *ptr_wcPubKey, int8_t *ptr_wcHashVerifyStat);
+
+crypto_Rsa_Status_E Crypto_Rsa_Wc_Oaep_Encrypt(uint8_t *ptr_wcInputData, uint32_t wcDataLen, crypto_Hash_Algo_E hashType_en, uint8_t *ptr_wcLabel, 
+                                               uint32_t wcLabelLen, uint8_t *ptr_wcOutData, uint32_t wcOutDataLen, st_Crypto_Rsa_PubKey *ptr_wcPubKey);
+
+crypto_Rsa_Status_E Crypto_Rsa_Wc_Oaep_Decrypt(uint8_t *ptr_wcInputData, uint32_t wcDataLen, crypto_Hash_Algo_E hashType_en, uint8_t *ptr_wcLabel, 
+                                               uint32_t wcLabelLen, uint8_t *ptr_wcOutData, uint32_t wcOutDataLen, uint32_t *ptr_wcMsgLen,
+                                               st_Crypto_Rsa_PrivKey *ptr_wcPrivKey);
+
+#endif /* CRYPTO_RSA_WC_WRAPPER_H */
@@ -34,7 +34,9 @@
 #include "wolfssl/wolfcrypt/error-crypt.h"
 #include "wolfssl/wolfcrypt/random.h"
 #include "wolfssl/wolfcrypt/ecc.h"
+#include "wolfssl/wolfcrypt/hmac.h"
 #include "crypto/common_crypto/crypto_hash.h"
+#include "crypto/common_crypto/crypto_rfc6979.h"
 
 crypto_DigiSign_Status_E Crypto_DigiSign_Wc_Ecdsa_SignHash(uint8_t *ptr_wcInputHash, uint32_t wcHashLen, uint8_t *ptr_wcSig, uint32_t wcSigLen, uint8_t *ptr_wcPrivKey, 
                                                        uint32_t wcPrivKeyLen, crypto_EccCurveType_E wcEccCurveType_en)
@@ -257,3 +259,437 @@ crypto_DigiSign_Status_E Crypto_DigiSign_Wc_Ecdsa_VerifyData(uint8_t *ptr_wcInpu
 }
 #pragma coverity compliance end_block "MISRA C-2012 Rule 5.1"
 #pragma GCC diagnostic pop 
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Wc_Ecc_KeyGen(uint8_t *ptr_wcPrivKey, uint32_t wcPrivKeyLen, uint8_t *ptr_wcPubKey, uint32_t wcPubKeyLen, 
+                                                        crypto_EccCurveType_E wcEccCurveType_en)
+{
+    crypto_DigiSign_Status_E ret_wcEcdsaStat_en;
+    ecc_key wcEccKey_st;
+    WC_RNG wcRng_st;
+    int wcEccCurveId = (int)ECC_CURVE_INVALID;
+    int wcEcdsaStat = BAD_FUNC_ARG;
+    int wcKeySize = 0;
+    word32 privKeyLen = wcPrivKeyLen;
+    word32 pubKeyLen = wcPubKeyLen;
+    
+    wcEccCurveId = Crypto_Common_Wc_Ecc_GetWcCurveId(wcEccCurveType_en);
+    
+    if(wcEccCurveId == (int)ECC_CURVE_INVALID)
+    {
+        ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_ERROR_CURVE;
+    }
+    else
+    {
+        wcKeySize = wc_ecc_get_curve_size_from_id(wcEccCurveId);
+        
+        if(wcPrivKeyLen < (uint32_t)wcKeySize)
+        {
+            ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_ERROR_PRIVKEYLEN;
+        }
+        else if(wcPubKeyLen < ((2u * (uint32_t)wcKeySize) + 1u))
+        {
+            ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_ERROR_PUBKEYLEN;
+        }
+        else
+        {
+            // Setup the RNG
+            wcEcdsaStat = wc_InitRng(&wcRng_st);
+
+            if(wcEcdsaStat == 0)
+            {
+                wcEcdsaStat = wc_ecc_init(&wcEccKey_st);
+
+                if(wcEcdsaStat == 0)
+                {
+                    wcEcdsaStat = wc_ecc_make_key_ex(&wcRng_st, wcKeySize, &wcEccKey_st, wcEccCurveId);
+
+                    //Export private key "d" and public key in ANSI X9.63 format
+                    if(wcEcdsaStat == 0)
+                    {
+                        wcEcdsaStat = wc_ecc_export_private_only(&wcEccKey_st, ptr_wcPrivKey, &privKeyLen);
+                    }
+                    if(wcEcdsaStat == 0)
+                    {
+                        wcEcdsaStat = wc_ecc_export_x963(&wcEccKey_st, ptr_wcPubKey, &pubKeyLen);
+                    }
+                    (void)wc_ecc_free(&wcEccKey_st);
+                }
+                (void)wc_FreeRng(&wcRng_st);
+                
+                if(wcEcdsaStat == 0)
+                {
+                    ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_SUCCESS;
+                }
+                else if(wcEcdsaStat == ECC_CURVE_OID_E)
+                {
+                    ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_ERROR_CURVE;
+                }
+                else if( (wcEcdsaStat == BAD_FUNC_ARG) || (wcEcdsaStat == ECC_BAD_ARG_E) )
+                {
+                    ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_ERROR_ARG;
+                }
+                else
+                {
+                    ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_ERROR_FAIL;
+                }
+            }
+            else
+            {
+                ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_ERROR_RNG;
+            }
+        }
+    }
+    
+    return ret_wcEcdsaStat_en;
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Wc_Ecdsa_VerifyBatch(st_Crypto_DigiSign_Ecdsa_VerifyItem *ptr_wcItems, uint32_t wcNumItems, 
+                                                            uint32_t *ptr_wcVerifyBitmap, crypto_EccCurveType_E wcEccCurveType_en)
+{
+    crypto_DigiSign_Status_E ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_SUCCESS;
+    ecc_key wcEccPubKey_st;
+    int wcEccCurveId = (int)ECC_CURVE_INVALID;
+    int wcEcdsaStat = BAD_FUNC_ARG;
+    int verifyStat = 0;
+    int curveLen = 0;
+    uint8_t *ptr_importedKey = NULL;
+    uint32_t item;
+    mp_int r, s;
+    
+    wcEccCurveId = Crypto_Common_Wc_Ecc_GetWcCurveId(wcEccCurveType_en);
+    
+    if(wcEccCurveId == (int)ECC_CURVE_INVALID)
+    {
+        ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_ERROR_CURVE;
+    }
+    else if( (wc_ecc_init(&wcEccPubKey_st) != 0) || (mp_init_multi(&r, &s, NULL, NULL, NULL, NULL) != MP_OKAY) )
+    {
+        ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_ERROR_FAIL;
+    }
+    else
+    {
+        curveLen = wc_ecc_get_curve_size_from_id(wcEccCurveId);
+        
+        for(item = 0u; item < wcNumItems; item++)
+        {
+            wcEcdsaStat = 0;
+            verifyStat = 0;
+            
+            //Items in a row signed by the same key import it once
+            if(ptr_wcItems[item].ptr_pubKey != ptr_importedKey)
+            {
+                ptr_importedKey = NULL;
+                (void)wc_ecc_free(&wcEccPubKey_st);
+                wcEcdsaStat = wc_ecc_init(&wcEccPubKey_st);
+                if(wcEcdsaStat == 0)
+                {
+                    wcEcdsaStat = wc_ecc_import_x963_ex(ptr_wcItems[item].ptr_pubKey, ptr_wcItems[item].pubKeyLen, &wcEccPubKey_st, wcEccCurveId);
+                }
+                if(wcEcdsaStat == 0)
+                {
+                    ptr_importedKey = ptr_wcItems[item].ptr_pubKey;
+                }
+            }
+            
+            if( (wcEcdsaStat == 0) && (ptr_wcItems[item].sigLen >= (2u * (uint32_t)curveLen)) )
+            {
+                wcEcdsaStat = mp_read_unsigned_bin(&r, ptr_wcItems[item].ptr_inputSig, (word32)curveLen);
+                if(wcEcdsaStat == 0)
+                {
+                    wcEcdsaStat = mp_read_unsigned_bin(&s, (const byte*)(ptr_wcItems[item].ptr_inputSig + (uint32_t)curveLen), (word32)curveLen);
+                }
+                if(wcEcdsaStat == 0)
+                {
+                    wcEcdsaStat = wc_ecc_verify_hash_ex(&r, &s, (const byte*)ptr_wcItems[item].ptr_inputHash, (word32)ptr_wcItems[item].hashLen, 
+                                                        &verifyStat, &wcEccPubKey_st);
+                }
+                if( (wcEcdsaStat == 0) && (verifyStat == 1) )
+                {
+                    *ptr_wcVerifyBitmap |= ((uint32_t)1u << item);
+                }
+            }
+        }
+        
+        mp_clear(&r);
+        mp_clear(&s);
+        (void)wc_ecc_free(&wcEccPubKey_st);
+    }
+    
+    return ret_wcEcdsaStat_en;
+}
+
+//The ecc_key and the DRBG of the handle were set up by Crypto_Key_Import
+crypto_DigiSign_Status_E Crypto_DigiSign_Wc_Ecdsa_SignHashWithKey(uint8_t *ptr_wcInputHash, uint32_t wcHashLen, uint8_t *ptr_wcSig, uint32_t wcSigLen, 
+                                                                st_Crypto_Key_Ecc *ptr_wcKey_st)
+{
+    crypto_DigiSign_Status_E ret_wcEcdsaStat_en;
+    int wcEcdsaStat;
+    mp_int r, s;
+    
+    (void)wcSigLen;
+    
+    wcEcdsaStat = mp_init(&r);
+                    
+    if(wcEcdsaStat == 0)
+    {        
+        wcEcdsaStat = mp_init(&s);           
+    }
+    if(wcEcdsaStat == 0)
+    {
+        wcEcdsaStat = wc_ecc_sign_hash_ex(ptr_wcInputHash, wcHashLen, (WC_RNG*)ptr_wcKey_st->ptr_wcRng, (ecc_key*)ptr_wcKey_st->ptr_wcEccKey, &r, &s);
+
+        //Import signature R and S
+        if(wcEcdsaStat == 0)
+        {
+            wcEcdsaStat = mp_to_unsigned_bin_len(&r, (byte*)ptr_wcSig, (int)ptr_wcKey_st->keySize);
+        }
+        if(wcEcdsaStat == 0)
+        {
+            wcEcdsaStat = mp_to_unsigned_bin_len(&s, (byte*)(ptr_wcSig + ptr_wcKey_st->keySize), (int)ptr_wcKey_st->keySize);
+        }
+    }
+    
+    if(wcEcdsaStat == 0)
+    {
+        ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_SUCCESS;
+    }
+    else if(wcEcdsaStat == RNG_FAILURE_E)
+    {
+        ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_ERROR_RNG;
+    }
+    else if( (wcEcdsaStat == BAD_FUNC_ARG) || (wcEcdsaStat == ECC_BAD_ARG_E) )
+    {
+        ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_ERROR_ARG;
+    }
+    else
+    {
+        ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_ERROR_FAIL;
+    }
+    
+    return ret_wcEcdsaStat_en;
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Wc_Ecdsa_VerifyHashWithKey(uint8_t *ptr_wcInputHash, uint32_t wcHashLen, uint8_t *ptr_wcInputSig, uint32_t wcSigLen, 
+                                                                    int8_t *ptr_wcHashVerifyStat, st_Crypto_Key_Ecc *ptr_wcKey_st)
+{
+    crypto_DigiSign_Status_E ret_wcEcdsaStat_en;
+    int wcEcdsaStat;
+    int verifyStat = 0;
+    mp_int r, s;
+    
+    (void)wcSigLen;
+    
+    wcEcdsaStat = mp_init(&r);
+    
+    if(wcEcdsaStat == 0)
+    {        
+        wcEcdsaStat = mp_init(&s);
+    }
+    if(wcEcdsaStat == 0)
+    {
+        // Import signature r and s
+        wcEcdsaStat = mp_read_unsigned_bin(&r, ptr_wcInputSig, (word32)ptr_wcKey_st->keySize);
+    }
+    if(wcEcdsaStat == 0)
+    {
+        wcEcdsaStat = mp_read_unsigned_bin(&s, (const byte*)(ptr_wcInputSig + ptr_wcKey_st->keySize), (word32)ptr_wcKey_st->keySize);
+    }
+    //If Verify status value is 1 then verification is successfully
+    if(wcEcdsaStat == 0)
+    {
+        wcEcdsaStat = wc_ecc_verify_hash_ex(&r, &s, (const byte*)ptr_wcInputHash, (word32)wcHashLen, &verifyStat, (ecc_key*)ptr_wcKey_st->ptr_wcEccKey);
+        *ptr_wcHashVerifyStat = (int8_t)verifyStat;
+    }
+    
+    if(wcEcdsaStat == 0)
+    {
+        ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_SUCCESS;
+    }
+    else if( (wcEcdsaStat == BAD_FUNC_ARG) || (wcEcdsaStat == ECC_BAD_ARG_E) )
+    {
+        ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_ERROR_ARG;
+    }
+    else
+    {
+        ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_ERROR_FAIL;
+    }
+    
+    return ret_wcEcdsaStat_en;
+}
+
+//HMAC of the RFC 6979 HMAC_DRBG
+static bool lCrypto_DigiSign_Wc_Ecdsa_Hmac(crypto_Hash_Algo_E hashAlgo_en, uint8_t *ptr_key, uint32_t keyLen, uint8_t **ptr_data, 
+                                           uint32_t *ptr_dataLen, uint32_t numData, uint8_t *ptr_mac)
+{
+    Hmac wcHmac_st;
+    int wcHmacType;
+    int wcHmacStat;
+    uint32_t i;
+    
+    switch(hashAlgo_en)
+    {
+        case CRYPTO_HASH_SHA2_256:
+            wcHmacType = WC_SHA256;
+            break;
+        case CRYPTO_HASH_SHA2_384:
+            wcHmacType = WC_SHA384;
+            break;
+        default:
+            wcHmacType = WC_SHA512;
+            break;
+    }
+    
+    wcHmacStat = wc_HmacInit(&wcHmac_st, NULL, INVALID_DEVID);
+    if(wcHmacStat == 0)
+    {
+        wcHmacStat = wc_HmacSetKey(&wcHmac_st, wcHmacType, ptr_key, keyLen);
+        for(i = 0u; (i < numData) && (wcHmacStat == 0); i++)
+        {
+            wcHmacStat = wc_HmacUpdate(&wcHmac_st, ptr_data[i], ptr_dataLen[i]);
+        }
+        if(wcHmacStat == 0)
+        {
+            wcHmacStat = wc_HmacFinal(&wcHmac_st, ptr_mac);
+        }
+        wc_HmacFree(&wcHmac_st);
+    }
+    
+    return (wcHmacStat == 0);
+}
+
+crypto_DigiSign_Status_E Crypto_DigiSign_Wc_Ecdsa_SignHashDeterministic(uint8_t *ptr_wcInputHash, uint32_t wcHashLen, uint8_t *ptr_wcSig, 
+                                                                    uint32_t wcSigLen, uint8_t *ptr_wcPrivKey, uint32_t wcPrivKeyLen, 
+                                                                    crypto_Hash_Algo_E hashType_en, crypto_EccCurveType_E wcEccCurveType_en)
+{
+    crypto_DigiSign_Status_E ret_wcEcdsaStat_en;
+    crypto_Rfc6979_Status_E nonceStat_en = CRYPTO_RFC6979_SUCCESS;
+    ecc_key wcEccPrivKey_st;
+    WC_RNG wcRng_st;
+    int wcEccCurveId = (int)ECC_CURVE_INVALID;
+    int wcEcdsaStat = BAD_FUNC_ARG;
+    int wcRngStat = BAD_FUNC_ARG;
+    int keySize = 0;
+    uint8_t order[CRYPTO_ECC_MAX_KEY_LENGTH];
+    uint8_t k[CRYPTO_ECC_MAX_KEY_LENGTH];
+    uint32_t orderLen = 0u;
+    mp_int r, s, wcOrder;
+    
+    wcEccCurveId = Crypto_Common_Wc_Ecc_GetWcCurveId(wcEccCurveType_en);
+    
+    if(wcEccCurveId == (int)ECC_CURVE_INVALID)
+    {
+        return CRYPTO_DIGISIGN_ERROR_CURVE;
+    }
+    
+    //wolfCrypt takes a DRBG even with k given, no nonce is drawn from it
+    wcRngStat = wc_InitRng(&wcRng_st);
+    if(wcRngStat != 0)
+    {
+        return CRYPTO_DIGISIGN_ERROR_RNG;
+    }
+    
+    wcEcdsaStat = wc_ecc_init(&wcEccPrivKey_st);
+    if(wcEcdsaStat == 0)
+    {
+        wcEcdsaStat = wc_ecc_import_private_key_ex(ptr_wcPrivKey, wcPrivKeyLen, NULL, 0, &wcEccPrivKey_st, wcEccCurveId);
+        
+        if(wcEcdsaStat == 0)
+        {
+            keySize = wcEccPrivKey_st.dp->size;
+            if(wcSigLen < (2u * (uint32_t)keySize))
+            {
+                wcEcdsaStat = BAD_FUNC_ARG;
+            }
+        }
+        
+        //Order of the curve MSB first without leading zero bytes
+        if(wcEcdsaStat == 0)
+        {
+            wcEcdsaStat = mp_init(&wcOrder);
+            if(wcEcdsaStat == 0)
+            {
+                wcEcdsaStat = mp_read_radix(&wcOrder, wcEccPrivKey_st.dp->order, MP_RADIX_HEX);
+                if(wcEcdsaStat == 0)
+                {
+                    orderLen = (uint32_t)mp_unsigned_bin_size(&wcOrder);
+                    if( (orderLen == 0u) || (orderLen > (uint32_t)CRYPTO_ECC_MAX_KEY_LENGTH) )
+                    {
+                        wcEcdsaStat = ECC_BAD_ARG_E;
+                    }
+                }
+                if(wcEcdsaStat == 0)
+                {
+                    wcEcdsaStat = mp_to_unsigned_bin(&wcOrder, order);
+                }
+                mp_clear(&wcOrder);
+            }
+        }
+        
+        if(wcEcdsaStat == 0)
+        {
+            nonceStat_en = Crypto_Rfc6979_GenerateK(lCrypto_DigiSign_Wc_Ecdsa_Hmac, hashType_en, order, orderLen, ptr_wcPrivKey, 
+                                                    wcPrivKeyLen, ptr_wcInputHash, wcHashLen, k);
+            if(nonceStat_en == CRYPTO_RFC6979_SUCCESS)
+            {
+                //Used by the next signature only, cleared by wolfCrypt
+                wcEcdsaStat = wc_ecc_sign_set_k(k, orderLen, &wcEccPrivKey_st);
+            }
+        }
+        
+        if( (wcEcdsaStat == 0) && (nonceStat_en == CRYPTO_RFC6979_SUCCESS) )
+        {
+            wcEcdsaStat = mp_init_multi(&r, &s, NULL, NULL, NULL, NULL);
+            if(wcEcdsaStat == 0)
+            {
+                wcEcdsaStat = wc_ecc_sign_hash_ex(ptr_wcInputHash, wcHashLen, &wcRng_st, &wcEccPrivKey_st, &r, &s);
+
+                //Import signature R and S
+                if(wcEcdsaStat == 0)
+                {
+                    wcEcdsaStat = mp_to_unsigned_bin_len(&r, (byte*)ptr_wcSig, keySize);
+                }
+                if(wcEcdsaStat == 0)
+                {
+                    wcEcdsaStat = mp_to_unsigned_bin_len(&s, (byte*)(ptr_wcSig + (uint32_t)keySize), keySize);
+                }
+                mp_clear(&r);
+                mp_clear(&s);
+            }
+        }
+        
+        (void)wc_ecc_free(&wcEccPrivKey_st);
+    }
+    (void)wc_FreeRng(&wcRng_st);
+    (void)XMEMSET(k, 0, sizeof(k));
+    
+    if(nonceStat_en == CRYPTO_RFC6979_ERROR_ARG)
+    {
+        ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_ERROR_PRIVKEYLEN;
+    }
+    else if(nonceStat_en == CRYPTO_RFC6979_ERROR_HASHTYPE)
+    {
+        ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_ERROR_HASHTYPE;
+    }
+    else if(nonceStat_en != CRYPTO_RFC6979_SUCCESS)
+    {
+        ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_ERROR_FAIL;
+    }
+    else if(wcEcdsaStat == 0)
+    {
+        ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_SUCCESS;
+    }
+    else if(wcEcdsaStat == ECC_CURVE_OID_E)
+    {
+        ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_ERROR_CURVE;
+    }
+    else if( (wcEcdsaStat == BAD_FUNC_ARG) || (wcEcdsaStat == ECC_BAD_ARG_E) )
+    {
+        ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_ERROR_ARG;
+    }
+    else
+    {
+        ret_wcEcdsaStat_en = CRYPTO_DIGISIGN_ERROR_FAIL;
+    }
+    
+    return ret_wcEcdsaStat_en;
+}
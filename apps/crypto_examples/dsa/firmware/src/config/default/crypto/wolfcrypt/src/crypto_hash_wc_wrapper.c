@@ -32,6 +32,7 @@
 #include "crypto/wolfcrypt/crypto_hash_wc_wrapper.h"
 #include "wolfssl/wolfcrypt/error-crypt.h"
 #include "wolfssl/wolfcrypt/sha256.h"
+#include "wolfssl/wolfcrypt/sha512.h"
 // *****************************************************************************
 // *****************************************************************************
 // Section: Global Data Definitions
@@ -79,6 +80,12 @@ crypto_Hash_Status_E Crypto_Hash_Wc_ShaInit(void *ptr_shaCtx_st, crypto_Hash_Alg
             case CRYPTO_HASH_SHA2_256:
                 wcShaStatus = wc_InitSha256((wc_Sha256*)ptr_shaCtx_st);
                 break;
+            case CRYPTO_HASH_SHA2_384:
+                wcShaStatus = wc_InitSha384((wc_Sha384*)ptr_shaCtx_st);
+                break;
+            case CRYPTO_HASH_SHA2_512:
+                wcShaStatus = wc_InitSha512((wc_Sha512*)ptr_shaCtx_st);
+                break;
             default:
                 ret_shaStat_en = CRYPTO_HASH_ERROR_ALGO;
                 break;
@@ -118,6 +125,12 @@ crypto_Hash_Status_E Crypto_Hash_Wc_ShaUpdate(void *ptr_shaCtx_st, uint8_t *ptr_
 		case CRYPTO_HASH_SHA2_256:
 			wcShaStatus = wc_Sha256Update((wc_Sha256*)ptr_shaCtx_st, (const byte*)ptr_data, (word32)dataLen);
             break;
+		case CRYPTO_HASH_SHA2_384:
+			wcShaStatus = wc_Sha384Update((wc_Sha384*)ptr_shaCtx_st, (const byte*)ptr_data, (word32)dataLen);
+            break;
+		case CRYPTO_HASH_SHA2_512:
+			wcShaStatus = wc_Sha512Update((wc_Sha512*)ptr_shaCtx_st, (const byte*)ptr_data, (word32)dataLen);
+            break;
         default:
             ret_shaStat_en = CRYPTO_HASH_ERROR_ALGO;
             break;
@@ -149,6 +162,12 @@ crypto_Hash_Status_E Crypto_Hash_Wc_ShaFinal(void *ptr_shaCtx_st, uint8_t *ptr_d
 		case CRYPTO_HASH_SHA2_256:
 			wcShaStatus = wc_Sha256Final((wc_Sha256*)ptr_shaCtx_st, (byte*)ptr_digest);
             break;
+		case CRYPTO_HASH_SHA2_384:
+			wcShaStatus = wc_Sha384Final((wc_Sha384*)ptr_shaCtx_st, (byte*)ptr_digest);
+            break;
+		case CRYPTO_HASH_SHA2_512:
+			wcShaStatus = wc_Sha512Final((wc_Sha512*)ptr_shaCtx_st, (byte*)ptr_digest);
+            break;
         default:
             ret_shaStat_en = CRYPTO_HASH_ERROR_ALGO;
             break;
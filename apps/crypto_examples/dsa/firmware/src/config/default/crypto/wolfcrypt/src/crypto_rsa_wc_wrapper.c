@@ -0,0 +1,434 @@
+/*******************************************************************************
+  MPLAB Harmony Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_rsa_wc_wrapper.c
+
+  Summary:
+    This file contains the source code for the MPLAB Harmony application.
+
+  Description:
+    This file contains the source code for the MPLAB Harmony application.  It
+    implements the logic of the application's state machine and it may call
+    API routines of other MPLAB Harmony modules in the system, such as drivers,
+    system services, and middleware.  However, it does not call any of the
+    system interfaces (such as the "Initialize" and "Tasks" functions) of any of
+    the modules in the system or make any assumptions about when those functions
+    are called.  That is the responsibility of the configuration-specific system
+    files.
+*******************************************************************************/
+
+ 
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <string.h>
+#include "crypto/common_crypto/crypto_rsa.h"
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/wolfcrypt/crypto_rsa_wc_wrapper.h"
+#include "wolfssl/wolfcrypt/error-crypt.h"
+#include "wolfssl/wolfcrypt/random.h"
+#include "wolfssl/wolfcrypt/hash.h"
+#include "wolfssl/wolfcrypt/rsa.h"
+#include "wolfssl/wolfcrypt/asn_public.h"
+
+//DigestInfo of the largest hash, SHA-512
+#define CRYPTO_RSA_WC_DIGESTINFO_MAX (19u + 64u)
+
+static enum wc_HashType lCrypto_Rsa_Wc_GetHashType(crypto_Hash_Algo_E hashType_en, int *ptr_wcMgf)
+{
+    enum wc_HashType wcHashType_en;
+
+    switch(hashType_en)
+    {
+        case CRYPTO_HASH_SHA2_256:
+            wcHashType_en = WC_HASH_TYPE_SHA256;
+            *ptr_wcMgf = WC_MGF1SHA256;
+            break;
+        case CRYPTO_HASH_SHA2_384:
+            wcHashType_en = WC_HASH_TYPE_SHA384;
+            *ptr_wcMgf = WC_MGF1SHA384;
+            break;
+        case CRYPTO_HASH_SHA2_512:
+            wcHashType_en = WC_HASH_TYPE_SHA512;
+            *ptr_wcMgf = WC_MGF1SHA512;
+            break;
+        default:
+            wcHashType_en = WC_HASH_TYPE_NONE;
+            *ptr_wcMgf = WC_MGF1NONE;
+            break;
+    }
+    return wcHashType_en;
+}
+
+static int lCrypto_Rsa_Wc_ImportPubKey(RsaKey *ptr_wcRsaKey_st, st_Crypto_Rsa_PubKey *ptr_wcPubKey)
+{
+    int wcRsaStat = wc_InitRsaKey(ptr_wcRsaKey_st, NULL);
+
+    if(wcRsaStat == 0)
+    {
+        wcRsaStat = wc_RsaPublicKeyDecodeRaw(ptr_wcPubKey->ptr_n, ptr_wcPubKey->modulusLen, ptr_wcPubKey->ptr_e, ptr_wcPubKey->eLen, 
+                                             ptr_wcRsaKey_st);
+    }
+    return wcRsaStat;
+}
+
+//wolfCrypt has no raw import of a private key, the numbers are read one by one
+static int lCrypto_Rsa_Wc_ImportPrivKey(RsaKey *ptr_wcRsaKey_st, st_Crypto_Rsa_PrivKey *ptr_wcPrivKey, WC_RNG *ptr_wcRng_st)
+{
+    word32 wcModLen = (word32)ptr_wcPrivKey->modulusLen;
+    word32 wcPrimeLen = wcModLen / 2u;
+    int wcRsaStat = wc_InitRsaKey(ptr_wcRsaKey_st, NULL);
+
+    if(wcRsaStat == 0)
+    {
+        wcRsaStat = mp_read_unsigned_bin(&ptr_wcRsaKey_st->n, ptr_wcPrivKey->ptr_n, wcModLen);
+    }
+    if(wcRsaStat == 0)
+    {
+        wcRsaStat = mp_read_unsigned_bin(&ptr_wcRsaKey_st->e, ptr_wcPrivKey->ptr_e, (word32)ptr_wcPrivKey->eLen);
+    }
+    if(wcRsaStat == 0)
+    {
+        wcRsaStat = mp_read_unsigned_bin(&ptr_wcRsaKey_st->d, ptr_wcPrivKey->ptr_d, wcModLen);
+    }
+    if(wcRsaStat == 0)
+    {
+        wcRsaStat = mp_read_unsigned_bin(&ptr_wcRsaKey_st->p, ptr_wcPrivKey->ptr_p, wcPrimeLen);
+    }
+    if(wcRsaStat == 0)
+    {
+        wcRsaStat = mp_read_unsigned_bin(&ptr_wcRsaKey_st->q, ptr_wcPrivKey->ptr_q, wcPrimeLen);
+    }
+    if(wcRsaStat == 0)
+    {
+        wcRsaStat = mp_read_unsigned_bin(&ptr_wcRsaKey_st->dP, ptr_wcPrivKey->ptr_dP, wcPrimeLen);
+    }
+    if(wcRsaStat == 0)
+    {
+        wcRsaStat = mp_read_unsigned_bin(&ptr_wcRsaKey_st->dQ, ptr_wcPrivKey->ptr_dQ, wcPrimeLen);
+    }
+    if(wcRsaStat == 0)
+    {
+        wcRsaStat = mp_read_unsigned_bin(&ptr_wcRsaKey_st->u, ptr_wcPrivKey->ptr_qInv, wcPrimeLen);
+    }
+    if(wcRsaStat == 0)
+    {
+        ptr_wcRsaKey_st->type = RSA_PRIVATE;
+#ifdef WC_RSA_BLINDING
+        //The blinding of the private operation draws from the RNG
+        wcRsaStat = wc_RsaSetRNG(ptr_wcRsaKey_st, ptr_wcRng_st);
+#else
+        (void)ptr_wcRng_st;
+#endif
+    }
+    return wcRsaStat;
+}
+
+static crypto_Rsa_Status_E lCrypto_Rsa_Wc_MapResult(int wcRsaStat)
+{
+    crypto_Rsa_Status_E ret_wcRsaStat_en;
+
+    if(wcRsaStat >= 0)
+    {
+        ret_wcRsaStat_en = CRYPTO_RSA_SUCCESS;
+    }
+    else if(wcRsaStat == BAD_FUNC_ARG)
+    {
+        ret_wcRsaStat_en = CRYPTO_RSA_ERROR_ARG;
+    }
+    else if(wcRsaStat == RSA_BUFFER_E)
+    {
+        ret_wcRsaStat_en = CRYPTO_RSA_ERROR_OUTPUTDATA;
+    }
+    else
+    {
+        ret_wcRsaStat_en = CRYPTO_RSA_ERROR_FAIL;
+    }
+    return ret_wcRsaStat_en;
+}
+
+//Errors of a public operation that only say the signature is not valid
+static bool lCrypto_Rsa_Wc_IsBadSignature(int wcRsaStat)
+{
+    return ( (wcRsaStat == BAD_PADDING_E) || (wcRsaStat == RSA_PAD_E) || (wcRsaStat == PSS_SALTLEN_E)
+             || (wcRsaStat == RSA_OUT_OF_RANGE_E) || (wcRsaStat == RSA_BUFFER_E) );
+}
+
+crypto_Rsa_Status_E Crypto_Rsa_Wc_Pkcs1v15_Sign(uint8_t *ptr_wcInputHash, uint32_t wcHashLen, crypto_Hash_Algo_E hashType_en, uint8_t *ptr_wcSig, 
+                                                uint32_t wcSigLen, st_Crypto_Rsa_PrivKey *ptr_wcPrivKey)
+{
+    crypto_Rsa_Status_E ret_wcRsaStat_en;
+    RsaKey wcRsaKey_st;
+    WC_RNG wcRng_st;
+    byte arr_wcDigestInfo[CRYPTO_RSA_WC_DIGESTINFO_MAX];
+    word32 wcDigestInfoLen;
+    int wcMgf;
+    int wcRsaStat;
+    enum wc_HashType wcHashType_en = lCrypto_Rsa_Wc_GetHashType(hashType_en, &wcMgf);
+
+    if(wcHashType_en == WC_HASH_TYPE_NONE)
+    {
+        ret_wcRsaStat_en = CRYPTO_RSA_ERROR_HASHTYPE;
+    }
+    else
+    {
+        wcRsaStat = wc_InitRng(&wcRng_st);
+
+        if(wcRsaStat == 0)
+        {
+            wcRsaStat = lCrypto_Rsa_Wc_ImportPrivKey(&wcRsaKey_st, ptr_wcPrivKey, &wcRng_st);
+
+            if(wcRsaStat == 0)
+            {
+                wcDigestInfoLen = wc_EncodeSignature(arr_wcDigestInfo, ptr_wcInputHash, wcHashLen, wc_HashGetOID(wcHashType_en));
+                wcRsaStat = wc_RsaSSL_Sign(arr_wcDigestInfo, wcDigestInfoLen, ptr_wcSig, wcSigLen, &wcRsaKey_st, &wcRng_st);
+            }
+            (void)wc_FreeRsaKey(&wcRsaKey_st);
+            (void)wc_FreeRng(&wcRng_st);
+
+            ret_wcRsaStat_en = lCrypto_Rsa_Wc_MapResult(wcRsaStat);
+        }
+        else
+        {
+            ret_wcRsaStat_en = CRYPTO_RSA_ERROR_RNG;
+        }
+    }
+    return ret_wcRsaStat_en;
+}
+
+crypto_Rsa_Status_E Crypto_Rsa_Wc_Pkcs1v15_Verify(uint8_t *ptr_wcInputHash, uint32_t wcHashLen, crypto_Hash_Algo_E hashType_en, uint8_t *ptr_wcSig, 
+                                                  uint32_t wcSigLen, st_Crypto_Rsa_PubKey *ptr_wcPubKey, int8_t *ptr_wcHashVerifyStat)
+{
+    crypto_Rsa_Status_E ret_wcRsaStat_en;
+    RsaKey wcRsaKey_st;
+    byte arr_wcDigestInfo[CRYPTO_RSA_WC_DIGESTINFO_MAX];
+    byte arr_wcDecoded[CRYPTO_RSA_WC_DIGESTINFO_MAX];
+    word32 wcDigestInfoLen;
+    int wcMgf;
+    int wcRsaStat;
+    enum wc_HashType wcHashType_en = lCrypto_Rsa_Wc_GetHashType(hashType_en, &wcMgf);
+
+    *ptr_wcHashVerifyStat = 0;
+
+    if(wcHashType_en == WC_HASH_TYPE_NONE)
+    {
+        ret_wcRsaStat_en = CRYPTO_RSA_ERROR_HASHTYPE;
+    }
+    else
+    {
+        wcRsaStat = lCrypto_Rsa_Wc_ImportPubKey(&wcRsaKey_st, ptr_wcPubKey);
+
+        if(wcRsaStat == 0)
+        {
+            wcDigestInfoLen = wc_EncodeSignature(arr_wcDigestInfo, ptr_wcInputHash, wcHashLen, wc_HashGetOID(wcHashType_en));
+            wcRsaStat = wc_RsaSSL_Verify(ptr_wcSig, wcSigLen, arr_wcDecoded, sizeof(arr_wcDecoded), &wcRsaKey_st);
+
+            if( (wcRsaStat == (int)wcDigestInfoLen) && (memcmp(arr_wcDecoded, arr_wcDigestInfo, wcDigestInfoLen) == 0) )
+            {
+                *ptr_wcHashVerifyStat = 1;
+            }
+        }
+        (void)wc_FreeRsaKey(&wcRsaKey_st);
+
+        if(lCrypto_Rsa_Wc_IsBadSignature(wcRsaStat))
+        {
+            ret_wcRsaStat_en = CRYPTO_RSA_SUCCESS;
+        }
+        else
+        {
+            ret_wcRsaStat_en = lCrypto_Rsa_Wc_MapResult(wcRsaStat);
+        }
+    }
+    return ret_wcRsaStat_en;
+}
+
+crypto_Rsa_Status_E Crypto_Rsa_Wc_Pss_Sign(uint8_t *ptr_wcInputHash, uint32_t wcHashLen, crypto_Hash_Algo_E hashType_en, uint32_t wcSaltLen, 
+                                           uint8_t *ptr_wcSig, uint32_t wcSigLen, st_Crypto_Rsa_PrivKey *ptr_wcPrivKey)
+{
+    crypto_Rsa_Status_E ret_wcRsaStat_en;
+    RsaKey wcRsaKey_st;
+    WC_RNG wcRng_st;
+    int wcMgf;
+    int wcRsaStat;
+    enum wc_HashType wcHashType_en = lCrypto_Rsa_Wc_GetHashType(hashType_en, &wcMgf);
+
+    if(wcHashType_en == WC_HASH_TYPE_NONE)
+    {
+        ret_wcRsaStat_en = CRYPTO_RSA_ERROR_HASHTYPE;
+    }
+    else
+    {
+        wcRsaStat = wc_InitRng(&wcRng_st);
+
+        if(wcRsaStat == 0)
+        {
+            wcRsaStat = lCrypto_Rsa_Wc_ImportPrivKey(&wcRsaKey_st, ptr_wcPrivKey, &wcRng_st);
+
+            if(wcRsaStat == 0)
+            {
+                wcRsaStat = wc_RsaPSS_Sign_ex(ptr_wcInputHash, wcHashLen, ptr_wcSig, wcSigLen, wcHashType_en, wcMgf, (int)wcSaltLen, 
+                                              &wcRsaKey_st, &wcRng_st);
+            }
+            (void)wc_FreeRsaKey(&wcRsaKey_st);
+            (void)wc_FreeRng(&wcRng_st);
+
+            ret_wcRsaStat_en = lCrypto_Rsa_Wc_MapResult(wcRsaStat);
+        }
+        else
+        {
+            ret_wcRsaStat_en = CRYPTO_RSA_ERROR_RNG;
+        }
+    }
+    return ret_wcRsaStat_en;
+}
+
+crypto_Rsa_Status_E Crypto_Rsa_Wc_Pss_Verify(uint8_t *ptr_wcInputHash, uint32_t wcHashLen, crypto_Hash_Algo_E hashType_en, uint32_t wcSaltLen, 
+                                             uint8_t *ptr_wcSig, uint32_t wcSigLen, st_Crypto_Rsa_PubKey *ptr_wcPubKey, int8_t *ptr_wcHashVerifyStat)
+{
+    crypto_Rsa_Status_E ret_wcRsaStat_en;
+    RsaKey wcRsaKey_st;
+    byte arr_wcDecoded[CRYPTO_RSA_MAX_MODULUS_SIZE];
+    int wcMgf;
+    int wcRsaStat;
+    enum wc_HashType wcHashType_en = lCrypto_Rsa_Wc_GetHashType(hashType_en, &wcMgf);
+
+    *ptr_wcHashVerifyStat = 0;
+
+    if(wcHashType_en == WC_HASH_TYPE_NONE)
+    {
+        ret_wcRsaStat_en = CRYPTO_RSA_ERROR_HASHTYPE;
+    }
+    else
+    {
+        wcRsaStat = lCrypto_Rsa_Wc_ImportPubKey(&wcRsaKey_st, ptr_wcPubKey);
+
+        if(wcRsaStat == 0)
+        {
+            wcRsaStat = wc_RsaPSS_Verify_ex(ptr_wcSig, wcSigLen, arr_wcDecoded, sizeof(arr_wcDecoded), wcHashType_en, wcMgf, 
+                                            (int)wcSaltLen, &wcRsaKey_st);
+            if(wcRsaStat >= 0)
+            {
+                wcRsaStat = wc_RsaPSS_CheckPadding_ex(ptr_wcInputHash, wcHashLen, arr_wcDecoded, (word32)wcRsaStat, wcHashType_en, 
+                                                      (int)wcSaltLen, mp_count_bits(&wcRsaKey_st.n));
+                if(wcRsaStat == 0)
+                {
+                    *ptr_wcHashVerifyStat = 1;
+                }
+            }
+        }
+        (void)wc_FreeRsaKey(&wcRsaKey_st);
+
+        if(lCrypto_Rsa_Wc_IsBadSignature(wcRsaStat))
+        {
+            ret_wcRsaStat_en = CRYPTO_RSA_SUCCESS;
+        }
+        else
+        {
+            ret_wcRsaStat_en = lCrypto_Rsa_Wc_MapResult(wcRsaStat);
+        }
+    }
+    return ret_wcRsaStat_en;
+}
+
+crypto_Rsa_Status_E Crypto_Rsa_Wc_Oaep_Encrypt(uint8_t *ptr_wcInputData, uint32_t wcDataLen, crypto_Hash_Algo_E hashType_en, uint8_t *ptr_wcLabel, 
+                                               uint32_t wcLabelLen, uint8_t *ptr_wcOutData, uint32_t wcOutDataLen, st_Crypto_Rsa_PubKey *ptr_wcPubKey)
+{
+    crypto_Rsa_Status_E ret_wcRsaStat_en;
+    RsaKey wcRsaKey_st;
+    WC_RNG wcRng_st;
+    int wcMgf;
+    int wcRsaStat;
+    enum wc_HashType wcHashType_en = lCrypto_Rsa_Wc_GetHashType(hashType_en, &wcMgf);
+
+    if(wcHashType_en == WC_HASH_TYPE_NONE)
+    {
+        ret_wcRsaStat_en = CRYPTO_RSA_ERROR_HASHTYPE;
+    }
+    else
+    {
+        wcRsaStat = wc_InitRng(&wcRng_st);
+
+        if(wcRsaStat == 0)
+        {
+            wcRsaStat = lCrypto_Rsa_Wc_ImportPubKey(&wcRsaKey_st, ptr_wcPubKey);
+
+            if(wcRsaStat == 0)
+            {
+                wcRsaStat = wc_RsaPublicEncrypt_ex(ptr_wcInputData, wcDataLen, ptr_wcOutData, wcOutDataLen, &wcRsaKey_st, &wcRng_st, 
+                                                   WC_RSA_OAEP_PAD, wcHashType_en, wcMgf, ptr_wcLabel, wcLabelLen);
+            }
+            (void)wc_FreeRsaKey(&wcRsaKey_st);
+            (void)wc_FreeRng(&wcRng_st);
+
+            ret_wcRsaStat_en = lCrypto_Rsa_Wc_MapResult(wcRsaStat);
+        }
+        else
+        {
+            ret_wcRsaStat_en = CRYPTO_RSA_ERROR_RNG;
+        }
+    }
+    return ret_wcRsaStat_en;
+}
+
+crypto_Rsa_Status_E Crypto_Rsa_Wc_Oaep_Decrypt(uint8_t *ptr_wcInputData, uint32_t wcDataLen, crypto_Hash_Algo_E hashType_en, uint8_t *ptr_wcLabel, 
+                                               uint32_t wcLabelLen, uint8_t *ptr_wcOutData, uint32_t wcOutDataLen, uint32_t *ptr_wcMsgLen,
+                                               st_Crypto_Rsa_PrivKey *ptr_wcPrivKey)
+{
+    crypto_Rsa_Status_E ret_wcRsaStat_en;
+    RsaKey wcRsaKey_st;
+    WC_RNG wcRng_st;
+    int wcMgf;
+    int wcRsaStat;
+    enum wc_HashType wcHashType_en = lCrypto_Rsa_Wc_GetHashType(hashType_en, &wcMgf);
+
+    *ptr_wcMsgLen = 0u;
+
+    if(wcHashType_en == WC_HASH_TYPE_NONE)
+    {
+        ret_wcRsaStat_en = CRYPTO_RSA_ERROR_HASHTYPE;
+    }
+    else
+    {
+        wcRsaStat = wc_InitRng(&wcRng_st);
+
+        if(wcRsaStat == 0)
+        {
+            wcRsaStat = lCrypto_Rsa_Wc_ImportPrivKey(&wcRsaKey_st, ptr_wcPrivKey, &wcRng_st);
+
+            if(wcRsaStat == 0)
+            {
+                wcRsaStat = wc_RsaPrivateDecrypt_ex(ptr_wcInputData, wcDataLen, ptr_wcOutData, wcOutDataLen, &wcRsaKey_st, 
+                                                    WC_RSA_OAEP_PAD, wcHashType_en, wcMgf, ptr_wcLabel, wcLabelLen);
+            }
+            (void)wc_FreeRsaKey(&wcRsaKey_st);
+            (void)wc_FreeRng(&wcRng_st);
+
+            if(wcRsaStat >= 0)
+            {
+                *ptr_wcMsgLen = (uint32_t)wcRsaStat;
+                ret_wcRsaStat_en = CRYPTO_RSA_SUCCESS;
+            }
+            //The output buffer is checked for the longest message first, wolfCrypt reports a bad padding as RSA_BUFFER_E
+            else if( (wcRsaStat == BAD_PADDING_E) || (wcRsaStat == RSA_PAD_E) || (wcRsaStat == RSA_OUT_OF_RANGE_E)
+                     || (wcRsaStat == RSA_BUFFER_E) )
+            {
+                ret_wcRsaStat_en = CRYPTO_RSA_ERROR_DECRYPT;
+            }
+            else
+            {
+                ret_wcRsaStat_en = lCrypto_Rsa_Wc_MapResult(wcRsaStat);
+            }
+        }
+        else
+        {
+            ret_wcRsaStat_en = CRYPTO_RSA_ERROR_RNG;
+        }
+    }
+    return ret_wcRsaStat_en;
+}
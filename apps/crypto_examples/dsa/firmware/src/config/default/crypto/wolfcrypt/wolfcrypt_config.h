@@ -73,6 +73,19 @@ extern "C" {
 #define CRYPTO_DIGISIGN_ALGO_EN
 #define CRYPTO_KAS_ALGO_EN    
 
+//CPKCL self test runs once at power-on; set to N to run it again every N
+//hardware ECC operations
+#define CRYPTO_CPKCL_SELFTEST_PERIOD    (0U)
+
+//Fixed-base comb tables of the curve generators, in flash, for the CPKCC key
+//generation and the k*G of the signatures. Each one takes 17 points: 952
+//bytes for P-192, 1088 P-224, 1224 P-256, 1768 P-384 and 2448 P-521
+#define CRYPTO_CPKCL_COMB_P192
+#define CRYPTO_CPKCL_COMB_P224
+#define CRYPTO_CPKCL_COMB_P256
+#define CRYPTO_CPKCL_COMB_P384
+#define CRYPTO_CPKCL_COMB_P521
+
 /*** wolfCrypt Library Configuration ***/
 //configuration.h included in config.h and user_settings.h allowing these
 //files to configure WolfSSL library
@@ -100,7 +113,7 @@ extern "C" {
 #define WOLFSSL_SP_MATH   
 
 //Needed when WOFSSL_SP_MATH defined
-//#define WOLFSSL_HAVE_SP_RSA  
+#define WOLFSSL_HAVE_SP_RSA    //RSA 2048/3072 reference for the CPKCC benchmark
 //#define WOLFSSL_HAVE_SP_DH
 
 //To prevent usage of SP functions defined by this: 
@@ -119,8 +132,16 @@ extern "C" {
 #define WOLFSSL_SP_NONBLOCK  //JK
 #define WC_ECC_NONBLOCK      //JK
 
+//sp_int modular multiply, reduction, exponentiation and inverse run on the
+//CPKCC for odd moduli from WOLFSSL_SP_CPKCC_MIN_BITS to 3072 bits, through the
+//--wrap linker options listed in port/cpkcc/cpkcc-sp-int.h
+#define WOLFSSL_SP_CPKCC
+#define WOLFSSL_SP_CPKCC_MIN_BITS   256
+
 #define NO_PWDBASED
-//#define WOLF_CRYPTO_CB     //Provide call-back support 
+#define WOLF_CRYPTO_CB     //Provide call-back support 
+#define CRYPTO_CRYPTOCB_HW_SHA      //SHA-256/384/512 on the SHA6156, crypto_cryptocb_wc_wrapper.c
+#define CRYPTO_CRYPTOCB_HW_ECDSA    //ECDSA sign/verify on the CPKCC, crypto_cryptocb_wc_wrapper.c
 #define WOLFCRYPT_ONLY
 #define HAVE_COMP_KEY        //JK 
 
@@ -159,10 +180,13 @@ extern "C" {
 #define HAVE_X963_KDF
 #define ECC_SHAMIR
 #define WOLFSSL_CUSTOM_CURVES
+#define HAVE_ECC_BRAINPOOL
+#define HAVE_ECC_KOBLITZ
 //#define HAVE_CURVE25519     //JK 
 //#define HAVE_ED25519        //JK
 #define FP_ECC
 #define HAVE_ECC521           //ECC_MAX_BITS
+#define WOLFSSL_ECDSA_SET_K   //RFC 6979 nonce of Crypto_DigiSign_Ecdsa_SignDeterministic
 
 //#define HAVE_DH
 //#define WOLFSSL_HAVE_SP_DH
@@ -173,7 +197,8 @@ extern "C" {
 #define FP_MAX_BITS 4096
 #define USE_CERT_BUFFERS_2048
 //#define WOLFSSL_RSA_PUBLIC_ONLY  //JK //Conflict with WOLFSSL_HAVE_SP_DH
-//#define WC_RSA_PSS               //JK
+#define WC_RSA_PSS
+#define WC_RSA_BLINDING
 //#define WOLFSSL_STATIC_RSA       //JK
 #define NO_DEV_RANDOM
 #define HAVE_HASHDRBG
@@ -202,7 +227,7 @@ int Crypto_Rng_Wc_Prng_Srand(uint8_t* output, unsigned int sz);
 //#define WC_NO_RNG //when using RNG
 //#define WC_NO_HASHDRBG
 //#define HAVE_ECC_ENCRYPT
-#define NO_RSA                 //JK
+//#define NO_RSA                 //JK
 #define NO_DH                  //JK
 //#define NO_SIG_WRAPPER
 //**********************************************************
@@ -0,0 +1,295 @@
+/* cpkcc-sp-int.c
+ *
+ * This file is part of wolfSSL.
+ *
+ * wolfSSL is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * wolfSSL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1335, USA
+ */
+
+
+#ifdef HAVE_CONFIG_H
+    #include <config.h>
+#endif
+
+#include <wolfssl/wolfcrypt/settings.h>
+
+#ifdef WOLFSSL_SP_CPKCC
+
+#include <wolfssl/wolfcrypt/error-crypt.h>
+#include <wolfssl/wolfcrypt/port/cpkcc/cpkcc-sp-int.h>
+
+#include "crypto/drivers/driver/drv_crypto_mp_hw_cpkcl.h"
+
+/* The CPKCC takes numbers least significant byte first, which is how the
+ * digits of an sp_int are laid out on a little endian core: they are passed
+ * in place. */
+#ifdef BIG_ENDIAN_ORDER
+    #error WOLFSSL_SP_CPKCC needs a little endian core
+#endif
+
+#ifdef WOLFSSL_SP_INT_NEGATIVE
+    #define CPKCC_SP_NEG(a)     ((a)->sign == MP_NEG)
+#else
+    #define CPKCC_SP_NEG(a)     0
+#endif
+
+#define CPKCC_SP_BYTES(a)       ((u2)((a)->used * SP_WORD_SIZEOF))
+
+/* Exponent zero extended to the number of digits the caller asks for */
+static byte cpkcc_sp_exp[CRYPTO_MP_HW_MAX_MODULUS_SIZE];
+
+static int cpkcc_sp_min_bits = WOLFSSL_SP_CPKCC_MIN_BITS;
+
+void cpkcc_sp_set_min_bits(int bits)
+{
+    cpkcc_sp_min_bits = bits;
+}
+
+/* Size in bytes of m when the CPKCC takes it as modulus with r holding the
+ * result, 0 otherwise. */
+static u2 cpkcc_sp_mod_size(const sp_int* m, const sp_int* r)
+{
+    u2 size = 0;
+
+    if ((m->used > 0) && sp_isodd(m) && (!CPKCC_SP_NEG(m)) &&
+            (r->size >= m->used) &&
+            (m->used * SP_WORD_SIZEOF <= CRYPTO_MP_HW_MAX_MODULUS_SIZE) &&
+            (sp_count_bits(m) >= cpkcc_sp_min_bits)) {
+        size = CPKCC_SP_BYTES(m);
+    }
+
+    return size;
+}
+
+/* Converts the driver result, r being written on used digits. */
+static int cpkcc_sp_result(CRYPTO_MP_RESULT res, sp_int* r, unsigned int used)
+{
+    int err;
+
+    if (res == CRYPTO_MP_RESULT_SUCCESS) {
+        r->used = used;
+    #ifdef WOLFSSL_SP_INT_NEGATIVE
+        r->sign = MP_ZPOS;
+    #endif
+        sp_clamp(r);
+        err = MP_OKAY;
+    }
+    else if (res == CRYPTO_MP_RESULT_NO_INVERSE) {
+        err = MP_VAL;
+    }
+    else {
+        /* CPKCL not ready or operands it does not take: software */
+        err = WC_HW_E;
+    }
+
+    return err;
+}
+
+/* Each of the following computes its result on the CPKCC and returns
+ * MP_OKAY, or returns WC_HW_E without touching r when the CPKCC does not
+ * take the operands: modulus even, out of range or below the threshold,
+ * negative values, or CPKCL not ready. */
+static int cpkcc_sp_mulmod(const sp_int* a, const sp_int* b, const sp_int* m,
+    sp_int* r)
+{
+    u2 modSz = cpkcc_sp_mod_size(m, r);
+    CRYPTO_MP_RESULT res;
+
+    if ((modSz == 0) || CPKCC_SP_NEG(a) || CPKCC_SP_NEG(b) ||
+            (a->used > m->used) || (b->used > m->used)) {
+        return WC_HW_E;
+    }
+
+    res = DRV_CRYPTO_MP_ModMul((pu1)m->dp, modSz, (pu1)a->dp,
+        CPKCC_SP_BYTES(a), (pu1)b->dp, CPKCC_SP_BYTES(b), (pu1)r->dp);
+
+    return cpkcc_sp_result(res, r, m->used);
+}
+
+static int cpkcc_sp_mod(const sp_int* a, const sp_int* m, sp_int* r)
+{
+    u2 modSz = cpkcc_sp_mod_size(m, r);
+    CRYPTO_MP_RESULT res;
+
+    if ((modSz == 0) || CPKCC_SP_NEG(a) || (a->used > 2 * m->used)) {
+        return WC_HW_E;
+    }
+
+    res = DRV_CRYPTO_MP_Mod((pu1)m->dp, modSz, (pu1)a->dp, CPKCC_SP_BYTES(a),
+        (pu1)r->dp);
+
+    return cpkcc_sp_result(res, r, m->used);
+}
+
+/* regular selects the exponentiation with a sequence of operations
+ * independent of the exponent, on at least digits words of it, for secret
+ * exponents. */
+static int cpkcc_sp_exptmod(const sp_int* b, const sp_int* e, int digits,
+    const sp_int* m, sp_int* r, int regular)
+{
+    u2 modSz = cpkcc_sp_mod_size(m, r);
+    u2 expSz;
+    CRYPTO_MP_RESULT res;
+
+    /* Zero base or exponent are left to the degenerate cases in software */
+    if ((modSz == 0) || sp_iszero(b) || sp_iszero(e) || CPKCC_SP_NEG(b) ||
+            CPKCC_SP_NEG(e) || (b->used > m->used) ||
+            (sp_cmp(b, m) != MP_LT)) {
+        return WC_HW_E;
+    }
+
+    if (regular) {
+        /* Process as many digits as asked for, the length of a secret
+         * exponent is not revealed by its value */
+        if ((digits < 0) || ((unsigned int)digits < e->used)) {
+            digits = (int)e->used;
+        }
+        if ((unsigned int)digits * SP_WORD_SIZEOF > modSz) {
+            return WC_HW_E;
+        }
+        expSz = (u2)((unsigned int)digits * SP_WORD_SIZEOF);
+        XMEMSET(cpkcc_sp_exp, 0, expSz);
+        XMEMCPY(cpkcc_sp_exp, e->dp, CPKCC_SP_BYTES(e));
+
+        res = DRV_CRYPTO_MP_ExpMod((pu1)m->dp, modSz, (pu1)b->dp,
+            CPKCC_SP_BYTES(b), cpkcc_sp_exp, expSz, true, (pu1)r->dp);
+
+        XMEMSET(cpkcc_sp_exp, 0, expSz);
+    }
+    else {
+        if (CPKCC_SP_BYTES(e) > modSz) {
+            return WC_HW_E;
+        }
+
+        res = DRV_CRYPTO_MP_ExpMod((pu1)m->dp, modSz, (pu1)b->dp,
+            CPKCC_SP_BYTES(b), (pu1)e->dp, CPKCC_SP_BYTES(e), false,
+            (pu1)r->dp);
+    }
+
+    return cpkcc_sp_result(res, r, m->used);
+}
+
+/* Also returns MP_VAL when a has no inverse. */
+static int cpkcc_sp_invmod(const sp_int* a, const sp_int* m, sp_int* r)
+{
+    u2 modSz = cpkcc_sp_mod_size(m, r);
+    CRYPTO_MP_RESULT res;
+
+    if ((modSz == 0) || CPKCC_SP_NEG(a) || (a->used > m->used)) {
+        return WC_HW_E;
+    }
+
+    res = DRV_CRYPTO_MP_InvMod((pu1)m->dp, modSz, (pu1)a->dp,
+        CPKCC_SP_BYTES(a), (pu1)r->dp);
+
+    return cpkcc_sp_result(res, r, m->used);
+}
+
+/* Link time hooks. The sp_int.c argument checks are repeated only as far as
+ * needed to dereference the operands; any case the CPKCC does not take,
+ * including the error ones, goes to the software version. */
+int __wrap_sp_mod(const sp_int* a, const sp_int* m, sp_int* r)
+{
+    int err = WC_HW_E;
+
+    if ((a != NULL) && (m != NULL) && (r != NULL)) {
+        err = cpkcc_sp_mod(a, m, r);
+    }
+    if (err == WC_HW_E) {
+        err = __real_sp_mod(a, m, r);
+    }
+
+    return err;
+}
+
+int __wrap_sp_mulmod(const sp_int* a, const sp_int* b, const sp_int* m,
+    sp_int* r)
+{
+    int err = WC_HW_E;
+
+    if ((a != NULL) && (b != NULL) && (m != NULL) && (r != NULL)) {
+        err = cpkcc_sp_mulmod(a, b, m, r);
+    }
+    if (err == WC_HW_E) {
+        err = __real_sp_mulmod(a, b, m, r);
+    }
+
+    return err;
+}
+
+int __wrap_sp_invmod(const sp_int* a, const sp_int* m, sp_int* r)
+{
+    int err = WC_HW_E;
+
+    if ((a != NULL) && (m != NULL) && (r != NULL)) {
+        err = cpkcc_sp_invmod(a, m, r);
+    }
+    if (err == WC_HW_E) {
+        err = __real_sp_invmod(a, m, r);
+    }
+
+    return err;
+}
+
+/* The exponent may be secret: regular exponentiation */
+int __wrap_sp_exptmod_ex(const sp_int* b, const sp_int* e, int digits,
+    const sp_int* m, sp_int* r)
+{
+    int err = WC_HW_E;
+
+    if ((b != NULL) && (e != NULL) && (m != NULL) && (r != NULL) &&
+            (digits >= 0)) {
+        err = cpkcc_sp_exptmod(b, e, digits, m, r, 1);
+    }
+    if (err == WC_HW_E) {
+        err = __real_sp_exptmod_ex(b, e, digits, m, r);
+    }
+
+    return err;
+}
+
+/* sp_exptmod calls sp_exptmod_ex inside sp_int.c, out of reach of the
+ * linker, so it is hooked as well */
+int __wrap_sp_exptmod(const sp_int* b, const sp_int* e, const sp_int* m,
+    sp_int* r)
+{
+    int err = WC_HW_E;
+
+    if ((b != NULL) && (e != NULL) && (m != NULL) && (r != NULL)) {
+        err = cpkcc_sp_exptmod(b, e, (int)e->used, m, r, 1);
+    }
+    if (err == WC_HW_E) {
+        err = __real_sp_exptmod(b, e, m, r);
+    }
+
+    return err;
+}
+
+/* Public exponent: fast exponentiation */
+int __wrap_sp_exptmod_nct(const sp_int* b, const sp_int* e, const sp_int* m,
+    sp_int* r)
+{
+    int err = WC_HW_E;
+
+    if ((b != NULL) && (e != NULL) && (m != NULL) && (r != NULL)) {
+        err = cpkcc_sp_exptmod(b, e, 0, m, r, 0);
+    }
+    if (err == WC_HW_E) {
+        err = __real_sp_exptmod_nct(b, e, m, r);
+    }
+
+    return err;
+}
+
+#endif /* WOLFSSL_SP_CPKCC */
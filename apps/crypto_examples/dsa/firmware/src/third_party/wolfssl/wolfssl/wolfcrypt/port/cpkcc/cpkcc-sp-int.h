@@ -0,0 +1,84 @@
+/* cpkcc-sp-int.h
+ *
+ * This file is part of wolfSSL.
+ *
+ * wolfSSL is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation; either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * wolfSSL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1335, USA
+ */
+
+
+#ifndef CPKCC_SP_INT_H
+#define CPKCC_SP_INT_H
+
+#ifdef __cplusplus
+    extern "C" {
+#endif
+
+#include <wolfssl/wolfcrypt/settings.h>
+
+#ifdef WOLFSSL_SP_CPKCC
+
+#include <wolfssl/wolfcrypt/sp_int.h>
+
+/* Smallest modulus, in bits, handed to the CPKCC. Below it the cost of
+ * moving the operands to crypto RAM outweighs the multiplier and the
+ * operation stays in software. The CPKCC takes moduli up to 3072 bits. */
+#ifndef WOLFSSL_SP_CPKCC_MIN_BITS
+    #define WOLFSSL_SP_CPKCC_MIN_BITS   256
+#endif
+
+/* The hooks are bound at link time and sp_int.c is left as shipped: link
+ * with
+ *   -Wl,--wrap=sp_mod,--wrap=sp_mulmod,--wrap=sp_invmod,--wrap=sp_exptmod,
+ *   --wrap=sp_exptmod_ex,--wrap=sp_exptmod_nct
+ * so that calls from outside sp_int.c (ecc.c, rsa.c, dh.c, the application)
+ * reach the __wrap_ versions. Each one runs the operation on the CPKCC when
+ * it takes the operands and calls the __real_ software version otherwise.
+ * Calls made inside sp_int.c stay in software. */
+WOLFSSL_LOCAL int __wrap_sp_mod(const sp_int* a, const sp_int* m, sp_int* r);
+WOLFSSL_LOCAL int __wrap_sp_mulmod(const sp_int* a, const sp_int* b,
+    const sp_int* m, sp_int* r);
+WOLFSSL_LOCAL int __wrap_sp_invmod(const sp_int* a, const sp_int* m,
+    sp_int* r);
+WOLFSSL_LOCAL int __wrap_sp_exptmod_ex(const sp_int* b, const sp_int* e,
+    int digits, const sp_int* m, sp_int* r);
+WOLFSSL_LOCAL int __wrap_sp_exptmod(const sp_int* b, const sp_int* e,
+    const sp_int* m, sp_int* r);
+WOLFSSL_LOCAL int __wrap_sp_exptmod_nct(const sp_int* b, const sp_int* e,
+    const sp_int* m, sp_int* r);
+
+/* The software versions, resolved by the linker to the sp_int.c functions */
+WOLFSSL_LOCAL int __real_sp_mod(const sp_int* a, const sp_int* m, sp_int* r);
+WOLFSSL_LOCAL int __real_sp_mulmod(const sp_int* a, const sp_int* b,
+    const sp_int* m, sp_int* r);
+WOLFSSL_LOCAL int __real_sp_invmod(const sp_int* a, const sp_int* m,
+    sp_int* r);
+WOLFSSL_LOCAL int __real_sp_exptmod_ex(const sp_int* b, const sp_int* e,
+    int digits, const sp_int* m, sp_int* r);
+WOLFSSL_LOCAL int __real_sp_exptmod(const sp_int* b, const sp_int* e,
+    const sp_int* m, sp_int* r);
+WOLFSSL_LOCAL int __real_sp_exptmod_nct(const sp_int* b, const sp_int* e,
+    const sp_int* m, sp_int* r);
+
+/* Moves the threshold at run time. A value above 3072 keeps every operation
+ * in software, which gives the reference results and timings. */
+WOLFSSL_API void cpkcc_sp_set_min_bits(int bits);
+
+#endif /* WOLFSSL_SP_CPKCC */
+
+#ifdef __cplusplus
+    } /* extern "C" */
+#endif
+
+#endif /* CPKCC_SP_INT_H */
@@ -275,7 +275,8 @@ crypto_Hash_Status_E Crypto_Hash_Hw_Sha_Update(void *shaUpdateCtx,
     fill = blockSizeBytes - left;
     shaCtx->totalLen += dataLen;
 
-    if ((left & dataLen) >= fill)
+    /* Complete the block left over by the previous update */
+    if ((left != 0U) && (dataLen >= fill))
     {
         (void) memcpy((shaCtx->buffer + left), data, fill);
         
@@ -290,18 +291,15 @@ crypto_Hash_Status_E Crypto_Hash_Hw_Sha_Update(void *shaUpdateCtx,
 #pragma GCC diagnostic pop
         /* MISRA C-2012 deviation block end */
 
-        for (uint32_t x = 0; x < dataLen; x += blockSizeBytes)
-        {
-            DRV_CRYPTO_SHA_Update(localBuffer, blockSizeWords);
-            localBuffer += (uint32_t)blockSizeWords;
-        }
+        DRV_CRYPTO_SHA_Update(localBuffer, blockSizeWords);
         
         data += fill;
         dataLen -= fill;
         left = 0;
     }
 
-    if (dataLen >= blockSizeBytes)
+    /* Hash the whole blocks straight from the caller buffer */
+    while (dataLen >= blockSizeBytes)
     {
         /* MISRA C-2012 deviation block start */
         /* MISRA C-2012 Rule 11.3 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_3_DR_1 */
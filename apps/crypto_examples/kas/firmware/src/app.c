@@ -28,6 +28,9 @@
 // *****************************************************************************
 
 #include "app.h"
+#include "wolfssl/wolfcrypt/ecc.h"
+#include "crypto/wolfcrypt/crypto_common_wc_wrapper.h"
+#include "crypto/wolfcrypt/crypto_cryptocb_wc_wrapper.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -40,6 +43,44 @@
 uint8_t testsPassed;
 uint8_t testsFailed;
 
+#define APP_ECDH_LATENCY_ROUNDS    (10U)
+
+#define APP_KEY_HANDLE_ROUNDS      (10U)
+
+#define APP_KEYGEN_ROUNDS          (10U)
+
+#define APP_ECIES_ROUNDS           (5U)
+#define APP_ECIES_MSG_SIZE         (64U)
+
+/* Steps of a non-blocking shared secret run per slice, one slice standing for
+   one call of APP_Tasks */
+#define APP_NB_SLICE_STEPS         (8U)
+
+/* Token sealed by the ECIES test, with its KDF shared info and GCM header */
+static uint8_t eciesMsg[APP_ECIES_MSG_SIZE];
+static uint8_t eciesPlain[APP_ECIES_MSG_SIZE];
+static uint8_t eciesCipher[APP_ECIES_MSG_SIZE + CRYPTO_ECIES_OVERHEAD(CRYPTO_ECC_MAX_KEY_LENGTH)];
+static uint8_t eciesSharedInfo[] = "ECIES token v1";
+static uint8_t eciesAad[] = { 0x01, 0x00, 0x00, 0x40 };
+
+/* Peer key pair generated by wolfCrypt, sized for the largest curve */
+static uint8_t peerPriv[CRYPTO_ECC_MAX_KEY_LENGTH];
+static uint8_t peerPubl[(2U * CRYPTO_ECC_MAX_KEY_LENGTH) + 1U];
+
+#define APP_DH_ROUNDS              (3U)
+
+/* FFDHE key pairs and shared secrets of both sides, sized for ffdhe3072 */
+static uint8_t dhPriv[CRYPTO_KAS_DH_FFDHE3072_PRIV_SIZE];
+static uint8_t dhPubl[CRYPTO_KAS_DH_FFDHE3072_SIZE];
+static uint8_t dhSecret[CRYPTO_KAS_DH_FFDHE3072_SIZE];
+static uint8_t dhPeerPriv[CRYPTO_KAS_DH_FFDHE3072_PRIV_SIZE];
+static uint8_t dhPeerPubl[CRYPTO_KAS_DH_FFDHE3072_SIZE];
+static uint8_t dhPeerSecret[CRYPTO_KAS_DH_FFDHE3072_SIZE];
+
+/* wolfCrypt keys of the crypto callback test */
+static ecc_key cbPrivKey;
+static ecc_key cbPublKey;
+
 // *****************************************************************************
 /* Application Data
 
@@ -121,12 +162,744 @@ void GenerateSharedSecret (ECDH *ecdh)
     }
 }
 
+/*******************************************************************************
+  Function:
+    void ECDH_Ram_Latency (ECDH *ecdh)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDH_Ram_Latency (ECDH *ecdh)
+{
+    crypto_Kas_Status_E status = CRYPTO_KAS_SUCCESS;
+    uint32_t startTime = 0, endTime = 0;
+    double reloadTime, residentTime;
+    uint32_t i;
+
+    SYSTICK_TimerRestart();
+
+    /* Curve constants copied to crypto RAM for every operation */
+    startTime = SYSTICK_TimerCounterGet();
+    for (i = 0; (i < APP_ECDH_LATENCY_ROUNDS) && (status == CRYPTO_KAS_SUCCESS); i++)
+    {
+        DRV_CRYPTO_ECC_RamInvalidate();
+        status = Crypto_Kas_Ecdh_SharedSecret(ecdh->handler, ecdh->privKey,
+            ecdh->privKeySize, ecdh->publKey, ecdh->publKeySize,
+            ecdh->sharedSecret, ecdh->expectedSecretSize, ecdh->curveType,
+            SESSION_ID);
+    }
+    endTime = SYSTICK_TimerCounterGet();
+    reloadTime = (double)(startTime - endTime)/(SYSTICK_FREQ/1000U);
+
+    /* Curve constants left resident by the previous operation */
+    startTime = SYSTICK_TimerCounterGet();
+    for (i = 0; (i < APP_ECDH_LATENCY_ROUNDS) && (status == CRYPTO_KAS_SUCCESS); i++)
+    {
+        status = Crypto_Kas_Ecdh_SharedSecret(ecdh->handler, ecdh->privKey,
+            ecdh->privKeySize, ecdh->publKey, ecdh->publKeySize,
+            ecdh->sharedSecret, ecdh->expectedSecretSize, ecdh->curveType,
+            SESSION_ID);
+    }
+    endTime = SYSTICK_TimerCounterGet();
+    residentTime = (double)(startTime - endTime)/(SYSTICK_FREQ/1000U);
+
+    if ((status != CRYPTO_KAS_SUCCESS) ||
+        !CompareHexArray(ecdh->sharedSecret, ecdh->expectedSecret, ecdh->expectedSecretSize))
+    {
+        printf("Failed to create shared secret, status: %d\r\n", status);
+        testsFailed++;
+    }
+    else
+    {
+        printf("Reloaded per operation (ms): %f\r\n", reloadTime / APP_ECDH_LATENCY_ROUNDS);
+        printf("Resident per operation (ms): %f\r\n", residentTime / APP_ECDH_LATENCY_ROUNDS);
+        printf("Saved per operation (ms): %f\r\n",
+            (reloadTime - residentTime) / APP_ECDH_LATENCY_ROUNDS);
+        testsPassed++;
+    }
+}
+
+/* Agrees on a secret between the key pair of the context and a wolfCrypt
+ * peer, the secret of each side goes to sharedSecret and expectedSecret */
+static crypto_Kas_Status_E ECDH_Peer_Agree (ECDH *ecdh)
+{
+    crypto_Kas_Status_E status;
+
+    status = Crypto_Kas_Ecdh_KeyGen(CRYPTO_HANDLER_SW_WOLFCRYPT, peerPriv,
+        ecdh->privKeySize, peerPubl, ecdh->publKeySize, ecdh->curveType,
+        SESSION_ID);
+
+    if (status == CRYPTO_KAS_SUCCESS)
+    {
+        status = Crypto_Kas_Ecdh_SharedSecret(ecdh->handler, ecdh->privKey,
+            ecdh->privKeySize, peerPubl, ecdh->publKeySize, ecdh->sharedSecret,
+            ecdh->sharedSecretSize, ecdh->curveType, SESSION_ID);
+    }
+
+    if (status == CRYPTO_KAS_SUCCESS)
+    {
+        status = Crypto_Kas_Ecdh_SharedSecret(CRYPTO_HANDLER_SW_WOLFCRYPT, 
+            peerPriv, ecdh->privKeySize, ecdh->publKey, ecdh->publKeySize, 
+            ecdh->expectedSecret, ecdh->expectedSecretSize, ecdh->curveType, 
+            SESSION_ID);
+    }
+
+    (void) memset(peerPriv, 0, sizeof(peerPriv));
+
+    return status;
+}
+
+/*******************************************************************************
+  Function:
+    void ECDH_KeyGen_Test (ECDH *ecdh)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDH_KeyGen_Test (ECDH *ecdh)
+{
+    crypto_Kas_Status_E status = CRYPTO_KAS_SUCCESS;
+    uint32_t startTime = 0, endTime = 0;
+    double keyGenTime;
+    uint32_t i;
+
+    SYSTICK_TimerRestart();
+
+    startTime = SYSTICK_TimerCounterGet();
+    for (i = 0; (i < APP_KEYGEN_ROUNDS) && (status == CRYPTO_KAS_SUCCESS); i++)
+    {
+        status = Crypto_Kas_Ecdh_KeyGen(ecdh->handler, ecdh->privKey,
+            ecdh->privKeySize, ecdh->publKey, ecdh->publKeySize,
+            ecdh->curveType, SESSION_ID);
+    }
+    endTime = SYSTICK_TimerCounterGet();
+    keyGenTime = (double)(startTime - endTime)/(SYSTICK_FREQ/1000U);
+
+    if (status == CRYPTO_KAS_SUCCESS)
+    {
+        printf("Key generation average (ms): %f\r\n", keyGenTime / APP_KEYGEN_ROUNDS);
+
+        status = ECDH_Peer_Agree(ecdh);
+    }
+
+    (void) memset(ecdh->privKey, 0, ecdh->privKeySize);
+
+    if (status != CRYPTO_KAS_SUCCESS)
+    {
+        printf("Failed to generate or use key pair, status: %d\r\n", status);
+        testsFailed++;
+    }
+    else if (!CompareHexArray(ecdh->sharedSecret, ecdh->expectedSecret, 
+                              ecdh->expectedSecretSize))
+    {
+        printf("Shared secrets with the generated keys differ\r\n");
+        testsFailed++;
+    }
+    else
+    {
+        printf("Test successful\r\n");
+        testsPassed++;
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void ECDH_Pool_Test (ECDH *ecdh)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDH_Pool_Test (ECDH *ecdh)
+{
+    crypto_Kas_Status_E status = CRYPTO_KAS_SUCCESS;
+    uint32_t startTime = 0, endTime = 0;
+    double fillTime, pooledTime = 0, onDemandTime;
+    bool secretsMatch = true;
+    uint32_t pairs = 0;
+    uint32_t i;
+
+    if (Crypto_Ecc_Pool_Init(ecdh->curveType) != CRYPTO_ECC_POOL_SUCCESS)
+    {
+        printf("Curve not supported by the pool\r\n");
+        testsFailed++;
+        return;
+    }
+
+    /* What APP_Tasks does when idle, one pair per call */
+    SYSTICK_TimerRestart();
+    startTime = SYSTICK_TimerCounterGet();
+    while (Crypto_Ecc_Pool_Tasks() == CRYPTO_ECC_POOL_SUCCESS)
+    {
+        pairs++;
+    }
+    endTime = SYSTICK_TimerCounterGet();
+    fillTime = (double)(startTime - endTime)/(SYSTICK_FREQ/1000U);
+
+    if (pairs != CRYPTO_ECC_POOL_SIZE)
+    {
+        printf("Failed to fill the pool\r\n");
+        testsFailed++;
+        return;
+    }
+
+    /* Each key generation takes one pair, the agreement with a wolfCrypt peer
+     * runs out of the timing */
+    for (i = 0; (i < pairs) && (status == CRYPTO_KAS_SUCCESS) && secretsMatch; i++)
+    {
+        SYSTICK_TimerRestart();
+        startTime = SYSTICK_TimerCounterGet();
+        status = Crypto_Kas_Ecdh_KeyGen(ecdh->handler, ecdh->privKey,
+            ecdh->privKeySize, ecdh->publKey, ecdh->publKeySize,
+            ecdh->curveType, SESSION_ID);
+        endTime = SYSTICK_TimerCounterGet();
+        pooledTime += (double)(startTime - endTime)/(SYSTICK_FREQ/1000U);
+
+        if (status == CRYPTO_KAS_SUCCESS)
+        {
+            status = ECDH_Peer_Agree(ecdh);
+            secretsMatch = CompareHexArray(ecdh->sharedSecret, 
+                ecdh->expectedSecret, ecdh->expectedSecretSize);
+        }
+    }
+
+    /* The pool is empty now, the same key generations run in full */
+    SYSTICK_TimerRestart();
+    startTime = SYSTICK_TimerCounterGet();
+    for (i = 0; (i < pairs) && (status == CRYPTO_KAS_SUCCESS); i++)
+    {
+        status = Crypto_Kas_Ecdh_KeyGen(ecdh->handler, ecdh->privKey,
+            ecdh->privKeySize, ecdh->publKey, ecdh->publKeySize,
+            ecdh->curveType, SESSION_ID);
+    }
+    endTime = SYSTICK_TimerCounterGet();
+    onDemandTime = (double)(startTime - endTime)/(SYSTICK_FREQ/1000U);
+
+    (void) memset(ecdh->privKey, 0, ecdh->privKeySize);
+
+    if (status != CRYPTO_KAS_SUCCESS)
+    {
+        printf("Failed to generate or use key pair, status: %d\r\n", status);
+        testsFailed++;
+    }
+    else if (!secretsMatch)
+    {
+        printf("Shared secrets with the precomputed keys differ\r\n");
+        testsFailed++;
+    }
+    else
+    {
+        printf("Precomputation per pair (ms): %f\r\n", fillTime / pairs);
+        printf("Key generation from the pool average (ms): %f\r\n", pooledTime / pairs);
+        printf("Key generation on demand average (ms): %f\r\n", onDemandTime / pairs);
+        printf("Test successful\r\n");
+        testsPassed++;
+    }
+}
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Application Initialization and State Machine Functions
 // *****************************************************************************
 // *****************************************************************************
 
+/*******************************************************************************
+  Function:
+    void FFDHE_Test (crypto_HandlerType_E handler, crypto_Kas_DhGroup_E group,
+                     uint32_t primeSize, uint32_t privKeySize)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void FFDHE_Test (crypto_HandlerType_E handler, crypto_Kas_DhGroup_E group,
+                 uint32_t primeSize, uint32_t privKeySize)
+{
+    crypto_Kas_Status_E status = CRYPTO_KAS_SUCCESS;
+    crypto_HandlerType_E peerHandler;
+    uint32_t startTime = 0, endTime = 0;
+    double keyGenTime = 0, agreeTime = 0;
+    bool secretsMatch = false;
+    bool rejected = true;
+    uint32_t i;
+
+    /* The peer runs on the other handler */
+    peerHandler = (handler == CRYPTO_HANDLER_HW_INTERNAL) ? 
+        CRYPTO_HANDLER_SW_WOLFCRYPT : CRYPTO_HANDLER_HW_INTERNAL;
+
+    SYSTICK_TimerRestart();
+
+    startTime = SYSTICK_TimerCounterGet();
+    for (i = 0; (i < APP_DH_ROUNDS) && (status == CRYPTO_KAS_SUCCESS); i++)
+    {
+        status = Crypto_Kas_Dh_KeyGen(handler, dhPriv, privKeySize, dhPubl, 
+            primeSize, group, SESSION_ID);
+    }
+    endTime = SYSTICK_TimerCounterGet();
+    keyGenTime = (double)(startTime - endTime)/(SYSTICK_FREQ/1000U);
+
+    if (status == CRYPTO_KAS_SUCCESS)
+    {
+        status = Crypto_Kas_Dh_KeyGen(peerHandler, dhPeerPriv, privKeySize, 
+            dhPeerPubl, primeSize, group, SESSION_ID);
+    }
+
+    if (status == CRYPTO_KAS_SUCCESS)
+    {
+        SYSTICK_TimerRestart();
+
+        startTime = SYSTICK_TimerCounterGet();
+        for (i = 0; (i < APP_DH_ROUNDS) && (status == CRYPTO_KAS_SUCCESS); i++)
+        {
+            status = Crypto_Kas_Dh_SharedSecret(handler, dhPriv, privKeySize, 
+                dhPeerPubl, primeSize, dhSecret, primeSize, group, SESSION_ID);
+        }
+        endTime = SYSTICK_TimerCounterGet();
+        agreeTime = (double)(startTime - endTime)/(SYSTICK_FREQ/1000U);
+    }
+
+    if (status == CRYPTO_KAS_SUCCESS)
+    {
+        status = Crypto_Kas_Dh_SharedSecret(peerHandler, dhPeerPriv, 
+            privKeySize, dhPubl, primeSize, dhPeerSecret, primeSize, group, 
+            SESSION_ID);
+    }
+
+    secretsMatch = CompareHexArray(dhSecret, dhPeerSecret, primeSize);
+
+    /* Peer values 0, 1 and above p must be refused */
+    for (i = 0; (i < 3U) && (status == CRYPTO_KAS_SUCCESS); i++)
+    {
+        (void) memset(dhPeerPubl, (i == 2U) ? 0xFF : 0x00, primeSize);
+        if (i == 1U)
+        {
+            dhPeerPubl[primeSize - 1U] = 0x01U;
+        }
+
+        if (Crypto_Kas_Dh_SharedSecret(handler, dhPriv, privKeySize, 
+                dhPeerPubl, primeSize, dhSecret, primeSize, group, 
+                SESSION_ID) != CRYPTO_KAS_ERROR_PUBKEY)
+        {
+            rejected = false;
+        }
+    }
+
+    (void) memset(dhPriv, 0, sizeof(dhPriv));
+    (void) memset(dhPeerPriv, 0, sizeof(dhPeerPriv));
+
+    if (status != CRYPTO_KAS_SUCCESS)
+    {
+        printf("Failed to generate or use key pair, status: %d\r\n", status);
+        testsFailed++;
+    }
+    else if (!secretsMatch)
+    {
+        printf("Shared secrets of both handlers differ\r\n");
+        testsFailed++;
+    }
+    else if (!rejected)
+    {
+        printf("Invalid peer public value accepted\r\n");
+        testsFailed++;
+    }
+    else
+    {
+        printf("Key generation average (ms): %f\r\n", keyGenTime / APP_DH_ROUNDS);
+        printf("Key agreement average (ms): %f\r\n", agreeTime / APP_DH_ROUNDS);
+        printf("Test successful\r\n");
+        testsPassed++;
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void ECDH_CryptoCb_Test (ECDH *ecdh)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDH_CryptoCb_Test (ECDH *ecdh)
+{
+    uint32_t startTime = 0, endTime = 0;
+    double secretTime[2] = { 0, 0 };
+    word32 secretLen = 0;
+    uint32_t hwCount = 0;
+    uint32_t swCount = 0;
+    bool registered = false;
+    bool keysInit = false;
+    bool secretsMatch = true;
+    int curveId = Crypto_Common_Wc_Ecc_GetWcCurveId(ecdh->curveType);
+    int devId;
+    int ret = 0;
+    uint32_t i;
+
+    SYSTICK_TimerRestart();
+
+    /* Software first, then through the callback: only the keys set up with 
+       its device ID reach the CPKCC */
+    for (i = 0; (i < 2U) && (ret == 0); i++)
+    {
+        devId = (i == 0U) ? INVALID_DEVID : CRYPTO_CRYPTOCB_WC_DEVID;
+        if (i == 1U)
+        {
+            wc_ecc_free(&cbPrivKey);
+            wc_ecc_free(&cbPublKey);
+            keysInit = false;
+            ret = Crypto_CryptoCb_Wc_Init();
+            registered = (ret == 0);
+        }
+        if (ret == 0)
+        {
+            ret = wc_ecc_init_ex(&cbPrivKey, NULL, devId);
+        }
+        if (ret == 0)
+        {
+            ret = wc_ecc_init_ex(&cbPublKey, NULL, devId);
+            if (ret != 0)
+            {
+                wc_ecc_free(&cbPrivKey);
+            }
+            keysInit = (ret == 0);
+        }
+        if (ret == 0)
+        {
+            ret = wc_ecc_import_private_key_ex(ecdh->privKey, 
+                (word32)ecdh->privKeySize, NULL, 0, &cbPrivKey, curveId);
+        }
+        if (ret == 0)
+        {
+            ret = wc_ecc_import_x963_ex(ecdh->publKey, (word32)ecdh->publKeySize, 
+                &cbPublKey, curveId);
+        }
+        if (ret == 0)
+        {
+            (void) memset(ecdh->sharedSecret, 0, ecdh->sharedSecretSize);
+            secretLen = (word32)ecdh->sharedSecretSize;
+
+            startTime = SYSTICK_TimerCounterGet();
+            ret = wc_ecc_shared_secret(&cbPrivKey, &cbPublKey, ecdh->sharedSecret,
+                &secretLen);
+            endTime = SYSTICK_TimerCounterGet();
+            secretTime[i] = (double)(startTime - endTime)/(SYSTICK_FREQ/1000U);
+
+            secretsMatch = secretsMatch && (secretLen == ecdh->expectedSecretSize) &&
+                CompareHexArray(ecdh->sharedSecret, ecdh->expectedSecret, 
+                    ecdh->expectedSecretSize);
+        }
+    }
+
+    if (registered)
+    {
+        Crypto_CryptoCb_Wc_GetCounts(&hwCount, &swCount);
+        Crypto_CryptoCb_Wc_Deinit();
+    }
+
+    if (ret != 0)
+    {
+        printf("wolfCrypt shared secret failed, status: %d\r\n", ret);
+        testsFailed++;
+    }
+    else if (!secretsMatch)
+    {
+        printf("Test unsuccessful\r\n");
+        testsFailed++;
+    }
+    else if (hwCount == 0U)
+    {
+        printf("Shared secret left to software\r\n");
+        testsFailed++;
+    }
+    else
+    {
+        printf("Time elapsed (ms): wolfCrypt %f, callback %f\r\n", 
+            secretTime[0], secretTime[1]);
+        printf("Test successful\r\n");
+        testsPassed++;
+    }
+
+    if (keysInit)
+    {
+        wc_ecc_free(&cbPrivKey);
+        wc_ecc_free(&cbPublKey);
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void ECDH_KeyHandle_Test (ECDH *ecdh)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDH_KeyHandle_Test (ECDH *ecdh)
+{
+    crypto_Kas_Status_E status = CRYPTO_KAS_SUCCESS;
+    crypto_Key_Status_E keyStatus;
+    crypto_Key_Handle_T handle = CRYPTO_KEY_HANDLE_INVALID;
+    uint32_t startTime = 0, endTime = 0;
+    double callTime, importTime, handleTime;
+    uint32_t i;
+
+    SYSTICK_TimerRestart();
+
+    /* Private key passed on every call */
+    startTime = SYSTICK_TimerCounterGet();
+    for (i = 0; (i < APP_KEY_HANDLE_ROUNDS) && (status == CRYPTO_KAS_SUCCESS); i++)
+    {
+        status = Crypto_Kas_Ecdh_SharedSecret(ecdh->handler, ecdh->privKey,
+            ecdh->privKeySize, ecdh->publKey, ecdh->publKeySize,
+            ecdh->sharedSecret, ecdh->expectedSecretSize, ecdh->curveType,
+            SESSION_ID);
+    }
+    endTime = SYSTICK_TimerCounterGet();
+    callTime = (double)(startTime - endTime)/(SYSTICK_FREQ/1000U);
+
+    /* Private key imported once */
+    startTime = SYSTICK_TimerCounterGet();
+    keyStatus = Crypto_Key_Import(ecdh->handler, ecdh->privKey, ecdh->privKeySize,
+        NULL, 0, ecdh->curveType, &handle);
+    endTime = SYSTICK_TimerCounterGet();
+    importTime = (double)(startTime - endTime)/(SYSTICK_FREQ/1000U);
+
+    if ((status == CRYPTO_KAS_SUCCESS) && (keyStatus != CRYPTO_KEY_SUCCESS))
+    {
+        status = CRYPTO_KAS_ERROR_PRIVKEY;
+    }
+
+    (void) memset(ecdh->sharedSecret, 0, ecdh->sharedSecretSize);
+
+    startTime = SYSTICK_TimerCounterGet();
+    for (i = 0; (i < APP_KEY_HANDLE_ROUNDS) && (status == CRYPTO_KAS_SUCCESS); i++)
+    {
+        status = Crypto_Kas_Ecdh_SharedSecretWithKey(handle, ecdh->publKey, 
+            ecdh->publKeySize, ecdh->sharedSecret, ecdh->expectedSecretSize,
+            SESSION_ID);
+    }
+    endTime = SYSTICK_TimerCounterGet();
+    handleTime = (double)(startTime - endTime)/(SYSTICK_FREQ/1000U);
+
+    keyStatus = Crypto_Key_Destroy(handle);
+
+    if ((status != CRYPTO_KAS_SUCCESS) ||
+        !CompareHexArray(ecdh->sharedSecret, ecdh->expectedSecret, ecdh->expectedSecretSize))
+    {
+        printf("Failed to create shared secret, status: %d\r\n", status);
+        testsFailed++;
+    }
+    else if ((keyStatus != CRYPTO_KEY_SUCCESS) ||
+        (Crypto_Kas_Ecdh_SharedSecretWithKey(handle, ecdh->publKey, 
+            ecdh->publKeySize, ecdh->sharedSecret, ecdh->expectedSecretSize,
+            SESSION_ID) != CRYPTO_KAS_ERROR_PRIVKEY))
+    {
+        printf("Handle still usable after destroy\r\n");
+        testsFailed++;
+    }
+    else
+    {
+        printf("Import (ms): %f\r\n", importTime);
+        printf("Per call, per operation (ms): %f\r\n", callTime / APP_KEY_HANDLE_ROUNDS);
+        printf("Handle, per operation (ms): %f\r\n", handleTime / APP_KEY_HANDLE_ROUNDS);
+        printf("Test successful\r\n");
+        testsPassed++;
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void ECIES_Test (ECDH *ecdh)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECIES_Test (ECDH *ecdh)
+{
+    crypto_Ecies_Status_E status = CRYPTO_ECIES_SUCCESS;
+    crypto_Ecies_Status_E tamperStatus;
+    crypto_HandlerType_E otherHandler = (ecdh->handler == CRYPTO_HANDLER_HW_INTERNAL) ?
+        CRYPTO_HANDLER_SW_WOLFCRYPT : CRYPTO_HANDLER_HW_INTERNAL;
+    uint32_t cipherLen = APP_ECIES_MSG_SIZE + CRYPTO_ECIES_OVERHEAD(ecdh->privKeySize);
+    uint32_t startTime = 0, endTime = 0;
+    double encTime = 0, decTime = 0;
+    uint32_t hwCount = 0;
+    uint32_t swCount = 0;
+    bool registered;
+    bool match = true;
+    uint32_t i;
+
+    for (i = 0; i < APP_ECIES_MSG_SIZE; i++)
+    {
+        eciesMsg[i] = (uint8_t)i;
+    }
+
+    /* The hardware handler hashes and seals on the SHA and AES engines 
+       through the crypto callback */
+    registered = (Crypto_CryptoCb_Wc_Init() == 0);
+
+    SYSTICK_TimerRestart();
+
+    /* Sealed for the known answer public key, opened with its private key */
+    for (i = 0; (i < APP_ECIES_ROUNDS) && (status == CRYPTO_ECIES_SUCCESS) && match; i++)
+    {
+        startTime = SYSTICK_TimerCounterGet();
+        status = Crypto_Ecies_Encrypt(ecdh->handler, ecdh->curveType, ecdh->publKey,
+            ecdh->publKeySize, eciesSharedInfo, sizeof(eciesSharedInfo) - 1U,
+            eciesAad, sizeof(eciesAad), eciesMsg, APP_ECIES_MSG_SIZE, 
+            eciesCipher, cipherLen);
+        endTime = SYSTICK_TimerCounterGet();
+        encTime += (double)(startTime - endTime)/(SYSTICK_FREQ/1000U);
+
+        if (status == CRYPTO_ECIES_SUCCESS)
+        {
+            (void) memset(eciesPlain, 0, sizeof(eciesPlain));
+            startTime = SYSTICK_TimerCounterGet();
+            status = Crypto_Ecies_Decrypt(ecdh->handler, ecdh->curveType, 
+                ecdh->privKey, ecdh->privKeySize, eciesSharedInfo, 
+                sizeof(eciesSharedInfo) - 1U, eciesAad, sizeof(eciesAad), 
+                eciesCipher, cipherLen, eciesPlain, sizeof(eciesPlain));
+            endTime = SYSTICK_TimerCounterGet();
+            decTime += (double)(startTime - endTime)/(SYSTICK_FREQ/1000U);
+            match = CompareHexArray(eciesPlain, eciesMsg, APP_ECIES_MSG_SIZE);
+        }
+    }
+
+    if (registered)
+    {
+        Crypto_CryptoCb_Wc_GetCounts(&hwCount, &swCount);
+    }
+
+    /* The other handler must open it too */
+    if ((status == CRYPTO_ECIES_SUCCESS) && match)
+    {
+        (void) memset(eciesPlain, 0, sizeof(eciesPlain));
+        status = Crypto_Ecies_Decrypt(otherHandler, ecdh->curveType, 
+            ecdh->privKey, ecdh->privKeySize, eciesSharedInfo, 
+            sizeof(eciesSharedInfo) - 1U, eciesAad, sizeof(eciesAad), 
+            eciesCipher, cipherLen, eciesPlain, sizeof(eciesPlain));
+        match = CompareHexArray(eciesPlain, eciesMsg, APP_ECIES_MSG_SIZE);
+    }
+
+    /* A flipped tag bit must be rejected */
+    eciesCipher[cipherLen - 1U] ^= 0x01U;
+    tamperStatus = Crypto_Ecies_Decrypt(ecdh->handler, ecdh->curveType, 
+        ecdh->privKey, ecdh->privKeySize, eciesSharedInfo, 
+        sizeof(eciesSharedInfo) - 1U, eciesAad, sizeof(eciesAad), 
+        eciesCipher, cipherLen, eciesPlain, sizeof(eciesPlain));
+
+    if (registered)
+    {
+        Crypto_CryptoCb_Wc_Deinit();
+    }
+
+    if (status != CRYPTO_ECIES_SUCCESS)
+    {
+        printf("ECIES failed, status: %d\r\n", status);
+        testsFailed++;
+    }
+    else if ((ecdh->handler == CRYPTO_HANDLER_HW_INTERNAL) && (hwCount == 0U))
+    {
+        printf("KDF and AES-GCM left to software\r\n");
+        testsFailed++;
+    }
+    else if (!match)
+    {
+        printf("Decrypted message mismatch\r\n");
+        testsFailed++;
+    }
+    else if (tamperStatus != CRYPTO_ECIES_ERROR_AUTH)
+    {
+        printf("Tampered ciphertext not rejected, status: %d\r\n", tamperStatus);
+        testsFailed++;
+    }
+    else
+    {
+        printf("%d byte message, per operation (ms): encrypt %f, decrypt %f\r\n",
+            (int)APP_ECIES_MSG_SIZE, encTime / APP_ECIES_ROUNDS, 
+            decTime / APP_ECIES_ROUNDS);
+        printf("Callbacks on the engines: %d, left to software: %d\r\n", 
+            (int)hwCount, (int)swCount);
+        printf("Test successful\r\n");
+        testsPassed++;
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void ECDH_Nb_Test (ECDH *ecdh)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDH_Nb_Test (ECDH *ecdh)
+{
+    crypto_Ecc_Nb_Status_E status;
+    crypto_Kas_Status_E blockStatus = CRYPTO_KAS_SUCCESS;
+    uint32_t startTime = 0, endTime = 0;
+    double sliceTime, worstTime, totalTime, blockTime = 0;
+    uint32_t slices = 0;
+
+    (void) memset(ecdh->sharedSecret, 0, ecdh->sharedSecretSize);
+
+    SYSTICK_TimerRestart();
+
+    /* One call of Crypto_Ecc_Nb_Continue per slice, the start call included
+       in the worst slice */
+    startTime = SYSTICK_TimerCounterGet();
+    status = Crypto_Ecc_Nb_EcdhStart(ecdh->handler, ecdh->curveType, 
+        ecdh->privKey, ecdh->privKeySize, ecdh->publKey, ecdh->publKeySize,
+        ecdh->sharedSecret, ecdh->expectedSecretSize);
+    endTime = SYSTICK_TimerCounterGet();
+    worstTime = (double)(startTime - endTime)/(SYSTICK_FREQ/1000U);
+    totalTime = worstTime;
+
+    while (status == CRYPTO_ECC_NB_IN_PROGRESS)
+    {
+        startTime = SYSTICK_TimerCounterGet();
+        status = Crypto_Ecc_Nb_Continue(APP_NB_SLICE_STEPS);
+        endTime = SYSTICK_TimerCounterGet();
+        sliceTime = (double)(startTime - endTime)/(SYSTICK_FREQ/1000U);
+        totalTime += sliceTime;
+        slices++;
+        if (sliceTime > worstTime)
+        {
+            worstTime = sliceTime;
+        }
+    }
+
+    /* Reference: the blocking call on the same handler */
+    if ((status == CRYPTO_ECC_NB_SUCCESS) &&
+        CompareHexArray(ecdh->sharedSecret, ecdh->expectedSecret, ecdh->expectedSecretSize))
+    {
+        startTime = SYSTICK_TimerCounterGet();
+        blockStatus = Crypto_Kas_Ecdh_SharedSecret(ecdh->handler, ecdh->privKey,
+            ecdh->privKeySize, ecdh->publKey, ecdh->publKeySize,
+            ecdh->sharedSecret, ecdh->expectedSecretSize, ecdh->curveType,
+            SESSION_ID);
+        endTime = SYSTICK_TimerCounterGet();
+        blockTime = (double)(startTime - endTime)/(SYSTICK_FREQ/1000U);
+    }
+
+    if ((status != CRYPTO_ECC_NB_SUCCESS) || (blockStatus != CRYPTO_KAS_SUCCESS) ||
+        !CompareHexArray(ecdh->sharedSecret, ecdh->expectedSecret, ecdh->expectedSecretSize))
+    {
+        printf("Failed to create shared secret, status: %d / %d\r\n", status, blockStatus);
+        testsFailed++;
+    }
+    else
+    {
+        printf("%d steps per slice, %d slices\r\n", (int)APP_NB_SLICE_STEPS, (int)slices);
+        printf("Worst slice (ms): %f\r\n", worstTime);
+        printf("Total, blocking (ms): %f, %f\r\n", totalTime, blockTime);
+        printf("Test successful\r\n");
+        testsPassed++;
+    }
+}
+
 /*******************************************************************************
   Function:
     void APP_Initialize ( void )
@@ -141,6 +914,9 @@ void APP_Initialize ( void )
     appData.state = APP_STATE_INIT;
 
     appData.isTestedECDH = false;
+
+    /* CPKCL self test runs once here, ECC operations use the cached result */
+    (void) DRV_CRYPTO_ECC_InitCpkcl();
 }
 
 /******************************************************************************
@@ -193,6 +969,33 @@ void APP_Tasks ( void )
 
                 printf("\r\n-----------ECDH SECP384 wolfCrypt Wrapper------------\r\n");
                 SECP384R1_Test(CRYPTO_HANDLER_SW_WOLFCRYPT);
+
+                printf("\r\n-----------ECDH Crypto RAM Latency-------------\r\n");
+                ECDH_Ram_Benchmark();
+                
+                printf("\r\n-----------ECDH Key Generation-------------\r\n");
+                ECDH_KeyGen_Benchmark();
+
+                printf("\r\n-----------ECDH Ephemeral Key Precomputation-------------\r\n");
+                ECDH_Pool_Benchmark();
+
+                printf("\r\n-----------Finite Field Diffie-Hellman-------------\r\n");
+                FFDHE_Benchmark();
+
+                printf("\r\n-----------ECDH Binary Curves-------------\r\n");
+                ECDH_Binary_Benchmark();
+
+                printf("\r\n-----------ECDH wolfCrypt Crypto Callback-------------\r\n");
+                ECDH_CryptoCb_Benchmark();
+
+                printf("\r\n-----------ECDH Key Handles-------------\r\n");
+                ECDH_KeyHandle_Benchmark();
+
+                printf("\r\n-----------ECIES ECDH, X9.63 KDF and AES-GCM-------------\r\n");
+                ECIES_Benchmark();
+
+                printf("\r\n-----------Non-blocking ECDH-------------\r\n");
+                ECDH_Nb_Benchmark();
                                 
                 appData.isTestedECDH = true;
 
@@ -202,7 +1005,11 @@ void APP_Tasks ( void )
                 
                 SYSTICK_TimerStop();
             }
-            
+            else
+            {
+                /* Idle, precompute the next ephemeral key pair */
+                (void) Crypto_Ecc_Pool_Tasks();
+            }
 
             break;
         }
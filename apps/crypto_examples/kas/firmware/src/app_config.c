@@ -33,6 +33,15 @@ uint8_t sharedSecret_SECP256R1[32];
 
 uint8_t sharedSecret_SECP384R1[48];
 
+/* Generated key pairs and their shared secrets, sized for the largest curve */
+uint8_t keyGenPriv[CRYPTO_ECC_MAX_KEY_LENGTH];
+
+uint8_t keyGenPubl[(2 * CRYPTO_ECC_MAX_KEY_LENGTH) + 1];
+
+uint8_t keyGenSecret[CRYPTO_ECC_MAX_KEY_LENGTH];
+
+uint8_t keyGenPeerSecret[CRYPTO_ECC_MAX_KEY_LENGTH];
+
 // *****************************************************************************
 /* NIST Test Vectors
 
@@ -122,6 +131,197 @@ uint8_t Secret_SECP384R1[48] = {
     0x9C, 0xF5, 0xD4, 0xA2, 0x70, 0xF5, 0x97, 0x46
 };
 
+// *****************************************************************************
+/* Degenerate Private Keys
+
+  Summary:
+    secp256r1 private keys whose sliced multiplication meets equal or 
+    opposite points.
+
+  Description:
+    The sliced k*P scans k + n or k + 2n and only meets P or -P on its last
+    two bits, for k in [1, 5] and k = n - 2 or n - 1. These keys run each
+    case with the peer key Publ_SECP256R1, the shared secrets are the x 
+    coordinates of k*Q.
+*/
+
+uint8_t Priv_Degenerate_SECP256R1[4][32] = {
+    //1: -Q + Q one bit before the end, then Q copied
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+    },
+    //2: Q + Q in the copy of a zero bit
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02
+    },
+    //4: Q + Q in the accumulator
+    {
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04
+    },
+    //n - 1: Q - Q in the copy of a zero bit
+    {
+        0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xbc, 0xe6, 0xfa, 0xad, 0xa7, 0x17, 0x9e, 0x84,
+        0xf3, 0xb9, 0xca, 0xc2, 0xfc, 0x63, 0x25, 0x50
+    }
+};
+
+uint8_t Secret_Degenerate_SECP256R1[4][32] = {
+    {
+        0x41, 0x19, 0x2d, 0x28, 0x13, 0xe7, 0x95, 0x61,
+        0xe6, 0xa1, 0xd6, 0xf5, 0x3c, 0x8b, 0xc1, 0xa4,
+        0x33, 0xa1, 0x99, 0xc8, 0x35, 0xe1, 0x41, 0xb0,
+        0x5a, 0x74, 0xa9, 0x7b, 0x0f, 0xae, 0xb9, 0x22
+    },
+    {
+        0xe8, 0xe3, 0x48, 0x22, 0x67, 0x5d, 0x8b, 0x3f,
+        0x45, 0x53, 0x24, 0x76, 0xed, 0xd0, 0x27, 0x37,
+        0x37, 0xff, 0xfd, 0x41, 0xa4, 0xb4, 0x25, 0x4d,
+        0x64, 0x50, 0x83, 0x85, 0xc7, 0x20, 0x36, 0x72
+    },
+    {
+        0xa3, 0x38, 0x1e, 0xcc, 0x58, 0x21, 0x7e, 0xbb,
+        0x00, 0x7c, 0x42, 0x5b, 0xa7, 0x3d, 0xde, 0x2c,
+        0x6f, 0xaa, 0x97, 0xe3, 0xac, 0xc5, 0x0d, 0x54,
+        0x9a, 0xf2, 0x95, 0x19, 0x5f, 0x67, 0x16, 0x20
+    },
+    {
+        0x41, 0x19, 0x2d, 0x28, 0x13, 0xe7, 0x95, 0x61,
+        0xe6, 0xa1, 0xd6, 0xf5, 0x3c, 0x8b, 0xc1, 0xa4,
+        0x33, 0xa1, 0x99, 0xc8, 0x35, 0xe1, 0x41, 0xb0,
+        0x5a, 0x74, 0xa9, 0x7b, 0x0f, 0xae, 0xb9, 0x22
+    }
+};
+
+// *****************************************************************************
+/* Binary Curve Test Vectors
+
+  Summary:
+    ECDH private keys, peer public keys and shared secrets on sect233k1,
+    sect233r1, sect283k1 and sect283r1.
+
+  Description:
+    The shared secrets were computed offline, wolfCrypt has no binary curves
+    to check them against. They only serve the binary curve tests.
+*/
+
+uint8_t Priv_SECT233K1[30] = {
+    0x00, 0x38, 0xd9, 0xdf, 0x28, 0xa0, 0x19, 0x03,
+    0xfa, 0xbc, 0x9a, 0x42, 0x75, 0x09, 0x33, 0xbe,
+    0x15, 0x0c, 0xdb, 0x53, 0x1c, 0xcb, 0x07, 0x9c,
+    0x2b, 0xc3, 0x43, 0x84, 0x7b, 0x88
+};
+
+uint8_t Publ_SECT233K1[61] = {
+    0x04, 0x00, 0x79, 0x96, 0xb0, 0xab, 0x7c, 0xc7,
+    0xde, 0xe2, 0x60, 0xb7, 0xf6, 0x7f, 0x0b, 0x60,
+    0x74, 0x09, 0xc5, 0x72, 0xbe, 0x8f, 0x5f, 0xb9,
+    0xf9, 0xaa, 0x37, 0x71, 0x30, 0xf7, 0xa1, 0x01,
+    0x5d, 0xa9, 0xb9, 0x9e, 0x8f, 0xe3, 0xc0, 0xb6,
+    0x68, 0x92, 0xc1, 0x8e, 0xc3, 0x0c, 0xf2, 0x21,
+    0x16, 0xd3, 0x38, 0xd2, 0x55, 0x71, 0x5a, 0xd2,
+    0x1a, 0xe4, 0x2d, 0x21, 0x4c
+};
+
+uint8_t Secret_SECT233K1[30] = {
+    0x00, 0xc6, 0x3e, 0x1e, 0x81, 0x75, 0x99, 0xb1,
+    0x13, 0x0f, 0xb0, 0x18, 0x2c, 0xd0, 0xc1, 0xd0,
+    0x7f, 0x15, 0xc6, 0xf8, 0x66, 0x31, 0x1a, 0xae,
+    0x9c, 0xa7, 0x86, 0x14, 0xec, 0x59
+};
+
+uint8_t Priv_SECT233R1[30] = {
+    0x00, 0x10, 0x55, 0xc4, 0xcf, 0x70, 0x2b, 0x28,
+    0x29, 0x4a, 0x0f, 0x6a, 0x10, 0x9c, 0x7f, 0xcc,
+    0xa5, 0xc3, 0xb0, 0x1a, 0xa7, 0xa8, 0xec, 0x54,
+    0x36, 0x1f, 0xda, 0x3f, 0x29, 0x61
+};
+
+uint8_t Publ_SECT233R1[61] = {
+    0x04, 0x01, 0x84, 0xcd, 0xc0, 0x2c, 0x18, 0x6a,
+    0x11, 0x56, 0xd6, 0xbe, 0xab, 0x33, 0x60, 0x39,
+    0x95, 0x0d, 0x0a, 0x9f, 0xd1, 0x85, 0x9e, 0xc2,
+    0x4a, 0xf3, 0x34, 0x66, 0x03, 0x4a, 0x80, 0x00,
+    0x43, 0xa3, 0xaa, 0xd6, 0xb3, 0x3a, 0x20, 0xe0,
+    0x06, 0x8d, 0xc5, 0x72, 0xc2, 0x6a, 0x53, 0xaf,
+    0x20, 0x87, 0xfa, 0x0d, 0xaa, 0xa1, 0x08, 0x64,
+    0x2e, 0x69, 0x72, 0x71, 0x2a
+};
+
+uint8_t Secret_SECT233R1[30] = {
+    0x01, 0x6a, 0x0c, 0x75, 0x2d, 0xbf, 0xf3, 0x24,
+    0xc7, 0xbf, 0xfb, 0x1b, 0x3e, 0x5d, 0x61, 0x60,
+    0x92, 0xb5, 0xf2, 0x18, 0x70, 0xe0, 0x29, 0xd9,
+    0xd6, 0x99, 0x8a, 0xce, 0xe2, 0x44
+};
+
+uint8_t Priv_SECT283K1[36] = {
+    0x01, 0xa6, 0xdb, 0x18, 0x13, 0x95, 0x5f, 0x07,
+    0x49, 0xf0, 0xaa, 0xe5, 0xea, 0x84, 0x58, 0xe3,
+    0x0a, 0xc1, 0xe4, 0x48, 0x85, 0x2e, 0x36, 0x9c,
+    0x87, 0x30, 0x5f, 0x80, 0x65, 0x89, 0xc2, 0x72,
+    0x02, 0x54, 0x05, 0x29
+};
+
+uint8_t Publ_SECT283K1[73] = {
+    0x04, 0x07, 0x0e, 0x49, 0x97, 0x1a, 0xe0, 0x23,
+    0xe2, 0xe4, 0xed, 0xe1, 0xca, 0xed, 0xe2, 0x3d,
+    0xc1, 0x63, 0xf5, 0xb1, 0x79, 0x4d, 0xfd, 0x4d,
+    0x54, 0x9d, 0x12, 0x50, 0x52, 0x70, 0xca, 0x6d,
+    0x57, 0x1f, 0x30, 0x10, 0xa6, 0x01, 0xeb, 0xb9,
+    0x69, 0x11, 0xf7, 0x4c, 0x71, 0x46, 0x32, 0x20,
+    0xfd, 0x28, 0xcb, 0x9e, 0xc5, 0xd9, 0xda, 0x1a,
+    0x5a, 0x6a, 0xbd, 0xce, 0x0e, 0x98, 0x8f, 0x5d,
+    0x7d, 0x5b, 0x8a, 0x94, 0x3a, 0x8e, 0xa3, 0xff,
+    0x8a
+};
+
+uint8_t Secret_SECT283K1[36] = {
+    0x06, 0xf0, 0xd3, 0xd0, 0x05, 0x45, 0x3c, 0x4f,
+    0x31, 0x59, 0x91, 0x8c, 0x79, 0x4b, 0xef, 0x0f,
+    0xaf, 0xd3, 0x2f, 0x57, 0xd6, 0xa2, 0x6a, 0xd1,
+    0xd1, 0x8a, 0x19, 0xd4, 0xe2, 0xaa, 0x42, 0xcd,
+    0x8d, 0x3f, 0x17, 0xa3
+};
+
+uint8_t Priv_SECT283R1[36] = {
+    0x02, 0x97, 0xa3, 0x14, 0x3c, 0x4f, 0x41, 0x0c,
+    0x07, 0x19, 0x1a, 0x7a, 0xf2, 0xbf, 0x7c, 0x1b,
+    0xbb, 0xd8, 0xd9, 0xfe, 0x8e, 0xa4, 0x73, 0xc6,
+    0x33, 0x68, 0x9b, 0xe1, 0xb6, 0x37, 0x5c, 0x4b,
+    0xc3, 0x5d, 0xe5, 0xfb
+};
+
+uint8_t Publ_SECT283R1[73] = {
+    0x04, 0x03, 0x7a, 0x37, 0xac, 0xa0, 0x85, 0x29,
+    0xed, 0x11, 0x63, 0x18, 0x33, 0x7b, 0x7c, 0xf4,
+    0x76, 0xc5, 0x56, 0x91, 0xb5, 0xda, 0x95, 0x26,
+    0x84, 0x3e, 0x7c, 0x56, 0xbd, 0xdc, 0xfa, 0xfe,
+    0x16, 0xd5, 0xf8, 0x73, 0x2d, 0x02, 0xbd, 0x3a,
+    0x62, 0x6b, 0xaa, 0xa4, 0x28, 0x9b, 0x1f, 0x8f,
+    0xf8, 0xcb, 0xe0, 0xe8, 0x86, 0xe5, 0x9d, 0x33,
+    0xeb, 0xd2, 0xbb, 0xe0, 0xd0, 0x03, 0x2b, 0x79,
+    0xa8, 0x38, 0xc1, 0x82, 0xe6, 0xc0, 0x37, 0x5f,
+    0xcc
+};
+
+uint8_t Secret_SECT283R1[36] = {
+    0x03, 0xe6, 0x09, 0xc9, 0x62, 0x62, 0xb3, 0x22,
+    0x75, 0x35, 0x99, 0xdb, 0x15, 0x4f, 0xb4, 0x58,
+    0x0b, 0x6f, 0xf9, 0x19, 0xb6, 0x7b, 0x72, 0x7e,
+    0xe1, 0x07, 0xf7, 0x10, 0xd6, 0xda, 0x78, 0xf5,
+    0xfc, 0x27, 0x95, 0x21
+};
 
 /* ************************************************************************** */
 /* ************************************************************************** */
@@ -155,23 +355,12 @@ void SECP256R1_Test (crypto_HandlerType_E cryptoHandler)
     printf("\r\nsecp256r1 with Uncompressed Key\r\n");
     GenerateSharedSecret(&secp256r1);
   
-  // wolfCrypt wrapper supports compressed key
-  if (secp256r1.handler == CRYPTO_HANDLER_SW_WOLFCRYPT)
-  {
-    secp256r1.handler            = CRYPTO_HANDLER_SW_WOLFCRYPT;
-    secp256r1.curveType          = CRYPTO_ECC_CURVE_SECP256R1;
-    secp256r1.privKey            = Priv_SECP256R1;
-    secp256r1.privKeySize        = sizeof(Priv_SECP256R1);
+    // Both handlers take compressed keys, the hardware computes Y on the CPKCC
     secp256r1.publKey            = Pub1_SEC256R1_Compressed;
     secp256r1.publKeySize        = sizeof(Pub1_SEC256R1_Compressed);
-    secp256r1.sharedSecret       = sharedSecret_SECP256R1;
-    secp256r1.sharedSecretSize   = sizeof(sharedSecret_SECP256R1);
-    secp256r1.expectedSecret     = Secret_SECP256R1;
-    secp256r1.expectedSecretSize = sizeof(Secret_SECP256R1);
-    
+
     printf("\r\nsecp256r1 with Compressed Key\r\n");
     GenerateSharedSecret(&secp256r1);
- }
 }
 
 void SECP384R1_Test(crypto_HandlerType_E cryptoHandler)
@@ -192,23 +381,435 @@ void SECP384R1_Test(crypto_HandlerType_E cryptoHandler)
     printf("\r\nsecp384r1 with Uncompressed Key\r\n");
     GenerateSharedSecret(&secp384r1);
     
-  // wolfCrypt wrapper supports compressed key
-  if (secp384r1.handler == CRYPTO_HANDLER_SW_WOLFCRYPT)
-  {
-    secp384r1.handler            = CRYPTO_HANDLER_SW_WOLFCRYPT;
-    secp384r1.curveType          = CRYPTO_ECC_CURVE_SECP384R1;
-    secp384r1.privKey            = Priv_SECP384R1;
-    secp384r1.privKeySize        = sizeof(Priv_SECP384R1);
+    // Both handlers take compressed keys, the hardware computes Y on the CPKCC
     secp384r1.publKey            = Publ_SECP384R1_Compressed;
     secp384r1.publKeySize        = sizeof(Publ_SECP384R1_Compressed);
-    secp384r1.sharedSecret       = sharedSecret_SECP384R1;
-    secp384r1.sharedSecretSize   = sizeof(sharedSecret_SECP384R1);
-    secp384r1.expectedSecret     = Secret_SECP384R1;
-    secp384r1.expectedSecretSize = sizeof(Secret_SECP384R1);
 
     printf("\r\nsecp384r1 with Compressed Key\r\n");
-    GenerateSharedSecret(&secp384r1); 
-  }
+    GenerateSharedSecret(&secp384r1);
+}
+
+/*******************************************************************************
+  Function:
+    void ECDH_Ram_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDH_Ram_Benchmark (void)
+{
+    ECDH secp256r1 = {
+        .handler         = CRYPTO_HANDLER_HW_INTERNAL,
+        .curveType          = CRYPTO_ECC_CURVE_SECP256R1,
+        .privKey            = Priv_SECP256R1,
+        .privKeySize        = sizeof(Priv_SECP256R1),
+        .publKey            = Publ_SECP256R1,
+        .publKeySize        = sizeof(Publ_SECP256R1),
+        .sharedSecret       = sharedSecret_SECP256R1,
+        .sharedSecretSize   = sizeof(sharedSecret_SECP256R1),
+        .expectedSecret     = Secret_SECP256R1,
+        .expectedSecretSize = sizeof(Secret_SECP256R1)
+    };
+
+    printf("\r\nsecp256r1 curve constants reloaded vs resident\r\n");
+    ECDH_Ram_Latency(&secp256r1);
+
+    ECDH secp384r1 = {
+        .handler         = CRYPTO_HANDLER_HW_INTERNAL,
+        .curveType          = CRYPTO_ECC_CURVE_SECP384R1,
+        .privKey            = Priv_SECP384R1,
+        .privKeySize        = sizeof(Priv_SECP384R1),
+        .publKey            = Publ_SECP384R1,
+        .publKeySize        = sizeof(Publ_SECP384R1),
+        .sharedSecret       = sharedSecret_SECP384R1,
+        .sharedSecretSize   = sizeof(sharedSecret_SECP384R1),
+        .expectedSecret     = Secret_SECP384R1,
+        .expectedSecretSize = sizeof(Secret_SECP384R1)
+    };
+
+    printf("\r\nsecp384r1 curve constants reloaded vs resident\r\n");
+    ECDH_Ram_Latency(&secp384r1);
+}
+
+/*******************************************************************************
+  Function:
+    void ECDH_KeyGen_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDH_KeyGen_Benchmark (void)
+{
+    static const struct
+    {
+        crypto_EccCurveType_E curveType;
+        size_t keySize;
+        const char *name;
+    } curves[] = {
+        { CRYPTO_ECC_CURVE_SECP224R1, 28U, "secp224r1" },
+        { CRYPTO_ECC_CURVE_SECP256R1, 32U, "secp256r1" },
+        { CRYPTO_ECC_CURVE_SECP384R1, 48U, "secp384r1" },
+        { CRYPTO_ECC_CURVE_SECP521R1, 66U, "secp521r1" },
+        { CRYPTO_ECC_CURVE_BRAINPOOLP256R1, 32U, "brainpoolP256r1" },
+        { CRYPTO_ECC_CURVE_BRAINPOOLP384R1, 48U, "brainpoolP384r1" },
+        { CRYPTO_ECC_CURVE_SECP256K1, 32U, "secp256k1" },
+    };
+    size_t i;
+
+    for (i = 0; i < (sizeof(curves) / sizeof(curves[0])); i++)
+    {
+        ECDH keyGen = {
+            .handler            = CRYPTO_HANDLER_HW_INTERNAL,
+            .curveType          = curves[i].curveType,
+            .privKey            = keyGenPriv,
+            .privKeySize        = curves[i].keySize,
+            .publKey            = keyGenPubl,
+            .publKeySize        = (2U * curves[i].keySize) + 1U,
+            .sharedSecret       = keyGenSecret,
+            .sharedSecretSize   = curves[i].keySize,
+            .expectedSecret     = keyGenPeerSecret,
+            .expectedSecretSize = curves[i].keySize
+        };
+
+        printf("\r\n%s Hardware key generation\r\n", curves[i].name);
+        ECDH_KeyGen_Test(&keyGen);
+
+        keyGen.handler = CRYPTO_HANDLER_SW_WOLFCRYPT;
+        printf("\r\n%s wolfCrypt key generation\r\n", curves[i].name);
+        ECDH_KeyGen_Test(&keyGen);
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void ECDH_Pool_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDH_Pool_Benchmark (void)
+{
+    ECDH pool256 = {
+        .handler            = CRYPTO_HANDLER_HW_INTERNAL,
+        .curveType          = CRYPTO_ECC_CURVE_SECP256R1,
+        .privKey            = keyGenPriv,
+        .privKeySize        = 32U,
+        .publKey            = keyGenPubl,
+        .publKeySize        = 65U,
+        .sharedSecret       = keyGenSecret,
+        .sharedSecretSize   = 32U,
+        .expectedSecret     = keyGenPeerSecret,
+        .expectedSecretSize = 32U
+    };
+
+    printf("\r\nsecp256r1 Hardware key generation with precomputed pairs\r\n");
+    ECDH_Pool_Test(&pool256);
+
+    ECDH pool384 = {
+        .handler            = CRYPTO_HANDLER_HW_INTERNAL,
+        .curveType          = CRYPTO_ECC_CURVE_SECP384R1,
+        .privKey            = keyGenPriv,
+        .privKeySize        = 48U,
+        .publKey            = keyGenPubl,
+        .publKeySize        = 97U,
+        .sharedSecret       = keyGenSecret,
+        .sharedSecretSize   = 48U,
+        .expectedSecret     = keyGenPeerSecret,
+        .expectedSecretSize = 48U
+    };
+
+    printf("\r\nsecp384r1 Hardware key generation with precomputed pairs\r\n");
+    ECDH_Pool_Test(&pool384);
+
+    /* Keep secp256r1 pairs ready, APP_Tasks refills the pool when idle */
+    (void) Crypto_Ecc_Pool_Init(CRYPTO_ECC_CURVE_SECP256R1);
+}
+
+/*******************************************************************************
+  Function:
+    void FFDHE_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void FFDHE_Benchmark (void)
+{
+    printf("\r\nffdhe2048 Hardware Wrapper\r\n");
+    FFDHE_Test(CRYPTO_HANDLER_HW_INTERNAL, CRYPTO_KAS_DH_GROUP_FFDHE2048,
+        CRYPTO_KAS_DH_FFDHE2048_SIZE, CRYPTO_KAS_DH_FFDHE2048_PRIV_SIZE);
+
+    printf("\r\nffdhe2048 wolfCrypt Wrapper\r\n");
+    FFDHE_Test(CRYPTO_HANDLER_SW_WOLFCRYPT, CRYPTO_KAS_DH_GROUP_FFDHE2048,
+        CRYPTO_KAS_DH_FFDHE2048_SIZE, CRYPTO_KAS_DH_FFDHE2048_PRIV_SIZE);
+
+    printf("\r\nffdhe3072 Hardware Wrapper\r\n");
+    FFDHE_Test(CRYPTO_HANDLER_HW_INTERNAL, CRYPTO_KAS_DH_GROUP_FFDHE3072,
+        CRYPTO_KAS_DH_FFDHE3072_SIZE, CRYPTO_KAS_DH_FFDHE3072_PRIV_SIZE);
+
+    printf("\r\nffdhe3072 wolfCrypt Wrapper\r\n");
+    FFDHE_Test(CRYPTO_HANDLER_SW_WOLFCRYPT, CRYPTO_KAS_DH_GROUP_FFDHE3072,
+        CRYPTO_KAS_DH_FFDHE3072_SIZE, CRYPTO_KAS_DH_FFDHE3072_PRIV_SIZE);
+}
+
+/*******************************************************************************
+  Function:
+    void ECDH_Binary_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDH_Binary_Benchmark (void)
+{
+    static const struct
+    {
+        crypto_EccCurveType_E curveType;
+        size_t keySize;
+        uint8_t *privKey;
+        uint8_t *publKey;
+        uint8_t *secret;
+        const char *name;
+    } curves[] = {
+        { CRYPTO_ECC_CURVE_SECT233K1, 30U, Priv_SECT233K1, Publ_SECT233K1, Secret_SECT233K1, "sect233k1" },
+        { CRYPTO_ECC_CURVE_SECT233R1, 30U, Priv_SECT233R1, Publ_SECT233R1, Secret_SECT233R1, "sect233r1" },
+        { CRYPTO_ECC_CURVE_SECT283K1, 36U, Priv_SECT283K1, Publ_SECT283K1, Secret_SECT283K1, "sect283k1" },
+        { CRYPTO_ECC_CURVE_SECT283R1, 36U, Priv_SECT283R1, Publ_SECT283R1, Secret_SECT283R1, "sect283r1" },
+    };
+    size_t i;
+
+    for (i = 0; i < (sizeof(curves) / sizeof(curves[0])); i++)
+    {
+        ECDH binary = {
+            .handler            = CRYPTO_HANDLER_HW_INTERNAL,
+            .curveType          = curves[i].curveType,
+            .privKey            = curves[i].privKey,
+            .privKeySize        = curves[i].keySize,
+            .publKey            = curves[i].publKey,
+            .publKeySize        = (2U * curves[i].keySize) + 1U,
+            .sharedSecret       = keyGenSecret,
+            .sharedSecretSize   = curves[i].keySize,
+            .expectedSecret     = curves[i].secret,
+            .expectedSecretSize = curves[i].keySize
+        };
+
+        printf("\r\n%s Hardware Wrapper\r\n", curves[i].name);
+        GenerateSharedSecret(&binary);
+    }
+}
+
+/*******************************************************************************
+  Function:
+    void ECDH_CryptoCb_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDH_CryptoCb_Benchmark (void)
+{
+    ECDH secp256r1 = {
+        .handler            = CRYPTO_HANDLER_SW_WOLFCRYPT,
+        .curveType          = CRYPTO_ECC_CURVE_SECP256R1,
+        .privKey            = Priv_SECP256R1,
+        .privKeySize        = sizeof(Priv_SECP256R1),
+        .publKey            = Publ_SECP256R1,
+        .publKeySize        = sizeof(Publ_SECP256R1),
+        .sharedSecret       = sharedSecret_SECP256R1,
+        .sharedSecretSize   = sizeof(sharedSecret_SECP256R1),
+        .expectedSecret     = Secret_SECP256R1,
+        .expectedSecretSize = sizeof(Secret_SECP256R1)
+    };
+
+    ECDH secp384r1 = {
+        .handler            = CRYPTO_HANDLER_SW_WOLFCRYPT,
+        .curveType          = CRYPTO_ECC_CURVE_SECP384R1,
+        .privKey            = Priv_SECP384R1,
+        .privKeySize        = sizeof(Priv_SECP384R1),
+        .publKey            = Publ_SECP384R1,
+        .publKeySize        = sizeof(Publ_SECP384R1),
+        .sharedSecret       = sharedSecret_SECP384R1,
+        .sharedSecretSize   = sizeof(sharedSecret_SECP384R1),
+        .expectedSecret     = Secret_SECP384R1,
+        .expectedSecretSize = sizeof(Secret_SECP384R1)
+    };
+
+    printf("\r\nsecp256r1 wc_ecc_shared_secret\r\n");
+    ECDH_CryptoCb_Test(&secp256r1);
+
+    printf("\r\nsecp384r1 wc_ecc_shared_secret\r\n");
+    ECDH_CryptoCb_Test(&secp384r1);
+}
+
+/*******************************************************************************
+  Function:
+    void ECDH_KeyHandle_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDH_KeyHandle_Benchmark (void)
+{
+    ECDH secp256r1 = {
+        .handler            = CRYPTO_HANDLER_HW_INTERNAL,
+        .curveType          = CRYPTO_ECC_CURVE_SECP256R1,
+        .privKey            = Priv_SECP256R1,
+        .privKeySize        = sizeof(Priv_SECP256R1),
+        .publKey            = Publ_SECP256R1,
+        .publKeySize        = sizeof(Publ_SECP256R1),
+        .sharedSecret       = sharedSecret_SECP256R1,
+        .sharedSecretSize   = sizeof(sharedSecret_SECP256R1),
+        .expectedSecret     = Secret_SECP256R1,
+        .expectedSecretSize = sizeof(Secret_SECP256R1)
+    };
+
+    ECDH secp384r1 = {
+        .handler            = CRYPTO_HANDLER_HW_INTERNAL,
+        .curveType          = CRYPTO_ECC_CURVE_SECP384R1,
+        .privKey            = Priv_SECP384R1,
+        .privKeySize        = sizeof(Priv_SECP384R1),
+        .publKey            = Publ_SECP384R1,
+        .publKeySize        = sizeof(Publ_SECP384R1),
+        .sharedSecret       = sharedSecret_SECP384R1,
+        .sharedSecretSize   = sizeof(sharedSecret_SECP384R1),
+        .expectedSecret     = Secret_SECP384R1,
+        .expectedSecretSize = sizeof(Secret_SECP384R1)
+    };
+
+    printf("\r\nsecp256r1 HW key handle\r\n");
+    ECDH_KeyHandle_Test(&secp256r1);
+
+    printf("\r\nsecp384r1 HW key handle\r\n");
+    ECDH_KeyHandle_Test(&secp384r1);
+
+    secp256r1.handler = CRYPTO_HANDLER_SW_WOLFCRYPT;
+    printf("\r\nsecp256r1 SW key handle\r\n");
+    ECDH_KeyHandle_Test(&secp256r1);
+
+    secp384r1.handler = CRYPTO_HANDLER_SW_WOLFCRYPT;
+    printf("\r\nsecp384r1 SW key handle\r\n");
+    ECDH_KeyHandle_Test(&secp384r1);
+}
+
+/*******************************************************************************
+  Function:
+    void ECIES_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECIES_Benchmark (void)
+{
+    ECDH secp256r1 = {
+        .handler            = CRYPTO_HANDLER_HW_INTERNAL,
+        .curveType          = CRYPTO_ECC_CURVE_SECP256R1,
+        .privKey            = Priv_SECP256R1,
+        .privKeySize        = sizeof(Priv_SECP256R1),
+        .publKey            = Publ_SECP256R1,
+        .publKeySize        = sizeof(Publ_SECP256R1),
+        .sharedSecret       = sharedSecret_SECP256R1,
+        .sharedSecretSize   = sizeof(sharedSecret_SECP256R1),
+        .expectedSecret     = Secret_SECP256R1,
+        .expectedSecretSize = sizeof(Secret_SECP256R1)
+    };
+
+    ECDH secp384r1 = {
+        .handler            = CRYPTO_HANDLER_HW_INTERNAL,
+        .curveType          = CRYPTO_ECC_CURVE_SECP384R1,
+        .privKey            = Priv_SECP384R1,
+        .privKeySize        = sizeof(Priv_SECP384R1),
+        .publKey            = Publ_SECP384R1,
+        .publKeySize        = sizeof(Publ_SECP384R1),
+        .sharedSecret       = sharedSecret_SECP384R1,
+        .sharedSecretSize   = sizeof(sharedSecret_SECP384R1),
+        .expectedSecret     = Secret_SECP384R1,
+        .expectedSecretSize = sizeof(Secret_SECP384R1)
+    };
+
+    printf("\r\nsecp256r1 HW ECIES\r\n");
+    ECIES_Test(&secp256r1);
+
+    printf("\r\nsecp384r1 HW ECIES\r\n");
+    ECIES_Test(&secp384r1);
+
+    secp256r1.handler = CRYPTO_HANDLER_SW_WOLFCRYPT;
+    printf("\r\nsecp256r1 SW ECIES\r\n");
+    ECIES_Test(&secp256r1);
+
+    secp384r1.handler = CRYPTO_HANDLER_SW_WOLFCRYPT;
+    printf("\r\nsecp384r1 SW ECIES\r\n");
+    ECIES_Test(&secp384r1);
+}
+
+/*******************************************************************************
+  Function:
+    void ECDH_Nb_Benchmark (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void ECDH_Nb_Benchmark (void)
+{
+    static const char *degenerateKeys[4] = { "1", "2", "4", "n - 1" };
+    size_t i;
+
+    ECDH secp256r1 = {
+        .handler            = CRYPTO_HANDLER_HW_INTERNAL,
+        .curveType          = CRYPTO_ECC_CURVE_SECP256R1,
+        .privKey            = Priv_SECP256R1,
+        .privKeySize        = sizeof(Priv_SECP256R1),
+        .publKey            = Publ_SECP256R1,
+        .publKeySize        = sizeof(Publ_SECP256R1),
+        .sharedSecret       = sharedSecret_SECP256R1,
+        .sharedSecretSize   = sizeof(sharedSecret_SECP256R1),
+        .expectedSecret     = Secret_SECP256R1,
+        .expectedSecretSize = sizeof(Secret_SECP256R1)
+    };
+
+    ECDH secp384r1 = {
+        .handler            = CRYPTO_HANDLER_HW_INTERNAL,
+        .curveType          = CRYPTO_ECC_CURVE_SECP384R1,
+        .privKey            = Priv_SECP384R1,
+        .privKeySize        = sizeof(Priv_SECP384R1),
+        .publKey            = Publ_SECP384R1,
+        .publKeySize        = sizeof(Publ_SECP384R1),
+        .sharedSecret       = sharedSecret_SECP384R1,
+        .sharedSecretSize   = sizeof(sharedSecret_SECP384R1),
+        .expectedSecret     = Secret_SECP384R1,
+        .expectedSecretSize = sizeof(Secret_SECP384R1)
+    };
+
+    printf("\r\nsecp256r1 HW non-blocking\r\n");
+    ECDH_Nb_Test(&secp256r1);
+
+    printf("\r\nsecp384r1 HW non-blocking\r\n");
+    ECDH_Nb_Test(&secp384r1);
+
+    /* Additions of equal and opposite points within the slices */
+    for (i = 0U; i < 4U; i++)
+    {
+        secp256r1.privKey = Priv_Degenerate_SECP256R1[i];
+        secp256r1.expectedSecret = Secret_Degenerate_SECP256R1[i];
+        printf("\r\nsecp256r1 HW non-blocking, private key %s\r\n", 
+            degenerateKeys[i]);
+        ECDH_Nb_Test(&secp256r1);
+    }
+    secp256r1.privKey = Priv_SECP256R1;
+    secp256r1.expectedSecret = Secret_SECP256R1;
+
+    secp256r1.handler = CRYPTO_HANDLER_SW_WOLFCRYPT;
+    printf("\r\nsecp256r1 SW non-blocking\r\n");
+    ECDH_Nb_Test(&secp256r1);
+
+    secp384r1.handler = CRYPTO_HANDLER_SW_WOLFCRYPT;
+    printf("\r\nsecp384r1 SW non-blocking\r\n");
+    ECDH_Nb_Test(&secp384r1);
 }
 
 /*******************************************************************************
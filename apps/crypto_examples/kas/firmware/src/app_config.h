@@ -26,6 +26,10 @@
 
 #include "configuration.h"
 #include "crypto/common_crypto/crypto_kas.h"
+#include "crypto/common_crypto/crypto_ecc_pool.h"
+#include "crypto/common_crypto/crypto_ecc_nb.h"
+#include "crypto/common_crypto/crypto_ecies.h"
+#include "crypto/drivers/driver/drv_crypto_ecc_hw_cpkcl.h"
 #include "definitions.h"
 
 /* Provide C++ Compatibility */
@@ -161,6 +165,502 @@ extern "C" {
     */
     void SECP256R1_Test (crypto_HandlerType_E cryptoHandler);
 
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDH_Ram_Benchmark (void)
+
+      @Summary
+        Measures the latency saved by keeping curve constants in crypto RAM.
+
+      @Description
+        This function runs the hardware shared secret on P-256 and P-384, with
+        the curve constants reloaded in crypto RAM before every operation and
+        then left resident, and prints the average time of both.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDH_Ram_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDH_Ram_Latency (ECDH *ctx)
+
+      @Summary
+        Times hardware shared secrets with cold and resident curve constants.
+
+      @Description
+        This function runs APP_ECDH_LATENCY_ROUNDS shared secret computations
+        with the crypto RAM marked invalid before each one, then the same
+        number with the curve constants left resident, checks the result and
+        prints the average latency of both.
+
+      @Precondition
+        The ECDH context (ECDH structure) must be initialized for the hardware
+        handler.
+
+      @Parameters
+        @param ctx Pointer to the ECDH context (ECDH structure).
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDH_Ram_Latency (ECDH *ctx);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDH_KeyGen_Benchmark (void)
+
+      @Summary
+        Runs the key generation tests on every supported curve.
+
+      @Description
+        This function generates ECDH key pairs on secp224r1, secp256r1,
+        secp384r1, secp521r1, brainpoolP256r1, brainpoolP384r1 and secp256k1
+        with the hardware and the wolfCrypt handlers and prints the average
+        latency of each. secp192r1 is left out as the
+        wolfCrypt peer of the key agreement does not support it.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDH_KeyGen_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDH_KeyGen_Test (ECDH *ctx)
+
+      @Summary
+        Times key pair generation and checks the last pair in a key agreement.
+
+      @Description
+        This function runs APP_KEYGEN_ROUNDS key generations with
+        Crypto_Kas_Ecdh_KeyGen into the private and public key of the context
+        and prints the average latency. It then generates a peer pair with
+        wolfCrypt, computes the shared secret on both sides, one with the
+        context handler, and checks they match. The private keys are cleared
+        afterwards.
+
+      @Precondition
+        The ECDH context (ECDH structure) must hold buffers of the curve size
+        for the keys and both shared secrets.
+
+      @Parameters
+        @param ctx Pointer to the ECDH context (ECDH structure).
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDH_KeyGen_Test (ECDH *ctx);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDH_Pool_Benchmark (void)
+
+      @Summary
+        Measures ephemeral key generation from the precomputation pool.
+
+      @Description
+        This function runs the pool test on secp256r1 and secp384r1 with the
+        hardware handler, then leaves the pool initialized on secp256r1 so
+        APP_Tasks keeps it filled while the application is idle.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDH_Pool_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDH_Pool_Test (ECDH *ctx)
+
+      @Summary
+        Times ephemeral key generation with and without precomputed pairs.
+
+      @Description
+        This function fills the pool for the curve of the context, then runs
+        one key generation per precomputed pair and the same number with the
+        pool empty, and prints the average time to precompute a pair and the
+        average latency of both kinds of key generation. Every pair taken from
+        the pool is checked in a key agreement with a wolfCrypt peer.
+
+      @Precondition
+        The ECDH context (ECDH structure) must hold buffers of the curve size
+        for the keys and both shared secrets.
+
+      @Parameters
+        @param ctx Pointer to the ECDH context (ECDH structure).
+
+      @Returns
+        None.
+
+      @Remarks
+        The pool is left empty on the curve of the context.
+    */
+    void ECDH_Pool_Test (ECDH *ctx);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void FFDHE_Benchmark (void)
+
+      @Summary
+        Runs the finite field Diffie-Hellman tests on ffdhe2048 and ffdhe3072.
+
+      @Description
+        This function runs the FFDHE test on both RFC 7919 groups with the
+        hardware and the wolfCrypt handler.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void FFDHE_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDH_Binary_Benchmark (void)
+
+      @Summary
+        Runs the ECDH tests on the binary curves.
+
+      @Description
+        This function computes the shared secret of a known answer on
+        sect233k1, sect233r1, sect283k1 and sect283r1 with the hardware
+        handler. wolfCrypt has no binary curves.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDH_Binary_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void FFDHE_Test (crypto_HandlerType_E handler, crypto_Kas_DhGroup_E group,
+                         uint32_t primeSize, uint32_t privKeySize)
+
+      @Summary
+        Times FFDHE key generation and key agreement on one handler.
+
+      @Description
+        This function generates key pairs on the handler and prints the
+        average time of a key generation and of a key agreement with a peer
+        whose key pair comes from the other handler. The secrets computed on
+        both sides must match, and the peer public values 0, 1 and one above
+        the prime must be refused.
+
+      @Precondition
+        None.
+
+      @Parameters
+        @param handler Handler under test.
+        @param group RFC 7919 group.
+        @param primeSize Size of the prime of the group in bytes.
+        @param privKeySize Size of the generated private keys in bytes.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void FFDHE_Test (crypto_HandlerType_E handler, crypto_Kas_DhGroup_E group,
+                     uint32_t primeSize, uint32_t privKeySize);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDH_CryptoCb_Benchmark (void)
+
+      @Summary
+        Runs the wolfCrypt crypto callback test on secp256r1 and secp384r1.
+
+      @Description
+        This function runs the crypto callback test with the uncompressed test
+        keys of both curves.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDH_CryptoCb_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDH_CryptoCb_Test (ECDH *ecdh)
+
+      @Summary
+        Checks the wolfCrypt shared secret handed to the CPKCC by the crypto 
+        callback.
+
+      @Description
+        This function computes the shared secret with wc_ecc_shared_secret, 
+        first in software and then with the crypto callback device registered.
+        Both must match the expected secret and the callback must have run on
+        the CPKCC. The time of both is printed.
+
+      @Precondition
+        None.
+
+      @Parameters
+        @param ecdh Keys, curve and expected secret, the handler is unused.
+
+      @Returns
+        None.
+
+      @Remarks
+        The device is unregistered on return, the other wolfCrypt tests run in
+        software.
+    */
+    void ECDH_CryptoCb_Test (ECDH *ecdh);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDH_KeyHandle_Benchmark (void)
+
+      @Summary
+        Runs the key handle test on secp256r1 and secp384r1 with both handlers.
+
+      @Description
+        This function runs the key handle test with the known answer key pair
+        of each curve, on the hardware and wolfCrypt handlers.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDH_KeyHandle_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDH_KeyHandle_Test (ECDH *ecdh)
+
+      @Summary
+        Compares the shared secret calls taking the private key with those
+        taking a key handle.
+
+      @Description
+        This function computes the shared secret APP_KEY_HANDLE_ROUNDS times
+        passing the private key on every call, then imports the key once with
+        Crypto_Key_Import and runs the same rounds with the handle. The secret
+        must match the expected one, the import time and the latency per
+        operation are printed for both. The handle must be rejected once
+        destroyed.
+
+      @Precondition
+        SYSTICK timer started.
+
+      @Parameters
+        @param ecdh Pointer to the ECDH context (ECDH structure).
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDH_KeyHandle_Test (ECDH *ecdh);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECIES_Benchmark (void)
+
+      @Summary
+        Runs the ECIES test on secp256r1 and secp384r1 with both handlers.
+
+      @Description
+        This function runs the ECIES test with the known answer key pair of
+        each curve, on the hardware and wolfCrypt handlers.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECIES_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECIES_Test (ECDH *ecdh)
+
+      @Summary
+        Encrypts and decrypts a token with Crypto_Ecies_Encrypt and
+        Crypto_Ecies_Decrypt and times both end to end.
+
+      @Description
+        This function seals a APP_ECIES_MSG_SIZE byte message for the public
+        key of the context and opens it with its private key, 
+        APP_ECIES_ROUNDS times, with a KDF shared info and GCM additional data.
+        The last ciphertext must also open on the other handler, and once a 
+        bit of its tag is flipped it must be rejected with 
+        CRYPTO_ECIES_ERROR_AUTH. The crypto callback is registered for the
+        test: on the hardware handler the KDF and AES-GCM must reach the SHA
+        and AES engines, the other handler checks them against wolfCrypt. The
+        latency per encryption and decryption is printed.
+
+      @Precondition
+        SYSTICK timer started.
+
+      @Parameters
+        @param ecdh Pointer to the ECDH context (ECDH structure).
+
+      @Returns
+        None.
+
+      @Remarks
+        Each encryption generates an ephemeral key pair, from the pool when it
+        holds one for the curve.
+    */
+    void ECIES_Test (ECDH *ecdh);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDH_Nb_Benchmark (void)
+
+      @Summary
+        Runs the non-blocking ECDH test on secp256r1 and secp384r1.
+
+      @Description
+        This function runs the non-blocking ECDH test on secp256r1 and 
+        secp384r1 with the hardware and the wolfCrypt handler. The hardware
+        handler also runs it on secp256r1 with the private keys 1, 2, 4 and 
+        n - 1, whose multiplications add equal or opposite points within 
+        their slices.
+
+      @Precondition
+        SYSTICK timer started.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+    void ECDH_Nb_Benchmark (void);
+
+    // *****************************************************************************
+    /**
+      @Function
+        void ECDH_Nb_Test (ECDH *ecdh)
+
+      @Summary
+        Computes the shared secret in slices with crypto_ecc_nb.h and measures
+        the longest slice.
+
+      @Description
+        This function starts the shared secret of the context with
+        Crypto_Ecc_Nb_EcdhStart and calls Crypto_Ecc_Nb_Continue with
+        APP_NB_SLICE_STEPS steps per slice, as APP_Tasks would, until it ends.
+        The secret must match the expected one. The count of slices, the 
+        longest slice, the start call included, the total time and the time of
+        the blocking Crypto_Kas_Ecdh_SharedSecret on the same handler are
+        printed.
+
+      @Precondition
+        SYSTICK timer started.
+
+      @Parameters
+        @param ecdh Pointer to the ECDH context (ECDH structure).
+
+      @Returns
+        None.
+
+      @Remarks
+        The longest hardware slice is the one with the last bits of the 
+        multiplication and its conversion to affine coordinates.
+    */
+    void ECDH_Nb_Test (ECDH *ecdh);
+
     // *****************************************************************************
     /**
       @Function
@@ -51,6 +51,22 @@ typedef enum {
 	CRYPTO_HANDLER_MAX
 }crypto_HandlerType_E;
 
+//This needs to be taken care when no using any AES algorithm variant
+typedef enum
+{
+    CRYPTO_AESKEYSIZE_128 = 16, //Enum used for AES key size of 128 bits
+    CRYPTO_AESKEYSIZE_192 = 24, //Enum used for AES key size of 192 bits
+    CRYPTO_AESKEYSIZE_256 = 32  //Enum used for AES key size of 256 bits        
+}crypto_AesKeySize_E;
+
+//This needs to be taken care when no using any Sym or Asym algorithm variant
+typedef enum
+{
+    CRYPTO_CIOP_INVALID = 0,    //INVALID to define Min. range for Enum
+    CRYPTO_CIOP_ENCRYPT = 1,    //Enum used for Encryption cipher operation
+    CRYPTO_CIOP_DECRYPT = 2,    //Enum used for Decryption cipher operation
+    CRYPTO_CIOP_MAX,            //Max. to check Enum value range
+}crypto_CipherOper_E;
 
 /* Curve Types */
 typedef enum 
@@ -75,6 +91,26 @@ typedef enum
     CRYPTO_ECC_CURVE_P521 = 5,
     CRYPTO_ECC_CURVE_SECP521R1 = 5,        
           
+    /* Binary Curves */
+    
+    CRYPTO_ECC_CURVE_SECT233K1 = 6, //also called as NIST K-233
+    
+    CRYPTO_ECC_CURVE_SECT233R1 = 7, //also called as NIST B-233
+    
+    CRYPTO_ECC_CURVE_SECT283K1 = 8, //also called as NIST K-283
+    
+    CRYPTO_ECC_CURVE_SECT283R1 = 9, //also called as NIST B-283
+    
+    /* Other Prime Curves */
+    
+    CRYPTO_ECC_CURVE_BRAINPOOLP256R1 = 10, //RFC 5639
+    
+    CRYPTO_ECC_CURVE_BRAINPOOLP384R1 = 11, //RFC 5639
+    
+    CRYPTO_ECC_CURVE_SECP256K1 = 12, //SEC 2 Koblitz curve over a prime field
+    
+    CRYPTO_ECC_CURVE_CUSTOM = 13, //Parameters set at run time with DRV_CRYPTO_ECC_SetCustomCurve, hardware only
+    
     /* Twisted Edwards Curves */
 
     CRYPTO_ECC_CURVE_MAX
@@ -0,0 +1,86 @@
+/*******************************************************************************
+  MPLAB Harmony Application Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_ecc_nb.h
+
+  Summary:
+    Non-blocking ECDSA and ECDH for the cooperative task loops.
+
+  Description:
+    The ECDSA signature, its verification and the ECDH shared secret run here
+    in slices: a Start function checks and copies the arguments, and each
+    call of Crypto_Ecc_Nb_Continue from the application task runs at most a
+    given number of steps before returning CRYPTO_ECC_NB_IN_PROGRESS, so no
+    call holds the task loop for a whole scalar multiplication.
+
+    Handler     Step                                        Curves
+    wolfCrypt   One call of the SP non-blocking functions   P-256, P-384
+    Hardware    One bit of the CPKCC scalar multiplication  Prime curves
+
+    The hardware handler slices the multiplication with
+    DRV_CRYPTO_ECC_MulContinue. The arithmetic modulo the order before and
+    after it runs on wolfCrypt and takes one step, and the call running the
+    last bits of the multiplication returns even with steps left. The
+    signature takes its nonce from the pool of crypto_ecc_pool.h when a pair
+    is ready. An addition meeting equal or opposite points, which the CPKCC
+    additions do not take, is completed within its step by the driver, at
+    the cost of two conversions to affine coordinates.
+
+    One operation runs at a time. Its state, secrets included, is kept in
+    this module until it ends or Crypto_Ecc_Nb_Abort is called. The inputs are
+    copied by the Start functions, the output buffers are written at the end
+    and must stay valid until then. The public keys are uncompressed and not
+    checked to be on the curve, as with the blocking calls.
+*******************************************************************************/
+
+#ifndef CRYPTO_ECC_NB_H
+#define CRYPTO_ECC_NB_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stdint.h>
+#include "crypto_common.h"
+
+typedef enum
+{
+    CRYPTO_ECC_NB_ERROR_BUSY = -6,     //An operation is already running
+    CRYPTO_ECC_NB_ERROR_IDLE = -5,     //No operation to continue
+    CRYPTO_ECC_NB_ERROR_CURVE = -4,    //Curve not supported by the handler
+    CRYPTO_ECC_NB_ERROR_HANDLER = -3,
+    CRYPTO_ECC_NB_ERROR_ARG = -2,
+    CRYPTO_ECC_NB_ERROR_FAIL = -1,
+    CRYPTO_ECC_NB_SUCCESS = 0,
+    CRYPTO_ECC_NB_IN_PROGRESS = 1,     //Call Crypto_Ecc_Nb_Continue again
+}crypto_Ecc_Nb_Status_E;
+
+//Starts an ECDSA signature of a hash of at most 64 bytes. r || s is written on twice the curve size.
+crypto_Ecc_Nb_Status_E Crypto_Ecc_Nb_SignStart(crypto_HandlerType_E handlerType_en, crypto_EccCurveType_E eccCurveType_En,
+                                               uint8_t *ptr_inputHash, uint32_t hashLen, uint8_t *ptr_privKey, uint32_t privKeyLen,
+                                               uint8_t *ptr_outSig, uint32_t sigLen);
+
+//Starts an ECDSA verification. *ptr_hashVerifyStat is 1 for a valid signature and 0 otherwise once
+//Crypto_Ecc_Nb_Continue returns CRYPTO_ECC_NB_SUCCESS, r or s out of range being an invalid signature.
+crypto_Ecc_Nb_Status_E Crypto_Ecc_Nb_VerifyStart(crypto_HandlerType_E handlerType_en, crypto_EccCurveType_E eccCurveType_En,
+                                                 uint8_t *ptr_inputHash, uint32_t hashLen, uint8_t *ptr_inputSig, uint32_t sigLen,
+                                                 uint8_t *ptr_pubKey, uint32_t pubKeyLen, int8_t *ptr_hashVerifyStat);
+
+//Starts an ECDH shared secret, the X coordinate of d*Q written on the curve size.
+crypto_Ecc_Nb_Status_E Crypto_Ecc_Nb_EcdhStart(crypto_HandlerType_E handlerType_en, crypto_EccCurveType_E eccCurveType_En,
+                                               uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                               uint8_t *ptr_sharedSecret, uint32_t sharedSecretLen);
+
+//Runs at most maxSteps steps of the operation started. Returns CRYPTO_ECC_NB_IN_PROGRESS while steps are left, then
+//the result of the operation, which is over whatever it is.
+crypto_Ecc_Nb_Status_E Crypto_Ecc_Nb_Continue(uint32_t maxSteps);
+
+//Ends the operation started, if any, and clears its state. The outputs are not written.
+void Crypto_Ecc_Nb_Abort(void);
+
+#endif /* CRYPTO_ECC_NB_H */
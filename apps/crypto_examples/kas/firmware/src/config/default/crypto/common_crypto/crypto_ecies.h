@@ -0,0 +1,79 @@
+/*******************************************************************************
+  MPLAB Harmony Application Header File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_ecies.h
+
+  Summary:
+    ECIES hybrid encryption: ECDH, X9.63 KDF and AES-GCM in one call.
+
+  Description:
+    Crypto_Ecies_Encrypt agrees an ephemeral ECDH key with the recipient
+    public key, derives the AES key and nonce from the shared secret with the
+    X9.63 KDF and seals the message with AES-GCM. The ECDH runs on the handler
+    given, the CPKCC for the hardware handler. The KDF hashing and AES-GCM run
+    on wolfCrypt. For the hardware handler, their objects are set up with
+    CRYPTO_CRYPTOCB_WC_DEVID, so the crypto callback hands them to the SHA6156
+    and AES6149 when it is registered (crypto_cryptocb_wc_wrapper.h). The
+    shared secret and the derived key live on the stack of the call, about
+    1.2 KB with the wolfCrypt hash and AES objects, and are cleared before
+    returning. The module keeps no state of its own between calls.
+
+    Curve   KDF hash  AES key
+    P-256   SHA-256   128 bits
+    P-384   SHA-384   256 bits
+
+    The ciphertext is R || C || T: the ephemeral public key R uncompressed on
+    twice the curve size plus one byte, C on the size of the message and the
+    tag T on CRYPTO_ECIES_TAG_SIZE bytes. The 12 byte GCM nonce follows the
+    key in the KDF output, a new ephemeral key gives a new key and nonce.
+*******************************************************************************/
+
+#ifndef CRYPTO_ECIES_H
+#define CRYPTO_ECIES_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <stdint.h>
+#include "crypto_common.h"
+
+#define CRYPTO_ECIES_TAG_SIZE (16u)
+
+//Bytes the ciphertext adds to the message on a curve of keySize bytes
+#define CRYPTO_ECIES_OVERHEAD(keySize) ((2u * (uint32_t)(keySize)) + 1u + CRYPTO_ECIES_TAG_SIZE)
+
+typedef enum
+{
+    CRYPTO_ECIES_ERROR_AUTH = -8,      //Tag mismatch, the message buffer is cleared
+    CRYPTO_ECIES_ERROR_RNG = -7,
+    CRYPTO_ECIES_ERROR_HDLR = -6,
+    CRYPTO_ECIES_ERROR_CURVE = -5,     //Only P-256 and P-384
+    CRYPTO_ECIES_ERROR_PUBKEY = -4,
+    CRYPTO_ECIES_ERROR_PRIVKEY = -3,
+    CRYPTO_ECIES_ERROR_ARG = -2,
+    CRYPTO_ECIES_ERROR_FAIL = -1,
+    CRYPTO_ECIES_SUCCESS = 0,
+}crypto_Ecies_Status_E;
+
+//Encrypts ptr_msg for the public key (uncompressed or compressed) into ptr_cipher, msgLen plus CRYPTO_ECIES_OVERHEAD
+//bytes are written. The shared info goes into the KDF and the additional data is authenticated by GCM, both are
+//optional (NULL) and must be given again to decrypt.
+crypto_Ecies_Status_E Crypto_Ecies_Encrypt(crypto_HandlerType_E handlerType_en, crypto_EccCurveType_E eccCurveType_en,
+                                           uint8_t *ptr_pubKey, uint32_t pubKeyLen, uint8_t *ptr_sharedInfo, uint32_t sharedInfoLen,
+                                           uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_msg, uint32_t msgLen,
+                                           uint8_t *ptr_cipher, uint32_t cipherLen);
+
+//Decrypts a ciphertext of Crypto_Ecies_Encrypt with the private key, cipherLen minus CRYPTO_ECIES_OVERHEAD bytes are
+//written to ptr_msg. The message is cleared again when the tag does not match.
+crypto_Ecies_Status_E Crypto_Ecies_Decrypt(crypto_HandlerType_E handlerType_en, crypto_EccCurveType_E eccCurveType_en,
+                                           uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_sharedInfo, uint32_t sharedInfoLen,
+                                           uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_cipher, uint32_t cipherLen,
+                                           uint8_t *ptr_msg, uint32_t msgLen);
+
+#endif /* CRYPTO_ECIES_H */
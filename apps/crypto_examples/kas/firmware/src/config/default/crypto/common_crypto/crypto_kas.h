@@ -27,6 +27,7 @@
 // *****************************************************************************
 // *****************************************************************************
 #include "crypto_common.h"
+#include "crypto_key.h"
 // *****************************************************************************
 // *****************************************************************************
 // Section: Type Definitions
@@ -41,10 +42,48 @@ typedef enum
     CRYPTO_KAS_ERROR_CURVE = -122,
     CRYPTO_KAS_ERROR_ARG = -121,
     CRYPTO_KAS_ERROR_FAIL = -120,
+    CRYPTO_KAS_ERROR_RNG = -119,
     CRYPTO_KAS_SUCCESS = 0,        
 }crypto_Kas_Status_E;
 
+//Finite field Diffie-Hellman groups of RFC 7919, generator 2. An unknown group returns CRYPTO_KAS_ERROR_CURVE.
+typedef enum
+{
+    CRYPTO_KAS_DH_GROUP_INVALID = 0,
+    CRYPTO_KAS_DH_GROUP_FFDHE2048,
+    CRYPTO_KAS_DH_GROUP_FFDHE3072,
+    CRYPTO_KAS_DH_GROUP_MAX,
+}crypto_Kas_DhGroup_E;
+
+//Prime sizes in bytes, the size of the public keys and shared secrets
+#define CRYPTO_KAS_DH_FFDHE2048_SIZE (256u)
+#define CRYPTO_KAS_DH_FFDHE3072_SIZE (384u)
+
+//Size of the generated private keys in bytes
+#define CRYPTO_KAS_DH_FFDHE2048_PRIV_SIZE (29u)
+#define CRYPTO_KAS_DH_FFDHE3072_PRIV_SIZE (34u)
+
 crypto_Kas_Status_E Crypto_Kas_Ecdh_SharedSecret(crypto_HandlerType_E ecdhHandlerType_en, uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
                                                     uint8_t *ptr_sharedSecret, uint32_t sharedSecretLen, crypto_EccCurveType_E eccCurveType_en, uint32_t ecdhSessionId);
 
+//Shared secret with the private key of a handle from Crypto_Key_Import. The key is not parsed again and, for the
+//wolfCrypt handler, the blinding of the scalar multiplication draws from the DRBG of the handle.
+crypto_Kas_Status_E Crypto_Kas_Ecdh_SharedSecretWithKey(crypto_Key_Handle_T keyHandle, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                                        uint8_t *ptr_sharedSecret, uint32_t sharedSecretLen, uint32_t ecdhSessionId);
+
+//Generates an ECDH key pair. The private key is written on the curve size and the public key uncompressed (0x04 || X || Y) 
+//on twice the curve size plus one byte, privKeyLen and pubKeyLen give the sizes of the buffers.
+crypto_Kas_Status_E Crypto_Kas_Ecdh_KeyGen(crypto_HandlerType_E ecdhHandlerType_en, uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                            crypto_EccCurveType_E eccCurveType_en, uint32_t ecdhSessionId);
+
+//Generates a DH key pair. The private key is written on the private key size of the group and the public key on the 
+//prime size, both MSB first.
+crypto_Kas_Status_E Crypto_Kas_Dh_KeyGen(crypto_HandlerType_E dhHandlerType_en, uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                            crypto_Kas_DhGroup_E dhGroup_en, uint32_t dhSessionId);
+
+//Z = y^x mod p written on the prime size with its leading zeros. The peer public key y takes the prime size, it is 
+//rejected with CRYPTO_KAS_ERROR_PUBKEY unless 1 < y < p - 1, as is a shared secret of 1.
+crypto_Kas_Status_E Crypto_Kas_Dh_SharedSecret(crypto_HandlerType_E dhHandlerType_en, uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                                uint8_t *ptr_sharedSecret, uint32_t sharedSecretLen, crypto_Kas_DhGroup_E dhGroup_en, uint32_t dhSessionId);
+
 #endif /* CRYPTO_KAS_H */
\ No newline at end of file
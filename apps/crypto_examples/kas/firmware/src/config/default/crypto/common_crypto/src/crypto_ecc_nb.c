@@ -0,0 +1,885 @@
+/*******************************************************************************
+  MPLAB Harmony Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_ecc_nb.c
+
+  Summary:
+    Non-blocking ECDSA and ECDH for the cooperative task loops.
+
+  Description:
+    This file keeps the state of the operation running between the calls of
+    Crypto_Ecc_Nb_Continue. The wolfCrypt handler sets a non-blocking context
+    on its key and calls the wolfCrypt function of the operation until it
+    stops returning FP_WOULDBLOCK. The hardware handler goes through three
+    phases: the values modulo the order the multiplication needs, the sliced
+    multiplication on the CPKCC, and the values computed from its result.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "crypto/common_crypto/crypto_ecc_nb.h"
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_ecc_pool.h"
+#include "crypto/drivers/driver/drv_crypto_ecc_hw_cpkcl.h"
+#include "crypto/wolfcrypt/crypto_common_wc_wrapper.h"
+#include "wolfssl/wolfcrypt/error-crypt.h"
+#include "wolfssl/wolfcrypt/random.h"
+#include "wolfssl/wolfcrypt/ecc.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_ECC_NB_POINT_SIZE_MAX ((2 * CRYPTO_ECC_MAX_KEY_LENGTH) + 1)
+#define CRYPTO_ECC_NB_HASH_SIZE_MAX (64u)
+
+//Random bytes drawn above the curve size for the nonce, which makes the bias of the reduction negligible
+#define CRYPTO_ECC_NB_NONCE_EXTRA (8u)
+
+typedef enum
+{
+    CRYPTO_ECC_NB_OP_NONE = 0,
+    CRYPTO_ECC_NB_OP_SIGN,
+    CRYPTO_ECC_NB_OP_VERIFY,
+    CRYPTO_ECC_NB_OP_ECDH,
+}crypto_Ecc_Nb_Op_E;
+
+//Phases of the hardware handler
+typedef enum
+{
+    CRYPTO_ECC_NB_HW_PREPARE = 0,
+    CRYPTO_ECC_NB_HW_MUL,
+    CRYPTO_ECC_NB_HW_FINISH,
+}crypto_Ecc_Nb_HwPhase_E;
+
+static crypto_Ecc_Nb_Op_E eccNbOp_en = CRYPTO_ECC_NB_OP_NONE;
+static crypto_HandlerType_E eccNbHandler_en = CRYPTO_HANDLER_INVALID;
+static crypto_EccCurveType_E eccNbCurve_en = CRYPTO_ECC_CURVE_INVALID;
+static uint32_t eccNbKeySize = 0u;
+static uint8_t eccNbHash[CRYPTO_ECC_NB_HASH_SIZE_MAX];
+static uint32_t eccNbHashLen = 0u;
+static uint8_t *ptr_eccNbOut = NULL;
+static int8_t *ptr_eccNbVerifyStat = NULL;
+//False when r or s of the signature to verify is not in [1, n-1]
+static bool eccNbSigInRange = false;
+
+//wolfCrypt handler
+static ecc_key eccNbKey_st;
+static ecc_key eccNbPeerKey_st;
+static ecc_nb_ctx_t eccNbCtx_st;
+static WC_RNG eccNbRng_st;
+static mp_int eccNbR;
+static mp_int eccNbS;
+static bool eccNbKeyInit = false;
+static bool eccNbPeerKeyInit = false;
+static bool eccNbRngInit = false;
+static bool eccNbMpInit = false;
+
+//Hardware handler: the private key or nonce in eccNbScalar1, u1 and u2 of the verification in eccNbScalar1 and
+//eccNbScalar2, the private key of the signature in eccNbPrivKey
+static crypto_Ecc_Nb_HwPhase_E eccNbHwPhase_en = CRYPTO_ECC_NB_HW_PREPARE;
+static CPKCL_ECC_DATA eccNbEccData_st;
+static CPKCL_ECC_MUL_CTX eccNbMul_st;
+static uint8_t eccNbScalar1[CRYPTO_ECC_MAX_KEY_LENGTH];
+static uint8_t eccNbScalar2[CRYPTO_ECC_MAX_KEY_LENGTH];
+static uint8_t eccNbPrivKey[CRYPTO_ECC_MAX_KEY_LENGTH];
+static uint32_t eccNbPrivKeyLen = 0u;
+static uint8_t eccNbSig[2 * CRYPTO_ECC_MAX_KEY_LENGTH];
+static uint8_t eccNbPoint[CRYPTO_ECC_NB_POINT_SIZE_MAX];
+static uint8_t eccNbResult[CRYPTO_ECC_NB_POINT_SIZE_MAX];
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static crypto_Ecc_Nb_Status_E lCrypto_Ecc_Nb_GetHwCurve(crypto_EccCurveType_E eccCurveType_En, CRYPTO_CPKCL_CURVE *ptr_hwCurve)
+{
+    crypto_Ecc_Nb_Status_E ret_nbStat_en = CRYPTO_ECC_NB_SUCCESS;
+
+    switch(eccCurveType_En)
+    {
+        case CRYPTO_ECC_CURVE_P192:
+            *ptr_hwCurve = CRYPTO_CPKCL_CURVE_P192;
+            break;
+
+        case CRYPTO_ECC_CURVE_P224:
+            *ptr_hwCurve = CRYPTO_CPKCL_CURVE_P224;
+            break;
+
+        case CRYPTO_ECC_CURVE_P256:
+            *ptr_hwCurve = CRYPTO_CPKCL_CURVE_P256;
+            break;
+
+        case CRYPTO_ECC_CURVE_P384:
+            *ptr_hwCurve = CRYPTO_CPKCL_CURVE_P384;
+            break;
+
+        case CRYPTO_ECC_CURVE_P521:
+            *ptr_hwCurve = CRYPTO_CPKCL_CURVE_P521;
+            break;
+
+        case CRYPTO_ECC_CURVE_BRAINPOOLP256R1:
+            *ptr_hwCurve = CRYPTO_CPKCL_CURVE_BP256R1;
+            break;
+
+        case CRYPTO_ECC_CURVE_BRAINPOOLP384R1:
+            *ptr_hwCurve = CRYPTO_CPKCL_CURVE_BP384R1;
+            break;
+
+        case CRYPTO_ECC_CURVE_SECP256K1:
+            *ptr_hwCurve = CRYPTO_CPKCL_CURVE_SECP256K1;
+            break;
+
+        default:
+            //Binary curves, and the custom curve whose order wolfCrypt does not know
+            ret_nbStat_en = CRYPTO_ECC_NB_ERROR_CURVE;
+            break;
+    }
+
+    return ret_nbStat_en;
+}
+
+//Checks the handler and the curve and sets the key size. The wolfCrypt handler runs the SP code, which has the
+//non-blocking functions for P-256 and P-384 only.
+static crypto_Ecc_Nb_Status_E lCrypto_Ecc_Nb_Init(crypto_HandlerType_E handlerType_en, crypto_EccCurveType_E eccCurveType_En)
+{
+    crypto_Ecc_Nb_Status_E ret_nbStat_en = CRYPTO_ECC_NB_SUCCESS;
+    CRYPTO_CPKCL_CURVE hwCurve = CRYPTO_CPKCL_CURVE_P256;
+    int curveSize = wc_ecc_get_curve_size_from_id(Crypto_Common_Wc_Ecc_GetWcCurveId(eccCurveType_En));
+
+    if(eccNbOp_en != CRYPTO_ECC_NB_OP_NONE)
+    {
+        ret_nbStat_en = CRYPTO_ECC_NB_ERROR_BUSY;
+    }
+    else if(handlerType_en == CRYPTO_HANDLER_SW_WOLFCRYPT)
+    {
+        if( (eccCurveType_En != CRYPTO_ECC_CURVE_P256) && (eccCurveType_En != CRYPTO_ECC_CURVE_P384) )
+        {
+            ret_nbStat_en = CRYPTO_ECC_NB_ERROR_CURVE;
+        }
+    }
+    else if(handlerType_en == CRYPTO_HANDLER_HW_INTERNAL)
+    {
+        ret_nbStat_en = lCrypto_Ecc_Nb_GetHwCurve(eccCurveType_En, &hwCurve);
+
+        if(ret_nbStat_en != CRYPTO_ECC_NB_SUCCESS)
+        {
+            //Curve not supported
+        }
+        else if(DRV_CRYPTO_ECC_CheckCpkcl() != CRYPTO_CPKCL_RESULT_INIT_SUCCESS)
+        {
+            ret_nbStat_en = CRYPTO_ECC_NB_ERROR_FAIL;
+        }
+        else if(DRV_CRYPTO_ECC_InitCurveParams(&eccNbEccData_st, hwCurve) != CRYPTO_CPKCL_RESULT_CURVE_SUCCESS)
+        {
+            ret_nbStat_en = CRYPTO_ECC_NB_ERROR_CURVE;
+        }
+        else
+        {
+            eccNbHwPhase_en = CRYPTO_ECC_NB_HW_PREPARE;
+        }
+    }
+    else
+    {
+        ret_nbStat_en = CRYPTO_ECC_NB_ERROR_HANDLER;
+    }
+
+    if( (ret_nbStat_en == CRYPTO_ECC_NB_SUCCESS) && (curveSize <= 0) )
+    {
+        ret_nbStat_en = CRYPTO_ECC_NB_ERROR_CURVE;
+    }
+
+    if(ret_nbStat_en == CRYPTO_ECC_NB_SUCCESS)
+    {
+        eccNbHandler_en = handlerType_en;
+        eccNbCurve_en = eccCurveType_En;
+        eccNbKeySize = (uint32_t)curveSize;
+    }
+
+    return ret_nbStat_en;
+}
+
+//Frees the wolfCrypt objects and clears the state, the module is then idle
+static void lCrypto_Ecc_Nb_End(void)
+{
+    if(eccNbKeyInit == true)
+    {
+        (void)wc_ecc_free(&eccNbKey_st);
+    }
+    if(eccNbPeerKeyInit == true)
+    {
+        (void)wc_ecc_free(&eccNbPeerKey_st);
+    }
+    if(eccNbRngInit == true)
+    {
+        (void)wc_FreeRng(&eccNbRng_st);
+    }
+    if(eccNbMpInit == true)
+    {
+        mp_clear(&eccNbR);
+        mp_clear(&eccNbS);
+    }
+    eccNbKeyInit = false;
+    eccNbPeerKeyInit = false;
+    eccNbRngInit = false;
+    eccNbMpInit = false;
+
+    //The non-blocking context of the signature holds the nonce, the scalars and the multiplication the private key
+    (void) memset(&eccNbCtx_st, 0, sizeof(eccNbCtx_st));
+    (void) memset(&eccNbMul_st, 0, sizeof(eccNbMul_st));
+    (void) memset(eccNbScalar1, 0, sizeof(eccNbScalar1));
+    (void) memset(eccNbScalar2, 0, sizeof(eccNbScalar2));
+    (void) memset(eccNbPrivKey, 0, sizeof(eccNbPrivKey));
+    (void) memset(eccNbResult, 0, sizeof(eccNbResult));
+    (void) memset(eccNbHash, 0, sizeof(eccNbHash));
+    eccNbPrivKeyLen = 0u;
+    eccNbHashLen = 0u;
+    ptr_eccNbOut = NULL;
+    ptr_eccNbVerifyStat = NULL;
+    eccNbOp_en = CRYPTO_ECC_NB_OP_NONE;
+}
+
+//Reads the order n of the curve
+static int lCrypto_Ecc_Nb_ReadOrder(mp_int *ptr_n)
+{
+    const ecc_set_type *ptr_curveParams = wc_ecc_get_curve_params(wc_ecc_get_curve_idx(Crypto_Common_Wc_Ecc_GetWcCurveId(eccNbCurve_en)));
+    int wcNbStat = MP_VAL;
+
+    if(ptr_curveParams != NULL)
+    {
+        wcNbStat = mp_read_radix(ptr_n, ptr_curveParams->order, MP_RADIX_HEX);
+    }
+
+    return wcNbStat;
+}
+
+//True when r and s of the signature r || s are in [1, n-1]
+static bool lCrypto_Ecc_Nb_SigInRange(uint8_t *ptr_sig)
+{
+    bool inRange = false;
+    mp_int n, r, s;
+
+    if(mp_init_multi(&n, &r, &s, NULL, NULL, NULL) == MP_OKAY)
+    {
+        if( (lCrypto_Ecc_Nb_ReadOrder(&n) == MP_OKAY)
+                && (mp_read_unsigned_bin(&r, ptr_sig, eccNbKeySize) == MP_OKAY)
+                && (mp_read_unsigned_bin(&s, &ptr_sig[eccNbKeySize], eccNbKeySize) == MP_OKAY) )
+        {
+            inRange = (mp_iszero(&r) == MP_NO) && (mp_iszero(&s) == MP_NO)
+                        && (mp_cmp(&r, &n) == MP_LT) && (mp_cmp(&s, &n) == MP_LT);
+        }
+        mp_clear(&n);
+        mp_clear(&r);
+        mp_clear(&s);
+    }
+
+    return inRange;
+}
+
+static crypto_Ecc_Nb_Status_E lCrypto_Ecc_Nb_GetWcStatus(int wcNbStat)
+{
+    crypto_Ecc_Nb_Status_E ret_nbStat_en;
+
+    if(wcNbStat == 0)
+    {
+        ret_nbStat_en = CRYPTO_ECC_NB_SUCCESS;
+    }
+    else if(wcNbStat == FP_WOULDBLOCK)
+    {
+        ret_nbStat_en = CRYPTO_ECC_NB_IN_PROGRESS;
+    }
+    else if( (wcNbStat == BAD_FUNC_ARG) || (wcNbStat == ECC_BAD_ARG_E) )
+    {
+        ret_nbStat_en = CRYPTO_ECC_NB_ERROR_ARG;
+    }
+    else
+    {
+        ret_nbStat_en = CRYPTO_ECC_NB_ERROR_FAIL;
+    }
+
+    return ret_nbStat_en;
+}
+
+//wolfCrypt keys of the operation: the private key when given, with the non-blocking context, and the public key in
+//the key of the verification or the peer key of ECDH
+static int lCrypto_Ecc_Nb_Wc_SetKeys(uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen)
+{
+    int wcEccCurveId = Crypto_Common_Wc_Ecc_GetWcCurveId(eccNbCurve_en);
+    int wcNbStat = wc_ecc_init(&eccNbKey_st);
+
+    if(wcNbStat == 0)
+    {
+        eccNbKeyInit = true;
+        wcNbStat = wc_ecc_set_nonblock(&eccNbKey_st, &eccNbCtx_st);
+    }
+    if( (wcNbStat == 0) && (ptr_privKey != NULL) )
+    {
+        wcNbStat = wc_ecc_import_private_key_ex(ptr_privKey, privKeyLen, NULL, 0, &eccNbKey_st, wcEccCurveId);
+    }
+    if( (wcNbStat == 0) && (ptr_pubKey != NULL) && (ptr_privKey == NULL) )
+    {
+        wcNbStat = wc_ecc_import_x963_ex(ptr_pubKey, pubKeyLen, &eccNbKey_st, wcEccCurveId);
+    }
+    if( (wcNbStat == 0) && (ptr_pubKey != NULL) && (ptr_privKey != NULL) )
+    {
+        wcNbStat = wc_ecc_init(&eccNbPeerKey_st);
+        if(wcNbStat == 0)
+        {
+            eccNbPeerKeyInit = true;
+            wcNbStat = wc_ecc_import_x963_ex(ptr_pubKey, pubKeyLen, &eccNbPeerKey_st, wcEccCurveId);
+        }
+    }
+    if(wcNbStat == 0)
+    {
+        wcNbStat = mp_init_multi(&eccNbR, &eccNbS, NULL, NULL, NULL, NULL);
+        if(wcNbStat == MP_OKAY)
+        {
+            eccNbMpInit = true;
+        }
+    }
+
+    return wcNbStat;
+}
+
+//One call of the non-blocking wolfCrypt function of the operation
+static crypto_Ecc_Nb_Status_E lCrypto_Ecc_Nb_Wc_Step(void)
+{
+    int wcNbStat;
+    int verifyStat = 0;
+    word32 sharedSecretLen = eccNbKeySize;
+
+    if(eccNbOp_en == CRYPTO_ECC_NB_OP_SIGN)
+    {
+        wcNbStat = wc_ecc_sign_hash_ex(eccNbHash, eccNbHashLen, &eccNbRng_st, &eccNbKey_st, &eccNbR, &eccNbS);
+        if(wcNbStat == 0)
+        {
+            wcNbStat = mp_to_unsigned_bin_len(&eccNbR, ptr_eccNbOut, (int)eccNbKeySize);
+        }
+        if(wcNbStat == 0)
+        {
+            wcNbStat = mp_to_unsigned_bin_len(&eccNbS, &ptr_eccNbOut[eccNbKeySize], (int)eccNbKeySize);
+        }
+    }
+    else if(eccNbOp_en == CRYPTO_ECC_NB_OP_VERIFY)
+    {
+        wcNbStat = wc_ecc_verify_hash_ex(&eccNbR, &eccNbS, eccNbHash, eccNbHashLen, &verifyStat, &eccNbKey_st);
+        if(wcNbStat == 0)
+        {
+            *ptr_eccNbVerifyStat = (verifyStat == 1) ? 1 : 0;
+        }
+    }
+    else
+    {
+        //A negative return resets the state of the key, the non-blocking context keeps the progress
+        wcNbStat = wc_ecc_shared_secret_ex(&eccNbKey_st, &eccNbPeerKey_st.pubkey, ptr_eccNbOut, &sharedSecretLen);
+    }
+
+    return lCrypto_Ecc_Nb_GetWcStatus(wcNbStat);
+}
+
+//Nonce of the signature in eccNbScalar1: (c mod (n - 1)) + 1 with c drawn on the curve size plus
+//CRYPTO_ECC_NB_NONCE_EXTRA bytes
+static crypto_Ecc_Nb_Status_E lCrypto_Ecc_Nb_Hw_DrawNonce(void)
+{
+    crypto_Ecc_Nb_Status_E ret_nbStat_en = CRYPTO_ECC_NB_ERROR_FAIL;
+    uint8_t draw[CRYPTO_ECC_MAX_KEY_LENGTH + CRYPTO_ECC_NB_NONCE_EXTRA];
+    uint32_t drawLen = eccNbKeySize + CRYPTO_ECC_NB_NONCE_EXTRA;
+    WC_RNG wcRng_st;
+    int wcNbStat;
+    mp_int n, c;
+
+    wcNbStat = wc_InitRng(&wcRng_st);
+    if(wcNbStat == 0)
+    {
+        wcNbStat = wc_RNG_GenerateBlock(&wcRng_st, draw, drawLen);
+        (void)wc_FreeRng(&wcRng_st);
+    }
+
+    if( (wcNbStat == 0) && (mp_init_multi(&n, &c, NULL, NULL, NULL, NULL) == MP_OKAY) )
+    {
+        wcNbStat = lCrypto_Ecc_Nb_ReadOrder(&n);
+        if(wcNbStat == MP_OKAY)
+        {
+            wcNbStat = mp_sub_d(&n, 1, &n);
+        }
+        if(wcNbStat == MP_OKAY)
+        {
+            wcNbStat = mp_read_unsigned_bin(&c, draw, drawLen);
+        }
+        if(wcNbStat == MP_OKAY)
+        {
+            wcNbStat = mp_mod(&c, &n, &c);
+        }
+        if(wcNbStat == MP_OKAY)
+        {
+            wcNbStat = mp_add_d(&c, 1, &c);
+        }
+        if(wcNbStat == MP_OKAY)
+        {
+            wcNbStat = mp_to_unsigned_bin_len(&c, eccNbScalar1, (int)eccNbKeySize);
+        }
+        if(wcNbStat == MP_OKAY)
+        {
+            ret_nbStat_en = CRYPTO_ECC_NB_SUCCESS;
+        }
+        mp_forcezero(&c);
+        mp_clear(&n);
+    }
+    (void) memset(draw, 0, sizeof(draw));
+
+    return ret_nbStat_en;
+}
+
+//u1 = e/s and u2 = r/s modulo n in eccNbScalar1 and eccNbScalar2, e being the leftmost bits of the hash, as many as
+//in the order
+static crypto_Ecc_Nb_Status_E lCrypto_Ecc_Nb_Hw_VerifyScalars(void)
+{
+    crypto_Ecc_Nb_Status_E ret_nbStat_en = CRYPTO_ECC_NB_ERROR_FAIL;
+    int orderBits;
+    int wcNbStat;
+    mp_int n, e, r, w;
+
+    if(mp_init_multi(&n, &e, &r, &w, NULL, NULL) == MP_OKAY)
+    {
+        wcNbStat = lCrypto_Ecc_Nb_ReadOrder(&n);
+        if(wcNbStat == MP_OKAY)
+        {
+            wcNbStat = mp_read_unsigned_bin(&e, eccNbHash, eccNbHashLen);
+        }
+        orderBits = mp_count_bits(&n);
+        if( (wcNbStat == MP_OKAY) && (((int)eccNbHashLen * 8) > orderBits) )
+        {
+            wcNbStat = mp_rshb(&e, ((int)eccNbHashLen * 8) - orderBits);
+        }
+        if(wcNbStat == MP_OKAY)
+        {
+            wcNbStat = mp_read_unsigned_bin(&r, eccNbSig, eccNbKeySize);
+        }
+        if(wcNbStat == MP_OKAY)
+        {
+            wcNbStat = mp_read_unsigned_bin(&w, &eccNbSig[eccNbKeySize], eccNbKeySize);
+        }
+        if(wcNbStat == MP_OKAY)
+        {
+            wcNbStat = mp_invmod(&w, &n, &w);
+        }
+        if(wcNbStat == MP_OKAY)
+        {
+            wcNbStat = mp_mulmod(&e, &w, &n, &e);
+        }
+        if(wcNbStat == MP_OKAY)
+        {
+            wcNbStat = mp_mulmod(&r, &w, &n, &r);
+        }
+        if(wcNbStat == MP_OKAY)
+        {
+            wcNbStat = mp_to_unsigned_bin_len(&e, eccNbScalar1, (int)eccNbKeySize);
+        }
+        if(wcNbStat == MP_OKAY)
+        {
+            wcNbStat = mp_to_unsigned_bin_len(&r, eccNbScalar2, (int)eccNbKeySize);
+        }
+        if(wcNbStat == MP_OKAY)
+        {
+            ret_nbStat_en = CRYPTO_ECC_NB_SUCCESS;
+        }
+        mp_clear(&n);
+        mp_clear(&e);
+        mp_clear(&r);
+        mp_clear(&w);
+    }
+
+    return ret_nbStat_en;
+}
+
+//The signature is valid when x(u1*G + u2*Q) mod n is r
+static bool lCrypto_Ecc_Nb_Hw_VerifyResult(void)
+{
+    bool sigValid = false;
+    mp_int n, x, r;
+
+    if(mp_init_multi(&n, &x, &r, NULL, NULL, NULL) == MP_OKAY)
+    {
+        if( (lCrypto_Ecc_Nb_ReadOrder(&n) == MP_OKAY)
+                && (mp_read_unsigned_bin(&x, &eccNbResult[1], eccNbKeySize) == MP_OKAY)
+                && (mp_read_unsigned_bin(&r, eccNbSig, eccNbKeySize) == MP_OKAY)
+                && (mp_mod(&x, &n, &x) == MP_OKAY) )
+        {
+            sigValid = (mp_cmp(&x, &r) == MP_EQ);
+        }
+        mp_clear(&n);
+        mp_clear(&x);
+        mp_clear(&r);
+    }
+
+    return sigValid;
+}
+
+//Phase before the multiplication: the nonce of the signature, the private key range of ECDH and the scalars of the
+//verification, then the start of the sliced multiplication
+static crypto_Ecc_Nb_Status_E lCrypto_Ecc_Nb_Hw_Prepare(void)
+{
+    crypto_Ecc_Nb_Status_E ret_nbStat_en = CRYPTO_ECC_NB_SUCCESS;
+    CRYPTO_CPKCL_RESULT hwResult = CRYPTO_CPKCL_RESULT_POINT_ERROR;
+    mp_int n, d;
+
+    if(eccNbOp_en == CRYPTO_ECC_NB_OP_SIGN)
+    {
+        ret_nbStat_en = lCrypto_Ecc_Nb_Hw_DrawNonce();
+        if(ret_nbStat_en == CRYPTO_ECC_NB_SUCCESS)
+        {
+            hwResult = DRV_CRYPTO_ECC_MulStart(&eccNbEccData_st, &eccNbMul_st, eccNbScalar1, NULL, NULL, NULL);
+        }
+    }
+    else if(eccNbOp_en == CRYPTO_ECC_NB_OP_VERIFY)
+    {
+        ret_nbStat_en = lCrypto_Ecc_Nb_Hw_VerifyScalars();
+        if(ret_nbStat_en == CRYPTO_ECC_NB_SUCCESS)
+        {
+            hwResult = DRV_CRYPTO_ECC_MulStart(&eccNbEccData_st, &eccNbMul_st, eccNbScalar1, NULL, eccNbScalar2, eccNbPoint);
+        }
+    }
+    else
+    {
+        //The multiplication takes d in [1, n-1]
+        ret_nbStat_en = CRYPTO_ECC_NB_ERROR_FAIL;
+        if(mp_init_multi(&n, &d, NULL, NULL, NULL, NULL) == MP_OKAY)
+        {
+            if( (lCrypto_Ecc_Nb_ReadOrder(&n) == MP_OKAY)
+                    && (mp_read_unsigned_bin(&d, eccNbScalar1, eccNbKeySize) == MP_OKAY) )
+            {
+                ret_nbStat_en = ( (mp_iszero(&d) == MP_NO) && (mp_cmp(&d, &n) == MP_LT) ) ?
+                                    CRYPTO_ECC_NB_SUCCESS : CRYPTO_ECC_NB_ERROR_ARG;
+            }
+            mp_forcezero(&d);
+            mp_clear(&n);
+        }
+        if(ret_nbStat_en == CRYPTO_ECC_NB_SUCCESS)
+        {
+            hwResult = DRV_CRYPTO_ECC_MulStart(&eccNbEccData_st, &eccNbMul_st, eccNbScalar1, eccNbPoint, NULL, NULL);
+        }
+    }
+
+    if( (ret_nbStat_en == CRYPTO_ECC_NB_SUCCESS) && (hwResult != CRYPTO_CPKCL_RESULT_POINT_IN_PROGRESS) )
+    {
+        ret_nbStat_en = CRYPTO_ECC_NB_ERROR_FAIL;
+    }
+
+    return ret_nbStat_en;
+}
+
+//Phase after the multiplication
+static crypto_Ecc_Nb_Status_E lCrypto_Ecc_Nb_Hw_Finish(void)
+{
+    crypto_Ecc_Nb_Status_E ret_nbStat_en = CRYPTO_ECC_NB_SUCCESS;
+    uint32_t pointLen = (2u * eccNbKeySize) + 1u;
+
+    if(eccNbOp_en == CRYPTO_ECC_NB_OP_SIGN)
+    {
+        if(Crypto_Ecc_Pool_EcdsaSignNonce(eccNbCurve_en, eccNbScalar1, eccNbKeySize, eccNbResult, pointLen, eccNbHash, eccNbHashLen,
+                                          eccNbPrivKey, eccNbPrivKeyLen, ptr_eccNbOut, 2u * eccNbKeySize) != CRYPTO_ECC_POOL_SUCCESS)
+        {
+            ret_nbStat_en = CRYPTO_ECC_NB_ERROR_FAIL;
+        }
+    }
+    else if(eccNbOp_en == CRYPTO_ECC_NB_OP_VERIFY)
+    {
+        *ptr_eccNbVerifyStat = (lCrypto_Ecc_Nb_Hw_VerifyResult() == true) ? 1 : 0;
+    }
+    else
+    {
+        (void) memcpy(ptr_eccNbOut, &eccNbResult[1], eccNbKeySize);
+    }
+
+    return ret_nbStat_en;
+}
+
+//Runs the phases of the hardware handler. The preparation and the finish take one step each, the multiplication the
+//steps left, and the call running its last bits ends the slice.
+static crypto_Ecc_Nb_Status_E lCrypto_Ecc_Nb_Hw_Run(uint32_t maxSteps)
+{
+    crypto_Ecc_Nb_Status_E ret_nbStat_en = CRYPTO_ECC_NB_IN_PROGRESS;
+    CRYPTO_CPKCL_RESULT hwResult;
+    uint32_t steps = 0u;
+    uint32_t mulSteps;
+
+    while( (ret_nbStat_en == CRYPTO_ECC_NB_IN_PROGRESS) && (steps < maxSteps) )
+    {
+        if(eccNbHwPhase_en == CRYPTO_ECC_NB_HW_PREPARE)
+        {
+            ret_nbStat_en = lCrypto_Ecc_Nb_Hw_Prepare();
+            if(ret_nbStat_en == CRYPTO_ECC_NB_SUCCESS)
+            {
+                ret_nbStat_en = CRYPTO_ECC_NB_IN_PROGRESS;
+                eccNbHwPhase_en = CRYPTO_ECC_NB_HW_MUL;
+            }
+            steps++;
+        }
+        else if(eccNbHwPhase_en == CRYPTO_ECC_NB_HW_MUL)
+        {
+            mulSteps = maxSteps - steps;
+            if(mulSteps > 0xFFFFu)
+            {
+                mulSteps = 0xFFFFu;
+            }
+            hwResult = DRV_CRYPTO_ECC_MulContinue(&eccNbEccData_st, &eccNbMul_st, (u2)mulSteps, eccNbResult);
+            if(hwResult == CRYPTO_CPKCL_RESULT_POINT_SUCCESS)
+            {
+                eccNbHwPhase_en = CRYPTO_ECC_NB_HW_FINISH;
+            }
+            else if( (hwResult == CRYPTO_CPKCL_RESULT_POINT_INFINITY) && (eccNbOp_en == CRYPTO_ECC_NB_OP_VERIFY) )
+            {
+                //u1*G + u2*Q is the point at infinity, the signature is invalid
+                *ptr_eccNbVerifyStat = 0;
+                ret_nbStat_en = CRYPTO_ECC_NB_SUCCESS;
+            }
+            else if(hwResult != CRYPTO_CPKCL_RESULT_POINT_IN_PROGRESS)
+            {
+                ret_nbStat_en = CRYPTO_ECC_NB_ERROR_FAIL;
+            }
+            else
+            {
+                //Bits left
+            }
+            steps = maxSteps;
+        }
+        else
+        {
+            ret_nbStat_en = lCrypto_Ecc_Nb_Hw_Finish();
+            steps++;
+        }
+    }
+
+    return ret_nbStat_en;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Ecc_Nb_Status_E Crypto_Ecc_Nb_SignStart(crypto_HandlerType_E handlerType_en, crypto_EccCurveType_E eccCurveType_En,
+                                               uint8_t *ptr_inputHash, uint32_t hashLen, uint8_t *ptr_privKey, uint32_t privKeyLen,
+                                               uint8_t *ptr_outSig, uint32_t sigLen)
+{
+    crypto_Ecc_Nb_Status_E ret_nbStat_en = lCrypto_Ecc_Nb_Init(handlerType_en, eccCurveType_En);
+    uint32_t pointLen = (2u * eccNbKeySize) + 1u;
+
+    if(ret_nbStat_en != CRYPTO_ECC_NB_SUCCESS)
+    {
+        //Busy, or handler or curve not supported
+    }
+    else if( (ptr_inputHash == NULL) || (hashLen == 0u) || (hashLen > CRYPTO_ECC_NB_HASH_SIZE_MAX)
+            || (ptr_privKey == NULL) || (privKeyLen == 0u) || (privKeyLen > eccNbKeySize)
+            || (ptr_outSig == NULL) || (sigLen < (2u * eccNbKeySize)) )
+    {
+        ret_nbStat_en = CRYPTO_ECC_NB_ERROR_ARG;
+    }
+    else
+    {
+        eccNbOp_en = CRYPTO_ECC_NB_OP_SIGN;
+        (void) memcpy(eccNbHash, ptr_inputHash, hashLen);
+        eccNbHashLen = hashLen;
+        ptr_eccNbOut = ptr_outSig;
+
+        if(handlerType_en == CRYPTO_HANDLER_SW_WOLFCRYPT)
+        {
+            if(lCrypto_Ecc_Nb_Wc_SetKeys(ptr_privKey, privKeyLen, NULL, 0u) != 0)
+            {
+                ret_nbStat_en = CRYPTO_ECC_NB_ERROR_ARG;
+            }
+            else if(wc_InitRng(&eccNbRng_st) != 0)
+            {
+                ret_nbStat_en = CRYPTO_ECC_NB_ERROR_FAIL;
+            }
+            else
+            {
+                eccNbRngInit = true;
+            }
+        }
+        else
+        {
+            (void) memcpy(eccNbPrivKey, ptr_privKey, privKeyLen);
+            eccNbPrivKeyLen = privKeyLen;
+
+            //A precomputed pair skips the multiplication
+            if(Crypto_Ecc_Pool_Take(eccCurveType_En, eccNbScalar1, sizeof(eccNbScalar1), eccNbResult, pointLen) == CRYPTO_ECC_POOL_SUCCESS)
+            {
+                eccNbHwPhase_en = CRYPTO_ECC_NB_HW_FINISH;
+            }
+        }
+
+        if(ret_nbStat_en == CRYPTO_ECC_NB_SUCCESS)
+        {
+            ret_nbStat_en = CRYPTO_ECC_NB_IN_PROGRESS;
+        }
+        else
+        {
+            lCrypto_Ecc_Nb_End();
+        }
+    }
+
+    return ret_nbStat_en;
+}
+
+crypto_Ecc_Nb_Status_E Crypto_Ecc_Nb_VerifyStart(crypto_HandlerType_E handlerType_en, crypto_EccCurveType_E eccCurveType_En,
+                                                 uint8_t *ptr_inputHash, uint32_t hashLen, uint8_t *ptr_inputSig, uint32_t sigLen,
+                                                 uint8_t *ptr_pubKey, uint32_t pubKeyLen, int8_t *ptr_hashVerifyStat)
+{
+    crypto_Ecc_Nb_Status_E ret_nbStat_en = lCrypto_Ecc_Nb_Init(handlerType_en, eccCurveType_En);
+    uint32_t pointLen = (2u * eccNbKeySize) + 1u;
+
+    if(ret_nbStat_en != CRYPTO_ECC_NB_SUCCESS)
+    {
+        //Busy, or handler or curve not supported
+    }
+    else if( (ptr_inputHash == NULL) || (hashLen == 0u) || (hashLen > CRYPTO_ECC_NB_HASH_SIZE_MAX)
+            || (ptr_inputSig == NULL) || (sigLen != (2u * eccNbKeySize)) || (ptr_hashVerifyStat == NULL)
+            || (ptr_pubKey == NULL) || (pubKeyLen != pointLen) || (ptr_pubKey[0] != 0x04u) )
+    {
+        ret_nbStat_en = CRYPTO_ECC_NB_ERROR_ARG;
+    }
+    else
+    {
+        eccNbOp_en = CRYPTO_ECC_NB_OP_VERIFY;
+        (void) memcpy(eccNbHash, ptr_inputHash, hashLen);
+        eccNbHashLen = hashLen;
+        ptr_eccNbVerifyStat = ptr_hashVerifyStat;
+        *ptr_hashVerifyStat = 0;
+        (void) memcpy(eccNbSig, ptr_inputSig, sigLen);
+        eccNbSigInRange = lCrypto_Ecc_Nb_SigInRange(eccNbSig);
+
+        if(eccNbSigInRange == false)
+        {
+            //Crypto_Ecc_Nb_Continue ends with an invalid signature
+        }
+        else if(handlerType_en == CRYPTO_HANDLER_SW_WOLFCRYPT)
+        {
+            if( (lCrypto_Ecc_Nb_Wc_SetKeys(NULL, 0u, ptr_pubKey, pubKeyLen) != 0)
+                    || (mp_read_unsigned_bin(&eccNbR, eccNbSig, eccNbKeySize) != MP_OKAY)
+                    || (mp_read_unsigned_bin(&eccNbS, &eccNbSig[eccNbKeySize], eccNbKeySize) != MP_OKAY) )
+            {
+                ret_nbStat_en = CRYPTO_ECC_NB_ERROR_ARG;
+            }
+        }
+        else
+        {
+            (void) memcpy(eccNbPoint, ptr_pubKey, pointLen);
+        }
+
+        if(ret_nbStat_en == CRYPTO_ECC_NB_SUCCESS)
+        {
+            ret_nbStat_en = CRYPTO_ECC_NB_IN_PROGRESS;
+        }
+        else
+        {
+            lCrypto_Ecc_Nb_End();
+        }
+    }
+
+    return ret_nbStat_en;
+}
+
+crypto_Ecc_Nb_Status_E Crypto_Ecc_Nb_EcdhStart(crypto_HandlerType_E handlerType_en, crypto_EccCurveType_E eccCurveType_En,
+                                               uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                               uint8_t *ptr_sharedSecret, uint32_t sharedSecretLen)
+{
+    crypto_Ecc_Nb_Status_E ret_nbStat_en = lCrypto_Ecc_Nb_Init(handlerType_en, eccCurveType_En);
+    uint32_t pointLen = (2u * eccNbKeySize) + 1u;
+
+    if(ret_nbStat_en != CRYPTO_ECC_NB_SUCCESS)
+    {
+        //Busy, or handler or curve not supported
+    }
+    else if( (ptr_privKey == NULL) || (privKeyLen == 0u) || (privKeyLen > eccNbKeySize)
+            || (ptr_pubKey == NULL) || (pubKeyLen != pointLen) || (ptr_pubKey[0] != 0x04u)
+            || (ptr_sharedSecret == NULL) || (sharedSecretLen < eccNbKeySize) )
+    {
+        ret_nbStat_en = CRYPTO_ECC_NB_ERROR_ARG;
+    }
+    else
+    {
+        eccNbOp_en = CRYPTO_ECC_NB_OP_ECDH;
+        ptr_eccNbOut = ptr_sharedSecret;
+
+        if(handlerType_en == CRYPTO_HANDLER_SW_WOLFCRYPT)
+        {
+            if(lCrypto_Ecc_Nb_Wc_SetKeys(ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen) != 0)
+            {
+                ret_nbStat_en = CRYPTO_ECC_NB_ERROR_ARG;
+            }
+        }
+        else
+        {
+            //Private key padded to the curve size
+            (void) memset(eccNbScalar1, 0, eccNbKeySize - privKeyLen);
+            (void) memcpy(&eccNbScalar1[eccNbKeySize - privKeyLen], ptr_privKey, privKeyLen);
+            (void) memcpy(eccNbPoint, ptr_pubKey, pointLen);
+        }
+
+        if(ret_nbStat_en == CRYPTO_ECC_NB_SUCCESS)
+        {
+            ret_nbStat_en = CRYPTO_ECC_NB_IN_PROGRESS;
+        }
+        else
+        {
+            lCrypto_Ecc_Nb_End();
+        }
+    }
+
+    return ret_nbStat_en;
+}
+
+crypto_Ecc_Nb_Status_E Crypto_Ecc_Nb_Continue(uint32_t maxSteps)
+{
+    crypto_Ecc_Nb_Status_E ret_nbStat_en = CRYPTO_ECC_NB_IN_PROGRESS;
+    uint32_t steps = 0u;
+
+    if(eccNbOp_en == CRYPTO_ECC_NB_OP_NONE)
+    {
+        ret_nbStat_en = CRYPTO_ECC_NB_ERROR_IDLE;
+    }
+    else if( (eccNbOp_en == CRYPTO_ECC_NB_OP_VERIFY) && (eccNbSigInRange == false) )
+    {
+        *ptr_eccNbVerifyStat = 0;
+        ret_nbStat_en = CRYPTO_ECC_NB_SUCCESS;
+    }
+    else if(eccNbHandler_en == CRYPTO_HANDLER_SW_WOLFCRYPT)
+    {
+        while( (ret_nbStat_en == CRYPTO_ECC_NB_IN_PROGRESS) && (steps < maxSteps) )
+        {
+            ret_nbStat_en = lCrypto_Ecc_Nb_Wc_Step();
+            steps++;
+        }
+    }
+    else
+    {
+        ret_nbStat_en = lCrypto_Ecc_Nb_Hw_Run(maxSteps);
+    }
+
+    if( (ret_nbStat_en != CRYPTO_ECC_NB_IN_PROGRESS) && (ret_nbStat_en != CRYPTO_ECC_NB_ERROR_IDLE) )
+    {
+        lCrypto_Ecc_Nb_End();
+    }
+
+    return ret_nbStat_en;
+}
+
+void Crypto_Ecc_Nb_Abort(void)
+{
+    lCrypto_Ecc_Nb_End();
+}
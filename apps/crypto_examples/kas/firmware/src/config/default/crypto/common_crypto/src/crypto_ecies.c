@@ -0,0 +1,361 @@
+/*******************************************************************************
+  MPLAB Harmony Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_ecies.c
+
+  Summary:
+    ECIES hybrid encryption: ECDH, X9.63 KDF and AES-GCM in one call.
+
+  Description:
+    This file chains the ECDH of crypto_kas.c with the X9.63 KDF and AES-GCM
+    of wolfCrypt. The shared secret is hashed from the buffer the ECDH wrote it
+    to and the KDF output keys AES-GCM in place, both buffers are cleared as
+    soon as they are consumed. The secrets and the wolfCrypt objects live on
+    the stack of the caller, the functions are reentrant.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "crypto/common_crypto/crypto_ecies.h"
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/common_crypto/crypto_kas.h"
+#include "crypto/wolfcrypt/crypto_cryptocb_wc_wrapper.h"
+#include "wolfssl/wolfcrypt/error-crypt.h"
+#include "wolfssl/wolfcrypt/hash.h"
+#include "wolfssl/wolfcrypt/aes.h"
+#include "wolfssl/wolfcrypt/ecc.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_ECIES_SESSION_ID (1u)
+#define CRYPTO_ECIES_IV_SIZE (12u)
+#define CRYPTO_ECIES_AES_KEY_SIZE_MAX (32u)
+
+typedef struct
+{
+    uint32_t keySize;
+    uint32_t aesKeySize;
+    enum wc_HashType hashType_en;
+}crypto_Ecies_Params_T;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static crypto_Ecies_Status_E lCrypto_Ecies_GetParams(crypto_EccCurveType_E eccCurveType_en, crypto_Ecies_Params_T *ptr_params)
+{
+    crypto_Ecies_Status_E ret_eciesStat_en = CRYPTO_ECIES_SUCCESS;
+
+    switch(eccCurveType_en)
+    {
+        case CRYPTO_ECC_CURVE_P256:
+            ptr_params->keySize = 32u;
+            ptr_params->aesKeySize = 16u;
+            ptr_params->hashType_en = WC_HASH_TYPE_SHA256;
+            break;
+
+        case CRYPTO_ECC_CURVE_P384:
+            ptr_params->keySize = 48u;
+            ptr_params->aesKeySize = 32u;
+            ptr_params->hashType_en = WC_HASH_TYPE_SHA384;
+            break;
+
+        default:
+            ret_eciesStat_en = CRYPTO_ECIES_ERROR_CURVE;
+            break;
+    }
+
+    return ret_eciesStat_en;
+}
+
+//The hardware handler sets the wolfCrypt objects up with the device ID of the crypto callback, which hands them to the
+//SHA and AES engines. wolfCrypt runs them in software for the other handlers or when the callback is not registered.
+static int lCrypto_Ecies_GetDevId(crypto_HandlerType_E handlerType_en)
+{
+    return (handlerType_en == CRYPTO_HANDLER_HW_INTERNAL) ? CRYPTO_CRYPTOCB_WC_DEVID : INVALID_DEVID;
+}
+
+static crypto_Ecies_Status_E lCrypto_Ecies_MapKasStatus(crypto_Kas_Status_E kasStat_en)
+{
+    crypto_Ecies_Status_E ret_eciesStat_en;
+
+    switch(kasStat_en)
+    {
+        case CRYPTO_KAS_SUCCESS:
+            ret_eciesStat_en = CRYPTO_ECIES_SUCCESS;
+            break;
+
+        case CRYPTO_KAS_ERROR_PUBKEY:
+            ret_eciesStat_en = CRYPTO_ECIES_ERROR_PUBKEY;
+            break;
+
+        case CRYPTO_KAS_ERROR_PRIVKEY:
+            ret_eciesStat_en = CRYPTO_ECIES_ERROR_PRIVKEY;
+            break;
+
+        case CRYPTO_KAS_ERROR_HDLR:
+            ret_eciesStat_en = CRYPTO_ECIES_ERROR_HDLR;
+            break;
+
+        case CRYPTO_KAS_ERROR_CURVE:
+            ret_eciesStat_en = CRYPTO_ECIES_ERROR_CURVE;
+            break;
+
+        case CRYPTO_KAS_ERROR_RNG:
+            ret_eciesStat_en = CRYPTO_ECIES_ERROR_RNG;
+            break;
+
+        default:
+            ret_eciesStat_en = CRYPTO_ECIES_ERROR_FAIL;
+            break;
+    }
+
+    return ret_eciesStat_en;
+}
+
+//X9.63 KDF: the digests of Z || counter || SharedInfo, the counter from 1 on 32 bits big endian, up to outLen bytes.
+//wc_X963_KDF sets its hash up without a device ID, which would keep it off the SHA engine.
+static int lCrypto_Ecies_X963Kdf(enum wc_HashType hashType_en, int devId, const uint8_t *ptr_secret, uint32_t secretLen,
+                                 const uint8_t *ptr_sharedInfo, uint32_t sharedInfoLen, uint8_t *ptr_out, uint32_t outLen)
+{
+    wc_HashAlg hash;
+    uint8_t digest[WC_MAX_DIGEST_SIZE];
+    uint8_t counter[4];
+    uint32_t count = 1u;
+    uint32_t done = 0u;
+    uint32_t chunk;
+    int digestLen = wc_HashGetDigestSize(hashType_en);
+    int wcEciesStat = (digestLen > 0) ? 0 : BAD_FUNC_ARG;
+
+    while( (wcEciesStat == 0) && (done < outLen) )
+    {
+        counter[0] = (uint8_t)(count >> 24);
+        counter[1] = (uint8_t)(count >> 16);
+        counter[2] = (uint8_t)(count >> 8);
+        counter[3] = (uint8_t)count;
+
+        wcEciesStat = wc_HashInit_ex(&hash, hashType_en, NULL, devId);
+        if(wcEciesStat == 0)
+        {
+            wcEciesStat = wc_HashUpdate(&hash, hashType_en, ptr_secret, secretLen);
+            if(wcEciesStat == 0)
+            {
+                wcEciesStat = wc_HashUpdate(&hash, hashType_en, counter, (word32)sizeof(counter));
+            }
+            if( (wcEciesStat == 0) && (sharedInfoLen != 0u) )
+            {
+                wcEciesStat = wc_HashUpdate(&hash, hashType_en, ptr_sharedInfo, sharedInfoLen);
+            }
+            if(wcEciesStat == 0)
+            {
+                wcEciesStat = wc_HashFinal(&hash, hashType_en, digest);
+            }
+            (void) wc_HashFree(&hash, hashType_en);
+        }
+
+        if(wcEciesStat == 0)
+        {
+            chunk = ((outLen - done) < (uint32_t)digestLen) ? (outLen - done) : (uint32_t)digestLen;
+            (void) memcpy(&ptr_out[done], digest, chunk);
+            done += chunk;
+            count++;
+        }
+    }
+    (void) memset(digest, 0, sizeof(digest));
+
+    return wcEciesStat;
+}
+
+//Derives the AES key and the nonce from the shared secret, which is cleared, then runs AES-GCM over the message.
+//The tag is written to ptr_tag when encrypting and checked against it when decrypting.
+static crypto_Ecies_Status_E lCrypto_Ecies_KdfGcm(const crypto_Ecies_Params_T *ptr_params, int devId, bool encrypt,
+                                                  uint8_t *ptr_sharedSecret, uint8_t *ptr_sharedInfo, uint32_t sharedInfoLen,
+                                                  uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_in, uint32_t inLen,
+                                                  uint8_t *ptr_out, uint8_t *ptr_tag)
+{
+    crypto_Ecies_Status_E ret_eciesStat_en = CRYPTO_ECIES_SUCCESS;
+    uint8_t keyIv[CRYPTO_ECIES_AES_KEY_SIZE_MAX + CRYPTO_ECIES_IV_SIZE];
+    Aes aes;
+    int wcEciesStat;
+
+    wcEciesStat = lCrypto_Ecies_X963Kdf(ptr_params->hashType_en, devId, ptr_sharedSecret, ptr_params->keySize,
+                                        ptr_sharedInfo, sharedInfoLen, keyIv, ptr_params->aesKeySize + CRYPTO_ECIES_IV_SIZE);
+    (void) memset(ptr_sharedSecret, 0, ptr_params->keySize);
+
+    //With the device ID, the crypto callback keeps the key for the AES engine
+    if(wcEciesStat == 0)
+    {
+        wcEciesStat = wc_AesInit(&aes, NULL, devId);
+        if(wcEciesStat == 0)
+        {
+            wcEciesStat = wc_AesGcmSetKey(&aes, keyIv, ptr_params->aesKeySize);
+        }
+        if( (wcEciesStat == 0) && encrypt )
+        {
+            wcEciesStat = wc_AesGcmEncrypt(&aes, ptr_out, ptr_in, inLen, &keyIv[ptr_params->aesKeySize],
+                                           CRYPTO_ECIES_IV_SIZE, ptr_tag, CRYPTO_ECIES_TAG_SIZE, ptr_aad, aadLen);
+        }
+        else if(wcEciesStat == 0)
+        {
+            wcEciesStat = wc_AesGcmDecrypt(&aes, ptr_out, ptr_in, inLen, &keyIv[ptr_params->aesKeySize],
+                                           CRYPTO_ECIES_IV_SIZE, ptr_tag, CRYPTO_ECIES_TAG_SIZE, ptr_aad, aadLen);
+        }
+        else
+        {
+            //Key not set
+        }
+        wc_AesFree(&aes);
+        (void) memset(&aes, 0, sizeof(aes));
+    }
+    (void) memset(keyIv, 0, sizeof(keyIv));
+
+    if(wcEciesStat == AES_GCM_AUTH_E)
+    {
+        ret_eciesStat_en = CRYPTO_ECIES_ERROR_AUTH;
+    }
+    else if(wcEciesStat != 0)
+    {
+        ret_eciesStat_en = CRYPTO_ECIES_ERROR_FAIL;
+    }
+    else
+    {
+        //Sealed or opened
+    }
+
+    return ret_eciesStat_en;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Ecies_Status_E Crypto_Ecies_Encrypt(crypto_HandlerType_E handlerType_en, crypto_EccCurveType_E eccCurveType_en,
+                                           uint8_t *ptr_pubKey, uint32_t pubKeyLen, uint8_t *ptr_sharedInfo, uint32_t sharedInfoLen,
+                                           uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_msg, uint32_t msgLen,
+                                           uint8_t *ptr_cipher, uint32_t cipherLen)
+{
+    crypto_Ecies_Params_T params = {0};
+    crypto_Ecies_Status_E ret_eciesStat_en = lCrypto_Ecies_GetParams(eccCurveType_en, &params);
+    uint32_t pointSize = (2u * params.keySize) + 1u;
+    uint8_t ephPrivKey[CRYPTO_ECC_MAX_KEY_LENGTH];
+    uint8_t sharedSecret[CRYPTO_ECC_MAX_KEY_LENGTH];
+
+    if(ret_eciesStat_en != CRYPTO_ECIES_SUCCESS)
+    {
+        //Curve not supported
+    }
+    else if( (ptr_pubKey == NULL) || (pubKeyLen == 0u) )
+    {
+        ret_eciesStat_en = CRYPTO_ECIES_ERROR_PUBKEY;
+    }
+    else if( ((ptr_sharedInfo == NULL) && (sharedInfoLen != 0u)) || ((ptr_aad == NULL) && (aadLen != 0u))
+            || ((ptr_msg == NULL) && (msgLen != 0u)) || (ptr_cipher == NULL)
+            || (msgLen > (UINT32_MAX - CRYPTO_ECIES_OVERHEAD(params.keySize)))
+            || (cipherLen < (msgLen + CRYPTO_ECIES_OVERHEAD(params.keySize))) )
+    {
+        ret_eciesStat_en = CRYPTO_ECIES_ERROR_ARG;
+    }
+    else
+    {
+        //Ephemeral key pair, R goes in front of the ciphertext
+        ret_eciesStat_en = lCrypto_Ecies_MapKasStatus(Crypto_Kas_Ecdh_KeyGen(handlerType_en, ephPrivKey, params.keySize,
+                                                                             ptr_cipher, pointSize, eccCurveType_en,
+                                                                             CRYPTO_ECIES_SESSION_ID));
+        if(ret_eciesStat_en == CRYPTO_ECIES_SUCCESS)
+        {
+            ret_eciesStat_en = lCrypto_Ecies_MapKasStatus(Crypto_Kas_Ecdh_SharedSecret(handlerType_en, ephPrivKey, params.keySize,
+                                                                                       ptr_pubKey, pubKeyLen, sharedSecret,
+                                                                                       params.keySize, eccCurveType_en,
+                                                                                       CRYPTO_ECIES_SESSION_ID));
+        }
+        (void) memset(ephPrivKey, 0, sizeof(ephPrivKey));
+
+        if(ret_eciesStat_en == CRYPTO_ECIES_SUCCESS)
+        {
+            ret_eciesStat_en = lCrypto_Ecies_KdfGcm(&params, lCrypto_Ecies_GetDevId(handlerType_en), true, sharedSecret,
+                                                    ptr_sharedInfo, sharedInfoLen, ptr_aad, aadLen, ptr_msg, msgLen,
+                                                    &ptr_cipher[pointSize], &ptr_cipher[pointSize + msgLen]);
+        }
+        (void) memset(sharedSecret, 0, sizeof(sharedSecret));
+
+        if(ret_eciesStat_en != CRYPTO_ECIES_SUCCESS)
+        {
+            (void) memset(ptr_cipher, 0, msgLen + CRYPTO_ECIES_OVERHEAD(params.keySize));
+        }
+    }
+
+    return ret_eciesStat_en;
+}
+
+crypto_Ecies_Status_E Crypto_Ecies_Decrypt(crypto_HandlerType_E handlerType_en, crypto_EccCurveType_E eccCurveType_en,
+                                           uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_sharedInfo, uint32_t sharedInfoLen,
+                                           uint8_t *ptr_aad, uint32_t aadLen, uint8_t *ptr_cipher, uint32_t cipherLen,
+                                           uint8_t *ptr_msg, uint32_t msgLen)
+{
+    crypto_Ecies_Params_T params = {0};
+    crypto_Ecies_Status_E ret_eciesStat_en = lCrypto_Ecies_GetParams(eccCurveType_en, &params);
+    uint32_t pointSize = (2u * params.keySize) + 1u;
+    uint32_t plainLen = 0u;
+    uint8_t sharedSecret[CRYPTO_ECC_MAX_KEY_LENGTH];
+
+    if(ret_eciesStat_en != CRYPTO_ECIES_SUCCESS)
+    {
+        //Curve not supported
+    }
+    else if( (ptr_privKey == NULL) || (privKeyLen == 0u) || (privKeyLen > params.keySize) )
+    {
+        ret_eciesStat_en = CRYPTO_ECIES_ERROR_PRIVKEY;
+    }
+    else if( ((ptr_sharedInfo == NULL) && (sharedInfoLen != 0u)) || ((ptr_aad == NULL) && (aadLen != 0u))
+            || (ptr_cipher == NULL) || (cipherLen < CRYPTO_ECIES_OVERHEAD(params.keySize)) )
+    {
+        ret_eciesStat_en = CRYPTO_ECIES_ERROR_ARG;
+    }
+    else
+    {
+        plainLen = cipherLen - CRYPTO_ECIES_OVERHEAD(params.keySize);
+        if( ((ptr_msg == NULL) && (plainLen != 0u)) || (msgLen < plainLen) )
+        {
+            ret_eciesStat_en = CRYPTO_ECIES_ERROR_ARG;
+        }
+    }
+
+    if(ret_eciesStat_en == CRYPTO_ECIES_SUCCESS)
+    {
+        ret_eciesStat_en = lCrypto_Ecies_MapKasStatus(Crypto_Kas_Ecdh_SharedSecret(handlerType_en, ptr_privKey, privKeyLen,
+                                                                                   ptr_cipher, pointSize, sharedSecret,
+                                                                                   params.keySize, eccCurveType_en,
+                                                                                   CRYPTO_ECIES_SESSION_ID));
+        if(ret_eciesStat_en == CRYPTO_ECIES_SUCCESS)
+        {
+            ret_eciesStat_en = lCrypto_Ecies_KdfGcm(&params, lCrypto_Ecies_GetDevId(handlerType_en), false, sharedSecret,
+                                                    ptr_sharedInfo, sharedInfoLen, ptr_aad, aadLen, &ptr_cipher[pointSize],
+                                                    plainLen, ptr_msg, &ptr_cipher[pointSize + plainLen]);
+        }
+        (void) memset(sharedSecret, 0, sizeof(sharedSecret));
+
+        if( (ret_eciesStat_en != CRYPTO_ECIES_SUCCESS) && (ptr_msg != NULL) )
+        {
+            (void) memset(ptr_msg, 0, plainLen);
+        }
+    }
+
+    return ret_eciesStat_en;
+}
@@ -87,3 +87,187 @@ crypto_Kas_Status_E Crypto_Kas_Ecdh_SharedSecret(crypto_HandlerType_E ecdhHandle
     }
     return ret_ecdhStat_en;
 }
+
+crypto_Kas_Status_E Crypto_Kas_Ecdh_SharedSecretWithKey(crypto_Key_Handle_T keyHandle, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                                        uint8_t *ptr_sharedSecret, uint32_t sharedSecretLen, uint32_t ecdhSessionId)
+{
+    crypto_Kas_Status_E ret_ecdhStat_en = CRYPTO_KAS_ERROR_ALGONOTSUPPTD;
+    st_Crypto_Key_Ecc *ptr_key_st = Crypto_Key_Get(keyHandle);
+    
+    if( (ptr_pubKey == NULL) || (pubKeyLen == 0u) )
+    {
+        ret_ecdhStat_en = CRYPTO_KAS_ERROR_PUBKEY;
+    }
+    else if( (ptr_key_st == NULL) || (ptr_key_st->privKeyLen == 0u) )
+    {
+         ret_ecdhStat_en = CRYPTO_KAS_ERROR_PRIVKEY;
+    }
+    else if( (ptr_sharedSecret == NULL) || (sharedSecretLen < ptr_key_st->keySize) )
+    {
+         ret_ecdhStat_en = CRYPTO_KAS_ERROR_ARG;
+    }
+    else if((ecdhSessionId <= 0u) || (ecdhSessionId > (uint32_t)CRYPTO_KAS_SESSION_MAX) )
+    {
+        ret_ecdhStat_en = CRYPTO_KAS_ERROR_SID;
+    }
+    else
+    {
+        switch(ptr_key_st->handler_en)
+        {            
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_ecdhStat_en = Crypto_Kas_Wc_Ecdh_SharedSecretWithKey(ptr_key_st, ptr_pubKey, pubKeyLen, ptr_sharedSecret, sharedSecretLen);
+            break; 
+            case CRYPTO_HANDLER_HW_INTERNAL:
+	            ret_ecdhStat_en = Crypto_Kas_Ecdh_Hw_SharedSecret(ptr_key_st->privKey, ptr_key_st->privKeyLen, ptr_pubKey, pubKeyLen, ptr_sharedSecret,
+	                                                                    sharedSecretLen, ptr_key_st->eccCurveType_en);
+	            break;
+            default:
+                ret_ecdhStat_en = CRYPTO_KAS_ERROR_HDLR;
+                break;
+        }
+    }
+    return ret_ecdhStat_en;
+}
+
+crypto_Kas_Status_E Crypto_Kas_Ecdh_KeyGen(crypto_HandlerType_E ecdhHandlerType_en, uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                            crypto_EccCurveType_E eccCurveType_en, uint32_t ecdhSessionId)
+{
+    crypto_Kas_Status_E ret_ecdhStat_en = CRYPTO_KAS_ERROR_ALGONOTSUPPTD;
+    
+    if( (ptr_pubKey == NULL) || (pubKeyLen == 0u) )
+    {
+        ret_ecdhStat_en = CRYPTO_KAS_ERROR_PUBKEY;
+    }
+    else if( (ptr_privKey == NULL) || (privKeyLen == 0u) )
+    {
+         ret_ecdhStat_en = CRYPTO_KAS_ERROR_PRIVKEY;
+    }
+    else if( (eccCurveType_en <= CRYPTO_ECC_CURVE_INVALID) || (eccCurveType_en >= CRYPTO_ECC_CURVE_MAX) )
+    {
+         ret_ecdhStat_en = CRYPTO_KAS_ERROR_CURVE;
+    }
+    else if((ecdhSessionId <= 0u) || (ecdhSessionId > (uint32_t)CRYPTO_KAS_SESSION_MAX) )
+    {
+        ret_ecdhStat_en = CRYPTO_KAS_ERROR_SID;
+    }
+    else
+    {
+        switch(ecdhHandlerType_en)
+        {            
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_ecdhStat_en = Crypto_Kas_Wc_Ecdh_KeyGen(ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen, eccCurveType_en);
+            break; 
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_ecdhStat_en = Crypto_Kas_Ecdh_Hw_KeyGen(ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen, eccCurveType_en);
+            break;
+            default:
+                ret_ecdhStat_en = CRYPTO_KAS_ERROR_HDLR;
+            break;
+        }
+    }
+    return ret_ecdhStat_en;
+}
+
+static uint32_t lCrypto_Kas_Dh_GetPrimeSize(crypto_Kas_DhGroup_E dhGroup_en)
+{
+    uint32_t primeSize = 0u;
+    
+    if(dhGroup_en == CRYPTO_KAS_DH_GROUP_FFDHE2048)
+    {
+        primeSize = CRYPTO_KAS_DH_FFDHE2048_SIZE;
+    }
+    else if(dhGroup_en == CRYPTO_KAS_DH_GROUP_FFDHE3072)
+    {
+        primeSize = CRYPTO_KAS_DH_FFDHE3072_SIZE;
+    }
+    else
+    {
+        primeSize = 0u;
+    }
+    return primeSize;
+}
+
+crypto_Kas_Status_E Crypto_Kas_Dh_KeyGen(crypto_HandlerType_E dhHandlerType_en, uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                            crypto_Kas_DhGroup_E dhGroup_en, uint32_t dhSessionId)
+{
+    crypto_Kas_Status_E ret_dhStat_en = CRYPTO_KAS_ERROR_ALGONOTSUPPTD;
+    
+    if( (dhGroup_en <= CRYPTO_KAS_DH_GROUP_INVALID) || (dhGroup_en >= CRYPTO_KAS_DH_GROUP_MAX) )
+    {
+         ret_dhStat_en = CRYPTO_KAS_ERROR_CURVE;
+    }
+    else if( (ptr_pubKey == NULL) || (pubKeyLen < lCrypto_Kas_Dh_GetPrimeSize(dhGroup_en)) )
+    {
+        ret_dhStat_en = CRYPTO_KAS_ERROR_PUBKEY;
+    }
+    else if( (ptr_privKey == NULL) || (privKeyLen == 0u) )
+    {
+         ret_dhStat_en = CRYPTO_KAS_ERROR_PRIVKEY;
+    }
+    else if((dhSessionId <= 0u) || (dhSessionId > (uint32_t)CRYPTO_KAS_SESSION_MAX) )
+    {
+        ret_dhStat_en = CRYPTO_KAS_ERROR_SID;
+    }
+    else
+    {
+        switch(dhHandlerType_en)
+        {            
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_dhStat_en = Crypto_Kas_Wc_Dh_KeyGen(ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen, dhGroup_en);
+            break; 
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_dhStat_en = Crypto_Kas_Dh_Hw_KeyGen(ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen, dhGroup_en);
+            break;
+            default:
+                ret_dhStat_en = CRYPTO_KAS_ERROR_HDLR;
+            break;
+        }
+    }
+    return ret_dhStat_en;
+}
+
+crypto_Kas_Status_E Crypto_Kas_Dh_SharedSecret(crypto_HandlerType_E dhHandlerType_en, uint8_t *ptr_privKey, uint32_t privKeyLen, uint8_t *ptr_pubKey, uint32_t pubKeyLen,
+                                                uint8_t *ptr_sharedSecret, uint32_t sharedSecretLen, crypto_Kas_DhGroup_E dhGroup_en, uint32_t dhSessionId)
+{
+    crypto_Kas_Status_E ret_dhStat_en = CRYPTO_KAS_ERROR_ALGONOTSUPPTD;
+    uint32_t primeSize = lCrypto_Kas_Dh_GetPrimeSize(dhGroup_en);
+    
+    if(primeSize == 0u)
+    {
+         ret_dhStat_en = CRYPTO_KAS_ERROR_CURVE;
+    }
+    else if( (ptr_pubKey == NULL) || (pubKeyLen != primeSize) )
+    {
+        ret_dhStat_en = CRYPTO_KAS_ERROR_PUBKEY;
+    }
+    else if( (ptr_privKey == NULL) || (privKeyLen == 0u) || (privKeyLen >= primeSize) )
+    {
+         ret_dhStat_en = CRYPTO_KAS_ERROR_PRIVKEY;
+    }
+    else if( (ptr_sharedSecret == NULL) || (sharedSecretLen < primeSize) )
+    {
+         ret_dhStat_en = CRYPTO_KAS_ERROR_ARG;
+    }
+    else if((dhSessionId <= 0u) || (dhSessionId > (uint32_t)CRYPTO_KAS_SESSION_MAX) )
+    {
+        ret_dhStat_en = CRYPTO_KAS_ERROR_SID;
+    }
+    else
+    {
+        switch(dhHandlerType_en)
+        {            
+            case CRYPTO_HANDLER_SW_WOLFCRYPT:
+                ret_dhStat_en = Crypto_Kas_Wc_Dh_SharedSecret(ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen, ptr_sharedSecret,
+                                                                sharedSecretLen, dhGroup_en);
+            break; 
+            case CRYPTO_HANDLER_HW_INTERNAL:
+                ret_dhStat_en = Crypto_Kas_Dh_Hw_SharedSecret(ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen, ptr_sharedSecret,
+                                                                sharedSecretLen, dhGroup_en);
+            break;
+            default:
+                ret_dhStat_en = CRYPTO_KAS_ERROR_HDLR;
+            break;
+        }
+    }
+    return ret_dhStat_en;
+}
@@ -0,0 +1,388 @@
+/*******************************************************************************
+  MPLAB Harmony Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_key.c
+
+  Summary:
+    Persistent ECC key handles.
+
+  Description:
+    This file keeps imported ECC keys in a fixed number of slots. The wolfCrypt
+    handler imports the key into an ecc_key and instantiates a DRBG once, the
+    signatures and shared secrets then start from them instead of parsing the
+    key and seeding a DRBG on every call; the public key point also stays the
+    same, so the FP_ECC tables wolfCrypt caches for it keep being hit. The
+    hardware handler keeps the raw private key and the uncompressed public key,
+    a compressed key being decompressed on the CPKCC once at import.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "crypto/common_crypto/crypto_key.h"
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/drivers/driver/drv_crypto_ecc_hw_cpkcl.h"
+#include "crypto/wolfcrypt/crypto_common_wc_wrapper.h"
+#include "wolfssl/wolfcrypt/error-crypt.h"
+#include "wolfssl/wolfcrypt/random.h"
+#include "wolfssl/wolfcrypt/ecc.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+//The low byte of a handle is its slot plus one, the upper bytes the import count
+#define CRYPTO_KEY_HANDLE_SLOT_MASK (0xFFU)
+#define CRYPTO_KEY_HANDLE_COUNT_SHIFT (8U)
+
+static st_Crypto_Key_Ecc keySlot_st[CRYPTO_KEY_SLOTS];
+static crypto_Key_Handle_T keySlotHandle[CRYPTO_KEY_SLOTS];
+static ecc_key keyWcEccKey_st[CRYPTO_KEY_SLOTS];
+static WC_RNG keyWcRng_st[CRYPTO_KEY_SLOTS];
+static uint32_t keyImportCount = 0U;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static CRYPTO_CPKCL_CURVE lCrypto_Key_GetHwCurve(crypto_EccCurveType_E eccCurveType_en)
+{
+    CRYPTO_CPKCL_CURVE hwCurve;
+
+    switch(eccCurveType_en)
+    {
+        case CRYPTO_ECC_CURVE_P192:
+            hwCurve = CRYPTO_CPKCL_CURVE_P192;
+            break;
+
+        case CRYPTO_ECC_CURVE_P224:
+            hwCurve = CRYPTO_CPKCL_CURVE_P224;
+            break;
+
+        case CRYPTO_ECC_CURVE_P256:
+            hwCurve = CRYPTO_CPKCL_CURVE_P256;
+            break;
+
+        case CRYPTO_ECC_CURVE_P384:
+            hwCurve = CRYPTO_CPKCL_CURVE_P384;
+            break;
+
+        case CRYPTO_ECC_CURVE_P521:
+            hwCurve = CRYPTO_CPKCL_CURVE_P521;
+            break;
+
+        case CRYPTO_ECC_CURVE_SECT233K1:
+            hwCurve = CRYPTO_CPKCL_CURVE_SECT233K1;
+            break;
+
+        case CRYPTO_ECC_CURVE_SECT233R1:
+            hwCurve = CRYPTO_CPKCL_CURVE_SECT233R1;
+            break;
+
+        case CRYPTO_ECC_CURVE_SECT283K1:
+            hwCurve = CRYPTO_CPKCL_CURVE_SECT283K1;
+            break;
+
+        case CRYPTO_ECC_CURVE_SECT283R1:
+            hwCurve = CRYPTO_CPKCL_CURVE_SECT283R1;
+            break;
+
+        case CRYPTO_ECC_CURVE_BRAINPOOLP256R1:
+            hwCurve = CRYPTO_CPKCL_CURVE_BP256R1;
+            break;
+
+        case CRYPTO_ECC_CURVE_BRAINPOOLP384R1:
+            hwCurve = CRYPTO_CPKCL_CURVE_BP384R1;
+            break;
+
+        case CRYPTO_ECC_CURVE_SECP256K1:
+            hwCurve = CRYPTO_CPKCL_CURVE_SECP256K1;
+            break;
+
+        default:
+            hwCurve = CRYPTO_CPKCL_CURVE_CUSTOM;
+            break;
+    }
+
+    return hwCurve;
+}
+
+static crypto_Key_Status_E lCrypto_Key_Hw_Import(st_Crypto_Key_Ecc *ptr_key_st, uint8_t *ptr_privKey, uint32_t privKeyLen,
+                                                 uint8_t *ptr_pubKey, uint32_t pubKeyLen)
+{
+    crypto_Key_Status_E ret_keyStat_en = CRYPTO_KEY_SUCCESS;
+    CRYPTO_CPKCL_CURVE hwCurve = lCrypto_Key_GetHwCurve(ptr_key_st->eccCurveType_en);
+    CPKCL_ECC_DATA eccData;
+    uint32_t keySize;
+
+    if(DRV_CRYPTO_ECC_CheckCpkcl() != CRYPTO_CPKCL_RESULT_INIT_SUCCESS)
+    {
+        ret_keyStat_en = CRYPTO_KEY_ERROR_FAIL;
+    }
+    else if(DRV_CRYPTO_ECC_InitCurveParams(&eccData, hwCurve) != CRYPTO_CPKCL_RESULT_CURVE_SUCCESS)
+    {
+        ret_keyStat_en = CRYPTO_KEY_ERROR_CURVE;
+    }
+    else
+    {
+        keySize = (uint32_t)eccData.u2KeySize;
+        ptr_key_st->keySize = keySize;
+
+        if(ptr_privKey != NULL)
+        {
+            if(privKeyLen > keySize)
+            {
+                ret_keyStat_en = CRYPTO_KEY_ERROR_PRIVKEY;
+            }
+            else
+            {
+                (void) memcpy(ptr_key_st->privKey, ptr_privKey, privKeyLen);
+                ptr_key_st->privKeyLen = privKeyLen;
+            }
+        }
+
+        if( (ret_keyStat_en == CRYPTO_KEY_SUCCESS) && (ptr_pubKey != NULL) )
+        {
+            if(ptr_pubKey[0] == 0x04U)
+            {
+                if(pubKeyLen < ((2U * keySize) + 1U))
+                {
+                    ret_keyStat_en = CRYPTO_KEY_ERROR_PUBKEY;
+                }
+                else
+                {
+                    (void) memcpy(ptr_key_st->pubKey, ptr_pubKey, (2U * keySize) + 1U);
+                }
+            }
+            //Y is computed once here, the verifications then skip the modular square root
+            else if( (pubKeyLen < (keySize + 1U))
+                    || (DRV_CRYPTO_ECC_SetPubKeyCoordinates(&eccData, (pfu1)ptr_pubKey, (pfu1)&ptr_key_st->pubKey[1],
+                                                            (pfu1)&ptr_key_st->pubKey[1U + keySize], hwCurve) != CRYPTO_CPKCL_RESULT_CURVE_SUCCESS) )
+            {
+                ret_keyStat_en = CRYPTO_KEY_ERROR_PUBKEY;
+            }
+            else
+            {
+                ptr_key_st->pubKey[0] = 0x04U;
+            }
+
+            if(ret_keyStat_en == CRYPTO_KEY_SUCCESS)
+            {
+                ptr_key_st->pubKeyLen = (2U * keySize) + 1U;
+            }
+        }
+    }
+
+    return ret_keyStat_en;
+}
+
+static crypto_Key_Status_E lCrypto_Key_Wc_Import(uint32_t slot, uint8_t *ptr_privKey, uint32_t privKeyLen,
+                                                 uint8_t *ptr_pubKey, uint32_t pubKeyLen)
+{
+    crypto_Key_Status_E ret_keyStat_en;
+    st_Crypto_Key_Ecc *ptr_key_st = &keySlot_st[slot];
+    ecc_key *ptr_wcEccKey_st = &keyWcEccKey_st[slot];
+    WC_RNG *ptr_wcRng_st = &keyWcRng_st[slot];
+    int wcEccCurveId = Crypto_Common_Wc_Ecc_GetWcCurveId(ptr_key_st->eccCurveType_en);
+    int wcKeyStat;
+    word32 pubLen = (word32)sizeof(ptr_key_st->pubKey);
+
+    if(wcEccCurveId == (int)ECC_CURVE_INVALID)
+    {
+        ret_keyStat_en = CRYPTO_KEY_ERROR_CURVE;
+    }
+    else if(wc_InitRng(ptr_wcRng_st) != 0)
+    {
+        ret_keyStat_en = CRYPTO_KEY_ERROR_RNG;
+    }
+    else
+    {
+        wcKeyStat = wc_ecc_init(ptr_wcEccKey_st);
+
+        if(wcKeyStat == 0)
+        {
+            if(ptr_privKey != NULL)
+            {
+                //The public part is optional
+                wcKeyStat = wc_ecc_import_private_key_ex(ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen,
+                                                         ptr_wcEccKey_st, wcEccCurveId);
+            }
+            else
+            {
+                wcKeyStat = wc_ecc_import_x963_ex(ptr_pubKey, pubKeyLen, ptr_wcEccKey_st, wcEccCurveId);
+            }
+
+            if( (wcKeyStat == 0) && (ptr_pubKey != NULL) )
+            {
+                wcKeyStat = wc_ecc_export_x963(ptr_wcEccKey_st, ptr_key_st->pubKey, &pubLen);
+            }
+            if(wcKeyStat == 0)
+            {
+                //Blinding of the private key operations draws from the slot's DRBG
+                wcKeyStat = wc_ecc_set_rng(ptr_wcEccKey_st, ptr_wcRng_st);
+            }
+            if(wcKeyStat != 0)
+            {
+                (void)wc_ecc_free(ptr_wcEccKey_st);
+            }
+        }
+
+        if(wcKeyStat == 0)
+        {
+            ptr_key_st->keySize = (uint32_t)wc_ecc_get_curve_size_from_id(wcEccCurveId);
+            ptr_key_st->privKeyLen = (ptr_privKey != NULL) ? ptr_key_st->keySize : 0U;
+            ptr_key_st->pubKeyLen = (ptr_pubKey != NULL) ? (uint32_t)pubLen : 0U;
+            ptr_key_st->ptr_wcEccKey = ptr_wcEccKey_st;
+            ptr_key_st->ptr_wcRng = ptr_wcRng_st;
+            ret_keyStat_en = CRYPTO_KEY_SUCCESS;
+        }
+        else
+        {
+            (void)wc_FreeRng(ptr_wcRng_st);
+
+            if(wcKeyStat == ECC_CURVE_OID_E)
+            {
+                ret_keyStat_en = CRYPTO_KEY_ERROR_CURVE;
+            }
+            else if(ptr_privKey != NULL)
+            {
+                ret_keyStat_en = CRYPTO_KEY_ERROR_PRIVKEY;
+            }
+            else
+            {
+                ret_keyStat_en = CRYPTO_KEY_ERROR_PUBKEY;
+            }
+        }
+    }
+
+    return ret_keyStat_en;
+}
+
+static void lCrypto_Key_Clear(uint32_t slot)
+{
+    if(keySlot_st[slot].ptr_wcEccKey != NULL)
+    {
+        (void)wc_ecc_free(&keyWcEccKey_st[slot]);
+        (void)wc_FreeRng(&keyWcRng_st[slot]);
+    }
+
+    (void) memset(&keySlot_st[slot], 0, sizeof(keySlot_st[slot]));
+    (void) memset(&keyWcEccKey_st[slot], 0, sizeof(keyWcEccKey_st[slot]));
+    keySlotHandle[slot] = CRYPTO_KEY_HANDLE_INVALID;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+crypto_Key_Status_E Crypto_Key_Import(crypto_HandlerType_E handlerType_en, uint8_t *ptr_privKey, uint32_t privKeyLen,
+                                      uint8_t *ptr_pubKey, uint32_t pubKeyLen, crypto_EccCurveType_E eccCurveType_en,
+                                      crypto_Key_Handle_T *ptr_keyHandle)
+{
+    crypto_Key_Status_E ret_keyStat_en = CRYPTO_KEY_ERROR_FULL;
+    uint32_t slot;
+
+    if(ptr_keyHandle == NULL)
+    {
+        ret_keyStat_en = CRYPTO_KEY_ERROR_HANDLE;
+    }
+    else if( (eccCurveType_en <= CRYPTO_ECC_CURVE_INVALID) || (eccCurveType_en >= CRYPTO_ECC_CURVE_MAX) )
+    {
+        ret_keyStat_en = CRYPTO_KEY_ERROR_CURVE;
+    }
+    else if( ((ptr_privKey == NULL) && (ptr_pubKey == NULL))
+            || ((ptr_privKey != NULL) && ((privKeyLen == 0U) || (privKeyLen > (uint32_t)CRYPTO_ECC_MAX_KEY_LENGTH))) )
+    {
+        ret_keyStat_en = CRYPTO_KEY_ERROR_PRIVKEY;
+    }
+    //Check the Key compression Type, 0x04 for uncompressed, 0x02 for Even compressed and 0x03 for Odd compressed
+    else if( (ptr_pubKey != NULL)
+            && ( (pubKeyLen == 0U) || !( (ptr_pubKey[0] == 0x04U) || (ptr_pubKey[0] == 0x02U) || (ptr_pubKey[0] == 0x03U) ) ) )
+    {
+        ret_keyStat_en = CRYPTO_KEY_ERROR_PUBKEY;
+    }
+    else if( (handlerType_en != CRYPTO_HANDLER_HW_INTERNAL) && (handlerType_en != CRYPTO_HANDLER_SW_WOLFCRYPT) )
+    {
+        ret_keyStat_en = CRYPTO_KEY_ERROR_HDLR;
+    }
+    else
+    {
+        for(slot = 0U; slot < CRYPTO_KEY_SLOTS; slot++)
+        {
+            if(keySlotHandle[slot] == CRYPTO_KEY_HANDLE_INVALID)
+            {
+                break;
+            }
+        }
+
+        if(slot < CRYPTO_KEY_SLOTS)
+        {
+            (void) memset(&keySlot_st[slot], 0, sizeof(keySlot_st[slot]));
+            keySlot_st[slot].handler_en = handlerType_en;
+            keySlot_st[slot].eccCurveType_en = eccCurveType_en;
+
+            if(handlerType_en == CRYPTO_HANDLER_HW_INTERNAL)
+            {
+                ret_keyStat_en = lCrypto_Key_Hw_Import(&keySlot_st[slot], ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen);
+            }
+            else
+            {
+                ret_keyStat_en = lCrypto_Key_Wc_Import(slot, ptr_privKey, privKeyLen, ptr_pubKey, pubKeyLen);
+            }
+
+            if(ret_keyStat_en == CRYPTO_KEY_SUCCESS)
+            {
+                keyImportCount++;
+                keySlotHandle[slot] = (keyImportCount << CRYPTO_KEY_HANDLE_COUNT_SHIFT) | (slot + 1U);
+                *ptr_keyHandle = keySlotHandle[slot];
+            }
+            else
+            {
+                lCrypto_Key_Clear(slot);
+            }
+        }
+    }
+
+    return ret_keyStat_en;
+}
+
+crypto_Key_Status_E Crypto_Key_Destroy(crypto_Key_Handle_T keyHandle)
+{
+    crypto_Key_Status_E ret_keyStat_en = CRYPTO_KEY_ERROR_HANDLE;
+    uint32_t slot = (keyHandle & CRYPTO_KEY_HANDLE_SLOT_MASK) - 1U;
+
+    if( (Crypto_Key_Get(keyHandle) != NULL) && (slot < CRYPTO_KEY_SLOTS) )
+    {
+        lCrypto_Key_Clear(slot);
+        ret_keyStat_en = CRYPTO_KEY_SUCCESS;
+    }
+
+    return ret_keyStat_en;
+}
+
+st_Crypto_Key_Ecc *Crypto_Key_Get(crypto_Key_Handle_T keyHandle)
+{
+    st_Crypto_Key_Ecc *ptr_key_st = NULL;
+    uint32_t slot = (keyHandle & CRYPTO_KEY_HANDLE_SLOT_MASK) - 1U;
+
+    if( (keyHandle != CRYPTO_KEY_HANDLE_INVALID) && (slot < CRYPTO_KEY_SLOTS) && (keySlotHandle[slot] == keyHandle) )
+    {
+        ptr_key_st = &keySlot_st[slot];
+    }
+
+    return ptr_key_st;
+}
@@ -0,0 +1,149 @@
+/**************************************************************************
+  Crypto Framework Library Header
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_crypto_dh_hw_cpkcl.h
+  
+  Summary:
+    Crypto Framework Library header for the CPKCC finite field Diffie-Hellman
+    functions.
+
+  Description:
+    This header contains the function definitions for the CPKCC Diffie-Hellman
+    functions on the RFC 7919 ffdhe2048 and ffdhe3072 groups, built on the
+    ExpMod service.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2024, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+#ifndef DRV_CRYPTO_DH_HW_CPKCL_H
+#define DRV_CRYPTO_DH_HW_CPKCL_H
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stdint.h>
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_typedef_pb.h"
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    extern "C" {
+
+#endif
+// DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Macro Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Prime sizes in bytes, public keys and shared secrets take the full size */
+#define CRYPTO_DH_FFDHE2048_SIZE        (256U)
+#define CRYPTO_DH_FFDHE3072_SIZE        (384U)
+
+/* Generated private key sizes in bytes, twice the strength of the group as
+   wolfCrypt picks them */
+#define CRYPTO_DH_FFDHE2048_PRIV_SIZE   (29U)
+#define CRYPTO_DH_FFDHE3072_PRIV_SIZE   (34U)
+
+//******************************************************************************
+// Memory mapping for modular exponentiation, a is the prime size
+//******************************************************************************
+#define BASE_DH_EXPMOD_MODULO(a)        (MSB_EXTENT_CRYPTORAM | nu1CRYPTORAM_BASE)
+#define BASE_DH_EXPMOD_CNS(a)           (BASE_DH_EXPMOD_MODULO(a) + a + 4)
+#define BASE_DH_EXPMOD_X(a)             (BASE_DH_EXPMOD_CNS(a) + a + 12)
+#define BASE_DH_EXPMOD_PRECOMP(a)       (BASE_DH_EXPMOD_X(a) + 3*a + 24)
+#define BASE_DH_EXPMOD_EXPONENT(a)      (BASE_DH_EXPMOD_PRECOMP(a) + 3*a + 24)
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Types
+// *****************************************************************************
+// *****************************************************************************
+
+typedef enum
+{
+    CRYPTO_DH_GROUP_FFDHE2048,
+    CRYPTO_DH_GROUP_FFDHE3072
+} CRYPTO_DH_GROUP;
+
+typedef enum
+{
+    CRYPTO_DH_RESULT_SUCCESS,
+    CRYPTO_DH_RESULT_INIT_FAIL,
+    CRYPTO_DH_RESULT_ERROR_GROUP,
+    CRYPTO_DH_RESULT_ERROR_PRIVKEY,
+    CRYPTO_DH_RESULT_ERROR_PUBKEY,
+    CRYPTO_DH_RESULT_ERROR_RNG,
+    CRYPTO_DH_RESULT_ERROR_FAIL
+} CRYPTO_DH_RESULT;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: CPKCC DH Common Interface 
+// *****************************************************************************
+// *****************************************************************************
+
+/* Size of the prime and of the generated private keys of a group, 0 for an
+   unknown group */
+u2 DRV_CRYPTO_DH_GetPrimeSize(CRYPTO_DH_GROUP group);
+
+u2 DRV_CRYPTO_DH_GetPrivKeySize(CRYPTO_DH_GROUP group);
+
+/* x random with its top bits set, y = 2^x mod p. x is written on the private
+   key size and y on the prime size, both MSB first. */
+CRYPTO_DH_RESULT DRV_CRYPTO_DH_KeyGen(CRYPTO_DH_GROUP group, pfu1 privKey, 
+    pfu1 pubKey);
+
+/* Checks 1 < y < p - 1, y MSB first on the prime size. The groups are safe
+   primes, the only small subgroup is {1, p - 1}, so this is the full public
+   key validation. */
+CRYPTO_DH_RESULT DRV_CRYPTO_DH_CheckPubKey(CRYPTO_DH_GROUP group, 
+    pfu1 pubKey);
+
+/* Z = y^x mod p, written on the prime size with its leading zeros. The peer
+   key is checked first and Z = 1 is rejected. x is shorter than p and above
+   1, the exponentiation is regular and runs on the private key length. */
+CRYPTO_DH_RESULT DRV_CRYPTO_DH_SharedSecret(CRYPTO_DH_GROUP group, 
+    pfu1 privKey, u2 privKeyLen, pfu1 pubKey, pfu1 sharedSecret);
+
+// DOM-IGNORE-BEGIN
+#ifdef __cplusplus  // Provide C++ Compatibility
+
+    }
+
+#endif
+// DOM-IGNORE-END
+
+#endif /* DRV_CRYPTO_DH_HW_CPKCL_H */
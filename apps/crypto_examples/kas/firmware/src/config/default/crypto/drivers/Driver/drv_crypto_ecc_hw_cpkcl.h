@@ -51,6 +51,7 @@ Microchip or any third party.
 // *****************************************************************************
 
 #include <stdint.h>
+#include <stdbool.h>
 #include "../CPKCL_Lib/CryptoLib_typedef_pb.h"
 #include "../CPKCL_Lib/CryptoLib_Headers_pb.h"
 
@@ -126,6 +127,25 @@ extern CPKCL_PARAM     CPKCLParam;
 #define BASE_ECDSAV_A(a,b)              (BASE_ECDSAV_PUBLIC_KEY_Z(a,b) + a + 4)
 #define BASE_ECDSAV_WORKSPACE(a,b)      (BASE_ECDSAV_A(a,b) + a + 4)
 
+//******************************************************************************
+// Memory mappings for binary curves: the GF(2^n) services read a and b 
+// together at the "a" address, everything after a moves up by one operand
+//******************************************************************************
+#define BASE_GF2N_SCA_MUL_B(a,b)        (BASE_SCA_MUL_A(a,b) + a + 4)
+#define BASE_GF2N_SCA_MUL_SCALAR(a,b)   (BASE_GF2N_SCA_MUL_B(a,b) + a + 4)
+#define BASE_GF2N_SCA_MUL_ORDER(a,b)    (BASE_GF2N_SCA_MUL_SCALAR(a,b) + b + 4)
+#define BASE_GF2N_SCA_MUL_WORKSPACE(a,b) (BASE_GF2N_SCA_MUL_ORDER(a,b) + b + 4)
+
+#define BASE_GF2N_ECDSA_B(a,b)          (BASE_ECDSA_A(a,b) + a + 4)
+#define BASE_GF2N_PRIVATE_KEY(a,b)      (BASE_GF2N_ECDSA_B(a,b) + a + 4)
+#define BASE_GF2N_ECDSA_SCALAR(a,b)     (BASE_GF2N_PRIVATE_KEY(a,b) + b + 4)
+#define BASE_GF2N_ECDSA_ORDER(a,b)      (BASE_GF2N_ECDSA_SCALAR(a,b) + b + 4)
+#define BASE_GF2N_ECDSA_HASH(a,b)       (BASE_GF2N_ECDSA_ORDER(a,b) + b + 4)
+#define BASE_GF2N_ECDSA_WORKSPACE(a,b)  (BASE_GF2N_ECDSA_HASH(a,b) + b + 4)
+
+#define BASE_GF2N_ECDSAV_B(a,b)         (BASE_ECDSAV_A(a,b) + a + 4)
+#define BASE_GF2N_ECDSAV_WORKSPACE(a,b) (BASE_GF2N_ECDSAV_B(a,b) + a + 4)
+
 //******************************************************************************
 // Memory mapping for ECDH key agreement
 //******************************************************************************
@@ -181,6 +201,29 @@ extern CPKCL_PARAM     CPKCLParam;
 #define BASE_ADDITION_POINT_B_Z(a)      (BASE_ADDITION_POINT_B_Y(a) + a + 4)
 #define BASE_ADDITION_WORKSPACE(a)      (BASE_ADDITION_POINT_B_Z(a) + a + 4)
 
+//******************************************************************************
+// Memory mapping for point arithmetic: slot 0 is the accumulator, slots 1 to 3 
+// hold P1, P2 and P1 + P2 for the double scalar multiplication, each slot is 
+// a projective point X, Y, Z. The workspace takes the rest of the crypto RAM.
+//******************************************************************************
+#define BASE_POINT_MODULO(a)            (MSB_EXTENT_CRYPTORAM | nu1CRYPTORAM_BASE)
+#define BASE_POINT_CNS(a)               (BASE_POINT_MODULO(a) + a + 4)
+#define BASE_POINT_A(a)                 (BASE_POINT_CNS(a) + a + 12)
+#define BASE_POINT_SLOT(a,i)            (BASE_POINT_A(a) + a + 4 + (i)*(3*a + 12))
+#define BASE_POINT_SLOT_X(a,i)          (BASE_POINT_SLOT(a,i))
+#define BASE_POINT_SLOT_Y(a,i)          (BASE_POINT_SLOT_X(a,i) + a + 4)
+#define BASE_POINT_SLOT_Z(a,i)          (BASE_POINT_SLOT_Y(a,i) + a + 4)
+#define BASE_POINT_WORKSPACE(a)         (BASE_POINT_SLOT(a,4))
+
+//******************************************************************************
+// Memory mapping for modular exponentiation, used for point decompression
+//******************************************************************************
+#define BASE_EXPMOD_MODULO(a)           (MSB_EXTENT_CRYPTORAM | nu1CRYPTORAM_BASE)
+#define BASE_EXPMOD_CNS(a)              (BASE_EXPMOD_MODULO(a) + a + 4)
+#define BASE_EXPMOD_X(a)                (BASE_EXPMOD_CNS(a) + a + 12)
+#define BASE_EXPMOD_PRECOMP(a)          (BASE_EXPMOD_X(a) + 3*a + 24)
+#define BASE_EXPMOD_EXPONENT(a)         (BASE_EXPMOD_PRECOMP(a) + 3*a + 24)
+
 // *****************************************************************************
 // Size of ECC public keys
 // *****************************************************************************
@@ -190,6 +233,8 @@ extern CPKCL_PARAM     CPKCLParam;
 #define P256_PUBLIC_KEY_SIZE      64
 #define P384_PUBLIC_KEY_SIZE      96
 #define P521_PUBLIC_KEY_SIZE      132
+#define SECT233_PUBLIC_KEY_SIZE   60
+#define SECT283_PUBLIC_KEY_SIZE   72
 
 // *****************************************************************************
 // Size of ECC coordinates for public keys
@@ -200,6 +245,15 @@ extern CPKCL_PARAM     CPKCLParam;
 #define P256_PUBLIC_KEY_COORDINATE_SIZE      32
 #define P384_PUBLIC_KEY_COORDINATE_SIZE      48
 #define P521_PUBLIC_KEY_COORDINATE_SIZE      66
+#define SECT233_PUBLIC_KEY_COORDINATE_SIZE   30
+#define SECT283_PUBLIC_KEY_COORDINATE_SIZE   36
+
+// *****************************************************************************
+// Largest operand in the crypto RAM, P-521 values are rounded up to a 
+// multiple of 4 bytes
+// *****************************************************************************
+
+#define CPKCL_ECC_MAX_OPERAND_SIZE           68
 
 // *****************************************************************************
 // *****************************************************************************
@@ -216,6 +270,14 @@ typedef enum
     CRYPTO_CPKCL_RESULT_CURVE_ERROR,
     CRYPTO_CPKCL_RESULT_COORD_SUCCESS,
     CRYPTO_CPKCL_RESULT_COORD_COMPRESS_ERROR,
+    CRYPTO_CPKCL_RESULT_KEYGEN_SUCCESS,
+    CRYPTO_CPKCL_RESULT_KEYGEN_RNG_ERROR,
+    CRYPTO_CPKCL_RESULT_KEYGEN_ERROR,
+    CRYPTO_CPKCL_RESULT_POINT_SUCCESS,
+    CRYPTO_CPKCL_RESULT_POINT_INFINITY,     // Result is the point at infinity
+    CRYPTO_CPKCL_RESULT_POINT_DEGENERATE,   // An addition met equal points
+    CRYPTO_CPKCL_RESULT_POINT_ERROR,
+    CRYPTO_CPKCL_RESULT_POINT_IN_PROGRESS,  // Bits left, see DRV_CRYPTO_ECC_MulContinue
 } CRYPTO_CPKCL_RESULT;
 
 /* Curve Types */
@@ -228,8 +290,87 @@ typedef enum
     CRYPTO_CPKCL_CURVE_P256 = 3,        
     CRYPTO_CPKCL_CURVE_P384 = 4,
     CRYPTO_CPKCL_CURVE_P521 = 5, 
+    
+    /* Binary Curves */
+    CRYPTO_CPKCL_CURVE_SECT233K1 = 6,
+    CRYPTO_CPKCL_CURVE_SECT233R1 = 7,
+    CRYPTO_CPKCL_CURVE_SECT283K1 = 8,
+    CRYPTO_CPKCL_CURVE_SECT283R1 = 9,
+    
+    /* Other Weierstrass Prime Curves */
+    CRYPTO_CPKCL_CURVE_BP256R1 = 10,
+    CRYPTO_CPKCL_CURVE_BP384R1 = 11,
+    CRYPTO_CPKCL_CURVE_SECP256K1 = 12,
+    
+    /* Curve set by DRV_CRYPTO_ECC_SetCustomCurve */
+    CRYPTO_CPKCL_CURVE_CUSTOM = 13,
 } CRYPTO_CPKCL_CURVE;
 
+/* Crypto RAM memory mappings. Curve constants loaded for one mapping stay
+   valid for the next operation using the same mapping and curve. Binary 
+   curves use the BASE_GF2N_* variant of each mapping, with b after a. */
+typedef enum
+{
+    CRYPTO_CPKCL_RAM_NONE = 0,
+    CRYPTO_CPKCL_RAM_ECDSA_SIGN,     // BASE_ECDSA_*: modulo, a, order
+    CRYPTO_CPKCL_RAM_ECDSA_VERIFY,   // BASE_ECDSAV_*: modulo, a, order
+    CRYPTO_CPKCL_RAM_SCA_MUL,        // BASE_SCA_MUL_*: modulo, Cns, a, order
+    CRYPTO_CPKCL_RAM_POINT,          // BASE_POINT_*: modulo, Cns, a
+} CRYPTO_CPKCL_RAM_LAYOUT;
+
+// *****************************************************************************
+/* Custom Curve Descriptor
+
+  Summary:
+    Domain parameters of a prime curve y^2 = x^3 + a*x + b supplied at run 
+    time.
+    
+  Remarks:
+    All values are in LSB mode with 4 "0" bytes padding on the MSB side, as
+    the built-in tables: p, a, b and the base point on u2ModuloPSize + 4 
+    bytes, n on u2OrderSize + 4 bytes and Cns = floor(2^(16*u2ModuloPSize 
+    + 32) / p) on u2ModuloPSize + 8 bytes. The operand sizes are multiples 
+    of 4 bytes and u2KeySize is the size of p rounded up to a byte. The 
+    tables are read in place and must outlive the curve.
+*/
+typedef struct
+{
+    u2 u2ModuloPSize;
+    u2 u2OrderSize;
+    u2 u2KeySize;
+    const u1 *pu1ModuloP;
+    const u1 *pu1ACurve;
+    const u1 *pu1BCurve;
+    const u1 *pu1APointX;
+    const u1 *pu1APointY;
+    const u1 *pu1APointOrder;
+    const u1 *pu1Cns;
+} CPKCL_ECC_CURVE_DESC;
+
+// *****************************************************************************
+/* Fixed-base Comb Table
+
+  Summary:
+    Precomputed points of the comb of a curve generator, in flash.
+    
+  Remarks:
+    u2Columns is d = ceil(bits of n / 4). pu1Points holds 
+    CPKCL_ECC_COMB_POINTS affine points, X then Y in LSB mode on 
+    u2ModuloPSize + 4 bytes each: the start point S, the 15 sums of 
+    2^(j*d) G for the 4 bits j of the column digits 1 to 15, and -(2^d S).
+    u4Size is the flash taken by the points.
+*/
+#define CPKCL_ECC_COMB_POINTS       (17U)
+#define CPKCL_ECC_COMB_START        (0U)
+#define CPKCL_ECC_COMB_END          (16U)
+
+typedef struct
+{
+    u2 u2Columns;
+    const u1 *pu1Points;
+    u4 u4Size;
+} CPKCL_ECC_COMB_TABLE;
+
 // *****************************************************************************
 /* ECC Data
 
@@ -238,11 +379,16 @@ typedef enum
     
   Remarks:
     Data pointed by this structure is in MSB mode with 4 "0" bytes padding on 
-    the MSB side.
+    the MSB side, except the curve constants (modulo, a, b, base point, order,
+    Cns and pfu1PublicKeyZ) which are in LSB mode, ready for the crypto RAM.
 */
 typedef struct
 {
-    // Prime P
+    // Curve the constants belong to
+    CRYPTO_CPKCL_CURVE curveType;
+
+
+    // Prime P, or the reduction polynomial f(x) of a binary curve
     pfu1 pfu1ModuloP;
 
     // Size of modulo P
@@ -251,6 +397,10 @@ typedef struct
     // Size of the order n
     u2 u2OrderSize;
 
+    // Size of private keys and coordinates outside the crypto RAM, smaller
+    // than the sizes above for P-521
+    u2 u2KeySize;
+
     // "a" parameter in curve equation
     // x^3 = x^2 + a*x + b
     pfu1 pfu1ACurve;
@@ -298,26 +448,202 @@ typedef struct
     // Random number
     pfu1 pfu1RandomNumber;
 
-    // Hash Value
+    // Hash Value, MSB mode as produced by the hash function
     pfu1 pfu1HashValue;
+
+    // Size of the hash value in bytes
+    u2 u2HashSize;
 } CPKCL_ECC_DATA;
 
+// *****************************************************************************
+/* Sliced Scalar Multiplication
+
+  Summary:
+    State of a scalar multiplication run a few bits at a time by 
+    DRV_CRYPTO_ECC_MulContinue.
+    
+  Remarks:
+    The scalars are in MSB mode on u2KeySize + 1 bytes. au1Slots holds the 
+    points of the first u1Slots slots of the BASE_POINT_* memory mapping 
+    between two calls, so the crypto RAM may be used by other operations in
+    between. A secret scalar and the points depending on it are kept until
+    the multiplication ends, the context is then wiped.
+*/
+#define CPKCL_ECC_MUL_SLOTS         (4U)
+#define CPKCL_ECC_MUL_SLOT_SIZE     ((3U * CPKCL_ECC_MAX_OPERAND_SIZE) + 12U)
+
+typedef struct
+{
+    u1 au1Scalar1[CPKCL_ECC_MAX_OPERAND_SIZE];
+    u1 au1Scalar2[CPKCL_ECC_MAX_OPERAND_SIZE];
+    u1 au1Slots[CPKCL_ECC_MUL_SLOTS * CPKCL_ECC_MUL_SLOT_SIZE];
+
+    // Bits of the scalars left
+    u2 u2Bit;
+
+    // Slots saved, 0 when no multiplication is running
+    u1 u1Slots;
+
+    // Secret k*P: one doubling and one addition for every bit
+    bool regular;
+
+    // k1*P1 + k2*P2: P1 + P2 computed
+    bool tableReady;
+    
+    // Accumulator at infinity: no point added yet, or P + (-P)
+    bool accEmpty;
+} CPKCL_ECC_MUL_CTX;
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: CPKCL Common Interface 
 // *****************************************************************************
 // *****************************************************************************
 
+/* Start-up initialization, called from APP_Initialize: waits for the CPKCC
+   RAM clear and runs the CPKCL self test. The result is cached for
+   DRV_CRYPTO_ECC_CheckCpkcl. */
 CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_InitCpkcl(void);
 
+/* Called before each CPKCL operation. Returns the cached self test result,
+   initializes on first use and re-runs the self test every
+   CRYPTO_CPKCL_SELFTEST_PERIOD operations when that option is not 0. */
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_CheckCpkcl(void);
+
+/* Runs the self test again and replaces the cached result */
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_ReTestCpkcl(void);
+
+/* Cached self test result: 0 not run, 1 passed, negative failed */
+int8_t DRV_CRYPTO_ECC_GetSelfTestState(void);
+
 CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_InitCurveParams(CPKCL_ECC_DATA *pEcc, 
     CRYPTO_CPKCL_CURVE curveType);
+
+/* Sets the curve DRV_CRYPTO_ECC_InitCurveParams loads for 
+   CRYPTO_CPKCL_CURVE_CUSTOM, NULL clears it. The sizes are checked against 
+   the crypto RAM mappings, the values are not: p must be a prime above 3 
+   and G a point of order n on the curve. The curve constants resident in the
+   crypto RAM are dropped. Returns CRYPTO_CPKCL_RESULT_CURVE_ERROR for sizes 
+   that do not fit. */
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_SetCustomCurve(
+    const CPKCL_ECC_CURVE_DESC *pCurve);
+
+/* True for the curves over GF(2^m), y^2 + x*y = x^3 + a*x^2 + b, which run 
+   on the CPKCL GF2N services with the BASE_GF2N_* memory mappings */
+bool DRV_CRYPTO_ECC_IsBinaryCurve(CRYPTO_CPKCL_CURVE curveType);
     
+/* Splits a public key into its coordinates in MSB mode on u2KeySize bytes.
+   The key is either uncompressed (0x04 || X || Y) or compressed (0x02 or 0x03
+   for an even or odd Y || X), in which case Y is computed on the curve set by
+   DRV_CRYPTO_ECC_InitCurveParams with modular exponentiations on the CPKCC.
+   CRYPTO_CPKCL_RESULT_COORD_COMPRESS_ERROR is returned for an unknown format
+   or when X is not the abscissa of a point of the curve. Decompression uses 
+   the BASE_EXPMOD_* memory mapping and is only available on prime curves. */
 CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_SetPubKeyCoordinates(CPKCL_ECC_DATA *pEcc,
     pfu1 pubKey, pfu1 pubKeyX, pfu1 pubKeyY, CRYPTO_CPKCL_CURVE curveType);
     
 void DRV_CRYPTO_ECC_SecureCopy(pu1 pu1Dest, pu1 pu1Src, u2 u2Length);
 
+/* Generates a key pair on the curve set by DRV_CRYPTO_ECC_InitCurveParams.
+   The private key is a random number in [1, n-1] from the CPKCC generator, 
+   written in MSB mode on u2KeySize bytes. The public key d*G is written 
+   uncompressed as 0x04 || X || Y on 2*u2KeySize + 1 bytes. Uses the 
+   BASE_SCA_MUL_* memory mapping, d*G runs as DRV_CRYPTO_ECC_PointMul when 
+   the curve has a comb table. */
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_KeyGen(CPKCL_ECC_DATA *pEccData, 
+    pfu1 privKey, pfu1 pubKey);
+
+/* k*P on the binary curve set by DRV_CRYPTO_ECC_InitCurveParams, with the
+   BASE_GF2N_SCA_MUL_* memory mapping. The caller writes k at 
+   BASE_GF2N_SCA_MUL_SCALAR and P, projective, at BASE_SCA_MUL_POINT_A. The 
+   curve constants are loaded when they are not resident, k is wiped and the
+   affine result replaces P. Returns false when a CPKCL service fails. */
+bool DRV_CRYPTO_ECC_Gf2nMul(CPKCL_ECC_DATA *pEccData);
+
+/* Point arithmetic on the prime curve set by DRV_CRYPTO_ECC_InitCurveParams.
+   Points are uncompressed (0x04 || X || Y) on 2*u2KeySize + 1 bytes and 
+   scalars in MSB mode on u2KeySize bytes. The input points are not checked 
+   to be on the curve. CRYPTO_CPKCL_RESULT_POINT_INFINITY is returned, with 
+   nothing written, when the result is the point at infinity. */
+
+/* k*P with the BASE_SCA_MUL_* memory mapping, P being G when point is NULL. 
+   k may be secret, it is wiped from the crypto RAM. k*G runs on the comb 
+   table of the curve when there is one, with the BASE_POINT_* memory 
+   mapping: one doubling and one addition per column, the same sequence of
+   CPKCL services for every k. */
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_PointMul(CPKCL_ECC_DATA *pEccData, 
+    pfu1 scalar, pfu1 point, pfu1 result);
+
+/* A + B with the BASE_POINT_* memory mapping, A = B being doubled */
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_PointAdd(CPKCL_ECC_DATA *pEccData, 
+    pfu1 pointA, pfu1 pointB, pfu1 result);
+
+/* k1*P1 + k2*P2 in one pass over the scalar bits (Shamir's trick) with the 
+   BASE_POINT_* memory mapping, P1 being G when point1 is NULL: one doubling
+   per bit and an addition of P1, P2 or P1 + P2 for the non-zero bit pairs, 
+   where two separate multiplications double once per bit each. The number 
+   of operations depends on the scalars, which must be public (ECDSA 
+   verification, implicit certificates). The additions are not complete: 
+   CRYPTO_CPKCL_RESULT_POINT_DEGENERATE is returned when one of them meets 
+   equal or opposite points, P1 = +/-P2 or a partial sum equal to a table 
+   point, and the caller then computes the two products with 
+   DRV_CRYPTO_ECC_PointMul and adds them with DRV_CRYPTO_ECC_PointAdd. */
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_DualMul(CPKCL_ECC_DATA *pEccData, 
+    pfu1 scalar1, pfu1 point1, pfu1 scalar2, pfu1 point2, pfu1 result);
+
+/* The same multiplications in slices, for the cooperative task loops. The 
+   CPKCL services run to completion once called, so a multiplication is cut
+   between its point operations: each call of DRV_CRYPTO_ECC_MulContinue 
+   runs at most u2MaxBits steps and returns 
+   CRYPTO_CPKCL_RESULT_POINT_IN_PROGRESS until the result is written. A step
+   is one bit of the scalars, a doubling and an addition, or one of the 
+   single operations around them: P1 + P2 first, the conversion to affine 
+   coordinates last. 
+   
+   With scalar2 NULL, the secret k*P, P being G when point1 is NULL and k in
+   [1, n-1]: the bits of k + n or k + 2n, whichever is one bit longer than 
+   n, are scanned with one doubling and one addition each, the addition of
+   a zero bit going to a copy of the accumulator as in the comb, so the 
+   sequence of CPKCL services does not depend on k. Otherwise k1*P1 + k2*P2
+   with public scalars, as DRV_CRYPTO_ECC_DualMul. 
+   
+   An addition that meets equal or opposite points is completed within its
+   step: both points are converted to affine coordinates, equal points are 
+   doubled and opposite ones leave the accumulator at infinity. Such a step
+   costs two conversions more, it comes with P1 = +/-P2 or a partial sum 
+   equal to a table point, and for the secret k*P only with k in [1, 5] or
+   k = n - 2 or n - 1. CRYPTO_CPKCL_RESULT_POINT_DEGENERATE is never 
+   returned. The context is wiped when the multiplication ends or fails. */
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_MulStart(CPKCL_ECC_DATA *pEccData, 
+    CPKCL_ECC_MUL_CTX *pMul, pfu1 scalar1, pfu1 point1, pfu1 scalar2, 
+    pfu1 point2);
+
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_MulContinue(CPKCL_ECC_DATA *pEccData, 
+    CPKCL_ECC_MUL_CTX *pMul, u2 u2MaxBits, pfu1 result);
+
+/* Comb table of the curve generator, NULL when its CRYPTO_CPKCL_COMB_<curve>
+   option is not set */
+const CPKCL_ECC_COMB_TABLE *DRV_CRYPTO_ECC_GetCombTable(
+    CRYPTO_CPKCL_CURVE curveType);
+
+/* Turns the use of the comb tables on or off at run time, to compare with 
+   the CPKCL scalar multiplication. They are used by default. */
+void DRV_CRYPTO_ECC_SetCombEnabled(bool enable);
+
+/* True when k*G on the curve runs on its comb table */
+bool DRV_CRYPTO_ECC_CombIsUsed(CRYPTO_CPKCL_CURVE curveType);
+
+/* Crypto RAM manager: tracks which curve constants are already loaded at the
+   BASE_* offsets of a memory mapping so they are not copied again. Any other
+   use of the crypto RAM must call DRV_CRYPTO_ECC_RamInvalidate. */
+bool DRV_CRYPTO_ECC_RamIsResident(CRYPTO_CPKCL_CURVE curveType,
+    CRYPTO_CPKCL_RAM_LAYOUT layout);
+
+void DRV_CRYPTO_ECC_RamSetResident(CRYPTO_CPKCL_CURVE curveType,
+    CRYPTO_CPKCL_RAM_LAYOUT layout);
+
+void DRV_CRYPTO_ECC_RamInvalidate(void);
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
 
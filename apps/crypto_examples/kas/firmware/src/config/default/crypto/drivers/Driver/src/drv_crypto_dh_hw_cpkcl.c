@@ -0,0 +1,567 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_crypto_dh_hw_cpkcl.c
+  
+  Summary:
+    Crypto Framework Library source for the CPKCC Diffie-Hellman functions.
+
+  Description:
+    This source contains the function code for finite field Diffie-Hellman
+    on the RFC 7919 groups with the CPKCC ExpMod service.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2024, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "crypto/drivers/driver/drv_crypto_ecc_hw_cpkcl.h"
+#include "crypto/drivers/driver/drv_crypto_dh_hw_cpkcl.h"
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_typedef_pb.h"
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_mapping_pb.h"
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_Headers_pb.h"
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_JumpTable_Addr_pb.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Group Parameters
+// *****************************************************************************
+// *****************************************************************************
+
+/* Numbers in LSB mode followed by a zero padding word, copied as they are to
+   crypto RAM. The generator of both groups is 2. */
+
+// ffdhe2048 prime p, RFC 7919 Appendix A.1
+static const u1 ffdhe2048_au1ModuloP[260] = {
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x97, 0x5C, 0x28, 0x61,
+0x38, 0x42, 0x6B, 0x88, 0xFA, 0xEF, 0xB2, 0xC1, 0x26, 0x4A, 0xF3, 0xC6,
+0xB2, 0x83, 0x16, 0x7D, 0x83, 0xF1, 0x8E, 0xC5, 0x05, 0x20, 0xC2, 0x2E,
+0xBC, 0xFC, 0xB5, 0x3B, 0x73, 0xAD, 0x6F, 0x4C, 0x1B, 0x3B, 0xFE, 0xC3,
+0x83, 0x81, 0xF2, 0xEE, 0x32, 0x12, 0x4F, 0x8E, 0xFF, 0x83, 0x85, 0xE9,
+0x9C, 0xFE, 0x72, 0x91, 0x61, 0x2F, 0x34, 0x28, 0xCD, 0x04, 0x34, 0xC0,
+0xEC, 0xE2, 0xF7, 0xCD, 0xE1, 0xFC, 0x02, 0x9E, 0x70, 0x6D, 0x0A, 0xEE,
+0xC8, 0xA7, 0x07, 0x0B, 0x19, 0xBB, 0x72, 0x63, 0xE7, 0xED, 0x56, 0xAE,
+0xF4, 0x4D, 0x39, 0xDE, 0xA3, 0x42, 0x4F, 0x1D, 0x68, 0xF4, 0xD7, 0x60,
+0xB7, 0xDA, 0x6A, 0xB9, 0xFB, 0xE3, 0xC8, 0xB2, 0x4B, 0xA9, 0x08, 0xD1,
+0x61, 0xFB, 0x24, 0xB3, 0x82, 0xB1, 0x0A, 0xBC, 0x7A, 0x79, 0x3A, 0x48,
+0x4F, 0xCA, 0xAC, 0x30, 0x35, 0xE7, 0xAD, 0x36, 0xA1, 0x58, 0xF1, 0x1D,
+0x72, 0xE8, 0xEF, 0xF3, 0xDA, 0x89, 0xA6, 0xE2, 0x77, 0x8B, 0xE6, 0xE0,
+0x70, 0x0C, 0x4F, 0x98, 0x35, 0xC9, 0x57, 0x7F, 0x5E, 0x13, 0x57, 0xB5,
+0xF3, 0x1A, 0xED, 0x3D, 0x55, 0x65, 0x63, 0x85, 0xD0, 0x6E, 0x06, 0x5F,
+0x1F, 0xF5, 0x33, 0x24, 0x61, 0x65, 0xFD, 0xD5, 0xD5, 0x1E, 0xDF, 0xD3,
+0x7A, 0x61, 0xC4, 0xAE, 0x02, 0xB2, 0x81, 0xF6, 0xD8, 0x75, 0x0C, 0x63,
+0x63, 0xE3, 0x2F, 0x7D, 0xF9, 0x3E, 0x9B, 0x24, 0xCE, 0x9D, 0x93, 0xCC,
+0xFB, 0x33, 0x64, 0x14, 0x41, 0x36, 0xE1, 0xA9, 0x95, 0x36, 0x2D, 0xCE,
+0x83, 0xC5, 0xB9, 0xD8, 0xF1, 0x3C, 0x3D, 0x27, 0x20, 0x56, 0xDC, 0xAF,
+0x9A, 0x4A, 0xBB, 0xA2, 0x58, 0x54, 0xF8, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00
+};
+
+// Reduction constant, 2^(2*bits + 32) / p
+static const u1 ffdhe2048_au1Cns[264] = {
+0x99, 0xD3, 0x2B, 0x35, 0xA1, 0x4F, 0x8A, 0xD3, 0x6B, 0xE3, 0x7B, 0x18,
+0x50, 0x17, 0x3E, 0x25, 0x45, 0x5A, 0x73, 0x3C, 0x10, 0xD7, 0xB5, 0x45,
+0xCB, 0x29, 0x7E, 0x9A, 0x77, 0x79, 0x60, 0x74, 0x57, 0x50, 0x08, 0xAC,
+0x5E, 0x52, 0x0E, 0x84, 0x13, 0xDF, 0x5C, 0x32, 0x05, 0xB9, 0x7F, 0xDD,
+0x1A, 0x34, 0x37, 0xCE, 0x61, 0x44, 0x60, 0x09, 0xDC, 0x2A, 0x33, 0x69,
+0x69, 0xBC, 0xA4, 0x29, 0xFC, 0x96, 0x3B, 0x47, 0xAF, 0x9D, 0x8D, 0x65,
+0x6E, 0x0E, 0x8E, 0x98, 0x9F, 0x43, 0x7A, 0x41, 0x47, 0xF4, 0x89, 0x6F,
+0xAE, 0x5A, 0xCE, 0xDF, 0x2F, 0x2D, 0x01, 0xC4, 0x42, 0x41, 0x8D, 0x28,
+0x59, 0xA2, 0xB8, 0xD0, 0x08, 0x22, 0x53, 0xCB, 0x33, 0xE8, 0x91, 0x43,
+0xF8, 0x41, 0x15, 0xB9, 0xE0, 0xA9, 0xD0, 0xDC, 0x82, 0x1A, 0x29, 0x77,
+0x9A, 0x91, 0x1E, 0xF1, 0xCA, 0xE3, 0x15, 0xAB, 0xBB, 0xA9, 0x08, 0xF4,
+0xA7, 0x35, 0xBE, 0xAA, 0xD6, 0x41, 0xBD, 0x9C, 0x44, 0xDB, 0x0F, 0xEA,
+0x8F, 0x08, 0x66, 0x53, 0xCF, 0x06, 0x3D, 0x19, 0xC1, 0x29, 0x44, 0xF7,
+0x7F, 0xDB, 0x41, 0x1C, 0xFB, 0x26, 0x48, 0x12, 0x77, 0xFB, 0x3C, 0x43,
+0xB2, 0xA8, 0x7D, 0x84, 0xBB, 0x95, 0x38, 0x5C, 0x0F, 0xF2, 0xC4, 0x9F,
+0x50, 0x7B, 0xE4, 0x81, 0xA3, 0xC3, 0x5D, 0xF6, 0xE0, 0x5A, 0xBD, 0x4E,
+0x4D, 0x41, 0xE9, 0x40, 0x6C, 0x0A, 0x12, 0x82, 0x8F, 0xB4, 0xE3, 0x6D,
+0x02, 0x77, 0xCE, 0x96, 0xC8, 0x11, 0x33, 0xC6, 0x5C, 0xB9, 0x99, 0xC9,
+0xBC, 0x19, 0xD7, 0xB6, 0x24, 0xC6, 0x48, 0x62, 0xA2, 0x87, 0x69, 0xC2,
+0x67, 0x2C, 0x69, 0xE4, 0x5F, 0x9B, 0x88, 0x9E, 0x09, 0xE5, 0xC2, 0xE6,
+0x11, 0x94, 0x6C, 0x6A, 0x65, 0xB5, 0x44, 0x5D, 0xA7, 0xAB, 0x07, 0x52,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00
+};
+
+// ffdhe3072 prime p, RFC 7919 Appendix A.2
+static const u1 ffdhe3072_au1ModuloP[388] = {
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x37, 0x2E, 0xC6, 0x66,
+0x2B, 0x1D, 0xE4, 0x25, 0x7C, 0x9D, 0xD5, 0x3F, 0xEE, 0x20, 0x1B, 0x3C,
+0xEF, 0xDD, 0x53, 0xFA, 0x6B, 0xD0, 0xBC, 0x0A, 0x4E, 0x48, 0xC4, 0xD5,
+0x42, 0x9A, 0xBF, 0x1D, 0xDA, 0xEA, 0x0D, 0x9B, 0x97, 0x21, 0xC5, 0xAB,
+0x0D, 0x3A, 0x36, 0x22, 0xC5, 0x2B, 0x6D, 0xE8, 0x9E, 0xF6, 0x9D, 0x9C,
+0xAB, 0x82, 0xAE, 0x5C, 0xFF, 0x4B, 0xF5, 0x71, 0x1E, 0xE2, 0xF2, 0x64,
+0xD3, 0x4D, 0xD7, 0xE2, 0x52, 0x44, 0xFD, 0xF4, 0x44, 0x79, 0x43, 0xBC,
+0x93, 0x0C, 0x13, 0xB4, 0x70, 0x92, 0x13, 0x85, 0x09, 0x13, 0xFE, 0xAE,
+0x1C, 0xD9, 0x86, 0xC1, 0xFA, 0xB0, 0x8C, 0x59, 0xEE, 0xF7, 0xF7, 0x91,
+0x26, 0x1D, 0xD9, 0x7A, 0x07, 0xC9, 0xE6, 0xD6, 0xC9, 0x6F, 0xB4, 0x61,
+0x38, 0x02, 0x9C, 0xF9, 0xDE, 0xF4, 0x34, 0xBC, 0x5B, 0x03, 0x19, 0x65,
+0x3B, 0x5B, 0x35, 0xDE, 0xDC, 0xCF, 0x1F, 0x61, 0x38, 0x42, 0x6B, 0x88,
+0xFA, 0xEF, 0xB2, 0xC1, 0x26, 0x4A, 0xF3, 0xC6, 0xB2, 0x83, 0x16, 0x7D,
+0x83, 0xF1, 0x8E, 0xC5, 0x05, 0x20, 0xC2, 0x2E, 0xBC, 0xFC, 0xB5, 0x3B,
+0x73, 0xAD, 0x6F, 0x4C, 0x1B, 0x3B, 0xFE, 0xC3, 0x83, 0x81, 0xF2, 0xEE,
+0x32, 0x12, 0x4F, 0x8E, 0xFF, 0x83, 0x85, 0xE9, 0x9C, 0xFE, 0x72, 0x91,
+0x61, 0x2F, 0x34, 0x28, 0xCD, 0x04, 0x34, 0xC0, 0xEC, 0xE2, 0xF7, 0xCD,
+0xE1, 0xFC, 0x02, 0x9E, 0x70, 0x6D, 0x0A, 0xEE, 0xC8, 0xA7, 0x07, 0x0B,
+0x19, 0xBB, 0x72, 0x63, 0xE7, 0xED, 0x56, 0xAE, 0xF4, 0x4D, 0x39, 0xDE,
+0xA3, 0x42, 0x4F, 0x1D, 0x68, 0xF4, 0xD7, 0x60, 0xB7, 0xDA, 0x6A, 0xB9,
+0xFB, 0xE3, 0xC8, 0xB2, 0x4B, 0xA9, 0x08, 0xD1, 0x61, 0xFB, 0x24, 0xB3,
+0x82, 0xB1, 0x0A, 0xBC, 0x7A, 0x79, 0x3A, 0x48, 0x4F, 0xCA, 0xAC, 0x30,
+0x35, 0xE7, 0xAD, 0x36, 0xA1, 0x58, 0xF1, 0x1D, 0x72, 0xE8, 0xEF, 0xF3,
+0xDA, 0x89, 0xA6, 0xE2, 0x77, 0x8B, 0xE6, 0xE0, 0x70, 0x0C, 0x4F, 0x98,
+0x35, 0xC9, 0x57, 0x7F, 0x5E, 0x13, 0x57, 0xB5, 0xF3, 0x1A, 0xED, 0x3D,
+0x55, 0x65, 0x63, 0x85, 0xD0, 0x6E, 0x06, 0x5F, 0x1F, 0xF5, 0x33, 0x24,
+0x61, 0x65, 0xFD, 0xD5, 0xD5, 0x1E, 0xDF, 0xD3, 0x7A, 0x61, 0xC4, 0xAE,
+0x02, 0xB2, 0x81, 0xF6, 0xD8, 0x75, 0x0C, 0x63, 0x63, 0xE3, 0x2F, 0x7D,
+0xF9, 0x3E, 0x9B, 0x24, 0xCE, 0x9D, 0x93, 0xCC, 0xFB, 0x33, 0x64, 0x14,
+0x41, 0x36, 0xE1, 0xA9, 0x95, 0x36, 0x2D, 0xCE, 0x83, 0xC5, 0xB9, 0xD8,
+0xF1, 0x3C, 0x3D, 0x27, 0x20, 0x56, 0xDC, 0xAF, 0x9A, 0x4A, 0xBB, 0xA2,
+0x58, 0x54, 0xF8, 0xAD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00
+};
+
+// Reduction constant, 2^(2*bits + 32) / p
+static const u1 ffdhe3072_au1Cns[392] = {
+0x6B, 0x07, 0x5C, 0xA1, 0x60, 0x15, 0xBA, 0x14, 0xEC, 0x61, 0x18, 0xFA,
+0xDC, 0x33, 0x88, 0xD8, 0x49, 0x46, 0x38, 0xCA, 0x67, 0xB3, 0x0F, 0xC4,
+0x68, 0x12, 0xED, 0x2C, 0x37, 0x6F, 0x56, 0x95, 0x6F, 0x07, 0xAC, 0x44,
+0x37, 0xE1, 0xCA, 0x78, 0x15, 0x74, 0x83, 0x55, 0x5A, 0xDD, 0x46, 0x47,
+0xB0, 0xA0, 0xE8, 0x0B, 0x31, 0x8E, 0x7A, 0xDA, 0x07, 0xD0, 0xA0, 0xF7,
+0x3F, 0x28, 0x3E, 0xC7, 0xAB, 0x14, 0x87, 0x57, 0xC1, 0x61, 0x27, 0xE0,
+0xF8, 0xE2, 0x05, 0x7E, 0x7C, 0x3C, 0x24, 0x22, 0x32, 0x71, 0xFC, 0x1B,
+0xAE, 0xA2, 0x16, 0x1F, 0x92, 0xA8, 0xB3, 0xA2, 0x89, 0x0D, 0x72, 0xAD,
+0xE4, 0xF9, 0xC2, 0x1C, 0x51, 0x8F, 0x71, 0xBC, 0x04, 0x87, 0x47, 0xD9,
+0x8A, 0x70, 0xD6, 0x33, 0x9C, 0x7D, 0xF8, 0xB3, 0xD6, 0xD0, 0x19, 0xFD,
+0x07, 0x0D, 0x9C, 0x5B, 0x99, 0xEA, 0x24, 0x61, 0x7F, 0x5F, 0x08, 0x84,
+0xEF, 0xC6, 0x76, 0x6E, 0x30, 0x88, 0x46, 0x3A, 0x0B, 0xA4, 0x46, 0x25,
+0x45, 0x5A, 0x73, 0x3C, 0x10, 0xD7, 0xB5, 0x45, 0xCB, 0x29, 0x7E, 0x9A,
+0x77, 0x79, 0x60, 0x74, 0x57, 0x50, 0x08, 0xAC, 0x5E, 0x52, 0x0E, 0x84,
+0x13, 0xDF, 0x5C, 0x32, 0x05, 0xB9, 0x7F, 0xDD, 0x1A, 0x34, 0x37, 0xCE,
+0x61, 0x44, 0x60, 0x09, 0xDC, 0x2A, 0x33, 0x69, 0x69, 0xBC, 0xA4, 0x29,
+0xFC, 0x96, 0x3B, 0x47, 0xAF, 0x9D, 0x8D, 0x65, 0x6E, 0x0E, 0x8E, 0x98,
+0x9F, 0x43, 0x7A, 0x41, 0x47, 0xF4, 0x89, 0x6F, 0xAE, 0x5A, 0xCE, 0xDF,
+0x2F, 0x2D, 0x01, 0xC4, 0x42, 0x41, 0x8D, 0x28, 0x59, 0xA2, 0xB8, 0xD0,
+0x08, 0x22, 0x53, 0xCB, 0x33, 0xE8, 0x91, 0x43, 0xF8, 0x41, 0x15, 0xB9,
+0xE0, 0xA9, 0xD0, 0xDC, 0x82, 0x1A, 0x29, 0x77, 0x9A, 0x91, 0x1E, 0xF1,
+0xCA, 0xE3, 0x15, 0xAB, 0xBB, 0xA9, 0x08, 0xF4, 0xA7, 0x35, 0xBE, 0xAA,
+0xD6, 0x41, 0xBD, 0x9C, 0x44, 0xDB, 0x0F, 0xEA, 0x8F, 0x08, 0x66, 0x53,
+0xCF, 0x06, 0x3D, 0x19, 0xC1, 0x29, 0x44, 0xF7, 0x7F, 0xDB, 0x41, 0x1C,
+0xFB, 0x26, 0x48, 0x12, 0x77, 0xFB, 0x3C, 0x43, 0xB2, 0xA8, 0x7D, 0x84,
+0xBB, 0x95, 0x38, 0x5C, 0x0F, 0xF2, 0xC4, 0x9F, 0x50, 0x7B, 0xE4, 0x81,
+0xA3, 0xC3, 0x5D, 0xF6, 0xE0, 0x5A, 0xBD, 0x4E, 0x4D, 0x41, 0xE9, 0x40,
+0x6C, 0x0A, 0x12, 0x82, 0x8F, 0xB4, 0xE3, 0x6D, 0x02, 0x77, 0xCE, 0x96,
+0xC8, 0x11, 0x33, 0xC6, 0x5C, 0xB9, 0x99, 0xC9, 0xBC, 0x19, 0xD7, 0xB6,
+0x24, 0xC6, 0x48, 0x62, 0xA2, 0x87, 0x69, 0xC2, 0x67, 0x2C, 0x69, 0xE4,
+0x5F, 0x9B, 0x88, 0x9E, 0x09, 0xE5, 0xC2, 0xE6, 0x11, 0x94, 0x6C, 0x6A,
+0x65, 0xB5, 0x44, 0x5D, 0xA7, 0xAB, 0x07, 0x52, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00
+};
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Variables
+// *****************************************************************************
+// *****************************************************************************
+
+static u1 dhRandom[CRYPTO_DH_FFDHE3072_PRIV_SIZE + 3U];
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static bool lDRV_CRYPTO_DH_GetGroup(CRYPTO_DH_GROUP group, 
+    const u1 **ppu1ModuloP, const u1 **ppu1Cns, u2 *pu2PrimeSize)
+{
+    bool found = true;
+
+    switch (group)
+    {
+        case CRYPTO_DH_GROUP_FFDHE2048:
+            *ppu1ModuloP = ffdhe2048_au1ModuloP;
+            *ppu1Cns = ffdhe2048_au1Cns;
+            *pu2PrimeSize = CRYPTO_DH_FFDHE2048_SIZE;
+            break;
+
+        case CRYPTO_DH_GROUP_FFDHE3072:
+            *ppu1ModuloP = ffdhe3072_au1ModuloP;
+            *ppu1Cns = ffdhe3072_au1Cns;
+            *pu2PrimeSize = CRYPTO_DH_FFDHE3072_SIZE;
+            break;
+
+        default:
+            found = false;
+            break;
+    }
+
+    return found;
+}
+
+/* x > 1, x MSB first */
+static bool lDRV_CRYPTO_DH_IsAboveOne(pfu1 pfu1X, u2 u2Length)
+{
+    u1 u1High = 0U;
+    u2 u2Cpt;
+
+    for (u2Cpt = 0U; u2Cpt < (u2Length - 1U); u2Cpt++)
+    {
+        u1High |= pfu1X[u2Cpt];
+    }
+
+    return ((u1High != 0U) || (pfu1X[u2Length - 1U] > 1U));
+}
+
+/* r = x^e mod p. x and r are MSB first on the prime size, e MSB first on 
+   u2ExpLength bytes. The exponent is always secret: the exponentiation is
+   regular on its full length, and the exponent and intermediate powers are
+   cleared from crypto RAM whatever the outcome. */
+static CRYPTO_DH_RESULT lDRV_CRYPTO_DH_ExpMod(const u1 *pu1ModuloP, 
+    const u1 *pu1Cns, u2 u2PrimeSize, pfu1 pfu1X, pfu1 pfu1Exp, 
+    u2 u2ExpLength, pfu1 pfu1R)
+{
+    u2 u2ExpWords = (u2) ((u2ExpLength + 3U) & ~3U);
+    CRYPTO_DH_RESULT result = CRYPTO_DH_RESULT_SUCCESS;
+    pu1 pu1XArea;
+    pu1 pu1Exp;
+    u2 u2Cpt;
+
+    /* The ECC constants do not survive */
+    DRV_CRYPTO_ECC_RamInvalidate();
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:9 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:36 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:9 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:9 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    pu1XArea = (pu1) BASE_DH_EXPMOD_X(u2PrimeSize);
+    pu1Exp = (pu1) BASE_DH_EXPMOD_EXPONENT(u2PrimeSize);
+
+    (void) memcpy((pu1) BASE_DH_EXPMOD_MODULO(u2PrimeSize), pu1ModuloP, 
+        (size_t)u2PrimeSize + 4U);
+    (void) memcpy((pu1) BASE_DH_EXPMOD_CNS(u2PrimeSize), pu1Cns, 
+        (size_t)u2PrimeSize + 8U);
+
+    /* The least significant word of the X area stays 0, X follows it */
+    (void) memset(pu1XArea, 0, (3U * (size_t)u2PrimeSize) + 24U);
+    for (u2Cpt = 0U; u2Cpt < u2PrimeSize; u2Cpt++)
+    {
+        pu1XArea[4U + u2Cpt] = pfu1X[u2PrimeSize - u2Cpt - 1U];
+    }
+
+    (void) memset(pu1Exp, 0, (size_t)u2ExpWords + 4U);
+    for (u2Cpt = 0U; u2Cpt < u2ExpLength; u2Cpt++)
+    {
+        pu1Exp[u2Cpt] = pfu1Exp[u2ExpLength - u2Cpt - 1U];
+    }
+
+    CPKCL_ExpMod(nu1ModBase) = (nu1) BASE_DH_EXPMOD_MODULO(u2PrimeSize);
+    CPKCL_ExpMod(nu1CnsBase) = (nu1) BASE_DH_EXPMOD_CNS(u2PrimeSize);
+    CPKCL_ExpMod(nu1XBase) = (nu1) BASE_DH_EXPMOD_X(u2PrimeSize);
+    CPKCL_ExpMod(nu1PrecompBase) = (nu1) BASE_DH_EXPMOD_PRECOMP(u2PrimeSize);
+    CPKCL_ExpMod(pfu1ExpBase) = (pfu1) BASE_DH_EXPMOD_EXPONENT(u2PrimeSize);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL_ExpMod(u2ModLength) = u2PrimeSize;
+    CPKCL_ExpMod(u2ExpLength) = u2ExpWords;
+    CPKCL_ExpMod(u1Blinding) = 0U;
+
+    CPKCL(u2Option) = (u2) (CPKCL_EXPMOD_REGULARRSA | 
+        CPKCL_EXPMOD_EXPINPKCCRAM | CPKCL_EXPMOD_WINDOWSIZE_1);
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    vCPKCL_Process(ExpMod, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        result = CRYPTO_DH_RESULT_ERROR_FAIL;
+    }
+    else
+    {
+        /* The result replaces X */
+        for (u2Cpt = 0U; u2Cpt < u2PrimeSize; u2Cpt++)
+        {
+            pfu1R[u2Cpt] = pu1XArea[4U + u2PrimeSize - u2Cpt - 1U];
+        }
+    }
+
+    /* The X and precomputation areas hold intermediate powers */
+    (void) memset(pu1XArea, 0, (6U * (size_t)u2PrimeSize) + 48U);
+    (void) memset(pu1Exp, 0, (size_t)u2ExpWords + 4U);
+
+    return result;
+}
+
+/* 1 < y < p - 1 with p in LSB mode and y MSB first. p - 1 only differs from 
+   p in its least significant byte, p being odd. */
+static bool lDRV_CRYPTO_DH_IsPubKeyValid(const u1 *pu1ModuloP, 
+    u2 u2PrimeSize, pfu1 pfu1Y)
+{
+    u2 u2Cpt;
+    u1 u1Limit;
+
+    if (!lDRV_CRYPTO_DH_IsAboveOne(pfu1Y, u2PrimeSize))
+    {
+        return false;
+    }
+
+    for (u2Cpt = 0U; u2Cpt < u2PrimeSize; u2Cpt++)
+    {
+        u1Limit = pu1ModuloP[u2PrimeSize - u2Cpt - 1U];
+        if (u2Cpt == (u2PrimeSize - 1U))
+        {
+            u1Limit -= 1U;
+        }
+
+        if (pfu1Y[u2Cpt] != u1Limit)
+        {
+            return (pfu1Y[u2Cpt] < u1Limit);
+        }
+    }
+
+    /* y = p - 1 */
+    return false;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: CPKCC DH Common Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+u2 DRV_CRYPTO_DH_GetPrimeSize(CRYPTO_DH_GROUP group)
+{
+    const u1 *pu1ModuloP;
+    const u1 *pu1Cns;
+    u2 u2PrimeSize = 0U;
+
+    if (!lDRV_CRYPTO_DH_GetGroup(group, &pu1ModuloP, &pu1Cns, &u2PrimeSize))
+    {
+        u2PrimeSize = 0U;
+    }
+
+    return u2PrimeSize;
+}
+
+u2 DRV_CRYPTO_DH_GetPrivKeySize(CRYPTO_DH_GROUP group)
+{
+    u2 u2PrivSize;
+
+    switch (group)
+    {
+        case CRYPTO_DH_GROUP_FFDHE2048:
+            u2PrivSize = CRYPTO_DH_FFDHE2048_PRIV_SIZE;
+            break;
+
+        case CRYPTO_DH_GROUP_FFDHE3072:
+            u2PrivSize = CRYPTO_DH_FFDHE3072_PRIV_SIZE;
+            break;
+
+        default:
+            u2PrivSize = 0U;
+            break;
+    }
+
+    return u2PrivSize;
+}
+
+CRYPTO_DH_RESULT DRV_CRYPTO_DH_KeyGen(CRYPTO_DH_GROUP group, pfu1 privKey, 
+    pfu1 pubKey)
+{
+    const u1 *pu1ModuloP;
+    const u1 *pu1Cns;
+    u2 u2PrimeSize;
+    u2 u2PrivSize = DRV_CRYPTO_DH_GetPrivKeySize(group);
+    u1 au1Generator[CRYPTO_DH_FFDHE3072_SIZE];
+    pu1 pu1R;
+    CRYPTO_DH_RESULT result;
+
+    if (!lDRV_CRYPTO_DH_GetGroup(group, &pu1ModuloP, &pu1Cns, &u2PrimeSize))
+    {
+        return CRYPTO_DH_RESULT_ERROR_GROUP;
+    }
+
+    /* Check the CPKCL is initialized and its self test passed */
+    if (DRV_CRYPTO_ECC_CheckCpkcl() != CRYPTO_CPKCL_RESULT_INIT_SUCCESS)
+    {
+        return CRYPTO_DH_RESULT_INIT_FAIL;
+    }
+
+    DRV_CRYPTO_ECC_RamInvalidate();
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:2 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:2 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:2 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    pu1R = (pu1) BASE_DH_EXPMOD_MODULO(0U);
+    CPKCL_Rng(nu1RBase) = (nu1) BASE_DH_EXPMOD_MODULO(0U);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL_Rng(u2RLength) = (u2) ((u2PrivSize + 3U) & ~3U);
+    CPKCL(u2Option) = CPKCL_RNG_GET;
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    vCPKCL_Process(Rng, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        return CRYPTO_DH_RESULT_ERROR_RNG;
+    }
+
+    (void) memcpy(dhRandom, pu1R, sizeof(dhRandom));
+    (void) memset(pu1R, 0, sizeof(dhRandom));
+
+    /* Top bits set as wolfCrypt does, x keeps its length and is above 1 */
+    (void) memcpy(privKey, dhRandom, u2PrivSize);
+    privKey[0] |= 0x0CU;
+    (void) memset(dhRandom, 0, sizeof(dhRandom));
+
+    (void) memset(au1Generator, 0, u2PrimeSize);
+    au1Generator[u2PrimeSize - 1U] = 2U;
+
+    result = lDRV_CRYPTO_DH_ExpMod(pu1ModuloP, pu1Cns, u2PrimeSize, 
+        au1Generator, privKey, u2PrivSize, pubKey);
+
+    return result;
+}
+
+CRYPTO_DH_RESULT DRV_CRYPTO_DH_CheckPubKey(CRYPTO_DH_GROUP group, 
+    pfu1 pubKey)
+{
+    const u1 *pu1ModuloP;
+    const u1 *pu1Cns;
+    u2 u2PrimeSize;
+
+    if (!lDRV_CRYPTO_DH_GetGroup(group, &pu1ModuloP, &pu1Cns, &u2PrimeSize))
+    {
+        return CRYPTO_DH_RESULT_ERROR_GROUP;
+    }
+
+    if (!lDRV_CRYPTO_DH_IsPubKeyValid(pu1ModuloP, u2PrimeSize, pubKey))
+    {
+        return CRYPTO_DH_RESULT_ERROR_PUBKEY;
+    }
+
+    return CRYPTO_DH_RESULT_SUCCESS;
+}
+
+CRYPTO_DH_RESULT DRV_CRYPTO_DH_SharedSecret(CRYPTO_DH_GROUP group, 
+    pfu1 privKey, u2 privKeyLen, pfu1 pubKey, pfu1 sharedSecret)
+{
+    const u1 *pu1ModuloP;
+    const u1 *pu1Cns;
+    u2 u2PrimeSize;
+    CRYPTO_DH_RESULT result;
+
+    if (!lDRV_CRYPTO_DH_GetGroup(group, &pu1ModuloP, &pu1Cns, &u2PrimeSize))
+    {
+        return CRYPTO_DH_RESULT_ERROR_GROUP;
+    }
+
+    /* Check the CPKCL is initialized and its self test passed */
+    if (DRV_CRYPTO_ECC_CheckCpkcl() != CRYPTO_CPKCL_RESULT_INIT_SUCCESS)
+    {
+        return CRYPTO_DH_RESULT_INIT_FAIL;
+    }
+
+    /* Shorter than p, so below q = (p - 1) / 2 whose top 63 bits are set */
+    if ((privKeyLen == 0U) || (privKeyLen >= u2PrimeSize) || 
+        !lDRV_CRYPTO_DH_IsAboveOne(privKey, privKeyLen))
+    {
+        return CRYPTO_DH_RESULT_ERROR_PRIVKEY;
+    }
+
+    if (!lDRV_CRYPTO_DH_IsPubKeyValid(pu1ModuloP, u2PrimeSize, pubKey))
+    {
+        return CRYPTO_DH_RESULT_ERROR_PUBKEY;
+    }
+
+    result = lDRV_CRYPTO_DH_ExpMod(pu1ModuloP, pu1Cns, u2PrimeSize, pubKey, 
+        privKey, privKeyLen, sharedSecret);
+
+    /* Cannot happen with a valid peer key, checked as SP 800-56A asks */
+    if ((result == CRYPTO_DH_RESULT_SUCCESS) && 
+        !lDRV_CRYPTO_DH_IsAboveOne(sharedSecret, u2PrimeSize))
+    {
+        (void) memset(sharedSecret, 0, u2PrimeSize);
+        result = CRYPTO_DH_RESULT_ERROR_PUBKEY;
+    }
+
+    return result;
+}
@@ -0,0 +1,1016 @@
+/**************************************************************************
+  Crypto Framework Library Source
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_crypto_ecc_comb_cpkcl.c
+
+  Summary:
+    Fixed-base comb tables of the NIST curve generators.
+
+  Description:
+    This file holds, for each curve enabled with CRYPTO_CPKCL_COMB_<curve>,
+    the points DRV_CRYPTO_ECC_PointMul adds to compute k*G on the CPKCC with
+    one doubling and one addition per comb column instead of a full scalar 
+    multiplication. With d columns, d = ceil(bits of n / 4), point b of the
+    table (1 to 15) is the sum of the 2^(j*d) G for the bits j set in b. 
+    Point 0 is the start point S of the accumulator, a multiple of G derived
+    from SHA-256("CPKCC comb start " || curve name) so the accumulator never
+    starts at infinity, and point 16 is -(2^d S), which removes it at the end.
+    The points are affine, X then Y, in LSB mode with the 4 zero padding 
+    bytes of the crypto RAM operands.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2024, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <stddef.h>
+#include "crypto/drivers/driver/drv_crypto_ecc_hw_cpkcl.h"
+#include "crypto/wolfcrypt/wolfcrypt_config.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#ifdef CRYPTO_CPKCL_COMB_P192
+// *****************************************************************************
+/* P-192 generator comb, 48 columns */
+static const u1 p192_au1Comb[CPKCL_ECC_COMB_POINTS][56] = {
+{
+0xE6, 0x98, 0x0C, 0x0A, 0x9E, 0x07, 0xD3, 0x52, 0xD1, 0x62, 0x48, 0x34,
+0x3D, 0xFC, 0xFB, 0x33, 0x9F, 0xFF, 0xFA, 0xD6, 0xFD, 0x20, 0x15, 0x63,
+0x00, 0x00, 0x00, 0x00,
+0xFF, 0x7D, 0x7A, 0xF6, 0x11, 0x33, 0x19, 0x2B, 0x00, 0x2C, 0x40, 0xC3,
+0xC2, 0xA6, 0x3B, 0xB7, 0x36, 0x12, 0x35, 0xCF, 0xBA, 0xBA, 0xEF, 0x40,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0x12, 0x10, 0xFF, 0x82, 0xFD, 0x0A, 0xFF, 0xF4, 0x00, 0x88, 0xA1, 0x43,
+0xEB, 0x20, 0xBF, 0x7C, 0xF6, 0x90, 0x30, 0xB0, 0x0E, 0xA8, 0x8D, 0x18,
+0x00, 0x00, 0x00, 0x00,
+0x11, 0x48, 0x79, 0x1E, 0xA1, 0x77, 0xF9, 0x73, 0xD5, 0xCD, 0x24, 0x6B,
+0xED, 0x11, 0x10, 0x63, 0x78, 0xDA, 0xC8, 0xFF, 0x95, 0x2B, 0x19, 0x07,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0xD8, 0x48, 0x7C, 0x5D, 0xC5, 0x49, 0x96, 0xC3, 0x35, 0x7C, 0x92, 0x5A,
+0xAE, 0xDF, 0x2C, 0xEB, 0xFB, 0x71, 0xA6, 0xCB, 0xBD, 0x0C, 0xE3, 0x67,
+0x00, 0x00, 0x00, 0x00,
+0x7D, 0xBE, 0xBF, 0xEC, 0xE1, 0xCE, 0x83, 0x7A, 0x77, 0x15, 0x30, 0x06,
+0x3C, 0xD0, 0x32, 0xCE, 0xC3, 0xF5, 0x10, 0x58, 0xC4, 0x49, 0x35, 0xA9,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0xD3, 0xEA, 0xE3, 0x66, 0x89, 0xF8, 0x5E, 0x6F, 0x1A, 0xBF, 0xC9, 0xDF,
+0xEA, 0x6F, 0x9E, 0xF2, 0xE0, 0x06, 0x20, 0x45, 0xB8, 0x6B, 0x21, 0xCE,
+0x00, 0x00, 0x00, 0x00,
+0x79, 0x37, 0x7B, 0x92, 0x2D, 0x09, 0xB9, 0x46, 0x20, 0x0A, 0xB8, 0xB5,
+0x4B, 0xEB, 0x0A, 0x1D, 0x58, 0xC9, 0xAE, 0x5A, 0xE2, 0x2E, 0x8A, 0xD9,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0x40, 0xE3, 0xA1, 0xC0, 0xD8, 0x63, 0x99, 0xB1, 0x0B, 0x09, 0xD1, 0x80,
+0xF4, 0xD4, 0x30, 0x47, 0x37, 0xC7, 0x4A, 0x18, 0xD9, 0x81, 0xA5, 0x51,
+0x00, 0x00, 0x00, 0x00,
+0xA5, 0x12, 0x99, 0xE6, 0x31, 0x67, 0xC5, 0xEC, 0x16, 0x3F, 0x68, 0x2F,
+0xA0, 0xCE, 0xDF, 0x7C, 0x6E, 0x9F, 0xBB, 0xE0, 0xE2, 0x1E, 0xD8, 0x5B,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0x74, 0x33, 0xF4, 0xD4, 0x2D, 0x5A, 0xB1, 0xE4, 0x41, 0xC3, 0x92, 0xF2,
+0xA7, 0xEE, 0x57, 0x07, 0x24, 0xDC, 0xF8, 0xD0, 0x91, 0x06, 0x73, 0x0C,
+0x00, 0x00, 0x00, 0x00,
+0x00, 0x5E, 0xF4, 0xBB, 0x90, 0x78, 0x79, 0xDF, 0x08, 0x87, 0xDE, 0xE9,
+0x83, 0x9E, 0x8A, 0x00, 0x3E, 0xDE, 0x54, 0x93, 0x31, 0x4C, 0xB2, 0x31,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0xBA, 0x3A, 0xF6, 0xDD, 0x43, 0xC0, 0x5E, 0xCB, 0xE1, 0x41, 0x4F, 0xF8,
+0xD9, 0x21, 0x4C, 0xC9, 0x16, 0x44, 0xD2, 0x61, 0x83, 0x08, 0xF4, 0xF0,
+0x00, 0x00, 0x00, 0x00,
+0xF7, 0x95, 0x64, 0x40, 0xB0, 0x85, 0x75, 0xF3, 0xCA, 0xD0, 0xBC, 0x16,
+0x5B, 0x3B, 0xDE, 0xE5, 0x88, 0xA4, 0x3E, 0xE1, 0x1A, 0x3C, 0x85, 0x27,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0x8F, 0xE6, 0x8A, 0x8E, 0x2A, 0x23, 0x74, 0xD0, 0xA9, 0xF7, 0x29, 0xEE,
+0x8E, 0x52, 0x9E, 0x74, 0x9F, 0x46, 0x16, 0x97, 0xA3, 0xDE, 0x11, 0x06,
+0x00, 0x00, 0x00, 0x00,
+0xCC, 0x43, 0x80, 0x0D, 0xDD, 0x67, 0xB8, 0x66, 0xE6, 0x7D, 0x72, 0x3A,
+0x54, 0x46, 0x65, 0x6A, 0xC9, 0xBD, 0x38, 0x83, 0x52, 0x60, 0x54, 0xF9,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0x50, 0x8F, 0x5D, 0x0C, 0x93, 0x71, 0xEB, 0xB6, 0x96, 0xB5, 0x04, 0xB9,
+0x02, 0x5C, 0x24, 0x1C, 0x13, 0x75, 0x1F, 0x95, 0x71, 0x1F, 0xBC, 0x04,
+0x00, 0x00, 0x00, 0x00,
+0x3D, 0x80, 0x34, 0xBE, 0x6E, 0x91, 0xD0, 0xA4, 0x2A, 0x96, 0x21, 0x8C,
+0x8A, 0x94, 0xEC, 0x8B, 0xD0, 0xF8, 0x69, 0xFD, 0xE7, 0x96, 0x00, 0x15,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0x0C, 0xAC, 0x1A, 0xE7, 0xE8, 0xFF, 0x44, 0xBD, 0x65, 0xD0, 0x22, 0x43,
+0xB0, 0xA0, 0x69, 0x7D, 0x2A, 0xBA, 0xA3, 0xEC, 0x6C, 0xD9, 0x56, 0x9F,
+0x00, 0x00, 0x00, 0x00,
+0xCE, 0x9D, 0xA5, 0x25, 0xD1, 0xF0, 0x59, 0xEE, 0x5A, 0x57, 0xF4, 0xC3,
+0xDD, 0x62, 0x7D, 0x83, 0xD9, 0x73, 0xDE, 0x35, 0xB3, 0x7F, 0xE0, 0xA4,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0xE2, 0x6A, 0xF4, 0x1C, 0x0C, 0x76, 0x76, 0xEC, 0xB0, 0x44, 0x3D, 0xA3,
+0x32, 0x98, 0x54, 0xFF, 0x11, 0x5C, 0x18, 0xF3, 0x10, 0xD2, 0x5A, 0xE9,
+0x00, 0x00, 0x00, 0x00,
+0x2E, 0x37, 0xED, 0x38, 0xC5, 0x5E, 0x3E, 0x27, 0x69, 0x11, 0xAB, 0xB0,
+0x36, 0x91, 0xD3, 0x51, 0xC8, 0x27, 0x3A, 0x8F, 0xF6, 0x86, 0xEA, 0xA5,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0xD5, 0xD7, 0xD2, 0x74, 0xEA, 0x37, 0x12, 0x29, 0x9B, 0x8E, 0x33, 0x56,
+0xEE, 0x36, 0x36, 0x95, 0x0C, 0x12, 0x5C, 0x28, 0x86, 0x5E, 0xA6, 0x0D,
+0x00, 0x00, 0x00, 0x00,
+0x33, 0x32, 0x3C, 0xF1, 0x4C, 0xF0, 0x02, 0x13, 0xB2, 0x91, 0x83, 0x97,
+0xB9, 0x8A, 0x89, 0xFC, 0x72, 0x62, 0xA0, 0x3A, 0x2E, 0x5C, 0xD6, 0x26,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0xE6, 0xEF, 0xC5, 0x18, 0xA8, 0x47, 0x09, 0xD5, 0x6C, 0x3C, 0x11, 0xFE,
+0xAE, 0x23, 0xDB, 0x45, 0x6D, 0xE8, 0xBB, 0xE5, 0xF2, 0x99, 0xF1, 0x91,
+0x00, 0x00, 0x00, 0x00,
+0x64, 0xC0, 0xFE, 0x60, 0xB6, 0x81, 0x68, 0x37, 0xA4, 0xAE, 0x5D, 0x47,
+0xE9, 0x43, 0x73, 0x38, 0x19, 0x8A, 0x8D, 0xAC, 0xE8, 0x57, 0xCD, 0xEC,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0x28, 0x02, 0x51, 0x5B, 0xB9, 0xF5, 0xFE, 0xC9, 0xD6, 0xBC, 0x2E, 0x19,
+0x4C, 0x0A, 0x4C, 0x37, 0xF9, 0x83, 0x6A, 0xCE, 0x04, 0xF2, 0x98, 0x22,
+0x00, 0x00, 0x00, 0x00,
+0xD0, 0x74, 0xC5, 0xF4, 0x20, 0xB8, 0xE4, 0x46, 0xC0, 0x2C, 0xEB, 0xEF,
+0x44, 0x86, 0xD5, 0x06, 0x49, 0xC9, 0xC3, 0x10, 0x00, 0xA4, 0x13, 0xE7,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0xDF, 0xEE, 0x64, 0x2D, 0x0E, 0xCB, 0x78, 0x61, 0x99, 0x1F, 0x5E, 0xB8,
+0x5E, 0x7D, 0xAF, 0x27, 0x1F, 0xBE, 0xB7, 0x6C, 0xD7, 0xCE, 0x73, 0xD8,
+0x00, 0x00, 0x00, 0x00,
+0x9C, 0x7F, 0xA6, 0x52, 0x9C, 0x12, 0xC9, 0xEF, 0xAD, 0xD9, 0x04, 0x60,
+0x57, 0xB9, 0xD7, 0xA3, 0xE2, 0xF8, 0x41, 0xDC, 0x08, 0x98, 0x59, 0xFC,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0x8A, 0x92, 0xDF, 0x7F, 0x59, 0x6B, 0x6C, 0xBB, 0xF4, 0x3B, 0xF9, 0xD7,
+0xF0, 0x7E, 0x16, 0xAD, 0x1C, 0x06, 0x4E, 0x15, 0x32, 0xE4, 0xA9, 0xFA,
+0x00, 0x00, 0x00, 0x00,
+0x3F, 0x8F, 0x2C, 0xD5, 0x63, 0x0D, 0x3D, 0x0C, 0x8F, 0xE0, 0xF7, 0xD5,
+0xBE, 0xB2, 0x01, 0x61, 0xF3, 0x3C, 0xAE, 0xD6, 0xDD, 0xCD, 0x77, 0xD8,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0x1A, 0x05, 0x30, 0x45, 0x45, 0x23, 0xD1, 0x8E, 0x56, 0x6F, 0x62, 0x70,
+0xA8, 0x87, 0x44, 0xBD, 0x21, 0x9C, 0x3D, 0x5D, 0x25, 0xBB, 0xA5, 0xC1,
+0x00, 0x00, 0x00, 0x00,
+0x09, 0xA6, 0xDA, 0x65, 0x22, 0x2C, 0x98, 0xD6, 0x7F, 0x82, 0x19, 0x70,
+0xF9, 0x88, 0x46, 0x33, 0x7A, 0x41, 0xB3, 0x74, 0x33, 0x8C, 0xFD, 0xD9,
+0x00, 0x00, 0x00, 0x00
+}
+};
+
+static const CPKCL_ECC_COMB_TABLE p192_comb = {
+    48U, (const u1 *) p192_au1Comb, (u4) sizeof(p192_au1Comb)
+};
+#endif
+
+#ifdef CRYPTO_CPKCL_COMB_P224
+// *****************************************************************************
+/* P-224 generator comb, 56 columns */
+static const u1 p224_au1Comb[CPKCL_ECC_COMB_POINTS][64] = {
+{
+0x8D, 0x9F, 0x62, 0xCE, 0x8B, 0x1A, 0xCC, 0x72, 0x53, 0x32, 0x81, 0xE6,
+0x5C, 0x6A, 0x3A, 0x49, 0x65, 0xDC, 0x41, 0x7A, 0xF7, 0xCD, 0x1F, 0xB0,
+0x9A, 0x15, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xB9, 0xCB, 0xFB, 0x64, 0x45, 0xBD, 0x6D, 0xFB, 0x39, 0x33, 0x40, 0x41,
+0x55, 0xF0, 0xE3, 0x6E, 0xAB, 0x0D, 0x9E, 0x86, 0xC0, 0xB9, 0x1C, 0x9A,
+0xB4, 0xA9, 0x05, 0xD9, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x21, 0x1D, 0x5C, 0x11, 0xD6, 0x80, 0x32, 0x34, 0x22, 0x11, 0xC2, 0x56,
+0xD3, 0xC1, 0x03, 0x4A, 0xB9, 0x90, 0x13, 0x32, 0x7F, 0xBF, 0xB4, 0x6B,
+0xBD, 0x0C, 0x0E, 0xB7, 0x00, 0x00, 0x00, 0x00,
+0x34, 0x7E, 0x00, 0x85, 0x99, 0x81, 0xD5, 0x44, 0x64, 0x47, 0x07, 0x5A,
+0xA0, 0x75, 0x43, 0xCD, 0xE6, 0xDF, 0x22, 0x4C, 0xFB, 0x23, 0xF7, 0xB5,
+0x88, 0x63, 0x37, 0xBD, 0x00, 0x00, 0x00, 0x00
+},
+{
+0xE9, 0xBB, 0x6E, 0x66, 0x75, 0x96, 0xFD, 0x5E, 0xCE, 0x40, 0x4D, 0x66,
+0xA7, 0xBC, 0x43, 0x2A, 0x8A, 0x8D, 0xDF, 0x42, 0x22, 0xC5, 0x9B, 0xF9,
+0xB0, 0xBB, 0x49, 0x1F, 0x00, 0x00, 0x00, 0x00,
+0x43, 0x9C, 0xDC, 0x92, 0xB8, 0xE0, 0x29, 0x62, 0xE6, 0x36, 0x84, 0x60,
+0xE8, 0xEC, 0xD0, 0x10, 0x53, 0x18, 0x8F, 0x85, 0xDC, 0x21, 0xD3, 0xB8,
+0x4E, 0xDD, 0x12, 0x98, 0x00, 0x00, 0x00, 0x00
+},
+{
+0xB8, 0x8E, 0x5D, 0x8D, 0x67, 0x3E, 0x6D, 0xF1, 0x62, 0xB3, 0x1C, 0xED,
+0x9E, 0x55, 0x3F, 0x8A, 0xCE, 0xBB, 0xA3, 0xE9, 0x16, 0x48, 0xA7, 0xC2,
+0xD8, 0xCC, 0xDC, 0xEE, 0x00, 0x00, 0x00, 0x00,
+0x6D, 0x26, 0x50, 0xED, 0x90, 0x9F, 0xF1, 0xDF, 0xF9, 0x65, 0xBF, 0xB4,
+0xF2, 0xAB, 0xEC, 0xAF, 0x8F, 0x46, 0x65, 0x38, 0x31, 0x17, 0x0A, 0x91,
+0xBA, 0x79, 0xB3, 0x5C, 0x00, 0x00, 0x00, 0x00
+},
+{
+0xE3, 0x26, 0xAB, 0x6C, 0x96, 0x41, 0x06, 0xA0, 0xB0, 0xFA, 0x91, 0x29,
+0xFB, 0x91, 0x0B, 0x3A, 0xE1, 0xA4, 0x27, 0xEC, 0xEF, 0xBE, 0x8E, 0x5F,
+0x8A, 0xAA, 0x99, 0x04, 0x00, 0x00, 0x00, 0x00,
+0x5D, 0xAF, 0x66, 0x77, 0x40, 0x10, 0x75, 0x50, 0x54, 0x0D, 0x61, 0x29,
+0xD9, 0x84, 0x06, 0xF7, 0x82, 0xAE, 0x7A, 0xD7, 0x81, 0x5B, 0x8C, 0x33,
+0xD4, 0xF6, 0x16, 0x69, 0x00, 0x00, 0x00, 0x00
+},
+{
+0xC6, 0x15, 0x1F, 0x3B, 0xAC, 0x95, 0xEA, 0xD4, 0x82, 0x5E, 0x90, 0x00,
+0x60, 0x08, 0xB1, 0xC8, 0xD1, 0xE4, 0x3A, 0x32, 0xDD, 0xA3, 0x85, 0x76,
+0xBE, 0x56, 0x2B, 0x93, 0x00, 0x00, 0x00, 0x00,
+0xBF, 0xDB, 0x25, 0xEA, 0x3D, 0xF9, 0x9E, 0xF0, 0x90, 0xF3, 0x60, 0x59,
+0x66, 0x41, 0xA7, 0xA8, 0xE2, 0xDB, 0x76, 0xEC, 0xFD, 0x2A, 0x06, 0x19,
+0xF0, 0x80, 0x3E, 0x52, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x73, 0x2C, 0x73, 0x26, 0xDD, 0x2F, 0x82, 0x0F, 0x5D, 0x1B, 0x53, 0x83,
+0x1C, 0xA0, 0xA4, 0x1B, 0x7C, 0x34, 0x37, 0x3F, 0x36, 0x5C, 0x72, 0x84,
+0x5C, 0xB4, 0x91, 0xC3, 0x00, 0x00, 0x00, 0x00,
+0x24, 0xAD, 0xD6, 0xB2, 0xE1, 0xD5, 0xBB, 0xEC, 0xFA, 0x9D, 0xE1, 0xCD,
+0xFB, 0xDD, 0x7F, 0x2A, 0x22, 0x7E, 0xDA, 0x93, 0xC3, 0x44, 0xE2, 0xED,
+0x90, 0x78, 0xFB, 0x1E, 0x00, 0x00, 0x00, 0x00
+},
+{
+0xA1, 0x7D, 0x21, 0xCA, 0x90, 0x9E, 0x4C, 0xBB, 0x59, 0x91, 0xA7, 0xEC,
+0x1B, 0xD1, 0x7C, 0x8B, 0xC9, 0xC2, 0x33, 0x8D, 0xFF, 0x49, 0xF8, 0x09,
+0x94, 0xB3, 0x10, 0x26, 0x00, 0x00, 0x00, 0x00,
+0xA0, 0x4D, 0xC6, 0x2A, 0x35, 0xD1, 0x44, 0xFB, 0xB4, 0x46, 0x2C, 0x7B,
+0xBB, 0xCD, 0x89, 0x3C, 0x75, 0x9B, 0x07, 0x6C, 0x96, 0x12, 0xB1, 0x20,
+0xE8, 0xE4, 0x67, 0xFE, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x2D, 0x31, 0xF5, 0x2D, 0xAE, 0x8C, 0xE2, 0x6E, 0x5C, 0x6F, 0xD1, 0x61,
+0x1B, 0xC7, 0x4C, 0x7C, 0x3E, 0x9A, 0x61, 0xB7, 0x79, 0x47, 0x9B, 0x89,
+0x40, 0x32, 0xC7, 0x05, 0x00, 0x00, 0x00, 0x00,
+0x3A, 0x3E, 0xC7, 0x82, 0x63, 0x7F, 0x9F, 0xDA, 0x6B, 0xC5, 0x65, 0x51,
+0x61, 0x18, 0x56, 0xFD, 0x16, 0x21, 0xAB, 0x1F, 0x64, 0x94, 0x83, 0xB0,
+0x82, 0x58, 0x85, 0x72, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x09, 0x1C, 0x16, 0x2F, 0x18, 0x69, 0x04, 0xB5, 0x0F, 0xD0, 0xA8, 0x8C,
+0xA9, 0x74, 0xE0, 0xA3, 0x89, 0x34, 0xA9, 0x9D, 0xB8, 0x1D, 0x0C, 0xFB,
+0x68, 0x87, 0xC9, 0x41, 0x00, 0x00, 0x00, 0x00,
+0x81, 0xDA, 0x32, 0xFB, 0x05, 0xEA, 0xE5, 0x55, 0x68, 0xCA, 0xFB, 0x9F,
+0xCE, 0x3D, 0xE6, 0x59, 0xBF, 0x3F, 0x2D, 0xFE, 0x1C, 0xA7, 0x38, 0x87,
+0x40, 0x03, 0x5E, 0x0E, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x7F, 0xE8, 0x33, 0x23, 0x2B, 0xB2, 0xDA, 0xF6, 0xD2, 0x5D, 0x7A, 0x13,
+0x30, 0x44, 0xB8, 0xBE, 0x38, 0xF7, 0xB9, 0x3A, 0xE0, 0x24, 0x4F, 0xC3,
+0x0D, 0x5D, 0x0C, 0xCB, 0x00, 0x00, 0x00, 0x00,
+0xA5, 0xFD, 0xC8, 0xF0, 0x7D, 0x4A, 0x76, 0x44, 0x20, 0xFA, 0xC3, 0xA5,
+0x5B, 0x18, 0x50, 0xBE, 0xBC, 0x88, 0xD6, 0x81, 0x92, 0x81, 0x38, 0x89,
+0xDF, 0x31, 0x03, 0xC4, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x60, 0x0F, 0x6F, 0x79, 0x30, 0x95, 0xB8, 0xA3, 0x09, 0x69, 0xD2, 0x2B,
+0xE9, 0xAD, 0xDA, 0x84, 0x48, 0xFB, 0x83, 0x0C, 0x1A, 0x84, 0xA9, 0xA5,
+0x22, 0xBF, 0x65, 0x17, 0x00, 0x00, 0x00, 0x00,
+0x9E, 0xB0, 0x5D, 0xE7, 0x9E, 0x2A, 0x77, 0x6F, 0xC1, 0xCE, 0x67, 0x6C,
+0xBC, 0x23, 0x2F, 0x4E, 0xB1, 0xA8, 0xDB, 0x1E, 0x4C, 0x69, 0x13, 0x61,
+0xD9, 0x15, 0xA2, 0xE2, 0x00, 0x00, 0x00, 0x00
+},
+{
+0xB3, 0xEF, 0xB5, 0x9F, 0x50, 0x1E, 0x57, 0x52, 0x05, 0x41, 0x96, 0x86,
+0xE8, 0xAD, 0xFE, 0x74, 0xDA, 0xFA, 0x85, 0xAE, 0xC8, 0xE3, 0xBD, 0x3B,
+0xE8, 0x4B, 0x7E, 0x6C, 0x00, 0x00, 0x00, 0x00,
+0x52, 0x46, 0x0F, 0x16, 0x51, 0x9F, 0xFF, 0x39, 0x65, 0x5A, 0x49, 0xE2,
+0x7C, 0xB4, 0xF4, 0x82, 0xB5, 0x53, 0x6C, 0x94, 0xA2, 0x60, 0x9A, 0xEE,
+0xB3, 0x2D, 0x6D, 0x28, 0x00, 0x00, 0x00, 0x00
+},
+{
+0xAF, 0x44, 0x1A, 0x08, 0xD5, 0xBB, 0x40, 0x6C, 0x92, 0x13, 0x3B, 0x18,
+0x95, 0x09, 0xD0, 0xF6, 0x47, 0x6F, 0xBA, 0xEF, 0xBC, 0x57, 0x00, 0xCC,
+0xE9, 0x19, 0x56, 0x21, 0x00, 0x00, 0x00, 0x00,
+0x5E, 0xF4, 0x0D, 0x3B, 0x4D, 0xC9, 0x8B, 0x6F, 0x4F, 0x69, 0xA3, 0x54,
+0x1C, 0xF1, 0xB5, 0xE8, 0xDF, 0x3C, 0xB9, 0x31, 0x86, 0xB9, 0x2D, 0x98,
+0xB0, 0xF4, 0xE3, 0xE7, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x7B, 0x1C, 0x3E, 0xAB, 0x48, 0x70, 0xB1, 0xD8, 0xA1, 0xF8, 0x6F, 0xF3,
+0x38, 0xAC, 0xC6, 0xD2, 0x35, 0x94, 0x81, 0x29, 0x1C, 0xE9, 0x07, 0x4C,
+0x2F, 0x13, 0x13, 0xC8, 0x00, 0x00, 0x00, 0x00,
+0x1F, 0xB1, 0x03, 0x55, 0x42, 0x91, 0x28, 0xEA, 0x9F, 0x57, 0x30, 0x10,
+0x78, 0x08, 0x74, 0x96, 0xCC, 0xA5, 0x6B, 0x42, 0xF5, 0xBC, 0x62, 0x85,
+0xF1, 0xEB, 0x28, 0x1E, 0x00, 0x00, 0x00, 0x00
+},
+{
+0xEB, 0x64, 0xC8, 0x7C, 0x99, 0x31, 0x9F, 0x4C, 0x5E, 0x8B, 0xD2, 0x91,
+0xCD, 0x06, 0x73, 0xA9, 0x91, 0x66, 0x03, 0x17, 0xFF, 0x58, 0x7C, 0x49,
+0x51, 0xF3, 0xAE, 0xF1, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0x64, 0x05, 0x60, 0x2D, 0x1F, 0xDD, 0xDB, 0x02, 0x14, 0x3B, 0x07,
+0xAD, 0xDE, 0x93, 0xD6, 0x5B, 0x43, 0x84, 0xA6, 0x74, 0x58, 0x25, 0x96,
+0x1F, 0x47, 0xA7, 0xEE, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x79, 0x32, 0x2E, 0xE7, 0x2B, 0x85, 0x8E, 0xE4, 0xEF, 0xA6, 0x13, 0x94,
+0x2E, 0x5B, 0xE4, 0xF4, 0x26, 0x8E, 0xE4, 0x6C, 0x51, 0xC5, 0xEF, 0x84,
+0x96, 0x12, 0xFA, 0x43, 0x00, 0x00, 0x00, 0x00,
+0x6D, 0xAF, 0xFD, 0x50, 0xE1, 0xBF, 0xF2, 0xEF, 0xB6, 0xF3, 0x68, 0x68,
+0x29, 0x10, 0xC6, 0xED, 0x3A, 0x3E, 0x55, 0x0A, 0x44, 0xCC, 0xE4, 0x77,
+0xA9, 0x4C, 0x24, 0xCA, 0x00, 0x00, 0x00, 0x00
+}
+};
+
+static const CPKCL_ECC_COMB_TABLE p224_comb = {
+    56U, (const u1 *) p224_au1Comb, (u4) sizeof(p224_au1Comb)
+};
+#endif
+
+#ifdef CRYPTO_CPKCL_COMB_P256
+// *****************************************************************************
+/* P-256 generator comb, 64 columns */
+static const u1 p256_au1Comb[CPKCL_ECC_COMB_POINTS][72] = {
+{
+0xCA, 0xB0, 0xA5, 0x38, 0x62, 0xDD, 0x6D, 0x83, 0x59, 0x4A, 0x97, 0x27,
+0xAF, 0xB3, 0xBE, 0x1C, 0xC7, 0x28, 0x73, 0x62, 0xAE, 0xF4, 0x9A, 0x8F,
+0x70, 0x61, 0xFF, 0xE1, 0x06, 0x12, 0x91, 0x57, 0x00, 0x00, 0x00, 0x00,
+0x51, 0x48, 0xB1, 0x91, 0xCC, 0x9C, 0xDB, 0x7E, 0xDB, 0x50, 0x85, 0xDB,
+0x69, 0xC2, 0x6C, 0x59, 0x2F, 0xDD, 0xC2, 0x50, 0x0F, 0x50, 0x78, 0xC4,
+0x36, 0xAF, 0x17, 0xFA, 0xE3, 0x2D, 0x61, 0x2B, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x96, 0xC2, 0x98, 0xD8, 0x45, 0x39, 0xA1, 0xF4, 0xA0, 0x33, 0xEB, 0x2D,
+0x81, 0x7D, 0x03, 0x77, 0xF2, 0x40, 0xA4, 0x63, 0xE5, 0xE6, 0xBC, 0xF8,
+0x47, 0x42, 0x2C, 0xE1, 0xF2, 0xD1, 0x17, 0x6B, 0x00, 0x00, 0x00, 0x00,
+0xF5, 0x51, 0xBF, 0x37, 0x68, 0x40, 0xB6, 0xCB, 0xCE, 0x5E, 0x31, 0x6B,
+0x57, 0x33, 0xCE, 0x2B, 0x16, 0x9E, 0x0F, 0x7C, 0x4A, 0xEB, 0xE7, 0x8E,
+0x9B, 0x7F, 0x1A, 0xFE, 0xE2, 0x42, 0xE3, 0x4F, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x63, 0xDB, 0x14, 0x8E, 0xB4, 0x5C, 0xE7, 0x90, 0x7E, 0x1F, 0x65, 0xAD,
+0xAA, 0x3B, 0x49, 0x29, 0xDE, 0x25, 0x6E, 0x32, 0x2E, 0x59, 0x92, 0x84,
+0xA5, 0xAA, 0x11, 0x28, 0xBC, 0x22, 0xA8, 0x0F, 0x00, 0x00, 0x00, 0x00,
+0xE7, 0x2E, 0x46, 0x5F, 0x54, 0x24, 0x11, 0xE4, 0xF5, 0x82, 0xFE, 0x50,
+0x50, 0xA6, 0xB1, 0x34, 0x8B, 0x18, 0xDF, 0xB3, 0xBC, 0xD4, 0x4A, 0x6F,
+0x0D, 0xA8, 0xDB, 0xF5, 0xE8, 0x4A, 0xF4, 0xBF, 0x00, 0x00, 0x00, 0x00
+},
+{
+0xAF, 0x92, 0x79, 0x09, 0xE2, 0x1C, 0x39, 0x93, 0xFA, 0xF1, 0x35, 0x0D,
+0xFD, 0x98, 0x6C, 0xE9, 0x89, 0x27, 0xE0, 0x95, 0xDE, 0xC0, 0x57, 0xB2,
+0x6F, 0x72, 0xD6, 0x89, 0xBC, 0x4B, 0x0A, 0x30, 0x00, 0x00, 0x00, 0x00,
+0xA0, 0x27, 0x81, 0xC0, 0x91, 0xA2, 0x54, 0xAA, 0xA5, 0x06, 0xD8, 0xA9,
+0xAD, 0xEE, 0xB1, 0x5B, 0x6F, 0x3C, 0x1E, 0xFF, 0x25, 0xDB, 0x1D, 0x7F,
+0x44, 0x46, 0x9B, 0xD0, 0xE0, 0xC7, 0xAA, 0x72, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x85, 0xBD, 0x89, 0xD7, 0xC9, 0x4F, 0xC8, 0x57, 0xC3, 0xEA, 0x97, 0xC2,
+0x7D, 0xFF, 0x35, 0xFC, 0x6E, 0x76, 0xC6, 0x88, 0xD5, 0x2F, 0x98, 0xFB,
+0x67, 0x5E, 0xDB, 0xEE, 0x9B, 0x73, 0x7D, 0x44, 0x00, 0x00, 0x00, 0x00,
+0x32, 0x5B, 0xE2, 0x72, 0xC9, 0x33, 0x7E, 0x0C, 0x00, 0xE5, 0xFA, 0xA7,
+0x95, 0x9B, 0x34, 0x3D, 0xF7, 0xAF, 0x4A, 0x3A, 0x95, 0x9D, 0x2E, 0xE1,
+0xEE, 0x31, 0x41, 0x83, 0xAB, 0x25, 0x48, 0x2D, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x7F, 0x36, 0x1D, 0x2A, 0x93, 0x9C, 0x94, 0x13, 0xB7, 0x11, 0x0A, 0x1A,
+0x2B, 0xBD, 0x7F, 0xEF, 0x60, 0xFC, 0x1D, 0xB9, 0x8B, 0x06, 0xC6, 0xDD,
+0xFF, 0x72, 0x9C, 0x8A, 0x32, 0x19, 0x95, 0xEF, 0x00, 0x00, 0x00, 0x00,
+0xA8, 0xD8, 0x76, 0x73, 0xA7, 0x35, 0x60, 0x19, 0x40, 0x17, 0xCA, 0x95,
+0x08, 0x3B, 0x18, 0x23, 0x9C, 0x21, 0x2C, 0x02, 0x07, 0x98, 0xEE, 0xC1,
+0x9B, 0x2C, 0xBB, 0x7D, 0xC3, 0x9F, 0x1E, 0x61, 0x00, 0x00, 0x00, 0x00
+},
+{
+0xBC, 0xF4, 0x57, 0x0B, 0x92, 0xB1, 0xE2, 0xCA, 0x36, 0xBC, 0xC9, 0xC6,
+0x5E, 0xDF, 0x36, 0x29, 0xBF, 0x38, 0x12, 0xE1, 0x82, 0x64, 0xEA, 0x7D,
+0xD8, 0xF5, 0x51, 0x7B, 0x79, 0x63, 0x06, 0x55, 0x00, 0x00, 0x00, 0x00,
+0x4C, 0x96, 0x8A, 0x34, 0x16, 0xE2, 0xFF, 0x44, 0xE1, 0xFB, 0xDE, 0xDB,
+0x76, 0xD5, 0xB3, 0x9F, 0xE5, 0x50, 0x9D, 0x8D, 0x01, 0x40, 0xFA, 0x0A,
+0x51, 0xB8, 0xEC, 0x8A, 0x84, 0x64, 0x71, 0x15, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x01, 0xDE, 0x5C, 0xFC, 0xFF, 0xCA, 0x8E, 0xE4, 0x26, 0x5F, 0x71, 0x0D,
+0xE7, 0x84, 0xCD, 0x7C, 0x91, 0x43, 0x3E, 0xF4, 0x83, 0xF4, 0xE8, 0xA2,
+0xEA, 0x41, 0x11, 0xB2, 0x45, 0x77, 0x5D, 0xEB, 0x00, 0x00, 0x00, 0x00,
+0x79, 0x34, 0x1A, 0x73, 0xE2, 0x17, 0xC9, 0xCA, 0x45, 0xB6, 0x44, 0x28,
+0xFE, 0x2C, 0xF2, 0x85, 0xEE, 0x6C, 0x00, 0x58, 0xA1, 0xE6, 0x90, 0x09,
+0x7B, 0xC1, 0xEC, 0xDB, 0xEB, 0x72, 0xFD, 0xEA, 0x00, 0x00, 0x00, 0x00
+},
+{
+0xBE, 0x28, 0x37, 0x31, 0xFB, 0x0F, 0xF2, 0x6C, 0x4A, 0xB9, 0xC6, 0xA3,
+0x91, 0x95, 0x43, 0x96, 0xC5, 0x5F, 0x31, 0x44, 0x83, 0xFF, 0x36, 0x27,
+0x76, 0x92, 0x84, 0xA7, 0x77, 0x96, 0xD3, 0xA6, 0x00, 0x00, 0x00, 0x00,
+0xF4, 0xF5, 0x57, 0xC3, 0x33, 0xB8, 0xBA, 0xF2, 0x9B, 0x05, 0x84, 0x22,
+0x0C, 0x92, 0x4A, 0x82, 0xDF, 0xEC, 0x27, 0x2D, 0xBD, 0xBA, 0xB8, 0x66,
+0x16, 0x88, 0x0B, 0x9B, 0x74, 0x84, 0x4F, 0x67, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x3E, 0x8A, 0x7C, 0x67, 0x04, 0x8C, 0xF4, 0x2D, 0x6B, 0xA5, 0x03, 0x02,
+0x08, 0x2F, 0xE0, 0x74, 0xDB, 0xFE, 0xC7, 0xB8, 0x7D, 0x5F, 0x85, 0x31,
+0xAD, 0xDD, 0xC9, 0x72, 0x76, 0x9E, 0x76, 0x4E, 0x00, 0x00, 0x00, 0x00,
+0xB0, 0xBB, 0x24, 0xB8, 0x65, 0x61, 0xC3, 0xA4, 0xA5, 0x22, 0x91, 0x3B,
+0x6F, 0xE1, 0x9A, 0xFB, 0x81, 0x72, 0x94, 0x06, 0x72, 0x05, 0xC0, 0x1E,
+0x63, 0x06, 0x83, 0xDE, 0x82, 0x90, 0xB9, 0x42, 0x00, 0x00, 0x00, 0x00
+},
+{
+0xB9, 0x68, 0xA8, 0xDD, 0x50, 0x51, 0xF9, 0x6E, 0x31, 0xE1, 0x0C, 0x9C,
+0x79, 0x9E, 0xF8, 0xD1, 0x78, 0xC4, 0xA1, 0x08, 0xA0, 0x1C, 0xDC, 0x7F,
+0x4D, 0xE0, 0x6C, 0x1C, 0xF6, 0x8E, 0x87, 0x78, 0x00, 0x00, 0x00, 0x00,
+0x76, 0xD9, 0xE0, 0x1F, 0x12, 0xB9, 0x62, 0x9C, 0x4F, 0x8D, 0xE0, 0xBD,
+0x0E, 0x57, 0xCE, 0x6A, 0xEF, 0x9D, 0x30, 0x12, 0x2C, 0x14, 0x53, 0xDE,
+0x21, 0xC3, 0x72, 0x7B, 0x5D, 0x3F, 0xCB, 0xB6, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x73, 0x35, 0x1A, 0xC3, 0xD2, 0x1E, 0x99, 0x7F, 0x96, 0xB4, 0x4F, 0xD5,
+0x5B, 0xDD, 0x82, 0x5B, 0xAE, 0xFC, 0x2F, 0x81, 0x20, 0x52, 0x5C, 0x59,
+0x87, 0x12, 0x6B, 0x71, 0x4D, 0xBC, 0x88, 0x0C, 0x00, 0x00, 0x00, 0x00,
+0xA8, 0xAC, 0x48, 0x5F, 0x63, 0xBF, 0x57, 0x3A, 0xF3, 0x64, 0x25, 0xDF,
+0xF4, 0x81, 0x81, 0x7C, 0xAA, 0xE6, 0x04, 0x9C, 0xB3, 0xB5, 0xD1, 0x18,
+0xC6, 0x1D, 0x90, 0xF3, 0xA3, 0xDE, 0x5D, 0xDD, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x0C, 0xAD, 0x72, 0x3E, 0xFB, 0x79, 0x6A, 0xE9, 0x2F, 0x79, 0xBA, 0x42,
+0x8C, 0xA2, 0xA0, 0x43, 0xF3, 0x49, 0x3E, 0x08, 0x23, 0xA4, 0xE0, 0xEF,
+0x66, 0x74, 0x31, 0x6B, 0xAF, 0x44, 0xF3, 0x68, 0x00, 0x00, 0x00, 0x00,
+0x4A, 0x4D, 0xB2, 0x3F, 0xDB, 0x17, 0xFE, 0xCD, 0x26, 0xC6, 0xF5, 0x71,
+0x22, 0xFC, 0x8B, 0x66, 0xF3, 0x7F, 0xD6, 0x24, 0x3C, 0xD9, 0x4E, 0x60,
+0x20, 0x0A, 0x54, 0xF8, 0x05, 0xC4, 0xB9, 0x31, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x7F, 0x2E, 0x58, 0xA2, 0x89, 0x47, 0x6B, 0xD3, 0x28, 0x9C, 0xC3, 0x4E,
+0x14, 0x10, 0x1A, 0x0D, 0xA0, 0xD7, 0xBA, 0xED, 0xC3, 0x62, 0x3C, 0x66,
+0xB9, 0x1D, 0x46, 0x6F, 0x4B, 0xBF, 0x52, 0x40, 0x00, 0x00, 0x00, 0x00,
+0xEB, 0x25, 0x8D, 0x18, 0xC3, 0x27, 0x5A, 0x23, 0x5B, 0xCC, 0xBF, 0x99,
+0x39, 0xF3, 0x24, 0xE7, 0xC8, 0x0C, 0xD7, 0x71, 0xBD, 0xE6, 0x2B, 0x86,
+0x61, 0xFC, 0xB0, 0x90, 0x51, 0x4D, 0xCF, 0xFE, 0x00, 0x00, 0x00, 0x00
+},
+{
+0xAC, 0xCF, 0xD4, 0xA1, 0x10, 0x6C, 0x34, 0x74, 0xA4, 0xA7, 0x26, 0x85,
+0xC0, 0x5C, 0xDF, 0xAF, 0x7A, 0xFF, 0x2B, 0xF6, 0xA8, 0x02, 0x32, 0x12,
+0x1A, 0xE4, 0x02, 0xC8, 0xE2, 0xBA, 0xDD, 0x1E, 0x00, 0x00, 0x00, 0x00,
+0x44, 0xF8, 0x03, 0xD6, 0x2D, 0xAF, 0xA0, 0x8F, 0x17, 0x19, 0x70, 0x4C,
+0x7E, 0x6B, 0xE0, 0x36, 0xA0, 0x33, 0xDB, 0x73, 0x52, 0xF4, 0x45, 0x0C,
+0xFC, 0xBC, 0x0E, 0x56, 0x86, 0x4D, 0x10, 0x43, 0x00, 0x00, 0x00, 0x00
+},
+{
+0xE5, 0x78, 0x1D, 0x0D, 0x11, 0xB5, 0x15, 0x96, 0x4B, 0x74, 0xC4, 0x25,
+0x32, 0xDE, 0xB0, 0x66, 0x3A, 0x36, 0xAF, 0x6A, 0xFB, 0x46, 0x4A, 0x0A,
+0x1C, 0xA2, 0xF7, 0x84, 0xB4, 0x26, 0x8E, 0xB4, 0x00, 0x00, 0x00, 0x00,
+0x2D, 0x1B, 0xA0, 0x21, 0xF6, 0xB0, 0xEB, 0x06, 0x98, 0x0F, 0x7B, 0x8B,
+0x04, 0xE4, 0x04, 0xC0, 0x68, 0xF6, 0xD6, 0xFE, 0xCD, 0x1B, 0x13, 0x64,
+0xAB, 0x3D, 0x4D, 0x4D, 0x40, 0x15, 0xC0, 0xFA, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x7F, 0x36, 0xC3, 0x7C, 0xF0, 0x51, 0x22, 0x73, 0x7C, 0x4D, 0x18, 0x4F,
+0xCC, 0x7D, 0x3E, 0x5B, 0x80, 0xC1, 0x74, 0xFA, 0xC3, 0x1F, 0x00, 0x1F,
+0x1C, 0x23, 0x2C, 0xBA, 0x1A, 0x48, 0xBA, 0x4A, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0x8A, 0xC9, 0xCC, 0x8C, 0xA6, 0x11, 0x43, 0x28, 0xE6, 0x25, 0x26,
+0x40, 0xC5, 0x10, 0xF2, 0xE9, 0x84, 0x62, 0xF4, 0x5F, 0x29, 0x2F, 0x08,
+0x64, 0x1D, 0x9F, 0x04, 0xE7, 0xBF, 0x27, 0x78, 0x00, 0x00, 0x00, 0x00
+}
+};
+
+static const CPKCL_ECC_COMB_TABLE p256_comb = {
+    64U, (const u1 *) p256_au1Comb, (u4) sizeof(p256_au1Comb)
+};
+#endif
+
+#ifdef CRYPTO_CPKCL_COMB_P384
+// *****************************************************************************
+/* P-384 generator comb, 96 columns */
+static const u1 p384_au1Comb[CPKCL_ECC_COMB_POINTS][104] = {
+{
+0x73, 0x41, 0x21, 0x5E, 0x12, 0x39, 0xF6, 0x94, 0xAE, 0x24, 0xE4, 0xD8,
+0x30, 0x73, 0xB5, 0x83, 0x5F, 0x63, 0x96, 0xB1, 0xC2, 0x88, 0xCD, 0x25,
+0x55, 0xB0, 0x69, 0xE6, 0x25, 0x3E, 0xFD, 0x24, 0xC5, 0x42, 0xCB, 0xB5,
+0xBB, 0x19, 0xA6, 0xC2, 0xB3, 0x6C, 0x32, 0xB9, 0x40, 0x52, 0xA3, 0x52,
+0x00, 0x00, 0x00, 0x00,
+0x50, 0xEC, 0xB3, 0x9D, 0x4B, 0x3D, 0xF0, 0xF1, 0x91, 0x10, 0x77, 0x10,
+0x83, 0x32, 0x83, 0xF2, 0x11, 0x99, 0xD7, 0x06, 0x4A, 0xCC, 0x15, 0x8C,
+0x7D, 0x0E, 0xDB, 0xDD, 0x9D, 0x83, 0x61, 0x45, 0xE5, 0x97, 0x39, 0x41,
+0x64, 0x62, 0x9D, 0xA5, 0x4F, 0xF9, 0xD1, 0xFF, 0x6E, 0x5E, 0xC3, 0x98,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0xB7, 0x0A, 0x76, 0x72, 0x38, 0x5E, 0x54, 0x3A, 0x6C, 0x29, 0x55, 0xBF,
+0x5D, 0xF2, 0x02, 0x55, 0x38, 0x2A, 0x54, 0x82, 0xE0, 0x41, 0xF7, 0x59,
+0x98, 0x9B, 0xA7, 0x8B, 0x62, 0x3B, 0x1D, 0x6E, 0x74, 0xAD, 0x20, 0xF3,
+0x1E, 0xC7, 0xB1, 0x8E, 0x37, 0x05, 0x8B, 0xBE, 0x22, 0xCA, 0x87, 0xAA,
+0x00, 0x00, 0x00, 0x00,
+0x5F, 0x0E, 0xEA, 0x90, 0x7C, 0x1D, 0x43, 0x7A, 0x9D, 0x81, 0x7E, 0x1D,
+0xCE, 0xB1, 0x60, 0x0A, 0xC0, 0xB8, 0xF0, 0xB5, 0x13, 0x31, 0xDA, 0xE9,
+0x7C, 0x14, 0x9A, 0x28, 0xBD, 0x1D, 0xF4, 0xF8, 0x29, 0xDC, 0x92, 0x92,
+0xBF, 0x98, 0x9E, 0x5D, 0x6F, 0x2C, 0x26, 0x96, 0x4A, 0xDE, 0x17, 0x36,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0xC9, 0x21, 0xEE, 0xD8, 0x28, 0xB3, 0xC1, 0x39, 0xDB, 0x17, 0x87, 0x55,
+0x91, 0x0C, 0x3E, 0x2C, 0xA9, 0x86, 0x86, 0x3F, 0x8B, 0x80, 0x58, 0x4B,
+0x1A, 0x1B, 0x14, 0x18, 0x09, 0x39, 0x60, 0x43, 0xBC, 0x7A, 0xCA, 0x37,
+0x0D, 0x8B, 0xE9, 0xD6, 0x1B, 0xBD, 0x0C, 0x06, 0x9A, 0x38, 0x32, 0xF5,
+0x00, 0x00, 0x00, 0x00,
+0xCD, 0x6E, 0xD8, 0x23, 0x39, 0x18, 0x7E, 0x7A, 0x9A, 0x4E, 0x5A, 0x08,
+0xB1, 0x31, 0xEA, 0x31, 0x03, 0x36, 0x64, 0xBE, 0x5A, 0xCE, 0x40, 0xBC,
+0x63, 0x41, 0x12, 0xA2, 0xB2, 0xCF, 0x22, 0xBD, 0xBA, 0x82, 0x3A, 0xDE,
+0xA2, 0xCA, 0x04, 0x6F, 0x69, 0x8E, 0xB3, 0xC3, 0x2C, 0x85, 0xD2, 0xB9,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0xE5, 0xA0, 0x09, 0xEB, 0x46, 0x52, 0x4E, 0x26, 0x3C, 0xF0, 0xCD, 0x32,
+0x11, 0xBE, 0xF4, 0xF8, 0x4F, 0xFA, 0xAE, 0x5F, 0x83, 0x54, 0x9D, 0xDA,
+0x22, 0x1B, 0xA3, 0x17, 0xD0, 0x4F, 0xBC, 0xBB, 0x45, 0x61, 0xF0, 0x86,
+0x0C, 0xCD, 0xDE, 0xC3, 0xAB, 0x2C, 0x5F, 0x0A, 0x67, 0xF1, 0x8E, 0x52,
+0x00, 0x00, 0x00, 0x00,
+0xD6, 0x0D, 0x4F, 0xC1, 0x58, 0x98, 0x1E, 0x8A, 0x24, 0x75, 0xCB, 0x09,
+0xA8, 0x38, 0x05, 0x55, 0x22, 0xED, 0x7F, 0xC8, 0xB4, 0xCA, 0x60, 0xBD,
+0x8D, 0x05, 0x1D, 0x63, 0xDD, 0x6F, 0xB7, 0xF8, 0x14, 0xCF, 0x1D, 0x1A,
+0xA1, 0xEA, 0x03, 0x58, 0x6C, 0xF5, 0xCC, 0x7B, 0xBE, 0x1F, 0x9B, 0x7B,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0x53, 0xBD, 0x03, 0xAA, 0x9A, 0xB0, 0x28, 0xA6, 0x78, 0x2D, 0xF5, 0xA4,
+0x58, 0x54, 0x06, 0xBA, 0xEA, 0xDD, 0x10, 0x4D, 0x89, 0x87, 0x29, 0xDB,
+0x7D, 0x29, 0x3E, 0x8A, 0xAF, 0x31, 0x2A, 0xB4, 0x79, 0x12, 0x42, 0x06,
+0xE7, 0xF9, 0xF7, 0x40, 0xC4, 0x19, 0x01, 0x80, 0x4C, 0x0B, 0x9E, 0xC1,
+0x00, 0x00, 0x00, 0x00,
+0x41, 0x8C, 0xC8, 0xE6, 0xC5, 0x0F, 0x2D, 0x82, 0x58, 0xD8, 0x39, 0xE6,
+0x6D, 0xAA, 0x68, 0xAF, 0xF2, 0xEB, 0xF6, 0x35, 0xD1, 0xCA, 0xC7, 0xC1,
+0xF9, 0x7A, 0x56, 0xE3, 0xEA, 0x30, 0x7A, 0x57, 0xF6, 0x77, 0x5B, 0x1F,
+0x1D, 0x19, 0xA0, 0xE5, 0x01, 0xB3, 0x56, 0x03, 0xBF, 0xFD, 0xF3, 0x16,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0x09, 0x39, 0x13, 0xAA, 0x60, 0x15, 0x99, 0x30, 0x17, 0x00, 0xCB, 0xC6,
+0xB1, 0xDB, 0x97, 0x90, 0xE6, 0xFA, 0x60, 0xB8, 0x24, 0xE4, 0x7D, 0xD3,
+0xDD, 0x75, 0xB3, 0x70, 0xB2, 0x83, 0xB1, 0x9B, 0xA3, 0xE3, 0x6C, 0xCD,
+0x33, 0x62, 0x7A, 0x56, 0x88, 0x30, 0xDC, 0x0F, 0x9F, 0xBB, 0xB8, 0xAA,
+0x00, 0x00, 0x00, 0x00,
+0xA6, 0xD5, 0x0A, 0x60, 0x81, 0xB9, 0xC5, 0x16, 0x44, 0xAA, 0x2F, 0xD6,
+0xF2, 0x73, 0xDF, 0xEB, 0xF3, 0x7B, 0x74, 0xC9, 0xB3, 0x5B, 0x95, 0x6D,
+0xAC, 0x04, 0xEB, 0x15, 0xC8, 0x5F, 0x00, 0xF6, 0xB5, 0x50, 0x20, 0x28,
+0xD1, 0x01, 0xAF, 0xF0, 0x28, 0x6D, 0x4F, 0x31, 0x81, 0x2F, 0x94, 0x48,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0x5E, 0x60, 0x16, 0x77, 0x21, 0x11, 0x22, 0x20, 0xC8, 0x81, 0xF2, 0x9E,
+0xC8, 0xD2, 0x47, 0x23, 0x42, 0x63, 0x7D, 0x56, 0x99, 0x45, 0xBA, 0x54,
+0x3F, 0xF0, 0xC0, 0x77, 0x30, 0xBA, 0x0F, 0xCE, 0x44, 0x74, 0x36, 0xCB,
+0x02, 0xF8, 0x22, 0x70, 0x52, 0xA0, 0xA6, 0xA9, 0x36, 0xA9, 0x34, 0x73,
+0x00, 0x00, 0x00, 0x00,
+0x1A, 0xA0, 0x58, 0xD6, 0x68, 0x1F, 0x46, 0xB5, 0xFA, 0x0E, 0xBD, 0xC2,
+0x19, 0xD5, 0x64, 0x0A, 0x80, 0x92, 0x7A, 0x69, 0x8F, 0xEE, 0x2E, 0x9E,
+0x7A, 0x01, 0x0E, 0x7D, 0x89, 0x9B, 0x5D, 0x8E, 0xCD, 0x4C, 0xBD, 0x7C,
+0x36, 0x5C, 0x7C, 0x1F, 0x26, 0xC9, 0x32, 0xF6, 0xF7, 0xEF, 0xFC, 0x7F,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0x44, 0x83, 0x75, 0x0E, 0xE6, 0xE2, 0x0A, 0x30, 0xA5, 0x2C, 0x1A, 0x37,
+0x7A, 0x70, 0x1C, 0x45, 0x32, 0xDD, 0x52, 0x50, 0x10, 0x1D, 0x65, 0x25,
+0x54, 0xB9, 0x62, 0x48, 0x7F, 0xDE, 0x88, 0xBF, 0x13, 0xEF, 0x81, 0x03,
+0x6E, 0xE2, 0xFC, 0xFA, 0x0E, 0x09, 0x0E, 0x96, 0x17, 0x6C, 0x91, 0xDC,
+0x00, 0x00, 0x00, 0x00,
+0x89, 0x08, 0x6B, 0x02, 0x44, 0xCC, 0x17, 0xED, 0x1B, 0x44, 0x42, 0x9B,
+0xF1, 0x1F, 0xC0, 0x95, 0x97, 0x06, 0x16, 0xCC, 0x78, 0x64, 0x89, 0x40,
+0x35, 0x4A, 0xA0, 0x0B, 0xB8, 0x54, 0xD1, 0x52, 0x52, 0x29, 0x1C, 0x70,
+0xA4, 0x2E, 0xD9, 0xB3, 0x0A, 0xCA, 0x9E, 0xD6, 0x40, 0x8A, 0x6E, 0x26,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0x71, 0xCA, 0x05, 0x49, 0xC0, 0xC2, 0xBF, 0xE4, 0x61, 0xF7, 0x56, 0xD1,
+0x0A, 0x45, 0x3A, 0xF3, 0xC2, 0x48, 0x88, 0xD0, 0xDB, 0x29, 0x8B, 0x3D,
+0x86, 0x96, 0x30, 0xA2, 0x95, 0xA3, 0x7D, 0x09, 0xD7, 0x72, 0x49, 0x5F,
+0x03, 0x05, 0x19, 0x21, 0x12, 0xAA, 0xCB, 0x17, 0x58, 0x05, 0xD1, 0xB2,
+0x00, 0x00, 0x00, 0x00,
+0x24, 0xE3, 0x3E, 0x75, 0x55, 0xBB, 0xCE, 0xDD, 0x6F, 0x66, 0x24, 0x69,
+0x7C, 0xB0, 0x7A, 0xE8, 0x68, 0x1A, 0xCF, 0x4E, 0x74, 0x5D, 0x47, 0x9B,
+0xC0, 0x36, 0x62, 0x2E, 0xF5, 0xE8, 0x2B, 0xF8, 0x6B, 0x05, 0xFD, 0x3C,
+0xBA, 0x0D, 0x7C, 0x23, 0xD2, 0xCB, 0xC6, 0xC3, 0x72, 0xD8, 0x4C, 0x35,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0xEE, 0x4C, 0x8D, 0x70, 0x24, 0x4D, 0x10, 0x8D, 0x43, 0xF0, 0x9C, 0x81,
+0x58, 0x69, 0x7D, 0x19, 0x10, 0x22, 0x71, 0xF0, 0xFA, 0x87, 0xFC, 0x47,
+0x58, 0x15, 0x20, 0x5C, 0x85, 0xF7, 0x3D, 0x10, 0x38, 0xF6, 0x1E, 0x61,
+0xE8, 0xA9, 0xB0, 0x30, 0xEC, 0xBF, 0xFE, 0xFD, 0xC8, 0x9A, 0xB1, 0x00,
+0x00, 0x00, 0x00, 0x00,
+0x3E, 0xE0, 0x01, 0xD2, 0x6F, 0x8D, 0x0E, 0xD4, 0x5F, 0xFF, 0x28, 0x22,
+0x9C, 0x96, 0x7C, 0xBB, 0xC5, 0x64, 0x61, 0x63, 0x82, 0x02, 0x81, 0x68,
+0x0D, 0x22, 0x54, 0xE7, 0xD2, 0x3C, 0xBB, 0xCD, 0xC4, 0xED, 0xF6, 0xE9,
+0x25, 0xFE, 0x18, 0x14, 0x31, 0x60, 0xE3, 0x9E, 0x05, 0x91, 0x2F, 0xA7,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0x7A, 0x73, 0x69, 0xB7, 0x73, 0xC2, 0xD2, 0x64, 0xFD, 0x3F, 0xD5, 0x97,
+0x51, 0x24, 0xC0, 0x2C, 0xBD, 0x46, 0x6C, 0xE8, 0x4B, 0xAC, 0xB6, 0xC3,
+0x6D, 0x92, 0x5E, 0x68, 0x1F, 0x41, 0xE9, 0x17, 0x36, 0x3A, 0x20, 0x75,
+0x6B, 0xF3, 0x6D, 0x13, 0x7E, 0xB2, 0xF0, 0x8B, 0xE0, 0x61, 0x95, 0x3F,
+0x00, 0x00, 0x00, 0x00,
+0xA7, 0x90, 0xE9, 0x27, 0xD5, 0xF8, 0x6F, 0xDD, 0x60, 0x7A, 0x86, 0xF9,
+0x86, 0xE5, 0x4B, 0xC3, 0x14, 0xE0, 0x54, 0x85, 0x47, 0x87, 0x08, 0xEA,
+0xCB, 0xE4, 0x52, 0x6F, 0x64, 0xD6, 0xCE, 0xCF, 0x41, 0xB6, 0x2A, 0x41,
+0x20, 0x5A, 0x1A, 0x4B, 0x87, 0x95, 0x62, 0x39, 0x06, 0xF0, 0x06, 0x0B,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0x82, 0x1F, 0x65, 0x85, 0xD2, 0x0D, 0x4C, 0x04, 0xF7, 0x3E, 0x5D, 0x78,
+0xE7, 0x51, 0x5C, 0x32, 0x32, 0x55, 0xE9, 0x88, 0x61, 0x18, 0x3A, 0xB8,
+0x31, 0x29, 0x2C, 0x52, 0xAD, 0x94, 0x9F, 0x53, 0x37, 0xF1, 0x80, 0x89,
+0x5B, 0x4E, 0x27, 0x15, 0xD7, 0x66, 0x0F, 0xDF, 0x10, 0xB0, 0xD7, 0x9F,
+0x00, 0x00, 0x00, 0x00,
+0xC0, 0xE4, 0x64, 0x40, 0x4A, 0xB9, 0xA7, 0xE4, 0x11, 0xD2, 0xD7, 0x25,
+0x45, 0xBA, 0x4E, 0xD4, 0xE3, 0x04, 0x8A, 0xBE, 0x54, 0x6B, 0x80, 0x0A,
+0xDE, 0x33, 0x90, 0x14, 0xBD, 0x26, 0x92, 0x92, 0x46, 0x92, 0x73, 0xC9,
+0xA3, 0x6F, 0x5F, 0x79, 0x25, 0x02, 0x26, 0xB9, 0xA3, 0xA9, 0x1A, 0x32,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0x8E, 0x7B, 0x70, 0x8B, 0xF5, 0xC2, 0xBC, 0x49, 0x83, 0x89, 0x92, 0x1D,
+0x19, 0xB5, 0x01, 0x29, 0x80, 0xC7, 0x49, 0x7D, 0x56, 0x29, 0x4C, 0x2E,
+0x64, 0x99, 0x6A, 0x4C, 0xF8, 0xCF, 0xD1, 0xEB, 0x13, 0x3E, 0xEE, 0x16,
+0xD3, 0xBB, 0xAE, 0x2C, 0xF7, 0x68, 0x7A, 0xA8, 0xEE, 0x43, 0xA5, 0x36,
+0x00, 0x00, 0x00, 0x00,
+0x6D, 0x94, 0x69, 0xB5, 0x29, 0x1C, 0xB4, 0x75, 0x7E, 0x26, 0xF2, 0x3E,
+0xD4, 0xE7, 0x10, 0x15, 0x4D, 0x39, 0xB3, 0xD4, 0x72, 0x50, 0x23, 0x91,
+0xD1, 0x85, 0xBD, 0x8F, 0x04, 0xFF, 0xEA, 0x58, 0x47, 0x78, 0xA6, 0x78,
+0x03, 0xAB, 0x49, 0xD3, 0x1C, 0xE4, 0x0E, 0xA5, 0xCD, 0xBA, 0x77, 0xF2,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0xBD, 0x3B, 0x86, 0x5F, 0x58, 0x56, 0xB0, 0x10, 0x3D, 0x28, 0x83, 0xB4,
+0x5A, 0xDC, 0x2C, 0xE9, 0x1D, 0x42, 0x7C, 0xDC, 0x09, 0x12, 0xB3, 0xEB,
+0xA8, 0xA5, 0x01, 0x6D, 0x79, 0xBD, 0xFC, 0x3A, 0x51, 0x6A, 0x8B, 0xA0,
+0xCA, 0x67, 0xB0, 0xE2, 0xEB, 0x7A, 0xCB, 0xE8, 0xC2, 0x0D, 0x6E, 0x02,
+0x00, 0x00, 0x00, 0x00,
+0x8A, 0xE1, 0xDD, 0x02, 0x29, 0x50, 0xC3, 0xD8, 0x36, 0xCF, 0xC6, 0xD8,
+0xAC, 0x5F, 0xC1, 0x64, 0x45, 0x1E, 0x78, 0x10, 0x01, 0x27, 0xEA, 0x17,
+0xD8, 0x43, 0x34, 0x1F, 0xFC, 0x1F, 0x8D, 0xD6, 0xA5, 0x61, 0x74, 0x8C,
+0x37, 0x56, 0xE2, 0x4B, 0xE1, 0x24, 0xEF, 0xD8, 0xBA, 0x66, 0x88, 0xAE,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0x1C, 0xA9, 0x65, 0xD2, 0xD0, 0x78, 0x3A, 0xAC, 0xD3, 0x83, 0x8F, 0x6C,
+0xEF, 0xF8, 0x29, 0x1A, 0x17, 0xD8, 0xD8, 0x8F, 0xDE, 0xFD, 0x98, 0xEF,
+0x48, 0xF7, 0x2B, 0xC4, 0xA1, 0x9E, 0x45, 0xDF, 0xC7, 0x3D, 0xA7, 0x81,
+0x39, 0xFC, 0xDA, 0x14, 0x2D, 0xFA, 0x2A, 0xC5, 0x54, 0xFA, 0x3D, 0xB0,
+0x00, 0x00, 0x00, 0x00,
+0xE7, 0x2C, 0x0D, 0x6C, 0x6E, 0x6F, 0x40, 0xCC, 0xCA, 0x72, 0xFD, 0x41,
+0x2B, 0x0B, 0x12, 0xCD, 0xDD, 0x02, 0xF6, 0x78, 0x06, 0x90, 0x5D, 0xEF,
+0x29, 0xF2, 0xCC, 0x8A, 0xD1, 0xA2, 0xF8, 0xF5, 0x8A, 0x90, 0x6D, 0xCE,
+0xCF, 0x1F, 0xFD, 0xAA, 0xF2, 0x85, 0x6D, 0x0E, 0x5A, 0x88, 0xE2, 0x2C,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0xDE, 0x66, 0x26, 0xC6, 0x0E, 0x9A, 0x10, 0x89, 0x1E, 0xD0, 0xFC, 0x7F,
+0x75, 0x2E, 0xC1, 0xC8, 0xB0, 0x5A, 0x8B, 0xC4, 0x69, 0x61, 0x20, 0xA8,
+0x6C, 0xAC, 0x83, 0xF9, 0xCF, 0xFD, 0xC2, 0x4B, 0x23, 0x7D, 0x97, 0x55,
+0x71, 0xCA, 0xCF, 0x59, 0x6A, 0xC9, 0x66, 0x57, 0x33, 0xCB, 0x64, 0x12,
+0x00, 0x00, 0x00, 0x00,
+0x4B, 0x4B, 0x01, 0x2E, 0x81, 0x13, 0x69, 0x6B, 0xC5, 0x3E, 0x48, 0xE4,
+0x07, 0x87, 0xD2, 0x31, 0x58, 0x97, 0xB1, 0xFF, 0x0C, 0x19, 0xF7, 0xCB,
+0x48, 0xF2, 0xA5, 0x65, 0xA0, 0x17, 0x67, 0xB6, 0x69, 0x4F, 0x3B, 0xC5,
+0xFA, 0xD8, 0x4A, 0xD9, 0x76, 0xA3, 0xA1, 0xA1, 0xEE, 0xBE, 0x9E, 0x11,
+0x00, 0x00, 0x00, 0x00
+},
+{
+0x1E, 0x73, 0x55, 0x36, 0x91, 0xE5, 0x83, 0x1B, 0xC4, 0x70, 0x07, 0xEF,
+0x7D, 0x4E, 0x2A, 0x0B, 0x9E, 0xEA, 0x1C, 0xFA, 0xF5, 0x7D, 0x83, 0xC2,
+0x98, 0xDC, 0x69, 0x8C, 0x66, 0x27, 0x34, 0x69, 0x3E, 0x6B, 0x62, 0x71,
+0xEA, 0x69, 0x80, 0xF3, 0x8A, 0x7E, 0x7B, 0xCB, 0x7E, 0x84, 0x53, 0xFA,
+0x00, 0x00, 0x00, 0x00,
+0xF8, 0x5E, 0x9A, 0x44, 0x68, 0x5D, 0x3E, 0xF5, 0x64, 0x7E, 0x2D, 0xD5,
+0x0D, 0x17, 0xAB, 0x3F, 0xCB, 0x2A, 0x1B, 0xC6, 0xEE, 0x04, 0x03, 0xE6,
+0xD6, 0xE4, 0x0C, 0xC4, 0x1B, 0xAE, 0xD4, 0x86, 0xC7, 0x1D, 0x16, 0xE0,
+0x5C, 0x8E, 0x82, 0xB9, 0x4F, 0x1C, 0x83, 0xA1, 0x19, 0x97, 0x30, 0x6A,
+0x00, 0x00, 0x00, 0x00
+}
+};
+
+static const CPKCL_ECC_COMB_TABLE p384_comb = {
+    96U, (const u1 *) p384_au1Comb, (u4) sizeof(p384_au1Comb)
+};
+#endif
+
+#ifdef CRYPTO_CPKCL_COMB_P521
+// *****************************************************************************
+/* P-521 generator comb, 131 columns */
+static const u1 p521_au1Comb[CPKCL_ECC_COMB_POINTS][144] = {
+{
+0x3E, 0x7E, 0x29, 0x97, 0xB8, 0xAC, 0x51, 0xF7, 0xFD, 0x17, 0x20, 0x57,
+0x37, 0xB8, 0xD8, 0x8B, 0x9D, 0x60, 0x01, 0x64, 0xC1, 0x14, 0x07, 0x99,
+0x2D, 0xBB, 0x1B, 0xA9, 0xCE, 0xD3, 0x48, 0xFA, 0xB9, 0x3E, 0xAF, 0x02,
+0x3C, 0x30, 0xC2, 0xFB, 0xDC, 0x47, 0x87, 0xCF, 0x52, 0xD4, 0x83, 0x13,
+0xF3, 0xE0, 0xFD, 0x33, 0xE6, 0xCB, 0xF2, 0x69, 0x1C, 0xB1, 0xC3, 0x63,
+0xED, 0xCD, 0xBF, 0xDF, 0xC4, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x9F, 0xA9, 0x09, 0x30, 0xB7, 0x5F, 0x94, 0x5B, 0x1C, 0x04, 0xA2, 0xC2,
+0xD9, 0x67, 0xD0, 0x83, 0x95, 0x92, 0x63, 0xDA, 0x66, 0xD6, 0x76, 0x45,
+0xB6, 0xB1, 0x8C, 0x19, 0xA9, 0x87, 0x67, 0x22, 0x68, 0x48, 0x48, 0xCE,
+0x99, 0x28, 0x6F, 0x82, 0xEF, 0xE1, 0x5E, 0xEC, 0x15, 0x2B, 0xBC, 0x00,
+0x48, 0x34, 0xAE, 0x2F, 0xBF, 0xF5, 0x60, 0xE9, 0x4E, 0x40, 0x39, 0x60,
+0x31, 0xAC, 0x16, 0x27, 0xE7, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x66, 0xBD, 0xE5, 0xC2, 0x31, 0x7E, 0x7E, 0xF9, 0x9B, 0x42, 0x6A, 0x85,
+0xC1, 0xB3, 0x48, 0x33, 0xDE, 0xA8, 0xFF, 0xA2, 0x27, 0xC1, 0x1D, 0xFE,
+0x28, 0x59, 0xE7, 0xEF, 0x77, 0x5E, 0x4B, 0xA1, 0xBA, 0x3D, 0x4D, 0x6B,
+0x60, 0xAF, 0x28, 0xF8, 0x21, 0xB5, 0x3F, 0x05, 0x39, 0x81, 0x64, 0x9C,
+0x42, 0xB4, 0x95, 0x23, 0x66, 0xCB, 0x3E, 0x9E, 0xCD, 0xE9, 0x04, 0x04,
+0xB7, 0x06, 0x8E, 0x85, 0xC6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x50, 0x66, 0xD1, 0x9F, 0x76, 0x94, 0xBE, 0x88, 0x40, 0xC2, 0x72, 0xA2,
+0x86, 0x70, 0x3C, 0x35, 0x61, 0x07, 0xAD, 0x3F, 0x01, 0xB9, 0x50, 0xC5,
+0x40, 0x26, 0xF4, 0x5E, 0x99, 0x72, 0xEE, 0x97, 0x2C, 0x66, 0x3E, 0x27,
+0x17, 0xBD, 0xAF, 0x17, 0x68, 0x44, 0x9B, 0x57, 0x49, 0x44, 0xF5, 0x98,
+0xD9, 0x1B, 0x7D, 0x2C, 0xB4, 0x5F, 0x8A, 0x5C, 0x04, 0xC0, 0x3B, 0x9A,
+0x78, 0x6A, 0x29, 0x39, 0x18, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+},
+{
+0xCA, 0x07, 0xFD, 0x66, 0x9B, 0xEB, 0x36, 0x10, 0x90, 0xB4, 0x7F, 0x6B,
+0xC1, 0x2C, 0xA5, 0x6C, 0x70, 0xC2, 0xE0, 0xD3, 0x3E, 0x97, 0x2E, 0x51,
+0x11, 0x2D, 0xD9, 0x73, 0xBF, 0x80, 0x99, 0x88, 0xEA, 0x5E, 0x00, 0xA4,
+0xE4, 0xCF, 0xB4, 0x38, 0x13, 0x43, 0xEB, 0x8C, 0xCC, 0x92, 0xF9, 0xB6,
+0x23, 0x7C, 0xAF, 0x6D, 0x8D, 0x2F, 0xAC, 0xD0, 0xCB, 0x93, 0x2A, 0xE3,
+0x17, 0xBF, 0xCF, 0x1C, 0xC2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xCA, 0x8C, 0x50, 0x2F, 0xF1, 0xD6, 0xD9, 0x7B, 0xAF, 0x72, 0x5A, 0x59,
+0x71, 0x71, 0x2D, 0xE8, 0x73, 0x28, 0x51, 0x97, 0x76, 0x29, 0xD0, 0x25,
+0xBC, 0x9F, 0xF3, 0x8C, 0x8B, 0xDE, 0xC1, 0xEF, 0xF4, 0x37, 0x12, 0x9A,
+0x7F, 0xB7, 0xE6, 0x25, 0x5D, 0x8B, 0xD9, 0xD4, 0xE7, 0x73, 0x3B, 0x9F,
+0xFE, 0x07, 0xCB, 0xEC, 0x2B, 0xA6, 0xFD, 0xE1, 0xCF, 0x50, 0x53, 0x62,
+0x03, 0x3B, 0x81, 0xDB, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x61, 0xBD, 0x27, 0x9B, 0x9B, 0x1C, 0x5A, 0x41, 0xD6, 0x54, 0x68, 0x60,
+0x53, 0x27, 0x52, 0x74, 0x38, 0x35, 0xE7, 0x92, 0xF4, 0x1E, 0x33, 0x9E,
+0x6D, 0x7A, 0x7E, 0x81, 0x85, 0xBA, 0x3D, 0x0B, 0x3B, 0x27, 0xAC, 0x49,
+0x53, 0xBD, 0xC4, 0x55, 0x7F, 0x41, 0xB5, 0xFC, 0x8D, 0xC7, 0x42, 0xAD,
+0x38, 0x8D, 0xE0, 0x92, 0xB9, 0x98, 0x89, 0x52, 0xCC, 0x14, 0x19, 0xCC,
+0xF6, 0xFF, 0xC2, 0x14, 0xC1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x45, 0x96, 0x7E, 0x76, 0xB0, 0x6F, 0xB2, 0x35, 0x59, 0xA6, 0xE5, 0xC5,
+0x2F, 0x51, 0x2B, 0x16, 0xB8, 0xFB, 0x47, 0xCC, 0x96, 0x36, 0xE0, 0xA6,
+0x9B, 0xA6, 0x29, 0x0A, 0x65, 0xB0, 0x2D, 0x73, 0x5D, 0xDF, 0x6B, 0xD5,
+0xED, 0x74, 0x8A, 0x05, 0xD9, 0x58, 0xC8, 0x25, 0xA0, 0x60, 0x7B, 0x4B,
+0x3D, 0x37, 0x43, 0xBD, 0xD4, 0xA6, 0xF8, 0x17, 0xB4, 0x10, 0xF6, 0xED,
+0x51, 0x8F, 0x96, 0x7B, 0x1F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x77, 0xFA, 0xC0, 0x1B, 0xA4, 0xB5, 0x56, 0x5F, 0xF5, 0x36, 0xFD, 0x64,
+0xB5, 0x6B, 0xDD, 0x6C, 0x7F, 0x7C, 0x5B, 0x8A, 0xB5, 0x68, 0xAC, 0xD0,
+0xF9, 0x9E, 0x91, 0x09, 0xBF, 0xD9, 0x92, 0x4A, 0x20, 0xC5, 0xC3, 0x71,
+0x2B, 0xE1, 0x05, 0xC3, 0xEE, 0x9A, 0x69, 0xDB, 0x1C, 0x9D, 0x4A, 0x55,
+0x43, 0x46, 0xF5, 0x61, 0x77, 0x00, 0xDE, 0x7F, 0xCE, 0x15, 0x91, 0x47,
+0x24, 0x31, 0xC1, 0x99, 0x39, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x2D, 0xAC, 0x71, 0xC2, 0xE1, 0x90, 0xF8, 0x25, 0xAC, 0x70, 0xB3, 0x94,
+0xD3, 0xCC, 0x53, 0x13, 0x11, 0x40, 0x4D, 0x74, 0xF6, 0xAD, 0xB5, 0xC7,
+0x27, 0x81, 0x37, 0xBE, 0x87, 0x76, 0xCD, 0x9C, 0xCD, 0xE3, 0xC4, 0x06,
+0x5C, 0x9B, 0x48, 0xA8, 0xF9, 0x05, 0x55, 0x30, 0x0A, 0x58, 0x45, 0x19,
+0x2B, 0xB1, 0xB3, 0x4A, 0x20, 0x0A, 0x19, 0x07, 0x4D, 0xEA, 0x34, 0x15,
+0xB1, 0x3E, 0xF5, 0x0F, 0x59, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x48, 0x85, 0x79, 0x91, 0xDD, 0x4E, 0x7D, 0x87, 0x7A, 0x65, 0x1D, 0x03,
+0x25, 0x7B, 0x3C, 0xC4, 0x04, 0x8A, 0xB1, 0xFA, 0x71, 0x36, 0x60, 0x47,
+0x76, 0xB4, 0x70, 0xF6, 0xF2, 0xE7, 0x39, 0x7E, 0x03, 0xCC, 0x2F, 0xB0,
+0x31, 0x64, 0xB7, 0xF7, 0xF5, 0x46, 0x7F, 0x87, 0xF3, 0x62, 0x56, 0x7C,
+0x61, 0x0C, 0x8B, 0x1C, 0x7E, 0x32, 0xF8, 0x5B, 0x22, 0xE3, 0x8B, 0x4A,
+0x53, 0xB3, 0xCD, 0xE9, 0xAE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x20, 0x44, 0x26, 0x9D, 0x2E, 0x09, 0xD7, 0xA2, 0xDB, 0xF3, 0x3F, 0x53,
+0x52, 0x03, 0x97, 0x1F, 0x2E, 0xB5, 0xB5, 0x99, 0x2B, 0x23, 0xDD, 0x31,
+0xE9, 0x45, 0x0F, 0x85, 0x6B, 0xE1, 0x9C, 0x8A, 0x49, 0x18, 0x01, 0xC3,
+0x23, 0x90, 0xC9, 0x01, 0x1E, 0x30, 0xE9, 0xC8, 0x89, 0x09, 0xC3, 0x4B,
+0x4C, 0xF6, 0x95, 0xCD, 0x70, 0xDE, 0xA4, 0x77, 0x89, 0xF2, 0x26, 0x10,
+0xBB, 0x97, 0x87, 0xBC, 0xD7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+},
+{
+0xF8, 0xED, 0xE9, 0x2B, 0x34, 0x09, 0xEA, 0x98, 0x99, 0x81, 0xB9, 0xFC,
+0x32, 0x31, 0x2F, 0x6C, 0xEB, 0x3A, 0xF8, 0xFA, 0x3D, 0x89, 0x79, 0xF5,
+0x0F, 0xDA, 0x3F, 0xC7, 0xBB, 0x87, 0x8E, 0x85, 0x1C, 0x9D, 0x0B, 0x7A,
+0xFB, 0xB3, 0xC0, 0xD3, 0xB1, 0x68, 0xEE, 0x71, 0x05, 0x63, 0xFE, 0x21,
+0x16, 0x6F, 0xAA, 0x66, 0x1F, 0xF0, 0xF8, 0x5B, 0xED, 0x25, 0xA8, 0xBC,
+0x99, 0x4C, 0x93, 0x30, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xF2, 0x22, 0x30, 0x91, 0x50, 0x98, 0x30, 0xE4, 0xCE, 0x80, 0x5B, 0xDE,
+0xC9, 0x36, 0xC3, 0xFD, 0xEF, 0x30, 0x61, 0x8B, 0x89, 0xD6, 0x16, 0xB7,
+0xF4, 0xD2, 0x58, 0xA7, 0x05, 0xB4, 0x58, 0x8A, 0x1C, 0xBC, 0x5C, 0xAA,
+0xF8, 0x9D, 0x87, 0x98, 0xBB, 0xE0, 0x2C, 0xC1, 0x06, 0xFD, 0x7C, 0x84,
+0x3C, 0xFF, 0x02, 0x8C, 0x60, 0x63, 0x00, 0xA1, 0x5B, 0x69, 0x38, 0x34,
+0x6A, 0x90, 0x6E, 0x83, 0x36, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x2D, 0xE0, 0x9C, 0x25, 0x51, 0xE3, 0x8F, 0xAC, 0xF7, 0xE0, 0xE5, 0xDA,
+0x0C, 0xDA, 0x06, 0xA5, 0x1D, 0x42, 0x43, 0xF0, 0x98, 0x6E, 0xB5, 0x77,
+0x90, 0x74, 0x64, 0xA1, 0xC7, 0x41, 0xD0, 0xE0, 0x01, 0x01, 0xB9, 0x9C,
+0x89, 0x07, 0x1F, 0xE4, 0xE6, 0x72, 0x3E, 0xDA, 0x72, 0xF5, 0xBB, 0x29,
+0xF0, 0x4D, 0xA1, 0x04, 0x47, 0x5C, 0x63, 0x6B, 0xD3, 0xF5, 0x1E, 0xE8,
+0x58, 0x3F, 0x87, 0x56, 0xDD, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x3F, 0xE3, 0xF9, 0x5C, 0x9E, 0xE7, 0xAB, 0x77, 0xFD, 0x17, 0x11, 0x0A,
+0x81, 0xB5, 0xAA, 0x91, 0xE1, 0x2F, 0xAC, 0xCB, 0xB1, 0xF3, 0xED, 0x11,
+0xB7, 0x13, 0x21, 0xD7, 0x17, 0xE0, 0x43, 0xEF, 0x02, 0x40, 0xB7, 0x06,
+0x5C, 0x68, 0xAD, 0xF9, 0x1A, 0x3B, 0xBD, 0x8F, 0xCE, 0x70, 0x63, 0x7E,
+0x82, 0x3A, 0xF7, 0x42, 0x0B, 0xD5, 0x0D, 0x55, 0x9B, 0x4A, 0xE6, 0xC5,
+0xBE, 0x46, 0x21, 0x8F, 0xF2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x82, 0xED, 0x34, 0x29, 0xCC, 0x04, 0xA7, 0x05, 0x8C, 0xDD, 0x9E, 0x98,
+0xFB, 0x89, 0x70, 0x64, 0x2D, 0xC6, 0xE7, 0x0C, 0xD4, 0x39, 0xB2, 0xE0,
+0xFF, 0x5E, 0x5A, 0x10, 0xA6, 0x2E, 0x89, 0x4C, 0x04, 0x6B, 0xED, 0xD5,
+0x5F, 0x39, 0x19, 0xA5, 0x94, 0xD7, 0x9E, 0x50, 0x03, 0x70, 0x6C, 0x80,
+0xC4, 0xE5, 0x0C, 0xE7, 0x86, 0x98, 0x2E, 0x88, 0xA9, 0xF6, 0x01, 0xFF,
+0xA1, 0x0C, 0x73, 0x50, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x84, 0x54, 0xCC, 0xDB, 0x16, 0x8A, 0xA7, 0x90, 0x50, 0x4B, 0x45, 0xFD,
+0x8C, 0x07, 0xAB, 0xC1, 0x25, 0xE5, 0x09, 0xCB, 0x52, 0x82, 0x48, 0x6F,
+0xD7, 0x2E, 0x9B, 0xE1, 0x53, 0x3F, 0x66, 0xDD, 0x9C, 0xF5, 0x7B, 0xA6,
+0xA1, 0x0D, 0xB1, 0x16, 0x0A, 0x77, 0xBB, 0x36, 0x95, 0x6B, 0x7F, 0xB4,
+0xCE, 0x2B, 0x7B, 0x77, 0x28, 0x84, 0xDC, 0x6B, 0xF8, 0x53, 0x15, 0x56,
+0x3D, 0xAE, 0x02, 0xCD, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x5A, 0xD1, 0x79, 0x15, 0xA0, 0x33, 0x36, 0x1E, 0x1F, 0xCD, 0x98, 0x3E,
+0x23, 0x0C, 0x4F, 0x57, 0x99, 0x4F, 0x0F, 0xC6, 0xCA, 0x9D, 0x96, 0x45,
+0x24, 0x9F, 0xFB, 0x49, 0x93, 0x2C, 0x06, 0x10, 0x40, 0xF6, 0x78, 0xD3,
+0xD7, 0x29, 0x9A, 0xD2, 0x2F, 0x8C, 0xD4, 0xD7, 0x60, 0x17, 0x94, 0xEC,
+0x5C, 0xEA, 0xFB, 0x31, 0x59, 0x1C, 0x59, 0xF0, 0xBF, 0x9E, 0x0F, 0xB4,
+0x6B, 0x3E, 0x17, 0xD6, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x72, 0x4A, 0x98, 0x5A, 0x39, 0x4F, 0x0F, 0x22, 0x26, 0x0F, 0x51, 0x32,
+0xCE, 0x82, 0x3F, 0x9A, 0x1D, 0x9A, 0x06, 0x8C, 0x76, 0x4C, 0xD0, 0xF3,
+0x57, 0x1E, 0xA2, 0x69, 0x91, 0xD8, 0xD6, 0xF1, 0x01, 0xB6, 0x4D, 0xDC,
+0x0B, 0xB3, 0x96, 0x6B, 0xE0, 0xF3, 0xDC, 0x64, 0x28, 0xB7, 0xEE, 0x71,
+0xF3, 0xAF, 0xCA, 0xC7, 0x83, 0xC4, 0x80, 0x6F, 0xE4, 0x66, 0x1B, 0x57,
+0x92, 0x30, 0x53, 0x45, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+},
+{
+0xAD, 0x0D, 0x14, 0x87, 0x21, 0x45, 0xAE, 0x49, 0x3E, 0x80, 0xE2, 0x57,
+0x2B, 0x03, 0x73, 0xDA, 0x0A, 0xA2, 0x6E, 0x02, 0xEB, 0xE5, 0xF5, 0x13,
+0xB9, 0xAF, 0x00, 0x6E, 0xB0, 0xC4, 0x54, 0x2D, 0x74, 0x04, 0x15, 0x7A,
+0x2B, 0xB9, 0x93, 0x43, 0xDA, 0xA7, 0xF1, 0x13, 0xF8, 0x1B, 0xB4, 0xB5,
+0x7A, 0x86, 0xB5, 0x02, 0x07, 0x69, 0x78, 0x6D, 0xD1, 0xA4, 0x2E, 0xAF,
+0xAC, 0xA9, 0x93, 0x51, 0xB3, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xCB, 0x86, 0xB1, 0xA6, 0xF7, 0x63, 0x15, 0x2A, 0xB6, 0x57, 0x8E, 0xE2,
+0x44, 0x0A, 0xA7, 0x73, 0x1D, 0x8A, 0xFC, 0x78, 0x6D, 0xFC, 0xC4, 0xD7,
+0x99, 0x6D, 0x3D, 0xDF, 0x81, 0x45, 0x9B, 0x4C, 0xAB, 0x3A, 0x37, 0x1E,
+0x49, 0x52, 0x4F, 0x54, 0x8E, 0x49, 0x13, 0xE9, 0xA2, 0x34, 0x94, 0xE9,
+0x4C, 0x0F, 0x70, 0xC4, 0x49, 0x97, 0x15, 0x30, 0x66, 0x27, 0x14, 0xE5,
+0xCC, 0x02, 0xEF, 0xB8, 0xD0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+},
+{
+0xC9, 0xFF, 0xE6, 0xB9, 0xA6, 0x05, 0x98, 0xE9, 0x7B, 0x97, 0x4D, 0xF7,
+0x05, 0x7F, 0x35, 0x1A, 0xBC, 0x41, 0x99, 0x5C, 0x31, 0xEF, 0xDD, 0xC8,
+0xE7, 0x42, 0xE8, 0xCB, 0xCA, 0x66, 0x6D, 0x4B, 0x2D, 0xC1, 0x0D, 0xA2,
+0x5F, 0xF7, 0xE1, 0x84, 0xFC, 0x02, 0x0C, 0x5F, 0x50, 0x2C, 0x1B, 0x8B,
+0x3D, 0x49, 0x7B, 0x03, 0x9E, 0x88, 0xA1, 0x3F, 0x46, 0x50, 0x70, 0x95,
+0xE0, 0xD9, 0x0B, 0x72, 0xC2, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x09, 0x93, 0xAB, 0x93, 0x78, 0x33, 0x1F, 0x1A, 0x94, 0x8F, 0x6A, 0x22,
+0xA2, 0x30, 0x5A, 0xE0, 0xBD, 0xF1, 0x45, 0x40, 0x2D, 0xA5, 0x01, 0x2C,
+0x15, 0x51, 0x5F, 0xAB, 0xD5, 0x8F, 0x2E, 0xF4, 0xCF, 0xFE, 0x05, 0x0C,
+0x09, 0x1D, 0x4D, 0x95, 0xD3, 0x50, 0x06, 0x8D, 0xD1, 0x64, 0xE9, 0x47,
+0x01, 0x08, 0x86, 0x3C, 0x5D, 0xFA, 0x66, 0x68, 0xAF, 0xB4, 0xBB, 0x5A,
+0xBF, 0xEC, 0x2F, 0xAC, 0x2C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x47, 0x77, 0x53, 0xE5, 0xD2, 0xC3, 0x6D, 0x84, 0x46, 0x9F, 0x5F, 0x1F,
+0xDF, 0x00, 0x8E, 0xE2, 0x2D, 0xE4, 0x31, 0x3F, 0x24, 0xF6, 0x1A, 0x04,
+0x25, 0xF2, 0x6A, 0x25, 0x7F, 0x94, 0x48, 0x49, 0x50, 0x95, 0x4F, 0xFF,
+0x1A, 0xC6, 0x96, 0x38, 0x3E, 0x5A, 0xBB, 0x34, 0x73, 0xC7, 0x40, 0xCB,
+0xCC, 0xFA, 0xEA, 0xEC, 0x07, 0xCB, 0xBE, 0xB9, 0x3E, 0xE8, 0x45, 0x4D,
+0x49, 0xF0, 0x29, 0xFE, 0xAA, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xDB, 0x78, 0x55, 0x6B, 0xB3, 0x71, 0xFB, 0x83, 0x26, 0x05, 0x71, 0x0A,
+0x15, 0xF1, 0x17, 0x30, 0x77, 0x0D, 0x22, 0x5F, 0x46, 0xC9, 0x9E, 0x18,
+0x68, 0x5E, 0x46, 0x48, 0x07, 0xAE, 0x87, 0xBA, 0xEA, 0xCB, 0xE0, 0x70,
+0xD5, 0x74, 0xA4, 0x1D, 0xC5, 0xA7, 0x2B, 0x2B, 0xA6, 0xB0, 0x2C, 0xB9,
+0xE2, 0xB7, 0x1F, 0x8B, 0x6D, 0x35, 0xCB, 0x35, 0x18, 0xCB, 0xC8, 0x2C,
+0x6A, 0x29, 0x55, 0x11, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x04, 0xF6, 0xD0, 0x6E, 0x9B, 0x9D, 0x9C, 0x7F, 0xD7, 0xC6, 0x49, 0xCB,
+0xE9, 0x43, 0x5E, 0x76, 0xCA, 0xE5, 0x9B, 0xAE, 0x67, 0xDD, 0xC4, 0x03,
+0x36, 0xED, 0x5A, 0x40, 0x8B, 0x88, 0x80, 0x54, 0xDB, 0xCD, 0x0C, 0x92,
+0xB2, 0xEB, 0x69, 0x3A, 0xCC, 0xC7, 0xF0, 0x03, 0x73, 0x05, 0xEC, 0x44,
+0x26, 0xB0, 0x89, 0xCE, 0x37, 0x24, 0x8E, 0x15, 0x17, 0x9A, 0x17, 0x4F,
+0x29, 0x50, 0x79, 0x86, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xD9, 0x3D, 0x19, 0x9F, 0x32, 0x40, 0x85, 0xF7, 0xA9, 0x58, 0xC1, 0xDC,
+0x68, 0x40, 0x1E, 0x53, 0xA5, 0xB1, 0x42, 0x36, 0xBF, 0x71, 0x41, 0x77,
+0xA3, 0x3A, 0xE5, 0xC1, 0x0F, 0x92, 0xB4, 0x12, 0x8D, 0x47, 0x87, 0xFD,
+0x53, 0xFB, 0xC5, 0xD1, 0xCA, 0xA7, 0xCB, 0xA7, 0x58, 0x8C, 0x95, 0x48,
+0xC7, 0xF2, 0x66, 0x3F, 0xB2, 0x2C, 0x5B, 0x37, 0xBD, 0x99, 0x88, 0x59,
+0x0F, 0x0D, 0x51, 0x1B, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x41, 0x7E, 0x00, 0x52, 0x9D, 0x29, 0x96, 0xFE, 0xCD, 0x8D, 0x70, 0xCD,
+0xB5, 0x40, 0x71, 0x99, 0xFA, 0xF6, 0x55, 0xF6, 0xED, 0x4E, 0x29, 0xE9,
+0x9D, 0x83, 0x8B, 0xD5, 0x5D, 0xD4, 0x01, 0x77, 0xDB, 0x7C, 0xF7, 0xB6,
+0xAD, 0xF5, 0xBD, 0x5D, 0xF0, 0x72, 0xA5, 0x95, 0xF4, 0x89, 0x51, 0x26,
+0x7B, 0x5E, 0x51, 0xB3, 0x4E, 0x79, 0x62, 0xC1, 0x0B, 0x5E, 0x65, 0x72,
+0xE0, 0x71, 0xB5, 0xBF, 0x68, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x6B, 0x2A, 0xA8, 0xBD, 0x63, 0xB8, 0xD2, 0xF0, 0xC7, 0x9C, 0x0A, 0x39,
+0x83, 0xB2, 0xF5, 0x3D, 0x7B, 0xCD, 0x0F, 0x70, 0x5A, 0x99, 0xB9, 0xBA,
+0x06, 0x6C, 0x4E, 0xFA, 0xAF, 0xF0, 0x1E, 0xC0, 0xD4, 0x92, 0xA3, 0x76,
+0x13, 0x85, 0xA9, 0x10, 0xF0, 0x92, 0x53, 0x95, 0x72, 0xFC, 0xE3, 0xA7,
+0x50, 0x85, 0x7A, 0x1D, 0x28, 0x01, 0x3C, 0x8E, 0xA8, 0x98, 0x18, 0x36,
+0x1A, 0x55, 0xCA, 0xCB, 0x0F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x15, 0x11, 0xB7, 0x3A, 0x40, 0xCD, 0xA4, 0xC8, 0x5B, 0xB5, 0xB9, 0xBC,
+0x0D, 0x17, 0x83, 0xB7, 0x26, 0xB4, 0xD9, 0xAB, 0x6A, 0x0F, 0xE2, 0x1B,
+0x14, 0xB7, 0x77, 0x53, 0x64, 0xEA, 0xD2, 0x32, 0xBF, 0x8B, 0x35, 0x6B,
+0x80, 0x24, 0x34, 0xDA, 0x11, 0x22, 0x20, 0x6E, 0x00, 0xC8, 0x2B, 0x78,
+0x99, 0xC4, 0x27, 0xAA, 0xC4, 0x74, 0x09, 0xF8, 0xDE, 0x1C, 0x34, 0x50,
+0xA9, 0x6F, 0xE6, 0xC2, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xC3, 0x60, 0xAE, 0x24, 0x5B, 0xB9, 0x2C, 0x08, 0x84, 0x74, 0xAD, 0x83,
+0xF4, 0x0A, 0xB8, 0xD4, 0x6B, 0x25, 0x05, 0x62, 0xCE, 0x39, 0xB7, 0x84,
+0x63, 0xE0, 0x1F, 0xAE, 0x5E, 0x50, 0x6F, 0x61, 0x8F, 0x21, 0x2F, 0x34,
+0x68, 0xEA, 0x14, 0xEF, 0x86, 0x11, 0xA0, 0x64, 0x6C, 0xD6, 0x17, 0x2B,
+0xCE, 0x8B, 0x85, 0x50, 0xCE, 0x89, 0xE8, 0x60, 0x05, 0x10, 0x88, 0xD5,
+0x59, 0x6C, 0x04, 0xDB, 0xE1, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+},
+{
+0x05, 0x75, 0x82, 0x62, 0xA9, 0x53, 0xBF, 0xEE, 0x84, 0xDA, 0xB5, 0x03,
+0xF1, 0xE9, 0xBF, 0xC5, 0x59, 0xE8, 0x8F, 0xB8, 0x79, 0x73, 0xF9, 0x97,
+0x37, 0xFC, 0x14, 0x63, 0x73, 0x62, 0x81, 0x9F, 0x00, 0x30, 0xC6, 0xC0,
+0x9A, 0x6A, 0xBA, 0xB2, 0xD3, 0x66, 0x1F, 0x7A, 0x63, 0xE2, 0x10, 0xFB,
+0x92, 0x15, 0x5E, 0x1A, 0x67, 0xD9, 0x7F, 0x57, 0x3B, 0xFA, 0x51, 0x16,
+0x2C, 0x67, 0xAD, 0x77, 0xFD, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x9A, 0xEE, 0x25, 0xBA, 0xD1, 0x10, 0x1C, 0xA1, 0xDF, 0xB3, 0x6A, 0x4F,
+0xD3, 0x9A, 0xC8, 0x8D, 0x00, 0x7A, 0x60, 0xAE, 0x10, 0x8D, 0xCE, 0xCA,
+0xB4, 0xB1, 0x3A, 0xCF, 0xB0, 0x8C, 0x32, 0xB0, 0x4D, 0x3E, 0x97, 0x32,
+0x7D, 0x9A, 0x82, 0x34, 0x96, 0xD0, 0x88, 0x77, 0x3E, 0xB5, 0x68, 0x63,
+0x6D, 0xCE, 0x1D, 0x6A, 0xEA, 0x43, 0x47, 0xCD, 0x66, 0x95, 0x50, 0xC1,
+0xD9, 0x0F, 0x7F, 0x6B, 0x42, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+}
+};
+
+static const CPKCL_ECC_COMB_TABLE p521_comb = {
+    131U, (const u1 *) p521_au1Comb, (u4) sizeof(p521_au1Comb)
+};
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: CPKCL Comb Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+const CPKCL_ECC_COMB_TABLE *DRV_CRYPTO_ECC_GetCombTable(
+    CRYPTO_CPKCL_CURVE curveType)
+{
+    const CPKCL_ECC_COMB_TABLE *pComb = NULL;
+    
+    switch (curveType)
+    {
+#ifdef CRYPTO_CPKCL_COMB_P192
+        case CRYPTO_CPKCL_CURVE_P192:
+            pComb = &p192_comb;
+            break;
+#endif
+#ifdef CRYPTO_CPKCL_COMB_P224
+        case CRYPTO_CPKCL_CURVE_P224:
+            pComb = &p224_comb;
+            break;
+#endif
+#ifdef CRYPTO_CPKCL_COMB_P256
+        case CRYPTO_CPKCL_CURVE_P256:
+            pComb = &p256_comb;
+            break;
+#endif
+#ifdef CRYPTO_CPKCL_COMB_P384
+        case CRYPTO_CPKCL_CURVE_P384:
+            pComb = &p384_comb;
+            break;
+#endif
+#ifdef CRYPTO_CPKCL_COMB_P521
+        case CRYPTO_CPKCL_CURVE_P521:
+            pComb = &p521_comb;
+            break;
+#endif
+        default:
+            pComb = NULL;
+            break;
+    }
+    
+    return pComb;
+}
@@ -55,6 +55,7 @@ Microchip or any third party.
 #include "crypto/drivers/CPKCL_Lib/CryptoLib_Headers_pb.h"
 #include "crypto/drivers/CPKCL_Lib/CryptoLib_JumpTable_Addr_pb.h"
 #include "crypto/drivers/CPKCL_Lib/CryptoLib_cf.h"
+#include "crypto/wolfcrypt/wolfcrypt_config.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -74,12 +75,25 @@ CPKCL_PARAM     CPKCLParam;
 #define CPKCL_SELFTEST_CHECKSUM1   0x6E70DDD2
 #define CPKCL_SELFTEST_CHECKSUM2   0x25C8D64F
 
+/* Number of operations between two CPKCL self tests, 0 runs it only once */
+#ifndef CRYPTO_CPKCL_SELFTEST_PERIOD
+#define CRYPTO_CPKCL_SELFTEST_PERIOD    (0U)
+#endif
+
+/* Random numbers drawn for a private key before giving up, a draw is only
+   rejected when it is 0 or not below the order */
+#define CPKCL_KEYGEN_MAX_DRAWS     (8U)
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Data Definitions
 // *****************************************************************************
 // *****************************************************************************
 
+/* The curve constants below are stored least significant byte first, the
+   order the CPKCC expects in crypto RAM, with the 4 (8 for Cns) zero padding
+   bytes at the end. They are copied as-is without a byte reversal. */
+
 // *****************************************************************************
 /* 192-bit Elliptic Curve Parameters
 
@@ -88,60 +102,60 @@ CPKCL_PARAM     CPKCLParam;
 */
 // P = 2^192 - 2^64 + 1
 static const u1 p192_au1ModuloP[28] = {
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00
 };
 
 // "a" parameter in curve equation
 // x^3 = x^2 + a*x + b
 static const u1 p192_au1ACurve[28] = {
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFC
+0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00
 };
 
 // Base point A abscissa
 static const u1 p192_au1PtA_X[28] = {
-0x00, 0x00, 0x00, 0x00, 0x18, 0x8d, 0xa8, 0x0e, 0xb0, 0x30, 0x90, 0xf6,
-0x7c, 0xbf, 0x20, 0xeb, 0x43, 0xa1, 0x88, 0x00, 0xf4, 0xff, 0x0a, 0xfd,
-0x82, 0xff, 0x10, 0x12
+0x12, 0x10, 0xff, 0x82, 0xfd, 0x0a, 0xff, 0xf4, 0x00, 0x88, 0xa1, 0x43,
+0xeb, 0x20, 0xbf, 0x7c, 0xf6, 0x90, 0x30, 0xb0, 0x0e, 0xa8, 0x8d, 0x18,
+0x00, 0x00, 0x00, 0x00
 };
 
 // Base point A ordinate
 static const u1 p192_au1PtA_Y[28] = {
-0x00, 0x00, 0x00, 0x00, 0x07, 0x19, 0x2b, 0x95, 0xff, 0xc8, 0xda, 0x78,
-0x63, 0x10, 0x11, 0xed, 0x6b, 0x24, 0xcd, 0xd5, 0x73, 0xf9, 0x77, 0xa1,
-0x1e, 0x79, 0x48, 0x11
+0x11, 0x48, 0x79, 0x1e, 0xa1, 0x77, 0xf9, 0x73, 0xd5, 0xcd, 0x24, 0x6b,
+0xed, 0x11, 0x10, 0x63, 0x78, 0xda, 0xc8, 0xff, 0x95, 0x2b, 0x19, 0x07,
+0x00, 0x00, 0x00, 0x00
 };
 
 // Base point A height
 static const u1 p192_au1PtA_Z[28] = {
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x01
+0x00, 0x00, 0x00, 0x00
 };
 
 // OrderPointBase
 static const u1 p192_au1OrderPoint[28] = {
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0x99, 0xDE, 0xF8, 0x36, 0x14, 0x6B, 0xC9, 0xB1,
-0xB4, 0xD2, 0x28, 0x31
+0x31, 0x28, 0xD2, 0xB4, 0xB1, 0xC9, 0x6B, 0x14, 0x36, 0xF8, 0xDE, 0x99,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00
 };
 
 // Reduction constant
 static const u1 p192_au1Cns[32] = {
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00
+0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00
 };
 
 // "b" parameter in curve equation
 // x^3 = x^2 + a*x + b
 static const u1 p192_au1BCurve[28] = {
-0x00, 0x00, 0x00, 0x00, 0x64, 0x21, 0x05, 0x19, 0xe5, 0x9c, 0x80, 0xe7,
-0x0f, 0xa7, 0xe9, 0xab, 0x72, 0x24, 0x30, 0x49, 0xfe, 0xb8, 0xde, 0xec,
-0xc1, 0x46, 0xb9, 0xb1
+0xb1, 0xb9, 0x46, 0xc1, 0xec, 0xde, 0xb8, 0xfe, 0x49, 0x30, 0x24, 0x72,
+0xab, 0xe9, 0xa7, 0x0f, 0xe7, 0x80, 0x9c, 0xe5, 0x19, 0x05, 0x21, 0x64,
+0x00, 0x00, 0x00, 0x00
 };
 
 // *****************************************************************************
@@ -152,60 +166,60 @@ static const u1 p192_au1BCurve[28] = {
 */
 // P = 2^192 - 2^64 - 1
 static const u1 p224_au1ModuloP[32] = {
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00
 };
 
 // "a" parameter in curve equation = -3
 // x^3 = x^2 + a*x + b
 static const u1 p224_au1ACurve[32] = {
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00
 };
 
 // Base point A abscissa
 static const u1 p224_au1PtA_X[32] = {
-0x00, 0x00, 0x00, 0x00, 0xB7, 0x0E, 0x0C, 0xBD, 0x6B, 0xB4, 0xBF, 0x7F,
-0x32, 0x13, 0x90, 0xB9, 0x4A, 0x03, 0xC1, 0xD3, 0x56, 0xC2, 0x11, 0x22,
-0x34, 0x32, 0x80, 0xD6, 0x11, 0x5C, 0x1D, 0x21
+0x21, 0x1D, 0x5C, 0x11, 0xD6, 0x80, 0x32, 0x34, 0x22, 0x11, 0xC2, 0x56,
+0xD3, 0xC1, 0x03, 0x4A, 0xB9, 0x90, 0x13, 0x32, 0x7F, 0xBF, 0xB4, 0x6B,
+0xBD, 0x0C, 0x0E, 0xB7, 0x00, 0x00, 0x00, 0x00
 };
 
 // Base point A ordinate
 static const u1 p224_au1PtA_Y[32] = {
-0x00, 0x00, 0x00, 0x00, 0xBD, 0x37, 0x63, 0x88, 0xB5, 0xF7, 0x23, 0xFB,
-0x4C, 0x22, 0xDF, 0xE6, 0xCD, 0x43, 0x75, 0xA0, 0x5A, 0x07, 0x47, 0x64,
-0x44, 0xD5, 0x81, 0x99, 0x85, 0x00, 0x7E, 0x34
+0x34, 0x7E, 0x00, 0x85, 0x99, 0x81, 0xD5, 0x44, 0x64, 0x47, 0x07, 0x5A,
+0xA0, 0x75, 0x43, 0xCD, 0xE6, 0xDF, 0x22, 0x4C, 0xFB, 0x23, 0xF7, 0xB5,
+0x88, 0x63, 0x37, 0xBD, 0x00, 0x00, 0x00, 0x00
 };
 
 // Base point A height
 static const u1 p224_au1PtA_Z[32] = {
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
 // OrderPointBase
 static const u1 p224_au1OrderPoint[32] = {
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x16, 0xA2, 0xE0, 0xB8, 0xF0, 0x3E,
-0x13, 0xDD, 0x29, 0x45, 0x5C, 0x5C, 0x2A, 0x3D
+0x3D, 0x2A, 0x5C, 0x5C, 0x45, 0x29, 0xDD, 0x13, 0x3E, 0xF0, 0xB8, 0xE0,
+0xA2, 0x16, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00
 };
 
 // Reduction constant
 static const u1 p224_au1Cns[36] = {
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00
+0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00
 };
 
 // "b" parameter in curve equation
 // x^3 = x^2 + a*x + b
 static const u1 p224_au1BCurve[32] = {
-0x00, 0x00, 0x00, 0x00, 0xb4, 0x05, 0x0a, 0x85, 0x0c, 0x04, 0xb3, 0xab,
-0xf5, 0x41, 0x32, 0x56, 0x50, 0x44, 0xb0, 0xb7, 0xd7, 0xbf, 0xd8, 0xba,
-0x27, 0x0b, 0x39, 0x43, 0x23, 0x55, 0xff, 0xb4
+0xb4, 0xff, 0x55, 0x23, 0x43, 0x39, 0x0b, 0x27, 0xba, 0xd8, 0xbf, 0xd7,
+0xb7, 0xb0, 0x44, 0x50, 0x56, 0x32, 0x41, 0xf5, 0xab, 0xb3, 0x04, 0x0c,
+0x85, 0x0a, 0x05, 0xb4, 0x00, 0x00, 0x00, 0x00
 };
 
 // *****************************************************************************
@@ -216,61 +230,61 @@ static const u1 p224_au1BCurve[32] = {
 */
 // P = 2^256 - 2^224 - 2^96 + 1
 static const u1 p256_au1ModuloP[36] = {
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00
 };
 
 // "a" parameter in curve equation = -3
 // x^3 = x^2 + a*x + b
 static const u1 p256_au1ACurve[36] = {
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x01,
+0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC
+0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00
 };
 
 // Base point A abscissa
 static const u1 p256_au1PtA_X[36] = {
-0x00, 0x00, 0x00, 0x00, 0x6b, 0x17, 0xd1, 0xf2, 0xe1, 0x2c, 0x42, 0x47,
-0xf8, 0xbc, 0xe6, 0xe5, 0x63, 0xa4, 0x40, 0xf2, 0x77, 0x03, 0x7d, 0x81,
-0x2d, 0xeb, 0x33, 0xa0, 0xf4, 0xa1, 0x39, 0x45, 0xd8, 0x98, 0xc2, 0x96
+0x96, 0xc2, 0x98, 0xd8, 0x45, 0x39, 0xa1, 0xf4, 0xa0, 0x33, 0xeb, 0x2d,
+0x81, 0x7d, 0x03, 0x77, 0xf2, 0x40, 0xa4, 0x63, 0xe5, 0xe6, 0xbc, 0xf8,
+0x47, 0x42, 0x2c, 0xe1, 0xf2, 0xd1, 0x17, 0x6b, 0x00, 0x00, 0x00, 0x00
 };
 
 // Base point A ordinate
 static const u1 p256_au1PtA_Y[36] = {
-0x00, 0x00, 0x00, 0x00, 0x4f, 0xe3, 0x42, 0xe2, 0xfe, 0x1a, 0x7f, 0x9b,
-0x8e, 0xe7, 0xeb, 0x4a, 0x7c, 0x0f, 0x9e, 0x16, 0x2b, 0xce, 0x33, 0x57,
-0x6b, 0x31, 0x5e, 0xce, 0xcb, 0xb6, 0x40, 0x68, 0x37, 0xbf, 0x51, 0xf5
+0xf5, 0x51, 0xbf, 0x37, 0x68, 0x40, 0xb6, 0xcb, 0xce, 0x5e, 0x31, 0x6b,
+0x57, 0x33, 0xce, 0x2b, 0x16, 0x9e, 0x0f, 0x7c, 0x4a, 0xeb, 0xe7, 0x8e,
+0x9b, 0x7f, 0x1a, 0xfe, 0xe2, 0x42, 0xe3, 0x4f, 0x00, 0x00, 0x00, 0x00
 };
 
 // Base point A height
 static const u1 p256_au1PtA_Z[36] = {
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
 // OrderPointBase
 static const u1 p256_au1OrderPoint[36] = {
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00,
-0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbc, 0xe6, 0xfa, 0xad,
-0xa7, 0x17, 0x9e, 0x84, 0xf3, 0xb9, 0xca, 0xc2, 0xfc, 0x63, 0x25, 0x51
+0x51, 0x25, 0x63, 0xfc, 0xc2, 0xca, 0xb9, 0xf3, 0x84, 0x9e, 0x17, 0xa7,
+0xad, 0xfa, 0xe6, 0xbc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00
 };
 
 // Reduction constant
 static const u1 p256_au1Cns[40] = {
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE,
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03,
-0x00, 0x00, 0x00, 0x05
+0x05, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF,
+0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00
 };
 
 // "b" parameter in curve equation
 // x^3 = x^2 + a*x + b
 static const u1 p256_au1BCurve[36] = {
-0x00, 0x00, 0x00, 0x00, 0x5a, 0xc6, 0x35, 0xd8, 0xaa, 0x3a, 0x93, 0xe7,
-0xb3, 0xeb, 0xbd, 0x55, 0x76, 0x98, 0x86, 0xbc, 0x65, 0x1d, 0x06, 0xb0,
-0xcc, 0x53, 0xb0, 0xf6, 0x3b, 0xce, 0x3c, 0x3e, 0x27, 0xd2, 0x60, 0x4b
+0x4b, 0x60, 0xd2, 0x27, 0x3e, 0x3c, 0xce, 0x3b, 0xf6, 0xb0, 0x53, 0xcc,
+0xb0, 0x06, 0x1d, 0x65, 0xbc, 0x86, 0x98, 0x76, 0x55, 0xbd, 0xeb, 0xb3,
+0xe7, 0x93, 0x3a, 0xaa, 0xd8, 0x35, 0xc6, 0x5a, 0x00, 0x00, 0x00, 0x00
 };
 
 // *****************************************************************************
@@ -281,76 +295,76 @@ static const u1 p256_au1BCurve[36] = {
 */
 // P = 2^384 - 2^224 +2^192 + 2^96 - 1
 static const u1 p384_au1ModuloP[52] = {
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xFF, 0xFF, 0xFF, 0xFF
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00
 };
 
 // "a" parameter in curve equation = -3
 // x^3 = x^2 + a*x + b
 static const u1 p384_au1ACurve[52] = {
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFC, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE,
-0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0xFF, 0xFF, 0xFF, 0xFC
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x00, 0x00, 0x00, 0x00
 };
 
 // Base point A abscissa
 static const u1 p384_au1PtA_X[52] = {
-0x00, 0x00, 0x00, 0x00, 0xaa, 0x87, 0xca, 0x22, 0xbe, 0x8b, 0x05, 0x37,
-0x8e, 0xb1, 0xc7, 0x1e, 0xf3, 0x20, 0xad, 0x74, 0x6e, 0x1d, 0x3b, 0x62,
-0x8b, 0xa7, 0x9b, 0x98, 0x59, 0xf7, 0x41, 0xe0, 0x82, 0x54, 0x2a, 0x38,
-0x55, 0x02, 0xf2, 0x5d, 0xbf, 0x55, 0x29, 0x6c, 0x3a, 0x54, 0x5e, 0x38,
-0x72, 0x76, 0x0a, 0xb7
+0xb7, 0x0a, 0x76, 0x72, 0x38, 0x5e, 0x54, 0x3a, 0x6c, 0x29, 0x55, 0xbf,
+0x5d, 0xf2, 0x02, 0x55, 0x38, 0x2a, 0x54, 0x82, 0xe0, 0x41, 0xf7, 0x59,
+0x98, 0x9b, 0xa7, 0x8b, 0x62, 0x3b, 0x1d, 0x6e, 0x74, 0xad, 0x20, 0xf3,
+0x1e, 0xc7, 0xb1, 0x8e, 0x37, 0x05, 0x8b, 0xbe, 0x22, 0xca, 0x87, 0xaa,
+0x00, 0x00, 0x00, 0x00
 };
 
 // Base point A ordinate
 static const u1 p384_au1PtA_Y[52] = {
-0x00, 0x00, 0x00, 0x00, 0x36, 0x17, 0xde, 0x4a, 0x96, 0x26, 0x2c, 0x6f,
-0x5d, 0x9e, 0x98, 0xbf, 0x92, 0x92, 0xdc, 0x29, 0xf8, 0xf4, 0x1d, 0xbd,
-0x28, 0x9a, 0x14, 0x7c, 0xe9, 0xda, 0x31, 0x13, 0xb5, 0xf0, 0xb8, 0xc0,
-0x0a, 0x60, 0xb1, 0xce, 0x1d, 0x7e, 0x81, 0x9d, 0x7a, 0x43, 0x1d, 0x7c,
-0x90, 0xea, 0x0e, 0x5f
+0x5f, 0x0e, 0xea, 0x90, 0x7c, 0x1d, 0x43, 0x7a, 0x9d, 0x81, 0x7e, 0x1d,
+0xce, 0xb1, 0x60, 0x0a, 0xc0, 0xb8, 0xf0, 0xb5, 0x13, 0x31, 0xda, 0xe9,
+0x7c, 0x14, 0x9a, 0x28, 0xbd, 0x1d, 0xf4, 0xf8, 0x29, 0xdc, 0x92, 0x92,
+0xbf, 0x98, 0x9e, 0x5d, 0x6f, 0x2c, 0x26, 0x96, 0x4a, 0xde, 0x17, 0x36,
+0x00, 0x00, 0x00, 0x00
 };
 
 // Base point A height
 static const u1 p384_au1PtA_Z[52] = {
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x01
+0x00, 0x00, 0x00, 0x00
 };
 
 // OrderPointBase
 static const u1 p384_au1OrderPoint[52] = {
-0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0x73, 0x29, 0xc5, 0xcc, 0x6a, 0x19, 0xec, 0xec, 0x7a, 0xa7, 0xb0, 0x48,
+0xb2, 0x0d, 0x1a, 0x58, 0xdf, 0x2d, 0x37, 0xf4, 0x81, 0x4d, 0x63, 0xc7,
 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xff, 0xff, 0xff, 0xff, 0xc7, 0x63, 0x4d, 0x81, 0xf4, 0x37, 0x2d, 0xdf,
-0x58, 0x1a, 0x0d, 0xb2, 0x48, 0xb0, 0xa7, 0x7a, 0xec, 0xec, 0x19, 0x6a,
-0xcc, 0xc5, 0x29, 0x73
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0x00, 0x00, 0x00, 0x00
 };
 
 // Reduction constant
 static const u1 p384_au1Cns[56] = {
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00
 };
 
 // "b" parameter in curve equation
 // x^3 = x^2 + a*x + b
 static const u1 p384_au1BCurve[52] = {
-0x00, 0x00, 0x00, 0x00, 0xb3, 0x31, 0x2f, 0xa7, 0xe2, 0x3e, 0xe7, 0xe4,
-0x98, 0x8e, 0x05, 0x6b, 0xe3, 0xf8, 0x2d, 0x19, 0x18, 0x1d, 0x9c, 0x6e,
-0xfe, 0x81, 0x41, 0x12, 0x03, 0x14, 0x08, 0x8f, 0x50, 0x13, 0x87, 0x5a,
-0xc6, 0x56, 0x39, 0x8d, 0x8a, 0x2e, 0xd1, 0x9d, 0x2a, 0x85, 0xc8, 0xed,
-0xd3, 0xec, 0x2a, 0xef
+0xef, 0x2a, 0xec, 0xd3, 0xed, 0xc8, 0x85, 0x2a, 0x9d, 0xd1, 0x2e, 0x8a,
+0x8d, 0x39, 0x56, 0xc6, 0x5a, 0x87, 0x13, 0x50, 0x8f, 0x08, 0x14, 0x03,
+0x12, 0x41, 0x81, 0xfe, 0x6e, 0x9c, 0x1d, 0x18, 0x19, 0x2d, 0xf8, 0xe3,
+0x6b, 0x05, 0x8e, 0x98, 0xe4, 0xe7, 0x3e, 0xe2, 0xa7, 0x2f, 0x31, 0xb3,
+0x00, 0x00, 0x00, 0x00
 };
 
 // *****************************************************************************
@@ -361,89 +375,606 @@ static const u1 p384_au1BCurve[52] = {
 */
 // P = 2^521-1
 static const u1 p521_au1ModuloP[72] = {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
 // "a" parameter in curve equation = -3
 // x^3 = x^2 + a*x + b
 static const u1 p521_au1ACurve[72] = {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
 // Base point A abscissa
 static const u1 p521_au1PtA_X[72] = {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0x85, 0x8e, 0x06, 0xb7, 0x04,
-0x04, 0xe9, 0xcd, 0x9e, 0x3e, 0xcb, 0x66, 0x23, 0x95, 0xb4, 0x42, 0x9c, 0x64,
-0x81, 0x39, 0x05, 0x3f, 0xb5, 0x21, 0xf8, 0x28, 0xaf, 0x60, 0x6b, 0x4d, 0x3d,
-0xba, 0xa1, 0x4b, 0x5e, 0x77, 0xef, 0xe7, 0x59, 0x28, 0xfe, 0x1d, 0xc1, 0x27,
-0xa2, 0xff, 0xa8, 0xde, 0x33, 0x48, 0xb3, 0xc1, 0x85, 0x6a, 0x42, 0x9b, 0xf9,
-0x7e, 0x7e, 0x31, 0xc2, 0xe5, 0xbd, 0x66
+0x66, 0xbd, 0xe5, 0xc2, 0x31, 0x7e, 0x7e, 0xf9, 0x9b, 0x42, 0x6a, 0x85, 0xc1,
+0xb3, 0x48, 0x33, 0xde, 0xa8, 0xff, 0xa2, 0x27, 0xc1, 0x1d, 0xfe, 0x28, 0x59,
+0xe7, 0xef, 0x77, 0x5e, 0x4b, 0xa1, 0xba, 0x3d, 0x4d, 0x6b, 0x60, 0xaf, 0x28,
+0xf8, 0x21, 0xb5, 0x3f, 0x05, 0x39, 0x81, 0x64, 0x9c, 0x42, 0xb4, 0x95, 0x23,
+0x66, 0xcb, 0x3e, 0x9e, 0xcd, 0xe9, 0x04, 0x04, 0xb7, 0x06, 0x8e, 0x85, 0xc6,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
 // Base point A ordinate
 static const u1 p521_au1PtA_Y[72] = {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x39, 0x29, 0x6a, 0x78, 0x9a,
-0x3b, 0xc0, 0x04, 0x5c, 0x8a, 0x5f, 0xb4, 0x2c, 0x7d, 0x1b, 0xd9, 0x98, 0xf5,
-0x44, 0x49, 0x57, 0x9b, 0x44, 0x68, 0x17, 0xaf, 0xbd, 0x17, 0x27, 0x3e, 0x66,
-0x2c, 0x97, 0xee, 0x72, 0x99, 0x5e, 0xf4, 0x26, 0x40, 0xc5, 0x50, 0xb9, 0x01,
-0x3f, 0xad, 0x07, 0x61, 0x35, 0x3c, 0x70, 0x86, 0xa2, 0x72, 0xc2, 0x40, 0x88,
-0xbe, 0x94, 0x76, 0x9f, 0xd1, 0x66, 0x50
+0x50, 0x66, 0xd1, 0x9f, 0x76, 0x94, 0xbe, 0x88, 0x40, 0xc2, 0x72, 0xa2, 0x86,
+0x70, 0x3c, 0x35, 0x61, 0x07, 0xad, 0x3f, 0x01, 0xb9, 0x50, 0xc5, 0x40, 0x26,
+0xf4, 0x5e, 0x99, 0x72, 0xee, 0x97, 0x2c, 0x66, 0x3e, 0x27, 0x17, 0xbd, 0xaf,
+0x17, 0x68, 0x44, 0x9b, 0x57, 0x49, 0x44, 0xf5, 0x98, 0xd9, 0x1b, 0x7d, 0x2c,
+0xb4, 0x5f, 0x8a, 0x5c, 0x04, 0xc0, 0x3b, 0x9a, 0x78, 0x6a, 0x29, 0x39, 0x18,
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
 // Base point A height
 static const u1 p521_au1PtA_Z[72] = {
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
 // OrderPointBase
 static const u1 p521_au1OrderPoint[72] = {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0x09, 0x64, 0x38, 0x91, 0x1e, 0xb7, 0x6f, 0xbb, 0xae, 0x47, 0x9c, 0x89, 0xb8,
+0xc9, 0xb5, 0x3b, 0xd0, 0xa5, 0x09, 0xf7, 0x48, 0x01, 0xcc, 0x7f, 0x6b, 0x96,
+0x2f, 0xbf, 0x83, 0x87, 0x86, 0x51, 0xfa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-0xfa, 0x51, 0x86, 0x87, 0x83, 0xbf, 0x2f, 0x96, 0x6b, 0x7f, 0xcc, 0x01, 0x48,
-0xf7, 0x09, 0xa5, 0xd0, 0x3b, 0xb5, 0xc9, 0xb8, 0x89, 0x9c, 0x47, 0xae, 0xbb,
-0x6f, 0xb7, 0x1e, 0x91, 0x38, 0x64, 0x09
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
 
 // Reduction constant
 static const u1 p521_au1Cns[76] = {
-0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00
 };
 
 // "b" parameter in curve equation
 // x^3 = x^2 + a*x + b
 static const u1 p521_au1BCurve[72] = {
-0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x51, 0x95, 0x3e, 0xb9, 0x61, 0x8e,
-0x1c, 0x9a, 0x1f, 0x92, 0x9a, 0x21, 0xa0, 0xb6, 0x85, 0x40, 0xee, 0xa2, 0xda,
-0x72, 0x5b, 0x99, 0xb3, 0x15, 0xf3, 0xb8, 0xb4, 0x89, 0x91, 0x8e, 0xf1, 0x09,
-0xe1, 0x56, 0x19, 0x39, 0x51, 0xec, 0x7e, 0x93, 0x7b, 0x16, 0x52, 0xc0, 0xbd,
-0x3b, 0xb1, 0xbf, 0x07, 0x35, 0x73, 0xdf, 0x88, 0x3d, 0x2c, 0x34, 0xf1, 0xef,
-0x45, 0x1f, 0xd4, 0x6b, 0x50, 0x3f, 0x00
+0x00, 0x3f, 0x50, 0x6b, 0xd4, 0x1f, 0x45, 0xef, 0xf1, 0x34, 0x2c, 0x3d, 0x88,
+0xdf, 0x73, 0x35, 0x07, 0xbf, 0xb1, 0x3b, 0xbd, 0xc0, 0x52, 0x16, 0x7b, 0x93,
+0x7e, 0xec, 0x51, 0x39, 0x19, 0x56, 0xe1, 0x09, 0xf1, 0x8e, 0x91, 0x89, 0xb4,
+0xb8, 0xf3, 0x15, 0xb3, 0x99, 0x5b, 0x72, 0xda, 0xa2, 0xee, 0x40, 0x85, 0xb6,
+0xa0, 0x21, 0x9a, 0x92, 0x1f, 0x9a, 0x1c, 0x8e, 0x61, 0xb9, 0x3e, 0x95, 0x51,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// *****************************************************************************
+/* 256-bit Brainpool Elliptic Curve Parameters
+
+  Summary:
+    brainpoolP256r1 (RFC 5639) Elliptic Curve Domain Parameters.
+*/
+static const u1 bp256r1_au1ModuloP[36] = {
+0x77, 0x53, 0x6e, 0x1f, 0x1d, 0x48, 0x13, 0x20, 0x28, 0x20, 0x26, 0xd5,
+0x23, 0xf6, 0x3b, 0x6e, 0x72, 0x8d, 0x83, 0x9d, 0x90, 0x0a, 0x66, 0x3e,
+0xbc, 0xa9, 0xee, 0xa1, 0xdb, 0x57, 0xfb, 0xa9, 0x00, 0x00, 0x00, 0x00
+};
+
+// "a" parameter in curve equation
+// x^3 = x^2 + a*x + b
+static const u1 bp256r1_au1ACurve[36] = {
+0xd9, 0xb5, 0x30, 0xf3, 0x44, 0x4b, 0x4a, 0xe9, 0x6c, 0x5c, 0xdc, 0x26,
+0xc1, 0x55, 0x80, 0xfb, 0xe7, 0xff, 0x7a, 0x41, 0x30, 0x75, 0xf6, 0xee,
+0x57, 0x30, 0x2c, 0xfc, 0x75, 0x09, 0x5a, 0x7d, 0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A abscissa
+static const u1 bp256r1_au1PtA_X[36] = {
+0x62, 0x32, 0xce, 0x9a, 0xbd, 0x53, 0x44, 0x3a, 0xc2, 0x23, 0xbd, 0xe3,
+0xe1, 0x27, 0xde, 0xb9, 0xaf, 0xb7, 0x81, 0xfc, 0x2f, 0x48, 0x4b, 0x2c,
+0xcb, 0x57, 0x7e, 0xcb, 0xb9, 0xae, 0xd2, 0x8b, 0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A ordinate
+static const u1 bp256r1_au1PtA_Y[36] = {
+0x97, 0x69, 0x04, 0x2f, 0xc7, 0x54, 0x1d, 0x5c, 0x54, 0x8e, 0xed, 0x2d,
+0x13, 0x45, 0x77, 0xc2, 0xc9, 0x1d, 0x61, 0x14, 0x1a, 0x46, 0xf8, 0x97,
+0xfd, 0xc4, 0xda, 0xc3, 0x35, 0xf8, 0x7e, 0x54, 0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A height
+static const u1 bp256r1_au1PtA_Z[36] = {
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// OrderPointBase
+static const u1 bp256r1_au1OrderPoint[36] = {
+0xa7, 0x56, 0x48, 0x97, 0x82, 0x0e, 0x1e, 0x90, 0xf7, 0xa6, 0x61, 0xb5,
+0xa3, 0x7a, 0x39, 0x8c, 0x71, 0x8d, 0x83, 0x9d, 0x90, 0x0a, 0x66, 0x3e,
+0xbc, 0xa9, 0xee, 0xa1, 0xdb, 0x57, 0xfb, 0xa9, 0x00, 0x00, 0x00, 0x00
+};
+
+// Reduction constant
+static const u1 bp256r1_au1Cns[40] = {
+0x94, 0x7c, 0x11, 0x6b, 0x0c, 0xdd, 0x80, 0x11, 0x30, 0xe6, 0x2a, 0xb6,
+0xa9, 0x2f, 0x6a, 0xff, 0xa0, 0x54, 0x4f, 0x9b, 0xf2, 0x7b, 0x2a, 0x32,
+0xa8, 0xab, 0x73, 0xbb, 0x7e, 0x5b, 0xc5, 0xa1, 0x31, 0x11, 0x8c, 0x81,
+0x01, 0x00, 0x00, 0x00
+};
+
+// "b" parameter in curve equation
+// x^3 = x^2 + a*x + b
+static const u1 bp256r1_au1BCurve[36] = {
+0xb6, 0x07, 0x8c, 0xff, 0x18, 0xdc, 0xcc, 0x6b, 0xce, 0xe1, 0xf7, 0x5c,
+0x29, 0x16, 0x84, 0x95, 0xbf, 0x7c, 0xd7, 0xbb, 0xd9, 0xb5, 0x30, 0xf3,
+0x44, 0x4b, 0x4a, 0xe9, 0x6c, 0x5c, 0xdc, 0x26, 0x00, 0x00, 0x00, 0x00
+};
+
+// *****************************************************************************
+/* 384-bit Brainpool Elliptic Curve Parameters
+
+  Summary:
+    brainpoolP384r1 (RFC 5639) Elliptic Curve Domain Parameters.
+*/
+static const u1 bp384r1_au1ModuloP[52] = {
+0x53, 0xec, 0x07, 0x31, 0x13, 0x00, 0x47, 0x87, 0x71, 0x1a, 0x1d, 0x90,
+0x29, 0xa7, 0xd3, 0xac, 0x23, 0x11, 0xb7, 0x7f, 0x19, 0xda, 0xb1, 0x12,
+0xb4, 0x56, 0x54, 0xed, 0x09, 0x71, 0x2f, 0x15, 0xdf, 0x41, 0xe6, 0x50,
+0x7e, 0x6f, 0x5d, 0x0f, 0x28, 0x6d, 0x38, 0xa3, 0x82, 0x1e, 0xb9, 0x8c,
+0x00, 0x00, 0x00, 0x00
+};
+
+// "a" parameter in curve equation
+// x^3 = x^2 + a*x + b
+static const u1 bp384r1_au1ACurve[52] = {
+0x26, 0x28, 0xce, 0x22, 0xdd, 0xc7, 0xa8, 0x04, 0xeb, 0xd4, 0x3a, 0x50,
+0x4a, 0x81, 0xa5, 0x8a, 0x0f, 0xf9, 0x91, 0xba, 0xef, 0x65, 0x91, 0x13,
+0x87, 0x27, 0xb2, 0x4f, 0x8e, 0xa2, 0xbe, 0xc2, 0xa0, 0xaf, 0x05, 0xce,
+0x0a, 0x08, 0x72, 0x3c, 0x0c, 0x15, 0x8c, 0x3d, 0xc6, 0x82, 0xc3, 0x7b,
+0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A abscissa
+static const u1 bp384r1_au1PtA_X[52] = {
+0x1e, 0xaf, 0xd4, 0x47, 0xe2, 0xb2, 0x87, 0xef, 0xaa, 0x46, 0xd6, 0x36,
+0x34, 0xe0, 0x26, 0xe8, 0xe8, 0x10, 0xbd, 0x0c, 0xfe, 0xca, 0x7f, 0xdb,
+0xe3, 0x4f, 0xf1, 0x7e, 0xe7, 0xa3, 0x47, 0x88, 0x6b, 0x3f, 0xc1, 0xb7,
+0x81, 0x3a, 0xa6, 0xa2, 0xff, 0x45, 0xcf, 0x68, 0xf0, 0x64, 0x1c, 0x1d,
+0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A ordinate
+static const u1 bp384r1_au1PtA_Y[52] = {
+0x15, 0x53, 0x3c, 0x26, 0x41, 0x03, 0x82, 0x42, 0x11, 0x81, 0x91, 0x77,
+0x21, 0x46, 0x46, 0x0e, 0x28, 0x29, 0x91, 0xf9, 0x4f, 0x05, 0x9c, 0xe1,
+0x64, 0x58, 0xec, 0xfe, 0x29, 0x0b, 0xb7, 0x62, 0x52, 0xd5, 0xcf, 0x95,
+0x8e, 0xeb, 0xb1, 0x5c, 0xa4, 0xc2, 0xf9, 0x20, 0x75, 0x1d, 0xbe, 0x8a,
+0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A height
+static const u1 bp384r1_au1PtA_Z[52] = {
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00
+};
+
+// OrderPointBase
+static const u1 bp384r1_au1OrderPoint[52] = {
+0x65, 0x65, 0x04, 0xe9, 0x02, 0x32, 0x88, 0x3b, 0x10, 0xc3, 0x7f, 0x6b,
+0xaf, 0xb6, 0x3a, 0xcf, 0xa7, 0x25, 0x04, 0xac, 0x6c, 0x6e, 0x16, 0x1f,
+0xb3, 0x56, 0x54, 0xed, 0x09, 0x71, 0x2f, 0x15, 0xdf, 0x41, 0xe6, 0x50,
+0x7e, 0x6f, 0x5d, 0x0f, 0x28, 0x6d, 0x38, 0xa3, 0x82, 0x1e, 0xb9, 0x8c,
+0x00, 0x00, 0x00, 0x00
+};
+
+// Reduction constant
+static const u1 bp384r1_au1Cns[56] = {
+0x56, 0x7b, 0x98, 0x63, 0x16, 0x67, 0xa2, 0x84, 0xf6, 0x3b, 0xa0, 0x10,
+0x6f, 0x56, 0x71, 0x7a, 0xe0, 0xbc, 0x47, 0x90, 0x21, 0xd7, 0xc4, 0xf1,
+0xce, 0x90, 0xd5, 0x9e, 0xde, 0x6e, 0xe5, 0xca, 0x49, 0xc4, 0xa2, 0xdd,
+0x65, 0xfa, 0xc6, 0x3c, 0xfd, 0xad, 0x25, 0xff, 0xb8, 0xc6, 0x8e, 0x6d,
+0xb1, 0x75, 0xb5, 0xd1, 0x01, 0x00, 0x00, 0x00
+};
+
+// "b" parameter in curve equation
+// x^3 = x^2 + a*x + b
+static const u1 bp384r1_au1BCurve[52] = {
+0x11, 0x4c, 0x50, 0xfa, 0x96, 0x86, 0xb7, 0x3a, 0x94, 0xc9, 0xdb, 0x95,
+0x02, 0x39, 0xb4, 0x7c, 0xd5, 0x62, 0xeb, 0x3e, 0xa5, 0x0e, 0x88, 0x2e,
+0xa6, 0xd2, 0xdc, 0x07, 0xe1, 0x7d, 0xb7, 0x2f, 0x7c, 0x44, 0xf0, 0x16,
+0x54, 0xb5, 0x39, 0x8b, 0x26, 0x28, 0xce, 0x22, 0xdd, 0xc7, 0xa8, 0x04,
+0x00, 0x00, 0x00, 0x00
+};
+
+// *****************************************************************************
+/* 256-bit Koblitz Elliptic Curve Parameters
+
+  Summary:
+    secp256k1 (SEC 2) Elliptic Curve Domain Parameters.
+*/
+// P = 2^256 - 2^32 - 977
+static const u1 secp256k1_au1ModuloP[36] = {
+0x2f, 0xfc, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00
+};
+
+// "a" parameter in curve equation = 0
+// x^3 = x^2 + a*x + b
+static const u1 secp256k1_au1ACurve[36] = {
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A abscissa
+static const u1 secp256k1_au1PtA_X[36] = {
+0x98, 0x17, 0xf8, 0x16, 0x5b, 0x81, 0xf2, 0x59, 0xd9, 0x28, 0xce, 0x2d,
+0xdb, 0xfc, 0x9b, 0x02, 0x07, 0x0b, 0x87, 0xce, 0x95, 0x62, 0xa0, 0x55,
+0xac, 0xbb, 0xdc, 0xf9, 0x7e, 0x66, 0xbe, 0x79, 0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A ordinate
+static const u1 secp256k1_au1PtA_Y[36] = {
+0xb8, 0xd4, 0x10, 0xfb, 0x8f, 0xd0, 0x47, 0x9c, 0x19, 0x54, 0x85, 0xa6,
+0x48, 0xb4, 0x17, 0xfd, 0xa8, 0x08, 0x11, 0x0e, 0xfc, 0xfb, 0xa4, 0x5d,
+0x65, 0xc4, 0xa3, 0x26, 0x77, 0xda, 0x3a, 0x48, 0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A height
+static const u1 secp256k1_au1PtA_Z[36] = {
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// OrderPointBase
+static const u1 secp256k1_au1OrderPoint[36] = {
+0x41, 0x41, 0x36, 0xd0, 0x8c, 0x5e, 0xd2, 0xbf, 0x3b, 0xa0, 0x48, 0xaf,
+0xe6, 0xdc, 0xae, 0xba, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00
+};
+
+// Reduction constant
+static const u1 secp256k1_au1Cns[40] = {
+0x00, 0x00, 0x00, 0x00, 0xd1, 0x03, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x00, 0x00, 0x00
+};
+
+// "b" parameter in curve equation
+// x^3 = x^2 + a*x + b
+static const u1 secp256k1_au1BCurve[36] = {
+0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// *****************************************************************************
+/* 233-bit Koblitz Binary Elliptic Curve Parameters
+
+  Summary:
+    Recommended sect233k1 (K-233) Elliptic Curve Domain Parameters over GF(2^m).
+*/
+// f(x) = x^233 + x^74 + 1
+static const u1 sect233k1_au1ModuloP[36] = {
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// "a" parameter in curve equation = 0
+// y^2 + x*y = x^3 + a*x^2 + b
+static const u1 sect233k1_au1ACurve[36] = {
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A abscissa
+static const u1 sect233k1_au1PtA_X[36] = {
+0x26, 0x61, 0xad, 0xef, 0x6e, 0x9d, 0x4c, 0x0a, 0xf5, 0x6b, 0xc2, 0x19,
+0xa4, 0x63, 0x95, 0x14, 0xf4, 0x2f, 0xf2, 0x29, 0xf1, 0x1a, 0x73, 0x7e,
+0x3a, 0x85, 0xba, 0x32, 0x72, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A ordinate
+static const u1 sect233k1_au1PtA_Y[36] = {
+0xa3, 0xe6, 0xfa, 0x56, 0x10, 0xc1, 0xe0, 0x56, 0x9b, 0xeb, 0x8a, 0xf1,
+0x9b, 0xcd, 0xa8, 0x27, 0xc4, 0x67, 0x5a, 0x55, 0x0f, 0xf7, 0xb7, 0x19,
+0xe8, 0xec, 0x7d, 0x53, 0xdb, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A height
+static const u1 sect233k1_au1PtA_Z[36] = {
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// OrderPointBase, cofactor 4
+static const u1 sect233k1_au1OrderPoint[36] = {
+0xdf, 0xab, 0x73, 0xf1, 0xd5, 0x1a, 0xfb, 0x6e, 0xd4, 0xbc, 0x15, 0xb9,
+0x5b, 0x9d, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// Reduction constant, x^(16*32+32) / f(x) in GF(2)[x]
+static const u1 sect233k1_au1Cns[40] = {
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x80, 0x00
+};
+
+// "b" parameter in curve equation
+// y^2 + x*y = x^3 + a*x^2 + b
+static const u1 sect233k1_au1BCurve[36] = {
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// *****************************************************************************
+/* 233-bit Random Binary Elliptic Curve Parameters
+
+  Summary:
+    Recommended sect233r1 (B-233) Elliptic Curve Domain Parameters over GF(2^m).
+*/
+// f(x) = x^233 + x^74 + 1
+static const u1 sect233r1_au1ModuloP[36] = {
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// "a" parameter in curve equation = 1
+// y^2 + x*y = x^3 + a*x^2 + b
+static const u1 sect233r1_au1ACurve[36] = {
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A abscissa
+static const u1 sect233r1_au1PtA_X[36] = {
+0x8b, 0x55, 0xfd, 0x71, 0x73, 0xeb, 0xf8, 0xf8, 0x36, 0x8b, 0x1f, 0x39,
+0xbc, 0x65, 0xef, 0x5f, 0x75, 0xbb, 0xf1, 0x39, 0x21, 0xbb, 0x13, 0x83,
+0xac, 0xcb, 0xdf, 0xc9, 0xfa, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A ordinate
+static const u1 sect233r1_au1PtA_Y[36] = {
+0x52, 0x10, 0xf8, 0x01, 0x7e, 0x6f, 0x71, 0x36, 0xca, 0xa7, 0x67, 0xf8,
+0xef, 0x0b, 0x8a, 0xbf, 0xbe, 0x28, 0x85, 0xe5, 0x78, 0x06, 0x35, 0x03,
+0x19, 0xa4, 0x08, 0x6a, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A height
+static const u1 sect233r1_au1PtA_Z[36] = {
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// OrderPointBase, cofactor 2
+static const u1 sect233r1_au1OrderPoint[36] = {
+0xd7, 0xe0, 0xcf, 0x03, 0x26, 0x1d, 0x03, 0x22, 0x69, 0x8a, 0x2f, 0xe7,
+0x74, 0xe9, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// Reduction constant, x^(16*32+32) / f(x) in GF(2)[x]
+static const u1 sect233r1_au1Cns[40] = {
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x80, 0x00
+};
+
+// "b" parameter in curve equation
+// y^2 + x*y = x^3 + a*x^2 + b
+static const u1 sect233r1_au1BCurve[36] = {
+0xad, 0x90, 0x8f, 0x7d, 0x5f, 0x11, 0xfe, 0x81, 0x42, 0xce, 0xe9, 0x20,
+0x3b, 0x33, 0x3b, 0x21, 0x58, 0xbb, 0x23, 0x09, 0x8c, 0x7f, 0x2c, 0x33,
+0x6c, 0xde, 0x7e, 0x64, 0x66, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+// *****************************************************************************
+/* 283-bit Koblitz Binary Elliptic Curve Parameters
+
+  Summary:
+    Recommended sect283k1 (K-283) Elliptic Curve Domain Parameters over GF(2^m).
+*/
+// f(x) = x^283 + x^12 + x^7 + x^5 + 1
+static const u1 sect283k1_au1ModuloP[40] = {
+0xA1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+0x00, 0x00, 0x00, 0x00
+};
+
+// "a" parameter in curve equation = 0
+// y^2 + x*y = x^3 + a*x^2 + b
+static const u1 sect283k1_au1ACurve[40] = {
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A abscissa
+static const u1 sect283k1_au1PtA_X[40] = {
+0x36, 0x28, 0x49, 0x58, 0x24, 0xac, 0xc2, 0xb0, 0x13, 0x69, 0x87, 0x16,
+0x7a, 0x56, 0xc1, 0x23, 0x5f, 0x26, 0xcd, 0x53, 0xe5, 0x88, 0xf1, 0x62,
+0x81, 0x3b, 0x1a, 0x3f, 0x88, 0x44, 0xca, 0x78, 0x3f, 0x21, 0x03, 0x05,
+0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A ordinate
+static const u1 sect283k1_au1PtA_Y[40] = {
+0x59, 0x22, 0xdd, 0x77, 0x61, 0x11, 0x34, 0x4e, 0x36, 0x62, 0x59, 0xe4,
+0x98, 0x46, 0x18, 0xe8, 0xc0, 0x45, 0x7e, 0xe8, 0x6f, 0x42, 0xe5, 0x07,
+0x5d, 0xf9, 0x90, 0x8d, 0x31, 0x9e, 0x1c, 0x0f, 0x38, 0xda, 0xcc, 0x01,
+0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A height
+static const u1 sect283k1_au1PtA_Z[40] = {
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00
+};
+
+// OrderPointBase, cofactor 4
+static const u1 sect283k1_au1OrderPoint[40] = {
+0x61, 0x3c, 0x16, 0x1e, 0x06, 0x1e, 0x45, 0x94, 0x7f, 0xff, 0x5d, 0x26,
+0x77, 0x75, 0xd0, 0x2e, 0xae, 0xe9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01,
+0x00, 0x00, 0x00, 0x00
+};
+
+// Reduction constant, x^(16*36+32) / f(x) in GF(2)[x]
+static const u1 sect283k1_au1Cns[44] = {
+0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00
+};
+
+// "b" parameter in curve equation
+// y^2 + x*y = x^3 + a*x^2 + b
+static const u1 sect283k1_au1BCurve[40] = {
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00
+};
+
+// *****************************************************************************
+/* 283-bit Random Binary Elliptic Curve Parameters
+
+  Summary:
+    Recommended sect283r1 (B-283) Elliptic Curve Domain Parameters over GF(2^m).
+*/
+// f(x) = x^283 + x^12 + x^7 + x^5 + 1
+static const u1 sect283r1_au1ModuloP[40] = {
+0xA1, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+0x00, 0x00, 0x00, 0x00
+};
+
+// "a" parameter in curve equation = 1
+// y^2 + x*y = x^3 + a*x^2 + b
+static const u1 sect283r1_au1ACurve[40] = {
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A abscissa
+static const u1 sect283r1_au1PtA_X[40] = {
+0x53, 0x20, 0xb1, 0x86, 0xcd, 0xbe, 0xcd, 0xf8, 0x98, 0xe1, 0xe2, 0x80,
+0x9c, 0xac, 0x7e, 0x55, 0xb8, 0x25, 0xed, 0x2e, 0xec, 0xdf, 0xb0, 0x70,
+0x8c, 0x4f, 0x93, 0xe1, 0x90, 0xdd, 0xb7, 0x8d, 0x25, 0x39, 0xf9, 0x05,
+0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A ordinate
+static const u1 sect283r1_au1PtA_Y[40] = {
+0xf4, 0x12, 0x81, 0xbe, 0x45, 0xdf, 0xf0, 0x13, 0xc8, 0x79, 0x67, 0x82,
+0xb0, 0xdd, 0x0e, 0x35, 0x02, 0xf7, 0x6f, 0x51, 0xb4, 0x02, 0x0d, 0xb2,
+0xd4, 0xe6, 0x8f, 0xb9, 0x1c, 0x14, 0x24, 0xfe, 0x54, 0x68, 0x67, 0x03,
+0x00, 0x00, 0x00, 0x00
+};
+
+// Base point A height
+static const u1 sect283r1_au1PtA_Z[40] = {
+0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00
+};
+
+// OrderPointBase, cofactor 2
+static const u1 sect283r1_au1OrderPoint[40] = {
+0x07, 0xb3, 0xad, 0xef, 0x7c, 0x2a, 0x04, 0x5b, 0x16, 0x90, 0x8a, 0x93,
+0xfc, 0x60, 0x96, 0x39, 0x90, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x03,
+0x00, 0x00, 0x00, 0x00
+};
+
+// Reduction constant, x^(16*36+32) / f(x) in GF(2)[x]
+static const u1 sect283r1_au1Cns[44] = {
+0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00
+};
+
+// "b" parameter in curve equation
+// y^2 + x*y = x^3 + a*x^2 + b
+static const u1 sect283r1_au1BCurve[40] = {
+0xf5, 0xa2, 0x79, 0x3b, 0x31, 0x3e, 0x26, 0xf6, 0x5a, 0x48, 0x81, 0xa5,
+0xa2, 0x9f, 0x30, 0x45, 0x76, 0xfd, 0x97, 0xca, 0x3f, 0x30, 0xa0, 0x19,
+0x8a, 0xaf, 0xa4, 0xa5, 0x6d, 0x59, 0xb8, 0xc8, 0x0a, 0x68, 0x7b, 0x02,
+0x00, 0x00, 0x00, 0x00
 };
 
 // Self test state for initialization
 static int8_t selfTestState = 0;
 
+#if CRYPTO_CPKCL_SELFTEST_PERIOD != 0
+// Operations run since the last self test
+static uint32_t selfTestOpCount = 0;
+#endif
+
+// Curve constants resident in crypto RAM and the memory mapping they follow
+static CRYPTO_CPKCL_CURVE ramCurve = (CRYPTO_CPKCL_CURVE)0;
+static CRYPTO_CPKCL_RAM_LAYOUT ramLayout = CRYPTO_CPKCL_RAM_NONE;
+
+// Point decompression values, LSB mode with the padding of the operands
+static u1 decompX[CPKCL_ECC_MAX_OPERAND_SIZE + 4];
+static u1 decompY[CPKCL_ECC_MAX_OPERAND_SIZE + 4];
+static u1 decompRhs[CPKCL_ECC_MAX_OPERAND_SIZE + 4];
+static u1 sqrtQ[CPKCL_ECC_MAX_OPERAND_SIZE + 4];
+static u1 sqrtExp[CPKCL_ECC_MAX_OPERAND_SIZE + 4];
+static u1 sqrtC[CPKCL_ECC_MAX_OPERAND_SIZE + 4];
+static u1 sqrtT[CPKCL_ECC_MAX_OPERAND_SIZE + 4];
+static u1 sqrtB[CPKCL_ECC_MAX_OPERAND_SIZE + 4];
+static u1 modMulS[CPKCL_ECC_MAX_OPERAND_SIZE + 4];
+static u1 modMulD[CPKCL_ECC_MAX_OPERAND_SIZE + 4];
+static u1 modSquareExp[CPKCL_ECC_MAX_OPERAND_SIZE + 4];
+
+// Smallest quadratic non-residue of the last curve with p = 1 mod 4
+static CRYPTO_CPKCL_CURVE sqrtZCurve = (CRYPTO_CPKCL_CURVE)0;
+static u1 sqrtZ = 0U;
+
+// Curve loaded for CRYPTO_CPKCL_CURVE_CUSTOM, NULL when none is set
+static const CPKCL_ECC_CURVE_DESC *customCurve = NULL;
+
+// Height of the custom curve base point and public keys
+static const u1 custom_au1PtA_Z[CPKCL_ECC_MAX_OPERAND_SIZE + 4] = { 0x01 };
+
+// k*G runs on the comb tables of drv_crypto_ecc_comb_cpkcl.c
+static bool combEnabled = true;
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: File Scope Functions
@@ -452,14 +983,12 @@ static int8_t selfTestState = 0;
 
 static int8_t lDRV_CRYPTO_ECC_SelfTest(void)
 {
-    // if (selfTestState != 0U)
-    // {
-    //     return selfTestState;
-    // }
-    
     /* Clear contents of CPKCL */
     (void) memset(&CPKCLParam, 0, sizeof(CPKCL_PARAM));
     
+    /* The self test uses the crypto RAM */
+    DRV_CRYPTO_ECC_RamInvalidate();
+    
     pvCPKCLParam = &CPKCLParam;
     
     /* MISRA C-2012 deviation block start */
@@ -503,277 +1032,2911 @@ static int8_t lDRV_CRYPTO_ECC_SelfTest(void)
         selfTestState = 1;
     }
     
+#if CRYPTO_CPKCL_SELFTEST_PERIOD != 0
+    selfTestOpCount = 0;
+#endif
+    
     return selfTestState;
 }
 
-// *****************************************************************************
-// *****************************************************************************
-// Section: CPKCL Common Interface Implementation
-// *****************************************************************************
-// *****************************************************************************
-
-CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_InitCpkcl(void)
+/* Checks 0 < d < n, both in LSB mode on u2Size bytes */
+static bool lDRV_CRYPTO_ECC_ScalarInRange(pu1 pu1Scalar, pfu1 pfu1Order, 
+    u2 u2Size)
 {
-    /* Wait end of CPKCC RAM initialization */ 
-    while ((CPKCCSR & (unsigned int)BIT_CPKCCSR_CLRRAM_BUSY) != 0U)
+    u2 u2Cpt = u2Size;
+    u1 u1NonZero = 0U;
+    
+    while (u2Cpt > 0U)
     {
-        ;
+        u2Cpt--;
+        u1NonZero |= pu1Scalar[u2Cpt];
     }
-  
-    /* Perform self test */
-    if (lDRV_CRYPTO_ECC_SelfTest() < 0)
+    if (u1NonZero == 0U)
     {
-        return CRYPTO_CPKCL_RESULT_INIT_ERROR;
+        return false;
     }
     
-    return CRYPTO_CPKCL_RESULT_INIT_SUCCESS;
+    u2Cpt = u2Size;
+    while (u2Cpt > 0U)
+    {
+        u2Cpt--;
+        if (pu1Scalar[u2Cpt] != pfu1Order[u2Cpt])
+        {
+            return (pu1Scalar[u2Cpt] < pfu1Order[u2Cpt]);
+        }
+    }
+    
+    /* Equal to the order */
+    return false;
 }
 
-CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_InitCurveParams(CPKCL_ECC_DATA *pEcc, 
-    CRYPTO_CPKCL_CURVE curveType)
+/* The helpers below work on values in LSB mode on u2Size bytes */
+
+/* Returns -1, 0 or 1 when x is below, equal to or above y */
+static int8_t lDRV_CRYPTO_ECC_Compare(pfu1 pfu1X, pfu1 pfu1Y, u2 u2Size)
 {
-    CRYPTO_CPKCL_RESULT result = CRYPTO_CPKCL_RESULT_CURVE_SUCCESS;
+    u2 u2Cpt = u2Size;
     
-     switch (curveType)
+    while (u2Cpt > 0U)
     {
-         case CRYPTO_CPKCL_CURVE_P192:
-            pEcc->u2ModuloPSize = sizeof(p192_au1ModuloP) - 4U;
-            pEcc->u2OrderSize = sizeof(p192_au1OrderPoint) - 4U;
-            /* MISRA C-2012 deviation block start */
-            /* MISRA C-2012 Rule 11.8 deviated: 8. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunknown-pragmas"
-#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
-            pEcc->pfu1ModuloP = (pfu1) p192_au1ModuloP;
-            pEcc->pfu1ACurve = (pfu1) p192_au1ACurve;
-            pEcc->pfu1APointX = (pfu1) p192_au1PtA_X;
-            pEcc->pfu1APointY = (pfu1) p192_au1PtA_Y;
-            pEcc->pfu1APointZ = (pfu1) p192_au1PtA_Z;
-            pEcc->pfu1APointOrder = (pfu1) p192_au1OrderPoint;
-            pEcc->pfu1Cns = (pfu1) p192_au1Cns;
-            pEcc->pfu1BCurve = (pfu1) p192_au1BCurve;
-#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
-#pragma GCC diagnostic pop
-            /* MISRA C-2012 deviation block end */
-            break;
-        
-         case CRYPTO_CPKCL_CURVE_P224:
-            pEcc->u2ModuloPSize = sizeof(p224_au1ModuloP) - 4U;
-            pEcc->u2OrderSize = sizeof(p224_au1OrderPoint) - 4U;
-            /* MISRA C-2012 deviation block start */
-            /* MISRA C-2012 Rule 11.8 deviated: 8. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunknown-pragmas"
-#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
-            pEcc->pfu1ModuloP = (pfu1) p224_au1ModuloP;
-            pEcc->pfu1ACurve = (pfu1) p224_au1ACurve;
-            pEcc->pfu1APointX = (pfu1) p224_au1PtA_X;
-            pEcc->pfu1APointY = (pfu1) p224_au1PtA_Y;
-            pEcc->pfu1APointZ = (pfu1) p224_au1PtA_Z;
-            pEcc->pfu1APointOrder = (pfu1) p224_au1OrderPoint;
-            pEcc->pfu1Cns = (pfu1) p224_au1Cns;
-            pEcc->pfu1BCurve = (pfu1) p224_au1BCurve;
-#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
-#pragma GCC diagnostic pop
-            /* MISRA C-2012 deviation block end */
-            break;   
-            
-        case CRYPTO_CPKCL_CURVE_P256:
-            pEcc->u2ModuloPSize = sizeof(p256_au1ModuloP) - 4U;
-            pEcc->u2OrderSize = sizeof(p256_au1OrderPoint) - 4U;
-            /* MISRA C-2012 deviation block start */
-            /* MISRA C-2012 Rule 11.8 deviated: 8. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunknown-pragmas"
-#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
-            pEcc->pfu1ModuloP = (pfu1) p256_au1ModuloP;
-            pEcc->pfu1ACurve = (pfu1) p256_au1ACurve;
-            pEcc->pfu1APointX = (pfu1) p256_au1PtA_X;
-            pEcc->pfu1APointY = (pfu1) p256_au1PtA_Y;
-            pEcc->pfu1APointZ = (pfu1) p256_au1PtA_Z;
-            pEcc->pfu1APointOrder = (pfu1) p256_au1OrderPoint;
-            pEcc->pfu1Cns = (pfu1) p256_au1Cns;
-            pEcc->pfu1BCurve = (pfu1) p256_au1BCurve;
-#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
-#pragma GCC diagnostic pop
-            /* MISRA C-2012 deviation block end */
-            break;
-        
-        case CRYPTO_CPKCL_CURVE_P384:
-            pEcc->u2ModuloPSize = sizeof(p384_au1ModuloP) - 4U;
-            pEcc->u2OrderSize = sizeof(p384_au1OrderPoint) - 4U;
-            /* MISRA C-2012 deviation block start */
-            /* MISRA C-2012 Rule 11.8 deviated: 8. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunknown-pragmas"
-#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
-            pEcc->pfu1ModuloP = (pfu1) p384_au1ModuloP;
-            pEcc->pfu1ACurve = (pfu1) p384_au1ACurve;
-            pEcc->pfu1APointX = (pfu1) p384_au1PtA_X;
-            pEcc->pfu1APointY = (pfu1) p384_au1PtA_Y;
-            pEcc->pfu1APointZ = (pfu1) p384_au1PtA_Z;
-            pEcc->pfu1APointOrder = (pfu1) p384_au1OrderPoint;
-            pEcc->pfu1Cns = (pfu1) p384_au1Cns;
-            pEcc->pfu1BCurve = (pfu1) p384_au1BCurve;
-#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
-#pragma GCC diagnostic pop
-            /* MISRA C-2012 deviation block end */
-            break;
-        
-        case CRYPTO_CPKCL_CURVE_P521:
-            pEcc->u2ModuloPSize = sizeof(p521_au1ModuloP) - 4U;
-            pEcc->u2OrderSize = sizeof(p521_au1OrderPoint) - 4U;
-            /* MISRA C-2012 deviation block start */
-            /* MISRA C-2012 Rule 11.8 deviated: 8. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunknown-pragmas"
-#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
-            pEcc->pfu1ModuloP = (pfu1) p521_au1ModuloP;
-            pEcc->pfu1ACurve = (pfu1) p521_au1ACurve;
-            pEcc->pfu1APointX = (pfu1) p521_au1PtA_X;
-            pEcc->pfu1APointY = (pfu1) p521_au1PtA_Y;
-            pEcc->pfu1APointZ = (pfu1) p521_au1PtA_Z;
-            pEcc->pfu1APointOrder = (pfu1) p521_au1OrderPoint;
-            pEcc->pfu1Cns = (pfu1) p521_au1Cns;
-            pEcc->pfu1BCurve = (pfu1) p521_au1BCurve;
-#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
-#pragma GCC diagnostic pop
-            /* MISRA C-2012 deviation block end */
-            break;
-        
-        default:  
-            result = CRYPTO_CPKCL_RESULT_CURVE_ERROR;
-            break;
+        u2Cpt--;
+        if (pfu1X[u2Cpt] != pfu1Y[u2Cpt])
+        {
+            return (pfu1X[u2Cpt] < pfu1Y[u2Cpt]) ? -1 : 1;
+        }
     }
     
-    return result;
+    return 0;
 }
 
-CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_SetPubKeyCoordinates(CPKCL_ECC_DATA *pEcc,
-    pfu1 pubKey, pfu1 pubKeyX, pfu1 pubKeyY, CRYPTO_CPKCL_CURVE curveType)
+/* r = x + y, returns the carry. r may be x or y. */
+static u1 lDRV_CRYPTO_ECC_Add(pu1 pu1R, pfu1 pfu1X, pfu1 pfu1Y, u2 u2Size)
 {
-    CRYPTO_CPKCL_RESULT result = CRYPTO_CPKCL_RESULT_CURVE_SUCCESS;
-    uint8_t i;
-    uint8_t keySize;
-    uint8_t coordSize;
+    u2 u2Cpt;
+    u2 u2Acc = 0U;
     
-    /* Compressed keys not supported */
-    if (pubKey[0] != 0x04U) 
+    for (u2Cpt = 0U; u2Cpt < u2Size; u2Cpt++)
     {
-        return CRYPTO_CPKCL_RESULT_COORD_COMPRESS_ERROR;
+        u2Acc += (u2) pfu1X[u2Cpt] + (u2) pfu1Y[u2Cpt];
+        pu1R[u2Cpt] = (u1) u2Acc;
+        u2Acc >>= 8U;
     }
+    
+    return (u1) u2Acc;
+}
 
-    switch (curveType)
+/* r = x - y, returns the borrow. r may be x or y. */
+static u1 lDRV_CRYPTO_ECC_Sub(pu1 pu1R, pfu1 pfu1X, pfu1 pfu1Y, u2 u2Size)
+{
+    u2 u2Cpt;
+    u2 u2Borrow = 0U;
+    u2 u2Diff;
+    
+    for (u2Cpt = 0U; u2Cpt < u2Size; u2Cpt++)
     {
-        case CRYPTO_CPKCL_CURVE_P192:
-            keySize = (uint8_t)P192_PUBLIC_KEY_SIZE;
-            coordSize = (uint8_t)P192_PUBLIC_KEY_COORDINATE_SIZE;
-            /* MISRA C-2012 deviation block start */
-            /* MISRA C-2012 Rule 11.8 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunknown-pragmas"
-#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
-            pEcc->pfu1PublicKeyZ = (pfu1) p192_au1PtA_Z;
-#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
-#pragma GCC diagnostic pop
-            /* MISRA C-2012 deviation block end */
-            break;
-         
-        case CRYPTO_CPKCL_CURVE_P224:
-            keySize = (uint8_t)P224_PUBLIC_KEY_SIZE;
-            coordSize = (uint8_t)P224_PUBLIC_KEY_COORDINATE_SIZE;
-            /* MISRA C-2012 deviation block start */
-            /* MISRA C-2012 Rule 11.8 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunknown-pragmas"
-#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
-            pEcc->pfu1PublicKeyZ = (pfu1) p224_au1PtA_Z;
-#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
-#pragma GCC diagnostic pop
-            /* MISRA C-2012 deviation block end */
-            break;
-            
-        case CRYPTO_CPKCL_CURVE_P256:
-            keySize = (uint8_t)P256_PUBLIC_KEY_SIZE;
-            coordSize = (uint8_t)P256_PUBLIC_KEY_COORDINATE_SIZE;
-            /* MISRA C-2012 deviation block start */
-            /* MISRA C-2012 Rule 11.8 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunknown-pragmas"
-#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
-            pEcc->pfu1PublicKeyZ = (pfu1) p256_au1PtA_Z;
-#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
-#pragma GCC diagnostic pop
-            /* MISRA C-2012 deviation block end */
-            break;    
-        
-        case CRYPTO_CPKCL_CURVE_P384:
-            keySize = (uint8_t)P384_PUBLIC_KEY_SIZE;
-            coordSize = (uint8_t)P384_PUBLIC_KEY_COORDINATE_SIZE;
-            /* MISRA C-2012 deviation block start */
-            /* MISRA C-2012 Rule 11.8 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunknown-pragmas"
-#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
-            pEcc->pfu1PublicKeyZ = (pfu1) p384_au1PtA_Z;
-#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
-#pragma GCC diagnostic pop
-            /* MISRA C-2012 deviation block end */
-            break;
-            
-        case CRYPTO_CPKCL_CURVE_P521:
-            keySize = (uint8_t)P521_PUBLIC_KEY_SIZE;
-            coordSize = (uint8_t)P521_PUBLIC_KEY_COORDINATE_SIZE;
-            /* MISRA C-2012 deviation block start */
-            /* MISRA C-2012 Rule 11.8 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunknown-pragmas"
-#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
-            pEcc->pfu1PublicKeyZ = (pfu1) p521_au1PtA_Z;
-#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
-#pragma GCC diagnostic pop
-            /* MISRA C-2012 deviation block end */
-            break;
-        
-        default:  
-            result = CRYPTO_CPKCL_RESULT_CURVE_ERROR;
-            break;
+        u2Diff = (u2) pfu1X[u2Cpt] - (u2) pfu1Y[u2Cpt] - u2Borrow;
+        pu1R[u2Cpt] = (u1) u2Diff;
+        u2Borrow = (u2Diff >> 8U) & 1U;
     }
-   
-    if (result != CRYPTO_CPKCL_RESULT_CURVE_SUCCESS)
-    { 
-        return result;
+    
+    return (u1) u2Borrow;
+}
+
+/* r = x + y mod p, x and y below p */
+static void lDRV_CRYPTO_ECC_ModAdd(pu1 pu1R, pfu1 pfu1X, pfu1 pfu1Y, 
+    pfu1 pfu1P, u2 u2Size)
+{
+    u1 u1Carry = lDRV_CRYPTO_ECC_Add(pu1R, pfu1X, pfu1Y, u2Size);
+    
+    if ((u1Carry != 0U) || (lDRV_CRYPTO_ECC_Compare(pu1R, pfu1P, u2Size) >= 0))
+    {
+        (void) lDRV_CRYPTO_ECC_Sub(pu1R, pu1R, pfu1P, u2Size);
+    }
+}
+
+/* r = x - y mod p, x and y below p */
+static void lDRV_CRYPTO_ECC_ModSub(pu1 pu1R, pfu1 pfu1X, pfu1 pfu1Y, 
+    pfu1 pfu1P, u2 u2Size)
+{
+    if (lDRV_CRYPTO_ECC_Sub(pu1R, pfu1X, pfu1Y, u2Size) != 0U)
+    {
+        (void) lDRV_CRYPTO_ECC_Add(pu1R, pu1R, pfu1P, u2Size);
     }
+}
+
+/* r = r / 2, the top bit of the result is given */
+static void lDRV_CRYPTO_ECC_ShiftRight(pu1 pu1R, u2 u2Size, u1 u1TopBit)
+{
+    u2 u2Cpt;
     
-    /* Split coordinates */
-    for (i = 0; i < keySize; i++)
+    for (u2Cpt = 0U; u2Cpt < u2Size; u2Cpt++)
     {
-        if (i < coordSize)
+        pu1R[u2Cpt] = (u1) (pu1R[u2Cpt] >> 1U);
+        if ((u2Cpt + 1U) < u2Size)
         {
-            pubKeyX[i] = pubKey[i + 1U];
+            pu1R[u2Cpt] |= (u1) (pu1R[u2Cpt + 1U] << 7U);
         }
         else
         {
-            pubKeyY[i - coordSize] = pubKey[i + 1U];
+            pu1R[u2Cpt] |= (u1) (u1TopBit << 7U);
         }
     }
-    
-    return CRYPTO_CPKCL_RESULT_CURVE_SUCCESS;
 }
+
+/* r = r / 2 mod p, p odd */
+static void lDRV_CRYPTO_ECC_ModHalf(pu1 pu1R, pfu1 pfu1P, u2 u2Size)
+{
+    u1 u1Carry = 0U;
     
-void DRV_CRYPTO_ECC_SecureCopy(pu1 pu1Dest, pu1 pu1Src, u2 u2Length)
-{   
+    if ((pu1R[0] & 1U) != 0U)
+    {
+        u1Carry = lDRV_CRYPTO_ECC_Add(pu1R, pu1R, pfu1P, u2Size);
+    }
+    
+    lDRV_CRYPTO_ECC_ShiftRight(pu1R, u2Size, u1Carry);
+}
+
+/* Loads the modulus and reduction constant of the curve for 
+   lDRV_CRYPTO_ECC_ModExp. The crypto RAM no longer holds the constants of
+   any other memory mapping afterwards. */
+static void lDRV_CRYPTO_ECC_ModExpSetup(CPKCL_ECC_DATA *pEcc)
+{
+    u2 u2ModuloPSize = pEcc->u2ModuloPSize;
+    
+    DRV_CRYPTO_ECC_RamInvalidate();
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:6 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:2 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:2 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    (void) memcpy((pu1) ((BASE_EXPMOD_MODULO(u2ModuloPSize))), 
+        pEcc->pfu1ModuloP, u2ModuloPSize + 4U);
+    (void) memcpy((pu1) ((BASE_EXPMOD_CNS(u2ModuloPSize))), 
+        pEcc->pfu1Cns, u2ModuloPSize + 8U);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+}
+
+/* r = x^e mod p on the CPKCC, x below p, e on u2ModuloPSize bytes. r may 
+   be x. */
+static bool lDRV_CRYPTO_ECC_ModExp(CPKCL_ECC_DATA *pEcc, pu1 pu1R, pu1 pu1X,
+    pu1 pu1Exp)
+{
+    u2 u2ModuloPSize = pEcc->u2ModuloPSize;
+    u2 u2ExpLength = u2ModuloPSize;
+    pu1 pu1XArea;
+    
+    /* Process the exponent up to its last non-zero word only, most of the 
+       exponents used here are small powers of 2 */
+    while ((u2ExpLength > 4U) && (pu1Exp[u2ExpLength - 1U] == 0U) && 
+           (pu1Exp[u2ExpLength - 2U] == 0U) && (pu1Exp[u2ExpLength - 3U] == 0U) && 
+           (pu1Exp[u2ExpLength - 4U] == 0U))
+    {
+        u2ExpLength -= 4U;
+    }
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:7 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:30 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:7 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:7 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    pu1XArea = (pu1) BASE_EXPMOD_X(u2ModuloPSize);
+    
+    /* The least significant word of the X area stays 0, X follows it */
+    (void) memset(pu1XArea, 0, (3U * (size_t)u2ModuloPSize) + 24U);
+    (void) memcpy(&pu1XArea[4], pu1X, u2ModuloPSize);
+    (void) memcpy((pu1) ((BASE_EXPMOD_EXPONENT(u2ModuloPSize))), pu1Exp, 
+        u2ModuloPSize + 4U);
+    
+    CPKCL_ExpMod(nu1ModBase) = (nu1) BASE_EXPMOD_MODULO(u2ModuloPSize);
+    CPKCL_ExpMod(nu1CnsBase) = (nu1) BASE_EXPMOD_CNS(u2ModuloPSize);
+    CPKCL_ExpMod(nu1XBase) = (nu1) BASE_EXPMOD_X(u2ModuloPSize);
+    CPKCL_ExpMod(nu1PrecompBase) = (nu1) BASE_EXPMOD_PRECOMP(u2ModuloPSize);
+    CPKCL_ExpMod(pfu1ExpBase) = (pfu1) BASE_EXPMOD_EXPONENT(u2ModuloPSize);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL_ExpMod(u2ModLength) = u2ModuloPSize;
+    CPKCL_ExpMod(u2ExpLength) = u2ExpLength;
+    CPKCL_ExpMod(u1Blinding) = 0U;
+    
+    /* The exponents used here are public, no blinding needed */
+    CPKCL(u2Option) = (u2) (CPKCL_EXPMOD_REGULARRSA | 
+        CPKCL_EXPMOD_EXPINPKCCRAM | CPKCL_EXPMOD_WINDOWSIZE_1);
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    vCPKCL_Process(ExpMod, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        return false;
+    }
+    
+    /* The result replaces X */
+    (void) memcpy(pu1R, &pu1XArea[4], u2ModuloPSize);
+    
+    return true;
+}
+
+/* r = x^2 mod p */
+static bool lDRV_CRYPTO_ECC_ModSquare(CPKCL_ECC_DATA *pEcc, pu1 pu1R, 
+    pu1 pu1X)
+{
+    (void) memset(modSquareExp, 0, sizeof(modSquareExp));
+    modSquareExp[0] = 2U;
+    
+    return lDRV_CRYPTO_ECC_ModExp(pEcc, pu1R, pu1X, modSquareExp);
+}
+
+/* r = x*y mod p as ((x + y)/2)^2 - ((x - y)/2)^2, the CPKCC modular 
+   exponentiation being the only modular product used. r may be x or y. */
+static bool lDRV_CRYPTO_ECC_ModMul(CPKCL_ECC_DATA *pEcc, pu1 pu1R, pu1 pu1X,
+    pu1 pu1Y)
+{
+    pfu1 pfu1P = pEcc->pfu1ModuloP;
+    u2 u2Size = pEcc->u2ModuloPSize;
+    
+    lDRV_CRYPTO_ECC_ModAdd(modMulS, pu1X, pu1Y, pfu1P, u2Size);
+    lDRV_CRYPTO_ECC_ModHalf(modMulS, pfu1P, u2Size);
+    lDRV_CRYPTO_ECC_ModSub(modMulD, pu1X, pu1Y, pfu1P, u2Size);
+    lDRV_CRYPTO_ECC_ModHalf(modMulD, pfu1P, u2Size);
+    
+    if (!lDRV_CRYPTO_ECC_ModSquare(pEcc, modMulS, modMulS) || 
+        !lDRV_CRYPTO_ECC_ModSquare(pEcc, modMulD, modMulD))
+    {
+        return false;
+    }
+    
+    lDRV_CRYPTO_ECC_ModSub(pu1R, modMulS, modMulD, pfu1P, u2Size);
+    
+    return true;
+}
+
+/* r = x^(2^k) mod p */
+static bool lDRV_CRYPTO_ECC_ModPow2k(CPKCL_ECC_DATA *pEcc, pu1 pu1R, 
+    pu1 pu1X, u2 u2K)
+{
+    (void) memset(modSquareExp, 0, sizeof(modSquareExp));
+    modSquareExp[u2K / 8U] = (u1) (1U << (u2K % 8U));
+    
+    return lDRV_CRYPTO_ECC_ModExp(pEcc, pu1R, pu1X, modSquareExp);
+}
+
+static bool lDRV_CRYPTO_ECC_IsOne(pu1 pu1X, u2 u2Size)
+{
+    u2 u2Cpt;
+    u1 u1Acc = (u1) (pu1X[0] ^ 1U);
+    
+    for (u2Cpt = 1U; u2Cpt < u2Size; u2Cpt++)
+    {
+        u1Acc |= pu1X[u2Cpt];
+    }
+    
+    return (u1Acc == 0U);
+}
+
+/* y = sqrt(n) mod p. Returns false when n is not a square. For p = 3 mod 4 
+   y = n^((p + 1)/4), otherwise Tonelli-Shanks with p - 1 = q*2^s. */
+static bool lDRV_CRYPTO_ECC_ModSqrt(CPKCL_ECC_DATA *pEcc, pu1 pu1Y, pu1 pu1N)
+{
+    pfu1 pfu1P = pEcc->pfu1ModuloP;
+    u2 u2Size = pEcc->u2ModuloPSize;
+    u2 u2S = 0U;
+    u2 u2M;
+    u2 u2I;
+    u2 u2Lo;
+    u2 u2Mid;
+    
+    (void) memset(sqrtQ, 0, sizeof(sqrtQ));
+    (void) memset(sqrtExp, 0, sizeof(sqrtExp));
+    
+    if ((pfu1P[0] & 3U) == 3U)
+    {
+        /* (p + 1)/4, p + 1 does not carry out of the operand */
+        sqrtExp[0] = 1U;
+        (void) lDRV_CRYPTO_ECC_Add(sqrtExp, pfu1P, sqrtExp, u2Size);
+        lDRV_CRYPTO_ECC_ShiftRight(sqrtExp, u2Size, 0U);
+        lDRV_CRYPTO_ECC_ShiftRight(sqrtExp, u2Size, 0U);
+        
+        if (!lDRV_CRYPTO_ECC_ModExp(pEcc, pu1Y, pu1N, sqrtExp) ||
+            !lDRV_CRYPTO_ECC_ModSquare(pEcc, sqrtT, pu1Y))
+        {
+            return false;
+        }
+        
+        return (lDRV_CRYPTO_ECC_Compare(sqrtT, pu1N, u2Size) == 0);
+    }
+    
+    /* q = (p - 1)/2^s */
+    (void) memcpy(sqrtQ, pfu1P, u2Size);
+    sqrtQ[0] &= 0xFEU;
+    while ((sqrtQ[0] & 1U) == 0U)
+    {
+        lDRV_CRYPTO_ECC_ShiftRight(sqrtQ, u2Size, 0U);
+        u2S++;
+    }
+    
+    /* Non-residue z: z^((p - 1)/2) = p - 1. Searched once per curve. */
+    if (sqrtZCurve != pEcc->curveType)
+    {
+        (void) memcpy(sqrtExp, pfu1P, u2Size);
+        sqrtExp[0] &= 0xFEU;
+        lDRV_CRYPTO_ECC_ShiftRight(sqrtExp, u2Size, 0U);
+        (void) memset(sqrtB, 0, sizeof(sqrtB));
+        (void) memcpy(sqrtB, pfu1P, u2Size);
+        sqrtB[0] &= 0xFEU;
+        
+        sqrtZ = 1U;
+        do
+        {
+            sqrtZ++;
+            (void) memset(sqrtC, 0, sizeof(sqrtC));
+            sqrtC[0] = sqrtZ;
+            if (!lDRV_CRYPTO_ECC_ModExp(pEcc, sqrtC, sqrtC, sqrtExp))
+            {
+                return false;
+            }
+        } while ((lDRV_CRYPTO_ECC_Compare(sqrtC, sqrtB, u2Size) != 0) && 
+                 (sqrtZ < 0xFFU));
+        
+        if (lDRV_CRYPTO_ECC_Compare(sqrtC, sqrtB, u2Size) != 0)
+        {
+            return false;
+        }
+        sqrtZCurve = pEcc->curveType;
+    }
+    
+    /* c = z^q, t = n^q, y = n^((q + 1)/2) */
+    (void) memset(sqrtC, 0, sizeof(sqrtC));
+    sqrtC[0] = sqrtZ;
+    (void) memset(sqrtExp, 0, sizeof(sqrtExp));
+    sqrtExp[0] = 1U;
+    (void) lDRV_CRYPTO_ECC_Add(sqrtExp, sqrtQ, sqrtExp, u2Size);
+    lDRV_CRYPTO_ECC_ShiftRight(sqrtExp, u2Size, 0U);
+    if (!lDRV_CRYPTO_ECC_ModExp(pEcc, sqrtC, sqrtC, sqrtQ) ||
+        !lDRV_CRYPTO_ECC_ModExp(pEcc, sqrtT, pu1N, sqrtQ) ||
+        !lDRV_CRYPTO_ECC_ModExp(pEcc, pu1Y, pu1N, sqrtExp))
+    {
+        return false;
+    }
+    
+    /* n = 0 has the root 0 */
+    (void) memset(sqrtB, 0, sizeof(sqrtB));
+    if (lDRV_CRYPTO_ECC_Compare(pu1N, sqrtB, u2Size) == 0)
+    {
+        return true;
+    }
+    
+    /* t^(2^(s - 1)) = 1 if and only if n is a square */
+    if (!lDRV_CRYPTO_ECC_ModPow2k(pEcc, sqrtB, sqrtT, u2S - 1U))
+    {
+        return false;
+    }
+    if (!lDRV_CRYPTO_ECC_IsOne(sqrtB, u2Size))
+    {
+        return false;
+    }
+    
+    u2M = u2S;
+    while (!lDRV_CRYPTO_ECC_IsOne(sqrtT, u2Size))
+    {
+        /* Least i with t^(2^i) = 1, known to be in [1, m - 1] */
+        u2Lo = 1U;
+        u2I = u2M - 1U;
+        while (u2Lo < u2I)
+        {
+            u2Mid = (u2) ((u2Lo + u2I) / 2U);
+            if (!lDRV_CRYPTO_ECC_ModPow2k(pEcc, sqrtB, sqrtT, u2Mid))
+            {
+                return false;
+            }
+            if (lDRV_CRYPTO_ECC_IsOne(sqrtB, u2Size))
+            {
+                u2I = u2Mid;
+            }
+            else
+            {
+                u2Lo = u2Mid + 1U;
+            }
+        }
+        
+        /* b = c^(2^(m - i - 1)), y = y*b, c = b^2, t = t*c, m = i */
+        if (!lDRV_CRYPTO_ECC_ModPow2k(pEcc, sqrtB, sqrtC, u2M - u2I - 1U) ||
+            !lDRV_CRYPTO_ECC_ModMul(pEcc, pu1Y, pu1Y, sqrtB) ||
+            !lDRV_CRYPTO_ECC_ModSquare(pEcc, sqrtC, sqrtB) ||
+            !lDRV_CRYPTO_ECC_ModMul(pEcc, sqrtT, sqrtT, sqrtC))
+        {
+            return false;
+        }
+        u2M = u2I;
+    }
+    
+    return true;
+}
+
+/* Computes Y from the compressed key 0x02/0x03 || X: y^2 = x^3 + a*x + b,
+   with the parity of Y given by the first byte. Coordinates are written in
+   MSB mode on coordSize bytes. */
+static CRYPTO_CPKCL_RESULT lDRV_CRYPTO_ECC_Decompress(CPKCL_ECC_DATA *pEcc,
+    pfu1 pubKey, pfu1 pubKeyX, pfu1 pubKeyY, u2 u2CoordSize)
+{
+    pfu1 pfu1P = pEcc->pfu1ModuloP;
+    u2 u2Size = pEcc->u2ModuloPSize;
+    u2 u2Cpt;
+    bool ok;
+    
+    (void) memset(decompX, 0, sizeof(decompX));
+    for (u2Cpt = 0U; u2Cpt < u2CoordSize; u2Cpt++)
+    {
+        decompX[u2Cpt] = pubKey[u2CoordSize - u2Cpt];
+    }
+    
+    if (lDRV_CRYPTO_ECC_Compare(decompX, pfu1P, u2Size) >= 0)
+    {
+        return CRYPTO_CPKCL_RESULT_COORD_COMPRESS_ERROR;
+    }
+    
+    lDRV_CRYPTO_ECC_ModExpSetup(pEcc);
+    
+    /* x^3 + a*x + b */
+    (void) memset(decompRhs, 0, sizeof(decompRhs));
+    (void) memset(decompY, 0, sizeof(decompY));
+    (void) memset(sqrtExp, 0, sizeof(sqrtExp));
+    sqrtExp[0] = 3U;
+    ok = lDRV_CRYPTO_ECC_ModExp(pEcc, decompRhs, decompX, sqrtExp);
+    if (ok)
+    {
+        (void) memcpy(decompY, pEcc->pfu1ACurve, u2Size);
+        ok = lDRV_CRYPTO_ECC_ModMul(pEcc, decompY, decompY, decompX);
+    }
+    
+    if (ok)
+    {
+        lDRV_CRYPTO_ECC_ModAdd(decompRhs, decompRhs, decompY, pfu1P, u2Size);
+        lDRV_CRYPTO_ECC_ModAdd(decompRhs, decompRhs, pEcc->pfu1BCurve, pfu1P, 
+            u2Size);
+        ok = lDRV_CRYPTO_ECC_ModSqrt(pEcc, decompY, decompRhs);
+    }
+    
+    /* The crypto RAM holds the decompression operands now */
+    DRV_CRYPTO_ECC_RamInvalidate();
+    
+    if (!ok)
+    {
+        return CRYPTO_CPKCL_RESULT_COORD_COMPRESS_ERROR;
+    }
+    
+    /* Take p - y when the parity does not match, y = 0 has no odd form */
+    if ((decompY[0] & 1U) != (pubKey[0] & 1U))
+    {
+        (void) memset(decompRhs, 0, sizeof(decompRhs));
+        if (lDRV_CRYPTO_ECC_Compare(decompY, decompRhs, u2Size) == 0)
+        {
+            return CRYPTO_CPKCL_RESULT_COORD_COMPRESS_ERROR;
+        }
+        (void) lDRV_CRYPTO_ECC_Sub(decompY, pfu1P, decompY, u2Size);
+    }
+    
+    for (u2Cpt = 0U; u2Cpt < u2CoordSize; u2Cpt++)
+    {
+        pubKeyX[u2Cpt] = pubKey[u2Cpt + 1U];
+        pubKeyY[u2Cpt] = decompY[u2CoordSize - u2Cpt - 1U];
+    }
+    
+    return CRYPTO_CPKCL_RESULT_CURVE_SUCCESS;
+}
+
+/* Draws the private key in place at pu1Scalar, where CPKCL_Rng(nu1RBase) 
+   points, and writes it out in MSB mode on u2KeySize bytes */
+static CRYPTO_CPKCL_RESULT lDRV_CRYPTO_ECC_DrawPrivateKey(
+    CPKCL_ECC_DATA *pEccData, pu1 pu1Scalar, pfu1 privKey)
+{
+    u1 u1TopMask;
+    u2 u2Cpt;
+    u4 u4Draw;
+    bool inRange = false;
+    u2 u2OrderSize = pEccData->u2OrderSize;
+    u2 u2KeySize = pEccData->u2KeySize;
+    
+    /* Keep the draw within the bit length of the order */
+    u1TopMask = pEccData->pfu1APointOrder[u2KeySize - 1U];
+    u1TopMask |= (u1) (u1TopMask >> 1U);
+    u1TopMask |= (u1) (u1TopMask >> 2U);
+    u1TopMask |= (u1) (u1TopMask >> 4U);
+    
+    for (u4Draw = 0U; (u4Draw < CPKCL_KEYGEN_MAX_DRAWS) && (!inRange); u4Draw++)
+    {
+        CPKCL_Rng(u2RLength) = u2OrderSize;
+        CPKCL(u2Option) = CPKCL_RNG_GET;
+        /* MISRA C-2012 deviation block start */
+        /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID - 
+           H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+        vCPKCL_Process(Rng, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+        /* MISRA C-2012 deviation block end */
+        if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+        {
+            return CRYPTO_CPKCL_RESULT_KEYGEN_RNG_ERROR;
+        }
+        
+        /* Clear the bytes above the key size and the padding */
+        (void) memset(&pu1Scalar[u2KeySize], 0, 
+                      (size_t)u2OrderSize - u2KeySize + 4U);
+        pu1Scalar[u2KeySize - 1U] &= u1TopMask;
+        
+        inRange = lDRV_CRYPTO_ECC_ScalarInRange(pu1Scalar, 
+                      pEccData->pfu1APointOrder, u2KeySize);
+    }
+    
+    if (!inRange)
+    {
+        (void) memset(pu1Scalar, 0, (size_t)u2OrderSize + 4U);
+        return CRYPTO_CPKCL_RESULT_KEYGEN_RNG_ERROR;
+    }
+    
+    /* Private key out in MSB mode */
+    for (u2Cpt = 0U; u2Cpt < u2KeySize; u2Cpt++)
+    {
+        privKey[u2Cpt] = pu1Scalar[u2KeySize - u2Cpt - 1U];
+    }
+    
+    return CRYPTO_CPKCL_RESULT_KEYGEN_SUCCESS;
+}
+
+/* DRV_CRYPTO_ECC_KeyGen on a binary curve */
+static CRYPTO_CPKCL_RESULT lDRV_CRYPTO_ECC_KeyGenGf2n(CPKCL_ECC_DATA *pEccData,
+    pfu1 privKey, pfu1 pubKey)
+{
+    CRYPTO_CPKCL_RESULT result;
+    pu1 pu1Scalar;
+    pu1 pu1PointX;
+    pu1 pu1PointY;
+    u2 u2Cpt;
+    
+    /* Set sizes */
+    u2 u2ModuloPSize = pEccData->u2ModuloPSize;
+    u2 u2KeySize = pEccData->u2KeySize;
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:4 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:28 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:4 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:4 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    pu1Scalar = (pu1) BASE_GF2N_SCA_MUL_SCALAR(u2ModuloPSize, 
+        pEccData->u2OrderSize);
+    pu1PointX = (pu1) BASE_SCA_MUL_POINT_A_X(u2ModuloPSize, 
+        pEccData->u2OrderSize);
+    pu1PointY = (pu1) BASE_SCA_MUL_POINT_A_Y(u2ModuloPSize, 
+        pEccData->u2OrderSize);
+    
+    /* The private key is drawn in place */
+    CPKCL_Rng(nu1RBase) = (nu1) BASE_GF2N_SCA_MUL_SCALAR(u2ModuloPSize, 
+        pEccData->u2OrderSize);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    
+    result = lDRV_CRYPTO_ECC_DrawPrivateKey(pEccData, pu1Scalar, privKey);
+    if (result != CRYPTO_CPKCL_RESULT_KEYGEN_SUCCESS)
+    {
+        return result;
+    }
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:3 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:21 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:3 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:3 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* Base point, overwritten by the result */
+    (void) memcpy(
+        (pu1) ((BASE_SCA_MUL_POINT_A_X(u2ModuloPSize, 
+            pEccData->u2OrderSize))), 
+        pEccData->pfu1APointX, u2ModuloPSize + 4U);
+    (void) memcpy(
+        (pu1) ((BASE_SCA_MUL_POINT_A_Y(u2ModuloPSize, 
+            pEccData->u2OrderSize))), 
+        pEccData->pfu1APointY, u2ModuloPSize + 4U);
+    (void) memcpy(
+        (pu1) ((BASE_SCA_MUL_POINT_A_Z(u2ModuloPSize, 
+            pEccData->u2OrderSize))), 
+        pEccData->pfu1APointZ, u2ModuloPSize + 4U);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    
+    if (!DRV_CRYPTO_ECC_Gf2nMul(pEccData))
+    {
+        (void) memset(privKey, 0, u2KeySize);
+        return CRYPTO_CPKCL_RESULT_KEYGEN_ERROR;
+    }
+    
+    /* Uncompressed public key in MSB mode */
+    pubKey[0] = 0x04U;
+    for (u2Cpt = 0U; u2Cpt < u2KeySize; u2Cpt++)
+    {
+        pubKey[1U + u2Cpt] = pu1PointX[u2KeySize - u2Cpt - 1U];
+        pubKey[1U + u2KeySize + u2Cpt] = pu1PointY[u2KeySize - u2Cpt - 1U];
+    }
+    
+    return CRYPTO_CPKCL_RESULT_KEYGEN_SUCCESS;
+}
+
+/* Loads the curve constants of the BASE_POINT_* memory mapping when they are
+   not resident */
+static void lDRV_CRYPTO_ECC_PointSetup(CPKCL_ECC_DATA *pEcc)
+{
+    u2 u2ModuloPSize = pEcc->u2ModuloPSize;
+    
+    if (DRV_CRYPTO_ECC_RamIsResident(pEcc->curveType, CRYPTO_CPKCL_RAM_POINT))
+    {
+        return;
+    }
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:3 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:12 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:3 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:3 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    (void) memcpy((pu1) ((BASE_POINT_MODULO(u2ModuloPSize))), 
+        pEcc->pfu1ModuloP, u2ModuloPSize + 4U);
+    (void) memcpy((pu1) ((BASE_POINT_CNS(u2ModuloPSize))), 
+        pEcc->pfu1Cns, u2ModuloPSize + 8U);
+    (void) memcpy((pu1) ((BASE_POINT_A(u2ModuloPSize))), 
+        pEcc->pfu1ACurve, u2ModuloPSize + 4U);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    
+    DRV_CRYPTO_ECC_RamSetResident(pEcc->curveType, CRYPTO_CPKCL_RAM_POINT);
+}
+
+/* Writes an uncompressed point in MSB mode, or G when it is NULL, as a 
+   projective point with Z = 1 at pu1Dest in the crypto RAM */
+static void lDRV_CRYPTO_ECC_PointLoad(CPKCL_ECC_DATA *pEcc, pu1 pu1Dest, 
+    pfu1 pfu1Point)
+{
+    u2 u2ModuloPSize = pEcc->u2ModuloPSize;
+    u2 u2KeySize = pEcc->u2KeySize;
+    pu1 pu1Y = &pu1Dest[u2ModuloPSize + 4U];
+    pu1 pu1Z = &pu1Dest[(2U * u2ModuloPSize) + 8U];
+    u2 u2Cpt;
+    
+    if (pfu1Point == NULL)
+    {
+        (void) memcpy(pu1Dest, pEcc->pfu1APointX, u2ModuloPSize + 4U);
+        (void) memcpy(pu1Y, pEcc->pfu1APointY, u2ModuloPSize + 4U);
+        (void) memcpy(pu1Z, pEcc->pfu1APointZ, u2ModuloPSize + 4U);
+        return;
+    }
+    
+    (void) memset(pu1Dest, 0, (3U * (size_t)u2ModuloPSize) + 12U);
+    for (u2Cpt = 0U; u2Cpt < u2KeySize; u2Cpt++)
+    {
+        pu1Dest[u2Cpt] = pfu1Point[u2KeySize - u2Cpt];
+        pu1Y[u2Cpt] = pfu1Point[(2U * u2KeySize) - u2Cpt];
+    }
+    pu1Z[0] = 1U;
+}
+
+/* Reads the affine point at pu1Src in the crypto RAM out uncompressed */
+static void lDRV_CRYPTO_ECC_PointStore(CPKCL_ECC_DATA *pEcc, pfu1 pfu1Point, 
+    pu1 pu1Src)
+{
+    u2 u2KeySize = pEcc->u2KeySize;
+    pu1 pu1Y = &pu1Src[pEcc->u2ModuloPSize + 4U];
+    u2 u2Cpt;
+    
+    pfu1Point[0] = 0x04U;
+    for (u2Cpt = 0U; u2Cpt < u2KeySize; u2Cpt++)
+    {
+        pfu1Point[1U + u2Cpt] = pu1Src[u2KeySize - u2Cpt - 1U];
+        pfu1Point[1U + u2KeySize + u2Cpt] = pu1Y[u2KeySize - u2Cpt - 1U];
+    }
+}
+
+/* True when the Z coordinate of the projective point at pu1Point is 0, the 
+   point at infinity */
+static bool lDRV_CRYPTO_ECC_PointIsInfinity(pu1 pu1Point, u2 u2ModuloPSize)
+{
+    pu1 pu1Z = &pu1Point[(2U * u2ModuloPSize) + 8U];
+    u1 u1NonZero = 0U;
+    u2 u2Cpt;
+    
+    for (u2Cpt = 0U; u2Cpt < u2ModuloPSize; u2Cpt++)
+    {
+        u1NonZero |= pu1Z[u2Cpt];
+    }
+    
+    return (u1NonZero == 0U);
+}
+
+/* Doubles the point of slot u1Slot in place */
+static CRYPTO_CPKCL_RESULT lDRV_CRYPTO_ECC_PointDbl(CPKCL_ECC_DATA *pEcc, 
+    u1 u1Slot)
+{
+    u2 u2ModuloPSize = pEcc->u2ModuloPSize;
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:5 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:20 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:5 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:5 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    CPKCL_ZpEccDbl(nu1ModBase) = (nu1) BASE_POINT_MODULO(u2ModuloPSize);
+    CPKCL_ZpEccDbl(nu1CnsBase) = (nu1) BASE_POINT_CNS(u2ModuloPSize);
+    CPKCL_ZpEccDbl(nu1PointABase) = (nu1) BASE_POINT_SLOT(u2ModuloPSize, 
+        u1Slot);
+    CPKCL_ZpEccDbl(nu1ABase) = (nu1) BASE_POINT_A(u2ModuloPSize);
+    CPKCL_ZpEccDbl(nu1Workspace) = (nu1) BASE_POINT_WORKSPACE(u2ModuloPSize);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL_ZpEccDbl(u2ModLength) = u2ModuloPSize;
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* See CPKCL_Rc_pb.h for possible u2Status Values */
+    vCPKCL_Process(ZpEccDblFast, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    if (CPKCL(u2Status) == (unsigned)CPKCL_POINT_AT_INFINITY)
+    {
+        return CRYPTO_CPKCL_RESULT_POINT_DEGENERATE;
+    }
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        return CRYPTO_CPKCL_RESULT_POINT_ERROR;
+    }
+    
+    return CRYPTO_CPKCL_RESULT_POINT_SUCCESS;
+}
+
+/* Adds the point of slot u1SlotB to the point of slot u1SlotA. The formulas
+   do not handle equal points: CRYPTO_CPKCL_RESULT_POINT_DEGENERATE is 
+   returned when the points are equal or opposite. */
+static CRYPTO_CPKCL_RESULT lDRV_CRYPTO_ECC_PointAddSlots(CPKCL_ECC_DATA *pEcc,
+    u1 u1SlotA, u1 u1SlotB)
+{
+    u2 u2ModuloPSize = pEcc->u2ModuloPSize;
+    pu1 pu1PointA;
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:6 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:24 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:6 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:6 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    pu1PointA = (pu1) BASE_POINT_SLOT(u2ModuloPSize, u1SlotA);
+    
+    CPKCL_ZpEccAdd(nu1ModBase) = (nu1) BASE_POINT_MODULO(u2ModuloPSize);
+    CPKCL_ZpEccAdd(nu1CnsBase) = (nu1) BASE_POINT_CNS(u2ModuloPSize);
+    CPKCL_ZpEccAdd(nu1PointABase) = (nu1) BASE_POINT_SLOT(u2ModuloPSize, 
+        u1SlotA);
+    CPKCL_ZpEccAdd(nu1PointBBase) = (nu1) BASE_POINT_SLOT(u2ModuloPSize, 
+        u1SlotB);
+    CPKCL_ZpEccAdd(nu1Workspace) = (nu1) BASE_POINT_WORKSPACE(u2ModuloPSize);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL_ZpEccAdd(u2ModLength) = u2ModuloPSize;
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* See CPKCL_Rc_pb.h for possible u2Status Values */
+    vCPKCL_Process(ZpEccAddFast, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    if (CPKCL(u2Status) == (unsigned)CPKCL_POINT_AT_INFINITY)
+    {
+        return CRYPTO_CPKCL_RESULT_POINT_DEGENERATE;
+    }
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        return CRYPTO_CPKCL_RESULT_POINT_ERROR;
+    }
+    
+    /* Equal points give Z = 0 just as opposite points */
+    if (lDRV_CRYPTO_ECC_PointIsInfinity(pu1PointA, u2ModuloPSize))
+    {
+        return CRYPTO_CPKCL_RESULT_POINT_DEGENERATE;
+    }
+    
+    return CRYPTO_CPKCL_RESULT_POINT_SUCCESS;
+}
+
+/* Converts the point of slot u1Slot to affine coordinates in place */
+static bool lDRV_CRYPTO_ECC_PointToAffine(CPKCL_ECC_DATA *pEcc, u1 u1Slot)
+{
+    u2 u2ModuloPSize = pEcc->u2ModuloPSize;
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:4 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:16 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:4 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:4 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    CPKCL_ZpEcConvProjToAffine(nu1ModBase) = (nu1) BASE_POINT_MODULO(
+        u2ModuloPSize);
+    CPKCL_ZpEcConvProjToAffine(nu1CnsBase) = (nu1) BASE_POINT_CNS(
+        u2ModuloPSize);
+    CPKCL_ZpEcConvProjToAffine(nu1PointABase) = (nu1) BASE_POINT_SLOT(
+        u2ModuloPSize, u1Slot);
+    CPKCL_ZpEcConvProjToAffine(nu1Workspace) = (nu1) BASE_POINT_WORKSPACE(
+        u2ModuloPSize);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL_ZpEcConvProjToAffine(u2ModLength) = u2ModuloPSize;
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* See CPKCL_Rc_pb.h for possible u2Status Values */
+    vCPKCL_Process(ZpEcConvProjToAffine, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    
+    return (CPKCL(u2Status) == (unsigned)CPKCL_OK);
+}
+
+/* lDRV_CRYPTO_ECC_PointAddSlots for the sliced multiplications, which must
+   not fall back on the blocking functions: when the points are equal or 
+   opposite, the copy of slot u1SlotA and slot u1SlotB are converted to 
+   affine coordinates and compared, equal points are doubled and 
+   CRYPTO_CPKCL_RESULT_POINT_INFINITY is returned for opposite ones, with Z
+   cleared in slot u1SlotA. Neither point may be at infinity. Such a step 
+   costs two conversions more than an addition. */
+static CRYPTO_CPKCL_RESULT lDRV_CRYPTO_ECC_PointAddFull(CPKCL_ECC_DATA *pEcc,
+    u1 u1SlotA, u1 u1SlotB)
+{
+    u1 au1Copy[CPKCL_ECC_MUL_SLOT_SIZE];
+    CRYPTO_CPKCL_RESULT status;
+    u2 u2ModuloPSize = pEcc->u2ModuloPSize;
+    size_t pointSize = (3U * (size_t)u2ModuloPSize) + 12U;
+    pu1 pu1PointA;
+    pu1 pu1PointB;
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:8 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:2 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:2 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    pu1PointA = (pu1) BASE_POINT_SLOT(u2ModuloPSize, u1SlotA);
+    pu1PointB = (pu1) BASE_POINT_SLOT(u2ModuloPSize, u1SlotB);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    
+    (void) memcpy(au1Copy, pu1PointA, pointSize);
+    status = lDRV_CRYPTO_ECC_PointAddSlots(pEcc, u1SlotA, u1SlotB);
+    
+    if (status == CRYPTO_CPKCL_RESULT_POINT_DEGENERATE)
+    {
+        /* The abscissas are equal, the ordinates tell the two cases apart */
+        (void) memcpy(pu1PointA, au1Copy, pointSize);
+        if (!lDRV_CRYPTO_ECC_PointToAffine(pEcc, u1SlotA) || 
+            !lDRV_CRYPTO_ECC_PointToAffine(pEcc, u1SlotB))
+        {
+            status = CRYPTO_CPKCL_RESULT_POINT_ERROR;
+        }
+        else if (memcmp(&pu1PointA[u2ModuloPSize + 4U], 
+                    &pu1PointB[u2ModuloPSize + 4U], u2ModuloPSize) != 0)
+        {
+            status = CRYPTO_CPKCL_RESULT_POINT_INFINITY;
+        }
+        else
+        {
+            status = lDRV_CRYPTO_ECC_PointDbl(pEcc, u1SlotA);
+        }
+        
+        /* A doubling meets infinity only for a point of order 2 */
+        if ((status == CRYPTO_CPKCL_RESULT_POINT_INFINITY) || 
+            (status == CRYPTO_CPKCL_RESULT_POINT_DEGENERATE))
+        {
+            (void) memset(&pu1PointA[(2U * u2ModuloPSize) + 8U], 0, 
+                (size_t)u2ModuloPSize + 4U);
+            status = CRYPTO_CPKCL_RESULT_POINT_INFINITY;
+        }
+    }
+    
+    /* The accumulator of a secret scalar depends on it */
+    (void) memset(au1Copy, 0, sizeof(au1Copy));
+    
+    return status;
+}
+
+/* Bit u2Bit of a scalar in MSB mode on u2KeySize bytes */
+static u1 lDRV_CRYPTO_ECC_ScalarBit(pfu1 pfu1Scalar, u2 u2KeySize, u2 u2Bit)
+{
+    return (u1) ((pfu1Scalar[u2KeySize - 1U - (u2Bit / 8U)] >> (u2Bit % 8U)) 
+        & 1U);
+}
+
+/* Writes point u2Index of the comb table, with Z = 1, in slot u1Slot */
+static void lDRV_CRYPTO_ECC_CombLoad(CPKCL_ECC_DATA *pEcc, 
+    const CPKCL_ECC_COMB_TABLE *pComb, u2 u2Index, u1 u1Slot)
+{
+    u2 u2ModuloPSize = pEcc->u2ModuloPSize;
+    size_t coordSize = (size_t)u2ModuloPSize + 4U;
+    const u1 *pu1Point = &pComb->pu1Points[2U * coordSize * u2Index];
+    pu1 pu1Dest;
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:1 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:4 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    pu1Dest = (pu1) BASE_POINT_SLOT(u2ModuloPSize, u1Slot);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    
+    (void) memcpy(pu1Dest, pu1Point, 2U * coordSize);
+    (void) memcpy(&pu1Dest[2U * coordSize], pEcc->pfu1APointZ, coordSize);
+}
+
+/* k*G on the comb table, k in MSB mode on u2KeySize bytes. The accumulator
+   starts at S, each column doubles it and adds the table point of the 
+   column digit, a zero digit adding point 15 to a copy of the accumulator 
+   instead, and -(2^d S) is added at the end. */
+static CRYPTO_CPKCL_RESULT lDRV_CRYPTO_ECC_CombMul(CPKCL_ECC_DATA *pEcc, 
+    const CPKCL_ECC_COMB_TABLE *pComb, pfu1 scalar, pfu1 result)
+{
+    CRYPTO_CPKCL_RESULT status = CRYPTO_CPKCL_RESULT_POINT_SUCCESS;
+    u2 u2ModuloPSize = pEcc->u2ModuloPSize;
+    u2 u2KeySize = pEcc->u2KeySize;
+    u2 u2Columns = pComb->u2Columns;
+    size_t pointSize = (3U * (size_t)u2ModuloPSize) + 12U;
+    pu1 pu1Acc;
+    u2 u2Col;
+    u2 u2Tooth;
+    u1 u1Digit;
+    
+    lDRV_CRYPTO_ECC_PointSetup(pEcc);
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:1 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:4 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    pu1Acc = (pu1) BASE_POINT_SLOT(u2ModuloPSize, 0U);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    
+    lDRV_CRYPTO_ECC_CombLoad(pEcc, pComb, CPKCL_ECC_COMB_START, 0U);
+    
+    u2Col = u2Columns;
+    while ((status == CRYPTO_CPKCL_RESULT_POINT_SUCCESS) && (u2Col > 0U))
+    {
+        u2Col--;
+        
+        u1Digit = 0U;
+        for (u2Tooth = 0U; u2Tooth < 4U; u2Tooth++)
+        {
+            u1Digit |= (u1) (lDRV_CRYPTO_ECC_ScalarBit(scalar, u2KeySize, 
+                (u2) (u2Col + (u2Tooth * u2Columns))) << u2Tooth);
+        }
+        
+        status = lDRV_CRYPTO_ECC_PointDbl(pEcc, 0U);
+        
+        /* The same copy, load and addition whatever the digit */
+        (void) memcpy(&pu1Acc[2U * pointSize], pu1Acc, pointSize);
+        lDRV_CRYPTO_ECC_CombLoad(pEcc, pComb, 
+            (u1Digit != 0U) ? (u2) u1Digit : 15U, 1U);
+        if (status == CRYPTO_CPKCL_RESULT_POINT_SUCCESS)
+        {
+            status = lDRV_CRYPTO_ECC_PointAddSlots(pEcc, 
+                (u1Digit != 0U) ? 0U : 2U, 1U);
+        }
+    }
+    
+    if (status == CRYPTO_CPKCL_RESULT_POINT_SUCCESS)
+    {
+        lDRV_CRYPTO_ECC_CombLoad(pEcc, pComb, CPKCL_ECC_COMB_END, 1U);
+        status = lDRV_CRYPTO_ECC_PointAddSlots(pEcc, 0U, 1U);
+    }
+    if ((status == CRYPTO_CPKCL_RESULT_POINT_SUCCESS) && 
+        !lDRV_CRYPTO_ECC_PointToAffine(pEcc, 0U))
+    {
+        status = CRYPTO_CPKCL_RESULT_POINT_ERROR;
+    }
+    
+    if (status == CRYPTO_CPKCL_RESULT_POINT_SUCCESS)
+    {
+        lDRV_CRYPTO_ECC_PointStore(pEcc, result, pu1Acc);
+    }
+    
+    /* The accumulator and its copy depend on k */
+    (void) memset(pu1Acc, 0, 3U * pointSize);
+    
+    return status;
+}
+
+/* Writes k + n or k + 2n, whichever is one bit longer than the order n, in
+   MSB mode on u2KeySize + 1 bytes, k being in MSB mode on u2KeySize bytes. 
+   k + n is below 2n and k + 2n below 3n, the choice is a mask on the top 
+   bit of k + n. Returns the bit length of n, the index of the top bit. */
+static u2 lDRV_CRYPTO_ECC_RegularScalar(CPKCL_ECC_DATA *pEcc, pu1 pu1Dest, 
+    pfu1 pfu1Scalar)
+{
+    u1 au1Sum1[CPKCL_ECC_MAX_OPERAND_SIZE];
+    u1 au1Sum2[CPKCL_ECC_MAX_OPERAND_SIZE];
+    pfu1 pfu1Order = pEcc->pfu1APointOrder;
+    u2 u2KeySize = pEcc->u2KeySize;
+    u2 u2Size = u2KeySize + 1U;
+    u2 u2OrderBits = 8U * u2Size;
+    u1 u1Mask;
+    u2 u2Cpt;
+    
+    while ((u2OrderBits > 0U) && (((pfu1Order[(u2OrderBits - 1U) / 8U] 
+        >> ((u2OrderBits - 1U) % 8U)) & 1U) == 0U))
+    {
+        u2OrderBits--;
+    }
+    
+    for (u2Cpt = 0U; u2Cpt < u2KeySize; u2Cpt++)
+    {
+        au1Sum1[u2Cpt] = pfu1Scalar[u2KeySize - u2Cpt - 1U];
+    }
+    au1Sum1[u2KeySize] = 0U;
+    (void) lDRV_CRYPTO_ECC_Add(au1Sum1, au1Sum1, pfu1Order, u2Size);
+    (void) lDRV_CRYPTO_ECC_Add(au1Sum2, au1Sum1, pfu1Order, u2Size);
+    
+    u1Mask = (u1) (0U - (((u4) au1Sum1[u2OrderBits / 8U] 
+        >> (u2OrderBits % 8U)) & 1U));
+    for (u2Cpt = 0U; u2Cpt < u2Size; u2Cpt++)
+    {
+        pu1Dest[u2Size - u2Cpt - 1U] = (u1) ((au1Sum1[u2Cpt] & u1Mask) 
+            | (au1Sum2[u2Cpt] & (u1) ~u1Mask));
+    }
+    
+    (void) memset(au1Sum1, 0, sizeof(au1Sum1));
+    (void) memset(au1Sum2, 0, sizeof(au1Sum2));
+    
+    return u2OrderBits;
+}
+
+/* One bit of the secret scalar: slot 0 is the accumulator, slot 1 P and 
+   slot 2 the copy the addition of a zero bit goes to. The doubled 
+   accumulator is below n except on the last two bits, where it meets P or -P
+   for k in [1, 5] and k = n - 2 or n - 1 only. k = 1 gets to -P + P, the 
+   accumulator is then empty until the last bit copies P. */
+static CRYPTO_CPKCL_RESULT lDRV_CRYPTO_ECC_MulRegularBit(
+    CPKCL_ECC_DATA *pEcc, CPKCL_ECC_MUL_CTX *pMul, pu1 pu1Acc)
+{
+    CRYPTO_CPKCL_RESULT status;
+    size_t pointSize = (3U * (size_t)pEcc->u2ModuloPSize) + 12U;
+    u1 u1Bit = lDRV_CRYPTO_ECC_ScalarBit(pMul->au1Scalar1, 
+        pEcc->u2KeySize + 1U, pMul->u2Bit);
+    
+    if (pMul->accEmpty)
+    {
+        if (u1Bit != 0U)
+        {
+            (void) memcpy(pu1Acc, &pu1Acc[pointSize], pointSize);
+            pMul->accEmpty = false;
+        }
+        return CRYPTO_CPKCL_RESULT_POINT_SUCCESS;
+    }
+    
+    status = lDRV_CRYPTO_ECC_PointDbl(pEcc, 0U);
+    
+    /* The same copy and addition whatever the bit */
+    (void) memcpy(&pu1Acc[2U * pointSize], pu1Acc, pointSize);
+    if (status == CRYPTO_CPKCL_RESULT_POINT_SUCCESS)
+    {
+        status = lDRV_CRYPTO_ECC_PointAddFull(pEcc, (u1Bit != 0U) ? 0U : 2U,
+            1U);
+    }
+    
+    /* Infinity in the copy is dropped */
+    if (status == CRYPTO_CPKCL_RESULT_POINT_INFINITY)
+    {
+        pMul->accEmpty = (u1Bit != 0U);
+        status = CRYPTO_CPKCL_RESULT_POINT_SUCCESS;
+    }
+    
+    return status;
+}
+
+/* One bit pair of the public scalars, as in DRV_CRYPTO_ECC_DualMul: slot 0
+   is the accumulator and slots 1 to 3 P1, P2 and P1 + P2. An accumulator at
+   infinity is empty again, and P1 + P2 at infinity, P1 = -P2, adds 
+   nothing. */
+static CRYPTO_CPKCL_RESULT lDRV_CRYPTO_ECC_MulDualBit(CPKCL_ECC_DATA *pEcc, 
+    CPKCL_ECC_MUL_CTX *pMul, pu1 pu1Acc)
+{
+    CRYPTO_CPKCL_RESULT status = CRYPTO_CPKCL_RESULT_POINT_SUCCESS;
+    size_t pointSize = (3U * (size_t)pEcc->u2ModuloPSize) + 12U;
+    u2 u2Size = pEcc->u2KeySize + 1U;
+    u1 u1Digit;
+    
+    if (!pMul->accEmpty)
+    {
+        status = lDRV_CRYPTO_ECC_PointDbl(pEcc, 0U);
+    }
+    
+    u1Digit = (u1) (lDRV_CRYPTO_ECC_ScalarBit(pMul->au1Scalar1, u2Size, 
+        pMul->u2Bit) | (u1) (lDRV_CRYPTO_ECC_ScalarBit(pMul->au1Scalar2, 
+        u2Size, pMul->u2Bit) << 1U));
+    if ((u1Digit == 3U) && lDRV_CRYPTO_ECC_PointIsInfinity(
+        &pu1Acc[3U * pointSize], pEcc->u2ModuloPSize))
+    {
+        u1Digit = 0U;
+    }
+    if ((status == CRYPTO_CPKCL_RESULT_POINT_SUCCESS) && (u1Digit != 0U))
+    {
+        if (pMul->accEmpty)
+        {
+            (void) memcpy(pu1Acc, &pu1Acc[(size_t)u1Digit * pointSize], 
+                pointSize);
+            pMul->accEmpty = false;
+        }
+        else
+        {
+            status = lDRV_CRYPTO_ECC_PointAddFull(pEcc, 0U, u1Digit);
+        }
+    }
+    if (status == CRYPTO_CPKCL_RESULT_POINT_INFINITY)
+    {
+        pMul->accEmpty = true;
+        status = CRYPTO_CPKCL_RESULT_POINT_SUCCESS;
+    }
+    
+    return status;
+}
+
+/* Last step: the accumulator to affine coordinates and out */
+static CRYPTO_CPKCL_RESULT lDRV_CRYPTO_ECC_MulEnd(CPKCL_ECC_DATA *pEcc, 
+    CPKCL_ECC_MUL_CTX *pMul, pu1 pu1Acc, pfu1 result)
+{
+    CRYPTO_CPKCL_RESULT status = CRYPTO_CPKCL_RESULT_POINT_SUCCESS;
+    
+    if (pMul->accEmpty)
+    {
+        /* Both scalars are 0 */
+        status = CRYPTO_CPKCL_RESULT_POINT_INFINITY;
+    }
+    else if (!lDRV_CRYPTO_ECC_PointToAffine(pEcc, 0U))
+    {
+        status = CRYPTO_CPKCL_RESULT_POINT_ERROR;
+    }
+    else
+    {
+        lDRV_CRYPTO_ECC_PointStore(pEcc, result, pu1Acc);
+    }
+    
+    return status;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: CPKCL Common Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_InitCpkcl(void)
+{
+    /* Wait end of CPKCC RAM initialization */ 
+    while ((CPKCCSR & (unsigned int)BIT_CPKCCSR_CLRRAM_BUSY) != 0U)
+    {
+        ;
+    }
+  
+    /* Perform self test, the result is kept for the following operations */
+    if (lDRV_CRYPTO_ECC_SelfTest() < 0)
+    {
+        return CRYPTO_CPKCL_RESULT_INIT_ERROR;
+    }
+    
+    return CRYPTO_CPKCL_RESULT_INIT_SUCCESS;
+}
+
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_CheckCpkcl(void)
+{
+    /* Not initialized at power-on, do it on first use */
+    if (selfTestState == 0)
+    {
+        return DRV_CRYPTO_ECC_InitCpkcl();
+    }
+    
+    /* A failed self test is only cleared by DRV_CRYPTO_ECC_ReTestCpkcl */
+    if (selfTestState < 0)
+    {
+        return CRYPTO_CPKCL_RESULT_INIT_ERROR;
+    }
+    
+#if CRYPTO_CPKCL_SELFTEST_PERIOD != 0
+    selfTestOpCount++;
+    if (selfTestOpCount >= (uint32_t)CRYPTO_CPKCL_SELFTEST_PERIOD)
+    {
+        return DRV_CRYPTO_ECC_ReTestCpkcl();
+    }
+#endif
+    
+    return CRYPTO_CPKCL_RESULT_INIT_SUCCESS;
+}
+
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_ReTestCpkcl(void)
+{
+    if (lDRV_CRYPTO_ECC_SelfTest() < 0)
+    {
+        return CRYPTO_CPKCL_RESULT_INIT_ERROR;
+    }
+    
+    return CRYPTO_CPKCL_RESULT_INIT_SUCCESS;
+}
+
+int8_t DRV_CRYPTO_ECC_GetSelfTestState(void)
+{
+    return selfTestState;
+}
+
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_InitCurveParams(CPKCL_ECC_DATA *pEcc, 
+    CRYPTO_CPKCL_CURVE curveType)
+{
+    CRYPTO_CPKCL_RESULT result = CRYPTO_CPKCL_RESULT_CURVE_SUCCESS;
+    
+    pEcc->curveType = curveType;
+    
+     switch (curveType)
+    {
+         case CRYPTO_CPKCL_CURVE_P192:
+            pEcc->u2ModuloPSize = sizeof(p192_au1ModuloP) - 4U;
+            pEcc->u2OrderSize = sizeof(p192_au1OrderPoint) - 4U;
+            pEcc->u2KeySize = P192_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 8. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1ModuloP = (pfu1) p192_au1ModuloP;
+            pEcc->pfu1ACurve = (pfu1) p192_au1ACurve;
+            pEcc->pfu1APointX = (pfu1) p192_au1PtA_X;
+            pEcc->pfu1APointY = (pfu1) p192_au1PtA_Y;
+            pEcc->pfu1APointZ = (pfu1) p192_au1PtA_Z;
+            pEcc->pfu1APointOrder = (pfu1) p192_au1OrderPoint;
+            pEcc->pfu1Cns = (pfu1) p192_au1Cns;
+            pEcc->pfu1BCurve = (pfu1) p192_au1BCurve;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+        
+         case CRYPTO_CPKCL_CURVE_P224:
+            pEcc->u2ModuloPSize = sizeof(p224_au1ModuloP) - 4U;
+            pEcc->u2OrderSize = sizeof(p224_au1OrderPoint) - 4U;
+            pEcc->u2KeySize = P224_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 8. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1ModuloP = (pfu1) p224_au1ModuloP;
+            pEcc->pfu1ACurve = (pfu1) p224_au1ACurve;
+            pEcc->pfu1APointX = (pfu1) p224_au1PtA_X;
+            pEcc->pfu1APointY = (pfu1) p224_au1PtA_Y;
+            pEcc->pfu1APointZ = (pfu1) p224_au1PtA_Z;
+            pEcc->pfu1APointOrder = (pfu1) p224_au1OrderPoint;
+            pEcc->pfu1Cns = (pfu1) p224_au1Cns;
+            pEcc->pfu1BCurve = (pfu1) p224_au1BCurve;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;   
+            
+        case CRYPTO_CPKCL_CURVE_P256:
+            pEcc->u2ModuloPSize = sizeof(p256_au1ModuloP) - 4U;
+            pEcc->u2OrderSize = sizeof(p256_au1OrderPoint) - 4U;
+            pEcc->u2KeySize = P256_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 8. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1ModuloP = (pfu1) p256_au1ModuloP;
+            pEcc->pfu1ACurve = (pfu1) p256_au1ACurve;
+            pEcc->pfu1APointX = (pfu1) p256_au1PtA_X;
+            pEcc->pfu1APointY = (pfu1) p256_au1PtA_Y;
+            pEcc->pfu1APointZ = (pfu1) p256_au1PtA_Z;
+            pEcc->pfu1APointOrder = (pfu1) p256_au1OrderPoint;
+            pEcc->pfu1Cns = (pfu1) p256_au1Cns;
+            pEcc->pfu1BCurve = (pfu1) p256_au1BCurve;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+        
+        case CRYPTO_CPKCL_CURVE_P384:
+            pEcc->u2ModuloPSize = sizeof(p384_au1ModuloP) - 4U;
+            pEcc->u2OrderSize = sizeof(p384_au1OrderPoint) - 4U;
+            pEcc->u2KeySize = P384_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 8. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1ModuloP = (pfu1) p384_au1ModuloP;
+            pEcc->pfu1ACurve = (pfu1) p384_au1ACurve;
+            pEcc->pfu1APointX = (pfu1) p384_au1PtA_X;
+            pEcc->pfu1APointY = (pfu1) p384_au1PtA_Y;
+            pEcc->pfu1APointZ = (pfu1) p384_au1PtA_Z;
+            pEcc->pfu1APointOrder = (pfu1) p384_au1OrderPoint;
+            pEcc->pfu1Cns = (pfu1) p384_au1Cns;
+            pEcc->pfu1BCurve = (pfu1) p384_au1BCurve;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+        
+        case CRYPTO_CPKCL_CURVE_P521:
+            pEcc->u2ModuloPSize = sizeof(p521_au1ModuloP) - 4U;
+            pEcc->u2OrderSize = sizeof(p521_au1OrderPoint) - 4U;
+            pEcc->u2KeySize = P521_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 8. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1ModuloP = (pfu1) p521_au1ModuloP;
+            pEcc->pfu1ACurve = (pfu1) p521_au1ACurve;
+            pEcc->pfu1APointX = (pfu1) p521_au1PtA_X;
+            pEcc->pfu1APointY = (pfu1) p521_au1PtA_Y;
+            pEcc->pfu1APointZ = (pfu1) p521_au1PtA_Z;
+            pEcc->pfu1APointOrder = (pfu1) p521_au1OrderPoint;
+            pEcc->pfu1Cns = (pfu1) p521_au1Cns;
+            pEcc->pfu1BCurve = (pfu1) p521_au1BCurve;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+        
+        case CRYPTO_CPKCL_CURVE_BP256R1:
+            pEcc->u2ModuloPSize = sizeof(bp256r1_au1ModuloP) - 4U;
+            pEcc->u2OrderSize = sizeof(bp256r1_au1OrderPoint) - 4U;
+            pEcc->u2KeySize = P256_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 8. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1ModuloP = (pfu1) bp256r1_au1ModuloP;
+            pEcc->pfu1ACurve = (pfu1) bp256r1_au1ACurve;
+            pEcc->pfu1APointX = (pfu1) bp256r1_au1PtA_X;
+            pEcc->pfu1APointY = (pfu1) bp256r1_au1PtA_Y;
+            pEcc->pfu1APointZ = (pfu1) bp256r1_au1PtA_Z;
+            pEcc->pfu1APointOrder = (pfu1) bp256r1_au1OrderPoint;
+            pEcc->pfu1Cns = (pfu1) bp256r1_au1Cns;
+            pEcc->pfu1BCurve = (pfu1) bp256r1_au1BCurve;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+        
+        case CRYPTO_CPKCL_CURVE_BP384R1:
+            pEcc->u2ModuloPSize = sizeof(bp384r1_au1ModuloP) - 4U;
+            pEcc->u2OrderSize = sizeof(bp384r1_au1OrderPoint) - 4U;
+            pEcc->u2KeySize = P384_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 8. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1ModuloP = (pfu1) bp384r1_au1ModuloP;
+            pEcc->pfu1ACurve = (pfu1) bp384r1_au1ACurve;
+            pEcc->pfu1APointX = (pfu1) bp384r1_au1PtA_X;
+            pEcc->pfu1APointY = (pfu1) bp384r1_au1PtA_Y;
+            pEcc->pfu1APointZ = (pfu1) bp384r1_au1PtA_Z;
+            pEcc->pfu1APointOrder = (pfu1) bp384r1_au1OrderPoint;
+            pEcc->pfu1Cns = (pfu1) bp384r1_au1Cns;
+            pEcc->pfu1BCurve = (pfu1) bp384r1_au1BCurve;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+        
+        case CRYPTO_CPKCL_CURVE_SECP256K1:
+            pEcc->u2ModuloPSize = sizeof(secp256k1_au1ModuloP) - 4U;
+            pEcc->u2OrderSize = sizeof(secp256k1_au1OrderPoint) - 4U;
+            pEcc->u2KeySize = P256_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 8. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1ModuloP = (pfu1) secp256k1_au1ModuloP;
+            pEcc->pfu1ACurve = (pfu1) secp256k1_au1ACurve;
+            pEcc->pfu1APointX = (pfu1) secp256k1_au1PtA_X;
+            pEcc->pfu1APointY = (pfu1) secp256k1_au1PtA_Y;
+            pEcc->pfu1APointZ = (pfu1) secp256k1_au1PtA_Z;
+            pEcc->pfu1APointOrder = (pfu1) secp256k1_au1OrderPoint;
+            pEcc->pfu1Cns = (pfu1) secp256k1_au1Cns;
+            pEcc->pfu1BCurve = (pfu1) secp256k1_au1BCurve;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+        
+        case CRYPTO_CPKCL_CURVE_CUSTOM:
+            if (customCurve == NULL)
+            {
+                result = CRYPTO_CPKCL_RESULT_CURVE_ERROR;
+            }
+            else
+            {
+                pEcc->u2ModuloPSize = customCurve->u2ModuloPSize;
+                pEcc->u2OrderSize = customCurve->u2OrderSize;
+                pEcc->u2KeySize = customCurve->u2KeySize;
+                /* MISRA C-2012 deviation block start */
+                /* MISRA C-2012 Rule 11.8 deviated: 8. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+                pEcc->pfu1ModuloP = (pfu1) customCurve->pu1ModuloP;
+                pEcc->pfu1ACurve = (pfu1) customCurve->pu1ACurve;
+                pEcc->pfu1APointX = (pfu1) customCurve->pu1APointX;
+                pEcc->pfu1APointY = (pfu1) customCurve->pu1APointY;
+                pEcc->pfu1APointZ = (pfu1) custom_au1PtA_Z;
+                pEcc->pfu1APointOrder = (pfu1) customCurve->pu1APointOrder;
+                pEcc->pfu1Cns = (pfu1) customCurve->pu1Cns;
+                pEcc->pfu1BCurve = (pfu1) customCurve->pu1BCurve;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+                /* MISRA C-2012 deviation block end */
+            }
+            break;
+        
+        case CRYPTO_CPKCL_CURVE_SECT233K1:
+            pEcc->u2ModuloPSize = sizeof(sect233k1_au1ModuloP) - 4U;
+            pEcc->u2OrderSize = sizeof(sect233k1_au1OrderPoint) - 4U;
+            pEcc->u2KeySize = SECT233_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 8. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1ModuloP = (pfu1) sect233k1_au1ModuloP;
+            pEcc->pfu1ACurve = (pfu1) sect233k1_au1ACurve;
+            pEcc->pfu1APointX = (pfu1) sect233k1_au1PtA_X;
+            pEcc->pfu1APointY = (pfu1) sect233k1_au1PtA_Y;
+            pEcc->pfu1APointZ = (pfu1) sect233k1_au1PtA_Z;
+            pEcc->pfu1APointOrder = (pfu1) sect233k1_au1OrderPoint;
+            pEcc->pfu1Cns = (pfu1) sect233k1_au1Cns;
+            pEcc->pfu1BCurve = (pfu1) sect233k1_au1BCurve;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+        
+        case CRYPTO_CPKCL_CURVE_SECT233R1:
+            pEcc->u2ModuloPSize = sizeof(sect233r1_au1ModuloP) - 4U;
+            pEcc->u2OrderSize = sizeof(sect233r1_au1OrderPoint) - 4U;
+            pEcc->u2KeySize = SECT233_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 8. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1ModuloP = (pfu1) sect233r1_au1ModuloP;
+            pEcc->pfu1ACurve = (pfu1) sect233r1_au1ACurve;
+            pEcc->pfu1APointX = (pfu1) sect233r1_au1PtA_X;
+            pEcc->pfu1APointY = (pfu1) sect233r1_au1PtA_Y;
+            pEcc->pfu1APointZ = (pfu1) sect233r1_au1PtA_Z;
+            pEcc->pfu1APointOrder = (pfu1) sect233r1_au1OrderPoint;
+            pEcc->pfu1Cns = (pfu1) sect233r1_au1Cns;
+            pEcc->pfu1BCurve = (pfu1) sect233r1_au1BCurve;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+        
+        case CRYPTO_CPKCL_CURVE_SECT283K1:
+            pEcc->u2ModuloPSize = sizeof(sect283k1_au1ModuloP) - 4U;
+            pEcc->u2OrderSize = sizeof(sect283k1_au1OrderPoint) - 4U;
+            pEcc->u2KeySize = SECT283_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 8. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1ModuloP = (pfu1) sect283k1_au1ModuloP;
+            pEcc->pfu1ACurve = (pfu1) sect283k1_au1ACurve;
+            pEcc->pfu1APointX = (pfu1) sect283k1_au1PtA_X;
+            pEcc->pfu1APointY = (pfu1) sect283k1_au1PtA_Y;
+            pEcc->pfu1APointZ = (pfu1) sect283k1_au1PtA_Z;
+            pEcc->pfu1APointOrder = (pfu1) sect283k1_au1OrderPoint;
+            pEcc->pfu1Cns = (pfu1) sect283k1_au1Cns;
+            pEcc->pfu1BCurve = (pfu1) sect283k1_au1BCurve;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+        
+        case CRYPTO_CPKCL_CURVE_SECT283R1:
+            pEcc->u2ModuloPSize = sizeof(sect283r1_au1ModuloP) - 4U;
+            pEcc->u2OrderSize = sizeof(sect283r1_au1OrderPoint) - 4U;
+            pEcc->u2KeySize = SECT283_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 8. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1ModuloP = (pfu1) sect283r1_au1ModuloP;
+            pEcc->pfu1ACurve = (pfu1) sect283r1_au1ACurve;
+            pEcc->pfu1APointX = (pfu1) sect283r1_au1PtA_X;
+            pEcc->pfu1APointY = (pfu1) sect283r1_au1PtA_Y;
+            pEcc->pfu1APointZ = (pfu1) sect283r1_au1PtA_Z;
+            pEcc->pfu1APointOrder = (pfu1) sect283r1_au1OrderPoint;
+            pEcc->pfu1Cns = (pfu1) sect283r1_au1Cns;
+            pEcc->pfu1BCurve = (pfu1) sect283r1_au1BCurve;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+        
+        default:  
+            result = CRYPTO_CPKCL_RESULT_CURVE_ERROR;
+            break;
+    }
+    
+    return result;
+}
+
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_SetCustomCurve(
+    const CPKCL_ECC_CURVE_DESC *pCurve)
+{
+    if (pCurve != NULL)
+    {
+        /* Operands are whole words and the largest one is the one of P-521,
+           which the memory mappings are sized for */
+        if ((pCurve->u2ModuloPSize == 0U) || 
+            ((pCurve->u2ModuloPSize % 4U) != 0U) ||
+            (pCurve->u2ModuloPSize > CPKCL_ECC_MAX_OPERAND_SIZE) ||
+            (pCurve->u2OrderSize == 0U) || 
+            ((pCurve->u2OrderSize % 4U) != 0U) ||
+            (pCurve->u2OrderSize > CPKCL_ECC_MAX_OPERAND_SIZE) ||
+            (pCurve->u2KeySize > pCurve->u2ModuloPSize) ||
+            ((pCurve->u2KeySize + 4U) <= pCurve->u2ModuloPSize) ||
+            ((pCurve->pu1ModuloP[0] & 1U) == 0U))
+        {
+            return CRYPTO_CPKCL_RESULT_CURVE_ERROR;
+        }
+    }
+    
+    customCurve = pCurve;
+    
+    /* Constants cached for the previous custom curve are stale */
+    DRV_CRYPTO_ECC_RamInvalidate();
+    if (sqrtZCurve == CRYPTO_CPKCL_CURVE_CUSTOM)
+    {
+        sqrtZCurve = (CRYPTO_CPKCL_CURVE)0;
+    }
+    
+    return CRYPTO_CPKCL_RESULT_CURVE_SUCCESS;
+}
+
+bool DRV_CRYPTO_ECC_IsBinaryCurve(CRYPTO_CPKCL_CURVE curveType)
+{
+    return ((curveType == CRYPTO_CPKCL_CURVE_SECT233K1) 
+            || (curveType == CRYPTO_CPKCL_CURVE_SECT233R1)
+            || (curveType == CRYPTO_CPKCL_CURVE_SECT283K1)
+            || (curveType == CRYPTO_CPKCL_CURVE_SECT283R1));
+}
+
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_SetPubKeyCoordinates(CPKCL_ECC_DATA *pEcc,
+    pfu1 pubKey, pfu1 pubKeyX, pfu1 pubKeyY, CRYPTO_CPKCL_CURVE curveType)
+{
+    CRYPTO_CPKCL_RESULT result = CRYPTO_CPKCL_RESULT_CURVE_SUCCESS;
+    uint8_t i;
+    uint8_t keySize;
+    uint8_t coordSize;
+    
+    if ((pubKey[0] != 0x04U) && (pubKey[0] != 0x02U) && (pubKey[0] != 0x03U)) 
+    {
+        return CRYPTO_CPKCL_RESULT_COORD_COMPRESS_ERROR;
+    }
+
+    switch (curveType)
+    {
+        case CRYPTO_CPKCL_CURVE_P192:
+            keySize = (uint8_t)P192_PUBLIC_KEY_SIZE;
+            coordSize = (uint8_t)P192_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1PublicKeyZ = (pfu1) p192_au1PtA_Z;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+         
+        case CRYPTO_CPKCL_CURVE_P224:
+            keySize = (uint8_t)P224_PUBLIC_KEY_SIZE;
+            coordSize = (uint8_t)P224_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1PublicKeyZ = (pfu1) p224_au1PtA_Z;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+            
+        case CRYPTO_CPKCL_CURVE_P256:
+            keySize = (uint8_t)P256_PUBLIC_KEY_SIZE;
+            coordSize = (uint8_t)P256_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1PublicKeyZ = (pfu1) p256_au1PtA_Z;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;    
+        
+        case CRYPTO_CPKCL_CURVE_P384:
+            keySize = (uint8_t)P384_PUBLIC_KEY_SIZE;
+            coordSize = (uint8_t)P384_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1PublicKeyZ = (pfu1) p384_au1PtA_Z;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+            
+        case CRYPTO_CPKCL_CURVE_P521:
+            keySize = (uint8_t)P521_PUBLIC_KEY_SIZE;
+            coordSize = (uint8_t)P521_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1PublicKeyZ = (pfu1) p521_au1PtA_Z;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+        
+        case CRYPTO_CPKCL_CURVE_BP256R1:
+            keySize = (uint8_t)P256_PUBLIC_KEY_SIZE;
+            coordSize = (uint8_t)P256_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1PublicKeyZ = (pfu1) bp256r1_au1PtA_Z;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+        
+        case CRYPTO_CPKCL_CURVE_BP384R1:
+            keySize = (uint8_t)P384_PUBLIC_KEY_SIZE;
+            coordSize = (uint8_t)P384_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1PublicKeyZ = (pfu1) bp384r1_au1PtA_Z;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+        
+        case CRYPTO_CPKCL_CURVE_SECP256K1:
+            keySize = (uint8_t)P256_PUBLIC_KEY_SIZE;
+            coordSize = (uint8_t)P256_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1PublicKeyZ = (pfu1) secp256k1_au1PtA_Z;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+        
+        case CRYPTO_CPKCL_CURVE_CUSTOM:
+            keySize = (uint8_t)(2U * pEcc->u2KeySize);
+            coordSize = (uint8_t)pEcc->u2KeySize;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1PublicKeyZ = (pfu1) custom_au1PtA_Z;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+        
+        case CRYPTO_CPKCL_CURVE_SECT233K1:
+            keySize = (uint8_t)SECT233_PUBLIC_KEY_SIZE;
+            coordSize = (uint8_t)SECT233_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1PublicKeyZ = (pfu1) sect233k1_au1PtA_Z;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+        
+        case CRYPTO_CPKCL_CURVE_SECT233R1:
+            keySize = (uint8_t)SECT233_PUBLIC_KEY_SIZE;
+            coordSize = (uint8_t)SECT233_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1PublicKeyZ = (pfu1) sect233r1_au1PtA_Z;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+        
+        case CRYPTO_CPKCL_CURVE_SECT283K1:
+            keySize = (uint8_t)SECT283_PUBLIC_KEY_SIZE;
+            coordSize = (uint8_t)SECT283_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1PublicKeyZ = (pfu1) sect283k1_au1PtA_Z;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+        
+        case CRYPTO_CPKCL_CURVE_SECT283R1:
+            keySize = (uint8_t)SECT283_PUBLIC_KEY_SIZE;
+            coordSize = (uint8_t)SECT283_PUBLIC_KEY_COORDINATE_SIZE;
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.8 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_8_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.8" "H3_MISRAC_2012_R_11_8_DR_1"
+            pEcc->pfu1PublicKeyZ = (pfu1) sect283r1_au1PtA_Z;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.8"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            break;
+        
+        default:  
+            result = CRYPTO_CPKCL_RESULT_CURVE_ERROR;
+            break;
+    }
+   
+    if (result != CRYPTO_CPKCL_RESULT_CURVE_SUCCESS)
+    { 
+        return result;
+    }
+    
+    /* Compressed keys only carry X, Y is computed on the CPKCC. On a binary 
+       curve that takes solving a quadratic equation in GF(2^m), which is not
+       supported: those keys must be uncompressed. */
+    if (pubKey[0] != 0x04U)
+    {
+        if (DRV_CRYPTO_ECC_IsBinaryCurve(curveType))
+        {
+            return CRYPTO_CPKCL_RESULT_COORD_COMPRESS_ERROR;
+        }
+        return lDRV_CRYPTO_ECC_Decompress(pEcc, pubKey, pubKeyX, pubKeyY, 
+                                          coordSize);
+    }
+    
+    /* Split coordinates */
+    for (i = 0; i < keySize; i++)
+    {
+        if (i < coordSize)
+        {
+            pubKeyX[i] = pubKey[i + 1U];
+        }
+        else
+        {
+            pubKeyY[i - coordSize] = pubKey[i + 1U];
+        }
+    }
+    
+    return CRYPTO_CPKCL_RESULT_CURVE_SUCCESS;
+}
+    
+void DRV_CRYPTO_ECC_SecureCopy(pu1 pu1Dest, pu1 pu1Src, u2 u2Length)
+{   
+    u2 u2Cpt;
+    pu1 pu1PtrDest;
+
+    /* Clean out the destination */
+    (void) memset(pu1Dest, 0, u2Length);
+    
+    u2Cpt = 0;
+    pu1PtrDest = pu1Dest;
+    while (u2Cpt < u2Length) 
+    {
+        *(pu1PtrDest++) = pu1Src[u2Length - u2Cpt - 1U];
+        u2Cpt++;
+    }
+}
+
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_KeyGen(CPKCL_ECC_DATA *pEccData, 
+    pfu1 privKey, pfu1 pubKey)
+{
+    CRYPTO_CPKCL_RESULT result;
+    pu1 pu1Scalar;
+    pu1 pu1PointX;
+    pu1 pu1PointY;
+    u2 u2Cpt;
+    
+    /* Set sizes */
+    u2 u2ModuloPSize = pEccData->u2ModuloPSize;
+    u2 u2OrderSize = pEccData->u2OrderSize;
+    u2 u2KeySize = pEccData->u2KeySize;
+    
+    if (DRV_CRYPTO_ECC_IsBinaryCurve(pEccData->curveType))
+    {
+        return lDRV_CRYPTO_ECC_KeyGenGf2n(pEccData, privKey, pubKey);
+    }
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:7 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:40 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:7 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:7 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* Curve constants are skipped when the previous multiplication left them */
+    if (!DRV_CRYPTO_ECC_RamIsResident(pEccData->curveType, 
+            CRYPTO_CPKCL_RAM_SCA_MUL))
+    {
+        (void) memcpy(
+            (pu1) ((BASE_SCA_MUL_MODULO(u2ModuloPSize, u2OrderSize))), 
+            pEccData->pfu1ModuloP, u2ModuloPSize + 4U);
+        (void) memcpy(
+            (pu1) ((BASE_SCA_MUL_CNS(u2ModuloPSize, u2OrderSize))), 
+            pEccData->pfu1Cns, u2ModuloPSize + 8U);
+        (void) memcpy(
+            (pu1) ((BASE_SCA_MUL_A(u2ModuloPSize, u2OrderSize))), 
+            pEccData->pfu1ACurve, u2ModuloPSize + 4U);
+        (void) memcpy(
+            (pu1) ((BASE_SCA_MUL_ORDER(u2ModuloPSize, u2OrderSize))), 
+            pEccData->pfu1APointOrder, u2OrderSize + 4U);
+        DRV_CRYPTO_ECC_RamSetResident(pEccData->curveType, 
+            CRYPTO_CPKCL_RAM_SCA_MUL);
+    }
+    
+    pu1Scalar = (pu1) BASE_SCA_MUL_SCALAR(u2ModuloPSize, u2OrderSize);
+    pu1PointX = (pu1) BASE_SCA_MUL_POINT_A_X(u2ModuloPSize, u2OrderSize);
+    pu1PointY = (pu1) BASE_SCA_MUL_POINT_A_Y(u2ModuloPSize, u2OrderSize);
+    
+    /* The private key is drawn in place */
+    CPKCL_Rng(nu1RBase) = (nu1) BASE_SCA_MUL_SCALAR(u2ModuloPSize, u2OrderSize);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    
+    result = lDRV_CRYPTO_ECC_DrawPrivateKey(pEccData, pu1Scalar, privKey);
+    if (result != CRYPTO_CPKCL_RESULT_KEYGEN_SUCCESS)
+    {
+        return result;
+    }
+    
+    if (DRV_CRYPTO_ECC_CombIsUsed(pEccData->curveType))
+    {
+        (void) memset(pu1Scalar, 0, (size_t)u2OrderSize + 4U);
+        if (DRV_CRYPTO_ECC_PointMul(pEccData, privKey, NULL, pubKey) 
+                != CRYPTO_CPKCL_RESULT_POINT_SUCCESS)
+        {
+            (void) memset(privKey, 0, u2KeySize);
+            return CRYPTO_CPKCL_RESULT_KEYGEN_ERROR;
+        }
+        return CRYPTO_CPKCL_RESULT_KEYGEN_SUCCESS;
+    }
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:9 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:45 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:6 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:9 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* Base point, overwritten by the result */
+    (void) memcpy(
+        (pu1) ((BASE_SCA_MUL_POINT_A_X(u2ModuloPSize, u2OrderSize))), 
+        pEccData->pfu1APointX, u2ModuloPSize + 4U);
+    (void) memcpy(
+        (pu1) ((BASE_SCA_MUL_POINT_A_Y(u2ModuloPSize, u2OrderSize))), 
+        pEccData->pfu1APointY, u2ModuloPSize + 4U);
+    (void) memcpy(
+        (pu1) ((BASE_SCA_MUL_POINT_A_Z(u2ModuloPSize, u2OrderSize))), 
+        pEccData->pfu1APointZ, u2ModuloPSize + 4U);
+
+    /* Ask for the multiplication d*G */
+    CPKCL_ZpEccMul(nu1ModBase) = (nu1) BASE_SCA_MUL_MODULO(u2ModuloPSize, 
+        u2OrderSize);
+    CPKCL_ZpEccMul(nu1CnsBase) = (nu1) BASE_SCA_MUL_CNS(u2ModuloPSize, 
+        u2OrderSize);
+    CPKCL_ZpEccMul(nu1PointBase) = (nu1) BASE_SCA_MUL_POINT_A(u2ModuloPSize, 
+        u2OrderSize);
+    CPKCL_ZpEccMul(nu1ABase) = (nu1) BASE_SCA_MUL_A(u2ModuloPSize, 
+        u2OrderSize);
+    CPKCL_ZpEccMul(nu1Workspace) = (nu1) BASE_SCA_MUL_WORKSPACE(u2ModuloPSize, 
+        u2OrderSize);
+    CPKCL_ZpEccMul(nu1KBase) = (nu1) BASE_SCA_MUL_SCALAR(u2ModuloPSize, 
+        u2OrderSize);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL_ZpEccMul(u2ModLength) = u2ModuloPSize;
+    CPKCL_ZpEccMul(u2KLength) = u2ModuloPSize;
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* See CPKCL_Rc_pb.h for possible u2Status Values */
+    vCPKCL_Process(ZpEccMulFast, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    
+    /* The private key is not needed in crypto RAM anymore */
+    (void) memset(pu1Scalar, 0, (size_t)u2OrderSize + 4U);
+    
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        (void) memset(privKey, 0, u2KeySize);
+        DRV_CRYPTO_ECC_RamInvalidate();
+        return CRYPTO_CPKCL_RESULT_KEYGEN_ERROR;
+    }
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:4 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:15 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:4 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:3 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* Ask to convert coordinates */
+    CPKCL_ZpEcConvProjToAffine(nu1ModBase) = (nu1) BASE_SCA_MUL_MODULO(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_ZpEcConvProjToAffine(nu1CnsBase) = (nu1) BASE_SCA_MUL_CNS(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_ZpEcConvProjToAffine(nu1PointABase) = (nu1) BASE_SCA_MUL_POINT_A(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_ZpEcConvProjToAffine(u2ModLength) = u2ModuloPSize;
+    CPKCL_ZpEcConvProjToAffine(nu1Workspace) = (nu1) BASE_SCA_MUL_WORKSPACE(
+        u2ModuloPSize, u2OrderSize);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* See CPKCL_Rc_pb.h for possible u2Status Values */
+    vCPKCL_Process(ZpEcConvProjToAffine, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        (void) memset(privKey, 0, u2KeySize);
+        DRV_CRYPTO_ECC_RamInvalidate();
+        return CRYPTO_CPKCL_RESULT_KEYGEN_ERROR;
+    }
+    
+    /* Uncompressed public key in MSB mode */
+    pubKey[0] = 0x04U;
+    for (u2Cpt = 0U; u2Cpt < u2KeySize; u2Cpt++)
+    {
+        pubKey[1U + u2Cpt] = pu1PointX[u2KeySize - u2Cpt - 1U];
+        pubKey[1U + u2KeySize + u2Cpt] = pu1PointY[u2KeySize - u2Cpt - 1U];
+    }
+    
+    return CRYPTO_CPKCL_RESULT_KEYGEN_SUCCESS;
+}
+
+bool DRV_CRYPTO_ECC_Gf2nMul(CPKCL_ECC_DATA *pEccData)
+{
+    /* Set sizes */
+    u2 u2ModuloPSize = pEccData->u2ModuloPSize;
+    u2 u2OrderSize = pEccData->u2OrderSize;
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:11 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:60 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:8 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:11 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* Curve constants are skipped when the previous multiplication left them,
+       a and b are read together from the "a" address */
+    if (!DRV_CRYPTO_ECC_RamIsResident(pEccData->curveType, 
+            CRYPTO_CPKCL_RAM_SCA_MUL))
+    {
+        (void) memcpy(
+            (pu1) ((BASE_SCA_MUL_MODULO(u2ModuloPSize, u2OrderSize))), 
+            pEccData->pfu1ModuloP, u2ModuloPSize + 4U);
+        (void) memcpy(
+            (pu1) ((BASE_SCA_MUL_CNS(u2ModuloPSize, u2OrderSize))), 
+            pEccData->pfu1Cns, u2ModuloPSize + 8U);
+        (void) memcpy(
+            (pu1) ((BASE_SCA_MUL_A(u2ModuloPSize, u2OrderSize))), 
+            pEccData->pfu1ACurve, u2ModuloPSize + 4U);
+        (void) memcpy(
+            (pu1) ((BASE_GF2N_SCA_MUL_B(u2ModuloPSize, u2OrderSize))), 
+            pEccData->pfu1BCurve, u2ModuloPSize + 4U);
+        (void) memcpy(
+            (pu1) ((BASE_GF2N_SCA_MUL_ORDER(u2ModuloPSize, u2OrderSize))), 
+            pEccData->pfu1APointOrder, u2OrderSize + 4U);
+        DRV_CRYPTO_ECC_RamSetResident(pEccData->curveType, 
+            CRYPTO_CPKCL_RAM_SCA_MUL);
+    }
+
+    /* Ask for the multiplication k*P */
+    CPKCL_GF2NEccMul(nu1ModBase) = (nu1) BASE_SCA_MUL_MODULO(u2ModuloPSize, 
+        u2OrderSize);
+    CPKCL_GF2NEccMul(nu1CnsBase) = (nu1) BASE_SCA_MUL_CNS(u2ModuloPSize, 
+        u2OrderSize);
+    CPKCL_GF2NEccMul(nu1PointBase) = (nu1) BASE_SCA_MUL_POINT_A(u2ModuloPSize, 
+        u2OrderSize);
+    CPKCL_GF2NEccMul(nu1ABase) = (nu1) BASE_SCA_MUL_A(u2ModuloPSize, 
+        u2OrderSize);
+    CPKCL_GF2NEccMul(nu1Workspace) = (nu1) BASE_GF2N_SCA_MUL_WORKSPACE(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_GF2NEccMul(nu1KBase) = (nu1) BASE_GF2N_SCA_MUL_SCALAR(u2ModuloPSize, 
+        u2OrderSize);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL_GF2NEccMul(u2ModLength) = u2ModuloPSize;
+    CPKCL_GF2NEccMul(u2KLength) = u2ModuloPSize;
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* See CPKCL_Rc_pb.h for possible u2Status Values */
+    vCPKCL_Process(GF2NEccMulFast, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:1 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:7 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* The scalar is not needed in crypto RAM anymore */
+    (void) memset(
+        (pu1) ((BASE_GF2N_SCA_MUL_SCALAR(u2ModuloPSize, u2OrderSize))), 
+        0, (size_t)u2OrderSize + 4U);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        DRV_CRYPTO_ECC_RamInvalidate();
+        return false;
+    }
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:4 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:17 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:4 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:3 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* Ask to convert coordinates */
+    CPKCL_GF2NEcConvProjToAffine(nu1ModBase) = (nu1) BASE_SCA_MUL_MODULO(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_GF2NEcConvProjToAffine(nu1CnsBase) = (nu1) BASE_SCA_MUL_CNS(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_GF2NEcConvProjToAffine(nu1PointABase) = (nu1) BASE_SCA_MUL_POINT_A(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_GF2NEcConvProjToAffine(u2ModLength) = u2ModuloPSize;
+    CPKCL_GF2NEcConvProjToAffine(nu1Workspace) = (nu1) 
+        BASE_GF2N_SCA_MUL_WORKSPACE(u2ModuloPSize, u2OrderSize);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* See CPKCL_Rc_pb.h for possible u2Status Values */
+    vCPKCL_Process(GF2NEcConvProjToAffine, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        DRV_CRYPTO_ECC_RamInvalidate();
+        return false;
+    }
+    
+    return true;
+}
+
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_PointMul(CPKCL_ECC_DATA *pEccData, 
+    pfu1 scalar, pfu1 point, pfu1 result)
+{
+    pu1 pu1Scalar;
+    pu1 pu1Point;
+    u1 u1NonZero = 0U;
     u2 u2Cpt;
-    pu1 pu1PtrDest;
+    
+    /* Set sizes */
+    u2 u2ModuloPSize = pEccData->u2ModuloPSize;
+    u2 u2OrderSize = pEccData->u2OrderSize;
+    u2 u2KeySize = pEccData->u2KeySize;
+    
+    if (DRV_CRYPTO_ECC_IsBinaryCurve(pEccData->curveType))
+    {
+        return CRYPTO_CPKCL_RESULT_POINT_ERROR;
+    }
+    
+    for (u2Cpt = 0U; u2Cpt < u2KeySize; u2Cpt++)
+    {
+        u1NonZero |= scalar[u2Cpt];
+    }
+    if (u1NonZero == 0U)
+    {
+        return CRYPTO_CPKCL_RESULT_POINT_INFINITY;
+    }
+    
+    /* The comb additions are not complete, the rare k for which one of them
+       meets equal points runs on the CPKCL multiplication below */
+    if ((point == NULL) && DRV_CRYPTO_ECC_CombIsUsed(pEccData->curveType))
+    {
+        if (lDRV_CRYPTO_ECC_CombMul(pEccData, 
+                DRV_CRYPTO_ECC_GetCombTable(pEccData->curveType), scalar, 
+                result) == CRYPTO_CPKCL_RESULT_POINT_SUCCESS)
+        {
+            return CRYPTO_CPKCL_RESULT_POINT_SUCCESS;
+        }
+        DRV_CRYPTO_ECC_RamInvalidate();
+    }
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:14 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:80 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:14 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:14 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* Curve constants are skipped when the previous multiplication left them */
+    if (!DRV_CRYPTO_ECC_RamIsResident(pEccData->curveType, 
+            CRYPTO_CPKCL_RAM_SCA_MUL))
+    {
+        (void) memcpy(
+            (pu1) ((BASE_SCA_MUL_MODULO(u2ModuloPSize, u2OrderSize))), 
+            pEccData->pfu1ModuloP, u2ModuloPSize + 4U);
+        (void) memcpy(
+            (pu1) ((BASE_SCA_MUL_CNS(u2ModuloPSize, u2OrderSize))), 
+            pEccData->pfu1Cns, u2ModuloPSize + 8U);
+        (void) memcpy(
+            (pu1) ((BASE_SCA_MUL_A(u2ModuloPSize, u2OrderSize))), 
+            pEccData->pfu1ACurve, u2ModuloPSize + 4U);
+        (void) memcpy(
+            (pu1) ((BASE_SCA_MUL_ORDER(u2ModuloPSize, u2OrderSize))), 
+            pEccData->pfu1APointOrder, u2OrderSize + 4U);
+        DRV_CRYPTO_ECC_RamSetResident(pEccData->curveType, 
+            CRYPTO_CPKCL_RAM_SCA_MUL);
+    }
+    
+    pu1Scalar = (pu1) BASE_SCA_MUL_SCALAR(u2ModuloPSize, u2OrderSize);
+    pu1Point = (pu1) BASE_SCA_MUL_POINT_A(u2ModuloPSize, u2OrderSize);
+    
+    CPKCL_ZpEccMul(nu1ModBase) = (nu1) BASE_SCA_MUL_MODULO(u2ModuloPSize, 
+        u2OrderSize);
+    CPKCL_ZpEccMul(nu1CnsBase) = (nu1) BASE_SCA_MUL_CNS(u2ModuloPSize, 
+        u2OrderSize);
+    CPKCL_ZpEccMul(nu1PointBase) = (nu1) BASE_SCA_MUL_POINT_A(u2ModuloPSize, 
+        u2OrderSize);
+    CPKCL_ZpEccMul(nu1ABase) = (nu1) BASE_SCA_MUL_A(u2ModuloPSize, 
+        u2OrderSize);
+    CPKCL_ZpEccMul(nu1Workspace) = (nu1) BASE_SCA_MUL_WORKSPACE(u2ModuloPSize, 
+        u2OrderSize);
+    CPKCL_ZpEccMul(nu1KBase) = (nu1) BASE_SCA_MUL_SCALAR(u2ModuloPSize, 
+        u2OrderSize);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL_ZpEccMul(u2ModLength) = u2ModuloPSize;
+    CPKCL_ZpEccMul(u2KLength) = u2ModuloPSize;
+    
+    /* Scalar in LSB mode, the point overwritten by the result */
+    (void) memset(pu1Scalar, 0, (size_t)u2OrderSize + 4U);
+    for (u2Cpt = 0U; u2Cpt < u2KeySize; u2Cpt++)
+    {
+        pu1Scalar[u2Cpt] = scalar[u2KeySize - u2Cpt - 1U];
+    }
+    lDRV_CRYPTO_ECC_PointLoad(pEccData, pu1Point, point);
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* See CPKCL_Rc_pb.h for possible u2Status Values */
+    vCPKCL_Process(ZpEccMulFast, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    
+    /* The scalar is not needed in crypto RAM anymore */
+    (void) memset(pu1Scalar, 0, (size_t)u2OrderSize + 4U);
+    
+    if ((CPKCL(u2Status) == (unsigned)CPKCL_POINT_AT_INFINITY) || 
+        ((CPKCL(u2Status) == (unsigned)CPKCL_OK) && 
+         lDRV_CRYPTO_ECC_PointIsInfinity(pu1Point, u2ModuloPSize)))
+    {
+        return CRYPTO_CPKCL_RESULT_POINT_INFINITY;
+    }
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        DRV_CRYPTO_ECC_RamInvalidate();
+        return CRYPTO_CPKCL_RESULT_POINT_ERROR;
+    }
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:4 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:15 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:4 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:3 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* Ask to convert coordinates */
+    CPKCL_ZpEcConvProjToAffine(nu1ModBase) = (nu1) BASE_SCA_MUL_MODULO(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_ZpEcConvProjToAffine(nu1CnsBase) = (nu1) BASE_SCA_MUL_CNS(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_ZpEcConvProjToAffine(nu1PointABase) = (nu1) BASE_SCA_MUL_POINT_A(
+        u2ModuloPSize, u2OrderSize);
+    CPKCL_ZpEcConvProjToAffine(u2ModLength) = u2ModuloPSize;
+    CPKCL_ZpEcConvProjToAffine(nu1Workspace) = (nu1) BASE_SCA_MUL_WORKSPACE(
+        u2ModuloPSize, u2OrderSize);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* See CPKCL_Rc_pb.h for possible u2Status Values */
+    vCPKCL_Process(ZpEcConvProjToAffine, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        DRV_CRYPTO_ECC_RamInvalidate();
+        return CRYPTO_CPKCL_RESULT_POINT_ERROR;
+    }
+    
+    lDRV_CRYPTO_ECC_PointStore(pEccData, result, pu1Point);
+    
+    return CRYPTO_CPKCL_RESULT_POINT_SUCCESS;
+}
 
-    /* Clean out the destination */
-    (void) memset(pu1Dest, 0, u2Length);
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_PointAdd(CPKCL_ECC_DATA *pEccData, 
+    pfu1 pointA, pfu1 pointB, pfu1 result)
+{
+    CRYPTO_CPKCL_RESULT status;
+    pu1 pu1Sum;
+    u1 u1YNonZero = 0U;
+    u2 u2Cpt;
     
-    u2Cpt = 0;
-    pu1PtrDest = pu1Dest;
-    while (u2Cpt < u2Length) 
+    /* Set sizes */
+    u2 u2ModuloPSize = pEccData->u2ModuloPSize;
+    u2 u2KeySize = pEccData->u2KeySize;
+    
+    if (DRV_CRYPTO_ECC_IsBinaryCurve(pEccData->curveType))
     {
-        *(pu1PtrDest++) = pu1Src[u2Length - u2Cpt - 1U];
-        u2Cpt++;
+        return CRYPTO_CPKCL_RESULT_POINT_ERROR;
+    }
+    
+    lDRV_CRYPTO_ECC_PointSetup(pEccData);
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:8 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:2 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:2 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    pu1Sum = (pu1) BASE_POINT_SLOT(u2ModuloPSize, 0U);
+    lDRV_CRYPTO_ECC_PointLoad(pEccData, pu1Sum, pointA);
+    lDRV_CRYPTO_ECC_PointLoad(pEccData, 
+        (pu1) BASE_POINT_SLOT(u2ModuloPSize, 1U), pointB);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    
+    /* The addition formulas do not take equal abscissas: the points are 
+       either equal, and doubled, or opposite */
+    if (memcmp(&pointA[1], &pointB[1], u2KeySize) != 0)
+    {
+        status = lDRV_CRYPTO_ECC_PointAddSlots(pEccData, 0U, 1U);
+    }
+    else if (memcmp(&pointA[1U + u2KeySize], &pointB[1U + u2KeySize], 
+                u2KeySize) != 0)
+    {
+        return CRYPTO_CPKCL_RESULT_POINT_INFINITY;
+    }
+    else
+    {
+        for (u2Cpt = 0U; u2Cpt < u2KeySize; u2Cpt++)
+        {
+            u1YNonZero |= pointA[1U + u2KeySize + u2Cpt];
+        }
+        if (u1YNonZero == 0U)
+        {
+            return CRYPTO_CPKCL_RESULT_POINT_INFINITY;
+        }
+        status = lDRV_CRYPTO_ECC_PointDbl(pEccData, 0U);
+    }
+    
+    if ((status != CRYPTO_CPKCL_RESULT_POINT_SUCCESS) || 
+        !lDRV_CRYPTO_ECC_PointToAffine(pEccData, 0U))
+    {
+        DRV_CRYPTO_ECC_RamInvalidate();
+        return CRYPTO_CPKCL_RESULT_POINT_ERROR;
+    }
+    
+    lDRV_CRYPTO_ECC_PointStore(pEccData, result, pu1Sum);
+    
+    return CRYPTO_CPKCL_RESULT_POINT_SUCCESS;
+}
+
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_DualMul(CPKCL_ECC_DATA *pEccData, 
+    pfu1 scalar1, pfu1 point1, pfu1 scalar2, pfu1 point2, pfu1 result)
+{
+    CRYPTO_CPKCL_RESULT status = CRYPTO_CPKCL_RESULT_POINT_SUCCESS;
+    pu1 pu1Acc;
+    pu1 pu1Slot1;
+    pu1 pu1Slot3;
+    bool accEmpty = true;
+    u1 u1Digit;
+    u2 u2Bit;
+    
+    /* Set sizes */
+    u2 u2ModuloPSize = pEccData->u2ModuloPSize;
+    u2 u2KeySize = pEccData->u2KeySize;
+    size_t pointSize = (3U * (size_t)u2ModuloPSize) + 12U;
+    
+    if (DRV_CRYPTO_ECC_IsBinaryCurve(pEccData->curveType))
+    {
+        return CRYPTO_CPKCL_RESULT_POINT_ERROR;
+    }
+    
+    lDRV_CRYPTO_ECC_PointSetup(pEccData);
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:4 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:16 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:4 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:4 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    pu1Acc = (pu1) BASE_POINT_SLOT(u2ModuloPSize, 0U);
+    pu1Slot1 = (pu1) BASE_POINT_SLOT(u2ModuloPSize, 1U);
+    pu1Slot3 = (pu1) BASE_POINT_SLOT(u2ModuloPSize, 3U);
+    
+    /* Table of the non-zero bit pairs: P1, P2 and P1 + P2 */
+    lDRV_CRYPTO_ECC_PointLoad(pEccData, pu1Slot1, point1);
+    lDRV_CRYPTO_ECC_PointLoad(pEccData, 
+        (pu1) BASE_POINT_SLOT(u2ModuloPSize, 2U), point2);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    (void) memcpy(pu1Slot3, pu1Slot1, pointSize);
+    status = lDRV_CRYPTO_ECC_PointAddSlots(pEccData, 3U, 2U);
+    
+    /* Scan the bits of both scalars together from the top: one doubling per
+       bit once the accumulator holds a point, and one addition per non-zero
+       pair, the first one being a copy */
+    u2Bit = 8U * u2KeySize;
+    while ((status == CRYPTO_CPKCL_RESULT_POINT_SUCCESS) && (u2Bit > 0U))
+    {
+        u2Bit--;
+        
+        if (!accEmpty)
+        {
+            status = lDRV_CRYPTO_ECC_PointDbl(pEccData, 0U);
+        }
+        
+        u1Digit = (u1) (lDRV_CRYPTO_ECC_ScalarBit(scalar1, u2KeySize, u2Bit) 
+            | (u1) (lDRV_CRYPTO_ECC_ScalarBit(scalar2, u2KeySize, u2Bit) << 1U));
+        if ((status != CRYPTO_CPKCL_RESULT_POINT_SUCCESS) || (u1Digit == 0U))
+        {
+            continue;
+        }
+        
+        if (accEmpty)
+        {
+            (void) memcpy(pu1Acc, &pu1Slot1[((size_t)u1Digit - 1U) * pointSize],
+                pointSize);
+            accEmpty = false;
+        }
+        else
+        {
+            status = lDRV_CRYPTO_ECC_PointAddSlots(pEccData, 0U, u1Digit);
+        }
+    }
+    
+    if (status == CRYPTO_CPKCL_RESULT_POINT_ERROR)
+    {
+        DRV_CRYPTO_ECC_RamInvalidate();
+        return status;
+    }
+    if (status != CRYPTO_CPKCL_RESULT_POINT_SUCCESS)
+    {
+        return status;
+    }
+    if (accEmpty)
+    {
+        /* Both scalars are 0 */
+        return CRYPTO_CPKCL_RESULT_POINT_INFINITY;
+    }
+    
+    if (!lDRV_CRYPTO_ECC_PointToAffine(pEccData, 0U))
+    {
+        DRV_CRYPTO_ECC_RamInvalidate();
+        return CRYPTO_CPKCL_RESULT_POINT_ERROR;
+    }
+    
+    lDRV_CRYPTO_ECC_PointStore(pEccData, result, pu1Acc);
+    
+    return CRYPTO_CPKCL_RESULT_POINT_SUCCESS;
+}
+
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_MulStart(CPKCL_ECC_DATA *pEccData, 
+    CPKCL_ECC_MUL_CTX *pMul, pfu1 scalar1, pfu1 point1, pfu1 scalar2, 
+    pfu1 point2)
+{
+    u1 u1NonZero = 0U;
+    u2 u2Cpt;
+    
+    /* Set sizes */
+    u2 u2KeySize = pEccData->u2KeySize;
+    size_t pointSize = (3U * (size_t)pEccData->u2ModuloPSize) + 12U;
+    
+    (void) memset(pMul, 0, sizeof(CPKCL_ECC_MUL_CTX));
+    
+    if (DRV_CRYPTO_ECC_IsBinaryCurve(pEccData->curveType))
+    {
+        return CRYPTO_CPKCL_RESULT_POINT_ERROR;
+    }
+    
+    /* The points go to the context in the crypto RAM format, the first call
+       of DRV_CRYPTO_ECC_MulContinue copies them to their slots */
+    if (scalar2 == NULL)
+    {
+        for (u2Cpt = 0U; u2Cpt < u2KeySize; u2Cpt++)
+        {
+            u1NonZero |= scalar1[u2Cpt];
+        }
+        if (u1NonZero == 0U)
+        {
+            return CRYPTO_CPKCL_RESULT_POINT_INFINITY;
+        }
+        
+        /* The top bit is set, the accumulator starts at P. Slot 2 is 
+           written before each addition and needs no saving. */
+        pMul->u2Bit = lDRV_CRYPTO_ECC_RegularScalar(pEccData, 
+            pMul->au1Scalar1, scalar1);
+        lDRV_CRYPTO_ECC_PointLoad(pEccData, &pMul->au1Slots[pointSize], 
+            point1);
+        (void) memcpy(pMul->au1Slots, &pMul->au1Slots[pointSize], pointSize);
+        pMul->regular = true;
+        pMul->u1Slots = 2U;
+    }
+    else
+    {
+        (void) memcpy(&pMul->au1Scalar1[1], scalar1, u2KeySize);
+        (void) memcpy(&pMul->au1Scalar2[1], scalar2, u2KeySize);
+        lDRV_CRYPTO_ECC_PointLoad(pEccData, &pMul->au1Slots[pointSize], 
+            point1);
+        lDRV_CRYPTO_ECC_PointLoad(pEccData, &pMul->au1Slots[2U * pointSize], 
+            point2);
+        (void) memcpy(&pMul->au1Slots[3U * pointSize], 
+            &pMul->au1Slots[pointSize], pointSize);
+        pMul->u2Bit = 8U * u2KeySize;
+        pMul->accEmpty = true;
+        pMul->u1Slots = 4U;
+    }
+    
+    return CRYPTO_CPKCL_RESULT_POINT_IN_PROGRESS;
+}
+
+CRYPTO_CPKCL_RESULT DRV_CRYPTO_ECC_MulContinue(CPKCL_ECC_DATA *pEccData, 
+    CPKCL_ECC_MUL_CTX *pMul, u2 u2MaxBits, pfu1 result)
+{
+    CRYPTO_CPKCL_RESULT status = CRYPTO_CPKCL_RESULT_POINT_IN_PROGRESS;
+    bool regular = pMul->regular;
+    bool ended = false;
+    pu1 pu1Acc;
+    u2 u2Steps = 0U;
+    
+    /* Set sizes */
+    u2 u2ModuloPSize = pEccData->u2ModuloPSize;
+    size_t pointSize = (3U * (size_t)u2ModuloPSize) + 12U;
+    
+    if (pMul->u1Slots == 0U)
+    {
+        return CRYPTO_CPKCL_RESULT_POINT_ERROR;
+    }
+    
+    /* The crypto RAM may have been used since the last call */
+    lDRV_CRYPTO_ECC_PointSetup(pEccData);
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:1 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:4 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    pu1Acc = (pu1) BASE_POINT_SLOT(u2ModuloPSize, 0U);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    (void) memcpy(pu1Acc, pMul->au1Slots, (size_t)pMul->u1Slots * pointSize);
+    
+    while ((status == CRYPTO_CPKCL_RESULT_POINT_IN_PROGRESS) && 
+        (u2Steps < u2MaxBits))
+    {
+        u2Steps++;
+        
+        if (!regular && !pMul->tableReady)
+        {
+            /* P1 = -P2 leaves Z = 0 in slot 3 */
+            status = lDRV_CRYPTO_ECC_PointAddFull(pEccData, 3U, 2U);
+            if (status == CRYPTO_CPKCL_RESULT_POINT_INFINITY)
+            {
+                status = CRYPTO_CPKCL_RESULT_POINT_SUCCESS;
+            }
+            pMul->tableReady = true;
+        }
+        else if (pMul->u2Bit > 0U)
+        {
+            pMul->u2Bit--;
+            status = regular ? 
+                lDRV_CRYPTO_ECC_MulRegularBit(pEccData, pMul, pu1Acc) : 
+                lDRV_CRYPTO_ECC_MulDualBit(pEccData, pMul, pu1Acc);
+        }
+        else
+        {
+            status = lDRV_CRYPTO_ECC_MulEnd(pEccData, pMul, pu1Acc, result);
+            ended = true;
+        }
+        
+        if ((status == CRYPTO_CPKCL_RESULT_POINT_SUCCESS) && !ended)
+        {
+            status = CRYPTO_CPKCL_RESULT_POINT_IN_PROGRESS;
+        }
+    }
+    
+    if (status == CRYPTO_CPKCL_RESULT_POINT_IN_PROGRESS)
+    {
+        (void) memcpy(pMul->au1Slots, pu1Acc, 
+            (size_t)pMul->u1Slots * pointSize);
+    }
+    else
+    {
+        if (status == CRYPTO_CPKCL_RESULT_POINT_ERROR)
+        {
+            DRV_CRYPTO_ECC_RamInvalidate();
+        }
+        (void) memset(pMul, 0, sizeof(CPKCL_ECC_MUL_CTX));
+    }
+    
+    if (regular)
+    {
+        /* The accumulator and its copy depend on k */
+        (void) memset(pu1Acc, 0, 3U * pointSize);
     }
+    
+    return status;
+}
+
+void DRV_CRYPTO_ECC_SetCombEnabled(bool enable)
+{
+    combEnabled = enable;
+}
+
+bool DRV_CRYPTO_ECC_CombIsUsed(CRYPTO_CPKCL_CURVE curveType)
+{
+    return (combEnabled && (DRV_CRYPTO_ECC_GetCombTable(curveType) != NULL));
+}
+
+bool DRV_CRYPTO_ECC_RamIsResident(CRYPTO_CPKCL_CURVE curveType,
+    CRYPTO_CPKCL_RAM_LAYOUT layout)
+{
+    return ((layout != CRYPTO_CPKCL_RAM_NONE) && (ramLayout == layout) 
+            && (ramCurve == curveType));
+}
+
+void DRV_CRYPTO_ECC_RamSetResident(CRYPTO_CPKCL_CURVE curveType,
+    CRYPTO_CPKCL_RAM_LAYOUT layout)
+{
+    ramCurve = curveType;
+    ramLayout = layout;
+}
+
+void DRV_CRYPTO_ECC_RamInvalidate(void)
+{
+    ramCurve = (CRYPTO_CPKCL_CURVE)0;
+    ramLayout = CRYPTO_CPKCL_RAM_NONE;
 }
@@ -59,14 +59,89 @@ Microchip or any third party.
 // *****************************************************************************
 // *****************************************************************************
 
-// All buffers maximum size
-static u1 sharedKeyX[P521_PUBLIC_KEY_COORDINATE_SIZE];    
-static u1 sharedKeyY[P521_PUBLIC_KEY_COORDINATE_SIZE];     
+// All buffers maximum operand size + 4
+static u1 sharedKeyX[CPKCL_ECC_MAX_OPERAND_SIZE + 4];    
+static u1 sharedKeyY[CPKCL_ECC_MAX_OPERAND_SIZE + 4];     
+static u1 pubKeyX[CPKCL_ECC_MAX_OPERAND_SIZE + 4];  
+static u1 pubKeyY[CPKCL_ECC_MAX_OPERAND_SIZE + 4]; 
+static u1 privateKey[CPKCL_ECC_MAX_OPERAND_SIZE + 4];
 
-// All buffers maximum size + 4
-static u1 pubKeyX[P521_PUBLIC_KEY_COORDINATE_SIZE + 4];  
-static u1 pubKeyY[P521_PUBLIC_KEY_COORDINATE_SIZE + 4]; 
-static u1 privateKey[P521_PUBLIC_KEY_COORDINATE_SIZE + 4];
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+/* DRV_CRYPTO_ECDH_GetSharedKey on a binary curve */
+static CRYPTO_ECDH_RESULT lDRV_CRYPTO_ECDH_GetSharedKeyGf2n(
+    CPKCL_ECC_DATA *pEccData, pfu1 sharedKey)
+{
+    /* Set sizes */
+    u2 u2ModuloPSize = pEccData->u2ModuloPSize;
+    u2 u2OrderSize = pEccData->u2OrderSize;
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:4 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:28 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:4 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:4 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* The point is overwritten by the result, load it every time. The curve
+       constants are loaded by the multiplication. */
+    DRV_CRYPTO_ECC_SecureCopy(
+        (pu1) ((BASE_GF2N_SCA_MUL_SCALAR(u2ModuloPSize, u2OrderSize))), 
+        pEccData->pfu1PrivateKey, u2OrderSize + 4U);
+    DRV_CRYPTO_ECC_SecureCopy(
+        (pu1) ((BASE_SCA_MUL_POINT_A_X(u2ModuloPSize, u2OrderSize))), 
+        pEccData->pfu1PublicKeyX, u2ModuloPSize + 4U);
+    DRV_CRYPTO_ECC_SecureCopy(
+        (pu1) ((BASE_SCA_MUL_POINT_A_Y(u2ModuloPSize, u2OrderSize))), 
+        pEccData->pfu1PublicKeyY, u2ModuloPSize + 4U);
+    (void) memcpy(
+        (pu1) ((BASE_SCA_MUL_POINT_A_Z(u2ModuloPSize, u2OrderSize))), 
+        pEccData->pfu1PublicKeyZ, u2ModuloPSize + 4U);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    
+    if (!DRV_CRYPTO_ECC_Gf2nMul(pEccData))
+    {
+        return CRYPTO_ECDH_RESULT_ERROR_FAIL;
+    }
+    
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 20.7 deviated below. Deviation record ID - 
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:1 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:3 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* Copy the result, the shared secret is the abscissa */
+    DRV_CRYPTO_ECC_SecureCopy(sharedKeyX,
+        (pu1) ((BASE_SCA_MUL_POINT_A(u2ModuloPSize, u2OrderSize))),
+                u2ModuloPSize + 4U);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+
+    /* Remove empty first four bytes and the operand rounding */  
+    (void) memcpy(sharedKey, 
+                  &sharedKeyX[4U + u2ModuloPSize - pEccData->u2KeySize], 
+                  pEccData->u2KeySize);
+    
+    return CRYPTO_ECDH_RESULT_SUCCESS;
+}
 
 // *****************************************************************************
 // *****************************************************************************
@@ -79,8 +154,8 @@ CRYPTO_ECDH_RESULT DRV_CRYPTO_ECDH_InitEccParams(CPKCL_ECC_DATA *pEccData,
 {
     CRYPTO_CPKCL_RESULT result;
     
-    /* Initialize CPKCL */
-    result = DRV_CRYPTO_ECC_InitCpkcl();
+    /* Check the CPKCL is initialized and its self test passed */
+    result = DRV_CRYPTO_ECC_CheckCpkcl();
     if (result != CRYPTO_CPKCL_RESULT_INIT_SUCCESS) 
     {
         return CRYPTO_ECDH_RESULT_INIT_FAIL;
@@ -96,8 +171,10 @@ CRYPTO_ECDH_RESULT DRV_CRYPTO_ECDH_InitEccParams(CPKCL_ECC_DATA *pEccData,
     /* Get coordinates of public key */
     (void) memset(pubKeyX, 0, sizeof(pubKeyX));
     (void) memset(pubKeyY, 0, sizeof(pubKeyY));
-    result = DRV_CRYPTO_ECC_SetPubKeyCoordinates(pEccData, pubKey, &pubKeyX[4], 
-                                                 &pubKeyY[4], eccCurveType);
+    result = DRV_CRYPTO_ECC_SetPubKeyCoordinates(pEccData, pubKey, 
+        &pubKeyX[4U + pEccData->u2ModuloPSize - pEccData->u2KeySize], 
+        &pubKeyY[4U + pEccData->u2ModuloPSize - pEccData->u2KeySize], 
+        eccCurveType);
     if (result == CRYPTO_CPKCL_RESULT_CURVE_ERROR)
     {
         return CRYPTO_ECDH_RESULT_ERROR_CURVE;
@@ -114,9 +191,16 @@ CRYPTO_ECDH_RESULT DRV_CRYPTO_ECDH_InitEccParams(CPKCL_ECC_DATA *pEccData,
     pEccData->pfu1PublicKeyX = (pfu1) pubKeyX;
     pEccData->pfu1PublicKeyY = (pfu1) pubKeyY;
     
-    /* Store private key locally, leaving first 4 bytes empty  */
+    if (privKeyLen > pEccData->u2KeySize)
+    {
+        return CRYPTO_ECDH_RESULT_ERROR_FAIL;
+    }
+    
+    /* Store private key locally, leaving first 4 bytes empty and right 
+       aligned on the operand size */
     (void) memset(privateKey, 0, sizeof(privateKey));
-    (void) memcpy(&privateKey[4], privKey, privKeyLen);
+    (void) memcpy(&privateKey[4U + pEccData->u2OrderSize - privKeyLen], 
+                  privKey, privKeyLen);
     pEccData->pfu1PrivateKey = (pfu1) privateKey;
     
     return CRYPTO_ECDH_RESULT_SUCCESS;
@@ -129,6 +213,11 @@ CRYPTO_ECDH_RESULT DRV_CRYPTO_ECDH_GetSharedKey(CPKCL_ECC_DATA *pEccData,
     u2 u2ModuloPSize = pEccData->u2ModuloPSize;
     u2 u2OrderSize = pEccData->u2OrderSize;
 
+    if (DRV_CRYPTO_ECC_IsBinaryCurve(pEccData->curveType))
+    {
+        return lDRV_CRYPTO_ECDH_GetSharedKeyGf2n(pEccData, sharedKey);
+    }
+
     /* MISRA C-2012 deviation block start */
     /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID - 
        H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
@@ -139,13 +228,27 @@ CRYPTO_ECDH_RESULT DRV_CRYPTO_ECDH_GetSharedKey(CPKCL_ECC_DATA *pEccData,
 (deviate:63 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
 (deviate:6 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
 (deviate:12 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
-    /* Copy parameters for ECDH in memory areas */
-    DRV_CRYPTO_ECC_SecureCopy(
-        (pu1) ((BASE_SCA_MUL_MODULO(u2ModuloPSize, u2OrderSize))), 
-        pEccData->pfu1ModuloP, u2ModuloPSize + 4U);
-    DRV_CRYPTO_ECC_SecureCopy(
-        (pu1) ((BASE_SCA_MUL_CNS(u2ModuloPSize, u2OrderSize))), 
-        pEccData->pfu1Cns, u2ModuloPSize + 8U);
+    /* Curve constants are skipped when the previous multiplication left them */
+    if (!DRV_CRYPTO_ECC_RamIsResident(pEccData->curveType, 
+            CRYPTO_CPKCL_RAM_SCA_MUL))
+    {
+        (void) memcpy(
+            (pu1) ((BASE_SCA_MUL_MODULO(u2ModuloPSize, u2OrderSize))), 
+            pEccData->pfu1ModuloP, u2ModuloPSize + 4U);
+        (void) memcpy(
+            (pu1) ((BASE_SCA_MUL_CNS(u2ModuloPSize, u2OrderSize))), 
+            pEccData->pfu1Cns, u2ModuloPSize + 8U);
+        (void) memcpy(
+            (pu1) ((BASE_SCA_MUL_A(u2ModuloPSize, u2OrderSize))), 
+            pEccData->pfu1ACurve, u2ModuloPSize + 4U);
+        (void) memcpy(
+            (pu1) ((BASE_SCA_MUL_ORDER(u2ModuloPSize, u2OrderSize))), 
+            pEccData->pfu1APointOrder, u2OrderSize + 4U);
+        DRV_CRYPTO_ECC_RamSetResident(pEccData->curveType, 
+            CRYPTO_CPKCL_RAM_SCA_MUL);
+    }
+
+    /* The point is overwritten by the result, load it every time */
     DRV_CRYPTO_ECC_SecureCopy(
         (pu1) ((BASE_SCA_MUL_SCALAR(u2ModuloPSize, u2OrderSize))), 
         pEccData->pfu1PrivateKey, u2OrderSize + 4U);
@@ -155,15 +258,9 @@ CRYPTO_ECDH_RESULT DRV_CRYPTO_ECDH_GetSharedKey(CPKCL_ECC_DATA *pEccData,
     DRV_CRYPTO_ECC_SecureCopy(
         (pu1) ((BASE_SCA_MUL_POINT_A_Y(u2ModuloPSize, u2OrderSize))), 
         pEccData->pfu1PublicKeyY, u2ModuloPSize + 4U);
-    DRV_CRYPTO_ECC_SecureCopy(
+    (void) memcpy(
         (pu1) ((BASE_SCA_MUL_POINT_A_Z(u2ModuloPSize, u2OrderSize))), 
         pEccData->pfu1PublicKeyZ, u2ModuloPSize + 4U);
-    DRV_CRYPTO_ECC_SecureCopy(
-        (pu1) ((BASE_SCA_MUL_A(u2ModuloPSize, u2OrderSize))), 
-        pEccData->pfu1ACurve, u2ModuloPSize + 4U);
-    DRV_CRYPTO_ECC_SecureCopy(
-        (pu1) ((BASE_SCA_MUL_ORDER(u2ModuloPSize, u2OrderSize))), 
-        pEccData->pfu1APointOrder, u2OrderSize + 4U);
 
     /* Ask for a key generation */
     CPKCL_ZpEccMul(nu1ModBase) = (nu1) BASE_SCA_MUL_MODULO(u2ModuloPSize, 
@@ -206,6 +303,7 @@ CRYPTO_ECDH_RESULT DRV_CRYPTO_ECDH_GetSharedKey(CPKCL_ECC_DATA *pEccData,
     /* MISRA C-2012 deviation block end */
     if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
     {
+        DRV_CRYPTO_ECC_RamInvalidate();
         return CRYPTO_ECDH_RESULT_ERROR_FAIL;
     }
 	
@@ -255,6 +353,7 @@ CRYPTO_ECDH_RESULT DRV_CRYPTO_ECDH_GetSharedKey(CPKCL_ECC_DATA *pEccData,
     /* MISRA C-2012 deviation block end */
     if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
     {
+        DRV_CRYPTO_ECC_RamInvalidate();
         return CRYPTO_ECDH_RESULT_ERROR_FAIL;
     }
 	
@@ -280,8 +379,10 @@ CRYPTO_ECDH_RESULT DRV_CRYPTO_ECDH_GetSharedKey(CPKCL_ECC_DATA *pEccData,
 #pragma GCC diagnostic pop
     /* MISRA C-2012 deviation block end */
 
-    /* Remove empty first four bytes */  
-    (void) memcpy(sharedKey, &sharedKeyX[4], u2OrderSize);
+    /* Remove empty first four bytes and the operand rounding */  
+    (void) memcpy(sharedKey, 
+                  &sharedKeyX[4U + u2ModuloPSize - pEccData->u2KeySize], 
+                  pEccData->u2KeySize);
     
     return CRYPTO_ECDH_RESULT_SUCCESS;
 }
@@ -0,0 +1,691 @@
+/**************************************************************************
+  Crypto Framework Library Header
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    drv_crypto_mp_hw_cpkcl.c
+
+  Summary:
+    Crypto Framework Library source for the CPKCC multi-precision
+    arithmetic.
+
+  Description:
+    This source contains the function code for the CPKCC modular
+    multiplication, reduction, exponentiation and inversion.
+**************************************************************************/
+
+//DOM-IGNORE-BEGIN
+/*
+Copyright (C) 2024, Microchip Technology Inc., and its subsidiaries. All rights reserved.
+
+The software and documentation is provided by microchip and its contributors
+"as is" and any express, implied or statutory warranties, including, but not
+limited to, the implied warranties of merchantability, fitness for a particular
+purpose and non-infringement of third party intellectual property rights are
+disclaimed to the fullest extent permitted by law. In no event shall microchip
+or its contributors be liable for any direct, indirect, incidental, special,
+exemplary, or consequential damages (including, but not limited to, procurement
+of substitute goods or services; loss of use, data, or profits; or business
+interruption) however caused and on any theory of liability, whether in contract,
+strict liability, or tort (including negligence or otherwise) arising in any way
+out of the use of the software and documentation, even if advised of the
+possibility of such damage.
+
+Except as expressly permitted hereunder and subject to the applicable license terms
+for any third-party software incorporated in the software and any applicable open
+source software license terms, no license or other rights, whether express or
+implied, are granted under any patent or other intellectual property rights of
+Microchip or any third party.
+*/
+//DOM-IGNORE-END
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+
+#include <string.h>
+#include "crypto/drivers/driver/drv_crypto_ecc_hw_cpkcl.h"
+#include "crypto/drivers/driver/drv_crypto_mp_hw_cpkcl.h"
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_typedef_pb.h"
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_mapping_pb.h"
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_Headers_pb.h"
+#include "crypto/drivers/CPKCL_Lib/CryptoLib_JumpTable_Addr_pb.h"
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File Scope Variables
+// *****************************************************************************
+// *****************************************************************************
+
+// Modulus and reduction constant of the last RedMod setup. They are copied
+// back to crypto RAM when the next operation uses the same modulus.
+static u1 mpModulus[CRYPTO_MP_HW_MAX_MODULUS_SIZE];
+static u1 mpCns[CRYPTO_MP_HW_MAX_MODULUS_SIZE + 8U];
+static u2 mpModLength = 0U;
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Writes an LSB first number into crypto RAM, zero extended to u2Length
+   bytes plus the padding word */
+static void lDRV_CRYPTO_MP_Load(pu1 pu1Dest, pu1 pu1Src, u2 u2SrcLength,
+    u2 u2Length)
+{
+    (void) memset(pu1Dest, 0, (size_t)u2Length + 4U);
+    (void) memcpy(pu1Dest, pu1Src, u2SrcLength);
+}
+
+static bool lDRV_CRYPTO_MP_IsZero(pu1 pu1X, u2 u2Length)
+{
+    u1 u1Acc = 0U;
+    u2 u2Cpt;
+
+    for (u2Cpt = 0; u2Cpt < u2Length; u2Cpt++)
+    {
+        u1Acc |= pu1X[u2Cpt];
+    }
+
+    return (u1Acc == 0U);
+}
+
+/* x < n, both LSB first */
+static bool lDRV_CRYPTO_MP_IsBelow(pu1 pu1X, u2 u2XLength, pu1 pu1N,
+    u2 u2ModLength)
+{
+    u2 u2Cpt = (u2XLength > u2ModLength) ? u2XLength : u2ModLength;
+    u1 u1X;
+    u1 u1N;
+
+    while (u2Cpt > 0U)
+    {
+        u2Cpt--;
+        u1X = (u2Cpt < u2XLength) ? pu1X[u2Cpt] : 0U;
+        u1N = (u2Cpt < u2ModLength) ? pu1N[u2Cpt] : 0U;
+        if (u1X != u1N)
+        {
+            return (u1X < u1N);
+        }
+    }
+
+    return false;
+}
+
+/* Checks the CPKCL is ready and n is a modulus the services accept */
+static CRYPTO_MP_RESULT lDRV_CRYPTO_MP_Check(pu1 pu1N, u2 u2ModLength)
+{
+    /* Check the CPKCL is initialized and its self test passed */
+    if (DRV_CRYPTO_ECC_CheckCpkcl() != CRYPTO_CPKCL_RESULT_INIT_SUCCESS)
+    {
+        return CRYPTO_MP_RESULT_INIT_FAIL;
+    }
+
+    if ((u2ModLength < CRYPTO_MP_HW_MIN_MODULUS_SIZE) ||
+        (u2ModLength > CRYPTO_MP_HW_MAX_MODULUS_SIZE) ||
+        ((u2ModLength & 3U) != 0U) ||
+        lDRV_CRYPTO_MP_IsZero(&pu1N[u2ModLength - 4U], 4U))
+    {
+        return CRYPTO_MP_RESULT_ERROR_SIZE;
+    }
+
+    if ((pu1N[0] & 1U) == 0U)
+    {
+        return CRYPTO_MP_RESULT_ERROR_INPUT;
+    }
+
+    return CRYPTO_MP_RESULT_SUCCESS;
+}
+
+/* Loads n and its reduction constant into crypto RAM. The RedMod setup only
+   runs when n is not the modulus of the previous call. */
+static bool lDRV_CRYPTO_MP_SetModulus(pu1 pu1N, u2 u2ModLength)
+{
+    bool cached = ((u2ModLength == mpModLength) &&
+                   (memcmp(mpModulus, pu1N, u2ModLength) == 0));
+
+    /* The ECC constants do not survive */
+    DRV_CRYPTO_ECC_RamInvalidate();
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:9 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:28 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:9 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:9 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    lDRV_CRYPTO_MP_Load((pu1) BASE_MP_MODULO(u2ModLength), pu1N,
+        u2ModLength, u2ModLength);
+    if (cached)
+    {
+        (void) memset((pu1) BASE_MP_CNS(u2ModLength), 0,
+            (size_t)u2ModLength + 12U);
+        (void) memcpy((pu1) BASE_MP_CNS(u2ModLength), mpCns,
+            (size_t)u2ModLength + 8U);
+    }
+
+    /* The X and precomputation areas are the workspace of the setup */
+    CPKCL_RedMod(u2ModLength) = u2ModLength;
+    CPKCL_RedMod(nu1ModBase) = (nu1) BASE_MP_MODULO(u2ModLength);
+    CPKCL_RedMod(nu1CnsBase) = (nu1) BASE_MP_CNS(u2ModLength);
+    CPKCL_RedMod(nu1RBase) = (nu1) BASE_MP_PRECOMP(u2ModLength);
+    CPKCL_RedMod(nu1XBase) = (nu1) BASE_MP_X(u2ModLength);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    if (cached)
+    {
+        return true;
+    }
+
+    CPKCL(u2Option) = CPKCL_REDMOD_SETUP;
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    vCPKCL_Process(RedMod, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        mpModLength = 0U;
+        return false;
+    }
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:1 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:3 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    (void) memcpy(mpCns, (pu1) BASE_MP_CNS(u2ModLength),
+        (size_t)u2ModLength + 8U);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    (void) memcpy(mpModulus, pu1N, u2ModLength);
+    mpModLength = u2ModLength;
+
+    return true;
+}
+
+/* Reduces the double length number in the X area, the modulus being set
+   up. The fast reduction leaves a result below 2n in the precomputation
+   area, the normalization brings it below n in the exponent area. */
+static bool lDRV_CRYPTO_MP_Reduce(u2 u2ModLength)
+{
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:4 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:12 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:4 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:4 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    CPKCL_RedMod(nu1XBase) = (nu1) BASE_MP_X(u2ModLength);
+    CPKCL_RedMod(nu1RBase) = (nu1) BASE_MP_PRECOMP(u2ModLength);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL_RedMod(u2ModLength) = u2ModLength;
+    CPKCL(u2Option) = (u2) (CPKCL_REDMOD_REDUCTION | CPKCL_REDMOD_USING_FASTRED);
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    vCPKCL_Process(RedMod, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        return false;
+    }
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:4 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:15 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:4 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:4 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    CPKCL_RedMod(nu1XBase) = (nu1) BASE_MP_PRECOMP(u2ModLength);
+    CPKCL_RedMod(nu1RBase) = (nu1) BASE_MP_EXPONENT(u2ModLength);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL(u2Option) = CPKCL_REDMOD_NORMALIZE;
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    vCPKCL_Process(RedMod, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+
+    return (CPKCL(u2Status) == (unsigned)CPKCL_OK);
+}
+
+/* Copies the reduced result out of the exponent area */
+static void lDRV_CRYPTO_MP_StoreReduced(pu1 pu1R, u2 u2ModLength)
+{
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:1 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:8 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    (void) memcpy(pu1R, (pu1) BASE_MP_EXPONENT(u2ModLength), u2ModLength);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: CPKCC Multi-Precision Common Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+CRYPTO_MP_RESULT DRV_CRYPTO_MP_ModMul(pu1 pu1N, u2 u2ModLength,
+    pu1 pu1X, u2 u2XLength, pu1 pu1Y, u2 u2YLength, pu1 pu1R)
+{
+    CRYPTO_MP_RESULT result = lDRV_CRYPTO_MP_Check(pu1N, u2ModLength);
+    pu1 pu1Operands;
+
+    if (result != CRYPTO_MP_RESULT_SUCCESS)
+    {
+        return result;
+    }
+
+    if ((u2XLength > u2ModLength) || (u2YLength > u2ModLength))
+    {
+        return CRYPTO_MP_RESULT_ERROR_INPUT;
+    }
+
+    if (!lDRV_CRYPTO_MP_SetModulus(pu1N, u2ModLength))
+    {
+        return CRYPTO_MP_RESULT_ERROR_FAIL;
+    }
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:8 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:32 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:8 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:8 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    pu1Operands = (pu1) BASE_MP_PRECOMP(u2ModLength);
+    lDRV_CRYPTO_MP_Load(pu1Operands, pu1X, u2XLength, u2ModLength);
+    lDRV_CRYPTO_MP_Load(&pu1Operands[u2ModLength + 4U], pu1Y, u2YLength,
+        u2ModLength);
+
+    /* The product goes to the X area, which is also Z: unused by the plain
+       multiplication but it must point to a valid area */
+    (void) memset((pu1) BASE_MP_X(u2ModLength), 0,
+        (2U * (size_t)u2ModLength) + 8U);
+
+    CPKCL_Fmult(nu1ModBase) = (nu1) BASE_MP_MODULO(u2ModLength);
+    CPKCL_Fmult(nu1CnsBase) = (nu1) BASE_MP_CNS(u2ModLength);
+    CPKCL_Fmult(nu1XBase) = (nu1) BASE_MP_PRECOMP(u2ModLength);
+    CPKCL_Fmult(nu1YBase) = (nu1) (BASE_MP_PRECOMP(u2ModLength) + u2ModLength + 4U);
+    CPKCL_Fmult(nu1ZBase) = (nu1) BASE_MP_X(u2ModLength);
+    CPKCL_Fmult(nu1RBase) = (nu1) BASE_MP_X(u2ModLength);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL_Fmult(u2ModLength) = u2ModLength;
+    CPKCL_Fmult(u2XLength) = u2ModLength;
+    CPKCL_Fmult(u2YLength) = u2ModLength;
+    CPKCL(u2Option) = CPKCL_FMULT_ONLY;
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    vCPKCL_Process(Fmult, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    if ((CPKCL(u2Status) != (unsigned)CPKCL_OK) ||
+        !lDRV_CRYPTO_MP_Reduce(u2ModLength))
+    {
+        return CRYPTO_MP_RESULT_ERROR_FAIL;
+    }
+
+    lDRV_CRYPTO_MP_StoreReduced(pu1R, u2ModLength);
+
+    return CRYPTO_MP_RESULT_SUCCESS;
+}
+
+CRYPTO_MP_RESULT DRV_CRYPTO_MP_Mod(pu1 pu1N, u2 u2ModLength,
+    pu1 pu1X, u2 u2XLength, pu1 pu1R)
+{
+    CRYPTO_MP_RESULT result = lDRV_CRYPTO_MP_Check(pu1N, u2ModLength);
+
+    if (result != CRYPTO_MP_RESULT_SUCCESS)
+    {
+        return result;
+    }
+
+    if (u2XLength > (2U * u2ModLength))
+    {
+        return CRYPTO_MP_RESULT_ERROR_INPUT;
+    }
+
+    if (!lDRV_CRYPTO_MP_SetModulus(pu1N, u2ModLength))
+    {
+        return CRYPTO_MP_RESULT_ERROR_FAIL;
+    }
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:1 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:6 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    /* x zero extended to the double length the reduction takes */
+    lDRV_CRYPTO_MP_Load((pu1) BASE_MP_X(u2ModLength), pu1X, u2XLength,
+        (u2) ((2U * u2ModLength) + 4U));
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+
+    if (!lDRV_CRYPTO_MP_Reduce(u2ModLength))
+    {
+        return CRYPTO_MP_RESULT_ERROR_FAIL;
+    }
+
+    lDRV_CRYPTO_MP_StoreReduced(pu1R, u2ModLength);
+
+    return CRYPTO_MP_RESULT_SUCCESS;
+}
+
+CRYPTO_MP_RESULT DRV_CRYPTO_MP_ExpMod(pu1 pu1N, u2 u2ModLength,
+    pu1 pu1X, u2 u2XLength, pu1 pu1E, u2 u2ELength, bool bRegular, pu1 pu1R)
+{
+    CRYPTO_MP_RESULT result = lDRV_CRYPTO_MP_Check(pu1N, u2ModLength);
+    u2 u2ExpLength;
+    pu1 pu1XArea;
+    pu1 pu1ExpArea;
+
+    if (result != CRYPTO_MP_RESULT_SUCCESS)
+    {
+        return result;
+    }
+
+    if ((u2XLength > u2ModLength) ||
+        !lDRV_CRYPTO_MP_IsBelow(pu1X, u2XLength, pu1N, u2ModLength))
+    {
+        return CRYPTO_MP_RESULT_ERROR_INPUT;
+    }
+
+    /* The fast exponentiation skips the leading zero bytes of e, the
+       regular one processes the length it is given */
+    while ((!bRegular) && (u2ELength > 0U) && (pu1E[u2ELength - 1U] == 0U))
+    {
+        u2ELength--;
+    }
+    if ((u2ELength == 0U) || (u2ELength > u2ModLength))
+    {
+        return CRYPTO_MP_RESULT_ERROR_INPUT;
+    }
+    u2ExpLength = (u2) ((u2ELength + 3U) & ~3U);
+
+    if (!lDRV_CRYPTO_MP_SetModulus(pu1N, u2ModLength))
+    {
+        return CRYPTO_MP_RESULT_ERROR_FAIL;
+    }
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:7 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:30 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:7 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:7 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    pu1XArea = (pu1) BASE_MP_X(u2ModLength);
+    pu1ExpArea = (pu1) BASE_MP_EXPONENT(u2ModLength);
+
+    /* The least significant word of the X area stays 0, X follows it */
+    (void) memset(pu1XArea, 0, (3U * (size_t)u2ModLength) + 24U);
+    (void) memcpy(&pu1XArea[4], pu1X, u2XLength);
+    lDRV_CRYPTO_MP_Load(pu1ExpArea, pu1E, u2ELength, u2ExpLength);
+
+    CPKCL_ExpMod(nu1ModBase) = (nu1) BASE_MP_MODULO(u2ModLength);
+    CPKCL_ExpMod(nu1CnsBase) = (nu1) BASE_MP_CNS(u2ModLength);
+    CPKCL_ExpMod(nu1XBase) = (nu1) BASE_MP_X(u2ModLength);
+    CPKCL_ExpMod(nu1PrecompBase) = (nu1) BASE_MP_PRECOMP(u2ModLength);
+    CPKCL_ExpMod(pfu1ExpBase) = (pfu1) BASE_MP_EXPONENT(u2ModLength);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL_ExpMod(u2ModLength) = u2ModLength;
+    CPKCL_ExpMod(u2ExpLength) = u2ExpLength;
+    CPKCL_ExpMod(u1Blinding) = 0U;
+
+    if (bRegular)
+    {
+        CPKCL(u2Option) = (u2) (CPKCL_EXPMOD_REGULARRSA |
+            CPKCL_EXPMOD_EXPINPKCCRAM | CPKCL_EXPMOD_WINDOWSIZE_1);
+    }
+    else
+    {
+        CPKCL(u2Option) = (u2) (CPKCL_EXPMOD_FASTRSA |
+            CPKCL_EXPMOD_EXPINPKCCRAM | CPKCL_EXPMOD_WINDOWSIZE_1);
+    }
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    vCPKCL_Process(ExpMod, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        result = CRYPTO_MP_RESULT_ERROR_FAIL;
+    }
+    else
+    {
+        /* The result replaces X */
+        (void) memcpy(pu1R, &pu1XArea[4], u2ModLength);
+    }
+
+    if (bRegular)
+    {
+        (void) memset(pu1ExpArea, 0, (size_t)u2ExpLength + 4U);
+    }
+
+    return result;
+}
+
+CRYPTO_MP_RESULT DRV_CRYPTO_MP_InvMod(pu1 pu1N, u2 u2ModLength,
+    pu1 pu1X, u2 u2XLength, pu1 pu1R)
+{
+    CRYPTO_MP_RESULT result = lDRV_CRYPTO_MP_Check(pu1N, u2ModLength);
+    pu1 pu1XArea;
+    pu1 pu1ZArea;
+
+    if (result != CRYPTO_MP_RESULT_SUCCESS)
+    {
+        return result;
+    }
+
+    if ((u2XLength > u2ModLength) || lDRV_CRYPTO_MP_IsZero(pu1X, u2XLength) ||
+        !lDRV_CRYPTO_MP_IsBelow(pu1X, u2XLength, pu1N, u2ModLength))
+    {
+        return CRYPTO_MP_RESULT_ERROR_INPUT;
+    }
+
+    /* GCD needs no reduction constant */
+    DRV_CRYPTO_ECC_RamInvalidate();
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 10.4, 10.8, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_10_4_DR_1 & H3_MISRAC_2012_R_10_8_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:7 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:30 "MISRA C-2012 Rule 10.4" "H3_MISRAC_2012_R_10_4_DR_1" )\
+(deviate:7 "MISRA C-2012 Rule 10.8" "H3_MISRAC_2012_R_10_8_DR_1" )\
+(deviate:7 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    pu1XArea = (pu1) BASE_MP_X(u2ModLength);
+    pu1ZArea = (pu1) BASE_MP_PRECOMP(u2ModLength);
+
+    /* X, then Y = n and A in the X area, Z then the workspace in the
+       precomputation area */
+    lDRV_CRYPTO_MP_Load(pu1XArea, pu1X, u2XLength, u2ModLength);
+    lDRV_CRYPTO_MP_Load(&pu1XArea[u2ModLength + 4U], pu1N, u2ModLength,
+        u2ModLength);
+    (void) memset(&pu1XArea[(2U * u2ModLength) + 8U], 0,
+        (size_t)u2ModLength + 4U);
+    (void) memset(pu1ZArea, 0, (3U * (size_t)u2ModLength) + 24U);
+
+    CPKCL_GCD(nu1XBase) = (nu1) BASE_MP_X(u2ModLength);
+    CPKCL_GCD(nu1YBase) = (nu1) (BASE_MP_X(u2ModLength) + u2ModLength + 4U);
+    CPKCL_GCD(nu1ABase) = (nu1) (BASE_MP_X(u2ModLength) + 2U*u2ModLength + 8U);
+    CPKCL_GCD(nu1ZBase) = (nu1) BASE_MP_PRECOMP(u2ModLength);
+    CPKCL_GCD(nu1WorkSpace) = (nu1) (BASE_MP_PRECOMP(u2ModLength) + u2ModLength + 4U);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.4"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.8"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    CPKCL_GCD(u2Length) = u2ModLength;
+    CPKCL(u2Option) = 0U;
+
+    /* MISRA C-2012 deviation block start */
+    /* MISRA C-2012 Rule 10.1, 11.1, 20.7 deviated below. Deviation record ID -
+       H3_MISRAC_2012_R_10_1_DR_1 & H3_MISRAC_2012_R_11_1_DR_1 & H3_MISRAC_2012_R_20_7_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block \
+(deviate:2 "MISRA C-2012 Rule 10.1" "H3_MISRAC_2012_R_10_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 11.1" "H3_MISRAC_2012_R_11_1_DR_1" )\
+(deviate:1 "MISRA C-2012 Rule 20.7" "H3_MISRAC_2012_R_20_7_DR_1" )
+    vCPKCL_Process(GCD, pvCPKCLParam);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 10.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.1"
+#pragma coverity compliance end_block "MISRA C-2012 Rule 20.7"
+#pragma GCC diagnostic pop
+    /* MISRA C-2012 deviation block end */
+    if (CPKCL(u2Status) != (unsigned)CPKCL_OK)
+    {
+        result = CRYPTO_MP_RESULT_ERROR_FAIL;
+    }
+    /* The inverse exists when the GCD A is 1 */
+    else if ((pu1XArea[(2U * u2ModLength) + 8U] != 1U) ||
+             !lDRV_CRYPTO_MP_IsZero(&pu1XArea[(2U * u2ModLength) + 9U],
+                 u2ModLength - 1U))
+    {
+        result = CRYPTO_MP_RESULT_NO_INVERSE;
+    }
+    else
+    {
+        (void) memcpy(pu1R, pu1ZArea, u2ModLength);
+    }
+
+    /* x may be a secret nonce, nothing is left behind */
+    (void) memset(pu1XArea, 0, (6U * (size_t)u2ModLength) + 48U);
+
+    return result;
+}
@@ -72,6 +72,18 @@ crypto_Kas_Status_E Crypto_Kas_Ecdh_Hw_SharedSecret(uint8_t *privKey,
     uint32_t privKeyLen, uint8_t *pubKey, uint32_t pubKeyLen, 
     uint8_t *secret, uint32_t secretLen, crypto_EccCurveType_E eccCurveType_en);
 
+crypto_Kas_Status_E Crypto_Kas_Ecdh_Hw_KeyGen(uint8_t *privKey, 
+    uint32_t privKeyLen, uint8_t *pubKey, uint32_t pubKeyLen, 
+    crypto_EccCurveType_E eccCurveType_en);
+
+crypto_Kas_Status_E Crypto_Kas_Dh_Hw_KeyGen(uint8_t *privKey, 
+    uint32_t privKeyLen, uint8_t *pubKey, uint32_t pubKeyLen, 
+    crypto_Kas_DhGroup_E dhGroup_en);
+
+crypto_Kas_Status_E Crypto_Kas_Dh_Hw_SharedSecret(uint8_t *privKey, 
+    uint32_t privKeyLen, uint8_t *pubKey, uint32_t pubKeyLen, 
+    uint8_t *secret, uint32_t secretLen, crypto_Kas_DhGroup_E dhGroup_en);
+
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
 
@@ -49,8 +49,10 @@ Microchip or any third party.
 
 #include <stdint.h>
 #include "crypto/drivers/wrapper/crypto_kas_cpkcc44163_wrapper.h"
+#include "crypto/common_crypto/crypto_ecc_pool.h"
 #include "crypto/drivers/driver/drv_crypto_ecc_hw_cpkcl.h"
 #include "crypto/drivers/driver/drv_crypto_ecdh_hw_cpkcl.h"
+#include "crypto/drivers/driver/drv_crypto_dh_hw_cpkcl.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -85,6 +87,38 @@ static crypto_Kas_Status_E lCrypto_Kas_Ecdh_Hw_GetCurve(
             *hwEccCurve = CRYPTO_CPKCL_CURVE_P521;
             break;
         
+        case CRYPTO_ECC_CURVE_SECT233K1:
+            *hwEccCurve = CRYPTO_CPKCL_CURVE_SECT233K1;
+            break;
+        
+        case CRYPTO_ECC_CURVE_SECT233R1:
+            *hwEccCurve = CRYPTO_CPKCL_CURVE_SECT233R1;
+            break;
+        
+        case CRYPTO_ECC_CURVE_SECT283K1:
+            *hwEccCurve = CRYPTO_CPKCL_CURVE_SECT283K1;
+            break;
+        
+        case CRYPTO_ECC_CURVE_SECT283R1:
+            *hwEccCurve = CRYPTO_CPKCL_CURVE_SECT283R1;
+            break;
+        
+        case CRYPTO_ECC_CURVE_BRAINPOOLP256R1:
+            *hwEccCurve = CRYPTO_CPKCL_CURVE_BP256R1;
+            break;
+        
+        case CRYPTO_ECC_CURVE_BRAINPOOLP384R1:
+            *hwEccCurve = CRYPTO_CPKCL_CURVE_BP384R1;
+            break;
+        
+        case CRYPTO_ECC_CURVE_SECP256K1:
+            *hwEccCurve = CRYPTO_CPKCL_CURVE_SECP256K1;
+            break;
+        
+        case CRYPTO_ECC_CURVE_CUSTOM:
+            *hwEccCurve = CRYPTO_CPKCL_CURVE_CUSTOM;
+            break;
+        
         default:
             kasStatus = CRYPTO_KAS_ERROR_CURVE;
             break;
@@ -121,6 +155,69 @@ static crypto_Kas_Status_E lCrypto_Kas_Ecdh_Hw_MapResult(
     return kasStatus;
 }
 
+static crypto_Kas_Status_E lCrypto_Kas_Dh_Hw_GetGroup(
+    crypto_Kas_DhGroup_E dhGroup, CRYPTO_DH_GROUP *hwDhGroup)
+{
+    crypto_Kas_Status_E kasStatus = CRYPTO_KAS_SUCCESS;
+    
+    switch (dhGroup)
+    {     
+        case CRYPTO_KAS_DH_GROUP_FFDHE2048:
+            *hwDhGroup = CRYPTO_DH_GROUP_FFDHE2048;
+            break;
+        
+        case CRYPTO_KAS_DH_GROUP_FFDHE3072:
+            *hwDhGroup = CRYPTO_DH_GROUP_FFDHE3072;
+            break;
+        
+        default:
+            kasStatus = CRYPTO_KAS_ERROR_CURVE;
+            break;
+    }
+    
+    return kasStatus;
+}
+
+static crypto_Kas_Status_E lCrypto_Kas_Dh_Hw_MapResult(
+    CRYPTO_DH_RESULT result)
+{
+    crypto_Kas_Status_E kasStatus;
+    
+    switch (result) 
+    {
+        case CRYPTO_DH_RESULT_SUCCESS:
+            kasStatus = CRYPTO_KAS_SUCCESS;
+            break;
+            
+        case CRYPTO_DH_RESULT_ERROR_GROUP:
+            kasStatus = CRYPTO_KAS_ERROR_CURVE;
+            break;
+            
+        case CRYPTO_DH_RESULT_ERROR_PRIVKEY:
+            kasStatus = CRYPTO_KAS_ERROR_PRIVKEY;
+            break;
+            
+        case CRYPTO_DH_RESULT_ERROR_PUBKEY:
+            kasStatus = CRYPTO_KAS_ERROR_PUBKEY;
+            break;
+            
+        case CRYPTO_DH_RESULT_ERROR_RNG:
+            kasStatus = CRYPTO_KAS_ERROR_RNG;
+            break;
+        
+        case CRYPTO_DH_RESULT_INIT_FAIL:
+        case CRYPTO_DH_RESULT_ERROR_FAIL:
+            kasStatus = CRYPTO_KAS_ERROR_FAIL;
+            break;
+            
+        default:
+            kasStatus = CRYPTO_KAS_ERROR_FAIL;
+            break;
+    }
+    
+    return kasStatus;
+}
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Kas Common Interface Implementation
@@ -156,3 +253,126 @@ crypto_Kas_Status_E Crypto_Kas_Ecdh_Hw_SharedSecret(uint8_t *privKey,
 
     return lCrypto_Kas_Ecdh_Hw_MapResult(hwResult);     
 }
+
+crypto_Kas_Status_E Crypto_Kas_Ecdh_Hw_KeyGen(uint8_t *privKey, 
+    uint32_t privKeyLen, uint8_t *pubKey, uint32_t pubKeyLen, 
+    crypto_EccCurveType_E eccCurveType_en)
+{
+    crypto_Kas_Status_E result;
+    CRYPTO_CPKCL_RESULT hwResult;
+    CPKCL_ECC_DATA eccData;
+    CRYPTO_CPKCL_CURVE hwEccCurve;
+
+    /* Get curve */
+    result = lCrypto_Kas_Ecdh_Hw_GetCurve(eccCurveType_en, &hwEccCurve);
+    if (result != CRYPTO_KAS_SUCCESS)
+    {
+        return result;
+    }
+    
+    /* Ephemeral key pair precomputed in idle time, the pool
+     * checks the buffer sizes */
+    if (Crypto_Ecc_Pool_Take(eccCurveType_en, privKey, privKeyLen, pubKey, 
+            pubKeyLen) == CRYPTO_ECC_POOL_SUCCESS)
+    {
+        return CRYPTO_KAS_SUCCESS;
+    }
+    
+    /* Check the CPKCL is initialized and its self test passed */
+    if (DRV_CRYPTO_ECC_CheckCpkcl() != CRYPTO_CPKCL_RESULT_INIT_SUCCESS)
+    {
+        return CRYPTO_KAS_ERROR_FAIL;
+    }
+    
+    if (DRV_CRYPTO_ECC_InitCurveParams(&eccData, hwEccCurve) 
+            != CRYPTO_CPKCL_RESULT_CURVE_SUCCESS)
+    {
+        return CRYPTO_KAS_ERROR_CURVE;
+    }
+    
+    if (privKeyLen < (uint32_t)eccData.u2KeySize)
+    {
+        return CRYPTO_KAS_ERROR_PRIVKEY;
+    }
+    
+    if (pubKeyLen < ((2U * (uint32_t)eccData.u2KeySize) + 1U))
+    {
+        return CRYPTO_KAS_ERROR_PUBKEY;
+    }
+    
+    hwResult = DRV_CRYPTO_ECC_KeyGen(&eccData, (pfu1)privKey, (pfu1)pubKey);
+    
+    if (hwResult == CRYPTO_CPKCL_RESULT_KEYGEN_SUCCESS)
+    {
+        result = CRYPTO_KAS_SUCCESS;
+    }
+    else if (hwResult == CRYPTO_CPKCL_RESULT_KEYGEN_RNG_ERROR)
+    {
+        result = CRYPTO_KAS_ERROR_RNG;
+    }
+    else
+    {
+        result = CRYPTO_KAS_ERROR_FAIL;
+    }
+    
+    return result;
+}
+
+crypto_Kas_Status_E Crypto_Kas_Dh_Hw_KeyGen(uint8_t *privKey, 
+    uint32_t privKeyLen, uint8_t *pubKey, uint32_t pubKeyLen, 
+    crypto_Kas_DhGroup_E dhGroup_en)
+{
+    crypto_Kas_Status_E result;
+    CRYPTO_DH_GROUP hwDhGroup;
+
+    /* Get group */
+    result = lCrypto_Kas_Dh_Hw_GetGroup(dhGroup_en, &hwDhGroup);
+    if (result != CRYPTO_KAS_SUCCESS)
+    {
+        return result;
+    }
+    
+    if (privKeyLen < (uint32_t)DRV_CRYPTO_DH_GetPrivKeySize(hwDhGroup))
+    {
+        return CRYPTO_KAS_ERROR_PRIVKEY;
+    }
+    
+    if (pubKeyLen < (uint32_t)DRV_CRYPTO_DH_GetPrimeSize(hwDhGroup))
+    {
+        return CRYPTO_KAS_ERROR_PUBKEY;
+    }
+    
+    return lCrypto_Kas_Dh_Hw_MapResult(DRV_CRYPTO_DH_KeyGen(hwDhGroup, 
+        (pfu1)privKey, (pfu1)pubKey));
+}
+
+crypto_Kas_Status_E Crypto_Kas_Dh_Hw_SharedSecret(uint8_t *privKey, 
+    uint32_t privKeyLen, uint8_t *pubKey, uint32_t pubKeyLen, 
+    uint8_t *secret, uint32_t secretLen, crypto_Kas_DhGroup_E dhGroup_en)
+{
+    crypto_Kas_Status_E result;
+    CRYPTO_DH_GROUP hwDhGroup;
+    u2 primeSize;
+
+    /* Get group */
+    result = lCrypto_Kas_Dh_Hw_GetGroup(dhGroup_en, &hwDhGroup);
+    if (result != CRYPTO_KAS_SUCCESS)
+    {
+        return result;
+    }
+    
+    primeSize = DRV_CRYPTO_DH_GetPrimeSize(hwDhGroup);
+    
+    if (pubKeyLen != (uint32_t)primeSize)
+    {
+        return CRYPTO_KAS_ERROR_PUBKEY;
+    }
+    
+    if (secretLen < (uint32_t)primeSize)
+    {
+        return CRYPTO_KAS_ERROR_ARG;
+    }
+    
+    return lCrypto_Kas_Dh_Hw_MapResult(DRV_CRYPTO_DH_SharedSecret(hwDhGroup, 
+        (pfu1)privKey, (u2)privKeyLen, (pfu1)pubKey, (pfu1)secret));
+}
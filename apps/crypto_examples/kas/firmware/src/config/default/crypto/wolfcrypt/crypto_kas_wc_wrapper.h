@@ -34,4 +34,16 @@
 crypto_Kas_Status_E Crypto_Kas_Wc_Ecdh_SharedSecret(uint8_t *ptr_wcPrivKey, uint32_t wcPrivKeyLen, uint8_t *ptr_wcPubKey, uint32_t wcPubKeyLen, uint8_t *ptr_wcSharedSecret,
                                                     uint32_t wcSharedSecretLen, crypto_EccCurveType_E wcEccCurveType_en);
 
+crypto_Kas_Status_E Crypto_Kas_Wc_Ecdh_SharedSecretWithKey(st_Crypto_Key_Ecc *ptr_wcKey_st, uint8_t *ptr_wcPubKey, uint32_t wcPubKeyLen, 
+                                                            uint8_t *ptr_wcSharedSecret, uint32_t wcSharedSecretLen);
+
+crypto_Kas_Status_E Crypto_Kas_Wc_Ecdh_KeyGen(uint8_t *ptr_wcPrivKey, uint32_t wcPrivKeyLen, uint8_t *ptr_wcPubKey, uint32_t wcPubKeyLen, 
+                                                crypto_EccCurveType_E wcEccCurveType_en);
+
+crypto_Kas_Status_E Crypto_Kas_Wc_Dh_KeyGen(uint8_t *ptr_wcPrivKey, uint32_t wcPrivKeyLen, uint8_t *ptr_wcPubKey, uint32_t wcPubKeyLen, 
+                                            crypto_Kas_DhGroup_E wcDhGroup_en);
+
+crypto_Kas_Status_E Crypto_Kas_Wc_Dh_SharedSecret(uint8_t *ptr_wcPrivKey, uint32_t wcPrivKeyLen, uint8_t *ptr_wcPubKey, uint32_t wcPubKeyLen, 
+                                                  uint8_t *ptr_wcSharedSecret, uint32_t wcSharedSecretLen, crypto_Kas_DhGroup_E wcDhGroup_en);
+
 #endif /* CRYPTO_KAS_WC_WRAPPER_H */
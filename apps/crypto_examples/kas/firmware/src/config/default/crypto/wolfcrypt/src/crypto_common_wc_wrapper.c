@@ -39,6 +39,9 @@ static const int arr_EccCurveWcMap[CRYPTO_WC_ECC_TOTAL_CURVES][2] =  {
                                                                         {(int)CRYPTO_ECC_CURVE_SECP256R1, (int)ECC_SECP256R1},
                                                                         {(int)CRYPTO_ECC_CURVE_SECP384R1, (int)ECC_SECP384R1},
                                                                         {(int)CRYPTO_ECC_CURVE_SECP521R1, (int)ECC_SECP521R1},
+                                                                        {(int)CRYPTO_ECC_CURVE_BRAINPOOLP256R1, (int)ECC_BRAINPOOLP256R1},
+                                                                        {(int)CRYPTO_ECC_CURVE_BRAINPOOLP384R1, (int)ECC_BRAINPOOLP384R1},
+                                                                        {(int)CRYPTO_ECC_CURVE_SECP256K1, (int)ECC_SECP256K1},
                                                                     };
 
 int Crypto_Common_Wc_Ecc_GetWcCurveId(crypto_EccCurveType_E curveType_en)
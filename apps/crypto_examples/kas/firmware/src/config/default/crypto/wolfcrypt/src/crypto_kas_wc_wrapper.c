@@ -31,7 +31,10 @@
 #include "crypto/wolfcrypt/crypto_kas_wc_wrapper.h"
 #include "crypto/wolfcrypt/crypto_common_wc_wrapper.h"
 #include "wolfssl/wolfcrypt/error-crypt.h"
+#include "wolfssl/wolfcrypt/random.h"
 #include "wolfssl/wolfcrypt/ecc.h"
+#include "wolfssl/wolfcrypt/dh.h"
+#include <string.h>
 
 crypto_Kas_Status_E Crypto_Kas_Wc_Ecdh_SharedSecret(uint8_t *ptr_wcPrivKey, uint32_t wcPrivKeyLen, uint8_t *ptr_wcPubKey, uint32_t wcPubKeyLen, uint8_t *ptr_wcSharedSecret,
                                                     uint32_t wcSharedSecretLen, crypto_EccCurveType_E wcEccCurveType_en)
@@ -97,3 +100,293 @@ crypto_Kas_Status_E Crypto_Kas_Wc_Ecdh_SharedSecret(uint8_t *ptr_wcPrivKey, uint
     }
     return ret_wcEcdhStat_en;
 }
+
+//The private key and the DRBG of the handle were set up by Crypto_Key_Import, only the peer key is imported
+crypto_Kas_Status_E Crypto_Kas_Wc_Ecdh_SharedSecretWithKey(st_Crypto_Key_Ecc *ptr_wcKey_st, uint8_t *ptr_wcPubKey, uint32_t wcPubKeyLen, 
+                                                            uint8_t *ptr_wcSharedSecret, uint32_t wcSharedSecretLen)
+{
+    crypto_Kas_Status_E ret_wcEcdhStat_en;
+    ecc_key *ptr_wcEccPrivKey_st = (ecc_key*)ptr_wcKey_st->ptr_wcEccKey;
+    ecc_key wcEccPubKey_st;
+    int wcEcdhStatus;
+    word32 sharedSecretLen = wcSharedSecretLen;
+    
+    wcEcdhStatus = wc_ecc_init(&wcEccPubKey_st);
+
+    if(wcEcdhStatus == 0)
+    {
+        /* Import public ECC key in ANSI X9.63 format */
+        wcEcdhStatus = wc_ecc_import_x963_ex(ptr_wcPubKey, wcPubKeyLen, &wcEccPubKey_st, 
+                                            Crypto_Common_Wc_Ecc_GetWcCurveId(ptr_wcKey_st->eccCurveType_en));
+        if(wcEcdhStatus == 0)
+        {
+            /* Generate Shared Secret using ECDH*/
+            wcEcdhStatus = wc_ecc_shared_secret(ptr_wcEccPrivKey_st, &wcEccPubKey_st, ptr_wcSharedSecret, &sharedSecretLen);
+        }
+        (void)wc_ecc_free(&wcEccPubKey_st);
+    }
+    
+    if(wcEcdhStatus == 0)
+    {
+        ret_wcEcdhStat_en = CRYPTO_KAS_SUCCESS;
+    }
+    else if(wcEcdhStatus == ECC_CURVE_OID_E)
+    {
+        ret_wcEcdhStat_en = CRYPTO_KAS_ERROR_CURVE;
+    }
+    else if( (wcEcdhStatus == BAD_FUNC_ARG) || (wcEcdhStatus == ECC_BAD_ARG_E) )
+    {
+        ret_wcEcdhStat_en = CRYPTO_KAS_ERROR_ARG;
+    }
+    else
+    {
+        ret_wcEcdhStat_en = CRYPTO_KAS_ERROR_FAIL;
+    }
+    
+    return ret_wcEcdhStat_en;
+}
+
+crypto_Kas_Status_E Crypto_Kas_Wc_Ecdh_KeyGen(uint8_t *ptr_wcPrivKey, uint32_t wcPrivKeyLen, uint8_t *ptr_wcPubKey, uint32_t wcPubKeyLen, 
+                                                crypto_EccCurveType_E wcEccCurveType_en)
+{
+    crypto_Kas_Status_E ret_wcEcdhStat_en = CRYPTO_KAS_ERROR_ALGONOTSUPPTD;
+    ecc_key wcEccKey_st;
+    WC_RNG wcRng_st;
+    int wcEcdhStatus = BAD_FUNC_ARG;
+    int wcEccCurveId = (int)ECC_CURVE_INVALID;
+    int wcKeySize = 0;
+    word32 privKeyLen = wcPrivKeyLen;
+    word32 pubKeyLen = wcPubKeyLen;
+    
+    wcEccCurveId = Crypto_Common_Wc_Ecc_GetWcCurveId(wcEccCurveType_en);
+    
+    if(wcEccCurveId == (int)ECC_CURVE_INVALID)
+    {
+        ret_wcEcdhStat_en = CRYPTO_KAS_ERROR_CURVE;
+    }
+    else
+    {
+        wcKeySize = wc_ecc_get_curve_size_from_id(wcEccCurveId);
+        
+        if(wcPrivKeyLen < (uint32_t)wcKeySize)
+        {
+            ret_wcEcdhStat_en = CRYPTO_KAS_ERROR_PRIVKEY;
+        }
+        else if(wcPubKeyLen < ((2u * (uint32_t)wcKeySize) + 1u))
+        {
+            ret_wcEcdhStat_en = CRYPTO_KAS_ERROR_PUBKEY;
+        }
+        else
+        {
+            // Setup the RNG
+            wcEcdhStatus = wc_InitRng(&wcRng_st);
+
+            if(wcEcdhStatus == 0)
+            {
+                wcEcdhStatus = wc_ecc_init(&wcEccKey_st);
+
+                if(wcEcdhStatus == 0)
+                {
+                    wcEcdhStatus = wc_ecc_make_key_ex(&wcRng_st, wcKeySize, &wcEccKey_st, wcEccCurveId);
+
+                    //Export private key "d" and public key in ANSI X9.63 format
+                    if(wcEcdhStatus == 0)
+                    {
+                        wcEcdhStatus = wc_ecc_export_private_only(&wcEccKey_st, ptr_wcPrivKey, &privKeyLen);
+                    }
+                    if(wcEcdhStatus == 0)
+                    {
+                        wcEcdhStatus = wc_ecc_export_x963(&wcEccKey_st, ptr_wcPubKey, &pubKeyLen);
+                    }
+                    (void)wc_ecc_free(&wcEccKey_st);
+                }
+                (void)wc_FreeRng(&wcRng_st);
+                
+                if(wcEcdhStatus == 0)
+                {
+                    ret_wcEcdhStat_en = CRYPTO_KAS_SUCCESS;
+                }
+                else if(wcEcdhStatus == ECC_CURVE_OID_E)
+                {
+                    ret_wcEcdhStat_en = CRYPTO_KAS_ERROR_CURVE;
+                }
+                else if( (wcEcdhStatus == BAD_FUNC_ARG) || (wcEcdhStatus == ECC_BAD_ARG_E) )
+                {
+                    ret_wcEcdhStat_en = CRYPTO_KAS_ERROR_ARG;
+                }
+                else
+                {
+                    ret_wcEcdhStat_en = CRYPTO_KAS_ERROR_FAIL;
+                }
+            }
+            else
+            {
+                ret_wcEcdhStat_en = CRYPTO_KAS_ERROR_RNG;
+            }
+        }
+    }
+    return ret_wcEcdhStat_en;
+}
+
+static const DhParams* lCrypto_Kas_Wc_Dh_GetParams(crypto_Kas_DhGroup_E wcDhGroup_en)
+{
+    const DhParams *ptr_dhParams = NULL;
+    
+    if(wcDhGroup_en == CRYPTO_KAS_DH_GROUP_FFDHE2048)
+    {
+        ptr_dhParams = wc_Dh_ffdhe2048_Get();
+    }
+    else if(wcDhGroup_en == CRYPTO_KAS_DH_GROUP_FFDHE3072)
+    {
+        ptr_dhParams = wc_Dh_ffdhe3072_Get();
+    }
+    else
+    {
+        ptr_dhParams = NULL;
+    }
+    return ptr_dhParams;
+}
+
+//wolfCrypt writes numbers without their leading zeros, move them right to fill the buffer
+static void lCrypto_Kas_Wc_Dh_LeftPad(uint8_t *ptr_data, uint32_t dataLen, uint32_t size)
+{
+    if(dataLen < size)
+    {
+        (void)memmove(&ptr_data[size - dataLen], ptr_data, dataLen);
+        (void)memset(ptr_data, 0, size - dataLen);
+    }
+}
+
+crypto_Kas_Status_E Crypto_Kas_Wc_Dh_KeyGen(uint8_t *ptr_wcPrivKey, uint32_t wcPrivKeyLen, uint8_t *ptr_wcPubKey, uint32_t wcPubKeyLen, 
+                                            crypto_Kas_DhGroup_E wcDhGroup_en)
+{
+    crypto_Kas_Status_E ret_wcDhStat_en = CRYPTO_KAS_ERROR_ALGONOTSUPPTD;
+    const DhParams *ptr_dhParams = lCrypto_Kas_Wc_Dh_GetParams(wcDhGroup_en);
+    DhKey wcDhKey_st;
+    WC_RNG wcRng_st;
+    int wcDhStatus = BAD_FUNC_ARG;
+    uint32_t privSize;
+    word32 privKeyLen = wcPrivKeyLen;
+    word32 pubKeyLen = wcPubKeyLen;
+    
+    if(ptr_dhParams == NULL)
+    {
+        ret_wcDhStat_en = CRYPTO_KAS_ERROR_CURVE;
+    }
+    else
+    {
+        privSize = (ptr_dhParams->p_len == CRYPTO_KAS_DH_FFDHE2048_SIZE) ? CRYPTO_KAS_DH_FFDHE2048_PRIV_SIZE : CRYPTO_KAS_DH_FFDHE3072_PRIV_SIZE;
+        
+        if(wcPrivKeyLen < privSize)
+        {
+            ret_wcDhStat_en = CRYPTO_KAS_ERROR_PRIVKEY;
+        }
+        else if(wcPubKeyLen < ptr_dhParams->p_len)
+        {
+            ret_wcDhStat_en = CRYPTO_KAS_ERROR_PUBKEY;
+        }
+        else
+        {
+            // Setup the RNG
+            wcDhStatus = wc_InitRng(&wcRng_st);
+
+            if(wcDhStatus == 0)
+            {
+                wcDhStatus = wc_InitDhKey(&wcDhKey_st);
+
+                if(wcDhStatus == 0)
+                {
+                    wcDhStatus = wc_DhSetKey(&wcDhKey_st, ptr_dhParams->p, ptr_dhParams->p_len, ptr_dhParams->g, ptr_dhParams->g_len);
+                    
+                    if(wcDhStatus == 0)
+                    {
+                        wcDhStatus = wc_DhGenerateKeyPair(&wcDhKey_st, &wcRng_st, ptr_wcPrivKey, &privKeyLen, ptr_wcPubKey, &pubKeyLen);
+                    }
+                    (void)wc_FreeDhKey(&wcDhKey_st);
+                }
+                (void)wc_FreeRng(&wcRng_st);
+                
+                if(wcDhStatus == 0)
+                {
+                    lCrypto_Kas_Wc_Dh_LeftPad(ptr_wcPrivKey, privKeyLen, privSize);
+                    lCrypto_Kas_Wc_Dh_LeftPad(ptr_wcPubKey, pubKeyLen, ptr_dhParams->p_len);
+                    ret_wcDhStat_en = CRYPTO_KAS_SUCCESS;
+                }
+                else if(wcDhStatus == BAD_FUNC_ARG)
+                {
+                    ret_wcDhStat_en = CRYPTO_KAS_ERROR_ARG;
+                }
+                else
+                {
+                    ret_wcDhStat_en = CRYPTO_KAS_ERROR_FAIL;
+                }
+            }
+            else
+            {
+                ret_wcDhStat_en = CRYPTO_KAS_ERROR_RNG;
+            }
+        }
+    }
+    return ret_wcDhStat_en;
+}
+
+crypto_Kas_Status_E Crypto_Kas_Wc_Dh_SharedSecret(uint8_t *ptr_wcPrivKey, uint32_t wcPrivKeyLen, uint8_t *ptr_wcPubKey, uint32_t wcPubKeyLen, 
+                                                  uint8_t *ptr_wcSharedSecret, uint32_t wcSharedSecretLen, crypto_Kas_DhGroup_E wcDhGroup_en)
+{
+    crypto_Kas_Status_E ret_wcDhStat_en = CRYPTO_KAS_ERROR_ALGONOTSUPPTD;
+    const DhParams *ptr_dhParams = lCrypto_Kas_Wc_Dh_GetParams(wcDhGroup_en);
+    DhKey wcDhKey_st;
+    int wcDhStatus = BAD_FUNC_ARG;
+    word32 sharedSecretLen = wcSharedSecretLen;
+    
+    if(ptr_dhParams == NULL)
+    {
+        ret_wcDhStat_en = CRYPTO_KAS_ERROR_CURVE;
+    }
+    else
+    {
+        wcDhStatus = wc_InitDhKey(&wcDhKey_st);
+        
+        if(wcDhStatus == 0)
+        {
+            wcDhStatus = wc_DhSetKey(&wcDhKey_st, ptr_dhParams->p, ptr_dhParams->p_len, ptr_dhParams->g, ptr_dhParams->g_len);
+            
+            //The agreement only checks the public key with WOLFSSL_VALIDATE_FFC_IMPORT, check 1 < y < p - 1 here
+            if( (wcDhStatus == 0) && (wc_DhCheckPubKey(&wcDhKey_st, ptr_wcPubKey, wcPubKeyLen) != 0) )
+            {
+                wcDhStatus = DH_CHECK_PUB_E;
+            }
+            
+            if(wcDhStatus == 0)
+            {
+                //Rejects a shared secret of 1
+                wcDhStatus = wc_DhAgree(&wcDhKey_st, ptr_wcSharedSecret, &sharedSecretLen, ptr_wcPrivKey, wcPrivKeyLen, 
+                                        ptr_wcPubKey, wcPubKeyLen);
+            }
+            (void)wc_FreeDhKey(&wcDhKey_st);
+        }
+        
+        if(wcDhStatus == 0)
+        {
+            lCrypto_Kas_Wc_Dh_LeftPad(ptr_wcSharedSecret, sharedSecretLen, ptr_dhParams->p_len);
+            ret_wcDhStat_en = CRYPTO_KAS_SUCCESS;
+        }
+        else if( (wcDhStatus == DH_CHECK_PUB_E) || (wcDhStatus == MP_VAL) )
+        {
+            ret_wcDhStat_en = CRYPTO_KAS_ERROR_PUBKEY;
+        }
+        else if(wcDhStatus == DH_CHECK_PRIV_E)
+        {
+            ret_wcDhStat_en = CRYPTO_KAS_ERROR_PRIVKEY;
+        }
+        else if(wcDhStatus == BAD_FUNC_ARG)
+        {
+            ret_wcDhStat_en = CRYPTO_KAS_ERROR_ARG;
+        }
+        else
+        {
+            ret_wcDhStat_en = CRYPTO_KAS_ERROR_FAIL;
+        }
+    }
+    return ret_wcDhStat_en;
+}
@@ -76,6 +76,19 @@ extern "C" {
 #define CRYPTO_DIGISIGN_ALGO_EN
 #define CRYPTO_KAS_ALGO_EN    
 
+//CPKCL self test runs once at power-on; set to N to run it again every N
+//hardware ECC operations
+#define CRYPTO_CPKCL_SELFTEST_PERIOD    (0U)
+
+//Fixed-base comb tables of the curve generators, in flash, for the CPKCC key
+//generation of the ECDH keys. Each one takes 17 points: 952
+//bytes for P-192, 1088 P-224, 1224 P-256, 1768 P-384 and 2448 P-521
+#define CRYPTO_CPKCL_COMB_P192
+#define CRYPTO_CPKCL_COMB_P224
+#define CRYPTO_CPKCL_COMB_P256
+#define CRYPTO_CPKCL_COMB_P384
+#define CRYPTO_CPKCL_COMB_P521
+
 /*** wolfCrypt Library Configuration ***/
 //configuration.h included in config.h and user_settings.h allowing these
 //files to configure WolfSSL library
@@ -122,8 +135,17 @@ extern "C" {
 #define WOLFSSL_SP_NONBLOCK  //JK
 #define WC_ECC_NONBLOCK      //JK
 
+//sp_int modular multiply, reduction, exponentiation and inverse run on the
+//CPKCC for odd moduli from WOLFSSL_SP_CPKCC_MIN_BITS to 3072 bits, through the
+//--wrap linker options listed in port/cpkcc/cpkcc-sp-int.h
+#define WOLFSSL_SP_CPKCC
+#define WOLFSSL_SP_CPKCC_MIN_BITS   256
+
 #define NO_PWDBASED
-//#define WOLF_CRYPTO_CB     //Provide call-back support 
+#define WOLF_CRYPTO_CB     //Provide call-back support 
+#define CRYPTO_CRYPTOCB_HW_SHA      //SHA-256/384/512 on the SHA6156, crypto_cryptocb_wc_wrapper.c
+#define CRYPTO_CRYPTOCB_HW_ECDH     //ECDH shared secret on the CPKCC, crypto_cryptocb_wc_wrapper.c
+#define CRYPTO_CRYPTOCB_HW_AES_GCM  //AES-GCM on the AES6149, crypto_cryptocb_wc_wrapper.c
 #define WOLFCRYPT_ONLY
 #define HAVE_COMP_KEY        //JK 
 
@@ -162,18 +184,22 @@ extern "C" {
 #define HAVE_X963_KDF
 #define ECC_SHAMIR
 #define WOLFSSL_CUSTOM_CURVES
+#define HAVE_ECC_BRAINPOOL
+#define HAVE_ECC_KOBLITZ
 //#define HAVE_CURVE25519     //JK 
 //#define HAVE_ED25519        //JK
 #define FP_ECC
 #define HAVE_ECC521           //ECC_MAX_BITS
 
-//#define HAVE_DH
-//#define WOLFSSL_HAVE_SP_DH
+#define HAVE_DH
+#define WOLFSSL_HAVE_SP_DH     //Raises SP_INT_BITS to the 3072-bit group
+#define HAVE_FFDHE_2048
+#define HAVE_FFDHE_3072
     
 #define HAVE_ANON
 #define WOLFSSL_OLD_PRIME_CHECK
 #define NO_DSA
-#define FP_MAX_BITS 4096
+#define FP_MAX_BITS 6144     //Twice the largest FFDHE group
 #define USE_CERT_BUFFERS_2048
 //#define WOLFSSL_RSA_PUBLIC_ONLY  //JK //Conflict with WOLFSSL_HAVE_SP_DH
 //#define WC_RSA_PSS               //JK
@@ -206,7 +232,7 @@ int Crypto_Rng_Wc_Prng_Srand(uint8_t* output, unsigned int sz);
 //#define WC_NO_HASHDRBG
 //#define HAVE_ECC_ENCRYPT
 #define NO_RSA                 //JK
-#define NO_DH                  //JK
+//#define NO_DH                //JK
 //#define NO_SIG_WRAPPER
 //**********************************************************
 
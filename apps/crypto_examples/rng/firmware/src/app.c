@@ -28,6 +28,8 @@
 // *****************************************************************************
 
 #include "app.h"
+#include "wolfssl/wolfcrypt/random.h"
+#include "crypto/wolfcrypt/crypto_cryptocb_wc_wrapper.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -41,6 +43,9 @@
 uint8_t testsPassed;
 uint8_t testsFailed;
 
+/* wolfCrypt RNG of the crypto callback test */
+static WC_RNG cbRng;
+
 // *****************************************************************************
 /* Application Data
 
@@ -106,6 +111,93 @@ void GenerateRng (crypto_HandlerType_E cryptoHandler)
     }
 }
 
+/*******************************************************************************
+  Function:
+    void GenerateRngCryptoCb (void)
+
+  Remarks:
+    See prototype in app.h.
+ */
+
+void GenerateRngCryptoCb (void)
+{
+    uint8_t rngData[DATA_SIZE];
+    uint32_t hwCount = 0;
+    uint32_t swCount = 0;
+    uint32_t busySwCount = 0;
+    bool registered = false;
+    bool rngInit = false;
+    bool nonZero = false;
+    int ret;
+    uint32_t i;
+
+    (void) memset(rngData, 0, DATA_SIZE);
+
+    ret = Crypto_CryptoCb_Wc_Init();
+    registered = (ret == 0);
+    if (ret == 0)
+    {
+        ret = wc_InitRng_ex(&cbRng, NULL, CRYPTO_CRYPTOCB_WC_DEVID);
+        rngInit = (ret == 0);
+    }
+
+    SYSTICK_TimerRestart();
+    uint32_t startTime = 0, endTime = 0;
+    startTime = SYSTICK_TimerCounterGet(); 
+
+    if (ret == 0)
+    {
+        ret = wc_RNG_GenerateBlock(&cbRng, rngData, DATA_SIZE);
+    }
+
+    endTime = SYSTICK_TimerCounterGet();
+    printf("Time elapsed (ms): %f\r\n", (double)(startTime - endTime)/(SYSTICK_FREQ/1000U));
+
+    for (i = 0; i < DATA_SIZE; i++)
+    {
+        nonZero = nonZero || (rngData[i] != 0U);
+    }
+
+    /* TRNG busy, the block comes from the wolfCrypt DRBG */
+    if (ret == 0)
+    {
+        Crypto_CryptoCb_Wc_GetCounts(&hwCount, &busySwCount);
+        if (Crypto_CryptoCb_Wc_EngineClaim(CRYPTO_CRYPTOCB_ENGINE_TRNG))
+        {
+            ret = wc_RNG_GenerateBlock(&cbRng, rngData, DATA_SIZE);
+            Crypto_CryptoCb_Wc_EngineRelease(CRYPTO_CRYPTOCB_ENGINE_TRNG);
+        }
+        Crypto_CryptoCb_Wc_GetCounts(&hwCount, &swCount);
+        busySwCount = swCount - busySwCount;
+    }
+
+    if (rngInit)
+    {
+        (void) wc_FreeRng(&cbRng);
+    }
+    if (registered)
+    {
+        Crypto_CryptoCb_Wc_Deinit();
+    }
+
+    if (ret != 0)
+    {
+        testsFailed++;
+        printf("Failed, status: %d\r\n", ret);
+    }
+    else if ((!nonZero) || (hwCount == 0U) || (busySwCount == 0U))
+    {
+        testsFailed++;
+        printf("Callbacks on the TRNG: %d, left to software: %d\r\n", 
+            (int)hwCount, (int)swCount);
+    }
+    else
+    {
+        testsPassed++;
+        printf("Test successful\r\n");
+    }
+}
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Application Initialization and State Machine Functions
@@ -168,6 +260,10 @@ void APP_Tasks ( void )
                 printf("\r\n-----------RNG wolfCrypt Wrapper-------------\r\n");
                 printf("\r\nPRNG\r\n");
                 GenerateRng(CRYPTO_HANDLER_SW_WOLFCRYPT);
+
+                printf("\r\n-----------RNG wolfCrypt Crypto Callback-------------\r\n");
+                printf("\r\nwc_RNG_GenerateBlock\r\n");
+                GenerateRngCryptoCb();
                                 
                 appData.isTestedRng = true;
 
@@ -188,6 +188,34 @@ void APP_Tasks (void);
 
 void GenerateRng (crypto_HandlerType_E cryptoHandler);
 
+// *****************************************************************************
+/**
+  @Function
+    void GenerateRngCryptoCb(void)
+
+  @Summary
+    Draws wolfCrypt random numbers through the crypto callback.
+
+  @Description
+    This function draws a block with wc_RNG_GenerateBlock with the crypto 
+    callback device registered, which must come from the TRNG, then a second 
+    block while the TRNG is claimed, which must be left to the wolfCrypt DRBG.
+
+  @Precondition
+    None.
+
+  @Parameters
+    None.
+
+  @Returns
+    None.
+
+  @Remarks
+    The device is unregistered on return.
+ */
+
+void GenerateRngCryptoCb (void);
+
 //DOM-IGNORE-BEGIN
 #ifdef __cplusplus
 }
@@ -0,0 +1,822 @@
+/*******************************************************************************
+  MPLAB Harmony Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_cryptocb_wc_wrapper.c
+
+  Summary:
+    This file contains the wolfCrypt crypto callback device of the hardware
+    crypto engines.
+
+  Description:
+    The callback hands each wolfCrypt operation of an enabled route to the
+    hardware wrapper of its engine and returns CRYPTOCB_UNAVAILABLE, which makes
+    wolfCrypt run its software code, for everything else: routes not enabled,
+    parameters the engine does not take, engine busy or failing.
+*******************************************************************************/
+
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <string.h>
+#include "device.h"
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/wolfcrypt/crypto_cryptocb_wc_wrapper.h"
+#include "wolfssl/wolfcrypt/settings.h"
+#include "wolfssl/wolfcrypt/error-crypt.h"
+#include "wolfssl/wolfcrypt/wc_port.h"
+#include "wolfssl/wolfcrypt/cryptocb.h"
+#ifdef NO_INLINE
+    #include "wolfssl/wolfcrypt/misc.h"
+#else
+    #define WOLFSSL_MISC_INCLUDED
+    #include "wolfcrypt/src/misc.c"
+#endif
+
+#ifdef CRYPTO_CRYPTOCB_HW_SHA
+#include "crypto/drivers/wrapper/crypto_hash_sha6156_wrapper.h"
+#endif
+#if defined(CRYPTO_CRYPTOCB_HW_ECDSA) || defined(CRYPTO_CRYPTOCB_HW_ECDH)
+#include "crypto/wolfcrypt/crypto_common_wc_wrapper.h"
+#include "crypto/drivers/driver/drv_crypto_ecc_hw_cpkcl.h"
+#endif
+#ifdef CRYPTO_CRYPTOCB_HW_ECDSA
+#include "crypto/drivers/wrapper/crypto_digisign_cpkcc44163_wrapper.h"
+#endif
+#ifdef CRYPTO_CRYPTOCB_HW_ECDH
+#include "crypto/drivers/wrapper/crypto_kas_cpkcc44163_wrapper.h"
+#endif
+#ifdef CRYPTO_CRYPTOCB_HW_AES
+#include "crypto/drivers/wrapper/crypto_sym_aes6149_wrapper.h"
+#endif
+#ifdef CRYPTO_CRYPTOCB_HW_AES_GCM
+#include "crypto/drivers/wrapper/crypto_aead_aes6149_wrapper.h"
+#endif
+#ifdef CRYPTO_CRYPTOCB_HW_TRNG
+#include "crypto/drivers/wrapper/crypto_rng_trng6334_wrapper.h"
+#endif
+
+#ifdef WOLF_CRYPTO_CB
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+/* Largest ECC key, P-521, in bytes */
+#define CRYPTO_CRYPTOCB_ECC_MAX_SIZE    (66U)
+
+#define CRYPTO_CRYPTOCB_AES_BLOCK_SIZE  (16U)
+
+static volatile bool cbEngineBusy[CRYPTO_CRYPTOCB_ENGINE_MAX];
+static uint32_t cbHwCount = 0;
+static uint32_t cbSwCount = 0;
+
+#ifdef CRYPTO_CRYPTOCB_HW_SHA
+/* The engine holds one hash: its context and the devCtx field of the
+ * wolfCrypt object owning it */
+static CRYPTO_HASH_HW_CONTEXT cbShaCtx;
+static void **cbShaOwner = NULL;
+/* devCtx of a wolfCrypt hash object points to one of these until its final */
+static uint8_t cbShaOnHw;
+static uint8_t cbShaOnSw;
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+#ifdef CRYPTO_CRYPTOCB_HW_SHA
+/* Claims the SHA engine for the hash object whose devCtx field is given. The
+ * object owning it already is taken back, it was set up again mid-stream. */
+static bool lCrypto_CryptoCb_Wc_ShaClaim(void **ptr_devCtx)
+{
+    uint32_t primask = __get_PRIMASK();
+    bool claimed = false;
+
+    __disable_irq();
+    if ((!cbEngineBusy[CRYPTO_CRYPTOCB_ENGINE_SHA]) || (cbShaOwner == ptr_devCtx))
+    {
+        cbEngineBusy[CRYPTO_CRYPTOCB_ENGINE_SHA] = true;
+        cbShaOwner = ptr_devCtx;
+        claimed = true;
+    }
+    __set_PRIMASK(primask);
+
+    return claimed;
+}
+
+static void lCrypto_CryptoCb_Wc_ShaRelease(void)
+{
+    cbShaOwner = NULL;
+    cbEngineBusy[CRYPTO_CRYPTOCB_ENGINE_SHA] = false;
+}
+
+static int lCrypto_CryptoCb_Wc_Sha(wc_CryptoInfo *ptr_info)
+{
+    int ret = CRYPTOCB_UNAVAILABLE;
+    void **ptr_devCtx = NULL;
+    crypto_Hash_Algo_E hashAlgo_en = CRYPTO_HASH_INVALID;
+    uint32_t digestSize = 0;
+    uint32_t digest[WC_SHA512_DIGEST_SIZE / 4U];
+
+    switch (ptr_info->hash.type)
+    {
+        case (int)WC_HASH_TYPE_SHA256:
+            if (ptr_info->hash.sha256 != NULL)
+            {
+                ptr_devCtx = &ptr_info->hash.sha256->devCtx;
+                hashAlgo_en = CRYPTO_HASH_SHA2_256;
+                digestSize = WC_SHA256_DIGEST_SIZE;
+            }
+            break;
+        case (int)WC_HASH_TYPE_SHA384:
+            if (ptr_info->hash.sha384 != NULL)
+            {
+                ptr_devCtx = &ptr_info->hash.sha384->devCtx;
+                hashAlgo_en = CRYPTO_HASH_SHA2_384;
+                digestSize = WC_SHA384_DIGEST_SIZE;
+            }
+            break;
+        case (int)WC_HASH_TYPE_SHA512:
+            if (ptr_info->hash.sha512 != NULL)
+            {
+                ptr_devCtx = &ptr_info->hash.sha512->devCtx;
+                hashAlgo_en = CRYPTO_HASH_SHA2_512;
+                digestSize = WC_SHA512_DIGEST_SIZE;
+            }
+            break;
+        default:
+            ptr_devCtx = NULL;
+            break;
+    }
+
+    if (ptr_devCtx == NULL)
+    {
+        return CRYPTOCB_UNAVAILABLE;
+    }
+
+    /* A stream stays where its first update went */
+    if (*ptr_devCtx == NULL)
+    {
+        *ptr_devCtx = &cbShaOnSw;
+        if (lCrypto_CryptoCb_Wc_ShaClaim(ptr_devCtx))
+        {
+            if (Crypto_Hash_Hw_Sha_Init(&cbShaCtx, hashAlgo_en) == CRYPTO_HASH_SUCCESS)
+            {
+                *ptr_devCtx = &cbShaOnHw;
+            }
+            else
+            {
+                lCrypto_CryptoCb_Wc_ShaRelease();
+            }
+        }
+    }
+
+    if (*ptr_devCtx == &cbShaOnHw)
+    {
+        if (cbShaOwner != ptr_devCtx)
+        {
+            /* Copy of a stream held by the engine */
+            ret = BAD_STATE_E;
+        }
+        else
+        {
+            ret = 0;
+            if ((ptr_info->hash.in != NULL) && (ptr_info->hash.inSz > 0U))
+            {
+                if (Crypto_Hash_Hw_Sha_Update(&cbShaCtx, (uint8_t*)ptr_info->hash.in,
+                        ptr_info->hash.inSz) != CRYPTO_HASH_SUCCESS)
+                {
+                    ret = WC_HW_E;
+                }
+            }
+            if (ptr_info->hash.digest != NULL)
+            {
+                /* MISRA C-2012 deviation block start */
+                /* MISRA C-2012 Rule 11.3 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_3_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.3" "H3_MISRAC_2012_R_11_3_DR_1"
+                if ((ret == 0) && (Crypto_Hash_Hw_Sha_Final(&cbShaCtx,
+                        (uint8_t*)digest) != CRYPTO_HASH_SUCCESS))
+                {
+                    ret = WC_HW_E;
+                }
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.3"
+#pragma GCC diagnostic pop
+                /* MISRA C-2012 deviation block end */
+                if (ret == 0)
+                {
+                    (void) memcpy(ptr_info->hash.digest, digest, digestSize);
+                }
+                lCrypto_CryptoCb_Wc_ShaRelease();
+                *ptr_devCtx = NULL;
+            }
+        }
+    }
+    else if (ptr_info->hash.digest != NULL)
+    {
+        /* wolfCrypt finishes the stream in software */
+        *ptr_devCtx = NULL;
+    }
+    else
+    {
+        //do nothing
+    }
+
+    return ret;
+}
+#endif /* CRYPTO_CRYPTOCB_HW_SHA */
+
+#if defined(CRYPTO_CRYPTOCB_HW_ECDSA) || defined(CRYPTO_CRYPTOCB_HW_ECDH)
+/* Curve of the hardware wrappers for a wolfCrypt key */
+static crypto_EccCurveType_E lCrypto_CryptoCb_Wc_EccCurve(const ecc_key *ptr_key)
+{
+    crypto_EccCurveType_E curveType_en = CRYPTO_ECC_CURVE_INVALID;
+    int curve;
+
+    if ((ptr_key != NULL) && (ptr_key->dp != NULL) &&
+        (ptr_key->dp->size <= (int)CRYPTO_CRYPTOCB_ECC_MAX_SIZE))
+    {
+        for (curve = 1; curve < (int)CRYPTO_ECC_CURVE_MAX; curve++)
+        {
+            if (Crypto_Common_Wc_Ecc_GetWcCurveId((crypto_EccCurveType_E)curve) ==
+                    ptr_key->dp->id)
+            {
+                curveType_en = (crypto_EccCurveType_E)curve;
+                break;
+            }
+        }
+    }
+
+    return curveType_en;
+}
+#endif
+
+#ifdef CRYPTO_CRYPTOCB_HW_ECDSA
+/* The CPKCC draws its own nonce: a key given one by wc_ecc_sign_set_k or
+ * set up for deterministic signatures is signed in software */
+static bool lCrypto_CryptoCb_Wc_EccHasNonce(const ecc_key *ptr_key)
+{
+    bool hasNonce = false;
+
+#if defined(WOLFSSL_ECDSA_SET_K) || defined(WOLFSSL_ECDSA_SET_K_ONE_LOOP) || \
+    defined(WOLFSSL_ECDSA_DETERMINISTIC_K) || \
+    defined(WOLFSSL_ECDSA_DETERMINISTIC_K_VARIANT)
+    #ifndef WOLFSSL_NO_MALLOC
+    hasNonce = (ptr_key->sign_k != NULL);
+    #else
+    hasNonce = (ptr_key->sign_k_set != 0U);
+    #endif
+#endif
+#if defined(WOLFSSL_ECDSA_DETERMINISTIC_K) || \
+    defined(WOLFSSL_ECDSA_DETERMINISTIC_K_VARIANT)
+    hasNonce = hasNonce || (ptr_key->deterministic != 0U);
+#endif
+
+    return hasNonce;
+}
+
+static int lCrypto_CryptoCb_Wc_EccSign(wc_CryptoInfo *ptr_info)
+{
+    ecc_key *ptr_key = ptr_info->pk.eccsign.key;
+    crypto_EccCurveType_E curveType_en = lCrypto_CryptoCb_Wc_EccCurve(ptr_key);
+    uint8_t privKey[CRYPTO_CRYPTOCB_ECC_MAX_SIZE];
+    uint8_t sig[2U * CRYPTO_CRYPTOCB_ECC_MAX_SIZE];
+    word32 keySize;
+    word32 privKeyLen;
+    word32 hashLen;
+    crypto_DigiSign_Status_E status = CRYPTO_DIGISIGN_ERROR_FAIL;
+    int ret = CRYPTOCB_UNAVAILABLE;
+
+    if ((curveType_en == CRYPTO_ECC_CURVE_INVALID) || (ptr_key->type == ECC_PUBLICKEY) ||
+        lCrypto_CryptoCb_Wc_EccHasNonce(ptr_key))
+    {
+        return CRYPTOCB_UNAVAILABLE;
+    }
+
+    keySize = (word32)ptr_key->dp->size;
+    privKeyLen = keySize;
+    if (wc_ecc_export_private_only(ptr_key, privKey, &privKeyLen) != 0)
+    {
+        return CRYPTOCB_UNAVAILABLE;
+    }
+
+    /* Leftmost bytes of a hash longer than the order, as wolfCrypt does for
+     * the curves whose order is a whole number of bytes */
+    hashLen = ptr_info->pk.eccsign.inlen;
+    if (hashLen > keySize)
+    {
+        hashLen = keySize;
+    }
+
+    if (Crypto_CryptoCb_Wc_EngineClaim(CRYPTO_CRYPTOCB_ENGINE_CPKCC))
+    {
+        status = Crypto_DigiSign_Ecdsa_Hw_Sign((uint8_t*)ptr_info->pk.eccsign.in,
+            hashLen, sig, 2U * keySize, privKey, privKeyLen, curveType_en);
+        Crypto_CryptoCb_Wc_EngineRelease(CRYPTO_CRYPTOCB_ENGINE_CPKCC);
+    }
+    ForceZero(privKey, sizeof(privKey));
+
+    if (status == CRYPTO_DIGISIGN_SUCCESS)
+    {
+        ret = wc_ecc_rs_raw_to_sig(sig, keySize, &sig[keySize], keySize,
+            ptr_info->pk.eccsign.out, ptr_info->pk.eccsign.outlen);
+    }
+
+    return ret;
+}
+
+static int lCrypto_CryptoCb_Wc_EccVerify(wc_CryptoInfo *ptr_info)
+{
+    ecc_key *ptr_key = ptr_info->pk.eccverify.key;
+    crypto_EccCurveType_E curveType_en = lCrypto_CryptoCb_Wc_EccCurve(ptr_key);
+    uint8_t pubKey[1U + (2U * CRYPTO_CRYPTOCB_ECC_MAX_SIZE)];
+    uint8_t sig[2U * CRYPTO_CRYPTOCB_ECC_MAX_SIZE] = {0};
+    word32 keySize;
+    word32 pubKeyLen = sizeof(pubKey);
+    word32 rLen;
+    word32 sLen;
+    word32 hashLen;
+    int8_t verifyStatus = 0;
+    crypto_DigiSign_Status_E status = CRYPTO_DIGISIGN_ERROR_FAIL;
+    int ret = CRYPTOCB_UNAVAILABLE;
+
+    if ((curveType_en == CRYPTO_ECC_CURVE_INVALID) ||
+        (ptr_key->type == ECC_PRIVATEKEY_ONLY))
+    {
+        return CRYPTOCB_UNAVAILABLE;
+    }
+
+    keySize = (word32)ptr_key->dp->size;
+    rLen = keySize;
+    sLen = keySize;
+    if ((wc_ecc_export_x963(ptr_key, pubKey, &pubKeyLen) != 0) ||
+        (wc_ecc_sig_to_rs(ptr_info->pk.eccverify.sig, ptr_info->pk.eccverify.siglen,
+            sig, &rLen, &sig[keySize], &sLen) != 0))
+    {
+        return CRYPTOCB_UNAVAILABLE;
+    }
+
+    /* r and s right aligned on the key size */
+    (void) memmove(&sig[keySize + keySize - sLen], &sig[keySize], sLen);
+    (void) memset(&sig[keySize], 0, keySize - sLen);
+    (void) memmove(&sig[keySize - rLen], sig, rLen);
+    (void) memset(sig, 0, keySize - rLen);
+
+    hashLen = ptr_info->pk.eccverify.hashlen;
+    if (hashLen > keySize)
+    {
+        hashLen = keySize;
+    }
+
+    /* Once the CPKCL is ready a failure is a signature mismatch */
+    if ((DRV_CRYPTO_ECC_CheckCpkcl() == CRYPTO_CPKCL_RESULT_INIT_SUCCESS) &&
+        Crypto_CryptoCb_Wc_EngineClaim(CRYPTO_CRYPTOCB_ENGINE_CPKCC))
+    {
+        status = Crypto_DigiSign_Ecdsa_Hw_Verify((uint8_t*)ptr_info->pk.eccverify.hash,
+            hashLen, sig, 2U * keySize, pubKey, pubKeyLen, &verifyStatus,
+            curveType_en);
+        Crypto_CryptoCb_Wc_EngineRelease(CRYPTO_CRYPTOCB_ENGINE_CPKCC);
+
+        if ((status == CRYPTO_DIGISIGN_SUCCESS) || (status == CRYPTO_DIGISIGN_ERROR_FAIL))
+        {
+            *ptr_info->pk.eccverify.res = (verifyStatus == 1) ? 1 : 0;
+            ret = 0;
+        }
+    }
+
+    return ret;
+}
+#endif /* CRYPTO_CRYPTOCB_HW_ECDSA */
+
+#ifdef CRYPTO_CRYPTOCB_HW_ECDH
+static int lCrypto_CryptoCb_Wc_Ecdh(wc_CryptoInfo *ptr_info)
+{
+    ecc_key *ptr_privKey = ptr_info->pk.ecdh.private_key;
+    crypto_EccCurveType_E curveType_en = lCrypto_CryptoCb_Wc_EccCurve(ptr_privKey);
+    uint8_t privKey[CRYPTO_CRYPTOCB_ECC_MAX_SIZE];
+    uint8_t pubKey[1U + (2U * CRYPTO_CRYPTOCB_ECC_MAX_SIZE)];
+    uint8_t secret[CRYPTO_CRYPTOCB_ECC_MAX_SIZE];
+    word32 keySize;
+    word32 privKeyLen;
+    word32 pubKeyLen = sizeof(pubKey);
+    crypto_Kas_Status_E status = CRYPTO_KAS_ERROR_FAIL;
+    int ret = CRYPTOCB_UNAVAILABLE;
+
+    if ((curveType_en == CRYPTO_ECC_CURVE_INVALID) ||
+        (ptr_privKey->type == ECC_PUBLICKEY) ||
+        (lCrypto_CryptoCb_Wc_EccCurve(ptr_info->pk.ecdh.public_key) != curveType_en))
+    {
+        return CRYPTOCB_UNAVAILABLE;
+    }
+
+    keySize = (word32)ptr_privKey->dp->size;
+    privKeyLen = keySize;
+    if ((*ptr_info->pk.ecdh.outlen < keySize) ||
+        (wc_ecc_export_x963(ptr_info->pk.ecdh.public_key, pubKey, &pubKeyLen) != 0) ||
+        (wc_ecc_export_private_only(ptr_privKey, privKey, &privKeyLen) != 0))
+    {
+        return CRYPTOCB_UNAVAILABLE;
+    }
+
+    if (Crypto_CryptoCb_Wc_EngineClaim(CRYPTO_CRYPTOCB_ENGINE_CPKCC))
+    {
+        status = Crypto_Kas_Ecdh_Hw_SharedSecret(privKey, privKeyLen, pubKey,
+            pubKeyLen, secret, keySize, curveType_en);
+        Crypto_CryptoCb_Wc_EngineRelease(CRYPTO_CRYPTOCB_ENGINE_CPKCC);
+    }
+    ForceZero(privKey, sizeof(privKey));
+
+    if (status == CRYPTO_KAS_SUCCESS)
+    {
+        (void) memcpy(ptr_info->pk.ecdh.out, secret, keySize);
+        *ptr_info->pk.ecdh.outlen = keySize;
+        ret = 0;
+    }
+    ForceZero(secret, sizeof(secret));
+
+    return ret;
+}
+#endif /* CRYPTO_CRYPTOCB_HW_ECDH */
+
+#if defined(CRYPTO_CRYPTOCB_HW_AES) || defined(CRYPTO_CRYPTOCB_HW_AES_GCM)
+/* wolfCrypt keeps the raw key only for an Aes object set up with a device */
+static bool lCrypto_CryptoCb_Wc_AesHasKey(const Aes *ptr_aes)
+{
+    return (ptr_aes != NULL) && (ptr_aes->devId == CRYPTO_CRYPTOCB_WC_DEVID) &&
+        ((ptr_aes->keylen == 16) || (ptr_aes->keylen == 24) || (ptr_aes->keylen == 32));
+}
+#endif
+
+#ifdef CRYPTO_CRYPTOCB_HW_AES
+static int lCrypto_CryptoCb_Wc_Aes(wc_CryptoInfo *ptr_info)
+{
+    Aes *ptr_aes = NULL;
+    uint8_t *ptr_out = NULL;
+    const uint8_t *ptr_in = NULL;
+    word32 size = 0;
+    uint8_t *ptr_iv = NULL;
+    uint8_t nextIv[CRYPTO_CRYPTOCB_AES_BLOCK_SIZE];
+    crypto_Sym_OpModes_E opMode_en = CRYPTO_SYM_OPMODE_INVALID;
+    crypto_Sym_Status_E status = CRYPTO_SYM_ERROR_CIPFAIL;
+    int ret = CRYPTOCB_UNAVAILABLE;
+
+    if (ptr_info->cipher.type == (int)WC_CIPHER_AES_ECB)
+    {
+        ptr_aes = ptr_info->cipher.aesecb.aes;
+        ptr_out = ptr_info->cipher.aesecb.out;
+        ptr_in = ptr_info->cipher.aesecb.in;
+        size = ptr_info->cipher.aesecb.sz;
+        opMode_en = CRYPTO_SYM_OPMODE_ECB;
+    }
+    else if (ptr_info->cipher.type == (int)WC_CIPHER_AES_CBC)
+    {
+        ptr_aes = ptr_info->cipher.aescbc.aes;
+        ptr_out = ptr_info->cipher.aescbc.out;
+        ptr_in = ptr_info->cipher.aescbc.in;
+        size = ptr_info->cipher.aescbc.sz;
+        opMode_en = CRYPTO_SYM_OPMODE_CBC;
+    }
+    else
+    {
+        return CRYPTOCB_UNAVAILABLE;
+    }
+
+    if ((!lCrypto_CryptoCb_Wc_AesHasKey(ptr_aes)) || (size == 0U) ||
+        ((size % CRYPTO_CRYPTOCB_AES_BLOCK_SIZE) != 0U))
+    {
+        return CRYPTOCB_UNAVAILABLE;
+    }
+
+    if (opMode_en == CRYPTO_SYM_OPMODE_CBC)
+    {
+        /* MISRA C-2012 deviation block start */
+        /* MISRA C-2012 Rule 11.3 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_3_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.3" "H3_MISRAC_2012_R_11_3_DR_1"
+        ptr_iv = (uint8_t*)ptr_aes->reg;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.3"
+#pragma GCC diagnostic pop
+        /* MISRA C-2012 deviation block end */
+
+        /* The last ciphertext block chains to the next call, keep it before
+         * an in place decryption overwrites it */
+        if (ptr_info->cipher.enc == 0)
+        {
+            (void) memcpy(nextIv, &ptr_in[size - CRYPTO_CRYPTOCB_AES_BLOCK_SIZE],
+                CRYPTO_CRYPTOCB_AES_BLOCK_SIZE);
+        }
+    }
+
+    if (Crypto_CryptoCb_Wc_EngineClaim(CRYPTO_CRYPTOCB_ENGINE_AES))
+    {
+        /* MISRA C-2012 deviation block start */
+        /* MISRA C-2012 Rule 11.3 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_3_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.3" "H3_MISRAC_2012_R_11_3_DR_1"
+        if (ptr_info->cipher.enc != 0)
+        {
+            status = Crypto_Sym_Hw_Aes_EncryptDirect(opMode_en, (uint8_t*)ptr_in,
+                size, ptr_out, (uint8_t*)ptr_aes->devKey, ptr_aes->keylen, ptr_iv);
+        }
+        else
+        {
+            status = Crypto_Sym_Hw_Aes_DecryptDirect(opMode_en, (uint8_t*)ptr_in,
+                size, ptr_out, (uint8_t*)ptr_aes->devKey, ptr_aes->keylen, ptr_iv);
+        }
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.3"
+#pragma GCC diagnostic pop
+        /* MISRA C-2012 deviation block end */
+        Crypto_CryptoCb_Wc_EngineRelease(CRYPTO_CRYPTOCB_ENGINE_AES);
+    }
+
+    if (status == CRYPTO_SYM_CIPHER_SUCCESS)
+    {
+        if (ptr_iv != NULL)
+        {
+            if (ptr_info->cipher.enc != 0)
+            {
+                (void) memcpy(ptr_iv, &ptr_out[size - CRYPTO_CRYPTOCB_AES_BLOCK_SIZE],
+                    CRYPTO_CRYPTOCB_AES_BLOCK_SIZE);
+            }
+            else
+            {
+                (void) memcpy(ptr_iv, nextIv, CRYPTO_CRYPTOCB_AES_BLOCK_SIZE);
+            }
+        }
+        ret = 0;
+    }
+
+    return ret;
+}
+#endif /* CRYPTO_CRYPTOCB_HW_AES */
+
+#ifdef CRYPTO_CRYPTOCB_HW_AES_GCM
+static int lCrypto_CryptoCb_Wc_AesGcm(wc_CryptoInfo *ptr_info)
+{
+    crypto_Aead_Status_E status = CRYPTO_AEAD_ERROR_CIPFAIL;
+    int ret = CRYPTOCB_UNAVAILABLE;
+
+    if (ptr_info->cipher.enc != 0)
+    {
+        Aes *ptr_aes = ptr_info->cipher.aesgcm_enc.aes;
+
+        if (lCrypto_CryptoCb_Wc_AesHasKey(ptr_aes) &&
+            Crypto_CryptoCb_Wc_EngineClaim(CRYPTO_CRYPTOCB_ENGINE_AES))
+        {
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.3 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_3_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.3" "H3_MISRAC_2012_R_11_3_DR_1"
+            status = Crypto_Aead_Hw_AesGcm_EncryptAuthDirect(
+                (uint8_t*)ptr_info->cipher.aesgcm_enc.in, ptr_info->cipher.aesgcm_enc.sz,
+                ptr_info->cipher.aesgcm_enc.out, (uint8_t*)ptr_aes->devKey,
+                ptr_aes->keylen, (uint8_t*)ptr_info->cipher.aesgcm_enc.iv,
+                ptr_info->cipher.aesgcm_enc.ivSz,
+                (uint8_t*)ptr_info->cipher.aesgcm_enc.authIn,
+                ptr_info->cipher.aesgcm_enc.authInSz,
+                ptr_info->cipher.aesgcm_enc.authTag,
+                ptr_info->cipher.aesgcm_enc.authTagSz);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.3"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            Crypto_CryptoCb_Wc_EngineRelease(CRYPTO_CRYPTOCB_ENGINE_AES);
+        }
+    }
+    else
+    {
+        Aes *ptr_aes = ptr_info->cipher.aesgcm_dec.aes;
+
+        if (lCrypto_CryptoCb_Wc_AesHasKey(ptr_aes) &&
+            Crypto_CryptoCb_Wc_EngineClaim(CRYPTO_CRYPTOCB_ENGINE_AES))
+        {
+            /* MISRA C-2012 deviation block start */
+            /* MISRA C-2012 Rule 11.3 deviated: 1. Deviation record ID - H3_MISRAC_2012_R_11_3_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.3" "H3_MISRAC_2012_R_11_3_DR_1"
+            /* Tag checked before any plaintext is written */
+            status = Crypto_Aead_Hw_AesGcm_DecryptVerifyDirect(
+                (uint8_t*)ptr_info->cipher.aesgcm_dec.in, ptr_info->cipher.aesgcm_dec.sz,
+                ptr_info->cipher.aesgcm_dec.out, (uint8_t*)ptr_aes->devKey,
+                ptr_aes->keylen, (uint8_t*)ptr_info->cipher.aesgcm_dec.iv,
+                ptr_info->cipher.aesgcm_dec.ivSz,
+                (uint8_t*)ptr_info->cipher.aesgcm_dec.authIn,
+                ptr_info->cipher.aesgcm_dec.authInSz,
+                (uint8_t*)ptr_info->cipher.aesgcm_dec.authTag,
+                ptr_info->cipher.aesgcm_dec.authTagSz);
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.3"
+#pragma GCC diagnostic pop
+            /* MISRA C-2012 deviation block end */
+            Crypto_CryptoCb_Wc_EngineRelease(CRYPTO_CRYPTOCB_ENGINE_AES);
+        }
+    }
+
+    if (status == CRYPTO_AEAD_CIPHER_SUCCESS)
+    {
+        ret = 0;
+    }
+    else if (status == CRYPTO_AEAD_ERROR_AUTHFAIL)
+    {
+        ret = AES_GCM_AUTH_E;
+    }
+    else
+    {
+        //do nothing
+    }
+
+    return ret;
+}
+#endif /* CRYPTO_CRYPTOCB_HW_AES_GCM */
+
+#ifdef CRYPTO_CRYPTOCB_HW_TRNG
+static int lCrypto_CryptoCb_Wc_Trng(uint8_t *ptr_out, word32 size)
+{
+    crypto_Rng_Status_E status = CRYPTO_RNG_ERROR_FAIL;
+    int ret = CRYPTOCB_UNAVAILABLE;
+
+    if ((ptr_out != NULL) && (size > 0U) &&
+        Crypto_CryptoCb_Wc_EngineClaim(CRYPTO_CRYPTOCB_ENGINE_TRNG))
+    {
+        status = Crypto_Rng_Hw_Trng_Generate(ptr_out, size);
+        Crypto_CryptoCb_Wc_EngineRelease(CRYPTO_CRYPTOCB_ENGINE_TRNG);
+    }
+
+    if (status == CRYPTO_RNG_SUCCESS)
+    {
+        ret = 0;
+    }
+
+    return ret;
+}
+#endif /* CRYPTO_CRYPTOCB_HW_TRNG */
+
+static int lCrypto_CryptoCb_Wc_Callback(int devId, wc_CryptoInfo *ptr_info, void *ptr_ctx)
+{
+    int ret = CRYPTOCB_UNAVAILABLE;
+    /* Only the objects set up with the device ID reach the engines */
+    int algoType = (devId == CRYPTO_CRYPTOCB_WC_DEVID) ?
+        ptr_info->algo_type : (int)WC_ALGO_TYPE_NONE;
+
+    (void)ptr_ctx;
+
+    switch (algoType)
+    {
+#ifdef CRYPTO_CRYPTOCB_HW_SHA
+        case (int)WC_ALGO_TYPE_HASH:
+            ret = lCrypto_CryptoCb_Wc_Sha(ptr_info);
+            break;
+#endif
+#if defined(CRYPTO_CRYPTOCB_HW_ECDSA) || defined(CRYPTO_CRYPTOCB_HW_ECDH)
+        case (int)WC_ALGO_TYPE_PK:
+    #ifdef CRYPTO_CRYPTOCB_HW_ECDSA
+            if (ptr_info->pk.type == (int)WC_PK_TYPE_ECDSA_SIGN)
+            {
+                ret = lCrypto_CryptoCb_Wc_EccSign(ptr_info);
+            }
+            else if (ptr_info->pk.type == (int)WC_PK_TYPE_ECDSA_VERIFY)
+            {
+                ret = lCrypto_CryptoCb_Wc_EccVerify(ptr_info);
+            }
+            else
+            {
+                //do nothing
+            }
+    #endif
+    #ifdef CRYPTO_CRYPTOCB_HW_ECDH
+            if (ptr_info->pk.type == (int)WC_PK_TYPE_ECDH)
+            {
+                ret = lCrypto_CryptoCb_Wc_Ecdh(ptr_info);
+            }
+    #endif
+            break;
+#endif
+#if defined(CRYPTO_CRYPTOCB_HW_AES) || defined(CRYPTO_CRYPTOCB_HW_AES_GCM)
+        case (int)WC_ALGO_TYPE_CIPHER:
+    #ifdef CRYPTO_CRYPTOCB_HW_AES
+            if ((ptr_info->cipher.type == (int)WC_CIPHER_AES_ECB) ||
+                (ptr_info->cipher.type == (int)WC_CIPHER_AES_CBC))
+            {
+                ret = lCrypto_CryptoCb_Wc_Aes(ptr_info);
+            }
+    #endif
+    #ifdef CRYPTO_CRYPTOCB_HW_AES_GCM
+            if (ptr_info->cipher.type == (int)WC_CIPHER_AES_GCM)
+            {
+                ret = lCrypto_CryptoCb_Wc_AesGcm(ptr_info);
+            }
+    #endif
+            break;
+#endif
+#ifdef CRYPTO_CRYPTOCB_HW_TRNG
+        case (int)WC_ALGO_TYPE_RNG:
+            ret = lCrypto_CryptoCb_Wc_Trng(ptr_info->rng.out, ptr_info->rng.sz);
+            break;
+        case (int)WC_ALGO_TYPE_SEED:
+            ret = lCrypto_CryptoCb_Wc_Trng(ptr_info->seed.seed, ptr_info->seed.sz);
+            break;
+#endif
+        default:
+            ret = CRYPTOCB_UNAVAILABLE;
+            break;
+    }
+
+    if (ret == CRYPTOCB_UNAVAILABLE)
+    {
+        cbSwCount++;
+    }
+    else
+    {
+        cbHwCount++;
+    }
+
+    return ret;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Crypto Callback Interface Implementation
+// *****************************************************************************
+// *****************************************************************************
+
+int Crypto_CryptoCb_Wc_Init(void)
+{
+    int ret = wolfCrypt_Init();
+
+    if (ret == 0)
+    {
+        ret = wc_CryptoCb_RegisterDevice(CRYPTO_CRYPTOCB_WC_DEVID,
+            lCrypto_CryptoCb_Wc_Callback, NULL);
+    }
+
+    if (ret == 0)
+    {
+        cbHwCount = 0;
+        cbSwCount = 0;
+    }
+
+    return ret;
+}
+
+void Crypto_CryptoCb_Wc_Deinit(void)
+{
+    wc_CryptoCb_UnRegisterDevice(CRYPTO_CRYPTOCB_WC_DEVID);
+#ifdef CRYPTO_CRYPTOCB_HW_SHA
+    /* A stream freed before its final would hold the engine for good */
+    if (cbShaOwner != NULL)
+    {
+        lCrypto_CryptoCb_Wc_ShaRelease();
+    }
+#endif
+    (void) wolfCrypt_Cleanup();
+}
+
+bool Crypto_CryptoCb_Wc_EngineClaim(crypto_CryptoCb_Engine_E engine_en)
+{
+    uint32_t primask;
+    bool claimed = false;
+
+    if (engine_en < CRYPTO_CRYPTOCB_ENGINE_MAX)
+    {
+        primask = __get_PRIMASK();
+        __disable_irq();
+        if (!cbEngineBusy[engine_en])
+        {
+            cbEngineBusy[engine_en] = true;
+            claimed = true;
+        }
+        __set_PRIMASK(primask);
+    }
+
+    return claimed;
+}
+
+void Crypto_CryptoCb_Wc_EngineRelease(crypto_CryptoCb_Engine_E engine_en)
+{
+    if (engine_en < CRYPTO_CRYPTOCB_ENGINE_MAX)
+    {
+        cbEngineBusy[engine_en] = false;
+    }
+}
+
+void Crypto_CryptoCb_Wc_GetCounts(uint32_t *ptr_hwCount, uint32_t *ptr_swCount)
+{
+    *ptr_hwCount = cbHwCount;
+    *ptr_swCount = cbSwCount;
+}
+
+#endif /* WOLF_CRYPTO_CB */
@@ -120,7 +120,8 @@ extern "C" {
 #define WC_ECC_NONBLOCK      //JK
 
 #define NO_PWDBASED
-//#define WOLF_CRYPTO_CB     //Provide call-back support 
+#define WOLF_CRYPTO_CB     //Provide call-back support 
+#define CRYPTO_CRYPTOCB_HW_TRNG     //RNG blocks from the TRNG6334, crypto_cryptocb_wc_wrapper.c
 #define WOLFCRYPT_ONLY
 #define HAVE_COMP_KEY        //JK 
 
@@ -28,6 +28,8 @@
 // *****************************************************************************
 
 #include "app.h"
+#include "wolfssl/wolfcrypt/aes.h"
+#include "crypto/wolfcrypt/crypto_cryptocb_wc_wrapper.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -40,6 +42,13 @@
 uint8_t testsPassed;
 uint8_t testsFailed;
 
+/* wolfCrypt AES object of the crypto callback test */
+static Aes cbAes;
+
+/* Blocks of the first call of the crypto callback test, the rest goes in a 
+   second call to check the IV chaining */
+#define APP_CB_FIRST_SIZE    (32U)
+
 // *****************************************************************************
 /* Application Data
 
@@ -390,6 +399,112 @@ void SingleStepDecrypt (AES *aes)
     }
 }
 
+/*******************************************************************************
+  Function:
+    void CryptoCbEncryptDecrypt (AES *aes)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void CryptoCbEncryptDecrypt (AES *aes)
+{
+    uint32_t hwCount = 0;
+    uint32_t swCount = 0;
+    bool registered = false;
+    bool encryptMatch = false;
+    bool decryptMatch = false;
+    int ret;
+
+    (void) memset(aes->symData, 0, aes->symDataSize);
+
+    ret = Crypto_CryptoCb_Wc_Init();
+    registered = (ret == 0);
+    if (ret == 0)
+    {
+        ret = wc_AesInit(&cbAes, NULL, CRYPTO_CRYPTOCB_WC_DEVID);
+    }
+
+    SYSTICK_TimerRestart();
+    uint32_t startTime = 0, endTime = 0;
+    startTime = SYSTICK_TimerCounterGet(); 
+
+    if (ret == 0)
+    {
+        ret = wc_AesSetKey(&cbAes, aes->key, (word32)aes->keySize, aes->iv, 
+            AES_ENCRYPTION);
+    }
+    if (ret == 0)
+    {
+        ret = (aes->aesMode == CRYPTO_SYM_OPMODE_CBC) ?
+            wc_AesCbcEncrypt(&cbAes, aes->symData, aes->pt, APP_CB_FIRST_SIZE) :
+            wc_AesEcbEncrypt(&cbAes, aes->symData, aes->pt, APP_CB_FIRST_SIZE);
+    }
+    if (ret == 0)
+    {
+        ret = (aes->aesMode == CRYPTO_SYM_OPMODE_CBC) ?
+            wc_AesCbcEncrypt(&cbAes, &aes->symData[APP_CB_FIRST_SIZE], 
+                &aes->pt[APP_CB_FIRST_SIZE], aes->ptSize - APP_CB_FIRST_SIZE) :
+            wc_AesEcbEncrypt(&cbAes, &aes->symData[APP_CB_FIRST_SIZE], 
+                &aes->pt[APP_CB_FIRST_SIZE], aes->ptSize - APP_CB_FIRST_SIZE);
+    }
+
+    endTime = SYSTICK_TimerCounterGet();
+    printf("Time elapsed (ms): %f\r\n", (double)(startTime - endTime)/(SYSTICK_FREQ/1000U));
+
+    encryptMatch = (ret == 0) && CompareHexArray(aes->symData, aes->cipher, 
+        aes->cipherSize);
+
+    /* Decrypted in place */
+    if (ret == 0)
+    {
+        ret = wc_AesSetKey(&cbAes, aes->key, (word32)aes->keySize, aes->iv, 
+            AES_DECRYPTION);
+    }
+    if (ret == 0)
+    {
+        ret = (aes->aesMode == CRYPTO_SYM_OPMODE_CBC) ?
+            wc_AesCbcDecrypt(&cbAes, aes->symData, aes->symData, APP_CB_FIRST_SIZE) :
+            wc_AesEcbDecrypt(&cbAes, aes->symData, aes->symData, APP_CB_FIRST_SIZE);
+    }
+    if (ret == 0)
+    {
+        ret = (aes->aesMode == CRYPTO_SYM_OPMODE_CBC) ?
+            wc_AesCbcDecrypt(&cbAes, &aes->symData[APP_CB_FIRST_SIZE], 
+                &aes->symData[APP_CB_FIRST_SIZE], aes->cipherSize - APP_CB_FIRST_SIZE) :
+            wc_AesEcbDecrypt(&cbAes, &aes->symData[APP_CB_FIRST_SIZE], 
+                &aes->symData[APP_CB_FIRST_SIZE], aes->cipherSize - APP_CB_FIRST_SIZE);
+    }
+
+    decryptMatch = (ret == 0) && CompareHexArray(aes->symData, aes->pt, 
+        aes->ptSize);
+
+    if (registered)
+    {
+        wc_AesFree(&cbAes);
+        Crypto_CryptoCb_Wc_GetCounts(&hwCount, &swCount);
+        Crypto_CryptoCb_Wc_Deinit();
+    }
+
+    if (ret != 0)
+    {
+        printf("wolfCrypt AES failed, status: %d\r\n", ret);
+        testsFailed++;
+    }
+    else if ((!encryptMatch) || (!decryptMatch) || (hwCount != 4U))
+    {
+        printf("Callbacks on the AES: %d, left to software: %d\r\n", 
+            (int)hwCount, (int)swCount);
+        testsFailed++;
+        printf("Test unsuccessful\r\n");
+    }
+    else
+    {
+        testsPassed++;
+        printf("Test successful\r\n");
+    }
+}
+
 // *****************************************************************************
 // *****************************************************************************
 // Section: Application Initialization and State Machine Functions
@@ -475,6 +590,9 @@ void APP_Tasks(void) {
                 printf("\r\n-----------AES-CTR wolfCrypt Wrapper-------------\r\n");
                 AES_CTR_Test(CRYPTO_HANDLER_SW_WOLFCRYPT);
                 
+                printf("\r\n-----------AES wolfCrypt Crypto Callback-------------\r\n");
+                AES_CryptoCb_Test();
+                
                 appData.isTestedAes      = true;
                 
                 printf("\r\n-----------AES-KW wolfCrypt Wrapper-------------\r\n");
@@ -770,6 +770,73 @@ void AES_KeyWrap_Test (crypto_HandlerType_E cryptoHandler)
     isKeyWrap = false;
 }
 
+/*******************************************************************************
+  Function:
+    void AES_CryptoCb_Test (void)
+
+  Remarks:
+    See prototype in app_config.h.
+ */
+
+void AES_CryptoCb_Test (void)
+{
+    st_Crypto_Sym_BlockCtx  Sym_Block_Ctx;
+
+    AES ecb128 = {
+        .Sym_Block_Ctx      = Sym_Block_Ctx,
+        .handler            = CRYPTO_HANDLER_SW_WOLFCRYPT,
+        .aesMode            = CRYPTO_SYM_OPMODE_ECB,
+        .iv                 = NULL,
+        .key                = Key_AES_ECB128,
+        .keySize            = sizeof(Key_AES_ECB128),
+        .pt                 = Plaintext_AES_ECB,
+        .ptSize             = sizeof(Plaintext_AES_ECB),
+        .symData            = symData_AES_128,
+        .symDataSize        = sizeof(symData_AES_128),
+        .cipher             = Ciphertext_AES_ECB128,
+        .cipherSize         = sizeof(Ciphertext_AES_ECB128)
+    };
+
+    printf("\r\nAES-ECB 128 wc_Aes Encrypt->Decrypt\r\n");
+    CryptoCbEncryptDecrypt(&ecb128);
+
+    AES cbc128 = {
+        .Sym_Block_Ctx      = Sym_Block_Ctx,
+        .handler            = CRYPTO_HANDLER_SW_WOLFCRYPT,
+        .aesMode            = CRYPTO_SYM_OPMODE_CBC,
+        .iv                 = AES_CBC_IV,
+        .key                = Key_AES_CBC128,
+        .keySize            = sizeof(Key_AES_CBC128),
+        .pt                 = Plaintext_AES_CBC,
+        .ptSize             = sizeof(Plaintext_AES_CBC),
+        .symData            = symData_AES_128,
+        .symDataSize        = sizeof(symData_AES_128),
+        .cipher             = Ciphertext_AES_CBC128,
+        .cipherSize         = sizeof(Ciphertext_AES_CBC128)
+    };
+
+    printf("\r\nAES-CBC 128 wc_Aes Encrypt->Decrypt\r\n");
+    CryptoCbEncryptDecrypt(&cbc128);
+
+    AES cbc256 = {
+        .Sym_Block_Ctx      = Sym_Block_Ctx,
+        .handler            = CRYPTO_HANDLER_SW_WOLFCRYPT,
+        .aesMode            = CRYPTO_SYM_OPMODE_CBC,
+        .iv                 = AES_CBC_IV,
+        .key                = Key_AES_CBC256,
+        .keySize            = sizeof(Key_AES_CBC256),
+        .pt                 = Plaintext_AES_CBC,
+        .ptSize             = sizeof(Plaintext_AES_CBC),
+        .symData            = symData_AES_256,
+        .symDataSize        = sizeof(symData_AES_256),
+        .cipher             = Ciphertext_AES_CBC256,
+        .cipherSize         = sizeof(Ciphertext_AES_CBC256)
+    };
+
+    printf("\r\nAES-CBC 256 wc_Aes Encrypt->Decrypt\r\n");
+    CryptoCbEncryptDecrypt(&cbc256);
+}
+
 /*******************************************************************************
   Function:
     bool CompareHexArray (uint8_t *arr1, uint8_t *arr2, size_t size)
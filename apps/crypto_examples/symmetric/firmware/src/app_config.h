@@ -223,6 +223,36 @@ extern "C" {
     */
     void SingleStepDecrypt (AES *ctx);
 
+    // *****************************************************************************
+    /**
+      @Function
+        void CryptoCbEncryptDecrypt (AES *ctx)
+
+      @Summary
+        Runs AES through wolfCrypt with the crypto callback device registered.
+
+      @Description
+        This function encrypts the plaintext and decrypts the result in place 
+        with wc_Aes set up on the callback device, each in two calls so the 
+        CBC IV chains from one to the next. Results must match the test vectors
+        and all four calls must have run on the AES engine.
+
+      @Precondition
+        The AES context (AES structure) must hold an ECB or CBC test vector of 
+        more than two blocks.
+
+      @Parameters
+        @param ctx Pointer to the AES context (AES structure), the handler is 
+                  unused.
+
+      @Returns
+        None.
+
+      @Remarks
+        The device is unregistered on return.
+    */
+    void CryptoCbEncryptDecrypt (AES *ctx);
+
     // *****************************************************************************
     /**
       @Function
@@ -335,6 +365,33 @@ extern "C" {
 
     void AES_KeyWrap_Test (crypto_HandlerType_E cryptoHandler);
 
+    // *****************************************************************************
+    /**
+      @Function
+        void AES_CryptoCb_Test (void)
+
+      @Summary
+        Runs ECB and CBC test vectors through the wolfCrypt crypto callback.
+
+      @Description
+        This function runs the AES-ECB 128 and AES-CBC 128 and 256 test vectors
+        through wc_Aes with the crypto callback device registered.
+
+      @Precondition
+        None.
+
+      @Parameters
+        None.
+
+      @Returns
+        None.
+
+      @Remarks
+        None.
+    */
+
+    void AES_CryptoCb_Test (void);
+
     // *****************************************************************************
     /**
       @Function
@@ -74,7 +74,7 @@ typedef struct
     crypto_HandlerType_E symHandlerType_en;
     uint8_t *ptr_key;
     uint8_t *ptr_initVect;
-    uint8_t arr_symDataCtx[70];
+    uint8_t arr_symDataCtx[136]__attribute__((aligned (4)));  //Holds the Cortex-M4 ChaCha20 context and its spare key stream
 }st_Crypto_Sym_StreamCtx;
 	
 typedef struct 
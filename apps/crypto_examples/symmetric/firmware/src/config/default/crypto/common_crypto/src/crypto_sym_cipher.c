@@ -963,7 +963,7 @@ crypto_Sym_Status_E Crypto_Sym_ChaCha20_Cipher(st_Crypto_Sym_StreamCtx *ptr_chaC
         switch(ptr_chaChaCtx_st->symHandlerType_en)
         {
             case CRYPTO_HANDLER_SW_WOLFCRYPT:
-                ret_chaCha20Stat_en = Crypto_Sym_Wc_ChaChaUpdate(ptr_chaChaCtx_st, ptr_inputData, dataLen, ptr_outData);
+                ret_chaCha20Stat_en = Crypto_Sym_Wc_ChaChaUpdate(ptr_chaChaCtx_st->arr_symDataCtx, ptr_inputData, dataLen, ptr_outData);
                 break;
             case CRYPTO_HANDLER_HW_INTERNAL:
                 
@@ -322,6 +322,10 @@ void DRV_CRYPTO_AES_WriteGcmHash(uint32_t *ghashBuffer);
 
 void DRV_CRYPTO_AES_ReadGcmH(uint32_t *hBuffer);
 
+void DRV_CRYPTO_AES_SetOwner(const void *owner);
+
+bool DRV_CRYPTO_AES_IsOwner(const void *owner);
+
 
 // DOM-IGNORE-BEGIN
 #ifdef __cplusplus  // Provide C++ Compatibility
@@ -0,0 +1,440 @@
+/*******************************************************************************
+  MPLAB Harmony Application Source File
+
+  Company:
+    Microchip Technology Inc.
+
+  File Name:
+    crypto_chacha_poly_cm4.c
+
+  Summary:
+    This file contains the source code for the MPLAB Harmony application.
+
+  Description:
+    This file contains the Cortex-M4 ChaCha20 and Poly1305 kernels (RFC 8439).
+    The portable wolfCrypt code keeps the ChaCha20 state in an array and, with
+    NO_INLINE, calls a function for every rotate; here the sixteen state words
+    are locals so the compiler keeps them in registers and folds the rotates
+    into the barrel shifter. Poly1305 works in radix 2^32 so each row of the
+    130-bit multiply is a chain of four UMAAL instructions.
+*******************************************************************************/
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Included Files
+// *****************************************************************************
+// *****************************************************************************
+#include <string.h>
+#include "crypto/common_crypto/crypto_common.h"
+#include "crypto/wolfcrypt/crypto_chacha_poly_cm4.h"
+
+#ifdef CRYPTO_CHACHA_POLY_CM4
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Global Data Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+#define CRYPTO_CHACHA20_CM4_ROTL(x, n)  (((x) << (n)) | ((x) >> (32U - (n))))
+
+#define CRYPTO_CHACHA20_CM4_QR(a, b, c, d)                                  \
+    do {                                                                    \
+        (a) += (b); (d) ^= (a); (d) = CRYPTO_CHACHA20_CM4_ROTL((d), 16U);   \
+        (c) += (d); (b) ^= (c); (b) = CRYPTO_CHACHA20_CM4_ROTL((b), 12U);   \
+        (a) += (b); (d) ^= (a); (d) = CRYPTO_CHACHA20_CM4_ROTL((d), 8U);    \
+        (c) += (d); (b) ^= (c); (b) = CRYPTO_CHACHA20_CM4_ROTL((b), 7U);    \
+    } while (false)
+
+/* (hi:lo) = a * b + lo + hi, the result always fits in 64 bits */
+#if defined(__ARM_ARCH_7EM__)
+#define CRYPTO_POLY1305_CM4_UMAAL(lo, hi, a, b)                             \
+    __asm__ ("umaal %0, %1, %2, %3" : "+r" (lo), "+r" (hi) : "r" (a), "r" (b))
+#else
+#define CRYPTO_POLY1305_CM4_UMAAL(lo, hi, a, b)                             \
+    do {                                                                    \
+        uint64_t t_ = ((uint64_t)(a) * (b)) + (lo) + (hi);                  \
+        (lo) = (uint32_t)t_;                                                \
+        (hi) = (uint32_t)(t_ >> 32U);                                       \
+    } while (false)
+#endif
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: File scope functions
+// *****************************************************************************
+// *****************************************************************************
+
+static uint32_t lCrypto_ChaChaPoly_Cm4_LoadLe32(const uint8_t *ptr_data)
+{
+    return ((uint32_t)ptr_data[0]) | ((uint32_t)ptr_data[1] << 8U) |
+           ((uint32_t)ptr_data[2] << 16U) | ((uint32_t)ptr_data[3] << 24U);
+}
+
+static void lCrypto_ChaChaPoly_Cm4_StoreLe32(uint8_t *ptr_data, uint32_t value)
+{
+    ptr_data[0] = (uint8_t)(value & 0xFFUL);
+    ptr_data[1] = (uint8_t)((value >> 8U) & 0xFFUL);
+    ptr_data[2] = (uint8_t)((value >> 16U) & 0xFFUL);
+    ptr_data[3] = (uint8_t)((value >> 24U) & 0xFFUL);
+}
+
+static void lCrypto_ChaCha20_Cm4_Block(const uint32_t *ptr_in, uint32_t *ptr_out)
+{
+    uint32_t x0 = ptr_in[0], x1 = ptr_in[1], x2 = ptr_in[2], x3 = ptr_in[3];
+    uint32_t x4 = ptr_in[4], x5 = ptr_in[5], x6 = ptr_in[6], x7 = ptr_in[7];
+    uint32_t x8 = ptr_in[8], x9 = ptr_in[9], x10 = ptr_in[10], x11 = ptr_in[11];
+    uint32_t x12 = ptr_in[12], x13 = ptr_in[13], x14 = ptr_in[14], x15 = ptr_in[15];
+    uint32_t round;
+
+    for (round = 0; round < 10UL; round++)
+    {
+        /* Column round */
+        CRYPTO_CHACHA20_CM4_QR(x0, x4, x8, x12);
+        CRYPTO_CHACHA20_CM4_QR(x1, x5, x9, x13);
+        CRYPTO_CHACHA20_CM4_QR(x2, x6, x10, x14);
+        CRYPTO_CHACHA20_CM4_QR(x3, x7, x11, x15);
+
+        /* Diagonal round */
+        CRYPTO_CHACHA20_CM4_QR(x0, x5, x10, x15);
+        CRYPTO_CHACHA20_CM4_QR(x1, x6, x11, x12);
+        CRYPTO_CHACHA20_CM4_QR(x2, x7, x8, x13);
+        CRYPTO_CHACHA20_CM4_QR(x3, x4, x9, x14);
+    }
+
+    ptr_out[0] = x0 + ptr_in[0];
+    ptr_out[1] = x1 + ptr_in[1];
+    ptr_out[2] = x2 + ptr_in[2];
+    ptr_out[3] = x3 + ptr_in[3];
+    ptr_out[4] = x4 + ptr_in[4];
+    ptr_out[5] = x5 + ptr_in[5];
+    ptr_out[6] = x6 + ptr_in[6];
+    ptr_out[7] = x7 + ptr_in[7];
+    ptr_out[8] = x8 + ptr_in[8];
+    ptr_out[9] = x9 + ptr_in[9];
+    ptr_out[10] = x10 + ptr_in[10];
+    ptr_out[11] = x11 + ptr_in[11];
+    ptr_out[12] = x12 + ptr_in[12];
+    ptr_out[13] = x13 + ptr_in[13];
+    ptr_out[14] = x14 + ptr_in[14];
+    ptr_out[15] = x15 + ptr_in[15];
+}
+
+static uint8_t lCrypto_ChaCha20_Cm4_KeyStreamByte(const uint32_t *ptr_keyStream, uint32_t pos)
+{
+    return (uint8_t)((ptr_keyStream[pos / 4UL] >> (8UL * (pos % 4UL))) & 0xFFUL);
+}
+
+static void lCrypto_ChaCha20_Cm4_Xor64(uint8_t *ptr_out, const uint8_t *ptr_in, const uint32_t *ptr_keyStream)
+{
+    uint32_t i;
+
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    if ((((uintptr_t)ptr_out | (uintptr_t)ptr_in) & 3UL) == 0UL)
+    {
+/* MISRA C-2012 deviation block start */
+/* MISRA C-2012 Rule 11.3 deviated: 2. Deviation record ID - H3_MISRAC_2012_R_11_3_DR_1 */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunknown-pragmas"
+#pragma coverity compliance block deviate "MISRA C-2012 Rule 11.3" "H3_MISRAC_2012_R_11_3_DR_1"
+        uint32_t *ptr_outWord = (uint32_t *)ptr_out;
+        const uint32_t *ptr_inWord = (const uint32_t *)ptr_in;
+#pragma coverity compliance end_block "MISRA C-2012 Rule 11.3"
+#pragma GCC diagnostic pop
+/* MISRAC 2012 deviation block end */
+
+        for (i = 0; i < 16UL; i++)
+        {
+            ptr_outWord[i] = ptr_inWord[i] ^ ptr_keyStream[i];
+        }
+    }
+    else
+#endif
+    {
+        for (i = 0; i < 64UL; i++)
+        {
+            ptr_out[i] = ptr_in[i] ^ lCrypto_ChaCha20_Cm4_KeyStreamByte(ptr_keyStream, i);
+        }
+    }
+}
+
+/* Adds the 16-byte blocks to h and multiplies by r modulo 2^130 - 5. h is
+ * kept partially reduced (h[4] < 8) between blocks. */
+static void lCrypto_Poly1305_Cm4_Blocks(CRYPTO_POLY1305_CM4_CTX *ptr_polyCtx, const uint8_t *ptr_data,
+                                        uint32_t dataLen, uint32_t padBit)
+{
+    const uint32_t r0 = ptr_polyCtx->r[0], r1 = ptr_polyCtx->r[1];
+    const uint32_t r2 = ptr_polyCtx->r[2], r3 = ptr_polyCtx->r[3];
+    /* r1..r3 are multiples of 4, so 2^130 = 5 mod p folds r_i into 5*r_i/4 */
+    const uint32_t s1 = r1 + (r1 >> 2U), s2 = r2 + (r2 >> 2U), s3 = r3 + (r3 >> 2U);
+    uint32_t h0 = ptr_polyCtx->h[0], h1 = ptr_polyCtx->h[1], h2 = ptr_polyCtx->h[2];
+    uint32_t h3 = ptr_polyCtx->h[3], h4 = ptr_polyCtx->h[4];
+    uint32_t t0, t1, t2, t3, t4, c;
+    uint64_t d;
+
+    while (dataLen >= 16UL)
+    {
+        /* h += m */
+        d = (uint64_t)h0 + lCrypto_ChaChaPoly_Cm4_LoadLe32(&ptr_data[0]);
+        h0 = (uint32_t)d;
+        d = (uint64_t)h1 + (d >> 32U) + lCrypto_ChaChaPoly_Cm4_LoadLe32(&ptr_data[4]);
+        h1 = (uint32_t)d;
+        d = (uint64_t)h2 + (d >> 32U) + lCrypto_ChaChaPoly_Cm4_LoadLe32(&ptr_data[8]);
+        h2 = (uint32_t)d;
+        d = (uint64_t)h3 + (d >> 32U) + lCrypto_ChaChaPoly_Cm4_LoadLe32(&ptr_data[12]);
+        h3 = (uint32_t)d;
+        h4 += (uint32_t)(d >> 32U) + padBit;
+
+        /* t = h * r, one UMAAL chain per word of h. Carries out of the
+         * fourth column land in t4; its final value is below 2^32. */
+        t0 = 0; t1 = 0; t2 = 0; t3 = 0;
+
+        c = 0;
+        CRYPTO_POLY1305_CM4_UMAAL(t0, c, h0, r0);
+        CRYPTO_POLY1305_CM4_UMAAL(t1, c, h0, r1);
+        CRYPTO_POLY1305_CM4_UMAAL(t2, c, h0, r2);
+        CRYPTO_POLY1305_CM4_UMAAL(t3, c, h0, r3);
+        t4 = c;
+
+        c = 0;
+        CRYPTO_POLY1305_CM4_UMAAL(t0, c, h1, s3);
+        CRYPTO_POLY1305_CM4_UMAAL(t1, c, h1, r0);
+        CRYPTO_POLY1305_CM4_UMAAL(t2, c, h1, r1);
+        CRYPTO_POLY1305_CM4_UMAAL(t3, c, h1, r2);
+        t4 += c;
+
+        c = 0;
+        CRYPTO_POLY1305_CM4_UMAAL(t0, c, h2, s2);
+        CRYPTO_POLY1305_CM4_UMAAL(t1, c, h2, s3);
+        CRYPTO_POLY1305_CM4_UMAAL(t2, c, h2, r0);
+        CRYPTO_POLY1305_CM4_UMAAL(t3, c, h2, r1);
+        t4 += c;
+
+        c = 0;
+        CRYPTO_POLY1305_CM4_UMAAL(t0, c, h3, s1);
+        CRYPTO_POLY1305_CM4_UMAAL(t1, c, h3, s2);
+        CRYPTO_POLY1305_CM4_UMAAL(t2, c, h3, s3);
+        CRYPTO_POLY1305_CM4_UMAAL(t3, c, h3, r0);
+        t4 += c;
+
+        c = 0;
+        CRYPTO_POLY1305_CM4_UMAAL(t1, c, h4, s1);
+        CRYPTO_POLY1305_CM4_UMAAL(t2, c, h4, s2);
+        CRYPTO_POLY1305_CM4_UMAAL(t3, c, h4, s3);
+        t4 += c + (h4 * r0);
+
+        /* Partial reduction: h = (t mod 2^130) + 5 * (t >> 130) */
+        c = (t4 >> 2U) + (t4 & ~3UL);
+        d = (uint64_t)t0 + c;
+        h0 = (uint32_t)d;
+        d = (uint64_t)t1 + (d >> 32U);
+        h1 = (uint32_t)d;
+        d = (uint64_t)t2 + (d >> 32U);
+        h2 = (uint32_t)d;
+        d = (uint64_t)t3 + (d >> 32U);
+        h3 = (uint32_t)d;
+        h4 = (t4 & 3UL) + (uint32_t)(d >> 32U);
+
+        ptr_data = &ptr_data[16];
+        dataLen -= 16UL;
+    }
+
+    ptr_polyCtx->h[0] = h0;
+    ptr_polyCtx->h[1] = h1;
+    ptr_polyCtx->h[2] = h2;
+    ptr_polyCtx->h[3] = h3;
+    ptr_polyCtx->h[4] = h4;
+}
+
+// *****************************************************************************
+// *****************************************************************************
+// Section: Function Definitions
+// *****************************************************************************
+// *****************************************************************************
+
+void Crypto_ChaCha20_Cm4_SetKey(CRYPTO_CHACHA20_CM4_CTX *ptr_chaChaCtx, const uint8_t *ptr_key, uint32_t keySize)
+{
+    uint32_t i;
+
+    if (keySize == CRYPTO_CHACHA20_CM4_KEYSIZE_128)
+    {
+        /* "expand 16-byte k", the key fills both halves */
+        ptr_chaChaCtx->state[0] = 0x61707865UL;
+        ptr_chaChaCtx->state[1] = 0x3120646eUL;
+        ptr_chaChaCtx->state[2] = 0x79622d36UL;
+        ptr_chaChaCtx->state[3] = 0x6b206574UL;
+
+        for (i = 0; i < 8UL; i++)
+        {
+            ptr_chaChaCtx->state[4UL + i] = lCrypto_ChaChaPoly_Cm4_LoadLe32(&ptr_key[4UL * (i % 4UL)]);
+        }
+    }
+    else
+    {
+        /* "expand 32-byte k" */
+        ptr_chaChaCtx->state[0] = 0x61707865UL;
+        ptr_chaChaCtx->state[1] = 0x3320646eUL;
+        ptr_chaChaCtx->state[2] = 0x79622d32UL;
+        ptr_chaChaCtx->state[3] = 0x6b206574UL;
+
+        for (i = 0; i < 8UL; i++)
+        {
+            ptr_chaChaCtx->state[4UL + i] = lCrypto_ChaChaPoly_Cm4_LoadLe32(&ptr_key[4UL * i]);
+        }
+    }
+    ptr_chaChaCtx->left = 0;
+}
+
+void Crypto_ChaCha20_Cm4_SetIv(CRYPTO_CHACHA20_CM4_CTX *ptr_chaChaCtx, const uint8_t *ptr_nonce, uint32_t counter)
+{
+    ptr_chaChaCtx->state[12] = counter;
+    ptr_chaChaCtx->state[13] = lCrypto_ChaChaPoly_Cm4_LoadLe32(&ptr_nonce[0]);
+    ptr_chaChaCtx->state[14] = lCrypto_ChaChaPoly_Cm4_LoadLe32(&ptr_nonce[4]);
+    ptr_chaChaCtx->state[15] = lCrypto_ChaChaPoly_Cm4_LoadLe32(&ptr_nonce[8]);
+    ptr_chaChaCtx->left = 0;
+}
+
+void Crypto_ChaCha20_Cm4_Process(CRYPTO_CHACHA20_CM4_CTX *ptr_chaChaCtx, uint8_t *ptr_outData, const uint8_t *ptr_inputData, uint32_t dataLen)
+{
+    uint32_t i;
+
+    /* Use up the key stream left over by the previous call */
+    while ((dataLen > 0UL) && (ptr_chaChaCtx->left > 0UL))
+    {
+        *ptr_outData = *ptr_inputData ^ lCrypto_ChaCha20_Cm4_KeyStreamByte(ptr_chaChaCtx->keyStream, 64UL - ptr_chaChaCtx->left);
+        ptr_outData++;
+        ptr_inputData++;
+        ptr_chaChaCtx->left--;
+        dataLen--;
+    }
+
+    while (dataLen >= 64UL)
+    {
+        lCrypto_ChaCha20_Cm4_Block(ptr_chaChaCtx->state, ptr_chaChaCtx->keyStream);
+        ptr_chaChaCtx->state[12]++;
+        lCrypto_ChaCha20_Cm4_Xor64(ptr_outData, ptr_inputData, ptr_chaChaCtx->keyStream);
+        ptr_outData = &ptr_outData[64];
+        ptr_inputData = &ptr_inputData[64];
+        dataLen -= 64UL;
+    }
+
+    if (dataLen > 0UL)
+    {
+        lCrypto_ChaCha20_Cm4_Block(ptr_chaChaCtx->state, ptr_chaChaCtx->keyStream);
+        ptr_chaChaCtx->state[12]++;
+        for (i = 0; i < dataLen; i++)
+        {
+            ptr_outData[i] = ptr_inputData[i] ^ lCrypto_ChaCha20_Cm4_KeyStreamByte(ptr_chaChaCtx->keyStream, i);
+        }
+        ptr_chaChaCtx->left = 64UL - dataLen;
+    }
+}
+
+void Crypto_Poly1305_Cm4_Init(CRYPTO_POLY1305_CM4_CTX *ptr_polyCtx, const uint8_t *ptr_key)
+{
+    /* r &= 0x0ffffffc0ffffffc0ffffffc0fffffff */
+    ptr_polyCtx->r[0] = lCrypto_ChaChaPoly_Cm4_LoadLe32(&ptr_key[0]) & 0x0FFFFFFFUL;
+    ptr_polyCtx->r[1] = lCrypto_ChaChaPoly_Cm4_LoadLe32(&ptr_key[4]) & 0x0FFFFFFCUL;
+    ptr_polyCtx->r[2] = lCrypto_ChaChaPoly_Cm4_LoadLe32(&ptr_key[8]) & 0x0FFFFFFCUL;
+    ptr_polyCtx->r[3] = lCrypto_ChaChaPoly_Cm4_LoadLe32(&ptr_key[12]) & 0x0FFFFFFCUL;
+
+    ptr_polyCtx->s[0] = lCrypto_ChaChaPoly_Cm4_LoadLe32(&ptr_key[16]);
+    ptr_polyCtx->s[1] = lCrypto_ChaChaPoly_Cm4_LoadLe32(&ptr_key[20]);
+    ptr_polyCtx->s[2] = lCrypto_ChaChaPoly_Cm4_LoadLe32(&ptr_key[24]);
+    ptr_polyCtx->s[3] = lCrypto_ChaChaPoly_Cm4_LoadLe32(&ptr_key[28]);
+
+    (void) memset(ptr_polyCtx->h, 0, sizeof(ptr_polyCtx->h));
+    ptr_polyCtx->leftover = 0;
+}
+
+void Crypto_Poly1305_Cm4_Update(CRYPTO_POLY1305_CM4_CTX *ptr_polyCtx, const uint8_t *ptr_data, uint32_t dataLen)
+{
+    uint32_t chunk;
+
+    if (ptr_polyCtx->leftover > 0UL)
+    {
+        chunk = 16UL - ptr_polyCtx->leftover;
+        if (chunk > dataLen)
+        {
+            chunk = dataLen;
+        }
+        (void) memcpy(&ptr_polyCtx->buffer[ptr_polyCtx->leftover], ptr_data, chunk);
+        ptr_polyCtx->leftover += chunk;
+        ptr_data = &ptr_data[chunk];
+        dataLen -= chunk;
+
+        if (ptr_polyCtx->leftover < 16UL)
+        {
+            return;
+        }
+        lCrypto_Poly1305_Cm4_Blocks(ptr_polyCtx, ptr_polyCtx->buffer, 16UL, 1UL);
+        ptr_polyCtx->leftover = 0;
+    }
+
+    chunk = dataLen & ~15UL;
+    if (chunk > 0UL)
+    {
+        lCrypto_Poly1305_Cm4_Blocks(ptr_polyCtx, ptr_data, chunk, 1UL);
+        ptr_data = &ptr_data[chunk];
+        dataLen -= chunk;
+    }
+
+    if (dataLen > 0UL)
+    {
+        (void) memcpy(ptr_polyCtx->buffer, ptr_data, dataLen);
+        ptr_polyCtx->leftover = dataLen;
+    }
+}
+
+void Crypto_Poly1305_Cm4_Final(CRYPTO_POLY1305_CM4_CTX *ptr_polyCtx, uint8_t *ptr_tag)
+{
+    uint32_t h0, h1, h2, h3, h4;
+    uint32_t g0, g1, g2, g3, g4, mask;
+    uint64_t d;
+
+    /* Last partial block is padded with a single 1 bit, no 2^128 bit */
+    if (ptr_polyCtx->leftover > 0UL)
+    {
+        ptr_polyCtx->buffer[ptr_polyCtx->leftover] = 1U;
+        (void) memset(&ptr_polyCtx->buffer[ptr_polyCtx->leftover + 1UL], 0, 15UL - ptr_polyCtx->leftover);
+        lCrypto_Poly1305_Cm4_Blocks(ptr_polyCtx, ptr_polyCtx->buffer, 16UL, 0UL);
+    }
+
+    h0 = ptr_polyCtx->h[0];
+    h1 = ptr_polyCtx->h[1];
+    h2 = ptr_polyCtx->h[2];
+    h3 = ptr_polyCtx->h[3];
+    h4 = ptr_polyCtx->h[4];
+
+    /* g = h + 5 - 2^130; keep g when it did not go negative */
+    d = (uint64_t)h0 + 5UL;
+    g0 = (uint32_t)d;
+    d = (uint64_t)h1 + (d >> 32U);
+    g1 = (uint32_t)d;
+    d = (uint64_t)h2 + (d >> 32U);
+    g2 = (uint32_t)d;
+    d = (uint64_t)h3 + (d >> 32U);
+    g3 = (uint32_t)d;
+    g4 = h4 + (uint32_t)(d >> 32U);
+
+    mask = 0UL - (g4 >> 2U);
+    h0 = (h0 & ~mask) | (g0 & mask);
+    h1 = (h1 & ~mask) | (g1 & mask);
+    h2 = (h2 & ~mask) | (g2 & mask);
+    h3 = (h3 & ~mask) | (g3 & mask);
+
+    /* tag = (h + s) mod 2^128 */
+    d = (uint64_t)h0 + ptr_polyCtx->s[0];
+    lCrypto_ChaChaPoly_Cm4_StoreLe32(&ptr_tag[0], (uint32_t)d);
+    d = (uint64_t)h1 + ptr_polyCtx->s[1] + (d >> 32U);
+    lCrypto_ChaChaPoly_Cm4_StoreLe32(&ptr_tag[4], (uint32_t)d);
+    d = (uint64_t)h2 + ptr_polyCtx->s[2] + (d >> 32U);
+    lCrypto_ChaChaPoly_Cm4_StoreLe32(&ptr_tag[8], (uint32_t)d);
+    d = (uint64_t)h3 + ptr_polyCtx->s[3] + (d >> 32U);
+    lCrypto_ChaChaPoly_Cm4_StoreLe32(&ptr_tag[12], (uint32_t)d);
+
+    (void) memset(ptr_polyCtx, 0, sizeof(CRYPTO_POLY1305_CM4_CTX));
+}
+
+#endif /* CRYPTO_CHACHA_POLY_CM4 */
+// *****************************************************************************
@@ -21,6 +21,7 @@
     files.
 *******************************************************************************/
 
+#include <string.h>
 #include "crypto/common_crypto/crypto_sym_cipher.h"
 #include "crypto/wolfcrypt/crypto_sym_wc_wrapper.h"
 #include "wolfssl/wolfcrypt/aes.h"
@@ -28,6 +29,7 @@
 #include "wolfssl/wolfcrypt/des3.h"
 #include "wolfssl/wolfcrypt/chacha.h"
 #include "wolfssl/wolfcrypt/error-crypt.h"
+#include "crypto/wolfcrypt/crypto_chacha_poly_cm4.h"
 
 // *****************************************************************************
 // *****************************************************************************
@@ -1134,6 +1136,69 @@ crypto_Sym_Status_E Crypto_Sym_Wc_AesKeyUnWrapDirect(uint8_t *ptr_inputData, uin
 }
 
 //ChaCha20
+#ifdef CRYPTO_CHACHA_POLY_CM4
+/* The 16-byte IV carries the 96-bit nonce followed by the big-endian initial
+ * block counter, the same layout the portable wolfCrypt path uses. */
+static uint32_t lCrypto_Sym_Wc_ChaCha_Counter(uint8_t *ptr_initVect)
+{
+    return ( ((uint32_t)ptr_initVect[12]<<24u) | ((uint32_t)ptr_initVect[13]<<16u) | ((uint32_t)ptr_initVect[14] << 8u) | ((uint32_t)ptr_initVect[15]) );
+}
+
+crypto_Sym_Status_E Crypto_Sym_Wc_ChaCha_Init(void *ptr_chaChaCtx, uint8_t *ptr_key, uint32_t keySize, uint8_t *ptr_initVect)
+{
+    crypto_Sym_Status_E ret_chaChaStat_en = CRYPTO_SYM_ERROR_CIPNOTSUPPTD;
+    
+    if(ptr_chaChaCtx == NULL)
+    {
+        ret_chaChaStat_en = CRYPTO_SYM_ERROR_CTX;
+    }
+    else if( (ptr_key == NULL) || ( (keySize != CRYPTO_CHACHA20_CM4_KEYSIZE) && (keySize != CRYPTO_CHACHA20_CM4_KEYSIZE_128) ) )
+    {
+        ret_chaChaStat_en = CRYPTO_SYM_ERROR_KEY;
+    }
+    else if(ptr_initVect == NULL)
+    {
+        ret_chaChaStat_en = CRYPTO_SYM_ERROR_ARG;
+    }
+    else
+    {
+        Crypto_ChaCha20_Cm4_SetKey((CRYPTO_CHACHA20_CM4_CTX*)ptr_chaChaCtx, (const uint8_t*)ptr_key, keySize);
+        Crypto_ChaCha20_Cm4_SetIv((CRYPTO_CHACHA20_CM4_CTX*)ptr_chaChaCtx, (const uint8_t*)ptr_initVect, lCrypto_Sym_Wc_ChaCha_Counter(ptr_initVect));
+        ret_chaChaStat_en = CRYPTO_SYM_CIPHER_SUCCESS;
+    }
+    return ret_chaChaStat_en;
+}
+
+crypto_Sym_Status_E Crypto_Sym_Wc_ChaChaUpdate(void *ptr_chaChaCtx, uint8_t *ptr_inputData, uint32_t dataLen, uint8_t *ptr_outData)
+{
+    crypto_Sym_Status_E ret_chaChaStat_en = CRYPTO_SYM_ERROR_CIPNOTSUPPTD; 
+    
+    if( (ptr_chaChaCtx != NULL) && (ptr_inputData != NULL) && (dataLen > 0u) && (ptr_outData != NULL) )
+    {
+        Crypto_ChaCha20_Cm4_Process((CRYPTO_CHACHA20_CM4_CTX*)ptr_chaChaCtx, ptr_outData, (const uint8_t*)ptr_inputData, dataLen);
+        ret_chaChaStat_en = CRYPTO_SYM_CIPHER_SUCCESS;
+    }
+    else
+    {
+        ret_chaChaStat_en = CRYPTO_SYM_ERROR_ARG;
+    }
+    return ret_chaChaStat_en;
+}
+
+crypto_Sym_Status_E Crypto_Sym_Wc_ChaChaDirect(uint8_t *ptr_inputData, uint32_t dataLen, uint8_t *ptr_outData, uint8_t *ptr_key, uint32_t keySize, uint8_t *ptr_initVect)
+{
+    crypto_Sym_Status_E ret_chaChaStat_en = CRYPTO_SYM_ERROR_CIPNOTSUPPTD;
+    CRYPTO_CHACHA20_CM4_CTX chaChaCtx;
+    
+    ret_chaChaStat_en = Crypto_Sym_Wc_ChaCha_Init(&chaChaCtx, ptr_key, keySize, ptr_initVect);
+    if(ret_chaChaStat_en == CRYPTO_SYM_CIPHER_SUCCESS)
+    {
+        ret_chaChaStat_en = Crypto_Sym_Wc_ChaChaUpdate(&chaChaCtx, ptr_inputData, dataLen, ptr_outData);
+    }
+    (void) memset(&chaChaCtx, 0, sizeof(chaChaCtx));
+    return ret_chaChaStat_en;
+}
+#else
 crypto_Sym_Status_E Crypto_Sym_Wc_ChaCha_Init(void *ptr_chaChaCtx, uint8_t *ptr_key, uint32_t keySize, uint8_t *ptr_initVect)
 {
     crypto_Sym_Status_E ret_chaChaStat_en = CRYPTO_SYM_ERROR_CIPNOTSUPPTD;   
@@ -1243,3 +1308,4 @@ crypto_Sym_Status_E Crypto_Sym_Wc_ChaChaDirect(uint8_t *ptr_inputData, uint32_t
     }   
     return ret_chaChaStat_en;
 }
+#endif /* CRYPTO_CHACHA_POLY_CM4 */
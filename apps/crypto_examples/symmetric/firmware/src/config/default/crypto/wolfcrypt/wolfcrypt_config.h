@@ -120,7 +120,8 @@ extern "C" {
 #define WC_ECC_NONBLOCK      //JK
 
 #define NO_PWDBASED
-//#define WOLF_CRYPTO_CB     //Provide call-back support 
+#define WOLF_CRYPTO_CB     //Provide call-back support 
+#define CRYPTO_CRYPTOCB_HW_AES      //AES-ECB/CBC on the AES6149, crypto_cryptocb_wc_wrapper.c
 #define WOLFCRYPT_ONLY
 #define HAVE_COMP_KEY        //JK 
 
@@ -188,6 +189,9 @@ extern "C" {
 #define HAVE_BLAKE2S    
 #define HAVE_BLAKE2B   
 #define HAVE_CHACHA      
+//Cortex-M4 ChaCha20 block and Poly1305 (UMAAL) kernels for the wolfCrypt
+//handler; comment out to fall back to the portable wolfCrypt code
+#define CRYPTO_CHACHA_POLY_CM4
 #define HAVE_AES_KEYWRAP
 #define HAVE_ECC_DHE   
 //#define WOLFCRYPT_HAVE_ECCSI  //JK